@@ -0,0 +1,32 @@
+#!/usr/bin/env perl
+# Times the snowball compiler on a synthetic among of many strings, all of
+# the same length so that none is a prefix of another, which was the worst
+# case for finding the longest substring of each.
+#
+# usage: among.pl <snowball> [<number of strings>]
+
+use strict;
+use warnings;
+use Time::HiRes qw(time);
+
+my $snowball = shift @ARGV or die "usage: $0 <snowball> [<number of strings>]\n";
+my $count = shift @ARGV || 200000;
+my $base = "bench_among";
+
+srand(1);
+my %strings;
+while (keys %strings < $count) {
+    $strings{join '', map { chr(ord('a') + int rand 26) } 1 .. 8} = 1;
+}
+
+open OUT, ">", "$base.sbl" or die "Can't open $base.sbl: $!\n";
+print OUT "externals ( stem )\n";
+print OUT "define stem as ( [substring] among (\n";
+print OUT "    '$_'\n" for sort keys %strings;
+print OUT ") delete )\n";
+close OUT or die "Can't close $base.sbl: $!\n";
+
+my $start = time;
+system($snowball, "$base.sbl", "-o", $base) == 0 or die "$snowball failed\n";
+printf "%d strings: %.2fs\n", $count, time - $start;
+unlink "$base.sbl", "$base.c", "$base.h";
@@ -0,0 +1,61 @@
+#!/usr/bin/env perl
+# Compares an algorithm compiled to C with the same algorithm compiled by
+# snowball -bytecode and run by sb_stemmer_new_from_file(): the time to
+# start up, and the time to stem a vocabulary (repeated to give a measurable
+# time), checking that the stems are the same.
+#
+# usage: bytecode.pl <snowball> <stemwords> <algorithm> <vocabulary> [<repeats>]
+
+use strict;
+use warnings;
+use Time::HiRes qw(time);
+
+my ($snowball, $stemwords, $algorithm, $voc, $repeats) = @ARGV;
+defined $voc or die "usage: $0 <snowball> <stemwords> <algorithm> <vocabulary> [<repeats>]\n";
+$repeats ||= 10;
+my $base = "bench_bytecode";
+
+my $source = "algorithms/$algorithm/stem_Unicode.sbl";
+$source = "algorithms/$algorithm/stem_ISO_8859_1.sbl" unless -f $source;
+system($snowball, $source, "-u", "-bytecode", "-o", $base) == 0
+    or die "$snowball failed\n";
+
+open IN, "<", $voc or die "Can't open $voc: $!\n";
+my @words = <IN>;
+close IN;
+open OUT, ">", "$base.txt" or die "Can't open $base.txt: $!\n";
+print OUT @words for 1 .. $repeats;
+close OUT or die "Can't close $base.txt: $!\n";
+open OUT, ">", "$base.empty" or die "Can't open $base.empty: $!\n";
+close OUT;
+
+# Runs stemwords with the given options, returning the best of three times.
+sub run {
+    my ($input, $output, @options) = @_;
+    my $best;
+    for (1 .. 3) {
+        my $start = time;
+        system($stemwords, @options, "-i", $input, "-o", $output) == 0
+            or die "$stemwords failed\n";
+        my $t = time - $start;
+        $best = $t if !defined $best || $t < $best;
+    }
+    return $best;
+}
+
+my @c = ("-l", $algorithm);
+my @bc = ("-f", "$base.sbc");
+my $c_start = run("$base.empty", "$base.out1", @c);
+my $bc_start = run("$base.empty", "$base.out2", @bc);
+my $c_time = run("$base.txt", "$base.out1", @c);
+my $bc_time = run("$base.txt", "$base.out2", @bc);
+system("cmp", "-s", "$base.out1", "$base.out2") == 0
+    or die "the stems of the bytecode differ from those of the C\n";
+
+my $n = @words * $repeats;
+printf "%s, %d words\n", $algorithm, $n;
+printf "start up: C %.4fs, bytecode %.4fs\n", $c_start, $bc_start;
+printf "C:        %.2fs, %.0f words/s\n", $c_time, $n / $c_time;
+printf "bytecode: %.2fs, %.0f words/s (%.2f times as long)\n",
+    $bc_time, $n / $bc_time, $bc_time / $c_time;
+unlink map { "$base.$_" } qw(sbc txt empty out1 out2);
@@ -0,0 +1,32 @@
+#!/usr/bin/env perl
+# Times the snowball compiler on a synthetic source with many stringdefs,
+# as made by tools which name each Unicode character, and a long among
+# whose strings refer to them, which was quadratic while the stringdefs
+# were kept in a list.
+#
+# usage: stringdefs.pl <snowball> [<number of stringdefs>]
+
+use strict;
+use warnings;
+use Time::HiRes qw(time);
+
+my $snowball = shift @ARGV or die "usage: $0 <snowball> [<number of stringdefs>]\n";
+my $count = shift @ARGV || 20000;
+my $base = "bench_stringdefs";
+
+open OUT, ">", "$base.sbl" or die "Can't open $base.sbl: $!\n";
+print OUT "stringescapes {}\n";
+printf OUT "stringdef u%d hex '%X'\n", $_, 0x4E00 + $_ for 0 .. $count - 1;
+print OUT "externals ( stem )\n";
+print OUT "define stem as ( [substring] among (\n";
+for my $i (0 .. $count - 1) {
+    my $j = ($i * 7919 + 1) % $count;
+    print OUT "    '{u$i}{u$j}'\n";
+}
+print OUT ") delete )\n";
+close OUT or die "Can't close $base.sbl: $!\n";
+
+my $start = time;
+system($snowball, "$base.sbl", "-u", "-o", $base) == 0 or die "$snowball failed\n";
+printf "%d stringdefs: %.2fs\n", $count, time - $start;
+unlink "$base.sbl", "$base.c", "$base.h";
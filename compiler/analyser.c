@@ -1,4 +1,5 @@
 
+#include <limits.h>  /* INT_MAX */
 #include <stdio.h>   /* printf etc */
 #include <stdlib.h>  /* exit */
 #include <string.h>  /* memmove */
@@ -11,7 +12,14 @@ static struct node * read_C(struct analyser * a);
 static struct node * C_style(struct analyser * a, char * s, int token);
 
 
-static void fault(int n) { fprintf(stderr, "fault %d\n", n); exit(1); }
+static void fault(int n) {
+    struct str * text = str_new();
+    str_append_string(text, "fault ");
+    str_append_int(text, n);
+    report(0, 0, false, text);
+    str_delete(text);
+    fatal();
+}
 
 static void print_node_(struct node * p, int n, const char * s) {
 
@@ -36,7 +44,7 @@ extern void print_program(struct analyser * a) {
 }
 
 static struct node * new_node(struct analyser * a, int type) {
-    NEW(node, p);
+    ARENA_NEW(a->arena, node, p);
     p->next = a->nodes; a->nodes = p;
     p->left = 0;
     p->right = 0;
@@ -46,7 +54,10 @@ static struct node * new_node(struct analyser * a, int type) {
     p->literalstring = 0;
     p->mode = a->mode;
     p->line_number = a->tokeniser->line_number;
+    p->file = a->tokeniser->file;
     p->type = type;
+    p->keep = -1;
+    p->can_fail = p->moves = p->moves_on_fail = true;
     return p;
 }
 
@@ -70,87 +81,107 @@ static const char * name_of_type(int n) {
     }
 }
 
-static void count_error(struct analyser * a) {
-    struct tokeniser * t = a->tokeniser;
-    if (t->error_count >= 20) { fprintf(stderr, "... etc\n"); exit(1); }
-    t->error_count++;
-}
-
 static void error2(struct analyser * a, int n, int x) {
     struct tokeniser * t = a->tokeniser;
-    count_error(a);
-    fprintf(stderr, "%s:%d: ", t->file, t->line_number);
-    if (n >= 30) report_b(stderr, t->b);
+    struct str * text;
+    unless (count_error(t)) return;
+    text = str_new();
+    if (n >= 30) str_append_b(text, t->b);
     switch (n) {
         case 0:
-            fprintf(stderr, "%s omitted", name_of_token(t->omission)); break;
+            str_append_string(text, name_of_token(t->omission));
+            str_append_string(text, " omitted"); break;
         case 3:
-            fprintf(stderr, "in among(...), ");
+            str_append_string(text, "in among(...), ");
         case 1:
-            fprintf(stderr, "unexpected %s", name_of_token(t->token));
-            if (t->token == c_number) fprintf(stderr, " %d", t->number);
+            str_append_string(text, "unexpected ");
+            str_append_string(text, name_of_token(t->token));
+            if (t->token == c_number) {
+                str_append_ch(text, ' ');
+                str_append_int(text, t->number);
+            }
             if (t->token == c_name) {
-                fprintf(stderr, " ");
-                report_b(stderr, t->b);
+                str_append_ch(text, ' ');
+                str_append_b(text, t->b);
             } break;
         case 2:
-            fprintf(stderr, "string omitted"); break;
+            str_append_string(text, "string omitted"); break;
 
         case 14:
-            fprintf(stderr, "unresolved substring on line %d", x); break;
+            str_append_string(text, "unresolved substring on line ");
+            str_append_int(text, x); break;
         case 15:
-            fprintf(stderr, "%s not allowed inside reverse(...)", name_of_token(t->token)); break;
+            str_append_string(text, name_of_token(t->token));
+            str_append_string(text, " not allowed inside reverse(...)"); break;
         case 16:
-            fprintf(stderr, "empty grouping"); break;
+            str_append_string(text, "empty grouping"); break;
         case 17:
-            fprintf(stderr, "backwards used when already in this mode"); break;
+            str_append_string(text, "backwards used when already in this mode"); break;
         case 18:
-            fprintf(stderr, "empty among(...)"); break;
+            str_append_string(text, "empty among(...)"); break;
         case 19:
-            fprintf(stderr, "two adjacent bracketed expressions in among(...)"); break;
+            str_append_string(text, "two adjacent bracketed expressions in among(...)"); break;
         case 20:
-            fprintf(stderr, "substring preceded by another substring on line %d", x); break;
+            str_append_string(text, "substring preceded by another substring on line ");
+            str_append_int(text, x); break;
 
         case 30:
-            fprintf(stderr, " re-declared"); break;
+            str_append_string(text, " re-declared"); break;
         case 31:
-            fprintf(stderr, " undeclared"); break;
+            str_append_string(text, " undeclared"); break;
         case 32:
-            fprintf(stderr, " declared as %s mode; used as %s mode",
-                            name_of_mode(a->mode), name_of_mode(x)); break;
+            str_append_string(text, " declared as ");
+            str_append_string(text, name_of_mode(a->mode));
+            str_append_string(text, " mode; used as ");
+            str_append_string(text, name_of_mode(x));
+            str_append_string(text, " mode"); break;
         case 33:
-            fprintf(stderr, " not of type %s", name_of_type(x)); break;
+            str_append_string(text, " not of type ");
+            str_append_string(text, name_of_type(x)); break;
         case 34:
-            fprintf(stderr, " not of type string or integer"); break;
+            str_append_string(text, " not of type string or integer"); break;
         case 35:
-            fprintf(stderr, " misplaced"); break;
+            str_append_string(text, " misplaced"); break;
         case 36:
-            fprintf(stderr, " redefined"); break;
+            str_append_string(text, " redefined"); break;
         case 37:
-            fprintf(stderr, " mis-used as %s mode",
-                            name_of_mode(x)); break;
+            str_append_string(text, " mis-used as ");
+            str_append_string(text, name_of_mode(x));
+            str_append_string(text, " mode"); break;
         default:
-            fprintf(stderr, " error %d", n); break;
+            str_append_string(text, " error ");
+            str_append_int(text, n); break;
 
     }
-    if (n <= 13 && t->previous_token > 0)
-        fprintf(stderr, " after %s", name_of_token(t->previous_token));
-    fprintf(stderr, "\n");
+    if (n <= 13 && t->previous_token > 0) {
+        str_append_string(text, " after ");
+        str_append_string(text, name_of_token(t->previous_token));
+    }
+    report(t->file, t->line_number, false, text);
+    str_delete(text);
 }
 
 static void error(struct analyser * a, int n) { error2(a, n, 0); }
 
 static void error3(struct analyser * a, struct node * p, symbol * b) {
-    count_error(a);
-    fprintf(stderr, "%s:%d: among(...) has repeated string '", a->tokeniser->file, p->line_number);
-    report_b(stderr, b);
-    fprintf(stderr, "'\n");
+    struct str * text;
+    unless (count_error(a->tokeniser)) return;
+    text = str_new();
+    str_append_string(text, "among(...) has repeated string '");
+    str_append_b(text, b);
+    str_append_ch(text, '\'');
+    report(a->tokeniser->file, p->line_number, false, text);
+    str_delete(text);
 }
 
 static void error4(struct analyser * a, struct name * q) {
-    count_error(a);
-    report_b(stderr, q->b);
-    fprintf(stderr, " undefined\n");
+    struct str * text;
+    unless (count_error(a->tokeniser)) return;
+    text = str_new();
+    str_append_b(text, q->b);
+    str_append_string(text, " undefined");
+    report(a->tokeniser->file, 0, false, text);
+    str_delete(text);
 }
 
 static void omission_error(struct analyser * a, int n) {
@@ -220,13 +251,17 @@ static void read_names(struct analyser * a, int type) {
     repeat {
         if (read_token(t) != c_name) break;
         if (look_for_name(a) != 0) error(a, 30); else {
-            NEW(name, p);
-            p->b = copy_b(t->b);
+            ARENA_NEW(a->arena, name, p);
+            p->b = arena_copy_b(a->arena, t->b);
             p->type = type;
             p->mode = -1; /* routines, externals */
             p->count = a->name_count[type];
             p->referenced = false;
             p->used = false;
+            p->short_word_limit = 0;
+            p->short_word_symbols = 0;
+            p->hotwords = false;
+            p->max_growth = -1;
             p->grouping = 0;
             p->definition = 0;
             a->name_count[type] ++;
@@ -238,11 +273,7 @@ static void read_names(struct analyser * a, int type) {
 }
 
 static symbol * new_literalstring(struct analyser * a) {
-    NEW(literalstring, p);
-    p->b = copy_b(a->tokeniser->b);
-    p->next = a->literalstrings;
-    a->literalstrings = p;
-    return p->b;
+    return arena_copy_b(a->arena, a->tokeniser->b);
 }
 
 static int read_AE_test(struct analyser * a) {
@@ -429,8 +460,8 @@ static int compare_amongvec(const void *pv, const void *qv) {
 
 static void make_among(struct analyser * a, struct node * p, struct node * substring) {
 
-    NEW(among, x);
-    NEWVEC(amongvec, v, p->number);
+    ARENA_NEW(a->arena, among, x);
+    ARENA_NEWVEC(a->arena, amongvec, v, p->number);
     struct node * q = p->left;
     struct amongvec * w0 = v;
     struct amongvec * w1 = v;
@@ -474,28 +505,52 @@ static void make_among(struct analyser * a, struct node * p, struct node * subst
         }
         q = q->right;
     }
-    unless (w1-v == p->number) { fprintf(stderr, "oh! %d %d\n", (int)(w1-v), p->number); exit(1); }
+    unless (w1-v == p->number) fault(2);
     if (backward) for (w0 = v; w0 < w1; w0++) reverse_b(w0->b);
     qsort(v, w1 - v, sizeof(struct amongvec), compare_amongvec);
 
-    /* the following loop is O(n squared) */
-    for (w0 = w1 - 1; w0 >= v; w0--) {
-        symbol * b = w0->b;
-        int size = w0->size;
-        struct amongvec * w;
-
-        for (w = w0 - 1; w >= v; w--) {
-            if (w->size < size && memcmp(w->b, b, w->size * sizeof(symbol)) == 0) {
-                w0->i = w - v;  /* fill in index of longest substring */
-                break;
+    /* Fill in the index of the longest substring, and find repeated
+     * strings. In sorted order, a string follows its prefixes, so those of
+     * the strings so far which are prefixes of the current one are kept on
+     * a stack, each a prefix of the one above it. Each string is pushed and
+     * popped once, so this is O(n) after the sort. */
+    {   int * stack = (int *) MALLOC((p->number + 1) * sizeof(int));
+        int top = 0;
+        for (w0 = v; w0 < w1; w0++) {
+            until (top == 0) {
+                struct amongvec * w = v + stack[top - 1];
+                if (w->size <= w0->size &&
+                    memcmp(w->b, w0->b, w->size * sizeof(symbol)) == 0) break;
+                top--;
+            }
+            if (top > 0 && v[stack[top - 1]].size == w0->size) {
+                symbol * b = copy_b(w0->b);
+                if (backward) reverse_b(b);
+                error3(a, p, b);
+                lose_b(b);
+                top--;
             }
+            if (top > 0) w0->i = stack[top - 1];
+            stack[top++] = w0 - v;
         }
+        FREE(stack);
     }
     if (backward) for (w0 = v; w0 < w1; w0++) reverse_b(w0->b);
 
-    for (w0 = v; w0 < w1 - 1; w0++)
-        if (w0->size == (w0 + 1)->size &&
-            memcmp(w0->b, (w0 + 1)->b, w0->size * sizeof(symbol)) == 0) error3(a, p, w0->b);
+    /* functions[k] is the routine numbered k + 1 */
+    x->function_count = 0;
+    {   struct name ** functions = (struct name **) MALLOC((p->number + 1) * sizeof(struct name *));
+        for (w0 = v; w0 < w1; w0++) {
+            int k;
+            w0->function_id = 0;
+            if (w0->function == 0) continue;
+            for (k = 0; k < x->function_count; k++)
+                if (functions[k] == w0->function) break;
+            if (k == x->function_count) functions[x->function_count++] = w0->function;
+            w0->function_id = k + 1;
+        }
+        FREE(functions);
+    }
 
     x->literalstring_count = p->number;
     x->command_count = result - 1;
@@ -737,7 +792,7 @@ static void read_define_grouping(struct analyser * a, struct name * q) {
     struct tokeniser * t = a->tokeniser;
     int style = c_plus;
     {
-        NEW(grouping, p);
+        ARENA_NEW(a->arena, grouping, p);
         if (a->groupings == 0) a->groupings = p; else a->groupings_end->next = p;
         a->groupings_end = p;
         q->grouping = p;
@@ -849,8 +904,330 @@ static void read_program_(struct analyser * a, int terminator) {
     }
 }
 
+/* The bound on how much longer an external can make the string, found from
+   the string commands it can reach. Each command gets a bound on the change
+   in the length of the string from the start of the command to wherever it
+   exits, and a sequence gets the largest sum over its prefixes, since the
+   changes made before a failure are not undone. Deletions count against
+   insertions when the size of the slice is known, as after
+   '[substring] among' or '['ss']'. Any loop which can lengthen the string
+   leaves it without a bound.
+*/
+
+#define NO_BOUND INT_MAX
+
+struct slice {
+    int size;                   /* the slice has at least this size */
+    struct node * substring;    /* if set, the slice is base + what it matched */
+    int base;
+    int open;                   /* the size matched since '[', or -1 */
+    struct node * open_substring;
+};
+
+static const struct slice unknown_slice = { 0, 0, 0, -1, 0 };
+
+static int add_growth(int x, int y) {
+    return x == NO_BOUND || y == NO_BOUND ? NO_BOUND : x + y;
+}
+
+static int touches(struct node * p, int ket, int depth);
+
+static int touches_list(struct node * p, int ket, int depth) {
+    until (p == 0) {
+        if (touches(p, ket, depth)) return true;
+        p = p->right;
+    }
+    return false;
+}
+
+/* Whether p can set bra or ket, or make the slice shorter. If ket is false,
+   whether it can do so other than by ']', or alter the string: either way,
+   a '[' before p still marks the same place after it. Routines are looked
+   into to the given depth of calls. */
+static int touches(struct node * p, int ket, int depth) {
+    if (p == 0) return false;
+    switch (p->type) {
+        case c_rightslice:
+            return ket;
+        case c_insert:
+        case c_attach:
+            unless (ket) return true;
+            break;
+        case c_call:
+            return depth == 0 || p->name->definition == 0 ||
+                   touches(p->name->definition, ket, depth - 1);
+        case c_leftslice:
+        case c_slicefrom:
+        case c_delete:
+        case c_assign:
+        case c_dollar:
+            return true;
+        case c_among:
+            if (p->among->function_count > 0) return true;
+            break;
+    }
+    return touches_list(p->left, ket, depth) || touches(p->aux, ket, depth);
+}
+
+static int touches_slice(struct node * p) { return touches(p, true, 1); }
+
+static int never_fails(struct node * p) {
+    switch (p->type) {
+        case c_slicefrom:
+        case c_delete:
+        case c_insert:
+        case c_attach:
+        case c_assign:
+        case c_leftslice:
+        case c_rightslice:
+        case c_setmark:
+        case c_set:
+        case c_unset:
+        case c_true:
+        case c_try:
+        case c_do:
+        case c_repeat:
+            return true;
+    }
+    return false;
+}
+
+/* Whether p can fail after doing what touches(p, false) looks for. */
+static int touches_before_failing(struct node * p) {
+    struct node * q;
+    struct node * last = 0;
+    unless (p->type == c_bra) return touches(p, false, 1);
+    for (q = p->left; q != 0; q = q->right)
+        unless (never_fails(q)) last = q;
+    for (q = p->left; q != 0 && last != 0; q = q->right) {
+        if (touches(q, false, 1)) return true;
+        if (q == last) break;
+    }
+    return false;
+}
+
+/* How far c moves over the string when p succeeds, or -1 if that can't be
+   known. */
+static int matched_size(struct node * p) {
+    switch (p->type) {
+        case c_literalstring: return SIZE(p->literalstring);
+        case c_next:
+        case c_grouping:
+        case c_non:
+            return 1;
+        case c_hop:
+            return p->AE->type == c_number && p->AE->number > 0 ? p->AE->number : 0;
+        case c_substring:
+        case c_name:
+        case c_booltest:
+        case c_atmark:
+        case c_atlimit:
+        case c_setmark:
+        case c_true:
+            return 0;
+    }
+    return -1;
+}
+
+static int routine_growth(struct name * q);
+static int growth(struct node * p, struct slice * s);
+
+static int growth_list(struct node * p, struct slice * s) {
+    int total = 0;
+    int max = 0;
+    until (p == 0) {
+        total = add_growth(total, growth(p, s));
+        if (total > max) max = total;
+        p = p->right;
+    }
+    return max;
+}
+
+static int growth_of_string(struct node * p) {
+    return p->literalstring == 0 ? NO_BOUND : SIZE(p->literalstring);
+}
+
+static int growth_among(struct node * p, struct slice * s) {
+    struct among * x = p->among;
+    int max = 0;
+    int i;
+    for (i = 0; i < x->literalstring_count; i++) {
+        struct amongvec * v = x->b + i;
+        struct slice t = *s;
+        int n = 0;
+        if (x->substring != 0) {
+            t = unknown_slice;
+            if (s->substring == x->substring) t.size = s->base + v->size;
+        }
+        unless (v->function == 0) n = routine_growth(v->function);
+        unless (v->p == 0) n = add_growth(n, growth(v->p, &t));
+        if (n > max) max = n;
+    }
+    unless (x->starter == 0) {
+        struct slice t = *s;
+        max = add_growth(growth(x->starter, &t), max);
+    }
+    *s = unknown_slice;
+    return max;
+}
+
+static int growth(struct node * p, struct slice * s) {
+    if (s->open >= 0 && p->type != c_bra && p->type != c_or && p->type != c_rightslice) {
+        int n = matched_size(p);
+        if (n < 0) s->open = -1; else s->open += n;
+        if (p->type == c_substring) s->open_substring = p;
+    }
+    switch (p->type) {
+        case c_bra:
+        case c_and:
+            return growth_list(p->left, s);
+        case c_or:
+            {
+                struct slice t = *s;
+                struct node * q;
+                int total = 0;
+                int max = 0;
+                for (q = p->left; q != 0; q = q->right) {
+                    struct slice u = t;
+                    total = add_growth(total, growth(q, &u));
+                    if (total > max) max = total;
+                    if (touches_slice(q)) {
+                        int open = t.open;
+                        t = unknown_slice;
+                        unless (touches_before_failing(q)) t.open = open;
+                    }
+                }
+                if (touches_slice(p)) *s = unknown_slice;
+                s->open = -1;
+                return max;
+            }
+        case c_test:
+        case c_reverse:
+        case c_backwards:
+            /* these succeed only if p->left does */
+            return growth(p->left, s);
+        case c_not:
+        case c_try:
+        case c_do:
+        case c_fail:
+            {
+                struct slice t = *s;
+                int n = growth(p->left, &t);
+                if (touches_slice(p)) *s = unknown_slice;
+                return n;
+            }
+        case c_goto:
+        case c_gopast:
+            {
+                struct slice t = touches_slice(p->left) ? unknown_slice : *s;
+                int n = growth(p->left, &t);
+                *s = t;
+                return n <= 0 ? 0 : NO_BOUND;
+            }
+        case c_repeat:
+        case c_atleast:
+        case c_loop:
+            {
+                struct slice t = touches_slice(p->left) ? unknown_slice : *s;
+                int n = growth(p->left, &t);
+                if (touches_slice(p)) *s = unknown_slice;
+                if (n <= 0) return 0;
+                if (p->type == c_loop && n != NO_BOUND && p->AE->type == c_number &&
+                    p->AE->number <= INT_MAX / n) return p->AE->number * n;
+                return NO_BOUND;
+            }
+        case c_setlimit:
+            {
+                int n = growth(p->left, s);
+                int m = add_growth(n, growth(p->aux, s));
+                return m > n ? m : n;
+            }
+        case c_dollar:
+            /* this works on another string */
+            *s = unknown_slice;
+            return 0;
+        case c_call:
+            if (touches_slice(p)) *s = unknown_slice;
+            return routine_growth(p->name);
+        case c_among:
+            return growth_among(p, s);
+        case c_leftslice:
+            *s = unknown_slice;
+            s->open = 0;
+            return 0;
+        case c_rightslice:
+            {
+                struct slice t = unknown_slice;
+                if (s->open >= 0) {
+                    t.size = t.base = s->open;
+                    t.substring = s->open_substring;
+                }
+                *s = t;
+                return 0;
+            }
+        case c_slicefrom:
+            {
+                int n = growth_of_string(p);
+                int size = s->size;
+                *s = unknown_slice;
+                if (n == NO_BOUND) return n;
+                s->size = n;
+                return n - size;
+            }
+        case c_delete:
+            {
+                int size = s->size;
+                *s = unknown_slice;
+                return -size;
+            }
+        case c_assign:
+            *s = unknown_slice;
+            return growth_of_string(p);
+        case c_insert:
+        case c_attach:
+            return growth_of_string(p);
+    }
+    return 0;
+}
+
+static int routine_growth(struct name * q) {
+    return q->max_growth < 0 ? NO_BOUND : q->max_growth;
+}
+
+/* Starting from no growth, the bounds of the routines are iterated to a
+   fixed point, so that recursion is allowed for. A bound still rising
+   after as many rounds as there are routines comes from a cycle of calls
+   which lengthens the string, and so is dropped. */
+static void find_max_growths(struct analyser * a) {
+    struct name * q;
+    int count = 0;
+    int rounds;
+    for (q = a->names; q != 0; q = q->next) {
+        if (q->type != t_routine && q->type != t_external) continue;
+        unless (q->definition == 0) { q->max_growth = 0; count++; }
+    }
+    for (rounds = 0; ; rounds++) {
+        int changed = false;
+        for (q = a->names; q != 0; q = q->next) {
+            struct slice s = unknown_slice;
+            int n;
+            if (q->type != t_routine && q->type != t_external) continue;
+            if (q->definition == 0 || q->max_growth < 0) continue;
+            n = growth(q->definition, &s);
+            if (n == NO_BOUND || rounds > count) n = -1; else if (n < 0) n = 0;
+            unless (n == q->max_growth) {
+                q->max_growth = n;
+                changed = true;
+            }
+        }
+        unless (changed) break;
+    }
+}
+
 extern void read_program(struct analyser * a) {
     read_program_(a, -1);
+    a->source_hash[0] = a->tokeniser->source_hash[0];
+    a->source_hash[1] = a->tokeniser->source_hash[1];
     {
         struct name * q = a->names;
         until (q == 0) {
@@ -866,42 +1243,41 @@ extern void read_program(struct analyser * a) {
 
     if (a->tokeniser->error_count == 0) {
         struct name * q = a->names;
-        int warned = false;
+        struct str * text = str_new();
         until (q == 0) {
             unless (q->referenced) {
-                unless (warned) {
-                    fprintf(stderr, "Declared but not used:");
-                    warned = true;
-                }
-                fprintf(stderr, " "); report_b(stderr, q->b);
+                if (str_len(text) == 0) str_append_string(text, "Declared but not used:");
+                str_append_ch(text, ' ');
+                str_append_b(text, q->b);
             }
             q = q->next;
         }
-        if (warned) fprintf(stderr, "\n");
+        if (str_len(text) > 0) report(a->tokeniser->file, 0, true, text);
 
         q = a->names;
-        warned = false;
+        str_clear(text);
         until (q == 0) {
             if (! q->used && (q->type == t_routine ||
                               q->type == t_grouping)) {
-                unless (warned) {
-                    fprintf(stderr, "Declared and defined but not used:");
-                    warned = true;
-                }
-                fprintf(stderr, " "); report_b(stderr, q->b);
+                if (str_len(text) == 0) str_append_string(text, "Declared and defined but not used:");
+                str_append_ch(text, ' ');
+                str_append_b(text, q->b);
             }
             q = q->next;
         }
-        if (warned) fprintf(stderr, "\n");
+        if (str_len(text) > 0) report(a->tokeniser->file, 0, true, text);
+        str_delete(text);
+
+        find_max_growths(a);
     }
 }
 
 extern struct analyser * create_analyser(struct tokeniser * t) {
     NEW(analyser, a);
     a->tokeniser = t;
+    a->arena = create_arena();
     a->nodes = 0;
     a->names = 0;
-    a->literalstrings = 0;
     a->program = 0;
     a->amongs = 0;
     a->among_count = 0;
@@ -915,45 +1291,14 @@ extern struct analyser * create_analyser(struct tokeniser * t) {
 
 extern void close_analyser(struct analyser * a) {
     {
-        struct node * q = a->nodes;
-        until (q == 0) {
-            struct node * q_next = q->next;
-            FREE(q);
-            q = q_next;
-        }
-    }
-    {
-        struct name * q = a->names;
-        until (q == 0) {
-            struct name * q_next = q->next;
-            lose_b(q->b); FREE(q);
-            q = q_next;
-        }
-    }
-    {
-        struct literalstring * q = a->literalstrings;
-        until (q == 0) {
-            struct literalstring * q_next = q->next;
-            lose_b(q->b); FREE(q);
-            q = q_next;
-        }
+        struct name * q;
+        for (q = a->names; q != 0; q = q->next)
+            unless (q->short_word_symbols == 0) lose_b(q->short_word_symbols);
     }
     {
-        struct among * q = a->amongs;
-        until (q == 0) {
-            struct among * q_next = q->next;
-            FREE(q->b); FREE(q);
-            q = q_next;
-        }
-    }
-    {
-        struct grouping * q = a->groupings;
-        until (q == 0) {
-            struct grouping * q_next = q->next;
-            lose_b(q->b); FREE(q);
-            q = q_next;
-        }
+        struct grouping * q;
+        for (q = a->groupings; q != 0; q = q->next) lose_b(q->b);
     }
+    lose_arena(a->arena);
     FREE(a);
 }
-
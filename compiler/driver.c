@@ -1,27 +1,50 @@
 #include <stdio.h>   /* for fprintf etc */
 #include <stdlib.h>  /* for free etc */
 #include <string.h>  /* for strlen */
-#include "header.h"
+#include <ctype.h>   /* for isalpha, toupper */
 
-#define DEFAULT_PACKAGE "org.tartarus.snowball.ext"
-#define DEFAULT_BASE_CLASS "org.tartarus.snowball.SnowballProgram"
-#define DEFAULT_AMONG_CLASS "org.tartarus.snowball.Among"
-#define DEFAULT_STRING_CLASS "java.lang.StringBuilder"
+/* -manifest compiles modules in parallel with fork(): elsewhere they are
+   compiled one after another. Define SB_HAVE_FORK as 0 or 1 to override
+   the guess. */
+#ifndef SB_HAVE_FORK
+#if defined __unix__ || defined __APPLE__
+#define SB_HAVE_FORK 1
+#else
+#define SB_HAVE_FORK 0
+#endif
+#endif
 
-static int eq(const char * s1, const char * s2) {
-    int s1_len = strlen(s1);
-    int s2_len = strlen(s2);
-    return s1_len == s2_len && memcmp(s1, s2, s1_len) == 0;
-}
+#if SB_HAVE_FORK
+#include <unistd.h>  /* for fork, sysconf */
+#include <sys/wait.h>
+#endif
+#include "header.h"
 
 static void print_arglist(void) {
     fprintf(stderr, "Usage: snowball <file> [options]\n\n"
                     "options are: [-o[utput] file]\n"
                     "             [-s[yntax]]\n"
+                    "             [-O]\n"
+                    "             [-l[ocals]]\n"
+                    "             [-hotwords file]\n"
+                    "             [-lines]\n"
+                    "             [-instrument]\n"
+                    "             [-report file]\n"
+                    "             [-profile file]\n"
+                    "             [-eval file]\n"
+                    "             [-manifest [-jobs n]]\n"
+                    "             [-cppdir dir]\n"
+#ifndef DISABLE_JAVA
+                    "             [-javadir dir]\n"
+#endif
+#ifndef DISABLE_PYTHON
+                    "             [-pythondir dir]\n"
+#endif
 #ifndef DISABLE_JAVA
                     "             [-j[ava]]\n"
 #endif
                     "             [-c++]\n"
+                    "             [-bytecode]\n"
 #ifndef DISABLE_PYTHON
                     "             [-py[thon]]\n"
 #endif
@@ -42,16 +65,14 @@ static void print_arglist(void) {
     exit(1);
 }
 
-static void check_lim(int i, int argc) {
-    if (i >= argc) {
-        fprintf(stderr, "argument list is one short\n");
-        print_arglist();
-    }
-}
-
-static FILE * get_output(symbol * b) {
-    char * s = b_to_s(b);
-    FILE * output = fopen(s, "w");
+static FILE * get_output(const char * name, const char * suffix) {
+    symbol * b = add_s_to_b(0, name);
+    char * s;
+    FILE * output;
+    b = add_s_to_b(b, suffix);
+    s = b_to_s(b);
+    lose_b(b);
+    output = fopen(s, "w");
     if (output == 0) {
         fprintf(stderr, "Can't open output %s\n", s);
         exit(1);
@@ -60,220 +81,322 @@ static FILE * get_output(symbol * b) {
     return output;
 }
 
-static void read_options(struct options * o, int argc, char * argv[]) {
-    char * s;
-    int i = 2;
-
-    /* set defaults: */
-
-    o->output_file = 0;
-    o->syntax_tree = false;
-    o->externals_prefix = "";
-    o->variables_prefix = 0;
-    o->runtime_path = 0;
-    o->parent_class_name = DEFAULT_BASE_CLASS;
-    o->string_class = DEFAULT_STRING_CLASS;
-    o->among_class = DEFAULT_AMONG_CLASS;
-    o->package = DEFAULT_PACKAGE;
-    o->name = "";
-    o->make_lang = LANG_C;
-    o->widechars = false;
-    o->includes = 0;
-    o->includes_end = 0;
-    o->utf8 = false;
-
-    /* read options: */
+static void close_output(FILE ** f) {
+    unless (*f == 0) fclose(*f);
+    *f = 0;
+}
 
-    repeat {
-        if (i >= argc) break;
-        s = argv[i++];
-        {   if (eq(s, "-o") || eq(s, "-output")) {
-                check_lim(i, argc);
-                o->output_file = argv[i++];
-                continue;
-            }
-            if (eq(s, "-n") || eq(s, "-name")) {
-                check_lim(i, argc);
-                o->name = argv[i++];
-                continue;
-            }
+static void close_outputs(struct options * o) {
+    close_output(&o->output_c);
+    close_output(&o->output_h);
+    close_output(&o->output_report);
+    close_output(&o->output_bytecode);
 #ifndef DISABLE_JAVA
-            if (eq(s, "-j") || eq(s, "-java")) {
-                o->make_lang = LANG_JAVA;
-                o->widechars = true;
-                continue;
-            }
+    close_output(&o->output_java);
 #endif
-            if (eq(s, "-c++")) {
-                o->make_lang = LANG_CPLUSPLUS;
-                continue;
-            }
 #ifndef DISABLE_PYTHON
-            if (eq(s, "-py") || eq(s, "-python")) {
-                o->make_lang = LANG_PYTHON;
-                o->widechars = true;
-                continue;
-            }
+    close_output(&o->output_python);
 #endif
-            if (eq(s, "-w") || eq(s, "-widechars")) {
-                o->widechars = true;
-                o->utf8 = false;
-                continue;
-            }
-            if (eq(s, "-s") || eq(s, "-syntax")) {
-                o->syntax_tree = true;
-                continue;
-            }
-            if (eq(s, "-ep") || eq(s, "-eprefix")) {
-                check_lim(i, argc);
-                o->externals_prefix = argv[i++];
-                continue;
-            }
-            if (eq(s, "-vp") || eq(s, "-vprefix")) {
-                check_lim(i, argc);
-                o->variables_prefix = argv[i++];
-                continue;
-            }
-            if (eq(s, "-i") || eq(s, "-include")) {
-                check_lim(i, argc);
+}
 
-                {
-                    NEW(include, p);
-                    symbol * b = add_s_to_b(0, argv[i++]);
-                    b = add_s_to_b(b, "/");
-                    p->next = 0; p->b = b;
+static void read_command_options(struct options * o, int argc, char * argv[]) {
+    struct str * error = str_new();
+    int k;
+    default_options(o);
+    k = read_options(o, argc, argv, 2, error);
+    unless (k == 0) {
+        report(0, 0, false, error);
+        if (k == 1) print_arglist();
+        exit(1);
+    }
+    str_delete(error);
+}
 
-                    if (o->includes == 0) o->includes = p; else
-                                          o->includes_end->next = p;
-                    o->includes_end = p;
-                }
-                continue;
-            }
-            if (eq(s, "-r") || eq(s, "-runtime")) {
-                check_lim(i, argc);
-                o->runtime_path = argv[i++];
-                continue;
-            }
-            if (eq(s, "-u") || eq(s, "-utf8")) {
-                o->utf8 = true;
-                o->widechars = false;
-                continue;
-            }
+/* Opens the outputs for o->make_lang, generates the program into them, and
+   closes them. */
+static void generate_outputs(struct analyser * a, struct options * o) {
+    char * s = o->output_file;
+    unless (s) {
+        fprintf(stderr, "Please include the -o option\n");
+        print_arglist();
+        exit(1);
+    }
+    switch (o->make_lang) {
+        case LANG_C:
+            o->output_h = get_output(s, ".h");
+            o->output_c = get_output(s, ".c");
+            if (o->report_file) o->output_report = get_output(o->report_file, "");
+            break;
+        case LANG_BYTECODE:
+            o->output_bytecode = get_output(s, ".sbc");
+            break;
+        case LANG_CPLUSPLUS:
+            o->output_h = get_output(s, ".hpp");
+            break;
 #ifndef DISABLE_JAVA
-            if (eq(s, "-p") || eq(s, "-parentclassname")) {
-                check_lim(i, argc);
-                o->parent_class_name = argv[i++];
-                continue;
-            }
-            if (eq(s, "-P") || eq(s, "-Package")) {
-                check_lim(i, argc);
-                o->package = argv[i++];
-                continue;
-            }
-            if (eq(s, "-S") || eq(s, "-stringclass")) {
-                check_lim(i, argc);
-                o->string_class = argv[i++];
-                continue;
-            }
-            if (eq(s, "-a") || eq(s, "-amongclass")) {
-                check_lim(i, argc);
-                o->among_class = argv[i++];
-                continue;
-            }
+        case LANG_JAVA:
+            o->output_java = get_output(s, ".java");
+            break;
+#endif
+#ifndef DISABLE_PYTHON
+        case LANG_PYTHON:
+            o->output_python = get_output(s, ".py");
+            break;
 #endif
-            fprintf(stderr, "'%s' misplaced\n", s);
-            print_arglist();
-        }
     }
+    generate_program(a, o);
+    close_outputs(o);
 }
 
-extern int main(int argc, char * argv[]) {
+/* -manifest: the input lists the modules of libstemmer, as
+   libstemmer/modules.txt does, and each algorithm is compiled to C in each
+   of its encodings, named as by the GNUmakefile, in the directory given by
+   -o. The source is algorithms/<algorithm>/stem_<encoding>.sbl, or
+   stem_Unicode.sbl for UTF-8, which falls back to stem_ISO_8859_1.sbl.
 
-    NEW(options, o);
-    if (argc == 1) print_arglist();
-    read_options(o, argc, argv);
-    {
-        symbol * filename = add_s_to_b(0, argv[1]);
-        char * file;
-        symbol * u = get_input(filename, &file);
-        if (u == 0) {
-            fprintf(stderr, "Can't open input %s\n", argv[1]);
-            exit(1);
-        }
-        {
-            struct tokeniser * t = create_tokeniser(u, file);
-            struct analyser * a = create_analyser(t);
-            t->widechars = o->widechars;
-            t->includes = o->includes;
-            a->utf8 = t->utf8 = o->utf8;
-            read_program(a);
-            if (t->error_count > 0) exit(1);
-            if (o->syntax_tree) print_program(a);
-            close_tokeniser(t);
-            unless (o->syntax_tree) {
-                struct generator * g;
+   With -cppdir, -javadir or -pythondir, each algorithm is also compiled
+   to those languages, as by the GNUmakefile. They all read the UTF-8
+   source as wide characters, so one parse serves them all; the C of each
+   encoding needs a parse of its own, as the tokeniser decodes the literal
+   strings for it.
 
-                char * s = o->output_file;
-                unless (s) {
-                    fprintf(stderr, "Please include the -o option\n");
-                    print_arglist();
-                    exit(1);
-                }
-                if (o->make_lang == LANG_C || o->make_lang == LANG_CPLUSPLUS) {
-                    symbol * b = add_s_to_b(0, s);
-                    b = add_s_to_b(b, ".h");
-                    o->output_h = get_output(b);
-                    b[SIZE(b) - 1] = 'c';
-                    if (o->make_lang == LANG_CPLUSPLUS) {
-                        b = add_s_to_b(b, "c");
-                    }
-                    o->output_c = get_output(b);
-                    lose_b(b);
+   Up to -jobs (by default, the number of processors) are compiled at once,
+   each by a process of its own, as the compiler keeps some of its state in
+   globals. Without fork() they are compiled one after another. */
 
-                    g = create_generator_c(a, o);
-                    generate_program_c(g);
-                    close_generator_c(g);
-                    fclose(o->output_c);
-                    fclose(o->output_h);
-                }
+struct job {
+    struct job * next;
+    char algorithm[64];  /* without the -variant of a variant */
+    char encoding[64];   /* or "" for the wide languages */
+};
+
+/* As Python's str.title(), as the GNUmakefile names the Python classes. */
+static void title_case(char * s) {
+    int start = true;
+    for (; *s; s++) {
+        *s = start ? toupper((unsigned char) *s) : tolower((unsigned char) *s);
+        start = !isalpha((unsigned char) *s);
+    }
+}
+
+static void generate_wide(struct analyser * a, struct options * o, struct job * j) {
+    char * output = (char *) MALLOC(1024);
+    char name[128];
+    char prefix[128];
+    sprintf(prefix, "%s_", j->algorithm);
+    o->externals_prefix = prefix;
+    o->name = name;
+    if (o->cpp_dir) {
+        o->make_lang = LANG_CPLUSPLUS;
+        sprintf(name, "%s_stemmer", j->algorithm);
+        sprintf(output, "%.900s/%s", o->cpp_dir, name);
+        o->output_file = output;
+        o->externals_prefix = "";
+        generate_outputs(a, o);
+        o->externals_prefix = prefix;
+    }
 #ifndef DISABLE_JAVA
-                if (o->make_lang == LANG_JAVA) {
-                    symbol * b = add_s_to_b(0, s);
-                    b = add_s_to_b(b, ".java");
-                    o->output_java = get_output(b);
-                    lose_b(b);
-                    g = create_generator_java(a, o);
-                    generate_program_java(g);
-                    close_generator_java(g);
-                    fclose(o->output_java);
-                }
+    if (o->java_dir) {
+        o->make_lang = LANG_JAVA;
+        o->parent_class_name = "org.tartarus.snowball.SnowballStemmer";
+        sprintf(name, "%sStemmer", j->algorithm);
+        sprintf(output, "%.900s/%s", o->java_dir, name);
+        o->output_file = output;
+        generate_outputs(a, o);
+    }
 #endif
 #ifndef DISABLE_PYTHON
-                if (o->make_lang == LANG_PYTHON) {
-                    symbol * b = add_s_to_b(0, s);
-                    b = add_s_to_b(b, ".py");
-                    o->output_python = get_output(b);
-                    lose_b(b);
-                    g = create_generator_python(a, o);
-                    generate_program_python(g);
-                    close_generator_python(g);
-                    fclose(o->output_python);
-                }
+    if (o->python_dir) {
+        o->make_lang = LANG_PYTHON;
+        o->parent_class_name = "BaseStemmer";
+        strcpy(name, j->algorithm);
+        title_case(name);
+        strcat(name, "Stemmer");
+        sprintf(output, "%.900s/%s_stemmer", o->python_dir, j->algorithm);
+        o->output_file = output;
+        generate_outputs(a, o);
+    }
 #endif
-            }
+    FREE(output);
+}
+
+/* Returns false if the program has errors, having freed all it used. With
+   j, a job of -manifest for the wide backends, it generates each of them
+   from the one parse. */
+static int compile(struct options * o, char * input, struct job * j) {
+    symbol * filename = add_s_to_b(0, input);
+    char * file;
+    int ok = true;
+    symbol * u = get_input(filename, &file);
+    if (u == 0) {
+        fprintf(stderr, "Can't open input %s\n", input);
+        exit(1);
+    }
+    {
+        struct tokeniser * t = create_tokeniser(u, file);
+        struct analyser * a = create_analyser(t);
+        t->widechars = o->widechars;
+        t->includes = o->includes;
+        a->utf8 = t->utf8 = o->utf8;
+        read_program(a);
+        if (t->error_count > 0) {
+            close_tokeniser(t);
             close_analyser(a);
+            lose_b(u);
+            lose_b(filename);
+            return false;
         }
-        lose_b(u);
-        lose_b(filename);
+        if (o->optimise) optimise_program(a, o);
+        if (o->syntax_tree) print_program(a); else
+        if (o->eval_file) ok = eval_words(a, o); else
+        if (j) generate_wide(a, o, j); else generate_outputs(a, o);
+        close_tokeniser(t); /* after generation, as nodes point to its file */
+        close_analyser(a);
     }
-    {   struct include * p = o->includes;
-        until (p == 0)
-        {   struct include * q = p->next;
-            lose_b(p->b); FREE(p); p = q;
+    lose_b(u);
+    lose_b(filename);
+    return ok;
+}
+
+static void add_job(struct job ** jobs, struct job ** jobs_end, char * algorithm, char * encoding) {
+    struct job * j = *jobs;
+    until (j == 0 || (eq(j->algorithm, algorithm) && eq(j->encoding, encoding))) j = j->next;
+    if (j == 0 && strlen(encoding) < sizeof j->encoding) {
+        NEW(job, p);
+        strcpy(p->algorithm, algorithm);
+        strcpy(p->encoding, encoding);
+        p->next = 0;
+        if (*jobs == 0) *jobs = p; else (*jobs_end)->next = p;
+        *jobs_end = p;
+    }
+}
+
+static struct job * read_manifest(struct options * o, char * input) {
+    FILE * f = fopen(input, "r");
+    struct job * jobs = 0;
+    struct job * jobs_end = 0;
+    int wide = o->cpp_dir || o->java_dir || o->python_dir;
+    char line[1024];
+    if (f == 0) {
+        fprintf(stderr, "Can't open input %s\n", input);
+        exit(1);
+    }
+    while (fgets(line, sizeof line, f)) {
+        char algorithm[64];
+        char encodings[1024];
+        char * e;
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%63s %1023s", algorithm, encodings) != 2) continue;
+        e = strchr(algorithm, '-');
+        if (e) *e = 0;
+        if (wide) add_job(&jobs, &jobs_end, algorithm, "");
+        e = strtok(encodings, ",");
+        until (e == 0) {
+            add_job(&jobs, &jobs_end, algorithm, e);
+            e = strtok(0, ",");
         }
     }
+    fclose(f);
+    return jobs;
+}
+
+static void job_paths(struct options * o, struct job * j, char * source, char * output, char * prefix) {
+    int wide = j->encoding[0] == 0;
+    o->utf8 = eq(j->encoding, "UTF_8");
+    o->widechars = wide;
+    sprintf(source, "algorithms/%s/stem_%s.sbl", j->algorithm, o->utf8 || wide ? "Unicode" : j->encoding);
+    if (o->utf8 || wide) {
+        FILE * f = fopen(source, "r");
+        if (f) fclose(f); else
+            sprintf(source, "algorithms/%s/stem_ISO_8859_1.sbl", j->algorithm);
+    }
+    sprintf(output, "%s/stem_%s_%s", o->output_file, j->encoding, j->algorithm);
+    sprintf(prefix, "%s_%s_", j->algorithm, j->encoding);
+}
+
+/* Compiles job j, whose paths job_paths() has set, returning false if it
+   fails. */
+static int compile_job(struct options * o, struct job * j, char * source, char * output, char * prefix) {
+    struct options job_options = *o;
+    int wide = j->encoding[0] == 0;
+    if (wide) {
+        printf("%s -> C++, Java, Python\n", source);
+    } else {
+        printf("%s -> %s\n", source, output);
+    }
+    fflush(stdout);
+    job_options.output_file = output;
+    job_options.externals_prefix = prefix;
+    return compile(&job_options, source, wide ? j : 0);
+}
+
+static void compile_manifest(struct options * o, char * input) {
+    struct job * jobs = read_manifest(o, input);
+    char * dir = o->output_file;
+    char * source;
+    char * output;
+    char * prefix;
+    int failed = false;
+    unless (dir) {
+        fprintf(stderr, "Please include the -o option\n");
+        print_arglist();
+    }
+    source = (char *) MALLOC(strlen(dir) + 256);
+    output = (char *) MALLOC(strlen(dir) + 256);
+    prefix = (char *) MALLOC(256);
+#if SB_HAVE_FORK
+    {
+        int running = 0;
+        if (o->jobs <= 0) o->jobs = sysconf(_SC_NPROCESSORS_ONLN);
+        if (o->jobs <= 0) o->jobs = 1;
+        until (jobs == 0 && running == 0) {
+            int status;
+            if (jobs != 0 && running < o->jobs) {
+                struct job * j = jobs;
+                int pid;
+                jobs = j->next;
+                job_paths(o, j, source, output, prefix);
+                pid = fork();
+                if (pid == 0) exit(compile_job(o, j, source, output, prefix) ? 0 : 1);
+                FREE(j);
+                if (pid < 0) {
+                    perror("fork");
+                    failed = true;
+                } else {
+                    running++;
+                }
+                continue;
+            }
+            if (wait(&status) < 0) break;
+            running--;
+            unless (WIFEXITED(status) && WEXITSTATUS(status) == 0) failed = true;
+        }
+    }
+#else
+    until (jobs == 0) {
+        struct job * j = jobs;
+        jobs = j->next;
+        job_paths(o, j, source, output, prefix);
+        unless (compile_job(o, j, source, output, prefix)) failed = true;
+        FREE(j);
+    }
+#endif
+    FREE(source);
+    FREE(output);
+    FREE(prefix);
+    if (failed) exit(1);
+}
+
+extern int main(int argc, char * argv[]) {
+
+    int ok = true;
+    NEW(options, o);
+    if (argc == 1) print_arglist();
+    read_command_options(o, argc, argv);
+    if (o->manifest) compile_manifest(o, argv[1]); else ok = compile(o, argv[1], 0);
+    lose_includes(o);
     FREE(o);
     unless (space_count == 0) fprintf(stderr, "%d blocks unfreed\n", space_count);
-    return 0;
+    return ok ? 0 : 1;
 }
 
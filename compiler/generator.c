@@ -5,12 +5,21 @@
 #include <string.h>  /* for strlen */
 #include "header.h"
 
-/* Define this to get warning messages when optimisations can't be used. */
-/* #define OPTIMISATION_WARNINGS */
+/* Generator for C, and for C++. In C++ each program becomes a header-only
+   class template NAME<symbol>, deriving from snowball::program<symbol> in
+   runtime/snowball.hpp. The program is analysed in terms of characters (as
+   for Java), and the literal strings and among tables are written out twice:
+   in UTF-8, for symbol = unsigned char, and as characters, for char16_t and
+   char32_t. The grouping tables are common to both. The C++ runtime has the
+   cursor and the limits as members and reports errors by throwing, so the
+   code for the two languages differs only here and there.
+*/
 
 /* recursive use: */
 
 static void generate(struct generator * g, struct node * p);
+static void w(struct generator * g, const char * s);
+static void generate_among_table_cpp(struct generator * g, struct among * x, int backward);
 
 enum special_labels {
 
@@ -69,6 +78,10 @@ static void wvn(struct generator * g, struct name * p) {  /* variable name */
         case t_string:
         case t_boolean:
         case t_integer:
+            if (g->cplusplus) {
+                /* members of the class, named as routines are */
+                wch(g, ch); wch(g, '_'); break;
+            }
             wch(g, ch); wch(g, '['); wi(g, p->count); wch(g, ']'); return;
         case t_external:
             ws(g, g->options->externals_prefix); break;
@@ -79,10 +92,24 @@ static void wvn(struct generator * g, struct name * p) {  /* variable name */
 }
 
 static void wv(struct generator * g, struct name * p) {  /* reference to variable */
-    if (p->type < t_routine) ws(g, "z->");
+    if (g->cplusplus) {
+        if (p->type == t_grouping) ws(g, "data::");
+    } else {
+        if (p->type < t_routine) ws(g, "z->");
+    }
     wvn(g, p);
 }
 
+/* The UTF-8 form of the characters at p, in a new block. */
+static symbol * utf8_b(symbol * p) {
+    symbol * q = create_b(3 * SIZE(p));
+    int i;
+    int n = 0;
+    for (i = 0; i < SIZE(p); i++) n += put_utf8(p[i], q + n);
+    SIZE(q) = n;
+    return q;
+}
+
 static void wlitarray(struct generator * g, symbol * p) {  /* write literal array */
 
     ws(g, "{ ");
@@ -95,6 +122,7 @@ static void wlitarray(struct generator * g, symbol * p) {  /* write literal arra
                 switch (ch) {
                     case '\'':
                     case '\\': wch(g, '\\');
+                    /* fall through */
                     default:   wch(g, ch);
                 }
                 wch(g, '\'');
@@ -107,8 +135,50 @@ static void wlitarray(struct generator * g, symbol * p) {  /* write literal arra
     ws(g, " }");
 }
 
+/* C++: the definition of table name of NAME<scope>, which C++11 and C++14
+   need as well as the declaration in the class, and C++17 makes inline. The
+   name is a formatted write. */
+
+static void wdefinition(struct generator * g, const char * type, const char * scope, const char * name) {
+    struct str * s = g->outbuf;
+    g->outbuf = g->definitions;
+    ws(g, "template <typename T> constexpr "); ws(g, type); wch(g, ' ');
+    ws(g, g->options->name); ws(g, scope); ws(g, "::"); w(g, name); ws(g, "[];\n");
+    g->outbuf = s;
+}
+
+/* C++: writes the declaration "static constexpr <type> <name>[] = { ... };"
+   of the characters at p into both sets of tables. */
+
+static void wtables(struct generator * g, const char * name, symbol * p) {
+    struct str * s = g->outbuf;
+    symbol * b = utf8_b(p);
+
+    wdefinition(g, "unsigned char", "_data<true, T>", name);
+    wdefinition(g, "char32_t", "_data<false, T>", name);
+
+    g->outbuf = g->declarations;
+    ws(g, "    static constexpr unsigned char "); ws(g, name); ws(g, "[] = ");
+    wlitarray(g, b);
+    ws(g, ";\n");
+
+    g->outbuf = g->wide_declarations;
+    ws(g, "    static constexpr char32_t "); ws(g, name); ws(g, "[] = ");
+    wlitarray(g, p);
+    ws(g, ";\n");
+
+    g->outbuf = s;
+    lose_b(b);
+}
+
 static void wlitref(struct generator * g, symbol * p) {  /* write ref to literal array */
 
+    if (g->cplusplus) {
+        char name[32];
+        sprintf(name, "s_%d", g->literalstring_count++);
+        wtables(g, name, p);
+        ws(g, "data::"); ws(g, name);
+    } else
     if (SIZE(p) == 0) ws(g, "0"); else {
         struct str * s = g->outbuf;
         g->outbuf = g->declarations;
@@ -161,6 +231,46 @@ static void wc(struct generator * g, struct node * p) { /* comment */
     wnl(g);
 }
 
+/* With -lines, a #line directive giving where p is in the source, when that
+   has changed and a new line has begun. line_count is left alone, so that
+   wbe() still sees a label just before it. */
+static void wline_to(struct generator * g, int line_number, char * file) {
+    struct str * s = g->outbuf;
+    char * q;
+    if (line_number == g->source_line && file == g->source_file) return;
+    if (str_len(s) > 0 && str_data(s)[str_len(s) - 1] != '\n') return;
+    ws(g, "#line "); wi(g, line_number); ws(g, " \"");
+    for (q = file; *q; q++) {
+        if (*q == '"' || *q == '\\') wch(g, '\\');
+        wch(g, *q);
+    }
+    ws(g, "\"\n");
+    g->source_line = line_number;
+    g->source_file = file;
+}
+
+static void wline(struct generator * g, struct node * p) {
+    if (g->options->lines && p->file != 0) wline_to(g, p->line_number, p->file);
+}
+
+static int count_lines(struct str * s) {
+    int n = 0;
+    int i;
+    for (i = 0; i < str_len(s); i++) if (str_data(s)[i] == '\n') n++;
+    return n;
+}
+
+/* Back to the generated file itself, for the code after the routines. */
+static void wline_to_output(struct generator * g) {
+    char * s = g->options->output_file;
+    int n = strlen(s);
+    char * file = MALLOC(n + 3);
+    memmove(file, s, n);
+    memmove(file + n, ".c", 3);
+    wline_to(g, count_lines(g->declarations) + count_lines(g->outbuf) + 2, file);
+    FREE(file);
+}
+
 static void wms(struct generator * g, const char * s) {
     wm(g); ws(g, s);   } /* margin + string */
 
@@ -178,26 +288,28 @@ static void wbe(struct generator * g) {    /* block end */
 
 static void wk(struct generator * g, struct node * p) {     /* keep c */
     ++g->keep_count;
+    g->saves++;
     if (p->mode == m_forward) {
-        ws(g, "int c"); wi(g, g->keep_count); ws(g, " = z->c;");
+        ws(g, "int c"); wi(g, g->keep_count); w(g, " = ~zc;");
     } else {
-        ws(g, "int m"); wi(g, g->keep_count); ws(g, " = z->l - z->c; (void)m");
+        ws(g, "int m"); wi(g, g->keep_count); w(g, " = ~zl - ~zc; (void)m");
         wi(g, g->keep_count); ws(g, ";");
     }
 }
 
 static void wrestore(struct generator * g, struct node * p, int keep_token) {     /* restore c */
+    g->restores++;
     if (p->mode == m_forward) {
-        ws(g, "z->c = c");
+        w(g, "~zc = c");
     } else {
-        ws(g, "z->c = z->l - m");
+        w(g, "~zc = ~zl - m");
     }
     wi(g, keep_token); ws(g, ";");
 }
 
 static void winc(struct generator * g, struct node * p) {     /* increment c */
-    ws(g, p->mode == m_forward ? "z->c++;" :
-                                 "z->c--;");
+    w(g, p->mode == m_forward ? "~zc++;" :
+                                "~zc--;");
 }
 
 static void wsetl(struct generator * g, int n) {
@@ -213,11 +325,14 @@ static void wgotol(struct generator * g, int n) {
 }
 
 static void wf(struct generator * g) {          /* fail */
-    if (g->failure_string != 0) { ws(g, "{ "); ws(g, g->failure_string); wch(g, ' '); }
+    int spill = g->locals && g->failure_label == x_return;
+    if (g->failure_string != 0 || spill) ws(g, "{ ");
+    if (g->failure_string != 0) { w(g, g->failure_string); wch(g, ' '); }
     switch (g->failure_label)
     {
         case x_return:
-           ws(g, "return 0;");
+           if (spill) ws(g, "z->c = c; ");
+           ws(g, g->cplusplus ? "return false;" : "return 0;");
            break;
         default:
            ws(g, "goto lab");
@@ -225,13 +340,13 @@ static void wf(struct generator * g) {          /* fail */
            wch(g, ';');
            g->label_used = 1;
     }
-    if (g->failure_string != 0) ws(g, " }");
+    if (g->failure_string != 0 || spill) ws(g, " }");
 }
 
 static void wlim(struct generator * g, struct node * p) {     /* if at limit fail */
 
-    ws(g, p->mode == m_forward ? "if (z->c >= z->l) " :
-                                 "if (z->c <= z->lb) ");
+    w(g, p->mode == m_forward ? "if (~zc >= ~zl) " :
+                                "if (~zc <= ~zlb) ");
     wf(g);
 }
 
@@ -246,12 +361,14 @@ static void wp(struct generator * g, const char * s, struct node * p) { /* forma
             case 'C': wc(g, p); continue;
             case 'k': wk(g, p); continue;
             case 'K': /* keep for c_test */
-                ws(g, p->mode == m_forward ? "int c_test = z->c;" :
-                                             "int m_test = z->l - z->c;");
+                g->saves++;
+                w(g, p->mode == m_forward ? "int c_test = ~zc;" :
+                                            "int m_test = ~zl - ~zc;");
                 continue;
             case 'R': /* restore for c_test */
-                ws(g, p->mode == m_forward ? "z->c = c_test;" :
-                                             "z->c = z->l - m_test;");
+                g->restores++;
+                w(g, p->mode == m_forward ? "~zc = c_test;" :
+                                            "~zc = ~zl - m_test;");
                 continue;
             case 'i': winc(g, p); continue;
             case 'l': wlim(g, p); continue;
@@ -273,12 +390,37 @@ static void wp(struct generator * g, const char * s, struct node * p) { /* forma
                 wch(g, p->literalstring == 0 ? 'v' : 's');
                 continue;
             case 'p': ws(g, g->options->externals_prefix); continue;
+            case 'z': /* c, l and lb are held in locals with -l, and are
+                         members in C++ */
+                unless (g->locals || g->cplusplus) ws(g, "z->");
+                continue;
+            case 'Z': /* the rest of the env, which are members in C++ */
+                unless (g->cplusplus) ws(g, "z->");
+                continue;
+            case 'Y': /* the env as the first argument to the runtime */
+                unless (g->cplusplus) ws(g, "z, ");
+                continue;
         }
     }
 }
 
 static void w(struct generator * g, const char * s) { wp(g, s, 0); }
 
+/* With -l, c, l and lb live in locals of each routine. z->l and z->lb are
+   written through whenever they are assigned, so only c has to be spilled
+   before a runtime call which looks at it, and reloaded afterwards - along
+   with l and lb if the call can alter the string or the limits.
+*/
+
+static void wspill(struct generator * g) {
+    if (g->locals) w(g, "~Mz->c = c;~N");
+}
+
+static void wreload(struct generator * g, int all) {
+    unless (g->locals) return;
+    w(g, all ? "~Mc = z->c; l = z->l; lb = z->lb;~N" : "~Mc = z->c;~N");
+}
+
 static void generate_AE(struct generator * g, struct node * p) {
     char * s;
     switch (p->type) {
@@ -287,9 +429,9 @@ static void generate_AE(struct generator * g, struct node * p) {
         case c_number:
             wi(g, p->number); break;
         case c_maxint:
-            ws(g, "MAXINT"); break;
+            ws(g, g->cplusplus ? "INT_MAX" : "MAXINT"); break;
         case c_minint:
-            ws(g, "MININT"); break;
+            ws(g, g->cplusplus ? "INT_MIN" : "MININT"); break;
         case c_neg:
             wch(g, '-'); generate_AE(g, p->right); break;
         case c_multiply:
@@ -305,13 +447,13 @@ static void generate_AE(struct generator * g, struct node * p) {
             ws(g, s); generate_AE(g, p->right); wch(g, ')'); break;
         case c_sizeof:
             g->V[0] = p->name;
-            w(g, "SIZE(~V0)"); break;
+            w(g, g->cplusplus ? "int(~V0.size())" : "SIZE(~V0)"); break;
         case c_cursor:
-            w(g, "z->c"); break;
+            w(g, "~zc"); break;
         case c_limit:
-            w(g, p->mode == m_forward ? "z->l" : "z->lb"); break;
+            w(g, p->mode == m_forward ? "~zl" : "~zlb"); break;
         case c_size:
-            w(g, "SIZE(z->p)"); break;
+            w(g, g->cplusplus ? "int(p.size())" : "SIZE(z->p)"); break;
     }
 }
 
@@ -410,6 +552,19 @@ static int repeat_restore(struct generator * g, struct node * p) {
     return repeat_score(g, p) >= 2;
 }
 
+/* With -O the optimiser has already decided whether c must be kept around
+   command p, so these only fall back on the heuristics above without it. */
+
+static int keep_needed(struct generator * g, struct node * p) {
+    if (p->keep >= 0) return p->keep;
+    return K_needed(g, p->left);
+}
+
+static int repeat_keep_needed(struct generator * g, struct node * p) {
+    if (p->keep >= 0) return p->keep;
+    return repeat_restore(g, p->left);
+}
+
 static void generate_bra(struct generator * g, struct node * p) {
     p = p->left;
     until (p == 0) { generate(g, p); p = p->right; }
@@ -417,7 +572,7 @@ static void generate_bra(struct generator * g, struct node * p) {
 
 static void generate_and(struct generator * g, struct node * p) {
     int keep_c = 0;
-    if (K_needed(g, p->left)) {
+    if (keep_needed(g, p)) {
         wp(g, "~{~k~C", p);
         keep_c = g->keep_count;
     } else {
@@ -443,7 +598,7 @@ static void generate_or(struct generator * g, struct node * p) {
 
     int out_lab = new_label(g);
 
-    if (K_needed(g, p->left)) {
+    if (keep_needed(g, p)) {
         wp(g, "~{~k~C", p);
         keep_c = g->keep_count;
     } else {
@@ -474,9 +629,12 @@ static void generate_or(struct generator * g, struct node * p) {
 
 static void generate_backwards(struct generator * g, struct node * p) {
 
-    wp(g,"~Mz->lb = z->c; z->c = z->l;~C~N", p);
+    if (g->locals)
+        wp(g,"~Mz->lb = lb = c; c = l;~C~N", p);
+    else
+        wp(g,"~M~Zlb = ~zc; ~zc = ~zl;~C~N", p);
     generate(g, p->left);
-    w(g, "~Mz->c = z->lb;~N");
+    w(g, "~M~zc = ~zlb;~N");
 }
 
 
@@ -487,7 +645,7 @@ static void generate_not(struct generator * g, struct node * p) {
     int a0 = g->failure_label;
     const char * a1 = g->failure_string;
 
-    if (K_needed(g, p->left)) {
+    if (keep_needed(g, p)) {
         wp(g, "~{~k~C", p);
         keep_c = g->keep_count;
     } else {
@@ -518,15 +676,16 @@ static void generate_not(struct generator * g, struct node * p) {
 
 
 static void generate_try(struct generator * g, struct node * p) {
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     if (keep_c) {
         if (p->mode == m_forward) {
-            wp(g, "~{int c_keep = z->c;~C", p);
-            g->failure_string = "z->c = c_keep;";
+            wp(g, "~{int c_keep = ~zc;~C", p);
+            g->failure_string = "~zc = c_keep;";
         } else {
-            wp(g, "~{int m_keep = z->l - z->c;/* (void) m_keep;*/~C", p);
-            g->failure_string = "z->c = z->l - m_keep;";
+            wp(g, g->cplusplus ? "~{int m_keep = ~zl - ~zc;~C" :
+                                 "~{int m_keep = ~zl - ~zc;/* (void) m_keep;*/~C", p);
+            g->failure_string = "~zc = ~zl - m_keep;";
         }
     } else {
         wp(g, "~M~C", p);
@@ -544,11 +703,15 @@ static void generate_try(struct generator * g, struct node * p) {
 }
 
 static void generate_set(struct generator * g, struct node * p) {
-    g->V[0] = p->name; wp(g, "~M~V0 = 1;~C", p);
+    g->V[0] = p->name;
+    g->S[0] = g->cplusplus ? "true" : "1";
+    wp(g, "~M~V0 = ~S0;~C", p);
 }
 
 static void generate_unset(struct generator * g, struct node * p) {
-    g->V[0] = p->name; wp(g, "~M~V0 = 0;~C", p);
+    g->V[0] = p->name;
+    g->S[0] = g->cplusplus ? "false" : "0";
+    wp(g, "~M~V0 = ~S0;~C", p);
 }
 
 static void generate_fail(struct generator * g, struct node * p) {
@@ -559,7 +722,7 @@ static void generate_fail(struct generator * g, struct node * p) {
 /* generate_test() also implements 'reverse' */
 
 static void generate_test(struct generator * g, struct node * p) {
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
     if (keep_c) wp(g, "~{~K~C", p);
            else wp(g, "~M~C", p);
 
@@ -571,7 +734,7 @@ static void generate_test(struct generator * g, struct node * p) {
 
 static void generate_do(struct generator * g, struct node * p) {
     int keep_c = 0;
-    if (K_needed(g, p->left)) {
+    if (keep_needed(g, p)) {
         wp(g, "~{~k~C", p);
         keep_c = g->keep_count;
     } else {
@@ -592,39 +755,91 @@ static void generate_do(struct generator * g, struct node * p) {
 }
 
 static void generate_next(struct generator * g, struct node * p) {
+    if (g->cplusplus) {
+        /* hop() steps over a character in UTF-8 as in wide symbols */
+        if (p->mode == m_forward)
+            w(g, "~{int ret = hop(c, 0, l, 1);");
+        else
+            w(g, "~{int ret = hop(c, lb, l, -1);");
+        wp(g, "~C"
+              "~Mif (ret < 0) ~f~N"
+              "~Mc = ret;~N"
+              "~}", p);
+    } else
     if (g->options->utf8) {
         if (p->mode == m_forward)
-            w(g, "~{int ret = skip_utf8(z->p, z->c, 0, z->l, 1");
+            w(g, "~{int ret = skip_utf8(z->p, ~zc, 0, ~zl, 1");
         else
-            w(g, "~{int ret = skip_utf8(z->p, z->c, z->lb, 0, -1");
+            w(g, "~{int ret = skip_utf8(z->p, ~zc, ~zlb, 0, -1");
         wp(g, ");~N"
               "~Mif (ret < 0) ~f~N"
-              "~Mz->c = ret;~C"
+              "~M~zc = ret;~C"
               "~}", p);
     } else
         wp(g, "~M~l~N"
               "~M~i~C", p);
 }
 
+/* In single byte encodings a grouping is a full 256 bit table, so that
+   membership tests can be generated inline without a range check. */
+
+static int byte_grouping(struct generator * g, struct grouping * q) {
+    return !g->options->utf8 && !g->options->widechars && q->largest_ch < 256;
+}
+
+/* Writes a test of whether the character before or after c is in grouping
+   p->name, negated if 'negate' is set. The character must be a single byte,
+   or ASCII in UTF-8, and must not be at the limit. */
+
+static void wgrouping_member(struct generator * g, struct node * p, int negate) {
+    struct grouping * q = p->name->grouping;
+    const char * ch = p->mode == m_forward ? "z->p[~zc]" : "z->p[~zc - 1]";
+    if (negate) wch(g, '!');
+    wch(g, '(');
+    if (byte_grouping(g, q)) {
+        wv(g, p->name); wch(g, '['); w(g, ch); ws(g, " >> 3] & (1 << (");
+        w(g, ch); ws(g, " & 7)))");
+        return;
+    }
+    if (q->smallest_ch > 0x7F) { ws(g, "0)"); return; }
+    g->I[8] = q->smallest_ch;
+    g->I[9] = q->largest_ch;
+    if (q->smallest_ch > 0) { w(g, ch); w(g, " >= ~I8 && "); }
+    if (q->largest_ch < 0x7F) { w(g, ch); w(g, " <= ~I9 && "); }
+    wv(g, p->name); ws(g, "[("); w(g, ch); w(g, " - ~I8) >> 3] & (1 << ((");
+    w(g, ch); w(g, " - ~I8) & 7)))");
+}
+
 static void generate_GO_grouping(struct generator * g, struct node * p, int is_goto, int complement) {
 
     struct grouping * q = p->name->grouping;
+    if (byte_grouping(g, q)) {
+        w(g, "~Mwhile(1) {"); wp(g, is_goto ? " /* goto */~C~+" : " /* gopast */~C~+", p);
+        wp(g, "~M~l~N", p);
+        w(g, "~Mif ("); wgrouping_member(g, p, complement); w(g, ") break;~N");
+        wp(g, "~M~i~N~}", p);
+        unless (is_goto) wp(g, "~M~i~N", p);
+        return;
+    }
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->S[1] = complement ? "in" : "out";
     g->S[2] = g->options->utf8 ? "_U" : "";
     g->V[0] = p->name;
     g->I[0] = q->smallest_ch;
     g->I[1] = q->largest_ch;
+    wspill(g);
     if (is_goto) {
-	wp(g, "~Mif (~S1_grouping~S0~S2(z, ~V0, ~I0, ~I1, 1) < 0) ~f /* goto */~C", p);
+	wp(g, "~Mif (~S1_grouping~S0~S2(~Y~V0, ~I0, ~I1, 1) < 0) ~f /* goto */~C", p);
+	wreload(g, false);
     } else {
 	wp(g, "~{ /* gopast */~C"
-	      "~Mint ret = ~S1_grouping~S0~S2(z, ~V0, ~I0, ~I1, 1);~N"
-	      "~Mif (ret < 0) ~f~N", p);
+	      "~Mint ret = ~S1_grouping~S0~S2(~Y~V0, ~I0, ~I1, 1);~N", p);
+	wreload(g, false);
+	w(g, "~Mif (ret < 0) ~f~N");
 	if (p->mode == m_forward)
-	    w(g, "~Mz->c += ret;~N");
+	    w(g, "~M~zc += ret;~N");
 	else
-	    w(g, "~Mz->c -= ret;~N");
+	    w(g, "~M~zc -= ret;~N");
 	w(g, "~}");
     }
 }
@@ -640,16 +855,14 @@ static void generate_GO(struct generator * g, struct node * p, int style) {
 	/* Special case for "goto" or "gopast" when used on a grouping or an
 	 * inverted grouping - the movement of c by the matching action is
 	 * exactly what we want! */
-#ifdef OPTIMISATION_WARNINGS
-	printf("Optimising %s %s\n", style ? "goto" : "gopast", p->left->type == c_non ? "non" : "grouping");
-#endif
+	g->grouping_scans++;
 	generate_GO_grouping(g, p->left, style, p->left->type == c_non);
 	return;
     }
 
     w(g, "~Mwhile(1) {"); wp(g, "~C~+", p);
 
-    if (style == 1 || repeat_restore(g, p->left)) {
+    if (p->keep >= 0 ? p->keep : style == 1 || repeat_restore(g, p->left)) {
         wp(g, "~M~k~N", p);
         keep_c = g->keep_count;
     }
@@ -658,7 +871,7 @@ static void generate_GO(struct generator * g, struct node * p, int style) {
     g->label_used = 0;
     generate(g, p->left);
 
-    if (style == 1) {
+    if (style == 1 && keep_c) {
         /* include for goto; omit for gopast */
         w(g, "~M"); wrestore(g, p, keep_c); w(g, "~N");
     }
@@ -693,7 +906,7 @@ static void generate_repeat(struct generator * g, struct node * p, int atleast_c
     int keep_c = 0;
     wp(g, "~Mwhile(1) {~C~+", p);
 
-    if (repeat_restore(g, p->left)) {
+    if (repeat_keep_needed(g, p)) {
         wp(g, "~M~k~N", p);
         keep_c = g->keep_count;
     }
@@ -736,72 +949,95 @@ static void generate_atleast(struct generator * g, struct node * p) {
 
 static void generate_setmark(struct generator * g, struct node * p) {
     g->V[0] = p->name;
-    wp(g, "~M~V0 = z->c;~C", p);
+    wp(g, "~M~V0 = ~zc;~C", p);
 }
 
 static void generate_tomark(struct generator * g, struct node * p) {
     g->S[0] = p->mode == m_forward ? ">" : "<";
 
-    w(g, "~Mif (z->c ~S0 "); generate_AE(g, p->AE); w(g, ") ~f~N");
-    w(g, "~Mz->c = "); generate_AE(g, p->AE); wp(g, ";~C", p);
+    w(g, "~Mif (~zc ~S0 "); generate_AE(g, p->AE); w(g, ") ~f~N");
+    w(g, "~M~zc = "); generate_AE(g, p->AE); wp(g, ";~C", p);
 }
 
 static void generate_atmark(struct generator * g, struct node * p) {
 
-    w(g, "~Mif (z->c != "); generate_AE(g, p->AE); wp(g, ") ~f~C", p);
+    w(g, "~Mif (~zc != "); generate_AE(g, p->AE); wp(g, ") ~f~C", p);
 }
 
 static void generate_hop(struct generator * g, struct node * p) {
+    if (g->cplusplus) {
+        g->S[0] = p->mode == m_forward ? "0, l, " : "lb, l, -";
+        w(g, "~{int ret = hop(c, ~S0");
+        generate_AE(g, p->AE); wp(g, ");~C", p);
+        wp(g, "~Mif (ret < 0) ~f~N"
+              "~Mc = ret;~N"
+              "~}", p);
+        return;
+    }
     g->S[0] = p->mode == m_forward ? "+" : "-";
-    g->S[1] = p->mode == m_forward ? "0" : "z->lb";
+    g->S[1] = p->mode == m_forward ? "0" : g->locals ? "lb" : "z->lb";
     if (g->options->utf8) {
-        w(g, "~{int ret = skip_utf8(z->p, z->c, ~S1, z->l, ~S0 ");
+        w(g, "~{int ret = skip_utf8(z->p, ~zc, ~S1, ~zl, ~S0 ");
         generate_AE(g, p->AE); wp(g, ");~C", p);
         w(g, "~Mif (ret < 0) ~f~N");
     } else {
-        w(g, "~{int ret = z->c ~S0 ");
+        w(g, "~{int ret = ~zc ~S0 ");
         generate_AE(g, p->AE); wp(g, ";~C", p);
-        w(g, "~Mif (~S1 > ret || ret > z->l) ~f~N");
+        w(g, "~Mif (~S1 > ret || ret > ~zl) ~f~N");
     }
-    wp(g, "~Mz->c = ret;~C"
+    wp(g, "~M~zc = ret;~C"
           "~}", p);
 }
 
 static void generate_delete(struct generator * g, struct node * p) {
+    if (g->cplusplus) {
+        wp(g, "~Mslice_del();~C", p);
+        return;
+    }
+    wspill(g);
     wp(g, "~{int ret = slice_del(z);~C", p);
+    wreload(g, true);
     wp(g, "~Mif (ret < 0) return ret;~N"
           "~}", p);
 }
 
 static void generate_tolimit(struct generator * g, struct node * p) {
     g->S[0] = p->mode == m_forward ? "" : "b";
-    wp(g, "~Mz->c = z->l~S0;~C", p);
+    wp(g, "~M~zc = ~zl~S0;~C", p);
 }
 
 static void generate_atlimit(struct generator * g, struct node * p) {
     g->S[0] = p->mode == m_forward ? "" : "b";
     g->S[1] = p->mode == m_forward ? "<" : ">";
-    wp(g, "~Mif (z->c ~S1 z->l~S0) ~f~C", p);
+    wp(g, "~Mif (~zc ~S1 ~zl~S0) ~f~C", p);
 }
 
 static void generate_leftslice(struct generator * g, struct node * p) {
     g->S[0] = p->mode == m_forward ? "bra" : "ket";
-    wp(g, "~Mz->~S0 = z->c;~C", p);
+    wp(g, "~M~Z~S0 = ~zc;~C", p);
 }
 
 static void generate_rightslice(struct generator * g, struct node * p) {
     g->S[0] = p->mode == m_forward ? "ket" : "bra";
-    wp(g, "~Mz->~S0 = z->c;~C", p);
+    wp(g, "~M~Z~S0 = ~zc;~C", p);
 }
 
 static void generate_assignto(struct generator * g, struct node * p) {
     g->V[0] = p->name;
+    if (g->cplusplus) {
+        wp(g, "~Massign_to(~V0);~C", p);
+        return;
+    }
     wp(g, "~M~V0 = assign_to(z, ~V0);~C"
           "~Mif (~V0 == 0) return -1;~C", p);
 }
 
 static void generate_sliceto(struct generator * g, struct node * p) {
     g->V[0] = p->name;
+    if (g->cplusplus) {
+        wp(g, "~Mslice_to(~V0);~C", p);
+        return;
+    }
     wp(g, "~M~V0 = slice_to(z, ~V0);~C"
           "~Mif (~V0 == 0) return -1;~C", p);
 }
@@ -816,16 +1052,50 @@ static void generate_data_address(struct generator * g, struct node * p) {
         wv(g, p->name);
 }
 
+/* C++: writes the string argument of insert(), slice_from() etc, after the
+   name of the function without its suffix: "(data::s_N)" for a literal, and
+   "_v(S_x)" for a string variable. An empty literal has no table, as a
+   constexpr array can't be empty. */
+
+static void generate_data_address_cpp(struct generator * g, struct node * p, const char * args) {
+
+    symbol * b = p->literalstring;
+    if (b != 0) {
+        ws(g, "("); ws(g, args);
+        if (SIZE(b) == 0) ws(g, "std::vector<symbol>()"); else wlitref(g, b);
+    } else {
+        ws(g, "_v("); ws(g, args);
+        wv(g, p->name);
+    }
+    ws(g, ")");
+}
+
+/* C++: insert(), or insert_v() for an empty literal. */
+static void winsert_cpp(struct generator * g, struct node * p, int keep_c, const char * args) {
+    if (keep_c) wp(g, "~{int c_keep = c;~C~M", p); else w(g, "~M");
+    if (p->literalstring != 0 && SIZE(p->literalstring) == 0) ws(g, "insert_v");
+                                                         else ws(g, "insert");
+    generate_data_address_cpp(g, p, args);
+    ws(g, ";");
+    if (keep_c) w(g, "~N~Mc = c_keep;~N~}"); else wp(g, "~C", p);
+}
+
 static void generate_insert(struct generator * g, struct node * p, int style) {
 
     int keep_c = style == c_attach;
     if (p->mode == m_backward) keep_c = !keep_c;
+    if (g->cplusplus) {
+        winsert_cpp(g, p, keep_c, "c, c, ");
+        return;
+    }
+    wspill(g);
     wp(g, "~{", p);
-    if (keep_c) w(g, "int c_keep = z->c;~N~M");
-    wp(g, "int ret = insert_~$(z, z->c, z->c, ", p);
+    if (keep_c) w(g, "int c_keep = ~zc;~N~M");
+    wp(g, "int ret = insert_~$(z, ~zc, ~zc, ", p);
     generate_data_address(g, p);
     wp(g, ");~C", p);
-    if (keep_c) w(g, "~Mz->c = c_keep;~N");
+    wreload(g, true);
+    if (keep_c) w(g, "~M~zc = c_keep;~N");
     wp(g, "~Mif (ret < 0) return ret;~N"
           "~}", p);
 }
@@ -833,13 +1103,19 @@ static void generate_insert(struct generator * g, struct node * p, int style) {
 static void generate_assignfrom(struct generator * g, struct node * p) {
 
     int keep_c = p->mode == m_forward; /* like 'attach' */
+    if (g->cplusplus) {
+        winsert_cpp(g, p, keep_c, keep_c ? "c, l, " : "lb, c, ");
+        return;
+    }
+    wspill(g);
     wp(g, "~{", p);
-    if (keep_c) wp(g, "int c_keep = z->c;~N"
-                   "~Mret = insert_~$(z, z->c, z->l, ", p);
-                else wp(g, "ret = insert_~$(z, z->lb, z->c, ", p);
+    if (keep_c) wp(g, "int c_keep = ~zc;~N"
+                   "~Mret = insert_~$(z, ~zc, ~zl, ", p);
+                else wp(g, "ret = insert_~$(z, ~zlb, ~zc, ", p);
     generate_data_address(g, p);
     wp(g, ");~C", p);
-    if (keep_c) w(g, "~Mz->c = c_keep;~N");
+    wreload(g, true);
+    if (keep_c) w(g, "~M~zc = c_keep;~N");
     wp(g, "~Mif (ret < 0) return ret;~N"
           "~}", p);
 }
@@ -849,27 +1125,49 @@ static void generate_assignfrom(struct generator * g, struct node * p) {
 static void generate_slicefrom(struct generator * g, struct node * p) {
 
 /*  w(g, "~Mslice_from_s(z, ");   <============= bug! should be: */
+    if (g->cplusplus) {
+        if (p->literalstring != 0 && SIZE(p->literalstring) == 0) {
+            wp(g, "~Mslice_del();~C", p);
+            return;
+        }
+        w(g, "~Mslice_from");
+        generate_data_address_cpp(g, p, "");
+        wp(g, ";~C", p);
+        return;
+    }
+    wspill(g);
     wp(g, "~{int ret = slice_from_~$(z, ", p);
     generate_data_address(g, p);
     wp(g, ");~C", p);
+    wreload(g, true);
     wp(g, "~Mif (ret < 0) return ret;~N"
           "~}", p);
 }
 
 static void generate_setlimit(struct generator * g, struct node * p) {
-    int keep_c;
-    wp(g, "~{int mlimit;~C"
-          "~M~k~N"
-          , p);
-    keep_c = g->keep_count;
+    int keep_c = 0;
+    wp(g, "~{int mlimit;~C", p);
+    if (p->keep != 0) {
+        wp(g, "~M~k~N", p);
+        keep_c = g->keep_count;
+    }
     generate(g, p->left);
-    if (p->mode == m_forward) w(g, "~Mmlimit = z->l - z->c; z->l = z->c;~N");
-                         else w(g, "~Mmlimit = z->lb; z->lb = z->c;~N");
-    w(g, "~M"); wrestore(g, p, keep_c); w(g, "~N");
-    g->failure_string = p->mode == m_forward ? "z->l += mlimit;" :
-                                               "z->lb = mlimit;";
+    if (g->locals) {
+        if (p->mode == m_forward) w(g, "~Mmlimit = l - c; z->l = l = c;~N");
+                             else w(g, "~Mmlimit = lb; z->lb = lb = c;~N");
+    } else {
+        if (p->mode == m_forward) w(g, "~Mmlimit = ~Zl - ~zc; ~Zl = ~zc;~N");
+                             else w(g, "~Mmlimit = ~Zlb; ~Zlb = ~zc;~N");
+    }
+    if (keep_c) { w(g, "~M"); wrestore(g, p, keep_c); w(g, "~N"); }
+    if (g->locals)
+        g->failure_string = p->mode == m_forward ? "z->l = l += mlimit;" :
+                                                   "z->lb = lb = mlimit;";
+    else
+        g->failure_string = p->mode == m_forward ? "~Zl += mlimit;" :
+                                                   "~Zlb = mlimit;";
     generate(g, p->aux);
-    wms(g, g->failure_string);
+    w(g, "~M"); w(g, g->failure_string);
     w(g, "~N"
       "~}");
 }
@@ -884,11 +1182,38 @@ static void generate_dollar(struct generator * g, struct node * p) {
     g->failure_string = 0;
 
     g->V[0] = p->name;
+    if (g->cplusplus) {
+        /* '$ s' swaps s in as the current string, and back out again after */
+        wp(g, "~{cursors env = save_cursors();~C"
+                 "~Mbool failure = true; /* assume failure */~N"
+                 "~Mswap_current(~V0);~N"
+                 "~Mlb = c = 0;~N"
+                 "~Ml = int(p.size());~N", p);
+        generate(g, p->left);
+        w(g, "~Mfailure = false; /* mark success */~N");
+        if (g->label_used)
+            wsetl(g, g->failure_label);
+        g->V[0] = p->name; /* necessary */
+
+        g->label_used = used;
+        g->failure_label = a0;
+        g->failure_string = a1;
+
+        w(g, "~Mswap_current(~V0);~N"
+             "~Mrestore_cursors(env);~N"
+             "~Mif (failure) ~f~N~}");
+        return;
+    }
+    wspill(g);
     wp(g, "~{struct SN_env env = * z;~C"
              "~Mint failure = 1; /* assume failure */~N"
-             "~Mz->p = ~V0;~N"
-             "~Mz->lb = z->c = 0;~N"
-             "~Mz->l = SIZE(z->p);~N", p);
+             "~Mz->p = ~V0;~N", p);
+    if (g->locals)
+        w(g, "~Mz->lb = lb = c = 0;~N"
+             "~Mz->l = l = SIZE(z->p);~N");
+    else
+        w(g, "~Mz->lb = z->c = 0;~N"
+             "~Mz->l = SIZE(z->p);~N");
     generate(g, p->left);
     w(g, "~Mfailure = 0; /* mark success */~N");
     if (g->label_used)
@@ -900,8 +1225,9 @@ static void generate_dollar(struct generator * g, struct node * p) {
     g->failure_string = a1;
 
     w(g, "~M~V0 = z->p;~N"
-         "~M* z = env;~N"
-         "~Mif (failure) ~f~N~}");
+         "~M* z = env;~N");
+    wreload(g, true);
+    w(g, "~Mif (failure) ~f~N~}");
 }
 
 static void generate_integer_assign(struct generator * g, struct node * p, char * s) {
@@ -921,8 +1247,14 @@ static void generate_integer_test(struct generator * g, struct node * p, char *
 static void generate_call(struct generator * g, struct node * p) {
 
     g->V[0] = p->name;
-    wp(g, "~{int ret = ~V0(z);~C"
-          "~Mif (ret == 0) ~f~N"
+    if (g->cplusplus) {
+        wp(g, "~Mif (!~V0()) ~f~C", p);
+        return;
+    }
+    wspill(g);
+    wp(g, "~{int ret = ~V0(z);~C", p);
+    wreload(g, true);
+    wp(g, "~Mif (ret == 0) ~f~N"
           "~Mif (ret < 0) return ret;~N~}", p);
 }
 
@@ -935,14 +1267,37 @@ static void generate_grouping(struct generator * g, struct node * p, int complem
     g->V[0] = p->name;
     g->I[0] = q->smallest_ch;
     g->I[1] = q->largest_ch;
-    wp(g, "~Mif (~S1_grouping~S0~S2(z, ~V0, ~I0, ~I1, 0)) ~f~C", p);
+    if (byte_grouping(g, q)) {
+        w(g, p->mode == m_forward ? "~Mif (~zc >= ~zl || " : "~Mif (~zc <= ~zlb || ");
+        wgrouping_member(g, p, !complement);
+        wp(g, ") ~f~C"
+              "~M~i~N", p);
+        return;
+    }
+    if (g->options->utf8) {
+        /* fast path for ASCII, which is always a single byte character */
+        w(g, p->mode == m_forward ? "~Mif (~zc < ~zl && z->p[~zc] < 0x80) {" :
+                                    "~Mif (~zc > ~zlb && z->p[~zc - 1] < 0x80) {");
+        wp(g, "~C~+"
+              "~Mif (", p);
+        wgrouping_member(g, p, !complement);
+        wp(g, ") ~f~N"
+              "~M~i~N"
+              "~-~M} else {~N~+", p);
+    }
+    wspill(g);
+    wp(g, "~Mif (~S1_grouping~S0~S2(~Y~V0, ~I0, ~I1, 0)) ~f~C", p);
+    wreload(g, false);
+    if (g->options->utf8) w(g, "~-~M}~N");
 }
 
 static void generate_namedstring(struct generator * g, struct node * p) {
 
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->V[0] = p->name;
-    wp(g, "~Mif (!(eq_v~S0(z, ~V0))) ~f~C", p);
+    wspill(g);
+    wp(g, "~Mif (!(eq_v~S0(~Y~V0))) ~f~C", p);
+    wreload(g, false);
 }
 
 static void generate_literalstring(struct generator * g, struct node * p) {
@@ -951,24 +1306,236 @@ static void generate_literalstring(struct generator * g, struct node * p) {
     g->I[0] = SIZE(b);
     g->L[0] = b;
 
+    if (g->cplusplus) {
+        if (SIZE(b) == 0) {
+            wp(g, "~M~C", p);
+            return;
+        }
+        wp(g, "~Mif (!eq_s~S0(~L0)) ~f~C", p);
+        return;
+    }
+    if (g->locals) {
+        /* compare in place rather than going through eq_s() */
+        if (SIZE(b) == 0) {
+            wp(g, "~M~C", p);
+        } else if (SIZE(b) == 1) {
+            g->I[1] = b[0];
+            if (p->mode == m_forward)
+                wp(g, "~Mif (c >= l || z->p[c] != ~I1) ~f~C"
+                      "~Mc++;~N", p);
+            else
+                wp(g, "~Mif (c <= lb || z->p[c - 1] != ~I1) ~f~C"
+                      "~Mc--;~N", p);
+        } else {
+            if (p->mode == m_forward)
+                wp(g, "~Mif (l - c < ~I0 || memcmp(z->p + c, ~L0, ~I0 * sizeof(symbol)) != 0) ~f~C"
+                      "~Mc += ~I0;~N", p);
+            else
+                wp(g, "~Mif (c - lb < ~I0 || memcmp(z->p + c - ~I0, ~L0, ~I0 * sizeof(symbol)) != 0) ~f~C"
+                      "~Mc -= ~I0;~N", p);
+        }
+        return;
+    }
     wp(g, "~Mif (!(eq_s~S0(z, ~I0, ~L0))) ~f~C", p);
 }
 
+/* From pass 4 of the optimiser, which runs without -O too: the words shorter than q->short_word_limit
+   which have none of q->short_word_symbols are returned unchanged. */
+static void generate_short_word_check(struct generator * g, struct name * q) {
+    symbol * b = q->short_word_symbols;
+    g->I[0] = q->short_word_limit;
+    if (b == 0) {
+        w(g, g->cplusplus ? "~Mif (~zl < ~I0) return true; /* shorter words are unchanged */~N" :
+                            "~Mif (~zl < ~I0) return 1; /* shorter words are unchanged */~N");
+        return;
+    }
+    if (g->cplusplus) return;  /* there is no table to hand for the test */
+    {   int min = 255, max = 0;
+        int i;
+        symbol map[32];
+        for (i = 0; i < 32; i++) map[i] = 0;
+        for (i = 0; i < SIZE(b); i++) {
+            if (b[i] < min) min = b[i];
+            if (b[i] > max) max = b[i];
+        }
+        for (i = 0; i < SIZE(b); i++) map[(b[i] - min) / 8] |= 1 << (b[i] - min) % 8;
+        w(g, "~Mif (~zl < ~I0) { /* shorter words without these are unchanged */~N~+"
+             "~Mstatic const unsigned char s[] = { ");
+        for (i = 0; i <= (max - min) / 8; i++) {
+            if (i > 0) w(g, ", ");
+            wi(g, map[i]);
+        }
+        g->I[1] = min;
+        g->I[2] = max;
+        w(g, " };~N"
+             "~Mint c0 = z->c;~N"
+             "~Mif (out_grouping(z, s, ~I1, ~I2, 1) < 0) return 1;~N"
+             "~Mz->c = c0;~N"
+             "~}");
+    }
+}
+
+/* -instrument: instrument_counts[] has a counter for each routine, and then
+   for each among, one for its lookups, one for each string of its table and
+   one for each of its cases. */
+
+static int routine_counter(struct generator * g, struct name * q) {
+    struct name * p = g->analyser->names;
+    int n = 0;
+    until (p == q) {
+        if ((p->type == t_routine || p->type == t_external) && p->definition) n++;
+        p = p->next;
+    }
+    return n;
+}
+
+static int among_counter(struct generator * g, struct among * x) {
+    struct among * y = g->analyser->amongs;
+    int n = routine_counter(g, 0);
+    until (y == x) {
+        n += 1 + y->literalstring_count + y->command_count;
+        y = y->next;
+    }
+    return n;
+}
+
+/* -profile: whether the lookups of among x mostly failed in training, or -1
+   if there were none. */
+static int among_usually_fails(struct generator * g, struct among * x) {
+    unsigned long * counts = g->profile->counts + among_counter(g, x);
+    unsigned long found = 0;
+    int i;
+    if (counts[0] == 0) return -1;
+    for (i = 1; i <= x->literalstring_count; i++) found += counts[i];
+    return found < counts[0] - found;
+}
+
+/* -report: a JSON object for each among lookup of the routine, giving
+   whether the quick test ahead of find_among() was made, and at most how
+   many strings of the table find_among() compares with, and how many
+   symbols. */
+static void report_among(struct generator * g, struct node * p, int prefilter) {
+    struct among * x = p->among;
+    struct str * s = g->report_amongs;
+    int probes = 1;
+    int longest = 0;
+    int i;
+    for (i = 2; i < x->literalstring_count; i *= 2) probes++;
+    probes++;  /* find_among() may look at the first string again */
+    for (i = 0; i < x->literalstring_count; i++)
+        if (x->b[i].size > longest) longest = x->b[i].size;
+    if (str_len(s) > 0) str_append_string(s, ",");
+    str_append_string(s, "\n        {\"among\": ");
+    str_append_int(s, x->number);
+    str_append_string(s, ", \"line\": ");
+    str_append_int(s, p->line_number);
+    str_append_string(s, ", \"strings\": ");
+    str_append_int(s, x->literalstring_count);
+    str_append_string(s, ", \"cases\": ");
+    str_append_int(s, x->command_count);
+    str_append_string(s, ", \"routines\": ");
+    str_append_int(s, x->function_count);
+    str_append_string(s, ", \"prefilter\": ");
+    str_append_string(s, prefilter ? "true" : "false");
+    str_append_string(s, ", \"probes\": ");
+    str_append_int(s, probes);
+    str_append_string(s, ", \"comparisons\": ");
+    str_append_int(s, probes * longest);
+    str_append_string(s, "}");
+}
+
+static void report_routine(struct generator * g, struct node * p) {
+    struct str * s = g->report;
+    if (str_len(s) > 0) str_append_string(s, ",");
+    str_append_string(s, "\n    {\"name\": \"");
+    str_append_b(s, p->name->b);
+    str_append_string(s, p->name->type == t_routine ? "\", \"type\": \"routine\"" :
+                                                      "\", \"type\": \"external\"");
+    str_append_string(s, ", \"line\": ");
+    str_append_int(s, p->line_number);
+    str_append_string(s, ", \"saves\": ");
+    str_append_int(s, g->saves);
+    str_append_string(s, ", \"restores\": ");
+    str_append_int(s, g->restores);
+    str_append_string(s, ", \"loops\": ");
+    str_append_int(s, g->loops);
+    str_append_string(s, ", \"grouping_scans\": ");
+    str_append_int(s, g->grouping_scans);
+    str_append_string(s, ",\n     \"amongs\": [");
+    str_append(s, g->report_amongs);
+    str_append_string(s, str_len(g->report_amongs) > 0 ? "\n     ]}" : "]}");
+    str_clear(g->report_amongs);
+}
+
 static void generate_define(struct generator * g, struct node * p) {
     struct name * q = p->name;
     g->next_label = 0;
+    g->saves = g->restores = g->loops = g->grouping_scans = 0;
 
-    g->S[0] = q->type == t_routine ? "static" : "extern";
     g->V[0] = q;
-
-    w(g, "~N~S0 int ~V0(struct SN_env * z) {~N~+");
+    if (g->cplusplus) {
+        g->S[0] = q->type == t_routine ? "private" : "public";
+        w(g, "~N  ~S0:~N~Mbool ~W0() {~N~+");
+    } else {
+        g->S[0] = q->type == t_routine ? "static" : "extern";
+        g->S[1] = "";
+        /* a routine never called in training is kept out of the way */
+        if (g->profile && q->type == t_routine &&
+            g->profile->counts[routine_counter(g, q)] == 0) g->S[1] = " SB_COLD";
+        w(g, "~N~S0~S1 int ~V0(struct SN_env * z) {~N~+");
+    }
     if (p->amongvar_needed) w(g, "~Mint among_var;~N");
+    if (g->locals)
+        w(g, "~Mint c = z->c, l = z->l, lb = z->lb; (void)l; (void)lb;~N");
+    if (g->options->instrument) {
+        g->I[0] = routine_counter(g, q);
+        w(g, "~Minstrument_counts[~I0]++;~N");
+    }
+    if (q->short_word_limit > 1) generate_short_word_check(g, q);
+    if (q->hotwords) {
+        w(g, "~M{   int ret = find_hotword(z, &hw_");
+        str_append_b(g->outbuf, q->b);
+        w(g, ");~N~M    if (ret) return ret;~N~M}~N");
+    }
     g->failure_string = 0;
     g->failure_label = x_return;
     g->label_used = 0;
     g->keep_count = 0;
     generate(g, p->left);
-    w(g, "~Mreturn 1;~N~}");
+    if (g->locals) w(g, "~Mz->c = c;~N");
+    w(g, g->cplusplus ? "~Mreturn true;~N~}" : "~Mreturn 1;~N~}");
+    if (g->options->report_file) report_routine(g, p);
+}
+
+/* For an among with routines, find_among() stops at a string with one,
+   with the cursor after it, returning -2 - i for string i; the routine is
+   called here, directly, and find_among_next() goes on from it. */
+static void generate_among_routines(struct generator * g, struct among * x, struct node * p) {
+    int id;
+    wp(g, "~{int ret = find_among~S0~S3(z, a_~I0, ~I1~S4);~C"
+          "~Mwhile (ret < -1) {~N~+"
+          "~Mint c_among = z->c;~N"
+          "~Mint i = -2 - ret;~N", p);
+    if (x->function_count > 1) w(g, "~Mswitch (a_~I0[i].function) {~N~+");
+    for (id = 1; id <= x->function_count; id++) {
+        int i;
+        for (i = 0; x->b[i].function_id != id; i++) continue;
+        g->I[2] = id;
+        g->V[0] = x->b[i].function;
+        if (x->function_count > 1) {
+            w(g, "~Mcase ~I2: ret = ~W0(z); break;~N");
+        } else {
+            w(g, "~Mret = ~W0(z);~N");
+        }
+    }
+    if (x->function_count > 1) w(g, "~-~M}~N");
+    wp(g, "~Mif (ret < 0) return ret;~N"
+          "~Mz->c = c_among;~N"
+          "~Mret = find_among_next~S0~S3(z, a_~I0, i, ret~S4);~N"
+          "~-~M}~N", p);
+    wreload(g, true);
+    unless (x->command_count == 0 && x->starter == 0) w(g, "~Mamong_var = ret;~N");
+    wp(g, "~Mif (~S8!ret~S9) ~f~N~}", p);
 }
 
 static void generate_substring(struct generator * g, struct node * p) {
@@ -982,17 +1549,31 @@ static void generate_substring(struct generator * g, struct node * p) {
     int n_cases = 0;
     symbol cases[2];
     int shortest_size = INT_MAX;
+    int shortcut = true;
+    char counted[40];
+    char af[64];
+    int fails = g->profile ? among_usually_fails(g, x) : -1;
 
+    counted[0] = '\0';
+    if (g->cplusplus) generate_among_table_cpp(g, x, p->mode == m_backward);
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->I[0] = x->number;
     g->I[1] = x->literalstring_count;
 
+    /* c must be spilled ahead of the test below, which may be followed by
+     * an 'else'. */
+    wspill(g);
+
     /* In forward mode with non-ASCII UTF-8 characters, the first character
      * of the string will often be the same, so instead look at the last
      * common character position.
      *
      * In backward mode, we can't match if there are fewer characters before
      * the current position than the minimum length.
+     *
+     * In C++ the test has to hold for the UTF-8 tables as well as the wide
+     * ones, so it is only made on ASCII characters, and in forward mode only
+     * when the shortest string is of one character, and so of one byte.
      */
     for (c = 0; c < x->literalstring_count; ++c) {
         int size = among_cases[c].size;
@@ -1000,8 +1581,9 @@ static void generate_substring(struct generator * g, struct node * p) {
             shortest_size = size;
         }
     }
+    if (g->cplusplus && p->mode == m_forward && shortest_size > 1) shortcut = false;
 
-    for (c = 0; c < x->literalstring_count; ++c) {
+    for (c = 0; shortcut && c < x->literalstring_count; ++c) {
         symbol ch;
         if (among_cases[c].size == 0) {
             empty_case = c;
@@ -1012,6 +1594,7 @@ static void generate_substring(struct generator * g, struct node * p) {
         } else {
             ch = among_cases[c].b[among_cases[c].size - 1];
         }
+        if (g->cplusplus && ch >= 0x80) shortcut = false;
         if (n_cases == 0) {
             block = ch >> 5;
         } else if (ch >> 5 != block) {
@@ -1036,25 +1619,34 @@ static void generate_substring(struct generator * g, struct node * p) {
         }
     }
 
-    if (block != -1 || n_cases <= 2) {
+    /* with -instrument, every lookup must reach find_among to be counted */
+    if (g->options->instrument) {
+        sprintf(counted, ", instrument_counts + %d", among_counter(g, x));
+    } else if (shortcut && (block != -1 || n_cases <= 2)) {
         char buf[64];
+        const char * z = g->locals || g->cplusplus ? "" : "z->";
+        const char * zp = g->cplusplus ? "" : "z->";
         g->I[2] = block;
         g->I[3] = bitmap;
         g->I[4] = shortest_size - 1;
+        /* -profile: whether the quick test usually rejects */
+        g->S[6] = fails < 0 || empty_case != -1 ? "" : fails ? "SB_LIKELY(" : "SB_UNLIKELY(";
+        g->S[7] = g->S[6][0] ? ")" : "";
         if (p->mode == m_forward) {
-            sprintf(buf, "z->p[z->c + %d]", shortest_size - 1);
+            sprintf(buf, "%sp[%sc + %d]", zp, z, shortest_size - 1);
             g->S[1] = buf;
             if (shortest_size == 1) {
-                wp(g, "~Mif (z->c >= z->l || ", p);
+                wp(g, "~Mif (~S6~zc >= ~zl || ", p);
             } else {
-                wp(g, "~Mif (z->c + ~I4 >= z->l || ", p);
+                wp(g, "~Mif (~S6~zc + ~I4 >= ~zl || ", p);
             }
         } else {
-            g->S[1] = "z->p[z->c - 1]";
+            sprintf(buf, "%sp[%sc - 1]", zp, z);
+            g->S[1] = buf;
             if (shortest_size == 1) {
-                wp(g, "~Mif (z->c <= z->lb || ", p);
+                wp(g, "~Mif (~S6~zc <= ~zlb || ", p);
             } else {
-                wp(g, "~Mif (z->c - ~I4 <= z->lb || ", p);
+                wp(g, "~Mif (~S6~zc - ~I4 <= ~zlb || ", p);
             }
         }
         if (n_cases == 0) {
@@ -1073,6 +1665,7 @@ static void generate_substring(struct generator * g, struct node * p) {
         } else {
             wp(g, "~S1 >> 5 != ~I2 || !((~I3 >> (~S1 & 0x1f)) & 1)", p);
         }
+        ws(g, g->S[7]);
         ws(g, ") ");
         if (empty_case != -1) {
             /* If the among includes the empty string, it can never fail
@@ -1083,17 +1676,95 @@ static void generate_substring(struct generator * g, struct node * p) {
         } else {
             wp(g, "~f~C", p);
         }
-    } else {
-#ifdef OPTIMISATION_WARNINGS
-        printf("Couldn't shortcut among %d\n", x->number);
-#endif
+    }
+    if (g->options->report_file) {
+        report_among(g, p, !g->options->instrument && (block != -1 || n_cases <= 2));
+    }
+    if (g->cplusplus) {
+        /* find_among() calls the routines of the among by number through
+           af_N(), which the compiler can see through and inline. */
+        if (x->function_count > 0) {
+            sprintf(af, ", [this](int function) { return af_%d(function); }", x->number);
+            g->S[2] = af;
+        } else {
+            g->S[2] = "";
+        }
+        if (x->command_count == 0 && x->starter == 0)
+            wp(g, "~Mif (!find_among~S0(data::a_~I0~S2)) ~f~C", p);
+        else
+            wp(g, "~Mamong_var = find_among~S0(data::a_~I0~S2);~C"
+                  "~Mif (!among_var) ~f~N", p);
+        return;
     }
 
+    g->S[3] = g->options->instrument ? "_counted" : "";
+    g->S[4] = counted;
+    /* -profile: whether find_among() usually fails, which isn't known
+       when most lookups fail, if the quick test has turned some away */
+    g->S[8] = fails == 0 ? "SB_UNLIKELY(" :
+              fails == 1 && (counted[0] || (block == -1 && n_cases > 2)) ? "SB_LIKELY(" : "";
+    g->S[9] = g->S[8][0] ? ")" : "";
+    if (x->function_count > 0) {
+        generate_among_routines(g, x, p);
+        return;
+    }
+    if (g->locals) {
+        /* among routines can alter the string, even if find_among fails */
+        if (x->command_count == 0 && x->starter == 0) {
+            wp(g, "~{int ret = find_among~S0~S3(z, a_~I0, ~I1~S4);~C", p);
+            wreload(g, false);
+            wp(g, "~Mif (~S8!ret~S9) ~f~N~}", p);
+        } else {
+            wp(g, "~Mamong_var = find_among~S0~S3(z, a_~I0, ~I1~S4);~C", p);
+            wreload(g, false);
+            wp(g, "~Mif (~S8!(among_var)~S9) ~f~N", p);
+        }
+        return;
+    }
     if (x->command_count == 0 && x->starter == 0)
-        wp(g, "~Mif (!(find_among~S0(z, a_~I0, ~I1))) ~f~C", p);
+        wp(g, "~Mif (~S8!(find_among~S0~S3(z, a_~I0, ~I1~S4))~S9) ~f~C", p);
     else
-        wp(g, "~Mamong_var = find_among~S0(z, a_~I0, ~I1);~C"
-              "~Mif (!(among_var)) ~f~N", p);
+        wp(g, "~Mamong_var = find_among~S0~S3(z, a_~I0, ~I1~S4);~C"
+              "~Mif (~S8!(among_var)~S9) ~f~N", p);
+}
+
+/* -profile: the cases of among x, from p on, most often taken in training
+   first, with those never taken marked cold. */
+static void generate_profiled_cases(struct generator * g, struct among * x, struct node * p) {
+    struct node ** cases = (struct node **) MALLOC((x->command_count + 1) * sizeof(struct node *));
+    int * numbers = (int *) MALLOC((x->command_count + 1) * sizeof(int));
+    unsigned long * counts = g->profile->counts + among_counter(g, x) + x->literalstring_count;
+    int n = 0;
+    int i;
+    until (p == 0) {
+        if (p->type == c_bra && p->left != 0) {
+            /* insertion sort, keeping the order of equal counts */
+            int number = n + 1;
+            for (i = n; i > 0 && counts[numbers[i - 1]] < counts[number]; i--) {
+                cases[i] = cases[i - 1];
+                numbers[i] = numbers[i - 1];
+            }
+            cases[i] = p;
+            numbers[i] = number;
+            n++;
+        }
+        p = p->right;
+    }
+    for (i = 0; i < n; i++) {
+        g->I[0] = numbers[i];
+        w(g, "~Mcase ~I0:~N~+");
+        if (g->options->instrument) {
+            g->I[1] = among_counter(g, x) + x->literalstring_count + g->I[0];
+            w(g, "~Minstrument_counts[~I1]++;~N");
+        }
+        if (counts[numbers[i]] == 0) {
+            g->I[1] = x->number;
+            w(g, "~MSB_COLD_PATH(cold_~I1_~I0);~N");
+        }
+        generate(g, cases[i]); w(g, "~Mbreak;~N~-");
+    }
+    FREE(cases);
+    FREE(numbers);
 }
 
 static void generate_among(struct generator * g, struct node * p) {
@@ -1111,10 +1782,20 @@ static void generate_among(struct generator * g, struct node * p) {
     w(g, "~Mswitch(among_var) {~N~+"
              "~Mcase 0: ~f~N");
 
+    if (g->profile) {
+        generate_profiled_cases(g, x, p);
+        w(g, "~}");
+        return;
+    }
     until (p == 0) {
          if (p->type == c_bra && p->left != 0) {
              g->I[0] = case_number++;
-             w(g, "~Mcase ~I0:~N~+"); generate(g, p); w(g, "~Mbreak;~N~-");
+             w(g, "~Mcase ~I0:~N~+");
+             if (g->options->instrument) {
+                 g->I[1] = among_counter(g, x) + x->literalstring_count + g->I[0];
+                 w(g, "~Minstrument_counts[~I1]++;~N");
+             }
+             generate(g, p); w(g, "~Mbreak;~N~-");
          }
          p = p->right;
     }
@@ -1136,7 +1817,8 @@ static void generate_debug(struct generator * g, struct node * p) {
 
     g->I[0] = g->debug_count++;
     g->I[1] = p->line_number;
-    wp(g, "~Mdebug(z, ~I0, ~I1);~C", p);
+    wspill(g);
+    wp(g, "~Mdebug(~Y~I0, ~I1);~C", p);
 
 }
 
@@ -1146,6 +1828,13 @@ static void generate(struct generator * g, struct node * p) {
     int a0 = g->failure_label;
     const char * a1 = g->failure_string;
 
+    wline(g, p);
+    switch (p->type)
+    {
+        case c_goto: case c_gopast: case c_repeat: case c_loop: case c_atleast:
+            g->loops++;
+            break;
+    }
     switch (p->type)
     {
         case c_define:        generate_define(g, p); break;
@@ -1206,8 +1895,7 @@ static void generate(struct generator * g, struct node * p) {
         case c_false:         generate_false(g, p); break;
         case c_true:          break;
         case c_debug:         generate_debug(g, p); break;
-        default: fprintf(stderr, "%d encountered\n", p->type);
-                 exit(1);
+        default: unexpected_node(p->type);
     }
 
     if (g->failure_label != a0)
@@ -1218,11 +1906,13 @@ static void generate(struct generator * g, struct node * p) {
 
 static void generate_start_comment(struct generator * g) {
 
-    w(g, "~N/* This file was generated automatically by the Snowball to ANSI C compiler */~N");
+    w(g, g->cplusplus ? "~N/* This file was generated automatically by the Snowball to C++ compiler */~N" :
+                        "~N/* This file was generated automatically by the Snowball to ANSI C compiler */~N");
 }
 
 static void generate_head(struct generator * g) {
 
+    if (g->locals) w(g, "~N#include <string.h> /* for memcmp */~N");
     if (g->options->runtime_path == 0) {
         w(g, "~N#include \"header.h\"~N~N");
     } else {
@@ -1292,10 +1982,8 @@ static void generate_among_table(struct generator * g, struct among * x) {
             w(g, "/*~J1 */ { ~I2, ");
             if (v->size == 0) w(g, "0,");
                          else w(g, "s_~I0_~I1,");
-            w(g, " ~I3, ~I4, ");
-            if (v->function == 0) w(g, "0"); else
-                                  wvn(g, v->function);
-            w(g, "}~S0~N");
+            g->I[5] = v->function_id;
+            w(g, " ~I3, ~I4, ~I5}~S0~N");
             v++;
         }
     }
@@ -1314,34 +2002,206 @@ static void set_bit(symbol * b, int i) { b[i/8] |= 1 << i%8; }
 
 static void generate_grouping_table(struct generator * g, struct grouping * q) {
 
-    int range = q->largest_ch - q->smallest_ch + 1;
+    int smallest_ch = byte_grouping(g, q) ? 0 : q->smallest_ch;
+    int largest_ch = byte_grouping(g, q) ? 255 : q->largest_ch;
+    int range = largest_ch - smallest_ch + 1;
     int size = (range + 7)/ 8;  /* assume 8 bits per symbol */
     symbol * b = q->b;
     symbol * map = create_b(size);
     int i;
     for (i = 0; i < size; i++) map[i] = 0;
 
-    for (i = 0; i < SIZE(b); i++) set_bit(map, b[i] - q->smallest_ch);
+    for (i = 0; i < SIZE(b); i++) set_bit(map, b[i] - smallest_ch);
 
     {
         g->V[0] = q->name;
 
-        w(g, "static const unsigned char ~V0[] = { ");
+        w(g, g->cplusplus ? "    static constexpr unsigned char ~W0[] = { " :
+                            "static const unsigned char ~V0[] = { ");
         for (i = 0; i < size; i++) {
              wi(g, map[i]);
              if (i < size - 1) w(g, ", ");
         }
-        w(g, " };~N~N");
+        w(g, g->cplusplus ? " };~N" : " };~N~N");
+        if (g->cplusplus) wdefinition(g, "unsigned char", "_groupings<T>", "~W0");
     }
     lose_b(map);
 }
 
 static void generate_groupings(struct generator * g) {
     struct grouping * q = g->analyser->groupings;
+    if (g->cplusplus) w(g, "~Ntemplate <typename T>~N"
+                           "struct ~S0_groupings {~N");
     until (q == 0) {
         generate_grouping_table(g, q);
         q = q->next;
     }
+    if (g->cplusplus) w(g, "};~N");
+}
+
+static void generate_int_array(struct generator * g, const char * type, const char * prefix,
+                               struct name * q, int * v, int n) {
+    int i;
+    g->S[0] = type;
+    g->S[1] = prefix;
+    w(g, "static const ~S0 ~S1");
+    str_append_b(g->outbuf, q->b);
+    w(g, "[] = {");
+    for (i = 0; i < n; i++) {
+        if (i % 16 == 0) w(g, "~N    ");
+        wi(g, v[i]);
+        if (i < n - 1) wch(g, ',');
+    }
+    w(g, "~N};~N");
+}
+
+/* Tables for -hotwords: find_hotword() looks the word up in one of these
+   before the stemming proper. An empty list gives no table, and no lookup,
+   as ISO C has no empty initialiser. */
+static void generate_hotwords(struct generator * g) {
+    struct name * q;
+    for (q = g->analyser->names; q != 0; q = q->next) {
+        struct hotwords * h;
+        int * s;
+        int i;
+        if (q->type != t_external || q->definition == 0) continue;
+        h = make_hotwords(g->analyser, g->options, q);
+        if (h->count == 0) {
+            lose_hotwords(h);
+            continue;
+        }
+        q->hotwords = true;
+        s = (int *) MALLOC((SIZE(h->s) + 1) * sizeof(int));
+        for (i = 0; i < SIZE(h->s); i++) s[i] = h->s[i];
+        g->I[0] = h->count;
+        w(g, "~N/* ~I0 hot words */~N");
+        generate_int_array(g, "symbol", "hw_s_", q, s, SIZE(h->s));
+        generate_int_array(g, "int", "hw_d_", q, h->d, h->bucket_count);
+        generate_int_array(g, "int", "hw_slot_", q, h->slot, 4 * h->slot_count);
+        g->I[0] = h->bucket_count;
+        g->I[1] = h->slot_count;
+        w(g, "static const struct hotwords hw_");
+        str_append_b(g->outbuf, q->b);
+        w(g, " = { ~I0, ~I1, hw_d_");
+        str_append_b(g->outbuf, q->b);
+        w(g, ", hw_slot_");
+        str_append_b(g->outbuf, q->b);
+        w(g, ", hw_s_");
+        str_append_b(g->outbuf, q->b);
+        w(g, " };~N");
+        FREE(s);
+        lose_hotwords(h);
+    }
+}
+
+/* The version of the stemmer is a hash of its source and of the among
+   tables made from it, so that it changes whenever the output may. It is
+   written into s, which must have room for 17 chars. */
+extern void version_of_stemmer(struct analyser * a, char * s) {
+    unsigned int h[2];
+    struct among * x = a->amongs;
+    h[0] = a->source_hash[0];
+    h[1] = a->source_hash[1];
+    until (x == 0) {
+        int i;
+        for (i = 0; i < x->literalstring_count; i++) {
+            struct amongvec * v = x->b + i;
+            symbol n[4];
+            n[0] = v->size;
+            n[1] = v->i;
+            n[2] = v->result;
+            n[3] = v->function_id;
+            add_to_hash(h, n, 4);
+            add_to_hash(h, v->b, v->size);
+        }
+        x = x->next;
+    }
+    sprintf(s, "%08x%08x", h[0], h[1]);
+}
+
+static void generate_version(struct generator * g) {
+    char s[20];
+    version_of_stemmer(g->analyser, s);
+    g->S[0] = s;
+    w(g, "~Nextern const char * ~pversion(void) { return \"~S0\"; }~N");
+}
+
+/* Writes the symbols of b as the body of a C string. */
+static void wcstring(struct generator * g, symbol * b, int n) {
+    int i;
+    for (i = 0; i < n; i++) {
+        symbol u[4];
+        int k = 1;
+        int j;
+        u[0] = b[i];
+        if (b[i] > 255) k = put_utf8(b[i], u);
+        for (j = 0; j < k; j++) {
+            int ch = u[j];
+            if (32 <= ch && ch < 127) {
+                if (ch == '"' || ch == '\\' || ch == '?') wch(g, '\\');
+                wch(g, ch);
+            } else {
+                char s[8];
+                sprintf(s, "\\%03o", ch);
+                ws(g, s);
+            }
+        }
+    }
+}
+
+static struct node * among_node(struct generator * g, struct among * x) {
+    struct node * p = g->analyser->nodes;
+    until (p->type == c_among && p->among == x) p = p->next;
+    return p;
+}
+
+/* -instrument: the names of the counters, which ~pcounters() hands out
+   with the counters themselves. */
+static void generate_instrument_names(struct generator * g) {
+    struct name * q = g->analyser->names;
+    struct among * x = g->analyser->amongs;
+    g->I[0] = among_counter(g, 0);
+    w(g, "~Nstatic const char * const instrument_names[~I0] = {~N");
+    until (q == 0) {
+        if ((q->type == t_routine || q->type == t_external) && q->definition) {
+            w(g, q->type == t_routine ? "    \"routine " : "    \"external ");
+            wcstring(g, q->b, SIZE(q->b));
+            w(g, "\",~N");
+        }
+        q = q->next;
+    }
+    until (x == 0) {
+        struct node * p = among_node(g, x);
+        int i;
+        g->I[0] = x->number;
+        g->I[1] = p->line_number;
+        w(g, "    \"among ~I0, line ~I1\",~N");
+        for (i = 0; i < x->literalstring_count; i++) {
+            w(g, "    \"among ~I0 '");
+            wcstring(g, x->b[i].b, x->b[i].size);
+            w(g, "'\",~N");
+        }
+        /* the cases are numbered as by generate_among() */
+        g->I[2] = 1;
+        p = p->left;
+        if (p != 0 && p->type != c_literalstring) p = p->right;
+        until (p == 0) {
+            if (p->type == c_bra && p->left != 0) {
+                g->I[1] = p->line_number;
+                w(g, "    \"among ~I0 case ~I2, line ~I1\",~N");
+                g->I[2]++;
+            }
+            p = p->right;
+        }
+        x = x->next;
+    }
+    g->I[0] = among_counter(g, 0);
+    w(g, "};~N~N"
+         "extern int ~pcounters(const char * const ** names, unsigned long ** counts) {~N"
+         "    *names = instrument_names;~N"
+         "    *counts = instrument_counts;~N"
+         "    return ~I0;~N"
+         "}~N");
 }
 
 static void generate_create(struct generator * g) {
@@ -1366,7 +2226,10 @@ static void generate_create_and_close_templates(struct generator * g) {
     w(g, "~N"
          "extern struct SN_env * ~pcreate_env(void);~N"
          "extern void ~pclose_env(struct SN_env * z);~N"
-         "~N");
+         "extern const char * ~pversion(void);~N");
+    if (g->options->instrument)
+        w(g, "extern int ~pcounters(const char * const ** names, unsigned long ** counts);~N");
+    w(g, "~N");
 }
 
 static void generate_header_file(struct generator * g) {
@@ -1381,12 +2244,16 @@ static void generate_header_file(struct generator * g) {
          "#endif~N");            /* for C++ */
 
     generate_create_and_close_templates(g);
+    if (g->options->instrument)
+        w(g, "#define ~pcounters ~pcounters~N~N");  /* for libstemmer */
     until (q == 0) {
         g->V[0] = q;
         switch (q->type)
         {
             case t_external:
-                w(g, "extern int ~W0(struct SN_env * z);~N");
+                g->I[0] = q->max_growth;
+                w(g, "extern int ~W0(struct SN_env * z);~N"
+                     "#define ~W0_max_growth ~I0~N");
                 break;
             case t_string:  g->S[1] = "S"; goto label0;
             case t_integer: g->S[1] = "I"; goto label0;
@@ -1428,6 +2295,11 @@ extern void generate_program_c(struct generator * g) {
          "#endif~N");
     generate_amongs(g);
     generate_groupings(g);
+    if (g->options->hotwords_file) generate_hotwords(g);
+    if (g->options->instrument) {
+        g->I[0] = among_counter(g, 0);
+        w(g, "static unsigned long instrument_counts[~I0];~N~N");
+    }
     g->declarations = g->outbuf;
     g->outbuf = str_new();
     g->literalstring_count = 0;
@@ -1435,8 +2307,16 @@ extern void generate_program_c(struct generator * g) {
         struct node * p = g->analyser->program;
         until (p == 0) { generate(g, p); p = p->right; }
     }
+    if (g->options->lines) wline_to_output(g);
     generate_create(g);
     generate_close(g);
+    generate_version(g);
+    if (g->options->instrument) generate_instrument_names(g);
+    if (g->options->report_file) {
+        fprintf(g->options->output_report, "{\"routines\": [");
+        output_str(g->options->output_report, g->report);
+        fprintf(g->options->output_report, "\n]}\n");
+    }
     output_str(g->options->output_c, g->declarations);
     str_delete(g->declarations);
     output_str(g->options->output_c, g->outbuf);
@@ -1448,18 +2328,283 @@ extern void generate_program_c(struct generator * g) {
     str_delete(g->outbuf);
 }
 
+/* C++ */
+
+static void generate_head_cpp(struct generator * g) {
+
+    const char * s = g->options->name;
+    w(g, "~N#ifndef SNOWBALL_");
+    for (; *s; s++) wch(g, 'a' <= *s && *s <= 'z' ? *s - 'a' + 'A' : *s);
+    w(g, "_HPP~N#define SNOWBALL_");
+    for (s = g->options->name; *s; s++) wch(g, 'a' <= *s && *s <= 'z' ? *s - 'a' + 'A' : *s);
+    w(g, "_HPP~N~N#include <climits> /* for INT_MAX, INT_MIN */~N");
+    if (g->options->runtime_path == 0) {
+        w(g, "#include \"snowball.hpp\"~N~N");
+    } else {
+        w(g, "#include \"");
+        ws(g, g->options->runtime_path);
+        if (g->options->runtime_path[strlen(g->options->runtime_path) - 1] != '/')
+            wch(g, '/');
+        w(g, "snowball.hpp\"~N~N");
+    }
+    w(g, "namespace snowball {~N");
+}
+
+static void reverse_b(symbol * b) {
+    int i = 0; int j = SIZE(b) - 1;
+    until (i >= j) {
+        int ch1 = b[i]; int ch2 = b[j];
+        b[i++] = ch2; b[j--] = ch1;
+    }
+}
+
+static int compare_amongvec(const void *pv, const void *qv) {
+    const struct amongvec * p = (const struct amongvec*)pv;
+    const struct amongvec * q = (const struct amongvec*)qv;
+    symbol * b_p = p->b; int p_size = p->size;
+    symbol * b_q = q->b; int q_size = q->size;
+    int smaller_size = p_size < q_size ? p_size : q_size;
+    int i;
+    for (i = 0; i < smaller_size; i++)
+        if (b_p[i] != b_q[i]) return b_p[i] - b_q[i];
+    return p_size - q_size;
+}
+
+/* The among x with its strings in UTF-8, sorted and linked up as
+   make_among() in analyser.c does. Only the order of the strings read
+   forwards is kept by UTF-8, so a backward among has to be sorted afresh. */
+
+static struct amongvec * utf8_among(struct among * x, int backward) {
+    int n = x->literalstring_count;
+    NEWVEC(amongvec, v, n);
+    struct amongvec * w0;
+    memmove(v, x->b, n * sizeof(struct amongvec));
+    for (w0 = v; w0 < v + n; w0++) {
+        w0->b = utf8_b(w0->b);
+        w0->size = SIZE(w0->b);
+        w0->i = -1;
+        if (backward) reverse_b(w0->b);
+    }
+    qsort(v, n, sizeof(struct amongvec), compare_amongvec);
+    for (w0 = v + n - 1; w0 >= v; w0--) {
+        struct amongvec * w;
+        for (w = w0 - 1; w >= v; w--) {
+            if (w->size < w0->size && memcmp(w->b, w0->b, w->size * sizeof(symbol)) == 0) {
+                w0->i = w - v;
+                break;
+            }
+        }
+    }
+    if (backward) for (w0 = v; w0 < v + n; w0++) reverse_b(w0->b);
+    return v;
+}
+
+/* Writes the strings of among x and the table of them into both sets of
+   tables. */
+
+static void generate_among_table_cpp(struct generator * g, struct among * x, int backward) {
+
+    int utf8;
+    struct str * s = g->outbuf;
+
+    for (utf8 = 1; utf8 >= 0; utf8--) {
+        struct amongvec * v = utf8 ? utf8_among(x, backward) : x->b;
+        int i;
+        const char * scope = utf8 ? "_data<true, T>" : "_data<false, T>";
+        g->outbuf = utf8 ? g->declarations : g->wide_declarations;
+        g->S[0] = utf8 ? "unsigned char" : "char32_t";
+        g->I[0] = x->number;
+        wdefinition(g, utf8 ? "among<unsigned char>" : "among<char32_t>", scope, "a_~I0");
+        for (i = 0; i < x->literalstring_count; i++) {
+            if (v[i].size == 0) continue;
+            g->I[1] = i;
+            g->I[2] = v[i].size;
+            wdefinition(g, g->S[0], scope, "s_~I0_~I1");
+            w(g, "~N    static constexpr ~S0 s_~I0_~I1[~I2] = ");
+            wlitarray(g, v[i].b);
+            ws(g, ";");
+        }
+        w(g, "~N~N    static constexpr among<~S0> a_~I0[] = {~N");
+        for (i = 0; i < x->literalstring_count; i++) {
+            g->I[1] = i;
+            g->I[2] = v[i].size;
+            g->I[3] = v[i].i;
+            g->I[4] = v[i].result;
+            g->I[5] = v[i].function_id;
+            g->S[1] = i < x->literalstring_count - 1 ? "," : "";
+            w(g, "    /*~J1 */ { ~I2, ");
+            if (v[i].size == 0) w(g, "nullptr,");
+                           else w(g, "s_~I0_~I1,");
+            w(g, " ~I3, ~I4, ~I5 }~S1~N");
+        }
+        w(g, "    };~N");
+        if (utf8) {
+            for (i = 0; i < x->literalstring_count; i++) lose_b(v[i].b);
+            FREE(v);
+        }
+    }
+    g->outbuf = s;
+}
+
+static void generate_among_funcs_cpp(struct generator * g) {
+    struct among * x = g->analyser->amongs;
+    until (x == 0) {
+        if (x->function_count > 0) {
+            int id;
+            g->I[0] = x->number;
+            w(g, "~N  private:~N"
+                 "~Mbool af_~I0(int function) {~N~+"
+                 "~Mswitch (function) {~N~+");
+            for (id = 1; id <= x->function_count; id++) {
+                int i;
+                for (i = 0; x->b[i].function_id != id; i++) continue;
+                g->I[1] = id;
+                g->V[0] = x->b[i].function;
+                w(g, "~Mcase ~I1: return ~W0();~N");
+            }
+            w(g, "~-~M}~N"
+                 "~Mreturn false;~N"
+                 "~}");
+        }
+        x = x->next;
+    }
+}
+
+static void generate_variables_cpp(struct generator * g) {
+    struct name * q = g->analyser->names;
+    w(g, "~N  private:~N");
+    until (q == 0) {
+        g->V[0] = q;
+        switch (q->type) {
+            case t_string:  w(g, "~Mstd::vector<symbol> ~W0;~N"); break;
+            case t_integer: w(g, "~Mint ~W0 = 0;~N"); break;
+            case t_boolean: w(g, "~Mbool ~W0 = false;~N"); break;
+        }
+        q = q->next;
+    }
+}
+
+static void generate_class_head_cpp(struct generator * g) {
+
+    /* the tables are members of templates, so that the definitions which
+       C++11 and C++14 need can go in the header */
+    w(g, "~N"
+         "template <bool utf8, typename T = void> struct ~S0_data;~N"
+         "~N"
+         "template <typename T>~N"
+         "struct ~S0_data<true, T> : ~S0_groupings<T> {~N");
+    str_append(g->outbuf, g->declarations);
+    w(g, "};~N"
+         "~N"
+         "template <typename T>~N"
+         "struct ~S0_data<false, T> : ~S0_groupings<T> {~N");
+    str_append(g->outbuf, g->wide_declarations);
+    w(g, "};~N");
+    if (str_len(g->definitions) > 0) {
+        w(g, "~N"
+             "#if __cplusplus < 201703L && !(defined _MSVC_LANG && _MSVC_LANG >= 201703L)~N");
+        str_append(g->outbuf, g->definitions);
+        w(g, "#endif~N");
+    }
+    w(g, "~N"
+         "template <typename symbol>~N"
+         "class ~S0 : public program<symbol> {~N"
+         "~N"
+         "    typedef program<symbol> base;~N"
+         "    typedef ~S0_data<base::utf8 != 0> data;~N"
+         "~N"
+         "    using base::p; using base::c; using base::l; using base::lb;~N"
+         "    using base::bra; using base::ket;~N"
+         "    using typename base::cursors; using base::save_cursors; using base::restore_cursors;~N"
+         "    using base::swap_current; using base::hop;~N"
+         "    using base::in_grouping; using base::in_grouping_b;~N"
+         "    using base::out_grouping; using base::out_grouping_b;~N"
+         "    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;~N"
+         "    using base::find_among; using base::find_among_b;~N"
+         "    using base::slice_from; using base::slice_from_v; using base::slice_del;~N"
+         "    using base::insert; using base::insert_v;~N"
+         "    using base::slice_to; using base::assign_to; using base::debug;~N");
+}
+
+extern void generate_program_cpp(struct generator * g) {
+
+    struct str * routines;
+
+    g->declarations = str_new();
+    g->wide_declarations = str_new();
+    g->definitions = str_new();
+    g->outbuf = str_new();
+    g->literalstring_count = 0;
+    g->margin = 1;
+    {
+        struct node * p = g->analyser->program;
+        until (p == 0) { generate(g, p); p = p->right; }
+    }
+    generate_among_funcs_cpp(g);
+    generate_variables_cpp(g);
+    routines = g->outbuf;
+
+    g->outbuf = str_new();
+    g->S[0] = g->options->name;
+    generate_start_comment(g);
+    generate_head_cpp(g);
+    generate_groupings(g);
+    generate_class_head_cpp(g);
+    str_append(g->outbuf, routines);
+    w(g, "};~N"
+         "~N"
+         "}~N"
+         "~N"
+         "#endif~N");
+    output_str(g->options->output_h, g->outbuf);
+
+    str_delete(routines);
+    str_delete(g->outbuf);
+    str_delete(g->declarations);
+    str_delete(g->wide_declarations);
+    str_delete(g->definitions);
+}
+
 extern struct generator * create_generator_c(struct analyser * a, struct options * o) {
     NEW(generator, g);
     g->analyser = a;
     g->options = o;
+    g->cplusplus = o->make_lang == LANG_CPLUSPLUS;
+    g->locals = o->locals && !g->cplusplus;
     g->margin = 0;
     g->debug_count = 0;
     g->line_count = 0;
+    g->source_line = 0;
+    g->source_file = 0;
+    g->report = 0;
+    g->report_amongs = 0;
+    if (o->report_file) {
+        g->report = str_new();
+        g->report_amongs = str_new();
+    }
+    g->profile = 0;
+    if (o->profile_file) {
+        g->profile = read_profile(a, o);
+        if (g->profile->count != among_counter(g, 0)) {
+            struct str * text = str_new();
+            str_append_string(text, "Profile ");
+            str_append_string(text, o->profile_file);
+            str_append_string(text, " doesn't match the program");
+            report(0, 0, false, text);
+            str_delete(text);
+            fatal();
+        }
+    }
     return g;
 }
 
 extern void close_generator_c(struct generator * g) {
 
+    if (g->report) {
+        str_delete(g->report);
+        str_delete(g->report_amongs);
+    }
+    if (g->profile) lose_profile(g->profile);
     FREE(g);
 }
 
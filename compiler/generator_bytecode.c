@@ -0,0 +1,303 @@
+#include <stdio.h>   /* for fprintf etc */
+#include <stdlib.h>  /* for exit, qsort, bsearch */
+#include <string.h>  /* for memset, memcpy */
+#include "header.h"
+#include "../runtime/bytecode.h"
+
+/* -bytecode: the syntax tree is written out as it stands, for
+   runtime/bytecode.c to run. Each node becomes a struct sb_bc_node, and the
+   pointers between nodes, to routines, amongs and groupings become indexes.
+   The layout is described in runtime/bytecode.h. */
+
+struct index {
+
+    struct node * p;
+    int i;
+};
+
+struct writer {
+
+    struct analyser * a;
+    struct index * index;     /* the nodes sorted by address */
+    int node_count;
+    symbol * blob;
+};
+
+static int compare_index(const void * x, const void * y) {
+    const struct node * p = ((const struct index *) x)->p;
+    const struct node * q = ((const struct index *) y)->p;
+    return p < q ? -1 : p > q;
+}
+
+static int node_index(struct writer * w, struct node * p) {
+    struct index key;
+    struct index * found;
+    if (p == 0) return -1;
+    key.p = p;
+    found = (struct index *) bsearch(&key, w->index, w->node_count,
+                                     sizeof(struct index), compare_index);
+    if (found == 0) {
+        report_s(0, 0, false, "node not in the syntax tree");
+        fatal();
+    }
+    return found->i;
+}
+
+static int add_to_blob(struct writer * w, symbol * p, int n) {
+    int offset = SIZE(w->blob);
+    w->blob = add_to_b(w->blob, n, p);
+    return offset;
+}
+
+static int op_of(struct node * p) {
+    switch (p->type) {
+        case c_bra: return SB_OP_BRA;
+        case c_and: return SB_OP_AND;
+        case c_or: return SB_OP_OR;
+        case c_backwards: return SB_OP_BACKWARDS;
+        case c_not: return SB_OP_NOT;
+        case c_set: return SB_OP_SET;
+        case c_unset: return SB_OP_UNSET;
+        case c_try: return SB_OP_TRY;
+        case c_do: return SB_OP_DO;
+        case c_fail: return SB_OP_FAIL;
+        case c_reverse: return SB_OP_REVERSE;
+        case c_test: return SB_OP_TEST;
+        case c_goto: return SB_OP_GOTO;
+        case c_gopast: return SB_OP_GOPAST;
+        case c_repeat: return SB_OP_REPEAT;
+        case c_loop: return SB_OP_LOOP;
+        case c_atleast: return SB_OP_ATLEAST;
+        case c_setmark: return SB_OP_SETMARK;
+        case c_tomark: return SB_OP_TOMARK;
+        case c_atmark: return SB_OP_ATMARK;
+        case c_hop: return SB_OP_HOP;
+        case c_next: return SB_OP_NEXT;
+        case c_tolimit: return SB_OP_TOLIMIT;
+        case c_atlimit: return SB_OP_ATLIMIT;
+        case c_leftslice: return SB_OP_LEFTSLICE;
+        case c_rightslice: return SB_OP_RIGHTSLICE;
+        case c_assignto: return SB_OP_ASSIGNTO;
+        case c_sliceto: return SB_OP_SLICETO;
+        case c_assign: return SB_OP_ASSIGN;
+        case c_insert: return SB_OP_INSERT;
+        case c_attach: return SB_OP_ATTACH;
+        case c_delete: return SB_OP_DELETE;
+        case c_slicefrom: return SB_OP_SLICEFROM;
+        case c_setlimit: return SB_OP_SETLIMIT;
+        case c_dollar: return SB_OP_DOLLAR;
+        case c_mathassign: return SB_OP_MATHASSIGN;
+        case c_plusassign: return SB_OP_PLUSASSIGN;
+        case c_minusassign: return SB_OP_MINUSASSIGN;
+        case c_multiplyassign: return SB_OP_MULTIPLYASSIGN;
+        case c_divideassign: return SB_OP_DIVIDEASSIGN;
+        case c_eq: return SB_OP_EQ;
+        case c_ne: return SB_OP_NE;
+        case c_gr: return SB_OP_GR;
+        case c_ge: return SB_OP_GE;
+        case c_ls: return SB_OP_LS;
+        case c_le: return SB_OP_LE;
+        case c_call: return SB_OP_CALL;
+        case c_grouping: return SB_OP_GROUPING;
+        case c_non: return SB_OP_NON;
+        case c_name:
+            switch (p->name->type) {
+                case t_string: return SB_OP_NAME;
+                case t_integer: return SB_OP_INTEGER;
+            }
+            return SB_OP_TRUE; /* in the definition of a grouping */
+        case c_literalstring: return SB_OP_LITERALSTRING;
+        case c_among: return SB_OP_AMONG;
+        case c_substring: return SB_OP_SUBSTRING;
+        case c_booltest: return SB_OP_BOOLTEST;
+        case c_false: return SB_OP_FALSE;
+        case c_true:
+        case c_debug:
+        case c_define: /* never run: calls go to the definition itself */
+            return SB_OP_TRUE;
+        case c_number: return SB_OP_NUMBER;
+        case c_maxint: return SB_OP_MAXINT;
+        case c_minint: return SB_OP_MININT;
+        case c_neg: return SB_OP_NEG;
+        case c_multiply: return SB_OP_MULTIPLY;
+        case c_plus: return SB_OP_PLUS;
+        case c_minus: return SB_OP_MINUS;
+        case c_divide: return SB_OP_DIVIDE;
+        case c_sizeof: return SB_OP_SIZEOF;
+        case c_cursor: return SB_OP_CURSOR;
+        case c_limit: return SB_OP_LIMIT;
+        case c_size: return SB_OP_SIZE;
+    }
+    {   struct str * text = str_new();
+        str_append_string(text, name_of_token(p->type));
+        str_append_string(text, " can't be written as bytecode");
+        report(0, 0, false, text);
+        str_delete(text);
+    }
+    fatal();
+    return 0;
+}
+
+static void make_node(struct writer * w, struct node * p, struct sb_bc_node * q) {
+    q->op = op_of(p);
+    q->backward = p->mode == m_backward;
+    q->left = node_index(w, p->left);
+    q->right = node_index(w, p->right);
+    q->aux = node_index(w, p->aux);
+    q->AE = node_index(w, p->AE);
+    q->arg = 0;
+    q->size = 0;
+    switch (p->type) {
+        case c_number:
+            q->arg = p->number;
+            break;
+        case c_call:
+            q->arg = node_index(w, p->name->definition);
+            break;
+        case c_grouping:
+        case c_non:
+            q->arg = p->name->grouping->number;
+            break;
+        case c_among:
+        case c_substring:
+            q->arg = p->among->number;
+            break;
+        case c_assign:
+        case c_insert:
+        case c_attach:
+        case c_slicefrom:
+        case c_literalstring:
+            if (p->literalstring != 0) {
+                q->size = SIZE(p->literalstring);
+                q->arg = add_to_blob(w, p->literalstring, q->size);
+                break;
+            }
+            q->size = -1;
+            q->arg = p->name->count;
+            break;
+        default:
+            if (q->op != SB_OP_TRUE && p->name != 0) q->arg = p->name->count;
+            break;
+    }
+}
+
+static void write_part(FILE * f, const void * p, size_t size, int n) {
+    if (n > 0 && fwrite(p, size, n, f) != (size_t) n) {
+        report_s(0, 0, false, "error writing bytecode");
+        fatal();
+    }
+}
+
+extern void generate_program_bytecode(struct analyser * a, struct options * o) {
+    struct writer w;
+    struct sb_bc_header h;
+    struct sb_bc_node * nodes;
+    struct sb_bc_among * amongs;
+    struct sb_bc_amongvec * vecs;
+    struct sb_bc_grouping * groupings;
+    struct sb_bc_external * externals;
+    int grouping_count = 0;
+    int external_count = 0;
+    int amongvec_count = 0;
+    int i;
+
+    w.a = a;
+    w.node_count = 0;
+    w.blob = create_b(0);
+    {   struct node * p;
+        for (p = a->nodes; p != 0; p = p->next) w.node_count++;
+        w.index = (struct index *) MALLOC(w.node_count * sizeof(struct index));
+        for (p = a->nodes, i = 0; p != 0; p = p->next, i++) {
+            w.index[i].p = p;
+            w.index[i].i = i;
+        }
+        qsort(w.index, w.node_count, sizeof(struct index), compare_index);
+        nodes = (struct sb_bc_node *) MALLOC(w.node_count * sizeof(struct sb_bc_node));
+        for (p = a->nodes, i = 0; p != 0; p = p->next, i++) make_node(&w, p, nodes + i);
+    }
+    {   struct among * x;
+        for (x = a->amongs; x != 0; x = x->next) amongvec_count += x->literalstring_count;
+        amongs = (struct sb_bc_among *) MALLOC(a->among_count * sizeof(struct sb_bc_among));
+        vecs = (struct sb_bc_amongvec *) MALLOC(amongvec_count * sizeof(struct sb_bc_amongvec));
+        amongvec_count = 0;
+        for (x = a->amongs; x != 0; x = x->next) {
+            struct sb_bc_among * y = amongs + x->number;
+            y->vec = amongvec_count;
+            y->count = x->literalstring_count;
+            y->command_count = x->command_count;
+            y->starter = node_index(&w, x->starter);
+            y->substring = x->substring != 0;
+            for (i = 0; i < x->literalstring_count; i++) {
+                struct amongvec * v = x->b + i;
+                struct sb_bc_amongvec * u = vecs + amongvec_count++;
+                u->s = add_to_blob(&w, v->b, v->size);
+                u->s_size = v->size;
+                u->substring_i = v->i;
+                u->result = v->result;
+                u->function = v->function == 0 ? -1 : node_index(&w, v->function->definition);
+            }
+        }
+    }
+    {   struct grouping * q;
+        for (q = a->groupings; q != 0; q = q->next) grouping_count++;
+        groupings = (struct sb_bc_grouping *) MALLOC(grouping_count * sizeof(struct sb_bc_grouping));
+        for (q = a->groupings; q != 0; q = q->next) {
+            struct sb_bc_grouping * y = groupings + q->number;
+            int size = (q->largest_ch - q->smallest_ch) / 8 + 1;
+            symbol * map = create_b(size);
+            for (i = 0; i < size; i++) map[i] = 0;
+            for (i = 0; i < SIZE(q->b); i++) {
+                int ch = q->b[i] - q->smallest_ch;
+                map[ch / 8] |= 1 << ch % 8;
+            }
+            y->bitmap = add_to_blob(&w, map, size);
+            y->min = q->smallest_ch;
+            y->max = q->largest_ch;
+            lose_b(map);
+        }
+    }
+    {   struct name * q;
+        for (q = a->names; q != 0; q = q->next) if (q->type == t_external) external_count++;
+        externals = (struct sb_bc_external *) MALLOC(external_count * sizeof(struct sb_bc_external));
+        i = 0;
+        for (q = a->names; q != 0; q = q->next) {
+            if (q->type != t_external) continue;
+            externals[i].name_size = SIZE(q->b);
+            externals[i].name = add_to_blob(&w, q->b, SIZE(q->b));
+            externals[i].node = node_index(&w, q->definition);
+            externals[i].max_growth = q->max_growth;
+            i++;
+        }
+    }
+
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, SB_BYTECODE_MAGIC, 8);
+    h.version = SB_BYTECODE_VERSION;
+    h.utf8 = o->utf8;
+    h.node_count = w.node_count;
+    h.among_count = a->among_count;
+    h.amongvec_count = amongvec_count;
+    h.grouping_count = grouping_count;
+    h.external_count = external_count;
+    h.strings = a->name_count[t_string];
+    h.integers = a->name_count[t_integer];
+    h.booleans = a->name_count[t_boolean];
+    h.blob_size = SIZE(w.blob);
+    version_of_stemmer(a, h.version_of_stemmer);
+
+    write_part(o->output_bytecode, &h, sizeof h, 1);
+    write_part(o->output_bytecode, nodes, sizeof(struct sb_bc_node), h.node_count);
+    write_part(o->output_bytecode, amongs, sizeof(struct sb_bc_among), h.among_count);
+    write_part(o->output_bytecode, vecs, sizeof(struct sb_bc_amongvec), h.amongvec_count);
+    write_part(o->output_bytecode, groupings, sizeof(struct sb_bc_grouping), h.grouping_count);
+    write_part(o->output_bytecode, externals, sizeof(struct sb_bc_external), h.external_count);
+    for (i = 0; i < h.blob_size; i++) putc(w.blob[i], o->output_bytecode);
+
+    FREE(w.index);
+    FREE(nodes);
+    FREE(amongs);
+    FREE(vecs);
+    FREE(groupings);
+    FREE(externals);
+    lose_b(w.blob);
+}
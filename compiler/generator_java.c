@@ -1,5 +1,5 @@
 
-#include <stdlib.h> /* for exit */
+#include <stdlib.h> /* for free */
 #include <string.h> /* for strlen */
 #include <stdio.h> /* for fprintf etc */
 #include "header.h"
@@ -443,6 +443,22 @@ static int repeat_restore(struct generator * g, struct node * p) {
     return repeat_score(g, p) >= 2;
 }
 
+/* With -O the optimiser has already decided whether the cursor must be kept
+   around command p, so these only fall back on the heuristics above without
+   it. */
+
+static int keep_needed(struct generator * g, struct node * p) {
+
+    if (p->keep >= 0) return p->keep;
+    return K_needed(g, p->left);
+}
+
+static int repeat_keep_needed(struct generator * g, struct node * p) {
+
+    if (p->keep >= 0) return p->keep;
+    return repeat_restore(g, p->left);
+}
+
 static void generate_bra(struct generator * g, struct node * p) {
 
     write_comment(g, p);
@@ -456,7 +472,7 @@ static void generate_bra(struct generator * g, struct node * p) {
 static void generate_and(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     write_comment(g, p);
 
@@ -475,7 +491,7 @@ static void generate_and(struct generator * g, struct node * p) {
 static void generate_or(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     int a0 = g->failure_label;
     struct str * a1 = str_copy(g->failure_str);
@@ -492,8 +508,8 @@ static void generate_or(struct generator * g, struct node * p) {
     if (p == 0) {
         /* p should never be 0 after an or: there should be at least two
          * sub nodes. */
-        fprintf(stderr, "Error: \"or\" node without children nodes.");
-        exit (1);
+        report_s(0, 0, false, "Error: \"or\" node without children nodes.");
+        fatal();
     }
     while (p->right != 0) {
         g->failure_label = new_label(g);
@@ -527,7 +543,7 @@ static void generate_backwards(struct generator * g, struct node * p) {
 static void generate_not(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     int a0 = g->failure_label;
     struct str * a1 = str_copy(g->failure_str);
@@ -563,7 +579,7 @@ static void generate_not(struct generator * g, struct node * p) {
 static void generate_try(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     write_comment(g, p);
     if (keep_c) write_savecursor(g, p, savevar);
@@ -605,7 +621,7 @@ static void generate_fail(struct generator * g, struct node * p) {
 static void generate_test(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     write_comment(g, p);
 
@@ -626,7 +642,7 @@ static void generate_test(struct generator * g, struct node * p) {
 static void generate_do(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
     write_comment(g, p);
     if (keep_c) write_savecursor(g, p, savevar);
 
@@ -646,7 +662,7 @@ static void generate_GO(struct generator * g, struct node * p, int style) {
 
     int end_unreachable = false;
     struct str * savevar = vars_newname(g);
-    int keep_c = style == 1 || repeat_restore(g, p->left);
+    int keep_c = p->keep >= 0 ? p->keep : style == 1 || repeat_restore(g, p->left);
 
     int a0 = g->failure_label;
     struct str * a1 = str_copy(g->failure_str);
@@ -669,7 +685,7 @@ static void generate_GO(struct generator * g, struct node * p, int style) {
         end_unreachable = true;
     } else {
         /* include for goto; omit for gopast */
-        if (style == 1) write_restorecursor(g, p, savevar);
+        if (style == 1 && keep_c) write_restorecursor(g, p, savevar);
         g->I[0] = golab;
         w(g, "~Mbreak golab~I0;~N");
     }
@@ -710,7 +726,7 @@ static void generate_loop(struct generator * g, struct node * p) {
 static void generate_repeat(struct generator * g, struct node * p, struct str * loopvar) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = repeat_restore(g, p->left);
+    int keep_c = repeat_keep_needed(g, p);
     int replab = new_label(g);
     g->I[0] = replab;
     write_comment(g, p);
@@ -923,8 +939,9 @@ static void generate_setlimit(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
     struct str * varname = vars_newname(g);
+    int keep_c = p->keep != 0;
     write_comment(g, p);
-    write_savecursor(g, p, savevar);
+    if (keep_c) write_savecursor(g, p, savevar);
     generate(g, p->left);
 
     if (!g->unreachable) {
@@ -937,7 +954,7 @@ static void generate_setlimit(struct generator * g, struct node * p) {
             w(g, "~M~B0 = limit_backward;~N");
             w(g, "~Mlimit_backward = cursor;~N");
         }
-        write_restorecursor(g, p, savevar);
+        if (keep_c) write_restorecursor(g, p, savevar);
 
         if (p->mode == m_forward) {
             str_assign(g->failure_str, "limit += ");
@@ -1076,6 +1093,35 @@ static void generate_define(struct generator * g, struct node * p) {
     g->outbuf = saved_output;
 }
 
+/* For an among with routines, find_among() stops at a string with one,
+   returning -2 - i for string i; the routine is called here, and
+   find_among_next() goes on from it. */
+static void generate_among_routines(struct generator * g, struct among * x, struct node * p) {
+    int id;
+    writef(g, "~{"
+              "~Mint among_ret = find_among~S0(a_~I0, ~I1);~N"
+              "~Mwhile (among_ret < -1)~N~{"
+              "~Mint c_among = cursor;~N"
+              "~Mint among_i = -2 - among_ret;~N"
+              "~Mboolean ret = false;~N"
+              "~Mswitch (a_~I0[among_i].function) {~N~+", p);
+    for (id = 1; id <= x->function_count; id++) {
+        int i;
+        for (i = 0; x->b[i].function_id != id; i++) continue;
+        g->I[2] = id;
+        g->V[0] = x->b[i].function;
+        w(g, "~Mcase ~I2:~N~+~Mret = ~W0();~N~Mbreak;~N~-");
+    }
+    writef(g, "~-~M}~N"
+              "~Mcursor = c_among;~N"
+              "~Mamong_ret = find_among_next~S0(a_~I0, among_i, ret);~N"
+              "~}", p);
+    unless (x->command_count == 0 && x->starter == 0)
+        writef(g, "~Mamong_var = among_ret;~N", p);
+    write_failure_if(g, "among_ret == 0", p);
+    w(g, "~}");
+}
+
 static void generate_substring(struct generator * g, struct node * p) {
 
     struct among * x = p->among;
@@ -1086,7 +1132,9 @@ static void generate_substring(struct generator * g, struct node * p) {
     g->I[0] = x->number;
     g->I[1] = x->literalstring_count;
 
-    if (x->command_count == 0 && x->starter == 0) {
+    if (x->function_count > 0) {
+        generate_among_routines(g, x, p);
+    } else if (x->command_count == 0 && x->starter == 0) {
         write_failure_if(g, "find_among~S0(a_~I0, ~I1) == 0", p);
     } else {
         writef(g, "~Mamong_var = find_among~S0(a_~I0, ~I1);~N", p);
@@ -1217,8 +1265,7 @@ static void generate(struct generator * g, struct node * p) {
         case c_false:         generate_false(g, p); break;
         case c_true:          break;
         case c_debug:         generate_debug(g, p); break;
-        default: fprintf(stderr, "%d encountered\n", p->type);
-                 exit(1);
+        default: unexpected_node(p->type);
     }
 
     g->failure_label = a0;
@@ -1253,9 +1300,7 @@ static void generate_class_begin(struct generator * g) {
      w(g, " {~N"
           "~N"
 	  "private static final long serialVersionUID = 1L;~N"
-	  "~N"
-	  "~+~+~Mprivate final static ~n methodObject = new ~n ();~N"
-         "~N");
+	  "~N");
 }
 
 static void generate_class_end(struct generator * g) {
@@ -1280,6 +1325,10 @@ static void generate_equals(struct generator * g) {
     w(g, "~N~N");
 }
 
+/* Routines called from an among are numbered from 1 in the table, and
+   generate_among_routines() dispatches on the number, replacing the
+   reflection the runtime once used. */
+
 static void generate_among_table(struct generator * g, struct among * x) {
 
     struct amongvec * v = x->b;
@@ -1295,13 +1344,12 @@ static void generate_among_table(struct generator * g, struct among * x) {
             g->I[1] = v->i;
             g->I[2] = v->result;
             g->L[0] = v->b;
+            g->I[3] = v->function_id;
             g->S[0] = i < x->literalstring_count - 1 ? "," : "";
 
-            w(g, "~Mnew Among ( ~L0, ~I1, ~I2, \"");
-            if (v->function != 0) {
-                write_varname(g, v->function);
-            }
-            w(g, "\", methodObject )~S0~N");
+            w(g, "~Mnew Among ( ~L0, ~I1, ~I2");
+            if (v->function != 0) w(g, ", ~I3");
+            w(g, " )~S0~N");
             v++;
         }
     }
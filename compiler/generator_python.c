@@ -1,5 +1,5 @@
 
-#include <stdlib.h> /* for exit */
+#include <stdlib.h> /* for free */
 #include <string.h> /* for strlen */
 #include <stdio.h> /* for fprintf etc */
 #include "header.h"
@@ -15,11 +15,34 @@ enum special_labels {
     x_return = -1
 };
 
+/* Python has no goto, and raising an exception to get out of a block is
+   slow, so each label is the end of a loop: the loop of a goto, gopast or
+   repeat, or else one which runs once, as "while True:" ending in "break".
+   Going to the label of the innermost loop is a break, or a continue for
+   the top of a repeat. Going further out sets the flag lab<n> and breaks,
+   and the flag is tested after each loop it leaves. */
+
+struct python_block {
+    struct python_block * outer;
+    int label;           /* breaking out of the loop goes here, or -1 */
+    int continue_label;  /* continuing the loop goes here, or -1 */
+    symbol * flags;      /* labels of this loop with a flag */
+    symbol * crossed;    /* labels further out which jumps leave it for */
+    struct str * saved;  /* the output up to the start of the body */
+};
+
 static int new_label(struct generator * g) {
 
-    int next_label = g->next_label++;
-    g->max_label = (next_label > g->max_label) ? next_label : g->max_label;
-    return next_label;
+    return g->next_label++;
+}
+
+static symbol * add_label(symbol * b, int n) {
+
+    symbol s[1];
+    int i;
+    for (i = 0; i < SIZE(b); i++) if (b[i] == n) return b;
+    s[0] = n;
+    return add_to_b(b, 1, s);
 }
 
 static struct str * vars_newname(struct generator * g) {
@@ -186,19 +209,73 @@ static void write_inc_cursor(struct generator * g, struct node * p) {
     write_newline(g);
 }
 
-static void wsetlab_begin(struct generator * g) {
+/* Called after the line which starts a loop, at the margin of its body,
+   which is kept aside until close_block() so that the flags can be cleared
+   at the top of it. */
+static void open_block(struct generator * g, int label, int continue_label) {
 
-    w(g, "~Mtry:~N~+");
+    NEW(python_block, b);
+    b->outer = g->block;
+    b->label = label;
+    b->continue_label = continue_label;
+    b->flags = create_b(0);
+    b->crossed = create_b(0);
+    b->saved = g->outbuf;
+    g->outbuf = str_new();
+    g->block = b;
 }
 
-static void wsetlab_end(struct generator * g, int n) {
-    g->I[0] = n;
-    w(g, "~-~Mexcept lab~I0: pass~N");
+static void close_block(struct generator * g) {
+
+    struct python_block * b = g->block;
+    struct str * body = g->outbuf;
+    int i;
+    g->outbuf = b->saved;
+    for (i = 0; i < SIZE(b->flags); i++) {
+        g->I[0] = b->flags[i];
+        w(g, "~Mlab~I0 = False~N");
+    }
+    str_append(g->outbuf, body);
+    str_delete(body);
+    g->block = b->outer;
+    w(g, "~-");
+    for (i = 0; i < SIZE(b->crossed); i++) {
+        g->I[0] = b->crossed[i];
+        g->S[0] = g->block->continue_label == b->crossed[i] ? "continue" : "break";
+        w(g, "~Mif lab~I0:~N~+~M~S0~N~-");
+    }
+    lose_b(b->flags);
+    lose_b(b->crossed);
+    FREE(b);
+}
+
+static void wsetlab_begin(struct generator * g, int n) {
+
+    w(g, "~Mwhile True:~N~+");
+    open_block(g, n, -1);
+}
+
+static void wsetlab_end(struct generator * g) {
+
+    unless (g->unreachable) w(g, "~Mbreak~N");
+    close_block(g);
+    g->unreachable = false;
 }
 
 static void wgotol(struct generator * g, int n) {
+
+    struct python_block * b = g->block;
     g->I[0] = n;
-    w(g, "~Mraise lab~I0()~N");
+    if (b->label == n) w(g, "~Mbreak~N"); else
+    if (b->continue_label == n) w(g, "~Mcontinue~N"); else {
+        until (b->label == n || b->continue_label == n) {
+            b->crossed = add_label(b->crossed, n);
+            b = b->outer;
+        }
+        b->flags = add_label(b->flags, n);
+        w(g, "~Mlab~I0 = True~N~Mbreak~N");
+    }
+    g->unreachable = true;
 }
 
 static void write_failure(struct generator * g) {
@@ -215,8 +292,7 @@ static void write_failure(struct generator * g) {
             g->unreachable = true;
             break;
         default:
-            g->I[0] = g->failure_label;
-            w(g, "~Mraise lab~I0()~N");
+            wgotol(g, g->failure_label);
     }
 }
 
@@ -419,6 +495,22 @@ static int repeat_restore(struct generator * g, struct node * p) {
     return repeat_score(g, p) >= 2;
 }
 
+/* With -O the optimiser has already decided whether the cursor must be kept
+   around command p, so these only fall back on the heuristics above without
+   it. */
+
+static int keep_needed(struct generator * g, struct node * p) {
+
+    if (p->keep >= 0) return p->keep;
+    return K_needed(g, p->left);
+}
+
+static int repeat_keep_needed(struct generator * g, struct node * p) {
+
+    if (p->keep >= 0) return p->keep;
+    return repeat_restore(g, p->left);
+}
+
 static void generate_bra(struct generator * g, struct node * p) {
 
     write_comment(g, p);
@@ -432,7 +524,7 @@ static void generate_bra(struct generator * g, struct node * p) {
 static void generate_and(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     write_comment(g, p);
 
@@ -451,14 +543,14 @@ static void generate_and(struct generator * g, struct node * p) {
 static void generate_or(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     int a0 = g->failure_label;
     struct str * a1 = str_copy(g->failure_str);
 
     int out_lab = new_label(g);
     write_comment(g, p);
-    wsetlab_begin(g);
+    wsetlab_begin(g, out_lab);
 
     if (keep_c) write_savecursor(g, p, savevar);
 
@@ -468,17 +560,16 @@ static void generate_or(struct generator * g, struct node * p) {
     if (p == 0) {
         /* p should never be 0 after an or: there should be at least two
          * sub nodes. */
-        fprintf(stderr, "Error: \"or\" node without children nodes.");
-        exit (1);
+        report_s(0, 0, false, "Error: \"or\" node without children nodes.");
+        fatal();
     }
     while (p->right != 0) {
         g->failure_label = new_label(g);
         int label = g->failure_label;
-        wsetlab_begin(g);
+        wsetlab_begin(g, label);
         generate(g, p);
         if (!g->unreachable) wgotol(g, out_lab);
-        wsetlab_end(g, label);
-        g->unreachable = false;
+        wsetlab_end(g);
         if (keep_c) write_restorecursor(g, p, savevar);
         p = p->right;
     }
@@ -488,7 +579,7 @@ static void generate_or(struct generator * g, struct node * p) {
     g->failure_str = a1;
 
     generate(g, p);
-    wsetlab_end(g, out_lab);
+    wsetlab_end(g);
     str_delete(savevar);
 }
 
@@ -505,7 +596,7 @@ static void generate_backwards(struct generator * g, struct node * p) {
 static void generate_not(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     int a0 = g->failure_label;
     struct str * a1 = str_copy(g->failure_str);
@@ -519,7 +610,7 @@ static void generate_not(struct generator * g, struct node * p) {
     int label = g->failure_label;
     str_clear(g->failure_str);
 
-    wsetlab_begin(g);
+    wsetlab_begin(g, label);
 
     generate(g, p->left);
 
@@ -529,8 +620,7 @@ static void generate_not(struct generator * g, struct node * p) {
 
     if (!g->unreachable) write_failure(g);
 
-    wsetlab_end(g, label);
-    g->unreachable = false;
+    wsetlab_end(g);
 
     if (keep_c) write_restorecursor(g, p, savevar);
     str_delete(savevar);
@@ -540,7 +630,7 @@ static void generate_not(struct generator * g, struct node * p) {
 static void generate_try(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     write_comment(g, p);
     if (keep_c) write_savecursor(g, p, savevar);
@@ -550,10 +640,9 @@ static void generate_try(struct generator * g, struct node * p) {
 
     if (keep_c) restore_string(p, g->failure_str, savevar);
 
-    wsetlab_begin(g);
+    wsetlab_begin(g, label);
     generate(g, p->left);
-    wsetlab_end(g, label);
-    g->unreachable = false;
+    wsetlab_end(g);
 
     str_delete(savevar);
 }
@@ -584,7 +673,7 @@ static void generate_fail(struct generator * g, struct node * p) {
 static void generate_test(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
 
     write_comment(g, p);
 
@@ -605,7 +694,7 @@ static void generate_test(struct generator * g, struct node * p) {
 static void generate_do(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = K_needed(g, p->left);
+    int keep_c = keep_needed(g, p);
     write_comment(g, p);
     if (keep_c) write_savecursor(g, p, savevar);
 
@@ -613,34 +702,50 @@ static void generate_do(struct generator * g, struct node * p) {
     int label = g->failure_label;
     str_clear(g->failure_str);
 
-    wsetlab_begin(g);
+    wsetlab_begin(g, label);
     generate(g, p->left);
-    wsetlab_end(g, label);
-    g->unreachable = false;
+    wsetlab_end(g);
 
     if (keep_c) write_restorecursor(g, p, savevar);
     str_delete(savevar);
 }
 
+/* goto or gopast of a grouping, or of non, is a scan by the runtime rather
+   than a loop here. */
+static void generate_GO_grouping(struct generator * g, struct node * p, int style) {
+
+    struct node * q = p->left;
+    write_comment(g, p);
+    g->S[0] = p->mode == m_forward ? "" : "_b";
+    g->S[1] = q->type == c_non ? "in" : "out";
+    g->V[0] = q->name;
+    write_failure_if(g, "not self.go_~S1_grouping~S0(~n.~V0)", p);
+    if (style == 0) write_inc_cursor(g, p);
+}
+
 static void generate_GO(struct generator * g, struct node * p, int style) {
 
+    if (p->left->type == c_grouping || p->left->type == c_non) {
+        generate_GO_grouping(g, p, style);
+        return;
+    }
+
     int end_unreachable = false;
     struct str * savevar = vars_newname(g);
-    int keep_c = style == 1 || repeat_restore(g, p->left);
+    int keep_c = p->keep >= 0 ? p->keep : style == 1 || repeat_restore(g, p->left);
 
     int a0 = g->failure_label;
     struct str * a1 = str_copy(g->failure_str);
 
     int golab = new_label(g);
-    g->I[0] = golab;
     write_comment(g, p);
-    w(g, "~Mtry:~N~+"
-             "~Mwhile True:~N~+");
+    w(g, "~Mwhile True:~N~+");
+    open_block(g, golab, -1);
     if (keep_c) write_savecursor(g, p, savevar);
 
     g->failure_label = new_label(g);
     int label = g->failure_label;
-    wsetlab_begin(g);
+    wsetlab_begin(g, label);
     generate(g, p->left);
 
     if (g->unreachable) {
@@ -649,12 +754,10 @@ static void generate_GO(struct generator * g, struct node * p, int style) {
         end_unreachable = true;
     } else {
         /* include for goto; omit for gopast */
-        if (style == 1) write_restorecursor(g, p, savevar);
-        g->I[0] = golab;
-        w(g, "~Mraise lab~I0()~N");
+        if (style == 1 && keep_c) write_restorecursor(g, p, savevar);
+        wgotol(g, golab);
     }
-    g->unreachable = false;
-    wsetlab_end(g, label);
+    wsetlab_end(g);
     if (keep_c) write_restorecursor(g, p, savevar);
 
     g->failure_label = a0;
@@ -663,9 +766,7 @@ static void generate_GO(struct generator * g, struct node * p, int style) {
 
     write_check_limit(g, p);
     write_inc_cursor(g, p);
-    w(g, "~-~-");
-    g->I[0] = golab;
-    w(g, "~Mexcept lab~I0: pass~N");
+    close_block(g);
     str_delete(savevar);
     g->unreachable = end_unreachable;
 }
@@ -680,10 +781,11 @@ static void generate_loop(struct generator * g, struct node * p) {
     g->B[0] = str_data(loopvar);
     writef(g, ", 0, -1):~N", p);
     writef(g, "~{", p);
+    open_block(g, -1, -1);
 
     generate(g, p->left);
 
-    w(g, "~}");
+    close_block(g);
     str_delete(loopvar);
     g->unreachable = false;
 }
@@ -691,19 +793,18 @@ static void generate_loop(struct generator * g, struct node * p) {
 static void generate_repeat(struct generator * g, struct node * p, struct str * loopvar) {
 
     struct str * savevar = vars_newname(g);
-    int keep_c = repeat_restore(g, p->left);
+    int keep_c = repeat_keep_needed(g, p);
     int rep_break_lab = new_label(g);
     int rep_continue_lab = new_label(g);
     write_comment(g, p);
-    writef(g, "~Mtry:~N~+"
-                  "~Mwhile True:~N~+"
-                      "~Mtry:~N~+", p);
+    w(g, "~Mwhile True:~N~+");
+    open_block(g, rep_break_lab, rep_continue_lab);
     if (keep_c) write_savecursor(g, p, savevar);
 
     g->failure_label = new_label(g);
     int label = g->failure_label;
     str_clear(g->failure_str);
-    wsetlab_begin(g);
+    wsetlab_begin(g, label);
     generate(g, p->left);
 
     if (!g->unreachable) {
@@ -712,21 +813,16 @@ static void generate_repeat(struct generator * g, struct node * p, struct str *
             w(g, "~M~B0 -= 1~N");
         }
 
-        g->I[0] = rep_continue_lab;
-        w(g, "~Mraise lab~I0()~N");
+        wgotol(g, rep_continue_lab);
     }
 
-    wsetlab_end(g, label);
-    g->unreachable = false;
+    wsetlab_end(g);
 
     if (keep_c) write_restorecursor(g, p, savevar);
 
-    g->I[0] = rep_continue_lab;
-    g->I[1] = rep_break_lab;
-    w(g, "~Mraise lab~I1()~N~}"
-         "~Mexcept lab~I0: pass~N"
-         "~}~}"
-         "~Mexcept lab~I1: pass~N");
+    wgotol(g, rep_break_lab);
+    close_block(g);
+    g->unreachable = false;
     str_delete(savevar);
 }
 
@@ -913,8 +1009,9 @@ static void generate_setlimit(struct generator * g, struct node * p) {
 
     struct str * savevar = vars_newname(g);
     struct str * varname = vars_newname(g);
+    int keep_c = p->keep != 0;
     write_comment(g, p);
-    write_savecursor(g, p, savevar);
+    if (keep_c) write_savecursor(g, p, savevar);
     generate(g, p->left);
 
     if (!g->unreachable) {
@@ -926,7 +1023,7 @@ static void generate_setlimit(struct generator * g, struct node * p) {
             w(g, "~M~B0 = self.limit_backward~N");
             w(g, "~Mself.limit_backward = self.cursor~N");
         }
-        write_restorecursor(g, p, savevar);
+        if (keep_c) write_restorecursor(g, p, savevar);
 
         if (p->mode == m_forward) {
             str_assign(g->failure_str, "self.limit += ");
@@ -1015,16 +1112,10 @@ static void generate_call(struct generator * g, struct node * p) {
 
 static void generate_grouping(struct generator * g, struct node * p, int complement) {
 
-    struct grouping * q = p->name->grouping;
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->S[1] = complement ? "out" : "in";
     g->V[0] = p->name;
-    g->I[0] = q->smallest_ch;
-    g->I[1] = q->largest_ch;
-    if (q->no_gaps)
-        write_failure_if(g, "not self.~S1_range~S0(~I0, ~I1)", p);
-    else
-        write_failure_if(g, "not self.~S1_grouping~S0(~n.~V0, ~I0, ~I1)", p);
+    write_failure_if(g, "not self.~S1_grouping~S0(~n.~V0)", p);
 }
 
 static void generate_namedstring(struct generator * g, struct node * p) {
@@ -1099,12 +1190,11 @@ static void generate_substring(struct generator * g, struct node * p) {
 
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->I[0] = x->number;
-    g->I[1] = x->literalstring_count;
 
     if (x->command_count == 0 && x->starter == 0) {
-        write_failure_if(g, "self.find_among~S0(~n.a_~I0, ~I1) == 0", p);
+        write_failure_if(g, "self.find_among~S0(~n.a_~I0, ~n.d_~I0) == 0", p);
     } else {
-        writef(g, "~Mamong_var = self.find_among~S0(~n.a_~I0, ~I1)~N", p);
+        writef(g, "~Mamong_var = self.find_among~S0(~n.a_~I0, ~n.d_~I0)~N", p);
         write_failure_if(g, "among_var == 0", p);
     }
 }
@@ -1229,8 +1319,7 @@ static void generate(struct generator * g, struct node * p) {
         case c_false:         generate_false(g, p); break;
         case c_true:          break;
         case c_debug:         generate_debug(g, p); break;
-        default: fprintf(stderr, "%d encountered\n", p->type);
-                 exit(1);
+        default: unexpected_node(p->type);
     }
 
     g->failure_label = a0;
@@ -1294,46 +1383,58 @@ static void generate_among_table(struct generator * g, struct among * x) {
     w(g, "~-~M]~N~N");
 }
 
+/* The cases again, for find_among() to look up with a dict for each size,
+   longest first, giving the index in the list. */
+
+static void generate_among_dicts(struct generator * g, struct among * x) {
+
+    struct amongvec * v = x->b;
+    int largest = 0;
+    int size;
+    int i;
+    for (i = 0; i < x->literalstring_count; i++) {
+        if (v[i].size > largest) largest = v[i].size;
+    }
+    g->I[0] = x->number;
+    w(g, "~Md_~I0 = (~N~+");
+    for (size = largest; size >= 0; size--) {
+        int first = true;
+        for (i = 0; i < x->literalstring_count; i++) {
+            if (v[i].size != size) continue;
+            if (first) {
+                g->I[0] = size;
+                w(g, "~M(~I0, {~N~+");
+                first = false;
+            } else {
+                w(g, ",~N");
+            }
+            g->I[0] = i;
+            g->L[0] = v[i].b;
+            w(g, "~M~L0: ~I0");
+        }
+        unless (first) w(g, "~N~-~M}),~N");
+    }
+    w(g, "~-~M)~N~N");
+}
+
 static void generate_amongs(struct generator * g) {
 
     struct among * x = g->analyser->amongs;
     while (x != 0) {
         generate_among_table(g, x);
+        generate_among_dicts(g, x);
         x = x->next;
     }
 }
 
-static void set_bit(symbol * b, int i) { b[i/8] |= 1 << i%8; }
-
-static int bit_is_set(symbol * b, int i) { return b[i/8] & 1 << i%8; }
+/* A grouping is a frozenset of its characters, so that a test of one is a
+   single lookup. */
 
 static void generate_grouping_table(struct generator * g, struct grouping * q) {
 
-    int range = q->largest_ch - q->smallest_ch + 1;
-    int size = (range + 7)/ 8;  /* assume 8 bits per symbol */
-    symbol * b = q->b;
-    symbol * map = create_b(size);
-    int i;
-    for (i = 0; i < size; i++) map[i] = 0;
-
-    /* Using unicode would require revision here */
-
-    for (i = 0; i < SIZE(b); i++) set_bit(map, b[i] - q->smallest_ch);
-
-    q->no_gaps = true;
-    for (i = 0; i < range; i++) unless (bit_is_set(map, i)) q->no_gaps = false;
-
-    unless (q->no_gaps) {
-        g->V[0] = q->name;
-
-        w(g, "~M~V0 = [");
-        for (i = 0; i < size; i++) {
-             write_int(g, map[i]);
-             if (i < size - 1) w(g, ", ");
-        }
-        w(g, "]~N~N");
-    }
-    lose_b(map);
+    g->V[0] = q->name;
+    g->L[0] = q->b;
+    w(g, "~M~V0 = frozenset(~L0)~N~N");
 }
 
 static void generate_groupings(struct generator * g) {
@@ -1392,16 +1493,6 @@ static void generate_methods(struct generator * g) {
     }
 }
 
-static void generate_label_classes(struct generator * g)
-{
-    int i;
-    for (i = 0; i <= g->max_label; i++)
-    {
-        g->I[0] = i;
-        w(g, "~N~Nclass lab~I0(BaseException): pass~N");
-    }
-}
-
 extern void generate_program_python(struct generator * g) {
 
     g->outbuf = str_new();
@@ -1417,8 +1508,6 @@ extern void generate_program_python(struct generator * g) {
     generate_copyfrom(g);
     generate_methods(g);
 
-    generate_label_classes(g);
-
     output_str(g->options->output_python, g->outbuf);
     str_delete(g->failure_str);
     str_delete(g->outbuf);
@@ -1432,7 +1521,7 @@ extern struct generator * create_generator_python(struct analyser * a, struct op
     g->margin = 0;
     g->debug_count = 0;
     g->unreachable = false;
-    g->max_label = 0;
+    g->block = 0;
     return g;
 }
 
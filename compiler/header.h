@@ -44,6 +44,7 @@ extern symbol * str_data(struct str * str);
 extern int str_len(struct str * str);
 extern int get_utf8(const symbol * p, int * slot);
 extern int put_utf8(int ch, symbol * p);
+extern void add_to_hash(unsigned int * h, const symbol * p, int n);
 
 struct m_pair {
 
@@ -84,7 +85,9 @@ struct tokeniser {
     int number;
     int m_start;
     int m_end;
-    struct m_pair * m_pairs;
+    struct m_pair ** m_pairs;   /* hash table of the stringdefs */
+    int m_pairs_size;           /* its number of buckets, a power of 2 */
+    int m_pairs_count;
     int get_depth;
     int error_count;
     int token;
@@ -95,6 +98,7 @@ struct tokeniser {
 
     int omission;
     struct include * includes;
+    unsigned int source_hash[2]; /* of the text of all the files read */
 
 };
 
@@ -104,6 +108,14 @@ extern int read_token(struct tokeniser * t);
 extern const char * name_of_token(int code);
 extern void close_tokeniser(struct tokeniser * t);
 
+/* Errors and warnings, which go to stderr, or to the result of
+   sb_compile() when the compiler is used as a library (see library.c). */
+extern void report(const char * file, int line_number, int warning, struct str * text);
+extern void report_s(const char * file, int line_number, int warning, const char * s);
+extern int count_error(struct tokeniser * t);
+extern void fatal(void);
+extern void unexpected_node(int type);
+
 enum token_codes {
 
 #include "syswords2.h"
@@ -122,6 +134,16 @@ extern int space_count;
 extern void * check_malloc(int n);
 extern void check_free(void * p);
 
+struct arena; /* defined in space.c */
+
+extern struct arena * create_arena(void);
+extern void * arena_malloc(struct arena * r, int n);
+extern symbol * arena_copy_b(struct arena * r, symbol * p);
+extern void lose_arena(struct arena * r);
+
+#define ARENA_NEW(r, type, p) struct type * p = (struct type *) arena_malloc(r, sizeof(struct type))
+#define ARENA_NEWVEC(r, type, p, n) struct type * p = (struct type *) arena_malloc(r, sizeof(struct type) * n)
+
 struct node;
 
 struct name {
@@ -135,13 +157,11 @@ struct name {
     struct grouping * grouping; /* for grouping names */
     byte referenced;
     byte used;
-
-};
-
-struct literalstring {
-
-    struct literalstring * next;
-    symbol * b;
+    int short_word_limit;       /* externals: shorter words are unchanged, */
+    symbol * short_word_symbols; /* unless they have one of these bytes */
+    byte hotwords;              /* externals: has a -hotwords table */
+    int max_growth;             /* routines, externals: the string is made at
+                                   most this much longer, or -1 if unbounded */
 
 };
 
@@ -153,6 +173,7 @@ struct amongvec {
     int i;           /* the amongvec index of the longest substring of b */
     int result;      /* the numeric result for the case */
     struct name * function;
+    int function_id; /* 1, 2 ... numbering the distinct functions of the among, or 0 */
 
 };
 
@@ -163,6 +184,7 @@ struct among {
     int number;               /* amongs are numbered 0, 1, 2 ... */
     int literalstring_count;  /* in this among */
     int command_count;        /* in this among */
+    int function_count;       /* number of distinct routines called */
     struct node * starter;    /* i.e. among( (starter) 'string' ... ) */
     struct node * substring;  /* i.e. substring ... among ( ... ) */
 };
@@ -192,7 +214,13 @@ struct node {
     symbol * literalstring;
     int number;
     int line_number;
+    char * file;           /* in which line_number is, for -lines */
     int amongvar_needed;   /* used in routine definitions */
+    int keep;              /* whether c must be kept: set by the optimiser,
+                              or -1 if the generator is to decide */
+    byte can_fail;         /* )  set by the optimiser: whether the command  */
+    byte moves;            /* )  can fail, whether c may have moved when it */
+    byte moves_on_fail;    /* )  succeeds, and when it fails                */
 };
 
 enum name_types {
@@ -219,9 +247,10 @@ enum name_types {
 struct analyser {
 
     struct tokeniser * tokeniser;
+    struct arena * arena;     /* of the nodes, names, literal strings,
+                                 amongs and groupings */
     struct node * nodes;
     struct name * names;
-    struct literalstring * literalstrings;
     int mode;
     byte modifyable;          /* false inside reverse(...) */
     struct node * program;
@@ -235,6 +264,7 @@ struct analyser {
     struct grouping * groupings_end;
     struct node * substring;  /* pending 'substring' in current routine definition */
     byte utf8;
+    unsigned int source_hash[2]; /* copied from the tokeniser */
 };
 
 enum analyser_modes {
@@ -253,14 +283,18 @@ struct generator {
 
     struct analyser * analyser;
     struct options * options;
+    byte cplusplus;            /* the C generator is writing C++ */
+    byte locals;               /* C: -locals */
     int unreachable;           /* 0 if code can be reached, 1 if current code
                                 * is unreachable. */
     int var_number;            /* Number of next variable to use. */
     struct str * outbuf;       /* temporary str to store output */
     struct str * declarations; /* str storing variable declarations */
+    struct str * wide_declarations; /* C++: the tables again, for wide symbols */
+    struct str * definitions;  /* C++: the tables once more, defined for C++11 */
     int next_label;
 #ifndef DISABLE_PYTHON
-    int max_label;
+    struct python_block * block; /* Python: the innermost loop being written */
 #endif
     int margin;
 
@@ -281,9 +315,21 @@ struct generator {
 
     int line_count;      /* counts number of lines output */
     int line_labelled;   /* in ANSI C, will need extra ';' if it is a block end */
+    int source_line;     /* ) of the last #line directive */
+    char * source_file;  /* )                            */
     int literalstring_count;
     int keep_count;      /* used to number keep/restore pairs to avoid compiler warnings
                             about shadowed variables */
+
+    /* for -report: */
+    struct str * report;        /* the routines so far, as JSON */
+    struct str * report_amongs; /* the amongs of the current routine */
+    int saves;           /* ) in the current routine: keeps of c, */
+    int restores;        /* ) restores of c, */
+    int loops;           /* ) loop commands, */
+    int grouping_scans;  /* ) and goto/gopast of groupings */
+
+    struct profile * profile; /* for -profile */
 };
 
 struct options {
@@ -300,9 +346,24 @@ struct options {
 #ifndef DISABLE_PYTHON
     FILE * output_python;
 #endif
+    FILE * output_bytecode;
     byte syntax_tree;
+    byte optimise;
+    byte locals;        /* C only: hold c, l and lb in locals of each routine */
     byte widechars;
-    enum { LANG_JAVA, LANG_C, LANG_CPLUSPLUS, LANG_PYTHON } make_lang;
+    char * hotwords_file; /* C only: frequent words to stem at compile time */
+    byte lines;         /* C only: #line directives giving the source lines */
+    byte instrument;    /* C only: count routine calls and among lookups */
+    char * report_file; /* C only: the costs of the routines, as JSON */
+    char * profile_file; /* C only: counters from -instrument, for branch hints */
+    char * eval_file;   /* words to stem in the interpreter, not generating */
+    FILE * output_report;
+    byte manifest;      /* C only: the input lists the modules to compile */
+    int jobs;           /* - and at most this many at once */
+    char * cpp_dir;     /* - and the directories for C++, Java and Python */
+    char * java_dir;
+    char * python_dir;
+    enum { LANG_JAVA, LANG_C, LANG_CPLUSPLUS, LANG_PYTHON, LANG_BYTECODE } make_lang;
     char * externals_prefix;
     char * variables_prefix;
     char * runtime_path;
@@ -315,12 +376,65 @@ struct options {
     byte utf8;
 };
 
+extern int eq(const char * s1, const char * s2);
+extern void default_options(struct options * o);
+extern int read_options(struct options * o, int argc, char * argv[], int i, struct str * error);
+extern void lose_includes(struct options * o);
+extern void generate_program(struct analyser * a, struct options * o);
+
+/* Optimiser, run on the analysed program when -O is given, apart from the
+   short word limits, which the C and C++ generators want in any case. */
+extern void optimise_program(struct analyser * a, struct options * o);
+extern void find_short_word_limits(struct analyser * a);
+
+/* Interpreter, running an external of the analysed program on a word. */
+struct interpreter;
+extern struct interpreter * create_interpreter(struct analyser * a, int utf8);
+extern void close_interpreter(struct interpreter * z);
+extern symbol * interpret(struct interpreter * z, struct name * q, symbol * word);
+extern symbol ** read_words(char * file, int widechars, int * count, symbol *** seconds);
+extern int eval_words(struct analyser * a, struct options * o);
+
+/* Hot word table for -hotwords: words and stems in s, as offsets and sizes
+   in groups of four in slot, placed by the displacements in d. */
+struct hotwords {
+
+    int count;
+    int bucket_count;
+    int slot_count;
+    int * d;
+    int * slot;
+    symbol * s;
+};
+
+extern struct hotwords * make_hotwords(struct analyser * a, struct options * o, struct name * q);
+extern void lose_hotwords(struct hotwords * h);
+
+/* Counters for -profile, in the order -instrument numbers them. */
+struct profile {
+
+    int count;
+    unsigned long * counts;
+};
+
+extern struct profile * read_profile(struct analyser * a, struct options * o);
+extern void lose_profile(struct profile * f);
+
 /* Generator for C code. */
 extern struct generator * create_generator_c(struct analyser * a, struct options * o);
 extern void close_generator_c(struct generator * g);
 
 extern void generate_program_c(struct generator * g);
 
+/* The version given by ~pversion() of the generated C, into s[17]. */
+extern void version_of_stemmer(struct analyser * a, char * s);
+
+/* Generator for bytecode, run by runtime/bytecode.c. */
+extern void generate_program_bytecode(struct analyser * a, struct options * o);
+
+/* Generator for C++ code, which is the generator for C writing C++. */
+extern void generate_program_cpp(struct generator * g);
+
 #ifndef DISABLE_JAVA
 /* Generator for Java code. */
 extern struct generator * create_generator_java(struct analyser * a, struct options * o);
@@ -0,0 +1,96 @@
+
+#include <stdio.h>   /* for fprintf etc */
+#include <stdlib.h>  /* for exit, free */
+#include <string.h>  /* for memcmp */
+#include "header.h"
+#include "../runtime/hotwords.h"
+
+/* -hotwords: the stems of a list of frequent words are worked out by
+   running the program in the interpreter, and put in a perfect hash table
+   which the generated external consults first.
+
+   The table is built by sb_place_hotwords() in runtime/hotwords.c, which
+   stemdict shares.
+*/
+
+static symbol ** read_hotwords(struct options * o, int * count) {
+    symbol ** words = read_words(o->hotwords_file, o->widechars, count, 0);
+    if (words == 0) {
+        struct str * text = str_new();
+        str_append_string(text, "Can't open hotwords file ");
+        str_append_string(text, o->hotwords_file);
+        report(0, 0, false, text);
+        str_delete(text);
+        fatal();
+    }
+    return words;
+}
+
+extern struct hotwords * make_hotwords(struct analyser * a, struct options * o, struct name * q) {
+    int count;
+    symbol ** words = read_hotwords(o, & count);
+    NEWVEC(sb_hotword, e, count + 1);
+    NEW(hotwords, h);
+    struct interpreter * z = create_interpreter(a, o->utf8);
+    int n = 0;
+    int i;
+
+    h->s = create_b(0);
+    for (i = 0; i < count; i++) {
+        symbol * word = words[i];
+        symbol * stem = interpret(z, q, word);
+        if (stem == 0) {
+            struct str * text = str_new();
+            str_append_string(text, o->hotwords_file);
+            str_append_string(text, ": faulty slice operation on hotword ");
+            str_append_int(text, i + 1);
+            report(0, 0, true, text);
+            str_delete(text);
+        } else {
+            struct sb_hotword * x = e + n++;
+            x->word = SIZE(h->s);
+            x->word_size = SIZE(word);
+            h->s = add_to_b(h->s, SIZE(word), word);
+            if (SIZE(stem) == SIZE(word) &&
+                memcmp(stem, word, SIZE(word) * sizeof(symbol)) == 0) {
+                x->stem = x->word;
+            } else {
+                x->stem = SIZE(h->s);
+                h->s = add_to_b(h->s, SIZE(stem), stem);
+            }
+            x->stem_size = SIZE(stem);
+            lose_b(stem);
+        }
+        lose_b(word);
+    }
+    FREE(words);
+    close_interpreter(z);
+
+    h->bucket_count = SB_HOTWORD_BUCKETS(n);
+    h->d = (int *) MALLOC(h->bucket_count * sizeof(int));
+    h->slot_count = SB_HOTWORD_SLOTS(n);
+    repeat {
+        h->slot = (int *) MALLOC(4 * h->slot_count * sizeof(int));
+        h->count = sb_place_hotwords(e, n, h->s, sizeof(symbol), h->bucket_count,
+                                     h->slot_count, h->d, h->slot);
+        if (h->count >= 0) break;
+        FREE(h->slot);
+        if (h->count == -2) {
+            struct str * text = str_new();
+            str_append_string(text, "Out of memory for hotwords");
+            report(0, 0, false, text);
+            str_delete(text);
+            fatal();
+        }
+        h->slot_count = SB_HOTWORD_MORE_SLOTS(h->slot_count);
+    }
+    FREE(e);
+    return h;
+}
+
+extern void lose_hotwords(struct hotwords * h) {
+    lose_b(h->s);
+    FREE(h->d);
+    FREE(h->slot);
+    FREE(h);
+}
@@ -0,0 +1,658 @@
+
+#include <limits.h>  /* for INT_MAX */
+#include <stdio.h>   /* for fprintf etc */
+#include <stdlib.h>  /* for exit */
+#include <string.h>  /* for memcmp, memmove */
+#include "header.h"
+
+/* An interpreter for the analysed program, so that the compiler can run an
+   algorithm itself. It follows what the C generator writes and the C
+   runtime does, on the symbols of the analysis: bytes (UTF-8 with -u), or
+   characters with -w.
+*/
+
+struct interpreter {
+
+    struct analyser * a;
+    int utf8;
+    symbol * p;
+    int c; int l; int lb; int bra; int ket;
+    symbol ** S;
+    int * I;
+    byte * B;
+    int among_var;
+    int error;          /* set by a faulty slice operation */
+};
+
+static int eval(struct interpreter * z, struct node * p);
+
+extern struct interpreter * create_interpreter(struct analyser * a, int utf8) {
+    NEW(interpreter, z);
+    int * n = a->name_count;
+    int i;
+    z->a = a;
+    z->utf8 = utf8;
+    z->p = create_b(0);
+    z->c = z->l = z->lb = z->bra = z->ket = 0;
+    z->S = (symbol **) MALLOC((n[t_string] + 1) * sizeof(symbol *));
+    for (i = 0; i < n[t_string]; i++) z->S[i] = create_b(0);
+    z->I = (int *) MALLOC((n[t_integer] + 1) * sizeof(int));
+    for (i = 0; i < n[t_integer]; i++) z->I[i] = 0;
+    z->B = (byte *) MALLOC(n[t_boolean] + 1);
+    for (i = 0; i < n[t_boolean]; i++) z->B[i] = false;
+    z->among_var = 0;
+    z->error = false;
+    return z;
+}
+
+extern void close_interpreter(struct interpreter * z) {
+    int i;
+    for (i = 0; i < z->a->name_count[t_string]; i++) lose_b(z->S[i]);
+    FREE(z->S);
+    FREE(z->I);
+    FREE(z->B);
+    lose_b(z->p);
+    FREE(z);
+}
+
+/* As skip_utf8() in runtime/utilities.c when utf8 is set. */
+
+static int skip(struct interpreter * z, int c, int lb, int l, int n) {
+    const symbol * p = z->p;
+    int b;
+    unless (z->utf8) {
+        int ret = c + n;
+        return lb > ret || ret > l ? -1 : ret;
+    }
+    if (n >= 0) {
+        for (; n > 0; n--) {
+            if (c >= l) return -1;
+            b = p[c++];
+            if (b >= 0xC0) {
+                while (c < l) {
+                    b = p[c];
+                    if (b >= 0xC0 || b < 0x80) break;
+                    c++;
+                }
+            }
+        }
+    } else {
+        for (; n < 0; n++) {
+            if (c <= lb) return -1;
+            b = p[--c];
+            if (b >= 0x80) {
+                while (c > lb) {
+                    b = p[c];
+                    if (b >= 0xC0) break;
+                    c--;
+                }
+            }
+        }
+    }
+    return c;
+}
+
+/* The character after c (before c if backward) into * slot, returning its
+   width, or 0 at the limit. */
+
+static int get_ch(struct interpreter * z, int backward, int * slot) {
+    const symbol * p = z->p;
+    int c = z->c;
+    int b0, b1;
+    if (backward) {
+        if (c <= z->lb) return 0;
+        b0 = p[--c];
+        if (!z->utf8 || b0 < 0x80 || c == z->lb) { * slot = b0; return 1; }
+        b1 = p[--c];
+        if (b1 >= 0xC0 || c == z->lb) { * slot = (b1 & 0x1F) << 6 | (b0 & 0x3F); return 2; }
+        * slot = (p[c] & 0xF) << 12 | (b1 & 0x3F) << 6 | (b0 & 0x3F); return 3;
+    }
+    if (c >= z->l) return 0;
+    b0 = p[c++];
+    if (!z->utf8 || b0 < 0xC0 || c == z->l) { * slot = b0; return 1; }
+    b1 = p[c++];
+    if (b0 < 0xE0 || c == z->l) { * slot = (b0 & 0x1F) << 6 | (b1 & 0x3F); return 2; }
+    * slot = (b0 & 0xF) << 12 | (b1 & 0x3F) << 6 | (p[c] & 0x3F); return 3;
+}
+
+static int keep(struct interpreter * z, struct node * p) {
+    return p->mode == m_forward ? z->c : z->l - z->c;
+}
+
+static void restore(struct interpreter * z, struct node * p, int k) {
+    z->c = p->mode == m_forward ? k : z->l - k;
+}
+
+static int next(struct interpreter * z, struct node * p) {
+    int ret = p->mode == m_forward ? skip(z, z->c, 0, z->l, 1) :
+                                     skip(z, z->c, z->lb, z->l, -1);
+    if (ret < 0) return false;
+    z->c = ret;
+    return true;
+}
+
+static int eval_AE(struct interpreter * z, struct node * p) {
+    switch (p->type) {
+        case c_name: return z->I[p->name->count];
+        case c_number: return p->number;
+        case c_maxint: return INT_MAX;
+        case c_minint: return INT_MIN;
+        case c_neg: return - eval_AE(z, p->right);
+        case c_multiply: return eval_AE(z, p->left) * eval_AE(z, p->right);
+        case c_plus: return eval_AE(z, p->left) + eval_AE(z, p->right);
+        case c_minus: return eval_AE(z, p->left) - eval_AE(z, p->right);
+        case c_divide: return eval_AE(z, p->left) / eval_AE(z, p->right);
+        case c_sizeof: return SIZE(z->S[p->name->count]);
+        case c_cursor: return z->c;
+        case c_limit: return p->mode == m_forward ? z->l : z->lb;
+        case c_size: return SIZE(z->p);
+    }
+    return 0;
+}
+
+/* As replace_s() in the runtime, returning the adjustment. */
+
+static int replace_s(struct interpreter * z, int c_bra, int c_ket, int s_size, const symbol * s) {
+    int adjustment = s_size - (c_ket - c_bra);
+    int len = SIZE(z->p);
+    if (adjustment != 0) {
+        if (adjustment + len > CAPACITY(z->p))
+            z->p = increase_capacity(z->p, adjustment + len);
+        memmove(z->p + c_ket + adjustment, z->p + c_ket,
+                (len - c_ket) * sizeof(symbol));
+        SIZE(z->p) = adjustment + len;
+        z->l += adjustment;
+        if (z->c >= c_ket)
+            z->c += adjustment;
+        else
+            if (z->c > c_bra)
+                z->c = c_bra;
+    }
+    unless (s_size == 0) memmove(z->p + c_bra, s, s_size * sizeof(symbol));
+    return adjustment;
+}
+
+static int slice_check(struct interpreter * z) {
+    if (z->bra < 0 || z->bra > z->ket || z->ket > z->l || z->l > SIZE(z->p)) {
+        z->error = true;
+        return false;
+    }
+    return true;
+}
+
+static void insert_s(struct interpreter * z, int bra, int ket, symbol * s) {
+    int adjustment = replace_s(z, bra, ket, SIZE(s), s);
+    if (bra <= z->bra) z->bra += adjustment;
+    if (bra <= z->ket) z->ket += adjustment;
+}
+
+/* The string argument of insert, <- etc */
+
+static symbol * data_of(struct interpreter * z, struct node * p) {
+    return p->literalstring != 0 ? p->literalstring : z->S[p->name->count];
+}
+
+static int eq_s(struct interpreter * z, struct node * p, symbol * s) {
+    int n = SIZE(s);
+    if (p->mode == m_forward) {
+        if (z->l - z->c < n || memcmp(z->p + z->c, s, n * sizeof(symbol)) != 0) return false;
+        z->c += n;
+    } else {
+        if (z->c - z->lb < n || memcmp(z->p + z->c - n, s, n * sizeof(symbol)) != 0) return false;
+        z->c -= n;
+    }
+    return true;
+}
+
+static int in_grouping(struct grouping * q, int ch) {
+    int i;
+    for (i = 0; i < SIZE(q->b); i++) if (q->b[i] == ch) return true;
+    return false;
+}
+
+static int eval_grouping(struct interpreter * z, struct node * p, int complement) {
+    int ch;
+    int w = get_ch(z, p->mode == m_backward, & ch);
+    if (w == 0) return false;
+    if (in_grouping(p->name->grouping, ch) == complement) return false;
+    if (p->mode == m_forward) z->c += w; else z->c -= w;
+    return true;
+}
+
+static int call(struct interpreter * z, struct name * q) {
+    int among_var = z->among_var;
+    int ret = eval(z, q->definition);
+    z->among_var = among_var;
+    return ret;
+}
+
+/* Gives the same result as find_among() in the runtime: every string of the
+   among which matches at c is a prefix (or suffix) of the longest one, so
+   the runtime's chain of substrings visits them longest first. */
+
+static int find_among(struct interpreter * z, struct node * p) {
+    struct among * x = p->among;
+    int c = z->c;
+    int limit = INT_MAX;
+    repeat {
+        struct amongvec * w = 0;
+        int i;
+        for (i = 0; i < x->literalstring_count; i++) {
+            struct amongvec * v = x->b + i;
+            if (v->size >= limit || (w != 0 && v->size <= w->size)) continue;
+            if (p->mode == m_forward) {
+                if (v->size > z->l - c ||
+                    memcmp(z->p + c, v->b, v->size * sizeof(symbol)) != 0) continue;
+            } else {
+                if (v->size > c - z->lb ||
+                    memcmp(z->p + c - v->size, v->b, v->size * sizeof(symbol)) != 0) continue;
+            }
+            w = v;
+        }
+        if (w == 0) return 0;
+        z->c = p->mode == m_forward ? c + w->size : c - w->size;
+        if (w->function == 0) return w->result;
+        {
+            int res = call(z, w->function);
+            z->c = p->mode == m_forward ? c + w->size : c - w->size;
+            if (res) return w->result;
+        }
+        limit = w->size;
+    }
+}
+
+static int eval_substring(struct interpreter * z, struct node * p) {
+    z->among_var = find_among(z, p);
+    return z->among_var != 0;
+}
+
+static int eval_among(struct interpreter * z, struct node * p) {
+    struct among * x = p->among;
+    int case_number = 1;
+
+    if (x->substring == 0) unless (eval_substring(z, p)) return false;
+    if (x->command_count == 0 && x->starter == 0) return true;
+
+    unless (x->starter == 0) unless (eval(z, x->starter)) return false;
+
+    p = p->left;
+    if (p != 0 && p->type != c_literalstring) p = p->right;
+    until (p == 0) {
+        if (p->type == c_bra && p->left != 0) {
+            if (case_number++ == z->among_var) return eval(z, p);
+        }
+        p = p->right;
+    }
+    return true;
+}
+
+static int eval_GO(struct interpreter * z, struct node * p, int style) {
+    repeat {
+        int k = keep(z, p);
+        if (eval(z, p->left)) {
+            if (style == 1) restore(z, p, k); /* goto */
+            return true;
+        }
+        if (z->error) return false;
+        restore(z, p, k);
+        unless (next(z, p)) return false;
+    }
+}
+
+static int eval_repeat(struct interpreter * z, struct node * p) {
+    int count = 0;
+    repeat {
+        int k = keep(z, p);
+        unless (eval(z, p->left)) { restore(z, p, k); break; }
+        count++;
+    }
+    return count;
+}
+
+static int eval_setlimit(struct interpreter * z, struct node * p) {
+    int k = keep(z, p);
+    int mlimit;
+    int ret;
+    unless (eval(z, p->left)) return false;
+    if (p->mode == m_forward) {
+        mlimit = z->l - z->c; z->l = z->c;
+    } else {
+        mlimit = z->lb; z->lb = z->c;
+    }
+    restore(z, p, k);
+    ret = eval(z, p->aux);
+    if (p->mode == m_forward) z->l += mlimit; else z->lb = mlimit;
+    return ret;
+}
+
+static int eval_dollar(struct interpreter * z, struct node * p) {
+    symbol * q = z->p;
+    int c = z->c; int l = z->l; int lb = z->lb; int bra = z->bra; int ket = z->ket;
+    int ret;
+    z->p = z->S[p->name->count];
+    z->lb = z->c = 0;
+    z->l = SIZE(z->p);
+    ret = eval(z, p->left);
+    z->S[p->name->count] = z->p;
+    z->p = q;
+    z->c = c; z->l = l; z->lb = lb; z->bra = bra; z->ket = ket;
+    return ret;
+}
+
+static int eval(struct interpreter * z, struct node * p) {
+
+    if (z->error) return false;
+    switch (p->type) {
+        case c_bra:
+            for (p = p->left; p != 0; p = p->right) unless (eval(z, p)) return false;
+            return true;
+        case c_and:
+            {   int k = keep(z, p);
+                for (p = p->left; p != 0; p = p->right) {
+                    unless (eval(z, p)) return false;
+                    if (p->right != 0) restore(z, p, k);
+                }
+                return true;
+            }
+        case c_or:
+            {   int k = keep(z, p);
+                for (p = p->left; p->right != 0; p = p->right) {
+                    if (eval(z, p)) return true;
+                    restore(z, p, k);
+                }
+                return eval(z, p);
+            }
+        case c_backwards:
+            z->lb = z->c; z->c = z->l;
+            unless (eval(z, p->left)) return false;
+            z->c = z->lb;
+            return true;
+        case c_not:
+            {   int k = keep(z, p);
+                if (eval(z, p->left)) return false;
+                restore(z, p, k);
+                return true;
+            }
+        case c_set:   z->B[p->name->count] = true; return true;
+        case c_unset: z->B[p->name->count] = false; return true;
+        case c_try:
+        case c_do:
+            {   int k = keep(z, p);
+                int ret = eval(z, p->left);
+                if (p->type == c_do || !ret) restore(z, p, k);
+                return true;
+            }
+        case c_fail:
+            eval(z, p->left);
+            return false;
+        case c_reverse:
+        case c_test:
+            {   int k = keep(z, p);
+                unless (eval(z, p->left)) return false;
+                restore(z, p, k);
+                return true;
+            }
+        case c_goto:   return eval_GO(z, p, 1);
+        case c_gopast: return eval_GO(z, p, 0);
+        case c_repeat: eval_repeat(z, p); return true;
+        case c_loop:
+            {   int i;
+                for (i = eval_AE(z, p->AE); i > 0; i--) unless (eval(z, p->left)) return false;
+                return true;
+            }
+        case c_atleast:
+            {   int i = eval_AE(z, p->AE);
+                return eval_repeat(z, p) >= i;
+            }
+        case c_setmark: z->I[p->name->count] = z->c; return true;
+        case c_tomark:
+            {   int mark = eval_AE(z, p->AE);
+                if (p->mode == m_forward ? z->c > mark : z->c < mark) return false;
+                z->c = mark;
+                return true;
+            }
+        case c_atmark: return z->c == eval_AE(z, p->AE);
+        case c_hop:
+            {   int n = eval_AE(z, p->AE);
+                int ret = p->mode == m_forward ? skip(z, z->c, 0, z->l, n) :
+                                                 skip(z, z->c, z->lb, z->l, -n);
+                if (ret < 0) return false;
+                z->c = ret;
+                return true;
+            }
+        case c_next: return next(z, p);
+        case c_tolimit: z->c = p->mode == m_forward ? z->l : z->lb; return true;
+        case c_atlimit: return p->mode == m_forward ? z->c >= z->l : z->c <= z->lb;
+        case c_leftslice:
+            if (p->mode == m_forward) z->bra = z->c; else z->ket = z->c;
+            return true;
+        case c_rightslice:
+            if (p->mode == m_forward) z->ket = z->c; else z->bra = z->c;
+            return true;
+        case c_assignto:
+            {   symbol ** s = z->S + p->name->count;
+                SIZE(* s) = 0;
+                * s = add_to_b(* s, z->l, z->p);
+                return true;
+            }
+        case c_sliceto:
+            {   symbol ** s = z->S + p->name->count;
+                unless (slice_check(z)) return false;
+                SIZE(* s) = 0;
+                * s = add_to_b(* s, z->ket - z->bra, z->p + z->bra);
+                return true;
+            }
+        case c_assign:
+            if (p->mode == m_forward) {
+                int c_keep = z->c;
+                insert_s(z, z->c, z->l, data_of(z, p));
+                z->c = c_keep;
+            } else {
+                insert_s(z, z->lb, z->c, data_of(z, p));
+            }
+            return true;
+        case c_insert:
+        case c_attach:
+            {   int c_keep = z->c;
+                insert_s(z, z->c, z->c, data_of(z, p));
+                if ((p->type == c_attach) != (p->mode == m_backward)) z->c = c_keep;
+                return true;
+            }
+        case c_delete:
+        case c_slicefrom:
+            {   symbol * s = p->type == c_delete ? 0 : data_of(z, p);
+                unless (slice_check(z)) return false;
+                replace_s(z, z->bra, z->ket, s == 0 ? 0 : SIZE(s), s);
+                return true;
+            }
+        case c_setlimit: return eval_setlimit(z, p);
+        case c_dollar: return eval_dollar(z, p);
+        case c_mathassign: z->I[p->name->count] = eval_AE(z, p->AE); return true;
+        case c_plusassign: z->I[p->name->count] += eval_AE(z, p->AE); return true;
+        case c_minusassign: z->I[p->name->count] -= eval_AE(z, p->AE); return true;
+        case c_multiplyassign: z->I[p->name->count] *= eval_AE(z, p->AE); return true;
+        case c_divideassign: z->I[p->name->count] /= eval_AE(z, p->AE); return true;
+        case c_eq: return z->I[p->name->count] == eval_AE(z, p->AE);
+        case c_ne: return z->I[p->name->count] != eval_AE(z, p->AE);
+        case c_gr: return z->I[p->name->count] > eval_AE(z, p->AE);
+        case c_ge: return z->I[p->name->count] >= eval_AE(z, p->AE);
+        case c_ls: return z->I[p->name->count] < eval_AE(z, p->AE);
+        case c_le: return z->I[p->name->count] <= eval_AE(z, p->AE);
+        case c_call: return call(z, p->name);
+        case c_grouping: return eval_grouping(z, p, false);
+        case c_non: return eval_grouping(z, p, true);
+        case c_name: return eq_s(z, p, z->S[p->name->count]);
+        case c_literalstring: return eq_s(z, p, p->literalstring);
+        case c_among: return eval_among(z, p);
+        case c_substring: return eval_substring(z, p);
+        case c_booltest: return z->B[p->name->count];
+        case c_false: return false;
+        case c_true:
+        case c_debug: return true;
+    }
+    unexpected_node(p->type);
+    return false;
+}
+
+/* Runs external q on word, returning the result in a new block, or 0 after
+   a faulty slice operation. */
+
+extern symbol * interpret(struct interpreter * z, struct name * q, symbol * word) {
+    SIZE(z->p) = 0;
+    z->p = add_to_b(z->p, SIZE(word), word);
+    z->c = 0; z->l = SIZE(word); z->lb = 0;
+    z->bra = 0; z->ket = z->l;
+    z->error = false;
+    call(z, q);
+    if (z->error) return 0;
+    return add_to_b(create_b(z->l), z->l, z->p);
+}
+
+/* Reads a field of u from i, up to end, as the symbols of the analysis:
+   UTF-8 is decoded with widechars, and otherwise taken as bytes. */
+
+static symbol * read_field(symbol * u, int * p_i, int end, int widechars) {
+    symbol * b = create_b(0);
+    int i = *p_i;
+    while (i < end && u[i] != ' ' && u[i] != '\t' && u[i] != '\r') {
+        symbol ch[1];
+        if (widechars) {
+            int slot;
+            i += get_utf8(u + i, & slot);
+            ch[0] = slot;
+        } else {
+            ch[0] = u[i++];
+        }
+        b = add_to_b(b, 1, ch);
+    }
+    *p_i = i;
+    if (SIZE(b) > 0) return b;
+    lose_b(b);
+    return 0;
+}
+
+/* Reads the first field of each line of file, skipping lines with none,
+   and if seconds isn't 0, the second field of each of those lines into
+   *seconds, as 0 where a line has none. Returns 0 if the file can't be
+   read. */
+
+extern symbol ** read_words(char * file, int widechars, int * count, symbol *** seconds) {
+    symbol * filename = add_s_to_b(0, file);
+    char * s;
+    symbol * u = get_input(filename, &s);
+    symbol ** words;
+    int n = 0;
+    int i = 0;
+    lose_b(filename);
+    if (u == 0) return 0;
+    free(s);
+    {   int j;
+        for (j = 0; j < SIZE(u); j++) if (u[j] == '\n') n++;
+    }
+    words = (symbol **) MALLOC((n + 1) * sizeof(symbol *));
+    unless (seconds == 0) *seconds = (symbol **) MALLOC((n + 1) * sizeof(symbol *));
+    n = 0;
+    until (i >= SIZE(u)) {
+        int end = i;
+        symbol * b;
+        while (end < SIZE(u) && u[end] != '\n') end++;
+        b = read_field(u, &i, end, widechars);
+        unless (b == 0) {
+            words[n] = b;
+            while (i < end && (u[i] == ' ' || u[i] == '\t' || u[i] == '\r')) i++;
+            unless (seconds == 0) (*seconds)[n] = read_field(u, &i, end, widechars);
+            n++;
+        }
+        i = end + 1;
+    }
+    lose_b(u);
+    * count = n;
+    return words;
+}
+
+static void write_symbols(symbol * b, int widechars) {
+    int i;
+    for (i = 0; i < SIZE(b); i++) {
+        if (widechars) {
+            symbol s[3];
+            int n = put_utf8(b[i], s);
+            int j;
+            for (j = 0; j < n; j++) putchar(s[j]);
+        } else {
+            putchar(b[i]);
+        }
+    }
+}
+
+/* -eval: runs the external stem on each word of the file, as stemwords
+   would run the compiled program. A line may give the expected stem after
+   the word, and those which differ are listed, with a count at the end;
+   the stems of words given alone are written out, one a line. Returns
+   false if any differ, or the file can't be read. */
+
+extern int eval_words(struct analyser * a, struct options * o) {
+    struct name * q;
+    symbol ** expected;
+    int count;
+    int checked = 0;
+    int differ = 0;
+    int i;
+    symbol ** words;
+    for (q = a->names; q != 0; q = q->next) {
+        if (q->type == t_external && SIZE(q->b) == 4 &&
+            q->b[0] == 's' && q->b[1] == 't' && q->b[2] == 'e' && q->b[3] == 'm') break;
+    }
+    if (q == 0) {
+        report_s(a->tokeniser->file, 0, false, "-eval needs an external stem");
+        return false;
+    }
+    words = read_words(o->eval_file, o->widechars, &count, &expected);
+    if (words == 0) {
+        struct str * text = str_new();
+        str_append_string(text, "Can't open ");
+        str_append_string(text, o->eval_file);
+        report(0, 0, false, text);
+        str_delete(text);
+        return false;
+    }
+    {   struct interpreter * z = create_interpreter(a, o->utf8);
+        for (i = 0; i < count; i++) {
+            symbol * word = words[i];
+            symbol * stem = interpret(z, q, word);
+            symbol * e = expected[i];
+            if (e == 0) {
+                unless (stem == 0) write_symbols(stem, o->widechars);
+                putchar('\n');
+            } else {
+                checked++;
+                if (stem == 0 || SIZE(stem) != SIZE(e) ||
+                    memcmp(stem, e, SIZE(e) * sizeof(symbol)) != 0) {
+                    differ++;
+                    write_symbols(word, o->widechars);
+                    printf(" -> ");
+                    if (stem == 0) printf("(faulty slice operation)"); else
+                        write_symbols(stem, o->widechars);
+                    printf(", expected ");
+                    write_symbols(e, o->widechars);
+                    putchar('\n');
+                }
+                lose_b(e);
+            }
+            if (stem == 0) {
+                struct str * text = str_new();
+                str_append_string(text, o->eval_file);
+                str_append_string(text, ": faulty slice operation on ");
+                str_append_b(text, word);
+                report(0, 0, true, text);
+                str_delete(text);
+            }
+            lose_b(stem);
+            lose_b(word);
+        }
+        close_interpreter(z);
+    }
+    FREE(words);
+    FREE(expected);
+    if (checked > 0) printf("%d of %d stems differ\n", differ, checked);
+    return differ == 0;
+}
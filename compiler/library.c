@@ -0,0 +1,302 @@
+#define _POSIX_C_SOURCE 200809L /* for open_memstream */
+#include <setjmp.h>  /* for setjmp, longjmp */
+#include <stdio.h>   /* for fprintf etc */
+#include <stdlib.h>  /* for malloc, realloc, free, exit */
+#include <string.h>  /* for strlen, memcpy */
+#include "header.h"
+#include "snowball_compiler.h"
+
+/* The compiler as a library: sb_compile() runs it on a source in memory,
+   and hands back what it would have written to files, and the errors and
+   warnings it would have written to stderr. report() and fatal() are how
+   the rest of the compiler gets them there, so while sb_compile() is
+   running they are kept in its result, and a fatal error jumps back to it
+   rather than exiting.
+
+   The compiler keeps this in globals, as it does space_count, so only one
+   compilation may run at a time. */
+
+static struct sb_compiler_result * collecting = 0;
+static jmp_buf * fatal_jump = 0;
+
+static char * copy_s(const char * s) {
+    char * p = (char *) malloc(strlen(s) + 1);
+    unless (p == 0) strcpy(p, s);
+    return p;
+}
+
+/* An error (or warning) about line_number of file, or about file as a
+   whole if line_number is 0, or about neither if file is 0. */
+extern void report(const char * file, int line_number, int warning, struct str * text) {
+    symbol * b = str_data(text);
+    int n = str_len(text);
+    int i;
+    if (collecting == 0) {
+        if (line_number > 0) fprintf(stderr, "%s:%d: ", file, line_number);
+        for (i = 0; i < n; i++) fprintf(stderr, "%c", b[i]);
+        fprintf(stderr, "\n");
+        return;
+    }
+    {
+        struct sb_compiler_result * r = collecting;
+        struct sb_compiler_message * m = (struct sb_compiler_message *)
+            realloc(r->messages, (r->message_count + 1) * sizeof(struct sb_compiler_message));
+        char * s = (char *) malloc(n + 1);
+        if (m == 0 || s == 0) { free(s); return; }
+        r->messages = m;
+        m += r->message_count;
+        for (i = 0; i < n; i++) s[i] = b[i];
+        s[n] = 0;
+        m->file = file == 0 ? 0 : copy_s(file);
+        m->line = line_number;
+        m->warning = warning;
+        m->text = s;
+        r->message_count++;
+    }
+}
+
+extern void report_s(const char * file, int line_number, int warning, const char * s) {
+    struct str * text = str_new();
+    str_append_string(text, s);
+    report(file, line_number, warning, text);
+    str_delete(text);
+}
+
+/* After 20 errors the command line gives up. The library goes on to the
+   end of the source, so as to free what it has made, but keeps no more of
+   them. Returns whether to report this one. */
+extern int count_error(struct tokeniser * t) {
+    if (t->error_count >= 20) {
+        if (collecting == 0) { fprintf(stderr, "... etc\n"); exit(1); }
+        if (t->error_count == 20) report_s(0, 0, false, "... etc");
+        t->error_count++;
+        return false;
+    }
+    t->error_count++;
+    return true;
+}
+
+/* After an error which has been reported, and which the compiler can't go
+   on from. */
+extern void fatal(void) {
+    unless (fatal_jump == 0) longjmp(*fatal_jump, 1);
+    exit(1);
+}
+
+/* A node the caller has no case for, which is a bug in the compiler. */
+extern void unexpected_node(int type) {
+    struct str * text = str_new();
+    str_append_int(text, type);
+    str_append_string(text, " encountered");
+    report(0, 0, false, text);
+    str_delete(text);
+    fatal();
+}
+
+/* Runs the generator for o->make_lang, which writes to the files for it in
+   o, which are open. */
+extern void generate_program(struct analyser * a, struct options * o) {
+    struct generator * g;
+    switch (o->make_lang) {
+        case LANG_C:
+            find_short_word_limits(a);
+            g = create_generator_c(a, o);
+            generate_program_c(g);
+            close_generator_c(g);
+            break;
+        case LANG_BYTECODE:
+            generate_program_bytecode(a, o);
+            break;
+        case LANG_CPLUSPLUS:
+            find_short_word_limits(a);
+            g = create_generator_c(a, o);
+            generate_program_cpp(g);
+            close_generator_c(g);
+            break;
+#ifndef DISABLE_JAVA
+        case LANG_JAVA:
+            g = create_generator_java(a, o);
+            generate_program_java(g);
+            close_generator_java(g);
+            break;
+#endif
+#ifndef DISABLE_PYTHON
+        case LANG_PYTHON:
+            g = create_generator_python(a, o);
+            generate_program_python(g);
+            close_generator_python(g);
+            break;
+#endif
+    }
+}
+
+/* What sb_compile() has made so far, for it to free whether or not it
+   gets to the end. A fatal error in the generators, which is a bug in the
+   compiler, may leave some of their own memory unfreed. */
+struct compilation {
+    int ok;
+    struct options o;
+    char * output_file;
+    symbol * u;
+    struct tokeniser * t;
+    struct analyser * a;
+    int output_count;
+    struct {
+        const char * suffix;
+        FILE ** file;       /* in o */
+        char * data;
+        size_t size;
+    } outputs[2];
+};
+
+static int add_output(struct compilation * c, FILE ** file, const char * suffix) {
+    int i = c->output_count;
+    c->outputs[i].suffix = suffix;
+    c->outputs[i].file = file;
+    c->outputs[i].data = 0;
+    c->outputs[i].size = 0;
+    *file = open_memstream(&c->outputs[i].data, &c->outputs[i].size);
+    if (*file == 0) return false;
+    c->output_count++;
+    return true;
+}
+
+static int compile_in_memory(struct compilation * c, const char * source, size_t size,
+                             const char * file, const char * const * options) {
+    struct options * o = &c->o;
+    default_options(o);
+    {   struct str * error = str_new();
+        int argc = 0;
+        int k;
+        unless (options == 0) while (options[argc] != 0) argc++;
+        k = read_options(o, argc, (char **) options, 0, error);
+        unless (k == 0) report(0, 0, false, error);
+        str_delete(error);
+        unless (k == 0) return false;
+    }
+    if (o->syntax_tree || o->hotwords_file || o->report_file || o->profile_file ||
+        o->manifest || o->eval_file) {
+        report_s(0, 0, false, "-syntax, -hotwords, -report, -profile, -manifest and -eval can't be used with sb_compile()");
+        return false;
+    }
+    if (o->output_file == 0) {
+        int n = strlen(file);
+        if (n > 4 && memcmp(file + n - 4, ".sbl", 4) == 0) n -= 4;
+        c->output_file = (char *) malloc(n + 1);
+        if (c->output_file == 0) return false;
+        memcpy(c->output_file, file, n);
+        c->output_file[n] = 0;
+        o->output_file = c->output_file;
+    }
+
+    c->u = create_b(size);
+    {   size_t i;
+        for (i = 0; i < size; i++) c->u[i] = (unsigned char) source[i];
+    }
+    SIZE(c->u) = size;
+    c->t = create_tokeniser(c->u, copy_s(file));
+    c->a = create_analyser(c->t);
+    c->t->widechars = o->widechars;
+    c->t->includes = o->includes;
+    c->a->utf8 = c->t->utf8 = o->utf8;
+    read_program(c->a);
+    if (c->t->error_count > 0) return false;
+    if (o->optimise) optimise_program(c->a, o);
+
+    switch (o->make_lang) {
+        case LANG_C:
+            unless (add_output(c, &o->output_c, ".c") &&
+                    add_output(c, &o->output_h, ".h")) return false;
+            break;
+        case LANG_BYTECODE:
+            unless (add_output(c, &o->output_bytecode, ".sbc")) return false;
+            break;
+        case LANG_CPLUSPLUS:
+            unless (add_output(c, &o->output_h, ".hpp")) return false;
+            break;
+#ifndef DISABLE_JAVA
+        case LANG_JAVA:
+            unless (add_output(c, &o->output_java, ".java")) return false;
+            break;
+#endif
+#ifndef DISABLE_PYTHON
+        case LANG_PYTHON:
+            unless (add_output(c, &o->output_python, ".py")) return false;
+            break;
+#endif
+    }
+    generate_program(c->a, o);
+    return true;
+}
+
+static int run_compilation(struct compilation * c, const char * source, size_t size,
+                           const char * file, const char * const * options) {
+    jmp_buf jump;
+    c->ok = false;
+    fatal_jump = &jump;
+    if (setjmp(jump) == 0) c->ok = compile_in_memory(c, source, size, file, options);
+    fatal_jump = 0;
+    return c->ok;
+}
+
+extern struct sb_compiler_result * sb_compile(const char * source, size_t size,
+                                              const char * file,
+                                              const char * const * options) {
+    struct sb_compiler_result * r;
+    struct compilation * c;
+    int i;
+    r = (struct sb_compiler_result *) malloc(sizeof(struct sb_compiler_result));
+    c = (struct compilation *) malloc(sizeof(struct compilation));
+    if (r == 0 || c == 0) { free(r); free(c); return 0; }
+    r->ok = false;
+    r->output_count = 0;
+    r->outputs = 0;
+    r->message_count = 0;
+    r->messages = 0;
+    c->output_file = 0;
+    c->u = 0;
+    c->t = 0;
+    c->a = 0;
+    c->output_count = 0;
+
+    collecting = r;
+    r->ok = run_compilation(c, source, size, file, options);
+    collecting = 0;
+
+    for (i = 0; i < c->output_count; i++) fclose(*c->outputs[i].file);
+    if (r->ok) {
+        r->outputs = (struct sb_compiler_output *)
+            malloc(c->output_count * sizeof(struct sb_compiler_output));
+        if (r->outputs == 0) r->ok = false;
+    }
+    for (i = 0; i < c->output_count; i++) {
+        if (r->ok) {
+            struct sb_compiler_output * q = r->outputs + r->output_count++;
+            q->suffix = c->outputs[i].suffix;
+            q->data = c->outputs[i].data;
+            q->size = c->outputs[i].size;
+        } else {
+            free(c->outputs[i].data);
+        }
+    }
+    unless (c->t == 0) close_tokeniser(c->t);
+    unless (c->a == 0) close_analyser(c->a);
+    lose_b(c->u);
+    lose_includes(&c->o);
+    free(c->output_file);
+    free(c);
+    return r;
+}
+
+extern void sb_compiler_result_delete(struct sb_compiler_result * r) {
+    int i;
+    if (r == 0) return;
+    for (i = 0; i < r->output_count; i++) free(r->outputs[i].data);
+    for (i = 0; i < r->message_count; i++) {
+        free(r->messages[i].file);
+        free(r->messages[i].text);
+    }
+    free(r->outputs);
+    free(r->messages);
+    free(r);
+}
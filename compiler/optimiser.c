@@ -0,0 +1,673 @@
+#include <limits.h>  /* INT_MAX, INT_MIN */
+#include <stdio.h>   /* FILE, used by header.h */
+#include <string.h>  /* for memcmp, memset */
+#include "header.h"
+
+/*  This module implements the optimisations selected by the -O option. It
+    runs on the node tree built by the analyser, before any generator sees it,
+    in four passes:
+
+    1. Constant folding of arithmetic expressions, so that for example
+       'hop 2+1' becomes 'hop 3'.
+
+    2. A dataflow analysis which works out, for every command, whether it
+       can fail, whether c may have moved when it succeeds, and whether c may
+       have moved when it fails. Routine calls use the summary of the called
+       routine, and the summaries are iterated to a fixed point so that
+       mutually recursive routines are handled. From this the 'keep' field of
+       each command that saves and restores c is set, replacing the
+       conservative K_needed() and repeat_score() heuristics the generators
+       otherwise use.
+
+    3. Dead store elimination for integer assignments: stores to integers
+       which are never read, and stores which are certainly overwritten
+       before they can be read, are turned into 'true'.
+
+    4. For each external, the length below which it leaves every word
+       unchanged is found by running it on all such words in the
+       interpreter, so that the generated code can return at once for them.
+
+    Note that in backward mode c is kept as l - c, so any command that alters
+    the string (and hence l) is regarded as moving c.
+*/
+
+/* Pass 1: constant folding */
+
+static int fold_constant(int op, int x, int y, int * result) {
+    long long r;
+    switch (op) {
+        case c_plus:     r = (long long)x + y; break;
+        case c_minus:    r = (long long)x - y; break;
+        case c_multiply: r = (long long)x * y; break;
+        case c_divide:
+            if (y == 0 || (x == INT_MIN && y == -1)) return false;
+            r = x / y; break;
+        default: return false;
+    }
+    if (r < INT_MIN || r > INT_MAX) return false;
+    * result = (int)r;
+    return true;
+}
+
+static void make_number(struct node * p, int n) {
+    p->type = c_number;
+    p->number = n;
+    p->left = 0;
+    p->right = 0;
+}
+
+/* Makes p the expression q, keeping p in its place in a->nodes: the nodes
+   of an expression are allocated in turn, so q->next may well be p. */
+static void copy_AE(struct node * p, struct node * q) {
+    struct node * next = p->next;
+    * p = * q;
+    p->next = next;
+}
+
+static void fold_AE(struct node * p) {
+    if (p == 0) return;
+    switch (p->type) {
+        case c_neg:
+            fold_AE(p->right);
+            if (p->right->type == c_number && p->right->number != INT_MIN)
+                make_number(p, - p->right->number);
+            return;
+        case c_plus:
+        case c_minus:
+        case c_multiply:
+        case c_divide:
+            fold_AE(p->left);
+            fold_AE(p->right);
+            {
+                struct node * l = p->left;
+                struct node * r = p->right;
+                int result;
+                if (l->type == c_number && r->type == c_number) {
+                    if (fold_constant(p->type, l->number, r->number, &result))
+                        make_number(p, result);
+                    return;
+                }
+                /* x + 0, x - 0, x * 1, x / 1 and 0 + x, 1 * x */
+                if (r->type == c_number &&
+                    ((r->number == 0 && (p->type == c_plus || p->type == c_minus)) ||
+                     (r->number == 1 && (p->type == c_multiply || p->type == c_divide)))) {
+                    copy_AE(p, l); return;
+                }
+                if (l->type == c_number &&
+                    ((l->number == 0 && p->type == c_plus) ||
+                     (l->number == 1 && p->type == c_multiply))) {
+                    copy_AE(p, r); return;
+                }
+            }
+            return;
+    }
+}
+
+/* Pass 2: cursor dataflow analysis */
+
+static int analyse_list(struct node * p);
+
+/* Sets p->can_fail, p->moves and p->moves_on_fail from the flags of its
+   components. Returns true if any flag of p changed.
+*/
+static int analyse(struct node * p) {
+    byte f = true;          /* can fail */
+    byte s = true;          /* c may move on success */
+    byte m = false;         /* c may move on failure */
+    int changed = false;
+    switch (p->type) {
+        case c_bra:
+            changed = analyse_list(p->left);
+            {
+                struct node * q;
+                byte moved = false;
+                f = s = m = false;
+                for (q = p->left; q != 0; q = q->right) {
+                    if (q->moves_on_fail || (q->can_fail && moved)) m = true;
+                    if (q->can_fail) f = true;
+                    if (q->moves) moved = true;
+                }
+                s = moved;
+            }
+            break;
+        case c_and:
+            changed = analyse_list(p->left);
+            {
+                struct node * q;
+                f = m = false;
+                for (q = p->left; q != 0; q = q->right) {
+                    if (q->can_fail) f = true;
+                    if (q->moves_on_fail) m = true;
+                    if (q->right == 0) s = q->moves;
+                }
+            }
+            break;
+        case c_or:
+            changed = analyse_list(p->left);
+            {
+                struct node * q;
+                s = false;
+                for (q = p->left; q != 0; q = q->right) {
+                    unless (q->can_fail) f = false;
+                    if (q->moves) s = true;
+                    if (q->right == 0) m = q->moves_on_fail;
+                }
+            }
+            break;
+        case c_not:
+            changed = analyse(p->left);
+            s = false; m = p->left->moves;
+            break;
+        case c_try:
+            changed = analyse(p->left);
+            f = false; s = p->left->moves;
+            break;
+        case c_test:
+        case c_reverse:
+            changed = analyse(p->left);
+            f = p->left->can_fail; s = false; m = p->left->moves_on_fail;
+            break;
+        case c_do:
+            changed = analyse(p->left);
+            f = false; s = false;
+            break;
+        case c_fail:
+            changed = analyse(p->left);
+            s = false; m = p->left->moves || p->left->moves_on_fail;
+            break;
+        case c_backwards:
+            changed = analyse(p->left);
+            f = p->left->can_fail; m = f;
+            break;
+        case c_goto:
+        case c_gopast:
+            changed = analyse(p->left);
+            m = true;
+            break;
+        case c_repeat:
+            changed = analyse(p->left);
+            f = false; s = p->left->moves;
+            break;
+        case c_loop:
+            changed = analyse(p->left);
+            f = p->left->can_fail; s = p->left->moves;
+            m = p->left->moves_on_fail || (f && s);
+            break;
+        case c_atleast:
+            changed = analyse(p->left);
+            s = p->left->moves;
+            m = s || p->left->moves_on_fail;
+            break;
+        case c_setlimit:
+            changed = analyse(p->left);
+            if (analyse(p->aux)) changed = true;
+            f = p->left->can_fail || p->aux->can_fail;
+            s = p->aux->moves;
+            m = p->left->moves_on_fail || p->aux->moves_on_fail;
+            break;
+        case c_dollar:
+            changed = analyse(p->left);
+            f = p->left->can_fail; s = false;
+            break;
+        case c_call:
+            {
+                struct node * d = p->name->definition;
+                f = d->can_fail; s = d->moves; m = d->moves_on_fail;
+            }
+            break;
+        case c_among:
+            /* the starter and the case commands are the bracketed command
+               lists; by the time one of them fails, the lookup has already
+               moved c */
+            {
+                struct node * q;
+                f = false;
+                for (q = p->left; q != 0; q = q->right) {
+                    if (q->type != c_bra) continue;
+                    if (analyse(q)) changed = true;
+                    if (q->can_fail) f = true;
+                }
+                m = f;
+                if (p->among->substring == 0) {
+                    f = true;
+                    if (p->among->function_count > 0) m = true;
+                }
+            }
+            break;
+        case c_substring:
+            m = p->among->function_count > 0;
+            break;
+        case c_literalstring:
+            s = SIZE(p->literalstring) > 0;
+            break;
+        case c_name:
+        case c_grouping:
+        case c_non:
+        case c_next:
+        case c_hop:
+        case c_tomark:
+            break;
+        case c_tolimit:
+            f = false;
+            break;
+        case c_atmark:
+        case c_atlimit:
+        case c_booltest:
+        case c_false:
+        case c_eq:
+        case c_ne:
+        case c_gr:
+        case c_ge:
+        case c_ls:
+        case c_le:
+            s = false;
+            break;
+        case c_delete:
+        case c_slicefrom:
+            /* slice errors are reported as failure by some generators */
+            break;
+        case c_sliceto:
+            s = false;
+            break;
+        case c_insert:
+        case c_attach:
+        case c_assign:
+            f = false;
+            break;
+        default:
+            /* leftslice, rightslice, assignto, set, unset, setmark, true,
+               debug and the integer assignments */
+            f = s = false;
+            break;
+    }
+    unless (p->can_fail == f && p->moves == s && p->moves_on_fail == m) {
+        p->can_fail = f;
+        p->moves = s;
+        p->moves_on_fail = m;
+        changed = true;
+    }
+    return changed;
+}
+
+static int analyse_list(struct node * p) {
+    int changed = false;
+    until (p == 0) {
+        if (analyse(p)) changed = true;
+        p = p->right;
+    }
+    return changed;
+}
+
+/* Decide which keeps of c are needed, now the flags are final. */
+
+static void set_keeps(struct node * p);
+
+static void set_keeps_list(struct node * p) {
+    until (p == 0) { set_keeps(p); p = p->right; }
+}
+
+static void set_keeps(struct node * p) {
+    struct node * q;
+    switch (p->type) {
+        case c_and:
+            p->keep = false;
+            for (q = p->left; q->right != 0; q = q->right)
+                if (q->moves) p->keep = true;
+            set_keeps_list(p->left);
+            return;
+        case c_or:
+            p->keep = false;
+            for (q = p->left; q->right != 0; q = q->right)
+                if (q->moves_on_fail) p->keep = true;
+            set_keeps_list(p->left);
+            return;
+        case c_not:
+        case c_try:
+        case c_gopast:
+        case c_repeat:
+        case c_atleast:
+            p->keep = p->left->moves_on_fail;
+            break;
+        case c_test:
+        case c_reverse:
+        case c_setlimit:
+            p->keep = p->left->moves;
+            break;
+        case c_do:
+        case c_goto:
+            p->keep = p->left->moves || p->left->moves_on_fail;
+            break;
+        case c_among:
+            for (q = p->left; q != 0; q = q->right)
+                if (q->type == c_bra) set_keeps(q);
+            return;
+        case c_bra:
+            set_keeps_list(p->left);
+            return;
+    }
+    unless (p->left == 0) set_keeps(p->left);
+    unless (p->aux == 0) set_keeps(p->aux);
+}
+
+/* Pass 3: dead integer stores */
+
+static int reads_integer_AE(struct node * p, struct name * q) {
+    if (p == 0) return false;
+    if (p->type == c_name) return p->name == q;
+    return reads_integer_AE(p->left, q) || reads_integer_AE(p->right, q);
+}
+
+/* Tests if command p, including its components, might read integer q. */
+static int reads_integer(struct node * p, struct name * q) {
+    struct node * r;
+    switch (p->type) {
+        case c_eq:
+        case c_ne:
+        case c_gr:
+        case c_ge:
+        case c_ls:
+        case c_le:
+        case c_plusassign:
+        case c_minusassign:
+        case c_multiplyassign:
+        case c_divideassign:
+            if (p->name == q) return true;
+            break;
+        case c_call:
+            /* assume a routine may read anything */
+            return true;
+        case c_among:
+            if (p->among->substring == 0 && p->among->function_count > 0)
+                return true;
+            for (r = p->left; r != 0; r = r->right)
+                if (r->type == c_bra && reads_integer(r, q)) return true;
+            return false;
+        case c_substring:
+            return p->among->function_count > 0;
+    }
+    if (reads_integer_AE(p->AE, q)) return true;
+    unless (p->aux == 0) if (reads_integer(p->aux, q)) return true;
+    for (r = p->left; r != 0; r = r->right)
+        if (reads_integer(r, q)) return true;
+    return false;
+}
+
+static int is_integer_store(struct node * p) {
+    return p->type == c_mathassign || p->type == c_setmark;
+}
+
+static void make_true(struct node * p) {
+    p->type = c_true;
+    p->AE = 0;
+    p->name = 0;
+    p->can_fail = p->moves = p->moves_on_fail = false;
+}
+
+/* In the command list p, remove stores which are overwritten by a later
+   store to the same integer before anything can read it or fail.
+*/
+static void kill_overwritten_stores(struct node * p) {
+    for (; p != 0; p = p->right) {
+        struct node * q;
+        unless (is_integer_store(p)) continue;
+        for (q = p->right; q != 0; q = q->right) {
+            if (is_integer_store(q) && q->name == p->name &&
+                !reads_integer(q->AE, p->name)) {
+                make_true(p);
+                break;
+            }
+            if (q->can_fail || reads_integer(q, p->name)) break;
+        }
+    }
+}
+
+static void remove_dead_stores(struct analyser * a, struct options * o) {
+    struct node * p;
+    for (p = a->nodes; p != 0; p = p->next) {
+        if (p->type == c_bra || p->type == c_and) kill_overwritten_stores(p->left);
+    }
+    if (o->variables_prefix) return; /* the integers are visible outside */
+    {
+        struct name * q;
+        for (q = a->names; q != 0; q = q->next) {
+            int read = false;
+            if (q->type != t_integer) continue;
+            for (p = a->nodes; p != 0; p = p->next) {
+                if (p->type == c_name && p->name == q) { read = true; break; }
+                if (p->name == q && (p->type == c_eq || p->type == c_ne ||
+                                     p->type == c_gr || p->type == c_ge ||
+                                     p->type == c_ls || p->type == c_le)) {
+                    read = true; break;
+                }
+            }
+            if (read) continue;
+            for (p = a->nodes; p != 0; p = p->next) {
+                if (p->name != q) continue;
+                switch (p->type) {
+                    case c_mathassign:
+                    case c_plusassign:
+                    case c_minusassign:
+                    case c_multiplyassign:
+                    case c_divideassign:
+                    case c_setmark:
+                        make_true(p);
+                }
+            }
+        }
+    }
+}
+
+/* Pass 4: short words. This leaves the program as it is, so the generators
+   run it whether or not -O is given. */
+
+/* Snowball tells symbols apart only by the literals, among strings and
+   groupings of the program, so a word of any other symbols behaves as the
+   same word of one stand-in symbol. With -u the width of a character also
+   counts, so there is a stand-in of each width.
+
+   One letter words which are changed are often just the markers a prelude
+   puts in, like 'Y'; such symbols are excluded, and the generated check
+   then also looks for them in the word. With -u, or a single byte
+   encoding, that works for any byte, and a non-ASCII character excludes
+   all bytes from 0x80 up. With -w nothing can be excluded.
+
+   A string variable can hold symbols of the word itself, so once one is
+   compared against the text two different stand-ins may no longer behave
+   alike, and the pass is skipped.
+*/
+
+#define MAX_SHORT_WORDS 100000  /* words to try of one length */
+#define MAX_SHORT_LENGTH 64     /* longest length tried */
+
+static void add_literal(byte * seen, symbol * b, int utf8) {
+    int i = 0;
+    while (i < SIZE(b)) {
+        int ch;
+        if (utf8) i += get_utf8(b + i, & ch); else ch = b[i++];
+        seen[ch] = true;
+    }
+}
+
+static void add_stand_in(byte * seen, int * alphabet, int * n, int from, int to) {
+    int ch;
+    for (ch = from; ch <= to; ch++) {
+        unless (seen[ch]) { alphabet[(*n)++] = ch; return; }
+    }
+}
+
+/* The symbols which make up the words to try: the first * real are those
+   of the program, and then come the stand-ins. */
+static int * make_alphabet(struct analyser * a, int * n, int * real) {
+    byte * seen = (byte *) MALLOC(0x10000);
+    int * alphabet;
+    int ch;
+    memset(seen, 0, 0x10000);
+    {   struct node * p;
+        for (p = a->nodes; p != 0; p = p->next)
+            unless (p->literalstring == 0) add_literal(seen, p->literalstring, a->utf8);
+    }
+    {   struct among * x;
+        for (x = a->amongs; x != 0; x = x->next) {
+            int i;
+            for (i = 0; i < x->literalstring_count; i++)
+                add_literal(seen, x->b[i].b, a->utf8);
+        }
+    }
+    {   struct grouping * q;
+        for (q = a->groupings; q != 0; q = q->next) {
+            int i;
+            for (i = 0; i < SIZE(q->b); i++) seen[q->b[i]] = true;
+        }
+    }
+    * n = 0;
+    for (ch = 0; ch < 0x10000; ch++) if (seen[ch]) (*n)++;
+    alphabet = (int *) MALLOC((* n + 3) * sizeof(int));
+    * n = 0;
+    for (ch = 0; ch < 0x10000; ch++) if (seen[ch]) alphabet[(*n)++] = ch;
+    * real = * n;
+    if (a->utf8) {
+        add_stand_in(seen, alphabet, n, 0x21, 0x7E);
+        add_stand_in(seen, alphabet, n, 0x100, 0x7FF);
+        add_stand_in(seen, alphabet, n, 0x800, 0xFFFF);
+    } else {
+        add_stand_in(seen, alphabet, n, 0x21, a->tokeniser->widechars ? 0xFFFF : 0xFF);
+    }
+    FREE(seen);
+    return alphabet;
+}
+
+/* Tries all words of length len, returning false if one is changed. */
+static int all_unchanged(struct interpreter * z, struct name * q, int utf8,
+                         int * alphabet, int n, int len) {
+    int * k;
+    symbol * word;
+    int unchanged = true;
+    int i;
+    if (n == 0 && len > 0) return true;
+    k = (int *) MALLOC((len + 1) * sizeof(int));
+    word = create_b(3 * len + 1);
+    for (i = 0; i < len; i++) k[i] = 0;
+    repeat {
+        symbol * stem;
+        SIZE(word) = 0;
+        for (i = 0; i < len; i++) {
+            if (utf8) SIZE(word) += put_utf8(alphabet[k[i]], word + SIZE(word));
+            else word[SIZE(word)++] = alphabet[k[i]];
+        }
+        stem = interpret(z, q, word);
+        if (stem == 0 || SIZE(stem) != SIZE(word) ||
+            memcmp(stem, word, SIZE(word) * sizeof(symbol)) != 0) unchanged = false;
+        unless (stem == 0) lose_b(stem);
+        unless (unchanged) break;
+        for (i = 0; i < len; i++) {
+            if (++k[i] < n) break;
+            k[i] = 0;
+        }
+        if (i == len) break;
+    }
+    lose_b(word);
+    FREE(k);
+    return unchanged;
+}
+
+/* Sets q->short_word_limit and q->short_word_symbols. */
+static void find_short_word_limit(struct interpreter * z, struct analyser * a, struct name * q,
+                                  int * all, int all_count, int real) {
+    int * alphabet = (int *) MALLOC((all_count + 1) * sizeof(int));
+    int n = 0;
+    symbol * excluded = create_b(0);
+    int ascii_only = false;
+    int len;
+    int count;
+    int i;
+
+    unless (all_unchanged(z, q, a->utf8, all, all_count, 0)) goto out;
+    for (i = 0; i < all_count; i++) {
+        int ch = all[i];
+        symbol one[1];
+        if (all_unchanged(z, q, a->utf8, all + i, 1, 1)) {
+            alphabet[n++] = ch;
+            continue;
+        }
+        if (a->tokeniser->widechars) goto out;
+        if (a->utf8 && ch >= 0x80) { ascii_only = true; continue; }
+        if (i >= real) goto out; /* a stand-in */
+        one[0] = ch;
+        excluded = add_to_b(excluded, 1, one);
+    }
+    if (ascii_only) {
+        int j = 0;
+        for (i = 0; i < n; i++) if (alphabet[i] < 0x80) alphabet[j++] = alphabet[i];
+        n = j;
+        for (i = 0x80; i < 0x100; i++) {
+            symbol one[1];
+            one[0] = i;
+            excluded = add_to_b(excluded, 1, one);
+        }
+    }
+    /* with n <= 1 the words tried tell nothing about longer words */
+    len = 2;
+    count = n * n;
+    while (n > 1 && len <= MAX_SHORT_LENGTH && count <= MAX_SHORT_WORDS &&
+           all_unchanged(z, q, a->utf8, alphabet, n, len)) {
+        len++;
+        if (count > MAX_SHORT_WORDS / n) break;
+        count *= n;
+    }
+    q->short_word_limit = len;
+    if (SIZE(excluded) > 0) {
+        q->short_word_symbols = excluded;
+        excluded = 0;
+    }
+out:
+    unless (excluded == 0) lose_b(excluded);
+    FREE(alphabet);
+}
+
+/* True if a string variable is compared against the text, either directly
+   or as the text of a '$' command. */
+static int compares_strings(struct analyser * a) {
+    struct node * p;
+    for (p = a->nodes; p != 0; p = p->next) {
+        if (p->name == 0 || p->name->type != t_string) continue;
+        if (p->type == c_name || p->type == c_dollar) return true;
+    }
+    return false;
+}
+
+extern void find_short_word_limits(struct analyser * a) {
+    int n;
+    int real;
+    int * alphabet;
+    struct interpreter * z;
+    struct name * q;
+    if (compares_strings(a)) return;
+    alphabet = make_alphabet(a, & n, & real);
+    z = create_interpreter(a, a->utf8);
+    for (q = a->names; q != 0; q = q->next) {
+        if (q->type != t_external || q->definition == 0) continue;
+        find_short_word_limit(z, a, q, alphabet, n, real);
+    }
+    close_interpreter(z);
+    FREE(alphabet);
+}
+
+extern void optimise_program(struct analyser * a, struct options * o) {
+    struct node * p;
+
+    for (p = a->nodes; p != 0; p = p->next) fold_AE(p->AE);
+
+    /* start from the optimistic assumption and iterate to a fixed point */
+    for (p = a->nodes; p != 0; p = p->next)
+        p->can_fail = p->moves = p->moves_on_fail = false;
+    repeat {
+        int changed = false;
+        for (p = a->program; p != 0; p = p->right)
+            if (analyse(p->left)) changed = true;
+        unless (changed) break;
+    }
+
+    remove_dead_stores(a, o);
+
+    for (p = a->program; p != 0; p = p->right) set_keeps(p->left);
+}
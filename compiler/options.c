@@ -0,0 +1,293 @@
+#include <stdio.h>   /* for FILE */
+#include <stdlib.h>  /* for atoi */
+#include <string.h>  /* for strlen, memcmp */
+#include "header.h"
+
+/* The options of the command line, read by the command, and by
+   sb_compile() in library.c from the array it is given. */
+
+#define DEFAULT_PACKAGE "org.tartarus.snowball.ext"
+#define DEFAULT_BASE_CLASS "org.tartarus.snowball.SnowballProgram"
+#define DEFAULT_AMONG_CLASS "org.tartarus.snowball.Among"
+#define DEFAULT_STRING_CLASS "java.lang.StringBuilder"
+
+extern int eq(const char * s1, const char * s2) {
+    int s1_len = strlen(s1);
+    int s2_len = strlen(s2);
+    return s1_len == s2_len && memcmp(s1, s2, s1_len) == 0;
+}
+
+extern void default_options(struct options * o) {
+    o->output_file = 0;
+    o->output_c = 0;
+    o->output_h = 0;
+#ifndef DISABLE_JAVA
+    o->output_java = 0;
+#endif
+#ifndef DISABLE_PYTHON
+    o->output_python = 0;
+#endif
+    o->output_bytecode = 0;
+    o->output_report = 0;
+    o->syntax_tree = false;
+    o->optimise = false;
+    o->locals = false;
+    o->externals_prefix = "";
+    o->variables_prefix = 0;
+    o->runtime_path = 0;
+    o->parent_class_name = DEFAULT_BASE_CLASS;
+    o->string_class = DEFAULT_STRING_CLASS;
+    o->among_class = DEFAULT_AMONG_CLASS;
+    o->package = DEFAULT_PACKAGE;
+    o->name = "";
+    o->make_lang = LANG_C;
+    o->widechars = false;
+    o->hotwords_file = 0;
+    o->lines = false;
+    o->instrument = false;
+    o->report_file = 0;
+    o->profile_file = 0;
+    o->eval_file = 0;
+    o->manifest = false;
+    o->jobs = 0;
+    o->cpp_dir = 0;
+    o->java_dir = 0;
+    o->python_dir = 0;
+    o->includes = 0;
+    o->includes_end = 0;
+    o->utf8 = false;
+}
+
+/* Reads the options in argv[i] onwards into o, which default_options() has
+   set up. Returns 0, or else puts an error in error and returns 1 if the
+   options are malformed, or 2 if they don't go together. */
+extern int read_options(struct options * o, int argc, char * argv[], int i, struct str * error) {
+    char * s;
+    repeat {
+        if (i >= argc) break;
+        s = argv[i++];
+        {   if (eq(s, "-o") || eq(s, "-output")) {
+                if (i >= argc) goto one_short;
+                o->output_file = argv[i++];
+                continue;
+            }
+            if (eq(s, "-n") || eq(s, "-name")) {
+                if (i >= argc) goto one_short;
+                o->name = argv[i++];
+                continue;
+            }
+#ifndef DISABLE_JAVA
+            if (eq(s, "-j") || eq(s, "-java")) {
+                o->make_lang = LANG_JAVA;
+                o->widechars = true;
+                continue;
+            }
+#endif
+            if (eq(s, "-c++")) {
+                o->make_lang = LANG_CPLUSPLUS;
+                continue;
+            }
+            if (eq(s, "-bytecode")) {
+                o->make_lang = LANG_BYTECODE;
+                continue;
+            }
+#ifndef DISABLE_PYTHON
+            if (eq(s, "-py") || eq(s, "-python")) {
+                o->make_lang = LANG_PYTHON;
+                o->widechars = true;
+                continue;
+            }
+#endif
+            if (eq(s, "-w") || eq(s, "-widechars")) {
+                o->widechars = true;
+                o->utf8 = false;
+                continue;
+            }
+            if (eq(s, "-s") || eq(s, "-syntax")) {
+                o->syntax_tree = true;
+                continue;
+            }
+            if (eq(s, "-O")) {
+                o->optimise = true;
+                continue;
+            }
+            if (eq(s, "-l") || eq(s, "-locals")) {
+                o->locals = true;
+                continue;
+            }
+            if (eq(s, "-lines")) {
+                o->lines = true;
+                continue;
+            }
+            if (eq(s, "-instrument")) {
+                o->instrument = true;
+                continue;
+            }
+            if (eq(s, "-manifest")) {
+                o->manifest = true;
+                continue;
+            }
+            if (eq(s, "-jobs")) {
+                if (i >= argc) goto one_short;
+                o->jobs = atoi(argv[i++]);
+                continue;
+            }
+            if (eq(s, "-cppdir")) {
+                if (i >= argc) goto one_short;
+                o->cpp_dir = argv[i++];
+                continue;
+            }
+#ifndef DISABLE_JAVA
+            if (eq(s, "-javadir")) {
+                if (i >= argc) goto one_short;
+                o->java_dir = argv[i++];
+                continue;
+            }
+#endif
+#ifndef DISABLE_PYTHON
+            if (eq(s, "-pythondir")) {
+                if (i >= argc) goto one_short;
+                o->python_dir = argv[i++];
+                continue;
+            }
+#endif
+            if (eq(s, "-report")) {
+                if (i >= argc) goto one_short;
+                o->report_file = argv[i++];
+                continue;
+            }
+            if (eq(s, "-profile")) {
+                if (i >= argc) goto one_short;
+                o->profile_file = argv[i++];
+                continue;
+            }
+            if (eq(s, "-eval")) {
+                if (i >= argc) goto one_short;
+                o->eval_file = argv[i++];
+                continue;
+            }
+            if (eq(s, "-hotwords")) {
+                if (i >= argc) goto one_short;
+                o->hotwords_file = argv[i++];
+                continue;
+            }
+            if (eq(s, "-ep") || eq(s, "-eprefix")) {
+                if (i >= argc) goto one_short;
+                o->externals_prefix = argv[i++];
+                continue;
+            }
+            if (eq(s, "-vp") || eq(s, "-vprefix")) {
+                if (i >= argc) goto one_short;
+                o->variables_prefix = argv[i++];
+                continue;
+            }
+            if (eq(s, "-i") || eq(s, "-include")) {
+                if (i >= argc) goto one_short;
+
+                {
+                    NEW(include, p);
+                    symbol * b = add_s_to_b(0, argv[i++]);
+                    b = add_s_to_b(b, "/");
+                    p->next = 0; p->b = b;
+
+                    if (o->includes == 0) o->includes = p; else
+                                          o->includes_end->next = p;
+                    o->includes_end = p;
+                }
+                continue;
+            }
+            if (eq(s, "-r") || eq(s, "-runtime")) {
+                if (i >= argc) goto one_short;
+                o->runtime_path = argv[i++];
+                continue;
+            }
+            if (eq(s, "-u") || eq(s, "-utf8")) {
+                o->utf8 = true;
+                o->widechars = false;
+                continue;
+            }
+#ifndef DISABLE_JAVA
+            if (eq(s, "-p") || eq(s, "-parentclassname")) {
+                if (i >= argc) goto one_short;
+                o->parent_class_name = argv[i++];
+                continue;
+            }
+            if (eq(s, "-P") || eq(s, "-Package")) {
+                if (i >= argc) goto one_short;
+                o->package = argv[i++];
+                continue;
+            }
+            if (eq(s, "-S") || eq(s, "-stringclass")) {
+                if (i >= argc) goto one_short;
+                o->string_class = argv[i++];
+                continue;
+            }
+            if (eq(s, "-a") || eq(s, "-amongclass")) {
+                if (i >= argc) goto one_short;
+                o->among_class = argv[i++];
+                continue;
+            }
+#endif
+            str_append_ch(error, '\'');
+            str_append_string(error, s);
+            str_append_string(error, "' misplaced");
+            return 1;
+        }
+    }
+    if (o->hotwords_file && o->make_lang != LANG_C) {
+        str_append_string(error, "-hotwords is only supported for C");
+        return 2;
+    }
+    if (o->lines && o->make_lang != LANG_C) {
+        str_append_string(error, "-lines is only supported for C");
+        return 2;
+    }
+    if (o->instrument && o->make_lang != LANG_C) {
+        str_append_string(error, "-instrument is only supported for C");
+        return 2;
+    }
+    if (o->report_file && o->make_lang != LANG_C) {
+        str_append_string(error, "-report is only supported for C");
+        return 2;
+    }
+    if (o->profile_file && o->make_lang != LANG_C) {
+        str_append_string(error, "-profile is only supported for C");
+        return 2;
+    }
+    if (o->manifest && o->make_lang != LANG_C) {
+        str_append_string(error, "-manifest is only supported for C");
+        return 2;
+    }
+    if (!o->manifest && (o->cpp_dir || o->java_dir || o->python_dir)) {
+        str_append_string(error, "-cppdir, -javadir and -pythondir need -manifest");
+        return 2;
+    }
+    if (o->manifest && (o->hotwords_file || o->report_file || o->profile_file || o->eval_file)) {
+        str_append_string(error, "-manifest can't be used with -hotwords, -report, -profile or -eval");
+        return 2;
+    }
+    if (o->make_lang == LANG_BYTECODE && o->widechars) {
+        str_append_string(error, "-bytecode can't be used with -widechars");
+        return 2;
+    }
+    if (o->make_lang == LANG_CPLUSPLUS) {
+        /* the C++ generator writes out UTF-8 and wide tables itself */
+        o->widechars = true;
+        o->utf8 = false;
+        if (o->name[0] == 0) o->name = "stemmer";
+    }
+    return 0;
+one_short:
+    str_append_string(error, "argument list is one short");
+    return 1;
+}
+
+extern void lose_includes(struct options * o) {
+    struct include * p = o->includes;
+    until (p == 0) {
+        struct include * q = p->next;
+        lose_b(p->b); FREE(p); p = q;
+    }
+    o->includes = 0;
+    o->includes_end = 0;
+}
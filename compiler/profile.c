@@ -0,0 +1,96 @@
+#include <stdio.h>   /* for fprintf etc */
+#include <stdlib.h>  /* for exit, free */
+#include <string.h>  /* for strlen */
+#include "header.h"
+
+/* -profile: the counters of a training run of the stemmer compiled with
+   -instrument, as JSON from sb_stemmer_counters(). The generator takes the
+   counters in the order -instrument numbers them, so the profile must come
+   from the same program, which the version in it is checked against. */
+
+static void profile_error(struct options * o, const char * s) {
+    struct str * text = str_new();
+    str_append_string(text, "Profile ");
+    str_append_string(text, o->profile_file);
+    str_append_string(text, ": ");
+    str_append_string(text, s);
+    report(0, 0, false, text);
+    str_delete(text);
+    fatal();
+}
+
+static int skip_space(symbol * u, int i) {
+    while (i < SIZE(u) && (u[i] == ' ' || u[i] == '\t' || u[i] == '\n' || u[i] == '\r')) i++;
+    return i;
+}
+
+/* The position after the first s at or after i, or -1. */
+static int find(symbol * u, int i, const char * s) {
+    int n = strlen(s);
+    for (; i + n <= SIZE(u); i++) {
+        int j;
+        for (j = 0; j < n; j++) if (u[i + j] != s[j]) break;
+        if (j == n) return i + n;
+    }
+    return -1;
+}
+
+extern struct profile * read_profile(struct analyser * a, struct options * o) {
+    symbol * filename = add_s_to_b(0, o->profile_file);
+    char * file;
+    symbol * u = get_input(filename, &file);
+    char version[20];
+    int i;
+    NEW(profile, f);
+    lose_b(filename);
+    if (u == 0) {
+        struct str * text = str_new();
+        str_append_string(text, "Can't open profile ");
+        str_append_string(text, o->profile_file);
+        report(0, 0, false, text);
+        str_delete(text);
+        fatal();
+    }
+    free(file);
+
+    i = find(u, 0, "\"version\": \"");
+    if (i < 0) profile_error(o, "no version");
+    version_of_stemmer(a, version);
+    {   int j;
+        for (j = 0; version[j]; j++) {
+            if (i + j >= SIZE(u) || u[i + j] != version[j]) break;
+        }
+        if (version[j] != 0 || i + j >= SIZE(u) || u[i + j] != '"')
+            profile_error(o, "for another version of the program");
+    }
+
+    i = find(u, i, "\"counters\": {");
+    if (i < 0) profile_error(o, "no counters");
+    f->count = 0;
+    f->counts = (unsigned long *) MALLOC((SIZE(u) / 4 + 1) * sizeof(unsigned long));
+    repeat {
+        unsigned long n = 0;
+        i = skip_space(u, i);
+        if (i < SIZE(u) && u[i] == '}') break;
+        if (f->count > 0) {
+            unless (i < SIZE(u) && u[i] == ',') profile_error(o, "',' expected");
+            i = skip_space(u, i + 1);
+        }
+        /* the name, which only -instrument uses */
+        unless (i < SIZE(u) && u[i] == '"') profile_error(o, "name expected");
+        for (i++; i < SIZE(u) && u[i] != '"'; i++) if (u[i] == '\\') i++;
+        i = skip_space(u, i + 1);
+        unless (i < SIZE(u) && u[i] == ':') profile_error(o, "':' expected");
+        i = skip_space(u, i + 1);
+        unless (i < SIZE(u) && '0' <= u[i] && u[i] <= '9') profile_error(o, "count expected");
+        while (i < SIZE(u) && '0' <= u[i] && u[i] <= '9') n = 10 * n + (u[i++] - '0');
+        f->counts[f->count++] = n;
+    }
+    lose_b(u);
+    return f;
+}
+
+extern void lose_profile(struct profile * f) {
+    FREE(f->counts);
+    FREE(f);
+}
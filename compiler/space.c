@@ -67,8 +67,10 @@ extern void lose_b(symbol * p) {
     FREE((char *) p - HEAD);
 }
 
+/* The capacity at least doubles, so that a block built up a little at a
+   time, like the output of the generators, is copied O(log n) times. */
 extern symbol * increase_capacity(symbol * p, int n) {
-    symbol * q = create_b(CAPACITY(p) + n + EXTENDER);
+    symbol * q = create_b(2 * CAPACITY(p) + n + EXTENDER);
     memmove(q, p, CAPACITY(p) * sizeof(symbol));
     SIZE(q) = SIZE(p);
     lose_b(p); return q;
@@ -105,6 +107,88 @@ extern void check_free(void * p) {
     free(p);
 }
 
+/*  An arena hands out memory which is only freed all at once, by
+    lose_arena(). The analyser keeps the syntax tree in one, as it lives
+    until the compilation is over, so that it costs a malloc for every
+    chunk rather than for every node, and is freed however far the
+    compilation got.
+
+        struct arena * r = create_arena();
+        void * p = arena_malloc(r, n);
+            - n bytes, aligned for any type
+        symbol * b = arena_copy_b(r, b0);
+            - a copy of block b0, which must not be grown or lost
+        lose_arena(r);
+            - free all the memory handed out by r
+*/
+
+#define CHUNKSIZE 16384
+
+union align { long l; double d; void * p; };
+
+#define ALIGNED(n) (((n) + sizeof(union align) - 1) / sizeof(union align) * sizeof(union align))
+
+struct chunk {
+    struct chunk * next;
+    union align data[1];
+};
+
+struct arena {
+    struct chunk * chunks;  /* the first is the one in use */
+    char * free;            /* the unused part of it */
+    int left;
+};
+
+extern struct arena * create_arena(void) {
+    NEW(arena, r);
+    r->chunks = 0;
+    r->free = 0;
+    r->left = 0;
+    return r;
+}
+
+extern void * arena_malloc(struct arena * r, int n) {
+    char * p;
+    n = ALIGNED(n);
+    if (n > r->left) {
+        int size = n > CHUNKSIZE / 4 ? n : CHUNKSIZE;
+        struct chunk * c = (struct chunk *) MALLOC(sizeof(struct chunk) - sizeof(union align) + size);
+        if (size == n && r->chunks != 0) {
+            /* a chunk of its own, leaving the one in use as it was */
+            c->next = r->chunks->next;
+            r->chunks->next = c;
+            return c->data;
+        }
+        c->next = r->chunks;
+        r->chunks = c;
+        r->free = (char *) c->data;
+        r->left = size;
+    }
+    p = r->free;
+    r->free += n;
+    r->left -= n;
+    return p;
+}
+
+extern symbol * arena_copy_b(struct arena * r, symbol * p) {
+    int n = SIZE(p);
+    symbol * q = (symbol *) (HEAD + (char *) arena_malloc(r, HEAD + (n + 1) * sizeof(symbol)));
+    CAPACITY(q) = n;
+    SIZE(q) = n;
+    memmove(q, p, n * sizeof(symbol));
+    return q;
+}
+
+extern void lose_arena(struct arena * r) {
+    struct chunk * c = r->chunks;
+    until (c == 0) {
+        struct chunk * c_next = c->next;
+        FREE(c);
+        c = c_next;
+    }
+    FREE(r);
+}
+
 /* To convert a block to a zero terminated string:  */
 
 extern char * b_to_s(symbol * p) {
@@ -114,8 +198,13 @@ extern char * b_to_s(symbol * p) {
         int i;
         for (i = 0; i < n; i++) {
 	    if (p[i] > 255) {
-		printf("In b_to_s, can't convert p[%d] to char because it's 0x%02x\n", i, (int)p[i]);
-		exit(1);
+		struct str * text = str_new();
+		str_append_string(text, "In b_to_s, can't convert a character of ");
+		str_append_int(text, p[i]);
+		report(0, 0, false, text);
+		str_delete(text);
+		free(s);
+		fatal();
 	    }
 	    s[i] = (char)p[i];
 	}
@@ -248,6 +337,17 @@ extern int get_utf8(const symbol * p, int * slot) {
     * slot = (b0 & 0xF) << 12 | (b1 & 0x3F) << 6 | (*p & 0x3F); return 3;
 }
 
+/* Folds n symbols into a 64 bit content hash, held as two halves which are
+   FNV-1a and sdbm. The hash is started from { 2166136261, 0 }. */
+
+extern void add_to_hash(unsigned int * h, const symbol * p, int n) {
+    int i;
+    for (i = 0; i < n; i++) {
+        h[0] = (h[0] ^ p[i]) * 16777619U;
+        h[1] = p[i] + (h[1] << 6) + (h[1] << 16) - h[1];
+    }
+}
+
 extern int put_utf8(int ch, symbol * p) {
     if (ch < 0x80) {
         p[0] = ch; return 1;
@@ -41,16 +41,17 @@ extern symbol * get_input(symbol * p, char ** p_file) {
 }
 
 static void error(struct tokeniser * t, char * s1, int n, symbol * p, char * s2) {
-    if (t->error_count == 20) { fprintf(stderr, "... etc\n"); exit(1); }
-    fprintf(stderr, "%s:%d: ", t->file, t->line_number);
-    unless (s1 == 0) fprintf(stderr, "%s", s1);
+    struct str * text;
+    unless (count_error(t)) return;
+    text = str_new();
+    unless (s1 == 0) str_append_string(text, s1);
     unless (p == 0) {
         int i;
-        for (i = 0; i < n; i++) fprintf(stderr, "%c", p[i]);
+        for (i = 0; i < n; i++) str_append_ch(text, p[i]);
     }
-    unless (s2 == 0) fprintf(stderr, "%s", s2);
-    fprintf(stderr, "\n");
-    t->error_count++;
+    unless (s2 == 0) str_append_string(text, s2);
+    report(t->file, t->line_number, false, text);
+    str_delete(text);
 }
 
 static void error1(struct tokeniser * t, char * s) {
@@ -72,16 +73,45 @@ static int compare_words(int m, symbol * p, int n, const byte * q) {
     return 0;
 }
 
-static int find_word(int n, symbol * p) {
-    int i = 0; int j = vocab->code;
-    repeat {
-        int k = i + (j - i)/2;
-        const struct system_word * w = vocab + k;
-        int diff = compare_words(n, p, w->s_size, w->s);
-        if (diff == 0) return w->code;
-        if (diff < 0) j = k; else i = k;
-        if (j - i == 1) break;
+/* The keywords are found through a perfect hash, worked out on first use:
+   the multiplier of hash_word() is the first for which no two keywords
+   share a slot. */
+
+#define KEYWORD_SLOTS 512
+
+static unsigned char keyword_slot[KEYWORD_SLOTS]; /* index in vocab, or 0 for none */
+static unsigned int keyword_multiplier = 0;
+
+static unsigned int hash_word(int n, const symbol * p, unsigned int m) {
+    unsigned int h = n;
+    int i; for (i = 0; i < n; i++) h = h * m + p[i];
+    return h % KEYWORD_SLOTS;
+}
+
+static void make_keyword_slots(void) {
+    unsigned int m;
+    for (m = 1; ; m++) {
+        int i;
+        memset(keyword_slot, 0, sizeof keyword_slot);
+        for (i = 1; i < vocab->code; i++) {
+            const struct system_word * w = vocab + i;
+            symbol s[20];
+            unsigned int h;
+            int j; for (j = 0; j < w->s_size; j++) s[j] = w->s[j];
+            h = hash_word(w->s_size, s, m);
+            unless (keyword_slot[h] == 0) break;
+            keyword_slot[h] = i;
+        }
+        if (i == vocab->code) break;
     }
+    keyword_multiplier = m;
+}
+
+static int find_word(int n, symbol * p) {
+    const struct system_word * w;
+    if (keyword_multiplier == 0) make_keyword_slots();
+    w = vocab + keyword_slot[hash_word(n, p, keyword_multiplier)];
+    if (compare_words(n, p, w->s_size, w->s) == 0) return w->code;
     return -1;
 }
 
@@ -111,8 +141,20 @@ static int white_space(struct tokeniser * t, int ch) {
     return false;
 }
 
+static unsigned int hash_m(int n, symbol * p) {
+    unsigned int h[2];
+    h[0] = 2166136261U;
+    h[1] = 0;
+    add_to_hash(h, p, n);
+    return h[0];
+}
+
+static struct m_pair ** m_bucket(struct tokeniser * t, int n, symbol * p) {
+    return t->m_pairs + (hash_m(n, p) & (t->m_pairs_size - 1));
+}
+
 static symbol * find_in_m(struct tokeniser * t, int n, symbol * p) {
-    struct m_pair * q = t->m_pairs;
+    struct m_pair * q = *m_bucket(t, n, p);
     repeat {
         if (q == 0) return 0;
         {
@@ -123,6 +165,47 @@ static symbol * find_in_m(struct tokeniser * t, int n, symbol * p) {
     }
 }
 
+/* A stringdef of a name already defined replaces its value. */
+static void add_to_m(struct tokeniser * t, symbol * name, symbol * value) {
+    struct m_pair ** bucket = m_bucket(t, SIZE(name), name);
+    struct m_pair * q;
+    for (q = *bucket; q != 0; q = q->next) {
+        if (SIZE(q->name) == SIZE(name) &&
+            memcmp(q->name, name, SIZE(name) * sizeof(symbol)) == 0) {
+            lose_b(q->value);
+            q->value = copy_b(value);
+            return;
+        }
+    }
+    {   NEW(m_pair, r);
+        r->next = *bucket;
+        r->name = copy_b(name);
+        r->value = copy_b(value);
+        *bucket = r;
+    }
+    t->m_pairs_count++;
+    if (t->m_pairs_count > t->m_pairs_size) {
+        /* double the table */
+        struct m_pair ** old = t->m_pairs;
+        int old_size = t->m_pairs_size;
+        int i;
+        t->m_pairs_size *= 2;
+        t->m_pairs = (struct m_pair **) MALLOC(t->m_pairs_size * sizeof(struct m_pair *));
+        for (i = 0; i < t->m_pairs_size; i++) t->m_pairs[i] = 0;
+        for (i = 0; i < old_size; i++) {
+            q = old[i];
+            until (q == 0) {
+                struct m_pair * q_next = q->next;
+                bucket = m_bucket(t, SIZE(q->name), q->name);
+                q->next = *bucket;
+                *bucket = q;
+                q = q_next;
+            }
+        }
+        FREE(old);
+    }
+}
+
 static int read_literal_string(struct tokeniser * t, int c) {
     symbol * p = t->p;
     int ch;
@@ -340,12 +423,7 @@ extern int read_token(struct tokeniser * t) {
                    unless (code == c_literalstring)
                        { error1(t, "string omitted after stringdef"); continue; }
                    if (base > 0) convert_numeric_string(t, t->b, base);
-                   {   NEW(m_pair, q);
-                       q->next = t->m_pairs;
-                       q->name = copy_b(t->b2);
-                       q->value = copy_b(t->b);
-                       t->m_pairs = q;
-                   }
+                   add_to_m(t, t->b2, t->b);
                }
                continue;
             case c_get:
@@ -355,8 +433,8 @@ extern int read_token(struct tokeniser * t) {
                }
                t->get_depth++;
                if (t->get_depth > 10) {
-                   fprintf(stderr, "get directives go 10 deep. Looping?\n");
-                   exit(1);
+                   report_s(0, 0, false, "get directives go 10 deep. Looping?");
+                   fatal();
                }
                {
                    char * file;
@@ -375,8 +453,10 @@ extern int read_token(struct tokeniser * t) {
                    }
                    if (u == 0) {
                        error(t, "Can't get '", SIZE(t->b), t->b, "'");
-                       exit(1);
+                       FREE(q);
+                       fatal();
                    }
+                   add_to_hash(t->source_hash, u, SIZE(u));
                    memmove(q, t, sizeof(struct input));
                    t->next = q;
                    t->p = u;
@@ -435,12 +515,18 @@ extern struct tokeniser * create_tokeniser(symbol * p, char * file) {
     t->b = create_b(0);
     t->b2 = create_b(0);
     t->m_start = -1;
-    t->m_pairs = 0;
+    t->m_pairs_size = 64;
+    t->m_pairs_count = 0;
+    t->m_pairs = (struct m_pair **) MALLOC(t->m_pairs_size * sizeof(struct m_pair *));
+    {   int i; for (i = 0; i < t->m_pairs_size; i++) t->m_pairs[i] = 0; }
     t->get_depth = 0;
     t->error_count = 0;
     t->token_held = false;
     t->token = -2;
     t->previous_token = -2;
+    t->source_hash[0] = 2166136261U;
+    t->source_hash[1] = 0;
+    add_to_hash(t->source_hash, p, SIZE(p));
     return t;
 }
 
@@ -448,22 +534,26 @@ extern void close_tokeniser(struct tokeniser * t) {
     lose_b(t->b);
     lose_b(t->b2);
     {
-        struct m_pair * q = t->m_pairs;
-        until (q == 0) {
-            struct m_pair * q_next = q->next;
-            lose_b(q->name);
-            lose_b(q->value);
-            FREE(q);
-            q = q_next;
+        int i;
+        for (i = 0; i < t->m_pairs_size; i++) {
+            struct m_pair * q = t->m_pairs[i];
+            until (q == 0) {
+                struct m_pair * q_next = q->next;
+                lose_b(q->name);
+                lose_b(q->value);
+                FREE(q);
+                q = q_next;
+            }
         }
+        FREE(t->m_pairs);
     }
-    {
+    /* back out of any gets still being read, after a fatal error */
+    until (t->next == 0) {
         struct input * q = t->next;
-        until (q == 0) {
-            struct input * q_next = q->next;
-            FREE(q);
-            q = q_next;
-        }
+        lose_b(t->p);
+        free(t->file);
+        memmove(t, q, sizeof(struct input));
+        FREE(q);
     }
     free(t->file);
     FREE(t);
@@ -0,0 +1,256 @@
+/* This is a simple program which uses libstemmer to build a dictionary of
+ * precomputed stems from a vocabulary, for sb_stemmer_load_dictionary().
+ * The layout of the file is described in libstemmer/stemdict.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h> /* for malloc, free */
+#include <string.h> /* for memcmp, memcpy */
+#include <ctype.h>  /* for isupper, tolower */
+
+#include "libstemmer.h"
+#include "../libstemmer/stemdict.h"
+#include "../runtime/hotwords.h"
+
+const char * progname;
+
+static sb_symbol * blob;
+static int blob_size = 0;
+static int blob_lim = 0;
+
+static struct sb_hotword * entries;
+static int count = 0;
+static int count_lim = 0;
+
+static void *
+check_realloc(void * p, size_t n)
+{
+    p = realloc(p, n);
+    if (p == 0) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static int
+add_to_blob(const sb_symbol * p, int n)
+{
+    int offset = blob_size;
+    if (blob_size + n > blob_lim) {
+        blob_lim = 2 * blob_lim + n + 1024;
+        blob = (sb_symbol *) check_realloc(blob, blob_lim);
+    }
+    memcpy(blob + blob_size, p, n);
+    blob_size += n;
+    return offset;
+}
+
+static void
+add_word(struct sb_stemmer * stemmer, const sb_symbol * b, int i)
+{
+    const sb_symbol * stemmed = sb_stemmer_stem(stemmer, b, i);
+    struct sb_hotword * e;
+    int len;
+    if (stemmed == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    len = sb_stemmer_length(stemmer);
+    if (count == count_lim) {
+        count_lim = 2 * count_lim + 1024;
+        entries = (struct sb_hotword *) check_realloc(entries, count_lim * sizeof(struct sb_hotword));
+    }
+    e = entries + count++;
+    e->word = add_to_blob(b, i);
+    e->word_size = i;
+    if (len == i && memcmp(stemmed, b, i) == 0) {
+        e->stem = e->word;
+    } else {
+        e->stem = add_to_blob(stemmed, len);
+    }
+    e->stem_size = len;
+}
+
+/* Reads the words as stemwords does, lower casing A-Z. */
+static void
+read_file(struct sb_stemmer * stemmer, FILE * f_in)
+{
+#define INC 10
+    int lim = INC;
+    sb_symbol * b = (sb_symbol *) check_realloc(0, lim * sizeof(sb_symbol));
+
+    while(1) {
+        int ch = getc(f_in);
+        int i = 0;
+        if (ch == EOF) break;
+        while(1) {
+            if (ch == '\n' || ch == EOF) break;
+            if (i == lim) {
+                lim = lim + INC;
+                b = (sb_symbol *) check_realloc(b, lim * sizeof(sb_symbol));
+            }
+            if (isupper(ch)) ch = tolower(ch);
+            b[i++] = ch;
+            ch = getc(f_in);
+        }
+        if (i > 0) add_word(stemmer, b, i);
+    }
+    free(b);
+}
+
+static void
+write_dictionary(FILE * f_out, struct sb_stemmer * stemmer,
+		 const char * language, const char * charenc)
+{
+    struct sb_dict_header h;
+    int * d;
+    int * slot;
+
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, SB_DICT_MAGIC, 8);
+    h.version = SB_DICT_VERSION;
+    strncpy(h.algorithm, language, sizeof h.algorithm - 1);
+    strncpy(h.charenc, charenc == NULL ? "UTF_8" : charenc, sizeof h.charenc - 1);
+    strncpy(h.version_of_stemmer, sb_stemmer_version(stemmer), sizeof h.version_of_stemmer - 1);
+    h.bucket_count = SB_HOTWORD_BUCKETS(count);
+    h.slot_count = SB_HOTWORD_SLOTS(count);
+    h.blob_size = blob_size;
+
+    d = (int *) check_realloc(0, h.bucket_count * sizeof(int));
+    slot = 0;
+    while(1) {
+        slot = (int *) check_realloc(slot, 4 * h.slot_count * sizeof(int));
+        h.count = sb_place_hotwords(entries, count, blob, sizeof(sb_symbol),
+                                    h.bucket_count, h.slot_count, d, slot);
+        if (h.count >= 0) break;
+        if (h.count == -2) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        h.slot_count = SB_HOTWORD_MORE_SLOTS(h.slot_count);
+    }
+
+    if (fwrite(&h, sizeof h, 1, f_out) != 1 ||
+        fwrite(d, sizeof(int), h.bucket_count, f_out) != (size_t)h.bucket_count ||
+        fwrite(slot, 4 * sizeof(int), h.slot_count, f_out) != (size_t)h.slot_count ||
+        fwrite(blob, 1, blob_size, f_out) != (size_t)blob_size) {
+        fprintf(stderr, "error writing dictionary\n");
+        exit(1);
+    }
+    free(d);
+    free(slot);
+}
+
+/** Display the command line syntax, and then exit.
+ *  @param n The value to exit with.
+ */
+static void
+usage(int n)
+{
+    printf("usage: %s [-l <language>] [-i <input file>] -o <output file> [-c <character encoding>] [-h]\n"
+	  "\n"
+	  "The input file consists of a list of words, one per line, as for\n"
+	  "stemwords. If omitted, stdin is used. The output file is a\n"
+	  "dictionary of the words and their stems, to be loaded with\n"
+	  "sb_stemmer_load_dictionary() by a stemmer for the same language and\n"
+	  "character encoding.\n"
+	  "\n"
+	  "-h displays this help\n",
+	  progname);
+    exit(n);
+}
+
+int
+main(int argc, char * argv[])
+{
+    char * in = 0;
+    char * out = 0;
+    FILE * f_in;
+    FILE * f_out;
+    struct sb_stemmer * stemmer;
+
+    char * language = "english";
+    char * charenc = NULL;
+
+    char * s;
+    int i = 1;
+
+    progname = argv[0];
+
+    while(i < argc) {
+	s = argv[i++];
+	if (s[0] == '-') {
+	    if (strcmp(s, "-o") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		out = argv[i++];
+	    } else if (strcmp(s, "-i") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		in = argv[i++];
+	    } else if (strcmp(s, "-l") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		language = argv[i++];
+	    } else if (strcmp(s, "-c") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		charenc = argv[i++];
+	    } else if (strcmp(s, "-h") == 0) {
+		usage(0);
+	    } else {
+		fprintf(stderr, "option %s unknown\n", s);
+		usage(1);
+	    }
+	} else {
+	    fprintf(stderr, "unexpected parameter %s\n", s);
+	    usage(1);
+	}
+    }
+    if (out == 0) usage(1);
+
+    /* prepare the files */
+    f_in = (in == 0) ? stdin : fopen(in, "r");
+    if (f_in == 0) {
+	fprintf(stderr, "file %s not found\n", in);
+	exit(1);
+    }
+    f_out = fopen(out, "wb");
+    if (f_out == 0) {
+	fprintf(stderr, "file %s cannot be opened\n", out);
+	exit(1);
+    }
+
+    stemmer = sb_stemmer_new(language, charenc);
+    if (stemmer == 0) {
+        if (charenc == NULL) {
+            fprintf(stderr, "language `%s' not available for stemming\n", language);
+            exit(1);
+        } else {
+            fprintf(stderr, "language `%s' not available for stemming in encoding `%s'\n", language, charenc);
+            exit(1);
+        }
+    }
+    read_file(stemmer, f_in);
+    write_dictionary(f_out, stemmer, language, charenc);
+    sb_stemmer_delete(stemmer);
+    free(entries);
+    free(blob);
+
+    if (in != 0) (void) fclose(f_in);
+    if (fclose(f_out) != 0) {
+	fprintf(stderr, "error writing dictionary\n");
+	exit(1);
+    }
+
+    return 0;
+}
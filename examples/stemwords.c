@@ -91,7 +91,7 @@ error:
 static void
 usage(int n)
 {
-    printf("usage: %s [-l <language>] [-i <input file>] [-o <output file>] [-c <character encoding>] [-p[2]] [-h]\n"
+    printf("usage: %s [-l <language>] [-i <input file>] [-o <output file>] [-c <character encoding>] [-d <dictionary>] [-f <bytecode file>] [-counts <file>] [-p[2]] [-h]\n"
 	  "\n"
 	  "The input file consists of a list of words to be stemmed, one per\n"
 	  "line. Words should be in lower case, but (for English) A-Z letters\n"
@@ -101,6 +101,18 @@ usage(int n)
 	  "If -c is given, the argument is the character encoding of the input\n"
           "and output files.  If it is omitted, the UTF-8 encoding is used.\n"
 	  "\n"
+	  "If -d is given, the argument is a dictionary of precomputed stems\n"
+	  "built by stemdict for the same language and encoding, which is\n"
+	  "consulted before the stemming algorithm.\n"
+	  "\n"
+	  "If -f is given, the argument is an algorithm compiled by snowball\n"
+	  "-bytecode, which is used instead of -l, in the encoding it was\n"
+	  "compiled for.\n"
+	  "\n"
+	  "If -counts is given, the counters of a stemmer compiled with\n"
+	  "snowball -instrument are written to the file given as JSON, for\n"
+	  "snowball -profile.\n"
+	  "\n"
 	  "If -p is given the output file consists of each word of the input\n"
 	  "file followed by \"->\" followed by its stemmed equivalent.\n"
 	  "If -p2 is given the output file is a two column layout containing\n"
@@ -125,6 +137,9 @@ main(int argc, char * argv[])
 
     char * language = "english";
     char * charenc = NULL;
+    char * dictionary = NULL;
+    char * bytecode = NULL;
+    char * counts = NULL;
 
     char * s;
     int i = 1;
@@ -159,6 +174,24 @@ main(int argc, char * argv[])
 		    exit(1);
 		}
 		charenc = argv[i++];
+	    } else if (strcmp(s, "-d") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		dictionary = argv[i++];
+	    } else if (strcmp(s, "-f") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		bytecode = argv[i++];
+	    } else if (strcmp(s, "-counts") == 0) {
+		if (i >= argc) {
+		    fprintf(stderr, "%s requires an argument\n", s);
+		    exit(1);
+		}
+		counts = argv[i++];
 	    } else if (strcmp(s, "-p2") == 0) {
 		pretty = 2;
 	    } else if (strcmp(s, "-p") == 0) {
@@ -188,7 +221,15 @@ main(int argc, char * argv[])
     }
 
     /* do the stemming process: */
-    stemmer = sb_stemmer_new(language, charenc);
+    if (bytecode != NULL) {
+        stemmer = sb_stemmer_new_from_file(bytecode);
+        if (stemmer == 0) {
+            fprintf(stderr, "bytecode %s cannot be loaded\n", bytecode);
+            exit(1);
+        }
+    } else {
+        stemmer = sb_stemmer_new(language, charenc);
+    }
     if (stemmer == 0) {
         if (charenc == NULL) {
             fprintf(stderr, "language `%s' not available for stemming\n", language);
@@ -198,7 +239,25 @@ main(int argc, char * argv[])
             exit(1);
         }
     }
+    if (dictionary != NULL &&
+        sb_stemmer_load_dictionary(stemmer, dictionary) < 0) {
+        fprintf(stderr, "dictionary %s cannot be loaded\n", dictionary);
+        exit(1);
+    }
     stem_file(stemmer, f_in, f_out);
+    if (counts != NULL) {
+        char * json = sb_stemmer_counters(stemmer);
+        FILE * f = fopen(counts, "w");
+        if (json == NULL) {
+            fprintf(stderr, "the stemmer has no counters\n");
+            exit(1);
+        }
+        if (f == 0 || fputs(json, f) == EOF || fclose(f) != 0) {
+            fprintf(stderr, "file %s cannot be written\n", counts);
+            exit(1);
+        }
+        free(json);
+    }
     sb_stemmer_delete(stemmer);
 
     if (in != 0) (void) fclose(f_in);
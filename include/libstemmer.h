@@ -7,9 +7,6 @@ extern "C" {
 struct sb_stemmer;
 typedef unsigned char sb_symbol;
 
-/* FIXME - should be able to get a version number for each stemming
- * algorithm (which will be incremented each time the output changes). */
-
 /** Returns an array of the names of the available stemming algorithms.
  *  Note that these are the canonical names - aliases (ie, other names for
  *  the same algorithm) will not be included in the list.
@@ -30,6 +27,10 @@ const char ** sb_stemmer_list(void);
  *  language.  Note that case is significant in this parameter - the
  *  value should be supplied in lower case.
  *
+ *  Some algorithms also have cheaper variants, named by adding a suffix
+ *  such as "-light" to either form (e.g. "english-light" or "en-light"),
+ *  which do only part of the work of the full algorithm.
+ *
  *  @param charenc The character encoding.  NULL may be passed as
  *  this value, in which case UTF-8 encoding will be assumed. Otherwise,
  *  the argument may be one of "UTF_8", "ISO_8859_1" (ie, Latin 1),
@@ -45,6 +46,26 @@ const char ** sb_stemmer_list(void);
  */
 struct sb_stemmer * sb_stemmer_new(const char * algorithm, const char * charenc);
 
+/** Create a new stemmer object from an algorithm compiled with
+ *  snowball -bytecode, so that algorithms can be added or changed without
+ *  rebuilding the library.  The file is mapped read-only and run in place,
+ *  and its external "stem" is called to stem each word, in the character
+ *  encoding the algorithm was compiled for (UTF-8 with -u, and otherwise a
+ *  single byte one).  Such a stemmer is slower than a compiled one, and
+ *  can't load a dictionary or be instrumented.
+ *
+ *  The file must come from snowball: it is checked to be bytecode for this
+ *  version of the library, but a program written by hand could still loop
+ *  forever.
+ *
+ *  @return NULL if the file can't be mapped (always, where the library
+ *  was built without mmap()), isn't bytecode in this version of the
+ *  format, or has no external "stem", or if an out of memory error
+ *  occurs.  The returned pointer must be deleted by calling
+ *  sb_stemmer_delete().
+ */
+struct sb_stemmer * sb_stemmer_new_from_file(const char * path);
+
 /** Delete a stemmer object.
  *
  *  This frees all resources allocated for the stemmer.  After calling
@@ -73,6 +94,68 @@ const sb_symbol *   sb_stemmer_stem(struct sb_stemmer * stemmer,
  */
 int                 sb_stemmer_length(struct sb_stemmer * stemmer);
 
+/** Get the version of the stemming algorithm.
+ *
+ *  This is a string of 16 hex digits, worked out by the snowball compiler
+ *  from the source of the algorithm and the tables made from it.  It
+ *  changes whenever the output of the stemmer may, so stems kept from an
+ *  earlier run can be reused while it is the same.
+ *
+ *  The string is owned by the library and must not be modified or freed.
+ */
+const char *        sb_stemmer_version(struct sb_stemmer * stemmer);
+
+/** Get an upper bound on the length of the stem of a word.
+ *
+ *  The bound is size plus a constant worked out by the snowball compiler
+ *  from the string operations of the algorithm, so a buffer of this length
+ *  can be allocated once for a batch of words.  If it is no more than size,
+ *  the algorithm never lengthens a word, and the stem can be copied back
+ *  over the word in place.
+ *
+ *  @param size The length of the word, in bytes.
+ *
+ *  @return -1 if the algorithm has no such bound, as when it can replace a
+ *  character with two inside a loop.
+ */
+int                 sb_stemmer_max_length(struct sb_stemmer * stemmer, int size);
+
+/** Load a dictionary of precomputed stems, built by the stemdict example
+ *  program, which sb_stemmer_stem() will then consult before running the
+ *  algorithm.
+ *
+ *  The file is mapped read-only rather than read, so processes which load
+ *  the same dictionary share one copy of it.  It stays mapped until the
+ *  stemmer is deleted, or another dictionary is loaded.
+ *
+ *  @return 0 on success, or -1 if the file can't be mapped (always, where
+ *  the library was built without mmap()), isn't a dictionary in this
+ *  version of the format or is inconsistent, or was built for a different
+ *  algorithm, character encoding or version of the algorithm.  The stemmer is left unchanged on
+ *  failure.
+ */
+int                 sb_stemmer_load_dictionary(struct sb_stemmer * stemmer,
+					       const char * path);
+
+/** Get the counters of a stemmer whose module was compiled with
+ *  snowball -instrument, as a JSON object: "version" gives the version of
+ *  the algorithm, and "counters" maps the name of each counter to its
+ *  count.  There is a counter for the calls of each routine, for the
+ *  lookups of each among, for the strings it matched and for the cases it
+ *  went on to.  Names are ASCII, with other characters escaped as \uXXXX.
+ *
+ *  The counters belong to the module, not the stemmer, so they add up
+ *  over all the stemmers for the algorithm and encoding, and are not
+ *  updated atomically when these are used from several threads.
+ *
+ *  @return A string, to be freed by the caller with free(), or NULL if the
+ *  module wasn't instrumented or memory runs out.
+ */
+char *              sb_stemmer_counters(struct sb_stemmer * stemmer);
+
+/** Set the counters of sb_stemmer_counters() back to zero. */
+void                sb_stemmer_reset_counters(struct sb_stemmer * stemmer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,65 @@
+
+/* Make header file work when included from C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/** An error or warning from the compiler. */
+struct sb_compiler_message {
+    char * file;        /* the source file it is about, or NULL */
+    int line;           /* the line it is about, or 0 for the whole file */
+    int warning;        /* 1 for a warning, 0 for an error */
+    char * text;
+};
+
+/** A file the compiler would have written. */
+struct sb_compiler_output {
+    const char * suffix; /* ".c", ".h", ".hpp", ".java", ".py" or ".sbc" */
+    char * data;
+    size_t size;
+};
+
+struct sb_compiler_result {
+    int ok;             /* 1 if the outputs were made */
+    int output_count;
+    struct sb_compiler_output * outputs;
+    int message_count;
+    struct sb_compiler_message * messages;
+};
+
+/** Compile a Snowball program held in memory, as the snowball command
+ *  would, but with the files it would write given back in memory, and its
+ *  errors and warnings given back as records rather than written to
+ *  stderr.
+ *
+ *  @param source The text of the program, of size bytes.  Any 'get'
+ *  directives in it are read from files, as by the command.
+ *
+ *  @param file The name of the source, for messages.  The outputs are
+ *  named by it with .sbl taken off, for the #line directives of -lines,
+ *  unless "-o" is given.
+ *
+ *  @param options The options of the command, as a NULL terminated array
+ *  of strings, such as { "-u", "-O", NULL }, or NULL for none.  -syntax,
+ *  -hotwords, -report, -profile, -manifest and -eval can't be used here.
+ *
+ *  @return A result, to be freed with sb_compiler_result_delete(), whose
+ *  ok field is 0 if the options or the program had errors, in which case
+ *  there are no outputs.  NULL is returned if memory runs out.
+ *
+ *  @note The compiler keeps some of its state in globals, so only one
+ *  call may be running at a time.
+ */
+struct sb_compiler_result * sb_compile(const char * source, size_t size,
+                                       const char * file,
+                                       const char * const * options);
+
+/** Free a result of sb_compile().  It is safe to pass a null pointer. */
+void sb_compiler_result_delete(struct sb_compiler_result * result);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -1,6 +1,5 @@
 
 package org.tartarus.snowball;
-import java.lang.reflect.InvocationTargetException;
 
 public class SnowballProgram {
     protected SnowballProgram()
@@ -178,6 +177,13 @@ public class SnowballProgram {
     {   return eq_s_b(s.length(), s.toString());
     }
 
+    /* Returns the result of the longest string of v matching at the
+     * cursor, with the cursor after it, or 0 if none does. A result is
+     * positive, or -1 for a string followed by (). If that string has a
+     * routine, it returns -2 - i instead, i being the index of the string:
+     * the stemmer calls the routine, puts the cursor back, and then calls
+     * find_among_next().
+     */
     protected int find_among(Among v[], int v_size)
     {
 	int i = 0;
@@ -229,21 +235,7 @@ public class SnowballProgram {
 	    Among w = v[i];
 	    if (common_i >= w.s_size) {
 		cursor = c + w.s_size;
-		if (w.method == null) return w.result;
-		boolean res;
-		try {
-		    Object resobj = w.method.invoke(w.methodobject,
-						    new Object[0]);
-		    res = resobj.toString().equals("true");
-		} catch (InvocationTargetException e) {
-		    res = false;
-		    // FIXME - debug message
-		} catch (IllegalAccessException e) {
-		    res = false;
-		    // FIXME - debug message
-		}
-		cursor = c + w.s_size;
-		if (res) return w.result;
+		return w.function == 0 ? w.result : -2 - i;
 	    }
 	    i = w.substring_i;
 	    if (i < 0) return 0;
@@ -297,28 +289,38 @@ public class SnowballProgram {
 	    Among w = v[i];
 	    if (common_i >= w.s_size) {
 		cursor = c - w.s_size;
-		if (w.method == null) return w.result;
-
-		boolean res;
-		try {
-		    Object resobj = w.method.invoke(w.methodobject,
-						    new Object[0]);
-		    res = resobj.toString().equals("true");
-		} catch (InvocationTargetException e) {
-		    res = false;
-		    // FIXME - debug message
-		} catch (IllegalAccessException e) {
-		    res = false;
-		    // FIXME - debug message
-		}
-		cursor = c - w.s_size;
-		if (res) return w.result;
+		return w.function == 0 ? w.result : -2 - i;
 	    }
 	    i = w.substring_i;
 	    if (i < 0) return 0;
 	}
     }
 
+    /* Goes on from string i of v, whose routine returned ret, with the
+     * cursor after the string. The strings it goes on to are shorter ones
+     * which begin it (end it, for find_among_next_b()), and so match too.
+     * Returns as find_among().
+     */
+    protected int find_among_next(Among v[], int i, boolean ret)
+    {
+	int c = cursor - v[i].s_size;
+	if (ret) return v[i].result;
+	i = v[i].substring_i;
+	if (i < 0) return 0;
+	cursor = c + v[i].s_size;
+	return v[i].function == 0 ? v[i].result : -2 - i;
+    }
+
+    protected int find_among_next_b(Among v[], int i, boolean ret)
+    {
+	int c = cursor + v[i].s_size;
+	if (ret) return v[i].result;
+	i = v[i].substring_i;
+	if (i < 0) return 0;
+	cursor = c - v[i].s_size;
+	return v[i].function == 0 ? v[i].result : -2 - i;
+    }
+
     /* to replace chars between c_bra and c_ket in current by the
      * chars in s.
      */
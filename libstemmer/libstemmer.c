@@ -0,0 +1,440 @@
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Dictionaries and bytecode files are mapped with mmap(): elsewhere
+ * sb_stemmer_load_dictionary() and sb_stemmer_new_from_file() just fail.
+ * Define SB_HAVE_MMAP as 0 or 1 to override the guess. */
+#ifndef SB_HAVE_MMAP
+#if defined __unix__ || defined __APPLE__
+#define SB_HAVE_MMAP 1
+#else
+#define SB_HAVE_MMAP 0
+#endif
+#endif
+
+#if SB_HAVE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "../include/libstemmer.h"
+#include "../runtime/header.h"
+#include "../runtime/bytecode.h"
+#include "stemdict.h"
+#include "modules.h"
+
+struct sb_stemmer {
+    struct SN_env * (*create)(void);
+    void (*close)(struct SN_env *);
+    int (*stem)(struct SN_env *);
+    const char * (*version)(void);
+    int max_growth;
+    int (*counters)(const char * const **, unsigned long **);
+    const char * charenc;       /* as in encodings[] */
+
+    struct SN_env * env;
+
+    /* from sb_stemmer_load_dictionary(): */
+    void * dict_map;
+    size_t dict_size;
+    struct hotwords dict;
+
+    /* from sb_stemmer_new_from_file(): */
+    void * program_map;
+    size_t program_size;
+    struct sb_bc_program program;
+    int program_node;           /* of the external "stem" */
+};
+
+extern const char **
+sb_stemmer_list(void)
+{
+    return algorithm_names;
+}
+
+static stemmer_encoding_t
+sb_getenc(const char * charenc)
+{
+    struct stemmer_encoding * encoding;
+    if (charenc == NULL) return ENC_UTF_8;
+    for (encoding = encodings; encoding->name != 0; encoding++) {
+	if (strcmp(encoding->name, charenc) == 0) break;
+    }
+    if (encoding->name == NULL) return ENC_UNKNOWN;
+    return encoding->enc;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new(const char * algorithm, const char * charenc)
+{
+    stemmer_encoding_t enc;
+    struct stemmer_encoding * encoding;
+    struct stemmer_modules * module;
+    struct sb_stemmer * stemmer;
+
+    enc = sb_getenc(charenc);
+    if (enc == ENC_UNKNOWN) return NULL;
+
+    for (module = modules; module->name != 0; module++) {
+	if (strcmp(module->name, algorithm) == 0 && module->enc == enc) break;
+    }
+    if (module->name == NULL) return NULL;
+    
+    stemmer = (struct sb_stemmer *) malloc(sizeof(struct sb_stemmer));
+    if (stemmer == NULL) return NULL;
+
+    stemmer->create = module->create;
+    stemmer->close = module->close;
+    stemmer->stem = module->stem;
+    stemmer->version = module->version;
+    stemmer->max_growth = module->max_growth;
+    stemmer->counters = module->counters;
+    for (encoding = encodings; encoding->enc != enc; encoding++) ;
+    stemmer->charenc = encoding->name;
+    stemmer->dict_map = NULL;
+    stemmer->program_map = NULL;
+
+    stemmer->env = stemmer->create();
+    if (stemmer->env == NULL)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+
+    return stemmer;
+}
+
+/* Unmaps what map_file() mapped. */
+static void
+unmap(void * map, size_t size)
+{
+#if SB_HAVE_MMAP
+    munmap(map, size);
+#else
+    (void) map; (void) size;
+#endif
+}
+
+void
+sb_stemmer_delete(struct sb_stemmer * stemmer)
+{
+    if (stemmer == 0) return;
+    if (stemmer->program_map) {
+        SN_close_env(stemmer->env, stemmer->program.h->strings);
+        unmap(stemmer->program_map, stemmer->program_size);
+        free(stemmer);
+        return;
+    }
+    if (stemmer->close == 0) return;
+    if (stemmer->dict_map) unmap(stemmer->dict_map, stemmer->dict_size);
+    stemmer->close(stemmer->env);
+    stemmer->close = 0;
+    free(stemmer);
+}
+
+const sb_symbol *
+sb_stemmer_stem(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    int ret;
+    if (SN_set_current(stemmer->env, size, (const symbol *)(word)))
+    {
+        stemmer->env->l = 0;
+        return NULL;
+    }
+    ret = stemmer->dict_map ? find_hotword(stemmer->env, &stemmer->dict) : 0;
+    if (ret == 0) ret = stemmer->program_map ?
+        run_bytecode(stemmer->env, &stemmer->program, stemmer->program_node) :
+        stemmer->stem(stemmer->env);
+    if (ret < 0) return NULL;
+    stemmer->env->p[stemmer->env->l] = 0;
+    return (const sb_symbol *)(stemmer->env->p);
+}
+
+int
+sb_stemmer_length(struct sb_stemmer * stemmer)
+{
+    return stemmer->env->l;
+}
+
+const char *
+sb_stemmer_version(struct sb_stemmer * stemmer)
+{
+    if (stemmer->program_map) return stemmer->program.h->version_of_stemmer;
+    return stemmer->version();
+}
+
+int
+sb_stemmer_max_length(struct sb_stemmer * stemmer, int size)
+{
+    if (stemmer->max_growth < 0 || size > INT_MAX - stemmer->max_growth) return -1;
+    return size + stemmer->max_growth;
+}
+
+/* The characters from 0xA0 up of ISO-8859-2, and from 0x80 up of KOI8-R. */
+static const unsigned short iso_8859_2[96] = {
+    0x00A0, 0x0104, 0x02D8, 0x0141, 0x00A4, 0x013D, 0x015A, 0x00A7,
+    0x00A8, 0x0160, 0x015E, 0x0164, 0x0179, 0x00AD, 0x017D, 0x017B,
+    0x00B0, 0x0105, 0x02DB, 0x0142, 0x00B4, 0x013E, 0x015B, 0x02C7,
+    0x00B8, 0x0161, 0x015F, 0x0165, 0x017A, 0x02DD, 0x017E, 0x017C,
+    0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7,
+    0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+    0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7,
+    0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+    0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7,
+    0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+    0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7,
+    0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9
+};
+
+static const unsigned short koi8_r[128] = {
+    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
+    0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590,
+    0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248,
+    0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7,
+    0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+    0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E,
+    0x255F, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+    0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x00A9,
+    0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+    0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+    0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+    0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+    0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+    0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+    0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+    0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A
+};
+
+/* Decodes the character at *s, which is at least 0x80, in the encoding
+ * charenc, and moves *s past it. Returns 0xFFFD for a bad UTF-8 sequence;
+ * any other single byte encoding is taken to be ISO-8859-1. */
+static long
+decode_char(const char * charenc, const unsigned char ** s)
+{
+    const unsigned char * q = *s;
+    long ch = *q++;
+    if (strcmp(charenc, "UTF_8") == 0) {
+        int extra = ch >= 0xF0 ? 3 : ch >= 0xE0 ? 2 : ch >= 0xC0 ? 1 : 0;
+        if (extra == 0 || ch >= 0xF8) {
+            ch = 0xFFFD;
+        } else {
+            ch &= 0x3F >> extra;
+            for (; extra > 0; extra--, q++) {
+                if ((*q & 0xC0) != 0x80) { ch = 0xFFFD; break; }
+                ch = ch << 6 | (*q & 0x3F);
+            }
+        }
+    } else if (strcmp(charenc, "ISO_8859_2") == 0) {
+        if (ch >= 0xA0) ch = iso_8859_2[ch - 0xA0];
+    } else if (strcmp(charenc, "KOI8_R") == 0) {
+        ch = koi8_r[ch - 0x80];
+    }
+    *s = q;
+    return ch;
+}
+
+/* Writes s, in the encoding charenc, as a JSON string to p, if p isn't
+ * NULL, and returns its length. Only ASCII is written: other characters
+ * are escaped as \\uXXXX, by surrogate pairs beyond 0xFFFF. */
+static size_t
+json_string(char * p, const char * s, const char * charenc)
+{
+    const unsigned char * q = (const unsigned char *) s;
+    size_t n = 0;
+    while (*q) {
+        long ch = *q;
+        char e[32];
+        if (ch >= 0x80) {
+            ch = decode_char(charenc, &q);
+            if (ch > 0xFFFF) {
+                ch -= 0x10000;
+                sprintf(e, "\\u%04lx\\u%04lx", 0xD800 + (ch >> 10), 0xDC00 + (ch & 0x3FF));
+            } else {
+                sprintf(e, "\\u%04lx", ch);
+            }
+        } else {
+            q++;
+            if (ch < 0x20) {
+                sprintf(e, "\\u%04lx", ch);
+            } else if (ch == '"' || ch == '\\') {
+                e[0] = '\\'; e[1] = ch; e[2] = 0;
+            } else {
+                e[0] = ch; e[1] = 0;
+            }
+        }
+        if (p) memcpy(p + n, e, strlen(e));
+        n += strlen(e);
+    }
+    return n;
+}
+
+/* Writes the JSON of sb_stemmer_counters() to p, if p isn't NULL, and
+ * returns its length. */
+static size_t
+json_counters(char * p, struct sb_stemmer * stemmer)
+{
+    const char * const * names;
+    unsigned long * counts;
+    int count = stemmer->counters(&names, &counts);
+    size_t n = 0;
+    char s[32];
+    int i;
+#define PUT(S) do { const char * s_ = (S); \
+                    if (p) memcpy(p + n, s_, strlen(s_)); \
+                    n += strlen(s_); } while (0)
+    PUT("{\"version\": \"");
+    PUT(stemmer->version());
+    PUT("\", \"counters\": {");
+    for (i = 0; i < count; i++) {
+        PUT(i == 0 ? "\n  \"" : ",\n  \"");
+        n += json_string(p ? p + n : NULL, names[i], stemmer->charenc);
+        sprintf(s, "\": %lu", counts[i]);
+        PUT(s);
+    }
+    PUT("\n}}\n");
+#undef PUT
+    return n;
+}
+
+char *
+sb_stemmer_counters(struct sb_stemmer * stemmer)
+{
+    char * p;
+    size_t n;
+    if (stemmer->counters == 0) return NULL;
+    n = json_counters(NULL, stemmer);
+    p = (char *) malloc(n + 1);
+    if (p == NULL) return NULL;
+    json_counters(p, stemmer);
+    p[n] = 0;
+    return p;
+}
+
+void
+sb_stemmer_reset_counters(struct sb_stemmer * stemmer)
+{
+    const char * const * names;
+    unsigned long * counts;
+    int count;
+    if (stemmer->counters == 0) return;
+    count = stemmer->counters(&names, &counts);
+    memset(counts, 0, count * sizeof(unsigned long));
+}
+
+/* Maps the file at path read-only, setting *size, if it is at least
+ * min_size bytes long. Returns NULL on failure, or if mmap() isn't
+ * available. */
+static void *
+map_file(const char * path, size_t min_size, size_t * size)
+{
+#if SB_HAVE_MMAP
+    struct stat st;
+    void * map;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    if (fstat(fd, &st) < 0 || st.st_size == 0 || (size_t)st.st_size < min_size) {
+        close(fd);
+        return NULL;
+    }
+    *size = st.st_size;
+    map = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return map == MAP_FAILED ? NULL : map;
+#else
+    (void) path; (void) min_size; (void) size;
+    return NULL;
+#endif
+}
+
+int
+sb_stemmer_load_dictionary(struct sb_stemmer * stemmer, const char * path)
+{
+    const struct sb_dict_header * h;
+    struct stemmer_modules * module;
+    struct hotwords dict;
+    size_t size;
+    void * map = map_file(path, sizeof(struct sb_dict_header), &size);
+    if (map == NULL) return -1;
+
+    h = (const struct sb_dict_header *) map;
+    if (memcmp(h->magic, SB_DICT_MAGIC, 8) != 0 ||
+        h->version != SB_DICT_VERSION ||
+        h->bucket_count <= 0 || h->slot_count <= 0 || h->blob_size < 0 ||
+        size != sizeof(struct sb_dict_header) +
+                (h->bucket_count + 4 * (size_t)h->slot_count) * sizeof(int) +
+                h->blob_size) goto error;
+    dict.bucket_count = h->bucket_count;
+    dict.slot_count = h->slot_count;
+    dict.d = (const int *) (h + 1);
+    dict.slot = dict.d + h->bucket_count;
+    dict.s = (const symbol *) (dict.slot + 4 * h->slot_count);
+    if (check_hotwords(&dict, h->blob_size / sizeof(symbol)) < 0) goto error;
+
+    /* the dictionary must be for the algorithm and encoding in use */
+    if (memchr(h->algorithm, 0, sizeof h->algorithm) == NULL ||
+        memchr(h->charenc, 0, sizeof h->charenc) == NULL) goto error;
+    for (module = modules; module->name != 0; module++) {
+        if (strcmp(module->name, h->algorithm) == 0 &&
+            module->enc == sb_getenc(h->charenc)) break;
+    }
+    if (module->name == NULL || module->stem != stemmer->stem) goto error;
+    if (strncmp(h->version_of_stemmer, stemmer->version(),
+                sizeof h->version_of_stemmer) != 0) goto error;
+
+    if (stemmer->dict_map) unmap(stemmer->dict_map, stemmer->dict_size);
+    stemmer->dict_map = map;
+    stemmer->dict_size = size;
+    stemmer->dict = dict;
+    return 0;
+
+error:
+    unmap(map, size);
+    return -1;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new_from_file(const char * path)
+{
+    struct sb_stemmer * stemmer;
+    const struct sb_bc_external * e;
+    size_t size;
+    int i;
+    void * map = map_file(path, 1, &size);
+    if (map == NULL) return NULL;
+
+    stemmer = (struct sb_stemmer *) malloc(sizeof(struct sb_stemmer));
+    if (stemmer == NULL) goto error;
+    if (bytecode_open(&stemmer->program, map, size) < 0) goto error;
+    i = bytecode_external(&stemmer->program, "stem");
+    if (i < 0) goto error;
+    e = stemmer->program.externals + i;
+
+    stemmer->create = 0;
+    stemmer->close = 0;
+    stemmer->stem = 0;
+    stemmer->version = 0;
+    stemmer->max_growth = e->max_growth;
+    stemmer->counters = 0;
+    stemmer->charenc = NULL;
+    stemmer->dict_map = NULL;
+    stemmer->program_map = map;
+    stemmer->program_size = size;
+    stemmer->program_node = e->node;
+    stemmer->env = SN_create_env(stemmer->program.h->strings,
+                                 stemmer->program.h->integers,
+                                 stemmer->program.h->booleans);
+    if (stemmer->env == NULL) {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+    return stemmer;
+
+error:
+    free(stemmer);
+    unmap(map, size);
+    return NULL;
+}
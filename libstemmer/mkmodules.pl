@@ -22,20 +22,43 @@ if (@ARGV) {
 my %aliases = ();
 my %algorithms = ();
 my %algorithm_encs = ();
+my %base_encs = ();
 
 my %encs = ();
 
-sub addalgenc($$) {
+# A variant <algorithm>-<variant> is the external stem_<variant> of the
+# algorithm, sharing its source file.
+sub base($) {
+  my $alg = shift();
+  $alg =~ s/-.*//;
+  return $alg;
+}
+
+sub stem_function($) {
   my $alg = shift();
+  return $alg =~ m/-(.*)/ ? "stem_$1" : 'stem';
+}
+
+sub addtohash($$$) {
+  my $hash = shift();
+  my $key = shift();
   my $enc = shift();
 
-  if (defined $algorithm_encs{$alg}) {
-      my $hashref = $algorithm_encs{$alg};
+  if (defined $$hash{$key}) {
+      my $hashref = $$hash{$key};
       $$hashref{$enc}=1;
   } else {
       my %newhash = ($enc => 1);
-      $algorithm_encs{$alg}=\%newhash;
+      $$hash{$key}=\%newhash;
   }
+}
+
+sub addalgenc($$) {
+  my $alg = shift();
+  my $enc = shift();
+
+  addtohash(\%algorithm_encs, $alg, $enc);
+  addtohash(\%base_encs, base($alg), $enc);
 
   $encs{$enc} = 1;
 }
@@ -99,13 +122,23 @@ EOS
     }
     print OUT "\n */\n\n";
 
-    foreach $lang (@algorithms) {
-        my $hashref = $algorithm_encs{$lang};
+    foreach $lang (sort keys %base_encs) {
+        my $hashref = $base_encs{$lang};
         foreach $enc (sort keys (%$hashref)) {
             print OUT "#include \"../$c_src_dir/stem_${enc}_$lang.h\"\n";
         }
     }
 
+    # Modules compiled with snowball -instrument define ${p}_counters.
+    print OUT "\n";
+    foreach $lang (sort keys %base_encs) {
+        my $hashref = $base_encs{$lang};
+        foreach $enc (sort keys (%$hashref)) {
+            my $p = "${lang}_${enc}";
+            print OUT "#ifndef ${p}_counters\n#define ${p}_counters 0\n#endif\n";
+        }
+    }
+
     print OUT <<EOS;
 
 typedef enum {
@@ -140,6 +173,9 @@ struct stemmer_modules {
   struct SN_env * (*create)(void);
   void (*close)(struct SN_env *);
   int (*stem)(struct SN_env *);
+  const char * (*version)(void);
+  int max_growth;
+  int (*counters)(const char * const **, unsigned long **);
 };
 static struct stemmer_modules modules[] = {
 EOS
@@ -148,14 +184,15 @@ EOS
         my $l = $aliases{$lang};
         my $hashref = $algorithm_encs{$l};
         my $enc;
+        my $stem = stem_function($l);
         foreach $enc (sort keys (%$hashref)) {
-            my $p = "${l}_${enc}";
-            print OUT "  {\"$lang\", ENC_$enc, ${p}_create_env, ${p}_close_env, ${p}_stem},\n";
+            my $p = base($l)."_${enc}";
+            print OUT "  {\"$lang\", ENC_$enc, ${p}_create_env, ${p}_close_env, ${p}_${stem}, ${p}_version, ${p}_${stem}_max_growth, ${p}_counters},\n";
         }
     }
 
     print OUT <<EOS;
-  {0,ENC_UNKNOWN,0,0,0}
+  {0,ENC_UNKNOWN,0,0,0,0,0,0}
 };
 EOS
 
@@ -164,7 +201,6 @@ static const char * algorithm_names[] = {
 EOS
 
     for $lang (@algorithms) {
-        my $l = $aliases{$lang};
         print OUT "  \"$lang\", \n";
     }
 
@@ -212,8 +248,8 @@ EOS
     }
 
     print OUT "\n\nsnowball_sources= \\\n";
-    for $lang (sort keys %aliases) {
-        my $hashref = $algorithm_encs{$lang};
+    for $lang (sort keys %base_encs) {
+        my $hashref = $base_encs{$lang};
         my $enc;
         foreach $enc (sort keys (%$hashref)) {
             print OUT "  src_c/stem_${enc}_${lang}.c \\\n";
@@ -223,6 +259,8 @@ EOS
     $need_sep = 0;
     for $srcfile ('runtime/api.c',
                   'runtime/utilities.c',
+                  'runtime/bytecode.c',
+                  'runtime/hotwords.c',
                   "libstemmer/libstemmer${extn}.c") {
         print OUT " \\\n" if $need_sep;
         print OUT "  $srcfile";
@@ -230,11 +268,10 @@ EOS
     }
 
     print OUT "\n\nsnowball_headers= \\\n";
-    for $lang (sort keys %aliases) {
-        my $hashref = $algorithm_encs{$lang};
+    for $lang (sort keys %base_encs) {
+        my $hashref = $base_encs{$lang};
         my $enc;
         foreach $enc (sort keys (%$hashref)) {
-            my $p = "${lang}_${enc}";
             print OUT "  src_c/stem_${enc}_${lang}.h \\\n";
         }
     }
@@ -243,7 +280,9 @@ EOS
     for $srcfile ('include/libstemmer.h',
                   "libstemmer/modules${extn}.h",
                   'runtime/api.h',
-                  'runtime/header.h') {
+                  'runtime/header.h',
+                  'runtime/bytecode.h',
+                  'runtime/hotwords.h') {
         print OUT " \\\n" if $need_sep;
         print OUT "  $srcfile";
         $need_sep = 1;
@@ -0,0 +1,292 @@
+/* libstemmer/modules.h: List of stemming modules.
+ *
+ * This file is generated by mkmodules.pl from a list of module names.
+ * Do not edit manually.
+ *
+ * Modules included by this file are: danish, dutch, english, english-light,
+ * finnish, french, german, hungarian, italian, norwegian, porter, portuguese,
+ * romanian, russian, spanish, swedish, turkish
+ */
+
+#include "../src_c/stem_ISO_8859_1_danish.h"
+#include "../src_c/stem_UTF_8_danish.h"
+#include "../src_c/stem_ISO_8859_1_dutch.h"
+#include "../src_c/stem_UTF_8_dutch.h"
+#include "../src_c/stem_ISO_8859_1_english.h"
+#include "../src_c/stem_UTF_8_english.h"
+#include "../src_c/stem_ISO_8859_1_finnish.h"
+#include "../src_c/stem_UTF_8_finnish.h"
+#include "../src_c/stem_ISO_8859_1_french.h"
+#include "../src_c/stem_UTF_8_french.h"
+#include "../src_c/stem_ISO_8859_1_german.h"
+#include "../src_c/stem_UTF_8_german.h"
+#include "../src_c/stem_ISO_8859_2_hungarian.h"
+#include "../src_c/stem_UTF_8_hungarian.h"
+#include "../src_c/stem_ISO_8859_1_italian.h"
+#include "../src_c/stem_UTF_8_italian.h"
+#include "../src_c/stem_ISO_8859_1_norwegian.h"
+#include "../src_c/stem_UTF_8_norwegian.h"
+#include "../src_c/stem_ISO_8859_1_porter.h"
+#include "../src_c/stem_UTF_8_porter.h"
+#include "../src_c/stem_ISO_8859_1_portuguese.h"
+#include "../src_c/stem_UTF_8_portuguese.h"
+#include "../src_c/stem_ISO_8859_2_romanian.h"
+#include "../src_c/stem_UTF_8_romanian.h"
+#include "../src_c/stem_KOI8_R_russian.h"
+#include "../src_c/stem_UTF_8_russian.h"
+#include "../src_c/stem_ISO_8859_1_spanish.h"
+#include "../src_c/stem_UTF_8_spanish.h"
+#include "../src_c/stem_ISO_8859_1_swedish.h"
+#include "../src_c/stem_UTF_8_swedish.h"
+#include "../src_c/stem_UTF_8_turkish.h"
+
+#ifndef danish_ISO_8859_1_counters
+#define danish_ISO_8859_1_counters 0
+#endif
+#ifndef danish_UTF_8_counters
+#define danish_UTF_8_counters 0
+#endif
+#ifndef dutch_ISO_8859_1_counters
+#define dutch_ISO_8859_1_counters 0
+#endif
+#ifndef dutch_UTF_8_counters
+#define dutch_UTF_8_counters 0
+#endif
+#ifndef english_ISO_8859_1_counters
+#define english_ISO_8859_1_counters 0
+#endif
+#ifndef english_UTF_8_counters
+#define english_UTF_8_counters 0
+#endif
+#ifndef finnish_ISO_8859_1_counters
+#define finnish_ISO_8859_1_counters 0
+#endif
+#ifndef finnish_UTF_8_counters
+#define finnish_UTF_8_counters 0
+#endif
+#ifndef french_ISO_8859_1_counters
+#define french_ISO_8859_1_counters 0
+#endif
+#ifndef french_UTF_8_counters
+#define french_UTF_8_counters 0
+#endif
+#ifndef german_ISO_8859_1_counters
+#define german_ISO_8859_1_counters 0
+#endif
+#ifndef german_UTF_8_counters
+#define german_UTF_8_counters 0
+#endif
+#ifndef hungarian_ISO_8859_2_counters
+#define hungarian_ISO_8859_2_counters 0
+#endif
+#ifndef hungarian_UTF_8_counters
+#define hungarian_UTF_8_counters 0
+#endif
+#ifndef italian_ISO_8859_1_counters
+#define italian_ISO_8859_1_counters 0
+#endif
+#ifndef italian_UTF_8_counters
+#define italian_UTF_8_counters 0
+#endif
+#ifndef norwegian_ISO_8859_1_counters
+#define norwegian_ISO_8859_1_counters 0
+#endif
+#ifndef norwegian_UTF_8_counters
+#define norwegian_UTF_8_counters 0
+#endif
+#ifndef porter_ISO_8859_1_counters
+#define porter_ISO_8859_1_counters 0
+#endif
+#ifndef porter_UTF_8_counters
+#define porter_UTF_8_counters 0
+#endif
+#ifndef portuguese_ISO_8859_1_counters
+#define portuguese_ISO_8859_1_counters 0
+#endif
+#ifndef portuguese_UTF_8_counters
+#define portuguese_UTF_8_counters 0
+#endif
+#ifndef romanian_ISO_8859_2_counters
+#define romanian_ISO_8859_2_counters 0
+#endif
+#ifndef romanian_UTF_8_counters
+#define romanian_UTF_8_counters 0
+#endif
+#ifndef russian_KOI8_R_counters
+#define russian_KOI8_R_counters 0
+#endif
+#ifndef russian_UTF_8_counters
+#define russian_UTF_8_counters 0
+#endif
+#ifndef spanish_ISO_8859_1_counters
+#define spanish_ISO_8859_1_counters 0
+#endif
+#ifndef spanish_UTF_8_counters
+#define spanish_UTF_8_counters 0
+#endif
+#ifndef swedish_ISO_8859_1_counters
+#define swedish_ISO_8859_1_counters 0
+#endif
+#ifndef swedish_UTF_8_counters
+#define swedish_UTF_8_counters 0
+#endif
+#ifndef turkish_UTF_8_counters
+#define turkish_UTF_8_counters 0
+#endif
+
+typedef enum {
+  ENC_UNKNOWN=0,
+  ENC_ISO_8859_1,
+  ENC_ISO_8859_2,
+  ENC_KOI8_R,
+  ENC_UTF_8
+} stemmer_encoding_t;
+
+struct stemmer_encoding {
+  const char * name;
+  stemmer_encoding_t enc;
+};
+static struct stemmer_encoding encodings[] = {
+  {"ISO_8859_1", ENC_ISO_8859_1},
+  {"ISO_8859_2", ENC_ISO_8859_2},
+  {"KOI8_R", ENC_KOI8_R},
+  {"UTF_8", ENC_UTF_8},
+  {0,ENC_UNKNOWN}
+};
+
+struct stemmer_modules {
+  const char * name;
+  stemmer_encoding_t enc; 
+  struct SN_env * (*create)(void);
+  void (*close)(struct SN_env *);
+  int (*stem)(struct SN_env *);
+  const char * (*version)(void);
+  int max_growth;
+  int (*counters)(const char * const **, unsigned long **);
+};
+static struct stemmer_modules modules[] = {
+  {"da", ENC_ISO_8859_1, danish_ISO_8859_1_create_env, danish_ISO_8859_1_close_env, danish_ISO_8859_1_stem, danish_ISO_8859_1_version, danish_ISO_8859_1_stem_max_growth, danish_ISO_8859_1_counters},
+  {"da", ENC_UTF_8, danish_UTF_8_create_env, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_version, danish_UTF_8_stem_max_growth, danish_UTF_8_counters},
+  {"dan", ENC_ISO_8859_1, danish_ISO_8859_1_create_env, danish_ISO_8859_1_close_env, danish_ISO_8859_1_stem, danish_ISO_8859_1_version, danish_ISO_8859_1_stem_max_growth, danish_ISO_8859_1_counters},
+  {"dan", ENC_UTF_8, danish_UTF_8_create_env, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_version, danish_UTF_8_stem_max_growth, danish_UTF_8_counters},
+  {"danish", ENC_ISO_8859_1, danish_ISO_8859_1_create_env, danish_ISO_8859_1_close_env, danish_ISO_8859_1_stem, danish_ISO_8859_1_version, danish_ISO_8859_1_stem_max_growth, danish_ISO_8859_1_counters},
+  {"danish", ENC_UTF_8, danish_UTF_8_create_env, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_version, danish_UTF_8_stem_max_growth, danish_UTF_8_counters},
+  {"de", ENC_ISO_8859_1, german_ISO_8859_1_create_env, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, german_ISO_8859_1_version, german_ISO_8859_1_stem_max_growth, german_ISO_8859_1_counters},
+  {"de", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_version, german_UTF_8_stem_max_growth, german_UTF_8_counters},
+  {"deu", ENC_ISO_8859_1, german_ISO_8859_1_create_env, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, german_ISO_8859_1_version, german_ISO_8859_1_stem_max_growth, german_ISO_8859_1_counters},
+  {"deu", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_version, german_UTF_8_stem_max_growth, german_UTF_8_counters},
+  {"dut", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, dutch_ISO_8859_1_version, dutch_ISO_8859_1_stem_max_growth, dutch_ISO_8859_1_counters},
+  {"dut", ENC_UTF_8, dutch_UTF_8_create_env, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_version, dutch_UTF_8_stem_max_growth, dutch_UTF_8_counters},
+  {"dutch", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, dutch_ISO_8859_1_version, dutch_ISO_8859_1_stem_max_growth, dutch_ISO_8859_1_counters},
+  {"dutch", ENC_UTF_8, dutch_UTF_8_create_env, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_version, dutch_UTF_8_stem_max_growth, dutch_UTF_8_counters},
+  {"en", ENC_ISO_8859_1, english_ISO_8859_1_create_env, english_ISO_8859_1_close_env, english_ISO_8859_1_stem, english_ISO_8859_1_version, english_ISO_8859_1_stem_max_growth, english_ISO_8859_1_counters},
+  {"en", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_version, english_UTF_8_stem_max_growth, english_UTF_8_counters},
+  {"en-light", ENC_ISO_8859_1, english_ISO_8859_1_create_env, english_ISO_8859_1_close_env, english_ISO_8859_1_stem_light, english_ISO_8859_1_version, english_ISO_8859_1_stem_light_max_growth, english_ISO_8859_1_counters},
+  {"en-light", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem_light, english_UTF_8_version, english_UTF_8_stem_light_max_growth, english_UTF_8_counters},
+  {"eng", ENC_ISO_8859_1, english_ISO_8859_1_create_env, english_ISO_8859_1_close_env, english_ISO_8859_1_stem, english_ISO_8859_1_version, english_ISO_8859_1_stem_max_growth, english_ISO_8859_1_counters},
+  {"eng", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_version, english_UTF_8_stem_max_growth, english_UTF_8_counters},
+  {"english", ENC_ISO_8859_1, english_ISO_8859_1_create_env, english_ISO_8859_1_close_env, english_ISO_8859_1_stem, english_ISO_8859_1_version, english_ISO_8859_1_stem_max_growth, english_ISO_8859_1_counters},
+  {"english", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_version, english_UTF_8_stem_max_growth, english_UTF_8_counters},
+  {"english-light", ENC_ISO_8859_1, english_ISO_8859_1_create_env, english_ISO_8859_1_close_env, english_ISO_8859_1_stem_light, english_ISO_8859_1_version, english_ISO_8859_1_stem_light_max_growth, english_ISO_8859_1_counters},
+  {"english-light", ENC_UTF_8, english_UTF_8_create_env, english_UTF_8_close_env, english_UTF_8_stem_light, english_UTF_8_version, english_UTF_8_stem_light_max_growth, english_UTF_8_counters},
+  {"es", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, spanish_ISO_8859_1_version, spanish_ISO_8859_1_stem_max_growth, spanish_ISO_8859_1_counters},
+  {"es", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_version, spanish_UTF_8_stem_max_growth, spanish_UTF_8_counters},
+  {"esl", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, spanish_ISO_8859_1_version, spanish_ISO_8859_1_stem_max_growth, spanish_ISO_8859_1_counters},
+  {"esl", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_version, spanish_UTF_8_stem_max_growth, spanish_UTF_8_counters},
+  {"fi", ENC_ISO_8859_1, finnish_ISO_8859_1_create_env, finnish_ISO_8859_1_close_env, finnish_ISO_8859_1_stem, finnish_ISO_8859_1_version, finnish_ISO_8859_1_stem_max_growth, finnish_ISO_8859_1_counters},
+  {"fi", ENC_UTF_8, finnish_UTF_8_create_env, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_version, finnish_UTF_8_stem_max_growth, finnish_UTF_8_counters},
+  {"fin", ENC_ISO_8859_1, finnish_ISO_8859_1_create_env, finnish_ISO_8859_1_close_env, finnish_ISO_8859_1_stem, finnish_ISO_8859_1_version, finnish_ISO_8859_1_stem_max_growth, finnish_ISO_8859_1_counters},
+  {"fin", ENC_UTF_8, finnish_UTF_8_create_env, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_version, finnish_UTF_8_stem_max_growth, finnish_UTF_8_counters},
+  {"finnish", ENC_ISO_8859_1, finnish_ISO_8859_1_create_env, finnish_ISO_8859_1_close_env, finnish_ISO_8859_1_stem, finnish_ISO_8859_1_version, finnish_ISO_8859_1_stem_max_growth, finnish_ISO_8859_1_counters},
+  {"finnish", ENC_UTF_8, finnish_UTF_8_create_env, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_version, finnish_UTF_8_stem_max_growth, finnish_UTF_8_counters},
+  {"fr", ENC_ISO_8859_1, french_ISO_8859_1_create_env, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, french_ISO_8859_1_version, french_ISO_8859_1_stem_max_growth, french_ISO_8859_1_counters},
+  {"fr", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_version, french_UTF_8_stem_max_growth, french_UTF_8_counters},
+  {"fra", ENC_ISO_8859_1, french_ISO_8859_1_create_env, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, french_ISO_8859_1_version, french_ISO_8859_1_stem_max_growth, french_ISO_8859_1_counters},
+  {"fra", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_version, french_UTF_8_stem_max_growth, french_UTF_8_counters},
+  {"fre", ENC_ISO_8859_1, french_ISO_8859_1_create_env, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, french_ISO_8859_1_version, french_ISO_8859_1_stem_max_growth, french_ISO_8859_1_counters},
+  {"fre", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_version, french_UTF_8_stem_max_growth, french_UTF_8_counters},
+  {"french", ENC_ISO_8859_1, french_ISO_8859_1_create_env, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, french_ISO_8859_1_version, french_ISO_8859_1_stem_max_growth, french_ISO_8859_1_counters},
+  {"french", ENC_UTF_8, french_UTF_8_create_env, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_version, french_UTF_8_stem_max_growth, french_UTF_8_counters},
+  {"ger", ENC_ISO_8859_1, german_ISO_8859_1_create_env, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, german_ISO_8859_1_version, german_ISO_8859_1_stem_max_growth, german_ISO_8859_1_counters},
+  {"ger", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_version, german_UTF_8_stem_max_growth, german_UTF_8_counters},
+  {"german", ENC_ISO_8859_1, german_ISO_8859_1_create_env, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, german_ISO_8859_1_version, german_ISO_8859_1_stem_max_growth, german_ISO_8859_1_counters},
+  {"german", ENC_UTF_8, german_UTF_8_create_env, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_version, german_UTF_8_stem_max_growth, german_UTF_8_counters},
+  {"hu", ENC_ISO_8859_2, hungarian_ISO_8859_2_create_env, hungarian_ISO_8859_2_close_env, hungarian_ISO_8859_2_stem, hungarian_ISO_8859_2_version, hungarian_ISO_8859_2_stem_max_growth, hungarian_ISO_8859_2_counters},
+  {"hu", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_version, hungarian_UTF_8_stem_max_growth, hungarian_UTF_8_counters},
+  {"hun", ENC_ISO_8859_2, hungarian_ISO_8859_2_create_env, hungarian_ISO_8859_2_close_env, hungarian_ISO_8859_2_stem, hungarian_ISO_8859_2_version, hungarian_ISO_8859_2_stem_max_growth, hungarian_ISO_8859_2_counters},
+  {"hun", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_version, hungarian_UTF_8_stem_max_growth, hungarian_UTF_8_counters},
+  {"hungarian", ENC_ISO_8859_2, hungarian_ISO_8859_2_create_env, hungarian_ISO_8859_2_close_env, hungarian_ISO_8859_2_stem, hungarian_ISO_8859_2_version, hungarian_ISO_8859_2_stem_max_growth, hungarian_ISO_8859_2_counters},
+  {"hungarian", ENC_UTF_8, hungarian_UTF_8_create_env, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_version, hungarian_UTF_8_stem_max_growth, hungarian_UTF_8_counters},
+  {"it", ENC_ISO_8859_1, italian_ISO_8859_1_create_env, italian_ISO_8859_1_close_env, italian_ISO_8859_1_stem, italian_ISO_8859_1_version, italian_ISO_8859_1_stem_max_growth, italian_ISO_8859_1_counters},
+  {"it", ENC_UTF_8, italian_UTF_8_create_env, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_version, italian_UTF_8_stem_max_growth, italian_UTF_8_counters},
+  {"ita", ENC_ISO_8859_1, italian_ISO_8859_1_create_env, italian_ISO_8859_1_close_env, italian_ISO_8859_1_stem, italian_ISO_8859_1_version, italian_ISO_8859_1_stem_max_growth, italian_ISO_8859_1_counters},
+  {"ita", ENC_UTF_8, italian_UTF_8_create_env, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_version, italian_UTF_8_stem_max_growth, italian_UTF_8_counters},
+  {"italian", ENC_ISO_8859_1, italian_ISO_8859_1_create_env, italian_ISO_8859_1_close_env, italian_ISO_8859_1_stem, italian_ISO_8859_1_version, italian_ISO_8859_1_stem_max_growth, italian_ISO_8859_1_counters},
+  {"italian", ENC_UTF_8, italian_UTF_8_create_env, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_version, italian_UTF_8_stem_max_growth, italian_UTF_8_counters},
+  {"nl", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, dutch_ISO_8859_1_version, dutch_ISO_8859_1_stem_max_growth, dutch_ISO_8859_1_counters},
+  {"nl", ENC_UTF_8, dutch_UTF_8_create_env, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_version, dutch_UTF_8_stem_max_growth, dutch_UTF_8_counters},
+  {"nld", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, dutch_ISO_8859_1_version, dutch_ISO_8859_1_stem_max_growth, dutch_ISO_8859_1_counters},
+  {"nld", ENC_UTF_8, dutch_UTF_8_create_env, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_version, dutch_UTF_8_stem_max_growth, dutch_UTF_8_counters},
+  {"no", ENC_ISO_8859_1, norwegian_ISO_8859_1_create_env, norwegian_ISO_8859_1_close_env, norwegian_ISO_8859_1_stem, norwegian_ISO_8859_1_version, norwegian_ISO_8859_1_stem_max_growth, norwegian_ISO_8859_1_counters},
+  {"no", ENC_UTF_8, norwegian_UTF_8_create_env, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_version, norwegian_UTF_8_stem_max_growth, norwegian_UTF_8_counters},
+  {"nor", ENC_ISO_8859_1, norwegian_ISO_8859_1_create_env, norwegian_ISO_8859_1_close_env, norwegian_ISO_8859_1_stem, norwegian_ISO_8859_1_version, norwegian_ISO_8859_1_stem_max_growth, norwegian_ISO_8859_1_counters},
+  {"nor", ENC_UTF_8, norwegian_UTF_8_create_env, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_version, norwegian_UTF_8_stem_max_growth, norwegian_UTF_8_counters},
+  {"norwegian", ENC_ISO_8859_1, norwegian_ISO_8859_1_create_env, norwegian_ISO_8859_1_close_env, norwegian_ISO_8859_1_stem, norwegian_ISO_8859_1_version, norwegian_ISO_8859_1_stem_max_growth, norwegian_ISO_8859_1_counters},
+  {"norwegian", ENC_UTF_8, norwegian_UTF_8_create_env, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_version, norwegian_UTF_8_stem_max_growth, norwegian_UTF_8_counters},
+  {"por", ENC_ISO_8859_1, portuguese_ISO_8859_1_create_env, portuguese_ISO_8859_1_close_env, portuguese_ISO_8859_1_stem, portuguese_ISO_8859_1_version, portuguese_ISO_8859_1_stem_max_growth, portuguese_ISO_8859_1_counters},
+  {"por", ENC_UTF_8, portuguese_UTF_8_create_env, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_version, portuguese_UTF_8_stem_max_growth, portuguese_UTF_8_counters},
+  {"porter", ENC_ISO_8859_1, porter_ISO_8859_1_create_env, porter_ISO_8859_1_close_env, porter_ISO_8859_1_stem, porter_ISO_8859_1_version, porter_ISO_8859_1_stem_max_growth, porter_ISO_8859_1_counters},
+  {"porter", ENC_UTF_8, porter_UTF_8_create_env, porter_UTF_8_close_env, porter_UTF_8_stem, porter_UTF_8_version, porter_UTF_8_stem_max_growth, porter_UTF_8_counters},
+  {"portuguese", ENC_ISO_8859_1, portuguese_ISO_8859_1_create_env, portuguese_ISO_8859_1_close_env, portuguese_ISO_8859_1_stem, portuguese_ISO_8859_1_version, portuguese_ISO_8859_1_stem_max_growth, portuguese_ISO_8859_1_counters},
+  {"portuguese", ENC_UTF_8, portuguese_UTF_8_create_env, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_version, portuguese_UTF_8_stem_max_growth, portuguese_UTF_8_counters},
+  {"pt", ENC_ISO_8859_1, portuguese_ISO_8859_1_create_env, portuguese_ISO_8859_1_close_env, portuguese_ISO_8859_1_stem, portuguese_ISO_8859_1_version, portuguese_ISO_8859_1_stem_max_growth, portuguese_ISO_8859_1_counters},
+  {"pt", ENC_UTF_8, portuguese_UTF_8_create_env, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_version, portuguese_UTF_8_stem_max_growth, portuguese_UTF_8_counters},
+  {"ro", ENC_ISO_8859_2, romanian_ISO_8859_2_create_env, romanian_ISO_8859_2_close_env, romanian_ISO_8859_2_stem, romanian_ISO_8859_2_version, romanian_ISO_8859_2_stem_max_growth, romanian_ISO_8859_2_counters},
+  {"ro", ENC_UTF_8, romanian_UTF_8_create_env, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_version, romanian_UTF_8_stem_max_growth, romanian_UTF_8_counters},
+  {"romanian", ENC_ISO_8859_2, romanian_ISO_8859_2_create_env, romanian_ISO_8859_2_close_env, romanian_ISO_8859_2_stem, romanian_ISO_8859_2_version, romanian_ISO_8859_2_stem_max_growth, romanian_ISO_8859_2_counters},
+  {"romanian", ENC_UTF_8, romanian_UTF_8_create_env, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_version, romanian_UTF_8_stem_max_growth, romanian_UTF_8_counters},
+  {"ron", ENC_ISO_8859_2, romanian_ISO_8859_2_create_env, romanian_ISO_8859_2_close_env, romanian_ISO_8859_2_stem, romanian_ISO_8859_2_version, romanian_ISO_8859_2_stem_max_growth, romanian_ISO_8859_2_counters},
+  {"ron", ENC_UTF_8, romanian_UTF_8_create_env, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_version, romanian_UTF_8_stem_max_growth, romanian_UTF_8_counters},
+  {"ru", ENC_KOI8_R, russian_KOI8_R_create_env, russian_KOI8_R_close_env, russian_KOI8_R_stem, russian_KOI8_R_version, russian_KOI8_R_stem_max_growth, russian_KOI8_R_counters},
+  {"ru", ENC_UTF_8, russian_UTF_8_create_env, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_version, russian_UTF_8_stem_max_growth, russian_UTF_8_counters},
+  {"rum", ENC_ISO_8859_2, romanian_ISO_8859_2_create_env, romanian_ISO_8859_2_close_env, romanian_ISO_8859_2_stem, romanian_ISO_8859_2_version, romanian_ISO_8859_2_stem_max_growth, romanian_ISO_8859_2_counters},
+  {"rum", ENC_UTF_8, romanian_UTF_8_create_env, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_version, romanian_UTF_8_stem_max_growth, romanian_UTF_8_counters},
+  {"rus", ENC_KOI8_R, russian_KOI8_R_create_env, russian_KOI8_R_close_env, russian_KOI8_R_stem, russian_KOI8_R_version, russian_KOI8_R_stem_max_growth, russian_KOI8_R_counters},
+  {"rus", ENC_UTF_8, russian_UTF_8_create_env, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_version, russian_UTF_8_stem_max_growth, russian_UTF_8_counters},
+  {"russian", ENC_KOI8_R, russian_KOI8_R_create_env, russian_KOI8_R_close_env, russian_KOI8_R_stem, russian_KOI8_R_version, russian_KOI8_R_stem_max_growth, russian_KOI8_R_counters},
+  {"russian", ENC_UTF_8, russian_UTF_8_create_env, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_version, russian_UTF_8_stem_max_growth, russian_UTF_8_counters},
+  {"spa", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, spanish_ISO_8859_1_version, spanish_ISO_8859_1_stem_max_growth, spanish_ISO_8859_1_counters},
+  {"spa", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_version, spanish_UTF_8_stem_max_growth, spanish_UTF_8_counters},
+  {"spanish", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, spanish_ISO_8859_1_version, spanish_ISO_8859_1_stem_max_growth, spanish_ISO_8859_1_counters},
+  {"spanish", ENC_UTF_8, spanish_UTF_8_create_env, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_version, spanish_UTF_8_stem_max_growth, spanish_UTF_8_counters},
+  {"sv", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem, swedish_ISO_8859_1_version, swedish_ISO_8859_1_stem_max_growth, swedish_ISO_8859_1_counters},
+  {"sv", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_version, swedish_UTF_8_stem_max_growth, swedish_UTF_8_counters},
+  {"swe", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem, swedish_ISO_8859_1_version, swedish_ISO_8859_1_stem_max_growth, swedish_ISO_8859_1_counters},
+  {"swe", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_version, swedish_UTF_8_stem_max_growth, swedish_UTF_8_counters},
+  {"swedish", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem, swedish_ISO_8859_1_version, swedish_ISO_8859_1_stem_max_growth, swedish_ISO_8859_1_counters},
+  {"swedish", ENC_UTF_8, swedish_UTF_8_create_env, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_version, swedish_UTF_8_stem_max_growth, swedish_UTF_8_counters},
+  {"tr", ENC_UTF_8, turkish_UTF_8_create_env, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_version, turkish_UTF_8_stem_max_growth, turkish_UTF_8_counters},
+  {"tur", ENC_UTF_8, turkish_UTF_8_create_env, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_version, turkish_UTF_8_stem_max_growth, turkish_UTF_8_counters},
+  {"turkish", ENC_UTF_8, turkish_UTF_8_create_env, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_version, turkish_UTF_8_stem_max_growth, turkish_UTF_8_counters},
+  {0,ENC_UNKNOWN,0,0,0,0,0,0}
+};
+static const char * algorithm_names[] = {
+  "danish", 
+  "dutch", 
+  "english", 
+  "english-light", 
+  "finnish", 
+  "french", 
+  "german", 
+  "hungarian", 
+  "italian", 
+  "norwegian", 
+  "porter", 
+  "portuguese", 
+  "romanian", 
+  "russian", 
+  "spanish", 
+  "swedish", 
+  "turkish", 
+  0
+};
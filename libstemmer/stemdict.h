@@ -0,0 +1,27 @@
+
+/* Layout of a stem dictionary file, as written by examples/stemdict.c and
+ * mapped by sb_stemmer_load_dictionary().
+ *
+ * The header below is followed by int d[bucket_count], int
+ * slot[4 * slot_count] and blob_size bytes of words and stems, all in the
+ * byte order of the machine which wrote it. Together they make a perfect
+ * hash table, looked up as by find_hotword() in runtime/utilities.c: a word
+ * goes in bucket hash(word, 0) % bucket_count, and then in slot
+ * hash(word, d[bucket]) % slot_count, whose four ints are the offset and
+ * size in the blob of the word and then of its stem.
+ */
+
+#define SB_DICT_MAGIC "SBSTEMD\n"
+#define SB_DICT_VERSION 2
+
+struct sb_dict_header {
+    char magic[8];
+    int version;
+    int count;              /* number of words */
+    int bucket_count;
+    int slot_count;
+    int blob_size;
+    char algorithm[32];     /* as given to sb_stemmer_new() */
+    char charenc[16];
+    char version_of_stemmer[24]; /* from sb_stemmer_version() */
+};
@@ -30,55 +30,81 @@ class BaseStemmer(object):
         self.bra              = other.bra
         self.ket              = other.ket
 
-    def in_grouping(self, s, min, max):
+    def in_grouping(self, s):
         if self.cursor >= self.limit:
             return False
-        ch = ord(self.current[self.cursor])
-        if ch > max or ch < min:
-            return False
-        ch -= min
-        if (s[ch >> 3] & (0x1 << (ch & 0x7))) == 0:
+        if self.current[self.cursor] not in s:
             return False
         self.cursor += 1
         return True
 
-    def in_grouping_b(self, s, min, max):
+    def in_grouping_b(self, s):
         if self.cursor <= self.limit_backward:
             return False
-        ch = ord(self.current[self.cursor - 1])
-        if ch > max or ch < min:
-            return False
-        ch -= min
-        if (s[ch >> 3] & (0x1 << (ch & 0x7))) == 0:
+        if self.current[self.cursor - 1] not in s:
             return False
         self.cursor -= 1
         return True
 
-    def out_grouping(self, s, min, max):
+    def out_grouping(self, s):
         if self.cursor >= self.limit:
             return False
-        ch = ord(self.current[self.cursor])
-        if ch > max or ch < min:
-            self.cursor += 1
-            return True
-        ch -= min
-        if (s[ch >> 3] & (0X1 << (ch & 0x7))) == 0:
-            self.cursor += 1
-            return True
-        return False
-
-    def out_grouping_b(self, s, min, max):
+        if self.current[self.cursor] in s:
+            return False
+        self.cursor += 1
+        return True
+
+    def out_grouping_b(self, s):
         if self.cursor <= self.limit_backward:
             return False
-        ch = ord(self.current[self.cursor - 1])
-        if ch > max or ch < min:
-            self.cursor -= 1
-            return True
-        ch -= min
-        if (s[ch >> 3] & (0X1 << (ch & 0x7))) == 0:
-            self.cursor -= 1
-            return True
-        return False
+        if self.current[self.cursor - 1] in s:
+            return False
+        self.cursor -= 1
+        return True
+
+    def go_in_grouping(self, s):
+        '''
+        Moves the cursor over the characters in s, as goto non s does,
+        failing at the limit.
+        '''
+        c = self.cursor
+        l = self.limit
+        current = self.current
+        while c < l and current[c] in s:
+            c += 1
+        self.cursor = c
+        return c < l
+
+    def go_in_grouping_b(self, s):
+        c = self.cursor
+        lb = self.limit_backward
+        current = self.current
+        while c > lb and current[c - 1] in s:
+            c -= 1
+        self.cursor = c
+        return c > lb
+
+    def go_out_grouping(self, s):
+        '''
+        Moves the cursor over the characters not in s, as goto s does,
+        failing at the limit.
+        '''
+        c = self.cursor
+        l = self.limit
+        current = self.current
+        while c < l and current[c] not in s:
+            c += 1
+        self.cursor = c
+        return c < l
+
+    def go_out_grouping_b(self, s):
+        c = self.cursor
+        lb = self.limit_backward
+        current = self.current
+        while c > lb and current[c - 1] not in s:
+            c -= 1
+        self.cursor = c
+        return c > lb
 
     def in_range(self, min, max):
         if self.cursor >= self.limit:
@@ -138,121 +164,64 @@ class BaseStemmer(object):
     def eq_v_b(self, s):
         return self.eq_s_b(len(s), s)
 
-    def find_among(self, v, v_size):
-        i = 0
-        j = v_size
-
+    def find_among(self, v, d):
+        '''
+        d gives the cases of v by size, longest first, each as a dict from
+        the string to its index in v, so the longest which matches at the
+        cursor is found by trying the sizes in turn.
+        '''
         c = self.cursor
-        l = self.limit
-
-        common_i = 0
-        common_j = 0
-
-        first_key_inspected = False
-
-        while True:
-            k = i + ((j - i) >> 1)
-            diff = 0
-            common = min(common_i, common_j) # smalle
-            w = v[k]
-            for i2 in range(common, w.s_size):
-                if c + common == l:
-                    diff = -1
-                    break
-                diff = ord(self.current[c + common]) - ord(w.s[i2])
-                if diff != 0:
+        room = self.limit - c
+        current = self.current
+        for size, cases in d:
+            if size <= room:
+                i = cases.get(current[c:c + size])
+                if i is not None:
                     break
-                common += 1
-            if diff < 0:
-                j = k
-                common_j = common
-            else:
-                i = k
-                common_i = common
-            if j - i <= 1:
-                if i > 0:
-                    break # v->s has been inspected
-                if j == i:
-                    break # only one item in v
-                # - but now we need to go round once more to get
-                # v->s inspected. self looks messy, but is actually
-                # the optimal approach.
-                if first_key_inspected:
-                    break
-                first_key_inspected = True
+        else:
+            return 0
         while True:
             w = v[i]
-            if common_i >= w.s_size:
-                self.cursor = c + w.s_size
-                if w.method is None:
-                    return w.result
-                method = getattr(self, w.method)
-                res = method()
-                self.cursor = c + w.s_size
-                if res:
-                    return w.result
+            self.cursor = c + w.s_size
+            if w.method is None:
+                return w.result
+            method = getattr(self, w.method)
+            res = method()
+            self.cursor = c + w.s_size
+            if res:
+                return w.result
+            # the longest case which is a prefix of this one
             i = w.substring_i
             if i < 0:
                 return 0
-        return -1 # not reachable
 
-    def find_among_b(self, v, v_size):
+    def find_among_b(self, v, d):
         '''
         find_among_b is for backwards processing. Same comments apply
         '''
-        i = 0
-        j = v_size
-
         c = self.cursor
-        lb = self.limit_backward;
-
-        common_i = 0
-        common_j = 0
-
-        first_key_inspected = False
-
-        while True:
-            k = i + ((j - i) >> 1)
-            diff = 0
-            common = min(common_i, common_j)
-            w = v[k]
-            for i2 in range(w.s_size - 1 - common, -1, -1):
-                if c - common == lb:
-                    diff = -1
-                    break
-                diff = ord(self.current[c - 1 - common]) - ord(w.s[i2])
-                if diff != 0:
-                    break
-                common += 1
-            if diff < 0:
-                j = k
-                common_j = common
-            else:
-                i = k
-                common_i = common
-            if j - i <= 1:
-                if i > 0:
+        room = c - self.limit_backward
+        current = self.current
+        for size, cases in d:
+            if size <= room:
+                i = cases.get(current[c - size:c])
+                if i is not None:
                     break
-                if j == i:
-                    break
-                if first_key_inspected:
-                    break
-                first_key_inspected = True
+        else:
+            return 0
         while True:
             w = v[i]
-            if common_i >= w.s_size:
-                self.cursor = c - w.s_size
-                if w.method is None:
-                    return w.result
-                method = getattr(self, w.method)
-                res = method()
-                self.cursor = c - w.s_size
-                if res:
-                    return w.result
+            self.cursor = c - w.s_size
+            if w.method is None:
+                return w.result
+            method = getattr(self, w.method)
+            res = method()
+            self.cursor = c - w.s_size
+            if res:
+                return w.result
             i = w.substring_i
             if i < 0:
                 return 0
-        return -1 # not reachable
 
     def replace_s(self, c_bra, c_ket, s):
         '''
@@ -0,0 +1,57 @@
+__all__ = ('language', 'stemmer')
+
+from .french_stemmer import FrenchStemmer
+from .hungarian_stemmer import HungarianStemmer
+from .english_stemmer import EnglishStemmer
+from .norwegian_stemmer import NorwegianStemmer
+from .danish_stemmer import DanishStemmer
+from .turkish_stemmer import TurkishStemmer
+from .porter_stemmer import PorterStemmer
+from .spanish_stemmer import SpanishStemmer
+from .german_stemmer import GermanStemmer
+from .portuguese_stemmer import PortugueseStemmer
+from .dutch_stemmer import DutchStemmer
+from .russian_stemmer import RussianStemmer
+from .romanian_stemmer import RomanianStemmer
+from .swedish_stemmer import SwedishStemmer
+from .italian_stemmer import ItalianStemmer
+from .finnish_stemmer import FinnishStemmer
+
+_languages = {
+    'french': FrenchStemmer,
+    'hungarian': HungarianStemmer,
+    'english': EnglishStemmer,
+    'norwegian': NorwegianStemmer,
+    'danish': DanishStemmer,
+    'turkish': TurkishStemmer,
+    'porter': PorterStemmer,
+    'spanish': SpanishStemmer,
+    'german': GermanStemmer,
+    'portuguese': PortugueseStemmer,
+    'dutch': DutchStemmer,
+    'russian': RussianStemmer,
+    'romanian': RomanianStemmer,
+    'swedish': SwedishStemmer,
+    'italian': ItalianStemmer,
+    'finnish': FinnishStemmer,
+}
+
+try:
+    import Stemmer
+    cext_available = True
+except ImportError:
+    cext_available = False
+
+def algorithms():
+    if cext_available:
+        return Stemmer.language()
+    else:
+        return list(_languages.key())
+
+def stemmer(lang):
+    if cext_available:
+        return Stemmer.Stemmer(lang)
+    if lang.lower() in _languages:
+        return _languages[lang.lower()]()
+    else:
+        raise KeyError("Stemming algorithm '%s' not found" % lang)
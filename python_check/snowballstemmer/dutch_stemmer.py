@@ -0,0 +1,747 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class DutchStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"", -1, 6),
+        Among(u"\u00E1", 0, 1),
+        Among(u"\u00E4", 0, 1),
+        Among(u"\u00E9", 0, 2),
+        Among(u"\u00EB", 0, 2),
+        Among(u"\u00ED", 0, 3),
+        Among(u"\u00EF", 0, 3),
+        Among(u"\u00F3", 0, 4),
+        Among(u"\u00F6", 0, 4),
+        Among(u"\u00FA", 0, 5),
+        Among(u"\u00FC", 0, 5)
+    ]
+
+    d_0 = (
+        (1, {
+            u"\u00E1": 1,
+            u"\u00E4": 2,
+            u"\u00E9": 3,
+            u"\u00EB": 4,
+            u"\u00ED": 5,
+            u"\u00EF": 6,
+            u"\u00F3": 7,
+            u"\u00F6": 8,
+            u"\u00FA": 9,
+            u"\u00FC": 10
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"", -1, 3),
+        Among(u"I", 0, 2),
+        Among(u"Y", 0, 1)
+    ]
+
+    d_1 = (
+        (1, {
+            u"I": 1,
+            u"Y": 2
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_2 = [
+        Among(u"dd", -1, -1),
+        Among(u"kk", -1, -1),
+        Among(u"tt", -1, -1)
+    ]
+
+    d_2 = (
+        (2, {
+            u"dd": 0,
+            u"kk": 1,
+            u"tt": 2
+        }),
+    )
+
+    a_3 = [
+        Among(u"ene", -1, 2),
+        Among(u"se", -1, 3),
+        Among(u"en", -1, 2),
+        Among(u"heden", 2, 1),
+        Among(u"s", -1, 3)
+    ]
+
+    d_3 = (
+        (5, {
+            u"heden": 3
+        }),
+        (3, {
+            u"ene": 0
+        }),
+        (2, {
+            u"se": 1,
+            u"en": 2
+        }),
+        (1, {
+            u"s": 4
+        }),
+    )
+
+    a_4 = [
+        Among(u"end", -1, 1),
+        Among(u"ig", -1, 2),
+        Among(u"ing", -1, 1),
+        Among(u"lijk", -1, 3),
+        Among(u"baar", -1, 4),
+        Among(u"bar", -1, 5)
+    ]
+
+    d_4 = (
+        (4, {
+            u"lijk": 3,
+            u"baar": 4
+        }),
+        (3, {
+            u"end": 0,
+            u"ing": 2,
+            u"bar": 5
+        }),
+        (2, {
+            u"ig": 1
+        }),
+    )
+
+    a_5 = [
+        Among(u"aa", -1, -1),
+        Among(u"ee", -1, -1),
+        Among(u"oo", -1, -1),
+        Among(u"uu", -1, -1)
+    ]
+
+    d_5 = (
+        (2, {
+            u"aa": 0,
+            u"ee": 1,
+            u"oo": 2,
+            u"uu": 3
+        }),
+    )
+
+    g_v = frozenset(u"aeiouy\u00E8")
+
+    g_v_I = frozenset(u"aeiouy\u00E8I")
+
+    g_v_j = frozenset(u"aeiouy\u00E8j")
+
+    I_p2 = 0
+    I_p1 = 0
+    B_e_found = False
+
+    def copy_from(self, other):
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        self.B_e_found = other.B_e_found
+        super.copy_from(other)
+
+    def r_prelude(self):
+        # (, line 41
+        # test, line 42
+        v_1 = self.cursor
+        # repeat, line 42
+        while True:
+            lab1 = False
+            v_2 = self.cursor
+            while True:
+                # (, line 42
+                # [, line 43
+                self.bra = self.cursor
+                # substring, line 43
+                among_var = self.find_among(DutchStemmer.a_0, DutchStemmer.d_0)
+                if among_var == 0:
+                    break
+                # ], line 43
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 45
+                    # <-, line 45
+                    if not self.slice_from(u"a"):
+                        return False
+                elif among_var == 2:
+                    # (, line 47
+                    # <-, line 47
+                    if not self.slice_from(u"e"):
+                        return False
+                elif among_var == 3:
+                    # (, line 49
+                    # <-, line 49
+                    if not self.slice_from(u"i"):
+                        return False
+                elif among_var == 4:
+                    # (, line 51
+                    # <-, line 51
+                    if not self.slice_from(u"o"):
+                        return False
+                elif among_var == 5:
+                    # (, line 53
+                    # <-, line 53
+                    if not self.slice_from(u"u"):
+                        return False
+                elif among_var == 6:
+                    # (, line 54
+                    # next, line 54
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_2
+            break
+        self.cursor = v_1
+        # try, line 57
+        v_3 = self.cursor
+        while True:
+            # (, line 57
+            # [, line 57
+            self.bra = self.cursor
+            # literal, line 57
+            if not self.eq_s(1, u"y"):
+                self.cursor = v_3
+                break
+            # ], line 57
+            self.ket = self.cursor
+            # <-, line 57
+            if not self.slice_from(u"Y"):
+                return False
+            break
+        # repeat, line 58
+        while True:
+            lab5 = False
+            v_4 = self.cursor
+            while True:
+                lab6 = False
+                # goto, line 58
+                while True:
+                    lab7 = False
+                    v_5 = self.cursor
+                    while True:
+                        lab8 = False
+                        # (, line 58
+                        if not self.in_grouping(DutchStemmer.g_v):
+                            break
+                        # [, line 59
+                        self.bra = self.cursor
+                        # or, line 59
+                        while True:
+                            lab9 = False
+                            v_6 = self.cursor
+                            while True:
+                                # (, line 59
+                                # literal, line 59
+                                if not self.eq_s(1, u"i"):
+                                    break
+                                # ], line 59
+                                self.ket = self.cursor
+                                if not self.in_grouping(DutchStemmer.g_v):
+                                    break
+                                # <-, line 59
+                                if not self.slice_from(u"I"):
+                                    return False
+                                lab9 = True
+                                break
+                            if lab9:
+                                break
+                            self.cursor = v_6
+                            # (, line 60
+                            # literal, line 60
+                            if not self.eq_s(1, u"y"):
+                                lab8 = True
+                                break
+                            # ], line 60
+                            self.ket = self.cursor
+                            # <-, line 60
+                            if not self.slice_from(u"Y"):
+                                return False
+                            break
+                        if lab8:
+                            break
+                        self.cursor = v_5
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = v_5
+                    if self.cursor >= self.limit:
+                        lab6 = True
+                        break
+                    self.cursor += 1
+                if lab6:
+                    break
+                lab5 = True
+                break
+            if lab5:
+                continue
+            self.cursor = v_4
+            break
+        return True
+
+    def r_mark_regions(self):
+        # (, line 64
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # gopast, line 69
+        if not self.go_out_grouping(DutchStemmer.g_v):
+            return False
+        self.cursor += 1
+        # gopast, line 69
+        if not self.go_in_grouping(DutchStemmer.g_v):
+            return False
+        self.cursor += 1
+        # setmark p1, line 69
+        self.I_p1 = self.cursor
+        # try, line 70
+        while True:
+            # (, line 70
+            if not self.I_p1 < 3:
+                break
+            self.I_p1 = 3
+            break
+        # gopast, line 71
+        if not self.go_out_grouping(DutchStemmer.g_v):
+            return False
+        self.cursor += 1
+        # gopast, line 71
+        if not self.go_in_grouping(DutchStemmer.g_v):
+            return False
+        self.cursor += 1
+        # setmark p2, line 71
+        self.I_p2 = self.cursor
+        return True
+
+    def r_postlude(self):
+        # repeat, line 75
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 75
+                # [, line 77
+                self.bra = self.cursor
+                # substring, line 77
+                among_var = self.find_among(DutchStemmer.a_1, DutchStemmer.d_1)
+                if among_var == 0:
+                    break
+                # ], line 77
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 78
+                    # <-, line 78
+                    if not self.slice_from(u"y"):
+                        return False
+                elif among_var == 2:
+                    # (, line 79
+                    # <-, line 79
+                    if not self.slice_from(u"i"):
+                        return False
+                elif among_var == 3:
+                    # (, line 80
+                    # next, line 80
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_undouble(self):
+        # (, line 90
+        # test, line 91
+        v_1 = self.limit - self.cursor
+        # among, line 91
+        if self.find_among_b(DutchStemmer.a_2, DutchStemmer.d_2) == 0:
+            return False
+        self.cursor = self.limit - v_1
+        # [, line 91
+        self.ket = self.cursor
+        # next, line 91
+        if self.cursor <= self.limit_backward:
+            return False
+        self.cursor -= 1
+        # ], line 91
+        self.bra = self.cursor
+        # delete, line 91
+        if not self.slice_del():
+            return False
+
+        return True
+
+    def r_e_ending(self):
+        # (, line 94
+        # unset e_found, line 95
+        self.B_e_found = False
+        # [, line 96
+        self.ket = self.cursor
+        # literal, line 96
+        if not self.eq_s_b(1, u"e"):
+            return False
+        # ], line 96
+        self.bra = self.cursor
+        # call R1, line 96
+        if not self.r_R1():
+            return False
+        # test, line 96
+        v_1 = self.limit - self.cursor
+        if not self.out_grouping_b(DutchStemmer.g_v):
+            return False
+        self.cursor = self.limit - v_1
+        # delete, line 96
+        if not self.slice_del():
+            return False
+
+        # set e_found, line 97
+        self.B_e_found = True
+        # call undouble, line 98
+        if not self.r_undouble():
+            return False
+        return True
+
+    def r_en_ending(self):
+        # (, line 101
+        # call R1, line 102
+        if not self.r_R1():
+            return False
+        # and, line 102
+        v_1 = self.limit - self.cursor
+        if not self.out_grouping_b(DutchStemmer.g_v):
+            return False
+        self.cursor = self.limit - v_1
+        # not, line 102
+        v_2 = self.limit - self.cursor
+        while True:
+            # literal, line 102
+            if not self.eq_s_b(3, u"gem"):
+                break
+            return False
+        self.cursor = self.limit - v_2
+        # delete, line 102
+        if not self.slice_del():
+            return False
+
+        # call undouble, line 103
+        if not self.r_undouble():
+            return False
+        return True
+
+    def r_standard_suffix(self):
+        # (, line 106
+        # do, line 107
+        v_1 = self.limit - self.cursor
+        while True:
+            # (, line 107
+            # [, line 108
+            self.ket = self.cursor
+            # substring, line 108
+            among_var = self.find_among_b(DutchStemmer.a_3, DutchStemmer.d_3)
+            if among_var == 0:
+                break
+            # ], line 108
+            self.bra = self.cursor
+            if among_var == 0:
+                break
+            elif among_var == 1:
+                # (, line 110
+                # call R1, line 110
+                if not self.r_R1():
+                    break
+                # <-, line 110
+                if not self.slice_from(u"heid"):
+                    return False
+            elif among_var == 2:
+                # (, line 113
+                # call en_ending, line 113
+                if not self.r_en_ending():
+                    break
+            elif among_var == 3:
+                # (, line 116
+                # call R1, line 116
+                if not self.r_R1():
+                    break
+                if not self.out_grouping_b(DutchStemmer.g_v_j):
+                    break
+                # delete, line 116
+                if not self.slice_del():
+                    return False
+
+            break
+        self.cursor = self.limit - v_1
+        # do, line 120
+        v_2 = self.limit - self.cursor
+        while True:
+            # call e_ending, line 120
+            if not self.r_e_ending():
+                break
+            break
+        self.cursor = self.limit - v_2
+        # do, line 122
+        v_3 = self.limit - self.cursor
+        while True:
+            lab2 = False
+            # (, line 122
+            # [, line 122
+            self.ket = self.cursor
+            # literal, line 122
+            if not self.eq_s_b(4, u"heid"):
+                break
+            # ], line 122
+            self.bra = self.cursor
+            # call R2, line 122
+            if not self.r_R2():
+                break
+            # not, line 122
+            v_4 = self.limit - self.cursor
+            while True:
+                # literal, line 122
+                if not self.eq_s_b(1, u"c"):
+                    break
+                lab2 = True
+                break
+            if lab2:
+                break
+            self.cursor = self.limit - v_4
+            # delete, line 122
+            if not self.slice_del():
+                return False
+
+            # [, line 123
+            self.ket = self.cursor
+            # literal, line 123
+            if not self.eq_s_b(2, u"en"):
+                break
+            # ], line 123
+            self.bra = self.cursor
+            # call en_ending, line 123
+            if not self.r_en_ending():
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 126
+        v_5 = self.limit - self.cursor
+        while True:
+            lab4 = False
+            # (, line 126
+            # [, line 127
+            self.ket = self.cursor
+            # substring, line 127
+            among_var = self.find_among_b(DutchStemmer.a_4, DutchStemmer.d_4)
+            if among_var == 0:
+                break
+            # ], line 127
+            self.bra = self.cursor
+            if among_var == 0:
+                break
+            elif among_var == 1:
+                # (, line 129
+                # call R2, line 129
+                if not self.r_R2():
+                    break
+                # delete, line 129
+                if not self.slice_del():
+                    return False
+
+                # or, line 130
+                while True:
+                    lab5 = False
+                    v_6 = self.limit - self.cursor
+                    while True:
+                        lab6 = False
+                        # (, line 130
+                        # [, line 130
+                        self.ket = self.cursor
+                        # literal, line 130
+                        if not self.eq_s_b(2, u"ig"):
+                            break
+                        # ], line 130
+                        self.bra = self.cursor
+                        # call R2, line 130
+                        if not self.r_R2():
+                            break
+                        # not, line 130
+                        v_7 = self.limit - self.cursor
+                        while True:
+                            # literal, line 130
+                            if not self.eq_s_b(1, u"e"):
+                                break
+                            lab6 = True
+                            break
+                        if lab6:
+                            break
+                        self.cursor = self.limit - v_7
+                        # delete, line 130
+                        if not self.slice_del():
+                            return False
+
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = self.limit - v_6
+                    # call undouble, line 130
+                    if not self.r_undouble():
+                        lab4 = True
+                        break
+                    break
+                if lab4:
+                    break
+            elif among_var == 2:
+                # (, line 133
+                # call R2, line 133
+                if not self.r_R2():
+                    break
+                # not, line 133
+                v_8 = self.limit - self.cursor
+                while True:
+                    # literal, line 133
+                    if not self.eq_s_b(1, u"e"):
+                        break
+                    lab4 = True
+                    break
+                if lab4:
+                    break
+                self.cursor = self.limit - v_8
+                # delete, line 133
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 3:
+                # (, line 136
+                # call R2, line 136
+                if not self.r_R2():
+                    break
+                # delete, line 136
+                if not self.slice_del():
+                    return False
+
+                # call e_ending, line 136
+                if not self.r_e_ending():
+                    break
+            elif among_var == 4:
+                # (, line 139
+                # call R2, line 139
+                if not self.r_R2():
+                    break
+                # delete, line 139
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 5:
+                # (, line 142
+                # call R2, line 142
+                if not self.r_R2():
+                    break
+                # Boolean test e_found, line 142
+                if not self.B_e_found:
+                    break
+                # delete, line 142
+                if not self.slice_del():
+                    return False
+
+            break
+        self.cursor = self.limit - v_5
+        # do, line 146
+        v_9 = self.limit - self.cursor
+        while True:
+            # (, line 146
+            if not self.out_grouping_b(DutchStemmer.g_v_I):
+                break
+            # test, line 148
+            v_10 = self.limit - self.cursor
+            # (, line 148
+            # among, line 149
+            if self.find_among_b(DutchStemmer.a_5, DutchStemmer.d_5) == 0:
+                break
+            if not self.out_grouping_b(DutchStemmer.g_v):
+                break
+            self.cursor = self.limit - v_10
+            # [, line 152
+            self.ket = self.cursor
+            # next, line 152
+            if self.cursor <= self.limit_backward:
+                break
+            self.cursor -= 1
+            # ], line 152
+            self.bra = self.cursor
+            # delete, line 152
+            if not self.slice_del():
+                return False
+
+            break
+        self.cursor = self.limit - v_9
+        return True
+
+    def _stem(self):
+        # (, line 157
+        # do, line 159
+        v_1 = self.cursor
+        while True:
+            # call prelude, line 159
+            if not self.r_prelude():
+                break
+            break
+        self.cursor = v_1
+        # do, line 160
+        v_2 = self.cursor
+        while True:
+            # call mark_regions, line 160
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_2
+        # backwards, line 161
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # do, line 162
+        v_3 = self.limit - self.cursor
+        while True:
+            # call standard_suffix, line 162
+            if not self.r_standard_suffix():
+                break
+            break
+        self.cursor = self.limit - v_3
+        self.cursor = self.limit_backward
+        # do, line 163
+        v_4 = self.cursor
+        while True:
+            # call postlude, line 163
+            if not self.r_postlude():
+                break
+            break
+        self.cursor = v_4
+        return True
@@ -0,0 +1,1368 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class EnglishStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"arsen", -1, -1),
+        Among(u"commun", -1, -1),
+        Among(u"gener", -1, -1)
+    ]
+
+    d_0 = (
+        (6, {
+            u"commun": 1
+        }),
+        (5, {
+            u"arsen": 0,
+            u"gener": 2
+        }),
+    )
+
+    a_1 = [
+        Among(u"'", -1, 1),
+        Among(u"'s'", 0, 1),
+        Among(u"'s", -1, 1)
+    ]
+
+    d_1 = (
+        (3, {
+            u"'s'": 1
+        }),
+        (2, {
+            u"'s": 2
+        }),
+        (1, {
+            u"'": 0
+        }),
+    )
+
+    a_2 = [
+        Among(u"ied", -1, 2),
+        Among(u"s", -1, 3),
+        Among(u"ies", 1, 2),
+        Among(u"sses", 1, 1),
+        Among(u"ss", 1, -1),
+        Among(u"us", 1, -1)
+    ]
+
+    d_2 = (
+        (4, {
+            u"sses": 3
+        }),
+        (3, {
+            u"ied": 0,
+            u"ies": 2
+        }),
+        (2, {
+            u"ss": 4,
+            u"us": 5
+        }),
+        (1, {
+            u"s": 1
+        }),
+    )
+
+    a_3 = [
+        Among(u"", -1, 3),
+        Among(u"bb", 0, 2),
+        Among(u"dd", 0, 2),
+        Among(u"ff", 0, 2),
+        Among(u"gg", 0, 2),
+        Among(u"bl", 0, 1),
+        Among(u"mm", 0, 2),
+        Among(u"nn", 0, 2),
+        Among(u"pp", 0, 2),
+        Among(u"rr", 0, 2),
+        Among(u"at", 0, 1),
+        Among(u"tt", 0, 2),
+        Among(u"iz", 0, 1)
+    ]
+
+    d_3 = (
+        (2, {
+            u"bb": 1,
+            u"dd": 2,
+            u"ff": 3,
+            u"gg": 4,
+            u"bl": 5,
+            u"mm": 6,
+            u"nn": 7,
+            u"pp": 8,
+            u"rr": 9,
+            u"at": 10,
+            u"tt": 11,
+            u"iz": 12
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_4 = [
+        Among(u"ed", -1, 2),
+        Among(u"eed", 0, 1),
+        Among(u"ing", -1, 2),
+        Among(u"edly", -1, 2),
+        Among(u"eedly", 3, 1),
+        Among(u"ingly", -1, 2)
+    ]
+
+    d_4 = (
+        (5, {
+            u"eedly": 4,
+            u"ingly": 5
+        }),
+        (4, {
+            u"edly": 3
+        }),
+        (3, {
+            u"eed": 1,
+            u"ing": 2
+        }),
+        (2, {
+            u"ed": 0
+        }),
+    )
+
+    a_5 = [
+        Among(u"anci", -1, 3),
+        Among(u"enci", -1, 2),
+        Among(u"ogi", -1, 13),
+        Among(u"li", -1, 16),
+        Among(u"bli", 3, 12),
+        Among(u"abli", 4, 4),
+        Among(u"alli", 3, 8),
+        Among(u"fulli", 3, 14),
+        Among(u"lessli", 3, 15),
+        Among(u"ousli", 3, 10),
+        Among(u"entli", 3, 5),
+        Among(u"aliti", -1, 8),
+        Among(u"biliti", -1, 12),
+        Among(u"iviti", -1, 11),
+        Among(u"tional", -1, 1),
+        Among(u"ational", 14, 7),
+        Among(u"alism", -1, 8),
+        Among(u"ation", -1, 7),
+        Among(u"ization", 17, 6),
+        Among(u"izer", -1, 6),
+        Among(u"ator", -1, 7),
+        Among(u"iveness", -1, 11),
+        Among(u"fulness", -1, 9),
+        Among(u"ousness", -1, 10)
+    ]
+
+    d_5 = (
+        (7, {
+            u"ational": 15,
+            u"ization": 18,
+            u"iveness": 21,
+            u"fulness": 22,
+            u"ousness": 23
+        }),
+        (6, {
+            u"lessli": 8,
+            u"biliti": 12,
+            u"tional": 14
+        }),
+        (5, {
+            u"fulli": 7,
+            u"ousli": 9,
+            u"entli": 10,
+            u"aliti": 11,
+            u"iviti": 13,
+            u"alism": 16,
+            u"ation": 17
+        }),
+        (4, {
+            u"anci": 0,
+            u"enci": 1,
+            u"abli": 5,
+            u"alli": 6,
+            u"izer": 19,
+            u"ator": 20
+        }),
+        (3, {
+            u"ogi": 2,
+            u"bli": 4
+        }),
+        (2, {
+            u"li": 3
+        }),
+    )
+
+    a_6 = [
+        Among(u"icate", -1, 4),
+        Among(u"ative", -1, 6),
+        Among(u"alize", -1, 3),
+        Among(u"iciti", -1, 4),
+        Among(u"ical", -1, 4),
+        Among(u"tional", -1, 1),
+        Among(u"ational", 5, 2),
+        Among(u"ful", -1, 5),
+        Among(u"ness", -1, 5)
+    ]
+
+    d_6 = (
+        (7, {
+            u"ational": 6
+        }),
+        (6, {
+            u"tional": 5
+        }),
+        (5, {
+            u"icate": 0,
+            u"ative": 1,
+            u"alize": 2,
+            u"iciti": 3
+        }),
+        (4, {
+            u"ical": 4,
+            u"ness": 8
+        }),
+        (3, {
+            u"ful": 7
+        }),
+    )
+
+    a_7 = [
+        Among(u"ic", -1, 1),
+        Among(u"ance", -1, 1),
+        Among(u"ence", -1, 1),
+        Among(u"able", -1, 1),
+        Among(u"ible", -1, 1),
+        Among(u"ate", -1, 1),
+        Among(u"ive", -1, 1),
+        Among(u"ize", -1, 1),
+        Among(u"iti", -1, 1),
+        Among(u"al", -1, 1),
+        Among(u"ism", -1, 1),
+        Among(u"ion", -1, 2),
+        Among(u"er", -1, 1),
+        Among(u"ous", -1, 1),
+        Among(u"ant", -1, 1),
+        Among(u"ent", -1, 1),
+        Among(u"ment", 15, 1),
+        Among(u"ement", 16, 1)
+    ]
+
+    d_7 = (
+        (5, {
+            u"ement": 17
+        }),
+        (4, {
+            u"ance": 1,
+            u"ence": 2,
+            u"able": 3,
+            u"ible": 4,
+            u"ment": 16
+        }),
+        (3, {
+            u"ate": 5,
+            u"ive": 6,
+            u"ize": 7,
+            u"iti": 8,
+            u"ism": 10,
+            u"ion": 11,
+            u"ous": 13,
+            u"ant": 14,
+            u"ent": 15
+        }),
+        (2, {
+            u"ic": 0,
+            u"al": 9,
+            u"er": 12
+        }),
+    )
+
+    a_8 = [
+        Among(u"e", -1, 1),
+        Among(u"l", -1, 2)
+    ]
+
+    d_8 = (
+        (1, {
+            u"e": 0,
+            u"l": 1
+        }),
+    )
+
+    a_9 = [
+        Among(u"succeed", -1, -1),
+        Among(u"proceed", -1, -1),
+        Among(u"exceed", -1, -1),
+        Among(u"canning", -1, -1),
+        Among(u"inning", -1, -1),
+        Among(u"earring", -1, -1),
+        Among(u"herring", -1, -1),
+        Among(u"outing", -1, -1)
+    ]
+
+    d_9 = (
+        (7, {
+            u"succeed": 0,
+            u"proceed": 1,
+            u"canning": 3,
+            u"earring": 5,
+            u"herring": 6
+        }),
+        (6, {
+            u"exceed": 2,
+            u"inning": 4,
+            u"outing": 7
+        }),
+    )
+
+    a_10 = [
+        Among(u"andes", -1, -1),
+        Among(u"atlas", -1, -1),
+        Among(u"bias", -1, -1),
+        Among(u"cosmos", -1, -1),
+        Among(u"dying", -1, 3),
+        Among(u"early", -1, 9),
+        Among(u"gently", -1, 7),
+        Among(u"howe", -1, -1),
+        Among(u"idly", -1, 6),
+        Among(u"lying", -1, 4),
+        Among(u"news", -1, -1),
+        Among(u"only", -1, 10),
+        Among(u"singly", -1, 11),
+        Among(u"skies", -1, 2),
+        Among(u"skis", -1, 1),
+        Among(u"sky", -1, -1),
+        Among(u"tying", -1, 5),
+        Among(u"ugly", -1, 8)
+    ]
+
+    d_10 = (
+        (6, {
+            u"cosmos": 3,
+            u"gently": 6,
+            u"singly": 12
+        }),
+        (5, {
+            u"andes": 0,
+            u"atlas": 1,
+            u"dying": 4,
+            u"early": 5,
+            u"lying": 9,
+            u"skies": 13,
+            u"tying": 16
+        }),
+        (4, {
+            u"bias": 2,
+            u"howe": 7,
+            u"idly": 8,
+            u"news": 10,
+            u"only": 11,
+            u"skis": 14,
+            u"ugly": 17
+        }),
+        (3, {
+            u"sky": 15
+        }),
+    )
+
+    g_v = frozenset(u"aeiouy")
+
+    g_v_WXY = frozenset(u"aeiouywxY")
+
+    g_valid_LI = frozenset(u"cdeghkmnrt")
+
+    B_Y_found = False
+    I_p2 = 0
+    I_p1 = 0
+
+    def copy_from(self, other):
+        self.B_Y_found = other.B_Y_found
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        super.copy_from(other)
+
+    def r_prelude(self):
+        # (, line 25
+        # unset Y_found, line 26
+        self.B_Y_found = False
+        # do, line 27
+        v_1 = self.cursor
+        while True:
+            # (, line 27
+            # [, line 27
+            self.bra = self.cursor
+            # literal, line 27
+            if not self.eq_s(1, u"'"):
+                break
+            # ], line 27
+            self.ket = self.cursor
+            # delete, line 27
+            if not self.slice_del():
+                return False
+
+            break
+        self.cursor = v_1
+        # do, line 28
+        v_2 = self.cursor
+        while True:
+            # (, line 28
+            # [, line 28
+            self.bra = self.cursor
+            # literal, line 28
+            if not self.eq_s(1, u"y"):
+                break
+            # ], line 28
+            self.ket = self.cursor
+            # <-, line 28
+            if not self.slice_from(u"Y"):
+                return False
+            # set Y_found, line 28
+            self.B_Y_found = True
+            break
+        self.cursor = v_2
+        # do, line 29
+        v_3 = self.cursor
+        while True:
+            # repeat, line 29
+            while True:
+                lab4 = False
+                v_4 = self.cursor
+                while True:
+                    lab5 = False
+                    # (, line 29
+                    # goto, line 29
+                    while True:
+                        lab6 = False
+                        v_5 = self.cursor
+                        while True:
+                            # (, line 29
+                            if not self.in_grouping(EnglishStemmer.g_v):
+                                break
+                            # [, line 29
+                            self.bra = self.cursor
+                            # literal, line 29
+                            if not self.eq_s(1, u"y"):
+                                break
+                            # ], line 29
+                            self.ket = self.cursor
+                            self.cursor = v_5
+                            lab6 = True
+                            break
+                        if lab6:
+                            break
+                        self.cursor = v_5
+                        if self.cursor >= self.limit:
+                            lab5 = True
+                            break
+                        self.cursor += 1
+                    if lab5:
+                        break
+                    # <-, line 29
+                    if not self.slice_from(u"Y"):
+                        return False
+                    # set Y_found, line 29
+                    self.B_Y_found = True
+                    lab4 = True
+                    break
+                if lab4:
+                    continue
+                self.cursor = v_4
+                break
+            break
+        self.cursor = v_3
+        return True
+
+    def r_mark_regions(self):
+        # (, line 32
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # do, line 35
+        v_1 = self.cursor
+        while True:
+            lab0 = False
+            # (, line 35
+            # or, line 41
+            while True:
+                lab1 = False
+                v_2 = self.cursor
+                while True:
+                    # among, line 36
+                    if self.find_among(EnglishStemmer.a_0, EnglishStemmer.d_0) == 0:
+                        break
+                    lab1 = True
+                    break
+                if lab1:
+                    break
+                self.cursor = v_2
+                # (, line 41
+                # gopast, line 41
+                if not self.go_out_grouping(EnglishStemmer.g_v):
+                    lab0 = True
+                    break
+                self.cursor += 1
+                # gopast, line 41
+                if not self.go_in_grouping(EnglishStemmer.g_v):
+                    lab0 = True
+                    break
+                self.cursor += 1
+                break
+            if lab0:
+                break
+            # setmark p1, line 42
+            self.I_p1 = self.cursor
+            # gopast, line 43
+            if not self.go_out_grouping(EnglishStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 43
+            if not self.go_in_grouping(EnglishStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p2, line 43
+            self.I_p2 = self.cursor
+            break
+        self.cursor = v_1
+        return True
+
+    def r_shortv(self):
+        # (, line 49
+        # or, line 51
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 50
+                if not self.out_grouping_b(EnglishStemmer.g_v_WXY):
+                    break
+                if not self.in_grouping_b(EnglishStemmer.g_v):
+                    break
+                if not self.out_grouping_b(EnglishStemmer.g_v):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 52
+            if not self.out_grouping_b(EnglishStemmer.g_v):
+                return False
+            if not self.in_grouping_b(EnglishStemmer.g_v):
+                return False
+            # atlimit, line 52
+            if self.cursor > self.limit_backward:
+                return False
+            break
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_Step_1a(self):
+        # (, line 58
+        # try, line 59
+        v_1 = self.limit - self.cursor
+        while True:
+            # (, line 59
+            # [, line 60
+            self.ket = self.cursor
+            # substring, line 60
+            among_var = self.find_among_b(EnglishStemmer.a_1, EnglishStemmer.d_1)
+            if among_var == 0:
+                self.cursor = self.limit - v_1
+                break
+            # ], line 60
+            self.bra = self.cursor
+            if among_var == 0:
+                self.cursor = self.limit - v_1
+                break
+            elif among_var == 1:
+                # (, line 62
+                # delete, line 62
+                if not self.slice_del():
+                    return False
+
+            break
+        # [, line 65
+        self.ket = self.cursor
+        # substring, line 65
+        among_var = self.find_among_b(EnglishStemmer.a_2, EnglishStemmer.d_2)
+        if among_var == 0:
+            return False
+        # ], line 65
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 66
+            # <-, line 66
+            if not self.slice_from(u"ss"):
+                return False
+        elif among_var == 2:
+            # (, line 68
+            # or, line 68
+            while True:
+                lab1 = False
+                v_2 = self.limit - self.cursor
+                while True:
+                    # (, line 68
+                    # hop, line 68
+                    c = self.cursor - 2
+                    if self.limit_backward > c or c > self.limit:
+                        break
+                    self.cursor = c
+                    # <-, line 68
+                    if not self.slice_from(u"i"):
+                        return False
+                    lab1 = True
+                    break
+                if lab1:
+                    break
+                self.cursor = self.limit - v_2
+                # <-, line 68
+                if not self.slice_from(u"ie"):
+                    return False
+                break
+        elif among_var == 3:
+            # (, line 69
+            # next, line 69
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            # gopast, line 69
+            if not self.go_out_grouping_b(EnglishStemmer.g_v):
+                return False
+            self.cursor -= 1
+            # delete, line 69
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_Step_1b(self):
+        # (, line 74
+        # [, line 75
+        self.ket = self.cursor
+        # substring, line 75
+        among_var = self.find_among_b(EnglishStemmer.a_4, EnglishStemmer.d_4)
+        if among_var == 0:
+            return False
+        # ], line 75
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 77
+            # call R1, line 77
+            if not self.r_R1():
+                return False
+            # <-, line 77
+            if not self.slice_from(u"ee"):
+                return False
+        elif among_var == 2:
+            # (, line 79
+            # test, line 80
+            v_1 = self.limit - self.cursor
+            # gopast, line 80
+            if not self.go_out_grouping_b(EnglishStemmer.g_v):
+                return False
+            self.cursor -= 1
+            self.cursor = self.limit - v_1
+            # delete, line 80
+            if not self.slice_del():
+                return False
+
+            # test, line 81
+            v_2 = self.limit - self.cursor
+            # substring, line 81
+            among_var = self.find_among_b(EnglishStemmer.a_3, EnglishStemmer.d_3)
+            if among_var == 0:
+                return False
+            self.cursor = self.limit - v_2
+            if among_var == 0:
+                return False
+            elif among_var == 1:
+                # (, line 83
+                # <+, line 83
+                c = self.cursor
+                self.insert(self.cursor, self.cursor, u"e")
+                self.cursor = c
+            elif among_var == 2:
+                # (, line 86
+                # [, line 86
+                self.ket = self.cursor
+                # next, line 86
+                if self.cursor <= self.limit_backward:
+                    return False
+                self.cursor -= 1
+                # ], line 86
+                self.bra = self.cursor
+                # delete, line 86
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 3:
+                # (, line 87
+                # atmark, line 87
+                if self.cursor != self.I_p1:
+                    return False
+                # test, line 87
+                v_3 = self.limit - self.cursor
+                # call shortv, line 87
+                if not self.r_shortv():
+                    return False
+                self.cursor = self.limit - v_3
+                # <+, line 87
+                c = self.cursor
+                self.insert(self.cursor, self.cursor, u"e")
+                self.cursor = c
+        return True
+
+    def r_Step_1c(self):
+        # (, line 93
+        # [, line 94
+        self.ket = self.cursor
+        # or, line 94
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # literal, line 94
+                if not self.eq_s_b(1, u"y"):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # literal, line 94
+            if not self.eq_s_b(1, u"Y"):
+                return False
+            break
+        # ], line 94
+        self.bra = self.cursor
+        if not self.out_grouping_b(EnglishStemmer.g_v):
+            return False
+        # not, line 95
+        v_2 = self.limit - self.cursor
+        while True:
+            # atlimit, line 95
+            if self.cursor > self.limit_backward:
+                break
+            return False
+        self.cursor = self.limit - v_2
+        # <-, line 96
+        if not self.slice_from(u"i"):
+            return False
+        return True
+
+    def r_Step_2(self):
+        # (, line 99
+        # [, line 100
+        self.ket = self.cursor
+        # substring, line 100
+        among_var = self.find_among_b(EnglishStemmer.a_5, EnglishStemmer.d_5)
+        if among_var == 0:
+            return False
+        # ], line 100
+        self.bra = self.cursor
+        # call R1, line 100
+        if not self.r_R1():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 101
+            # <-, line 101
+            if not self.slice_from(u"tion"):
+                return False
+        elif among_var == 2:
+            # (, line 102
+            # <-, line 102
+            if not self.slice_from(u"ence"):
+                return False
+        elif among_var == 3:
+            # (, line 103
+            # <-, line 103
+            if not self.slice_from(u"ance"):
+                return False
+        elif among_var == 4:
+            # (, line 104
+            # <-, line 104
+            if not self.slice_from(u"able"):
+                return False
+        elif among_var == 5:
+            # (, line 105
+            # <-, line 105
+            if not self.slice_from(u"ent"):
+                return False
+        elif among_var == 6:
+            # (, line 107
+            # <-, line 107
+            if not self.slice_from(u"ize"):
+                return False
+        elif among_var == 7:
+            # (, line 109
+            # <-, line 109
+            if not self.slice_from(u"ate"):
+                return False
+        elif among_var == 8:
+            # (, line 111
+            # <-, line 111
+            if not self.slice_from(u"al"):
+                return False
+        elif among_var == 9:
+            # (, line 112
+            # <-, line 112
+            if not self.slice_from(u"ful"):
+                return False
+        elif among_var == 10:
+            # (, line 114
+            # <-, line 114
+            if not self.slice_from(u"ous"):
+                return False
+        elif among_var == 11:
+            # (, line 116
+            # <-, line 116
+            if not self.slice_from(u"ive"):
+                return False
+        elif among_var == 12:
+            # (, line 118
+            # <-, line 118
+            if not self.slice_from(u"ble"):
+                return False
+        elif among_var == 13:
+            # (, line 119
+            # literal, line 119
+            if not self.eq_s_b(1, u"l"):
+                return False
+            # <-, line 119
+            if not self.slice_from(u"og"):
+                return False
+        elif among_var == 14:
+            # (, line 120
+            # <-, line 120
+            if not self.slice_from(u"ful"):
+                return False
+        elif among_var == 15:
+            # (, line 121
+            # <-, line 121
+            if not self.slice_from(u"less"):
+                return False
+        elif among_var == 16:
+            # (, line 122
+            if not self.in_grouping_b(EnglishStemmer.g_valid_LI):
+                return False
+            # delete, line 122
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_Step_3(self):
+        # (, line 126
+        # [, line 127
+        self.ket = self.cursor
+        # substring, line 127
+        among_var = self.find_among_b(EnglishStemmer.a_6, EnglishStemmer.d_6)
+        if among_var == 0:
+            return False
+        # ], line 127
+        self.bra = self.cursor
+        # call R1, line 127
+        if not self.r_R1():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 128
+            # <-, line 128
+            if not self.slice_from(u"tion"):
+                return False
+        elif among_var == 2:
+            # (, line 129
+            # <-, line 129
+            if not self.slice_from(u"ate"):
+                return False
+        elif among_var == 3:
+            # (, line 130
+            # <-, line 130
+            if not self.slice_from(u"al"):
+                return False
+        elif among_var == 4:
+            # (, line 132
+            # <-, line 132
+            if not self.slice_from(u"ic"):
+                return False
+        elif among_var == 5:
+            # (, line 134
+            # delete, line 134
+            if not self.slice_del():
+                return False
+
+        elif among_var == 6:
+            # (, line 136
+            # call R2, line 136
+            if not self.r_R2():
+                return False
+            # delete, line 136
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_Step_4(self):
+        # (, line 140
+        # [, line 141
+        self.ket = self.cursor
+        # substring, line 141
+        among_var = self.find_among_b(EnglishStemmer.a_7, EnglishStemmer.d_7)
+        if among_var == 0:
+            return False
+        # ], line 141
+        self.bra = self.cursor
+        # call R2, line 141
+        if not self.r_R2():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 144
+            # delete, line 144
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 145
+            # or, line 145
+            while True:
+                lab0 = False
+                v_1 = self.limit - self.cursor
+                while True:
+                    # literal, line 145
+                    if not self.eq_s_b(1, u"s"):
+                        break
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_1
+                # literal, line 145
+                if not self.eq_s_b(1, u"t"):
+                    return False
+                break
+            # delete, line 145
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_Step_5(self):
+        # (, line 149
+        # [, line 150
+        self.ket = self.cursor
+        # substring, line 150
+        among_var = self.find_among_b(EnglishStemmer.a_8, EnglishStemmer.d_8)
+        if among_var == 0:
+            return False
+        # ], line 150
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 151
+            # or, line 151
+            while True:
+                lab0 = False
+                v_1 = self.limit - self.cursor
+                while True:
+                    # call R2, line 151
+                    if not self.r_R2():
+                        break
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_1
+                # (, line 151
+                # call R1, line 151
+                if not self.r_R1():
+                    return False
+                # not, line 151
+                v_2 = self.limit - self.cursor
+                while True:
+                    # call shortv, line 151
+                    if not self.r_shortv():
+                        break
+                    return False
+                self.cursor = self.limit - v_2
+                break
+            # delete, line 151
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 152
+            # call R2, line 152
+            if not self.r_R2():
+                return False
+            # literal, line 152
+            if not self.eq_s_b(1, u"l"):
+                return False
+            # delete, line 152
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_exception2(self):
+        # (, line 156
+        # [, line 158
+        self.ket = self.cursor
+        # substring, line 158
+        if self.find_among_b(EnglishStemmer.a_9, EnglishStemmer.d_9) == 0:
+            return False
+        # ], line 158
+        self.bra = self.cursor
+        # atlimit, line 158
+        if self.cursor > self.limit_backward:
+            return False
+        return True
+
+    def r_exception1(self):
+        # (, line 168
+        # [, line 170
+        self.bra = self.cursor
+        # substring, line 170
+        among_var = self.find_among(EnglishStemmer.a_10, EnglishStemmer.d_10)
+        if among_var == 0:
+            return False
+        # ], line 170
+        self.ket = self.cursor
+        # atlimit, line 170
+        if self.cursor < self.limit:
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 174
+            # <-, line 174
+            if not self.slice_from(u"ski"):
+                return False
+        elif among_var == 2:
+            # (, line 175
+            # <-, line 175
+            if not self.slice_from(u"sky"):
+                return False
+        elif among_var == 3:
+            # (, line 176
+            # <-, line 176
+            if not self.slice_from(u"die"):
+                return False
+        elif among_var == 4:
+            # (, line 177
+            # <-, line 177
+            if not self.slice_from(u"lie"):
+                return False
+        elif among_var == 5:
+            # (, line 178
+            # <-, line 178
+            if not self.slice_from(u"tie"):
+                return False
+        elif among_var == 6:
+            # (, line 182
+            # <-, line 182
+            if not self.slice_from(u"idl"):
+                return False
+        elif among_var == 7:
+            # (, line 183
+            # <-, line 183
+            if not self.slice_from(u"gentl"):
+                return False
+        elif among_var == 8:
+            # (, line 184
+            # <-, line 184
+            if not self.slice_from(u"ugli"):
+                return False
+        elif among_var == 9:
+            # (, line 185
+            # <-, line 185
+            if not self.slice_from(u"earli"):
+                return False
+        elif among_var == 10:
+            # (, line 186
+            # <-, line 186
+            if not self.slice_from(u"onli"):
+                return False
+        elif among_var == 11:
+            # (, line 187
+            # <-, line 187
+            if not self.slice_from(u"singl"):
+                return False
+        return True
+
+    def r_postlude(self):
+        # (, line 203
+        # Boolean test Y_found, line 203
+        if not self.B_Y_found:
+            return False
+        # repeat, line 203
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                lab2 = False
+                # (, line 203
+                # goto, line 203
+                while True:
+                    lab3 = False
+                    v_2 = self.cursor
+                    while True:
+                        # (, line 203
+                        # [, line 203
+                        self.bra = self.cursor
+                        # literal, line 203
+                        if not self.eq_s(1, u"Y"):
+                            break
+                        # ], line 203
+                        self.ket = self.cursor
+                        self.cursor = v_2
+                        lab3 = True
+                        break
+                    if lab3:
+                        break
+                    self.cursor = v_2
+                    if self.cursor >= self.limit:
+                        lab2 = True
+                        break
+                    self.cursor += 1
+                if lab2:
+                    break
+                # <-, line 203
+                if not self.slice_from(u"y"):
+                    return False
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def _stem(self):
+        # (, line 205
+        # or, line 207
+        while True:
+            lab0 = False
+            v_1 = self.cursor
+            while True:
+                # call exception1, line 207
+                if not self.r_exception1():
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = v_1
+            while True:
+                lab2 = False
+                # not, line 208
+                v_2 = self.cursor
+                while True:
+                    # hop, line 208
+                    c = self.cursor + 3
+                    if 0 > c or c > self.limit:
+                        break
+                    self.cursor = c
+                    lab2 = True
+                    break
+                if lab2:
+                    break
+                self.cursor = v_2
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = v_1
+            # (, line 208
+            # do, line 209
+            v_3 = self.cursor
+            while True:
+                # call prelude, line 209
+                if not self.r_prelude():
+                    break
+                break
+            self.cursor = v_3
+            # do, line 210
+            v_4 = self.cursor
+            while True:
+                # call mark_regions, line 210
+                if not self.r_mark_regions():
+                    break
+                break
+            self.cursor = v_4
+            # backwards, line 211
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            # (, line 211
+            # do, line 213
+            v_5 = self.limit - self.cursor
+            while True:
+                # call Step_1a, line 213
+                if not self.r_Step_1a():
+                    break
+                break
+            self.cursor = self.limit - v_5
+            # or, line 215
+            while True:
+                lab7 = False
+                v_6 = self.limit - self.cursor
+                while True:
+                    # call exception2, line 215
+                    if not self.r_exception2():
+                        break
+                    lab7 = True
+                    break
+                if lab7:
+                    break
+                self.cursor = self.limit - v_6
+                # (, line 215
+                # do, line 217
+                v_7 = self.limit - self.cursor
+                while True:
+                    # call Step_1b, line 217
+                    if not self.r_Step_1b():
+                        break
+                    break
+                self.cursor = self.limit - v_7
+                # do, line 218
+                v_8 = self.limit - self.cursor
+                while True:
+                    # call Step_1c, line 218
+                    if not self.r_Step_1c():
+                        break
+                    break
+                self.cursor = self.limit - v_8
+                # do, line 220
+                v_9 = self.limit - self.cursor
+                while True:
+                    # call Step_2, line 220
+                    if not self.r_Step_2():
+                        break
+                    break
+                self.cursor = self.limit - v_9
+                # do, line 221
+                v_10 = self.limit - self.cursor
+                while True:
+                    # call Step_3, line 221
+                    if not self.r_Step_3():
+                        break
+                    break
+                self.cursor = self.limit - v_10
+                # do, line 222
+                v_11 = self.limit - self.cursor
+                while True:
+                    # call Step_4, line 222
+                    if not self.r_Step_4():
+                        break
+                    break
+                self.cursor = self.limit - v_11
+                # do, line 224
+                v_12 = self.limit - self.cursor
+                while True:
+                    # call Step_5, line 224
+                    if not self.r_Step_5():
+                        break
+                    break
+                self.cursor = self.limit - v_12
+                break
+            self.cursor = self.limit_backward
+            # do, line 227
+            v_13 = self.cursor
+            while True:
+                # call postlude, line 227
+                if not self.r_postlude():
+                    break
+                break
+            self.cursor = v_13
+            break
+        return True
+
+    def stem_light(self):
+        # (, line 233
+        # or, line 235
+        while True:
+            lab0 = False
+            v_1 = self.cursor
+            while True:
+                # call exception1, line 235
+                if not self.r_exception1():
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = v_1
+            while True:
+                lab2 = False
+                # not, line 236
+                v_2 = self.cursor
+                while True:
+                    # hop, line 236
+                    c = self.cursor + 3
+                    if 0 > c or c > self.limit:
+                        break
+                    self.cursor = c
+                    lab2 = True
+                    break
+                if lab2:
+                    break
+                self.cursor = v_2
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = v_1
+            # (, line 236
+            # do, line 237
+            v_3 = self.cursor
+            while True:
+                # call prelude, line 237
+                if not self.r_prelude():
+                    break
+                break
+            self.cursor = v_3
+            # backwards, line 238
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            # (, line 238
+            # do, line 238
+            v_4 = self.limit - self.cursor
+            while True:
+                # call Step_1a, line 238
+                if not self.r_Step_1a():
+                    break
+                break
+            self.cursor = self.limit - v_4
+            self.cursor = self.limit_backward
+            # do, line 239
+            v_5 = self.cursor
+            while True:
+                # call postlude, line 239
+                if not self.r_postlude():
+                    break
+                break
+            self.cursor = v_5
+            break
+        return True
@@ -0,0 +1,663 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class GermanStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"", -1, 6),
+        Among(u"U", 0, 2),
+        Among(u"Y", 0, 1),
+        Among(u"\u00E4", 0, 3),
+        Among(u"\u00F6", 0, 4),
+        Among(u"\u00FC", 0, 5)
+    ]
+
+    d_0 = (
+        (1, {
+            u"U": 1,
+            u"Y": 2,
+            u"\u00E4": 3,
+            u"\u00F6": 4,
+            u"\u00FC": 5
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"e", -1, 2),
+        Among(u"em", -1, 1),
+        Among(u"en", -1, 2),
+        Among(u"ern", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"s", -1, 3),
+        Among(u"es", 5, 2)
+    ]
+
+    d_1 = (
+        (3, {
+            u"ern": 3
+        }),
+        (2, {
+            u"em": 1,
+            u"en": 2,
+            u"er": 4,
+            u"es": 6
+        }),
+        (1, {
+            u"e": 0,
+            u"s": 5
+        }),
+    )
+
+    a_2 = [
+        Among(u"en", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"st", -1, 2),
+        Among(u"est", 2, 1)
+    ]
+
+    d_2 = (
+        (3, {
+            u"est": 3
+        }),
+        (2, {
+            u"en": 0,
+            u"er": 1,
+            u"st": 2
+        }),
+    )
+
+    a_3 = [
+        Among(u"ig", -1, 1),
+        Among(u"lich", -1, 1)
+    ]
+
+    d_3 = (
+        (4, {
+            u"lich": 1
+        }),
+        (2, {
+            u"ig": 0
+        }),
+    )
+
+    a_4 = [
+        Among(u"end", -1, 1),
+        Among(u"ig", -1, 2),
+        Among(u"ung", -1, 1),
+        Among(u"lich", -1, 3),
+        Among(u"isch", -1, 2),
+        Among(u"ik", -1, 2),
+        Among(u"heit", -1, 3),
+        Among(u"keit", -1, 4)
+    ]
+
+    d_4 = (
+        (4, {
+            u"lich": 3,
+            u"isch": 4,
+            u"heit": 6,
+            u"keit": 7
+        }),
+        (3, {
+            u"end": 0,
+            u"ung": 2
+        }),
+        (2, {
+            u"ig": 1,
+            u"ik": 5
+        }),
+    )
+
+    g_v = frozenset(u"aeiouy\u00E4\u00F6\u00FC")
+
+    g_s_ending = frozenset(u"bdfghklmnrt")
+
+    g_st_ending = frozenset(u"bdfghklmnt")
+
+    I_x = 0
+    I_p2 = 0
+    I_p1 = 0
+
+    def copy_from(self, other):
+        self.I_x = other.I_x
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        super.copy_from(other)
+
+    def r_prelude(self):
+        # (, line 33
+        # test, line 35
+        v_1 = self.cursor
+        # repeat, line 35
+        while True:
+            lab1 = False
+            v_2 = self.cursor
+            while True:
+                lab2 = False
+                # (, line 35
+                # or, line 38
+                while True:
+                    lab3 = False
+                    v_3 = self.cursor
+                    while True:
+                        # (, line 36
+                        # [, line 37
+                        self.bra = self.cursor
+                        # literal, line 37
+                        if not self.eq_s(1, u"\u00DF"):
+                            break
+                        # ], line 37
+                        self.ket = self.cursor
+                        # <-, line 37
+                        if not self.slice_from(u"ss"):
+                            return False
+                        lab3 = True
+                        break
+                    if lab3:
+                        break
+                    self.cursor = v_3
+                    # next, line 38
+                    if self.cursor >= self.limit:
+                        lab2 = True
+                        break
+                    self.cursor += 1
+                    break
+                if lab2:
+                    break
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_2
+            break
+        self.cursor = v_1
+        # repeat, line 41
+        while True:
+            lab6 = False
+            v_4 = self.cursor
+            while True:
+                lab7 = False
+                # goto, line 41
+                while True:
+                    lab8 = False
+                    v_5 = self.cursor
+                    while True:
+                        lab9 = False
+                        # (, line 41
+                        if not self.in_grouping(GermanStemmer.g_v):
+                            break
+                        # [, line 42
+                        self.bra = self.cursor
+                        # or, line 42
+                        while True:
+                            lab10 = False
+                            v_6 = self.cursor
+                            while True:
+                                # (, line 42
+                                # literal, line 42
+                                if not self.eq_s(1, u"u"):
+                                    break
+                                # ], line 42
+                                self.ket = self.cursor
+                                if not self.in_grouping(GermanStemmer.g_v):
+                                    break
+                                # <-, line 42
+                                if not self.slice_from(u"U"):
+                                    return False
+                                lab10 = True
+                                break
+                            if lab10:
+                                break
+                            self.cursor = v_6
+                            # (, line 43
+                            # literal, line 43
+                            if not self.eq_s(1, u"y"):
+                                lab9 = True
+                                break
+                            # ], line 43
+                            self.ket = self.cursor
+                            if not self.in_grouping(GermanStemmer.g_v):
+                                lab9 = True
+                                break
+                            # <-, line 43
+                            if not self.slice_from(u"Y"):
+                                return False
+                            break
+                        if lab9:
+                            break
+                        self.cursor = v_5
+                        lab8 = True
+                        break
+                    if lab8:
+                        break
+                    self.cursor = v_5
+                    if self.cursor >= self.limit:
+                        lab7 = True
+                        break
+                    self.cursor += 1
+                if lab7:
+                    break
+                lab6 = True
+                break
+            if lab6:
+                continue
+            self.cursor = v_4
+            break
+        return True
+
+    def r_mark_regions(self):
+        # (, line 47
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # test, line 52
+        v_1 = self.cursor
+        # (, line 52
+        # hop, line 52
+        c = self.cursor + 3
+        if 0 > c or c > self.limit:
+            return False
+        self.cursor = c
+        # setmark x, line 52
+        self.I_x = self.cursor
+        self.cursor = v_1
+        # gopast, line 54
+        if not self.go_out_grouping(GermanStemmer.g_v):
+            return False
+        self.cursor += 1
+        # gopast, line 54
+        if not self.go_in_grouping(GermanStemmer.g_v):
+            return False
+        self.cursor += 1
+        # setmark p1, line 54
+        self.I_p1 = self.cursor
+        # try, line 55
+        while True:
+            # (, line 55
+            if not (self.I_p1 < self.I_x):
+                break
+            self.I_p1 = self.I_x
+            break
+        # gopast, line 56
+        if not self.go_out_grouping(GermanStemmer.g_v):
+            return False
+        self.cursor += 1
+        # gopast, line 56
+        if not self.go_in_grouping(GermanStemmer.g_v):
+            return False
+        self.cursor += 1
+        # setmark p2, line 56
+        self.I_p2 = self.cursor
+        return True
+
+    def r_postlude(self):
+        # repeat, line 60
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 60
+                # [, line 62
+                self.bra = self.cursor
+                # substring, line 62
+                among_var = self.find_among(GermanStemmer.a_0, GermanStemmer.d_0)
+                if among_var == 0:
+                    break
+                # ], line 62
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 63
+                    # <-, line 63
+                    if not self.slice_from(u"y"):
+                        return False
+                elif among_var == 2:
+                    # (, line 64
+                    # <-, line 64
+                    if not self.slice_from(u"u"):
+                        return False
+                elif among_var == 3:
+                    # (, line 65
+                    # <-, line 65
+                    if not self.slice_from(u"a"):
+                        return False
+                elif among_var == 4:
+                    # (, line 66
+                    # <-, line 66
+                    if not self.slice_from(u"o"):
+                        return False
+                elif among_var == 5:
+                    # (, line 67
+                    # <-, line 67
+                    if not self.slice_from(u"u"):
+                        return False
+                elif among_var == 6:
+                    # (, line 68
+                    # next, line 68
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_standard_suffix(self):
+        # (, line 78
+        # do, line 79
+        v_1 = self.limit - self.cursor
+        while True:
+            # (, line 79
+            # [, line 80
+            self.ket = self.cursor
+            # substring, line 80
+            among_var = self.find_among_b(GermanStemmer.a_1, GermanStemmer.d_1)
+            if among_var == 0:
+                break
+            # ], line 80
+            self.bra = self.cursor
+            # call R1, line 80
+            if not self.r_R1():
+                break
+            if among_var == 0:
+                break
+            elif among_var == 1:
+                # (, line 82
+                # delete, line 82
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 2:
+                # (, line 85
+                # delete, line 85
+                if not self.slice_del():
+                    return False
+
+                # try, line 86
+                v_2 = self.limit - self.cursor
+                while True:
+                    # (, line 86
+                    # [, line 86
+                    self.ket = self.cursor
+                    # literal, line 86
+                    if not self.eq_s_b(1, u"s"):
+                        self.cursor = self.limit - v_2
+                        break
+                    # ], line 86
+                    self.bra = self.cursor
+                    # literal, line 86
+                    if not self.eq_s_b(3, u"nis"):
+                        self.cursor = self.limit - v_2
+                        break
+                    # delete, line 86
+                    if not self.slice_del():
+                        return False
+
+                    break
+            elif among_var == 3:
+                # (, line 89
+                if not self.in_grouping_b(GermanStemmer.g_s_ending):
+                    break
+                # delete, line 89
+                if not self.slice_del():
+                    return False
+
+            break
+        self.cursor = self.limit - v_1
+        # do, line 93
+        v_3 = self.limit - self.cursor
+        while True:
+            # (, line 93
+            # [, line 94
+            self.ket = self.cursor
+            # substring, line 94
+            among_var = self.find_among_b(GermanStemmer.a_2, GermanStemmer.d_2)
+            if among_var == 0:
+                break
+            # ], line 94
+            self.bra = self.cursor
+            # call R1, line 94
+            if not self.r_R1():
+                break
+            if among_var == 0:
+                break
+            elif among_var == 1:
+                # (, line 96
+                # delete, line 96
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 2:
+                # (, line 99
+                if not self.in_grouping_b(GermanStemmer.g_st_ending):
+                    break
+                # hop, line 99
+                c = self.cursor - 3
+                if self.limit_backward > c or c > self.limit:
+                    break
+                self.cursor = c
+                # delete, line 99
+                if not self.slice_del():
+                    return False
+
+            break
+        self.cursor = self.limit - v_3
+        # do, line 103
+        v_4 = self.limit - self.cursor
+        while True:
+            lab3 = False
+            # (, line 103
+            # [, line 104
+            self.ket = self.cursor
+            # substring, line 104
+            among_var = self.find_among_b(GermanStemmer.a_4, GermanStemmer.d_4)
+            if among_var == 0:
+                break
+            # ], line 104
+            self.bra = self.cursor
+            # call R2, line 104
+            if not self.r_R2():
+                break
+            if among_var == 0:
+                break
+            elif among_var == 1:
+                # (, line 106
+                # delete, line 106
+                if not self.slice_del():
+                    return False
+
+                # try, line 107
+                v_5 = self.limit - self.cursor
+                while True:
+                    lab4 = False
+                    # (, line 107
+                    # [, line 107
+                    self.ket = self.cursor
+                    # literal, line 107
+                    if not self.eq_s_b(2, u"ig"):
+                        self.cursor = self.limit - v_5
+                        break
+                    # ], line 107
+                    self.bra = self.cursor
+                    # not, line 107
+                    v_6 = self.limit - self.cursor
+                    while True:
+                        # literal, line 107
+                        if not self.eq_s_b(1, u"e"):
+                            break
+                        self.cursor = self.limit - v_5
+                        lab4 = True
+                        break
+                    if lab4:
+                        break
+                    self.cursor = self.limit - v_6
+                    # call R2, line 107
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_5
+                        break
+                    # delete, line 107
+                    if not self.slice_del():
+                        return False
+
+                    break
+            elif among_var == 2:
+                # (, line 110
+                # not, line 110
+                v_7 = self.limit - self.cursor
+                while True:
+                    # literal, line 110
+                    if not self.eq_s_b(1, u"e"):
+                        break
+                    lab3 = True
+                    break
+                if lab3:
+                    break
+                self.cursor = self.limit - v_7
+                # delete, line 110
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 3:
+                # (, line 113
+                # delete, line 113
+                if not self.slice_del():
+                    return False
+
+                # try, line 114
+                v_8 = self.limit - self.cursor
+                while True:
+                    lab7 = False
+                    # (, line 114
+                    # [, line 115
+                    self.ket = self.cursor
+                    # or, line 115
+                    while True:
+                        lab8 = False
+                        v_9 = self.limit - self.cursor
+                        while True:
+                            # literal, line 115
+                            if not self.eq_s_b(2, u"er"):
+                                break
+                            lab8 = True
+                            break
+                        if lab8:
+                            break
+                        self.cursor = self.limit - v_9
+                        # literal, line 115
+                        if not self.eq_s_b(2, u"en"):
+                            self.cursor = self.limit - v_8
+                            lab7 = True
+                            break
+                        break
+                    if lab7:
+                        break
+                    # ], line 115
+                    self.bra = self.cursor
+                    # call R1, line 115
+                    if not self.r_R1():
+                        self.cursor = self.limit - v_8
+                        break
+                    # delete, line 115
+                    if not self.slice_del():
+                        return False
+
+                    break
+            elif among_var == 4:
+                # (, line 119
+                # delete, line 119
+                if not self.slice_del():
+                    return False
+
+                # try, line 120
+                v_10 = self.limit - self.cursor
+                while True:
+                    # (, line 120
+                    # [, line 121
+                    self.ket = self.cursor
+                    # substring, line 121
+                    among_var = self.find_among_b(GermanStemmer.a_3, GermanStemmer.d_3)
+                    if among_var == 0:
+                        self.cursor = self.limit - v_10
+                        break
+                    # ], line 121
+                    self.bra = self.cursor
+                    # call R2, line 121
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_10
+                        break
+                    if among_var == 0:
+                        self.cursor = self.limit - v_10
+                        break
+                    elif among_var == 1:
+                        # (, line 123
+                        # delete, line 123
+                        if not self.slice_del():
+                            return False
+
+                    break
+            break
+        self.cursor = self.limit - v_4
+        return True
+
+    def _stem(self):
+        # (, line 133
+        # do, line 134
+        v_1 = self.cursor
+        while True:
+            # call prelude, line 134
+            if not self.r_prelude():
+                break
+            break
+        self.cursor = v_1
+        # do, line 135
+        v_2 = self.cursor
+        while True:
+            # call mark_regions, line 135
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_2
+        # backwards, line 136
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # do, line 137
+        v_3 = self.limit - self.cursor
+        while True:
+            # call standard_suffix, line 137
+            if not self.r_standard_suffix():
+                break
+            break
+        self.cursor = self.limit - v_3
+        self.cursor = self.limit_backward
+        # do, line 138
+        v_4 = self.cursor
+        while True:
+            # call postlude, line 138
+            if not self.r_postlude():
+                break
+            break
+        self.cursor = v_4
+        return True
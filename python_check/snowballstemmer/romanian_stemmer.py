@@ -0,0 +1,1149 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class RomanianStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"", -1, 3),
+        Among(u"I", 0, 1),
+        Among(u"U", 0, 2)
+    ]
+
+    d_0 = (
+        (1, {
+            u"I": 1,
+            u"U": 2
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"ea", -1, 3),
+        Among(u"a\u0163ia", -1, 7),
+        Among(u"aua", -1, 2),
+        Among(u"iua", -1, 4),
+        Among(u"a\u0163ie", -1, 7),
+        Among(u"ele", -1, 3),
+        Among(u"ile", -1, 5),
+        Among(u"iile", 6, 4),
+        Among(u"iei", -1, 4),
+        Among(u"atei", -1, 6),
+        Among(u"ii", -1, 4),
+        Among(u"ului", -1, 1),
+        Among(u"ul", -1, 1),
+        Among(u"elor", -1, 3),
+        Among(u"ilor", -1, 4),
+        Among(u"iilor", 14, 4)
+    ]
+
+    d_1 = (
+        (5, {
+            u"iilor": 15
+        }),
+        (4, {
+            u"a\u0163ia": 1,
+            u"a\u0163ie": 4,
+            u"iile": 7,
+            u"atei": 9,
+            u"ului": 11,
+            u"elor": 13,
+            u"ilor": 14
+        }),
+        (3, {
+            u"aua": 2,
+            u"iua": 3,
+            u"ele": 5,
+            u"ile": 6,
+            u"iei": 8
+        }),
+        (2, {
+            u"ea": 0,
+            u"ii": 10,
+            u"ul": 12
+        }),
+    )
+
+    a_2 = [
+        Among(u"icala", -1, 4),
+        Among(u"iciva", -1, 4),
+        Among(u"ativa", -1, 5),
+        Among(u"itiva", -1, 6),
+        Among(u"icale", -1, 4),
+        Among(u"a\u0163iune", -1, 5),
+        Among(u"i\u0163iune", -1, 6),
+        Among(u"atoare", -1, 5),
+        Among(u"itoare", -1, 6),
+        Among(u"\u0103toare", -1, 5),
+        Among(u"icitate", -1, 4),
+        Among(u"abilitate", -1, 1),
+        Among(u"ibilitate", -1, 2),
+        Among(u"ivitate", -1, 3),
+        Among(u"icive", -1, 4),
+        Among(u"ative", -1, 5),
+        Among(u"itive", -1, 6),
+        Among(u"icali", -1, 4),
+        Among(u"atori", -1, 5),
+        Among(u"icatori", 18, 4),
+        Among(u"itori", -1, 6),
+        Among(u"\u0103tori", -1, 5),
+        Among(u"icitati", -1, 4),
+        Among(u"abilitati", -1, 1),
+        Among(u"ivitati", -1, 3),
+        Among(u"icivi", -1, 4),
+        Among(u"ativi", -1, 5),
+        Among(u"itivi", -1, 6),
+        Among(u"icit\u0103i", -1, 4),
+        Among(u"abilit\u0103i", -1, 1),
+        Among(u"ivit\u0103i", -1, 3),
+        Among(u"icit\u0103\u0163i", -1, 4),
+        Among(u"abilit\u0103\u0163i", -1, 1),
+        Among(u"ivit\u0103\u0163i", -1, 3),
+        Among(u"ical", -1, 4),
+        Among(u"ator", -1, 5),
+        Among(u"icator", 35, 4),
+        Among(u"itor", -1, 6),
+        Among(u"\u0103tor", -1, 5),
+        Among(u"iciv", -1, 4),
+        Among(u"ativ", -1, 5),
+        Among(u"itiv", -1, 6),
+        Among(u"ical\u0103", -1, 4),
+        Among(u"iciv\u0103", -1, 4),
+        Among(u"ativ\u0103", -1, 5),
+        Among(u"itiv\u0103", -1, 6)
+    ]
+
+    d_2 = (
+        (9, {
+            u"abilitate": 11,
+            u"ibilitate": 12,
+            u"abilitati": 23,
+            u"abilit\u0103\u0163i": 32
+        }),
+        (8, {
+            u"abilit\u0103i": 29
+        }),
+        (7, {
+            u"icitate": 10,
+            u"ivitate": 13,
+            u"icatori": 19,
+            u"icitati": 22,
+            u"ivitati": 24,
+            u"icit\u0103\u0163i": 31,
+            u"ivit\u0103\u0163i": 33
+        }),
+        (6, {
+            u"a\u0163iune": 5,
+            u"i\u0163iune": 6,
+            u"atoare": 7,
+            u"itoare": 8,
+            u"\u0103toare": 9,
+            u"icit\u0103i": 28,
+            u"ivit\u0103i": 30,
+            u"icator": 36
+        }),
+        (5, {
+            u"icala": 0,
+            u"iciva": 1,
+            u"ativa": 2,
+            u"itiva": 3,
+            u"icale": 4,
+            u"icive": 14,
+            u"ative": 15,
+            u"itive": 16,
+            u"icali": 17,
+            u"atori": 18,
+            u"itori": 20,
+            u"\u0103tori": 21,
+            u"icivi": 25,
+            u"ativi": 26,
+            u"itivi": 27,
+            u"ical\u0103": 42,
+            u"iciv\u0103": 43,
+            u"ativ\u0103": 44,
+            u"itiv\u0103": 45
+        }),
+        (4, {
+            u"ical": 34,
+            u"ator": 35,
+            u"itor": 37,
+            u"\u0103tor": 38,
+            u"iciv": 39,
+            u"ativ": 40,
+            u"itiv": 41
+        }),
+    )
+
+    a_3 = [
+        Among(u"ica", -1, 1),
+        Among(u"abila", -1, 1),
+        Among(u"ibila", -1, 1),
+        Among(u"oasa", -1, 1),
+        Among(u"ata", -1, 1),
+        Among(u"ita", -1, 1),
+        Among(u"anta", -1, 1),
+        Among(u"ista", -1, 3),
+        Among(u"uta", -1, 1),
+        Among(u"iva", -1, 1),
+        Among(u"ic", -1, 1),
+        Among(u"ice", -1, 1),
+        Among(u"abile", -1, 1),
+        Among(u"ibile", -1, 1),
+        Among(u"isme", -1, 3),
+        Among(u"iune", -1, 2),
+        Among(u"oase", -1, 1),
+        Among(u"ate", -1, 1),
+        Among(u"itate", 17, 1),
+        Among(u"ite", -1, 1),
+        Among(u"ante", -1, 1),
+        Among(u"iste", -1, 3),
+        Among(u"ute", -1, 1),
+        Among(u"ive", -1, 1),
+        Among(u"ici", -1, 1),
+        Among(u"abili", -1, 1),
+        Among(u"ibili", -1, 1),
+        Among(u"iuni", -1, 2),
+        Among(u"atori", -1, 1),
+        Among(u"osi", -1, 1),
+        Among(u"ati", -1, 1),
+        Among(u"itati", 30, 1),
+        Among(u"iti", -1, 1),
+        Among(u"anti", -1, 1),
+        Among(u"isti", -1, 3),
+        Among(u"uti", -1, 1),
+        Among(u"i\u015Fti", -1, 3),
+        Among(u"ivi", -1, 1),
+        Among(u"it\u0103i", -1, 1),
+        Among(u"o\u015Fi", -1, 1),
+        Among(u"it\u0103\u0163i", -1, 1),
+        Among(u"abil", -1, 1),
+        Among(u"ibil", -1, 1),
+        Among(u"ism", -1, 3),
+        Among(u"ator", -1, 1),
+        Among(u"os", -1, 1),
+        Among(u"at", -1, 1),
+        Among(u"it", -1, 1),
+        Among(u"ant", -1, 1),
+        Among(u"ist", -1, 3),
+        Among(u"ut", -1, 1),
+        Among(u"iv", -1, 1),
+        Among(u"ic\u0103", -1, 1),
+        Among(u"abil\u0103", -1, 1),
+        Among(u"ibil\u0103", -1, 1),
+        Among(u"oas\u0103", -1, 1),
+        Among(u"at\u0103", -1, 1),
+        Among(u"it\u0103", -1, 1),
+        Among(u"ant\u0103", -1, 1),
+        Among(u"ist\u0103", -1, 3),
+        Among(u"ut\u0103", -1, 1),
+        Among(u"iv\u0103", -1, 1)
+    ]
+
+    d_3 = (
+        (5, {
+            u"abila": 1,
+            u"ibila": 2,
+            u"abile": 12,
+            u"ibile": 13,
+            u"itate": 18,
+            u"abili": 25,
+            u"ibili": 26,
+            u"atori": 28,
+            u"itati": 31,
+            u"it\u0103\u0163i": 40,
+            u"abil\u0103": 53,
+            u"ibil\u0103": 54
+        }),
+        (4, {
+            u"oasa": 3,
+            u"anta": 6,
+            u"ista": 7,
+            u"isme": 14,
+            u"iune": 15,
+            u"oase": 16,
+            u"ante": 20,
+            u"iste": 21,
+            u"iuni": 27,
+            u"anti": 33,
+            u"isti": 34,
+            u"i\u015Fti": 36,
+            u"it\u0103i": 38,
+            u"abil": 41,
+            u"ibil": 42,
+            u"ator": 44,
+            u"oas\u0103": 55,
+            u"ant\u0103": 58,
+            u"ist\u0103": 59
+        }),
+        (3, {
+            u"ica": 0,
+            u"ata": 4,
+            u"ita": 5,
+            u"uta": 8,
+            u"iva": 9,
+            u"ice": 11,
+            u"ate": 17,
+            u"ite": 19,
+            u"ute": 22,
+            u"ive": 23,
+            u"ici": 24,
+            u"osi": 29,
+            u"ati": 30,
+            u"iti": 32,
+            u"uti": 35,
+            u"ivi": 37,
+            u"o\u015Fi": 39,
+            u"ism": 43,
+            u"ant": 48,
+            u"ist": 49,
+            u"ic\u0103": 52,
+            u"at\u0103": 56,
+            u"it\u0103": 57,
+            u"ut\u0103": 60,
+            u"iv\u0103": 61
+        }),
+        (2, {
+            u"ic": 10,
+            u"os": 45,
+            u"at": 46,
+            u"it": 47,
+            u"ut": 50,
+            u"iv": 51
+        }),
+    )
+
+    a_4 = [
+        Among(u"ea", -1, 1),
+        Among(u"ia", -1, 1),
+        Among(u"esc", -1, 1),
+        Among(u"\u0103sc", -1, 1),
+        Among(u"ind", -1, 1),
+        Among(u"\u00E2nd", -1, 1),
+        Among(u"are", -1, 1),
+        Among(u"ere", -1, 1),
+        Among(u"ire", -1, 1),
+        Among(u"\u00E2re", -1, 1),
+        Among(u"se", -1, 2),
+        Among(u"ase", 10, 1),
+        Among(u"sese", 10, 2),
+        Among(u"ise", 10, 1),
+        Among(u"use", 10, 1),
+        Among(u"\u00E2se", 10, 1),
+        Among(u"e\u015Fte", -1, 1),
+        Among(u"\u0103\u015Fte", -1, 1),
+        Among(u"eze", -1, 1),
+        Among(u"ai", -1, 1),
+        Among(u"eai", 19, 1),
+        Among(u"iai", 19, 1),
+        Among(u"sei", -1, 2),
+        Among(u"e\u015Fti", -1, 1),
+        Among(u"\u0103\u015Fti", -1, 1),
+        Among(u"ui", -1, 1),
+        Among(u"ezi", -1, 1),
+        Among(u"\u00E2i", -1, 1),
+        Among(u"a\u015Fi", -1, 1),
+        Among(u"se\u015Fi", -1, 2),
+        Among(u"ase\u015Fi", 29, 1),
+        Among(u"sese\u015Fi", 29, 2),
+        Among(u"ise\u015Fi", 29, 1),
+        Among(u"use\u015Fi", 29, 1),
+        Among(u"\u00E2se\u015Fi", 29, 1),
+        Among(u"i\u015Fi", -1, 1),
+        Among(u"u\u015Fi", -1, 1),
+        Among(u"\u00E2\u015Fi", -1, 1),
+        Among(u"a\u0163i", -1, 2),
+        Among(u"ea\u0163i", 38, 1),
+        Among(u"ia\u0163i", 38, 1),
+        Among(u"e\u0163i", -1, 2),
+        Among(u"i\u0163i", -1, 2),
+        Among(u"\u00E2\u0163i", -1, 2),
+        Among(u"ar\u0103\u0163i", -1, 1),
+        Among(u"ser\u0103\u0163i", -1, 2),
+        Among(u"aser\u0103\u0163i", 45, 1),
+        Among(u"seser\u0103\u0163i", 45, 2),
+        Among(u"iser\u0103\u0163i", 45, 1),
+        Among(u"user\u0103\u0163i", 45, 1),
+        Among(u"\u00E2ser\u0103\u0163i", 45, 1),
+        Among(u"ir\u0103\u0163i", -1, 1),
+        Among(u"ur\u0103\u0163i", -1, 1),
+        Among(u"\u00E2r\u0103\u0163i", -1, 1),
+        Among(u"am", -1, 1),
+        Among(u"eam", 54, 1),
+        Among(u"iam", 54, 1),
+        Among(u"em", -1, 2),
+        Among(u"asem", 57, 1),
+        Among(u"sesem", 57, 2),
+        Among(u"isem", 57, 1),
+        Among(u"usem", 57, 1),
+        Among(u"\u00E2sem", 57, 1),
+        Among(u"im", -1, 2),
+        Among(u"\u00E2m", -1, 2),
+        Among(u"\u0103m", -1, 2),
+        Among(u"ar\u0103m", 65, 1),
+        Among(u"ser\u0103m", 65, 2),
+        Among(u"aser\u0103m", 67, 1),
+        Among(u"seser\u0103m", 67, 2),
+        Among(u"iser\u0103m", 67, 1),
+        Among(u"user\u0103m", 67, 1),
+        Among(u"\u00E2ser\u0103m", 67, 1),
+        Among(u"ir\u0103m", 65, 1),
+        Among(u"ur\u0103m", 65, 1),
+        Among(u"\u00E2r\u0103m", 65, 1),
+        Among(u"au", -1, 1),
+        Among(u"eau", 76, 1),
+        Among(u"iau", 76, 1),
+        Among(u"indu", -1, 1),
+        Among(u"\u00E2ndu", -1, 1),
+        Among(u"ez", -1, 1),
+        Among(u"easc\u0103", -1, 1),
+        Among(u"ar\u0103", -1, 1),
+        Among(u"ser\u0103", -1, 2),
+        Among(u"aser\u0103", 84, 1),
+        Among(u"seser\u0103", 84, 2),
+        Among(u"iser\u0103", 84, 1),
+        Among(u"user\u0103", 84, 1),
+        Among(u"\u00E2ser\u0103", 84, 1),
+        Among(u"ir\u0103", -1, 1),
+        Among(u"ur\u0103", -1, 1),
+        Among(u"\u00E2r\u0103", -1, 1),
+        Among(u"eaz\u0103", -1, 1)
+    ]
+
+    d_4 = (
+        (8, {
+            u"seser\u0103\u0163i": 47
+        }),
+        (7, {
+            u"aser\u0103\u0163i": 46,
+            u"iser\u0103\u0163i": 48,
+            u"user\u0103\u0163i": 49,
+            u"\u00E2ser\u0103\u0163i": 50,
+            u"seser\u0103m": 69
+        }),
+        (6, {
+            u"sese\u015Fi": 31,
+            u"ser\u0103\u0163i": 45,
+            u"aser\u0103m": 68,
+            u"iser\u0103m": 70,
+            u"user\u0103m": 71,
+            u"\u00E2ser\u0103m": 72,
+            u"seser\u0103": 86
+        }),
+        (5, {
+            u"ase\u015Fi": 30,
+            u"ise\u015Fi": 32,
+            u"use\u015Fi": 33,
+            u"\u00E2se\u015Fi": 34,
+            u"ar\u0103\u0163i": 44,
+            u"ir\u0103\u0163i": 51,
+            u"ur\u0103\u0163i": 52,
+            u"\u00E2r\u0103\u0163i": 53,
+            u"sesem": 59,
+            u"ser\u0103m": 67,
+            u"easc\u0103": 82,
+            u"aser\u0103": 85,
+            u"iser\u0103": 87,
+            u"user\u0103": 88,
+            u"\u00E2ser\u0103": 89
+        }),
+        (4, {
+            u"sese": 12,
+            u"e\u015Fte": 16,
+            u"\u0103\u015Fte": 17,
+            u"e\u015Fti": 23,
+            u"\u0103\u015Fti": 24,
+            u"se\u015Fi": 29,
+            u"ea\u0163i": 39,
+            u"ia\u0163i": 40,
+            u"asem": 58,
+            u"isem": 60,
+            u"usem": 61,
+            u"\u00E2sem": 62,
+            u"ar\u0103m": 66,
+            u"ir\u0103m": 73,
+            u"ur\u0103m": 74,
+            u"\u00E2r\u0103m": 75,
+            u"indu": 79,
+            u"\u00E2ndu": 80,
+            u"ser\u0103": 84,
+            u"eaz\u0103": 93
+        }),
+        (3, {
+            u"esc": 2,
+            u"\u0103sc": 3,
+            u"ind": 4,
+            u"\u00E2nd": 5,
+            u"are": 6,
+            u"ere": 7,
+            u"ire": 8,
+            u"\u00E2re": 9,
+            u"ase": 11,
+            u"ise": 13,
+            u"use": 14,
+            u"\u00E2se": 15,
+            u"eze": 18,
+            u"eai": 20,
+            u"iai": 21,
+            u"sei": 22,
+            u"ezi": 26,
+            u"a\u015Fi": 28,
+            u"i\u015Fi": 35,
+            u"u\u015Fi": 36,
+            u"\u00E2\u015Fi": 37,
+            u"a\u0163i": 38,
+            u"e\u0163i": 41,
+            u"i\u0163i": 42,
+            u"\u00E2\u0163i": 43,
+            u"eam": 55,
+            u"iam": 56,
+            u"eau": 77,
+            u"iau": 78,
+            u"ar\u0103": 83,
+            u"ir\u0103": 90,
+            u"ur\u0103": 91,
+            u"\u00E2r\u0103": 92
+        }),
+        (2, {
+            u"ea": 0,
+            u"ia": 1,
+            u"se": 10,
+            u"ai": 19,
+            u"ui": 25,
+            u"\u00E2i": 27,
+            u"am": 54,
+            u"em": 57,
+            u"im": 63,
+            u"\u00E2m": 64,
+            u"\u0103m": 65,
+            u"au": 76,
+            u"ez": 81
+        }),
+    )
+
+    a_5 = [
+        Among(u"a", -1, 1),
+        Among(u"e", -1, 1),
+        Among(u"ie", 1, 1),
+        Among(u"i", -1, 1),
+        Among(u"\u0103", -1, 1)
+    ]
+
+    d_5 = (
+        (2, {
+            u"ie": 2
+        }),
+        (1, {
+            u"a": 0,
+            u"e": 1,
+            u"i": 3,
+            u"\u0103": 4
+        }),
+    )
+
+    g_v = frozenset(u"aeiou\u00E2\u00EE\u0103")
+
+    B_standard_suffix_removed = False
+    I_p2 = 0
+    I_p1 = 0
+    I_pV = 0
+
+    def copy_from(self, other):
+        self.B_standard_suffix_removed = other.B_standard_suffix_removed
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        self.I_pV = other.I_pV
+        super.copy_from(other)
+
+    def r_prelude(self):
+        # (, line 31
+        # repeat, line 32
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                lab2 = False
+                # goto, line 32
+                while True:
+                    lab3 = False
+                    v_2 = self.cursor
+                    while True:
+                        lab4 = False
+                        # (, line 32
+                        if not self.in_grouping(RomanianStemmer.g_v):
+                            break
+                        # [, line 33
+                        self.bra = self.cursor
+                        # or, line 33
+                        while True:
+                            lab5 = False
+                            v_3 = self.cursor
+                            while True:
+                                # (, line 33
+                                # literal, line 33
+                                if not self.eq_s(1, u"u"):
+                                    break
+                                # ], line 33
+                                self.ket = self.cursor
+                                if not self.in_grouping(RomanianStemmer.g_v):
+                                    break
+                                # <-, line 33
+                                if not self.slice_from(u"U"):
+                                    return False
+                                lab5 = True
+                                break
+                            if lab5:
+                                break
+                            self.cursor = v_3
+                            # (, line 34
+                            # literal, line 34
+                            if not self.eq_s(1, u"i"):
+                                lab4 = True
+                                break
+                            # ], line 34
+                            self.ket = self.cursor
+                            if not self.in_grouping(RomanianStemmer.g_v):
+                                lab4 = True
+                                break
+                            # <-, line 34
+                            if not self.slice_from(u"I"):
+                                return False
+                            break
+                        if lab4:
+                            break
+                        self.cursor = v_2
+                        lab3 = True
+                        break
+                    if lab3:
+                        break
+                    self.cursor = v_2
+                    if self.cursor >= self.limit:
+                        lab2 = True
+                        break
+                    self.cursor += 1
+                if lab2:
+                    break
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_mark_regions(self):
+        # (, line 38
+        self.I_pV = self.limit
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # do, line 44
+        v_1 = self.cursor
+        while True:
+            lab0 = False
+            # (, line 44
+            # or, line 46
+            while True:
+                lab1 = False
+                v_2 = self.cursor
+                while True:
+                    lab2 = False
+                    # (, line 45
+                    if not self.in_grouping(RomanianStemmer.g_v):
+                        break
+                    # or, line 45
+                    while True:
+                        lab3 = False
+                        v_3 = self.cursor
+                        while True:
+                            # (, line 45
+                            if not self.out_grouping(RomanianStemmer.g_v):
+                                break
+                            # gopast, line 45
+                            if not self.go_out_grouping(RomanianStemmer.g_v):
+                                break
+                            self.cursor += 1
+                            lab3 = True
+                            break
+                        if lab3:
+                            break
+                        self.cursor = v_3
+                        # (, line 45
+                        if not self.in_grouping(RomanianStemmer.g_v):
+                            lab2 = True
+                            break
+                        # gopast, line 45
+                        if not self.go_in_grouping(RomanianStemmer.g_v):
+                            lab2 = True
+                            break
+                        self.cursor += 1
+                        break
+                    if lab2:
+                        break
+                    lab1 = True
+                    break
+                if lab1:
+                    break
+                self.cursor = v_2
+                # (, line 47
+                if not self.out_grouping(RomanianStemmer.g_v):
+                    lab0 = True
+                    break
+                # or, line 47
+                while True:
+                    lab5 = False
+                    v_4 = self.cursor
+                    while True:
+                        # (, line 47
+                        if not self.out_grouping(RomanianStemmer.g_v):
+                            break
+                        # gopast, line 47
+                        if not self.go_out_grouping(RomanianStemmer.g_v):
+                            break
+                        self.cursor += 1
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = v_4
+                    # (, line 47
+                    if not self.in_grouping(RomanianStemmer.g_v):
+                        lab0 = True
+                        break
+                    # next, line 47
+                    if self.cursor >= self.limit:
+                        lab0 = True
+                        break
+                    self.cursor += 1
+                    break
+                if lab0:
+                    break
+                break
+            if lab0:
+                break
+            # setmark pV, line 48
+            self.I_pV = self.cursor
+            break
+        self.cursor = v_1
+        # do, line 50
+        v_5 = self.cursor
+        while True:
+            # (, line 50
+            # gopast, line 51
+            if not self.go_out_grouping(RomanianStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 51
+            if not self.go_in_grouping(RomanianStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p1, line 51
+            self.I_p1 = self.cursor
+            # gopast, line 52
+            if not self.go_out_grouping(RomanianStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 52
+            if not self.go_in_grouping(RomanianStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p2, line 52
+            self.I_p2 = self.cursor
+            break
+        self.cursor = v_5
+        return True
+
+    def r_postlude(self):
+        # repeat, line 56
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 56
+                # [, line 58
+                self.bra = self.cursor
+                # substring, line 58
+                among_var = self.find_among(RomanianStemmer.a_0, RomanianStemmer.d_0)
+                if among_var == 0:
+                    break
+                # ], line 58
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 59
+                    # <-, line 59
+                    if not self.slice_from(u"i"):
+                        return False
+                elif among_var == 2:
+                    # (, line 60
+                    # <-, line 60
+                    if not self.slice_from(u"u"):
+                        return False
+                elif among_var == 3:
+                    # (, line 61
+                    # next, line 61
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_RV(self):
+        if not self.I_pV <= self.cursor:
+            return False
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_step_0(self):
+        # (, line 72
+        # [, line 73
+        self.ket = self.cursor
+        # substring, line 73
+        among_var = self.find_among_b(RomanianStemmer.a_1, RomanianStemmer.d_1)
+        if among_var == 0:
+            return False
+        # ], line 73
+        self.bra = self.cursor
+        # call R1, line 73
+        if not self.r_R1():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 75
+            # delete, line 75
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 77
+            # <-, line 77
+            if not self.slice_from(u"a"):
+                return False
+        elif among_var == 3:
+            # (, line 79
+            # <-, line 79
+            if not self.slice_from(u"e"):
+                return False
+        elif among_var == 4:
+            # (, line 81
+            # <-, line 81
+            if not self.slice_from(u"i"):
+                return False
+        elif among_var == 5:
+            # (, line 83
+            # not, line 83
+            v_1 = self.limit - self.cursor
+            while True:
+                # literal, line 83
+                if not self.eq_s_b(2, u"ab"):
+                    break
+                return False
+            self.cursor = self.limit - v_1
+            # <-, line 83
+            if not self.slice_from(u"i"):
+                return False
+        elif among_var == 6:
+            # (, line 85
+            # <-, line 85
+            if not self.slice_from(u"at"):
+                return False
+        elif among_var == 7:
+            # (, line 87
+            # <-, line 87
+            if not self.slice_from(u"a\u0163i"):
+                return False
+        return True
+
+    def r_combo_suffix(self):
+        # test, line 91
+        v_1 = self.limit - self.cursor
+        # (, line 91
+        # [, line 92
+        self.ket = self.cursor
+        # substring, line 92
+        among_var = self.find_among_b(RomanianStemmer.a_2, RomanianStemmer.d_2)
+        if among_var == 0:
+            return False
+        # ], line 92
+        self.bra = self.cursor
+        # call R1, line 92
+        if not self.r_R1():
+            return False
+        # (, line 92
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 100
+            # <-, line 101
+            if not self.slice_from(u"abil"):
+                return False
+        elif among_var == 2:
+            # (, line 103
+            # <-, line 104
+            if not self.slice_from(u"ibil"):
+                return False
+        elif among_var == 3:
+            # (, line 106
+            # <-, line 107
+            if not self.slice_from(u"iv"):
+                return False
+        elif among_var == 4:
+            # (, line 112
+            # <-, line 113
+            if not self.slice_from(u"ic"):
+                return False
+        elif among_var == 5:
+            # (, line 117
+            # <-, line 118
+            if not self.slice_from(u"at"):
+                return False
+        elif among_var == 6:
+            # (, line 121
+            # <-, line 122
+            if not self.slice_from(u"it"):
+                return False
+        # set standard_suffix_removed, line 125
+        self.B_standard_suffix_removed = True
+        self.cursor = self.limit - v_1
+        return True
+
+    def r_standard_suffix(self):
+        # (, line 129
+        # unset standard_suffix_removed, line 130
+        self.B_standard_suffix_removed = False
+        # repeat, line 131
+        while True:
+            lab1 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # call combo_suffix, line 131
+                if not self.r_combo_suffix():
+                    break
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = self.limit - v_1
+            break
+        # [, line 132
+        self.ket = self.cursor
+        # substring, line 132
+        among_var = self.find_among_b(RomanianStemmer.a_3, RomanianStemmer.d_3)
+        if among_var == 0:
+            return False
+        # ], line 132
+        self.bra = self.cursor
+        # call R2, line 132
+        if not self.r_R2():
+            return False
+        # (, line 132
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 148
+            # delete, line 149
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 151
+            # literal, line 152
+            if not self.eq_s_b(1, u"\u0163"):
+                return False
+            # ], line 152
+            self.bra = self.cursor
+            # <-, line 152
+            if not self.slice_from(u"t"):
+                return False
+        elif among_var == 3:
+            # (, line 155
+            # <-, line 156
+            if not self.slice_from(u"ist"):
+                return False
+        # set standard_suffix_removed, line 160
+        self.B_standard_suffix_removed = True
+        return True
+
+    def r_verb_suffix(self):
+        # setlimit, line 164
+        v_1 = self.limit - self.cursor
+        # tomark, line 164
+        if self.cursor < self.I_pV:
+            return False
+        self.cursor = self.I_pV
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 164
+        # [, line 165
+        self.ket = self.cursor
+        # substring, line 165
+        among_var = self.find_among_b(RomanianStemmer.a_4, RomanianStemmer.d_4)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 165
+        self.bra = self.cursor
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        elif among_var == 1:
+            # (, line 200
+            # or, line 200
+            while True:
+                lab0 = False
+                v_3 = self.limit - self.cursor
+                while True:
+                    if not self.out_grouping_b(RomanianStemmer.g_v):
+                        break
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_3
+                # literal, line 200
+                if not self.eq_s_b(1, u"u"):
+                    self.limit_backward = v_2
+                    return False
+                break
+            # delete, line 200
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 214
+            # delete, line 214
+            if not self.slice_del():
+                return False
+
+        self.limit_backward = v_2
+        return True
+
+    def r_vowel_suffix(self):
+        # (, line 218
+        # [, line 219
+        self.ket = self.cursor
+        # substring, line 219
+        among_var = self.find_among_b(RomanianStemmer.a_5, RomanianStemmer.d_5)
+        if among_var == 0:
+            return False
+        # ], line 219
+        self.bra = self.cursor
+        # call RV, line 219
+        if not self.r_RV():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 220
+            # delete, line 220
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def _stem(self):
+        # (, line 225
+        # do, line 226
+        v_1 = self.cursor
+        while True:
+            # call prelude, line 226
+            if not self.r_prelude():
+                break
+            break
+        self.cursor = v_1
+        # do, line 227
+        v_2 = self.cursor
+        while True:
+            # call mark_regions, line 227
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_2
+        # backwards, line 228
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 228
+        # do, line 229
+        v_3 = self.limit - self.cursor
+        while True:
+            # call step_0, line 229
+            if not self.r_step_0():
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 230
+        v_4 = self.limit - self.cursor
+        while True:
+            # call standard_suffix, line 230
+            if not self.r_standard_suffix():
+                break
+            break
+        self.cursor = self.limit - v_4
+        # do, line 231
+        v_5 = self.limit - self.cursor
+        while True:
+            lab4 = False
+            # (, line 231
+            # or, line 231
+            while True:
+                lab5 = False
+                v_6 = self.limit - self.cursor
+                while True:
+                    # Boolean test standard_suffix_removed, line 231
+                    if not self.B_standard_suffix_removed:
+                        break
+                    lab5 = True
+                    break
+                if lab5:
+                    break
+                self.cursor = self.limit - v_6
+                # call verb_suffix, line 231
+                if not self.r_verb_suffix():
+                    lab4 = True
+                    break
+                break
+            if lab4:
+                break
+            break
+        self.cursor = self.limit - v_5
+        # do, line 232
+        v_7 = self.limit - self.cursor
+        while True:
+            # call vowel_suffix, line 232
+            if not self.r_vowel_suffix():
+                break
+            break
+        self.cursor = self.limit - v_7
+        self.cursor = self.limit_backward
+        # do, line 234
+        v_8 = self.cursor
+        while True:
+            # call postlude, line 234
+            if not self.r_postlude():
+                break
+            break
+        self.cursor = v_8
+        return True
@@ -0,0 +1,403 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class DanishStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"hed", -1, 1),
+        Among(u"ethed", 0, 1),
+        Among(u"ered", -1, 1),
+        Among(u"e", -1, 1),
+        Among(u"erede", 3, 1),
+        Among(u"ende", 3, 1),
+        Among(u"erende", 5, 1),
+        Among(u"ene", 3, 1),
+        Among(u"erne", 3, 1),
+        Among(u"ere", 3, 1),
+        Among(u"en", -1, 1),
+        Among(u"heden", 10, 1),
+        Among(u"eren", 10, 1),
+        Among(u"er", -1, 1),
+        Among(u"heder", 13, 1),
+        Among(u"erer", 13, 1),
+        Among(u"s", -1, 2),
+        Among(u"heds", 16, 1),
+        Among(u"es", 16, 1),
+        Among(u"endes", 18, 1),
+        Among(u"erendes", 19, 1),
+        Among(u"enes", 18, 1),
+        Among(u"ernes", 18, 1),
+        Among(u"eres", 18, 1),
+        Among(u"ens", 16, 1),
+        Among(u"hedens", 24, 1),
+        Among(u"erens", 24, 1),
+        Among(u"ers", 16, 1),
+        Among(u"ets", 16, 1),
+        Among(u"erets", 28, 1),
+        Among(u"et", -1, 1),
+        Among(u"eret", 30, 1)
+    ]
+
+    d_0 = (
+        (7, {
+            u"erendes": 20
+        }),
+        (6, {
+            u"erende": 6,
+            u"hedens": 25
+        }),
+        (5, {
+            u"ethed": 1,
+            u"erede": 4,
+            u"heden": 11,
+            u"heder": 14,
+            u"endes": 19,
+            u"ernes": 22,
+            u"erens": 26,
+            u"erets": 29
+        }),
+        (4, {
+            u"ered": 2,
+            u"ende": 5,
+            u"erne": 8,
+            u"eren": 12,
+            u"erer": 15,
+            u"heds": 17,
+            u"enes": 21,
+            u"eres": 23,
+            u"eret": 31
+        }),
+        (3, {
+            u"hed": 0,
+            u"ene": 7,
+            u"ere": 9,
+            u"ens": 24,
+            u"ers": 27,
+            u"ets": 28
+        }),
+        (2, {
+            u"en": 10,
+            u"er": 13,
+            u"es": 18,
+            u"et": 30
+        }),
+        (1, {
+            u"e": 3,
+            u"s": 16
+        }),
+    )
+
+    a_1 = [
+        Among(u"gd", -1, -1),
+        Among(u"dt", -1, -1),
+        Among(u"gt", -1, -1),
+        Among(u"kt", -1, -1)
+    ]
+
+    d_1 = (
+        (2, {
+            u"gd": 0,
+            u"dt": 1,
+            u"gt": 2,
+            u"kt": 3
+        }),
+    )
+
+    a_2 = [
+        Among(u"ig", -1, 1),
+        Among(u"lig", 0, 1),
+        Among(u"elig", 1, 1),
+        Among(u"els", -1, 1),
+        Among(u"l\u00F8st", -1, 2)
+    ]
+
+    d_2 = (
+        (4, {
+            u"elig": 2,
+            u"l\u00F8st": 4
+        }),
+        (3, {
+            u"lig": 1,
+            u"els": 3
+        }),
+        (2, {
+            u"ig": 0
+        }),
+    )
+
+    g_v = frozenset(u"aeiouy\u00E6\u00E5\u00F8")
+
+    g_s_ending = frozenset(u"abcdfghjklmnoprtvyz\u00E5")
+
+    I_x = 0
+    I_p1 = 0
+    S_ch = ""
+
+    def copy_from(self, other):
+        self.I_x = other.I_x
+        self.I_p1 = other.I_p1
+        self.S_ch = other.S_ch
+        super.copy_from(other)
+
+    def r_mark_regions(self):
+        # (, line 29
+        self.I_p1 = self.limit
+        # test, line 33
+        v_1 = self.cursor
+        # (, line 33
+        # hop, line 33
+        c = self.cursor + 3
+        if 0 > c or c > self.limit:
+            return False
+        self.cursor = c
+        # setmark x, line 33
+        self.I_x = self.cursor
+        self.cursor = v_1
+        # goto, line 34
+        if not self.go_out_grouping(DanishStemmer.g_v):
+            return False
+        # gopast, line 34
+        if not self.go_in_grouping(DanishStemmer.g_v):
+            return False
+        self.cursor += 1
+        # setmark p1, line 34
+        self.I_p1 = self.cursor
+        # try, line 35
+        while True:
+            # (, line 35
+            if not (self.I_p1 < self.I_x):
+                break
+            self.I_p1 = self.I_x
+            break
+        return True
+
+    def r_main_suffix(self):
+        # (, line 40
+        # setlimit, line 41
+        v_1 = self.limit - self.cursor
+        # tomark, line 41
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 41
+        # [, line 41
+        self.ket = self.cursor
+        # substring, line 41
+        among_var = self.find_among_b(DanishStemmer.a_0, DanishStemmer.d_0)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 41
+        self.bra = self.cursor
+        self.limit_backward = v_2
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 48
+            # delete, line 48
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 50
+            if not self.in_grouping_b(DanishStemmer.g_s_ending):
+                return False
+            # delete, line 50
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_consonant_pair(self):
+        # (, line 54
+        # test, line 55
+        v_1 = self.limit - self.cursor
+        # (, line 55
+        # setlimit, line 56
+        v_2 = self.limit - self.cursor
+        # tomark, line 56
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_3 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_2
+        # (, line 56
+        # [, line 56
+        self.ket = self.cursor
+        # substring, line 56
+        if self.find_among_b(DanishStemmer.a_1, DanishStemmer.d_1) == 0:
+            self.limit_backward = v_3
+            return False
+        # ], line 56
+        self.bra = self.cursor
+        self.limit_backward = v_3
+        self.cursor = self.limit - v_1
+        # next, line 62
+        if self.cursor <= self.limit_backward:
+            return False
+        self.cursor -= 1
+        # ], line 62
+        self.bra = self.cursor
+        # delete, line 62
+        if not self.slice_del():
+            return False
+
+        return True
+
+    def r_other_suffix(self):
+        # (, line 65
+        # do, line 66
+        v_1 = self.limit - self.cursor
+        while True:
+            # (, line 66
+            # [, line 66
+            self.ket = self.cursor
+            # literal, line 66
+            if not self.eq_s_b(2, u"st"):
+                break
+            # ], line 66
+            self.bra = self.cursor
+            # literal, line 66
+            if not self.eq_s_b(2, u"ig"):
+                break
+            # delete, line 66
+            if not self.slice_del():
+                return False
+
+            break
+        self.cursor = self.limit - v_1
+        # setlimit, line 67
+        v_2 = self.limit - self.cursor
+        # tomark, line 67
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_3 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_2
+        # (, line 67
+        # [, line 67
+        self.ket = self.cursor
+        # substring, line 67
+        among_var = self.find_among_b(DanishStemmer.a_2, DanishStemmer.d_2)
+        if among_var == 0:
+            self.limit_backward = v_3
+            return False
+        # ], line 67
+        self.bra = self.cursor
+        self.limit_backward = v_3
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 70
+            # delete, line 70
+            if not self.slice_del():
+                return False
+
+            # do, line 70
+            v_4 = self.limit - self.cursor
+            while True:
+                # call consonant_pair, line 70
+                if not self.r_consonant_pair():
+                    break
+                break
+            self.cursor = self.limit - v_4
+        elif among_var == 2:
+            # (, line 72
+            # <-, line 72
+            if not self.slice_from(u"l\u00F8s"):
+                return False
+        return True
+
+    def r_undouble(self):
+        # (, line 75
+        # setlimit, line 76
+        v_1 = self.limit - self.cursor
+        # tomark, line 76
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 76
+        # [, line 76
+        self.ket = self.cursor
+        if not self.out_grouping_b(DanishStemmer.g_v):
+            self.limit_backward = v_2
+            return False
+        # ], line 76
+        self.bra = self.cursor
+        # -> ch, line 76
+        self.S_ch = self.slice_to(self.S_ch)
+        if self.S_ch == '':
+            return False
+        self.limit_backward = v_2
+        # name ch, line 77
+        if not self.eq_v_b(self.S_ch):
+            return False
+        # delete, line 78
+        if not self.slice_del():
+            return False
+
+        return True
+
+    def _stem(self):
+        # (, line 82
+        # do, line 84
+        v_1 = self.cursor
+        while True:
+            # call mark_regions, line 84
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_1
+        # backwards, line 85
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 85
+        # do, line 86
+        v_2 = self.limit - self.cursor
+        while True:
+            # call main_suffix, line 86
+            if not self.r_main_suffix():
+                break
+            break
+        self.cursor = self.limit - v_2
+        # do, line 87
+        v_3 = self.limit - self.cursor
+        while True:
+            # call consonant_pair, line 87
+            if not self.r_consonant_pair():
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 88
+        v_4 = self.limit - self.cursor
+        while True:
+            # call other_suffix, line 88
+            if not self.r_other_suffix():
+                break
+            break
+        self.cursor = self.limit - v_4
+        # do, line 89
+        v_5 = self.limit - self.cursor
+        while True:
+            # call undouble, line 89
+            if not self.r_undouble():
+                break
+            break
+        self.cursor = self.limit - v_5
+        self.cursor = self.limit_backward
+        return True
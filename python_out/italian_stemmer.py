@@ -0,0 +1,1257 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class ItalianStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"", -1, 7),
+        Among(u"qu", 0, 6),
+        Among(u"\u00E1", 0, 1),
+        Among(u"\u00E9", 0, 2),
+        Among(u"\u00ED", 0, 3),
+        Among(u"\u00F3", 0, 4),
+        Among(u"\u00FA", 0, 5)
+    ]
+
+    d_0 = (
+        (2, {
+            u"qu": 1
+        }),
+        (1, {
+            u"\u00E1": 2,
+            u"\u00E9": 3,
+            u"\u00ED": 4,
+            u"\u00F3": 5,
+            u"\u00FA": 6
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"", -1, 3),
+        Among(u"I", 0, 1),
+        Among(u"U", 0, 2)
+    ]
+
+    d_1 = (
+        (1, {
+            u"I": 1,
+            u"U": 2
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_2 = [
+        Among(u"la", -1, -1),
+        Among(u"cela", 0, -1),
+        Among(u"gliela", 0, -1),
+        Among(u"mela", 0, -1),
+        Among(u"tela", 0, -1),
+        Among(u"vela", 0, -1),
+        Among(u"le", -1, -1),
+        Among(u"cele", 6, -1),
+        Among(u"gliele", 6, -1),
+        Among(u"mele", 6, -1),
+        Among(u"tele", 6, -1),
+        Among(u"vele", 6, -1),
+        Among(u"ne", -1, -1),
+        Among(u"cene", 12, -1),
+        Among(u"gliene", 12, -1),
+        Among(u"mene", 12, -1),
+        Among(u"sene", 12, -1),
+        Among(u"tene", 12, -1),
+        Among(u"vene", 12, -1),
+        Among(u"ci", -1, -1),
+        Among(u"li", -1, -1),
+        Among(u"celi", 20, -1),
+        Among(u"glieli", 20, -1),
+        Among(u"meli", 20, -1),
+        Among(u"teli", 20, -1),
+        Among(u"veli", 20, -1),
+        Among(u"gli", 20, -1),
+        Among(u"mi", -1, -1),
+        Among(u"si", -1, -1),
+        Among(u"ti", -1, -1),
+        Among(u"vi", -1, -1),
+        Among(u"lo", -1, -1),
+        Among(u"celo", 31, -1),
+        Among(u"glielo", 31, -1),
+        Among(u"melo", 31, -1),
+        Among(u"telo", 31, -1),
+        Among(u"velo", 31, -1)
+    ]
+
+    d_2 = (
+        (6, {
+            u"gliela": 2,
+            u"gliele": 8,
+            u"gliene": 14,
+            u"glieli": 22,
+            u"glielo": 33
+        }),
+        (4, {
+            u"cela": 1,
+            u"mela": 3,
+            u"tela": 4,
+            u"vela": 5,
+            u"cele": 7,
+            u"mele": 9,
+            u"tele": 10,
+            u"vele": 11,
+            u"cene": 13,
+            u"mene": 15,
+            u"sene": 16,
+            u"tene": 17,
+            u"vene": 18,
+            u"celi": 21,
+            u"meli": 23,
+            u"teli": 24,
+            u"veli": 25,
+            u"celo": 32,
+            u"melo": 34,
+            u"telo": 35,
+            u"velo": 36
+        }),
+        (3, {
+            u"gli": 26
+        }),
+        (2, {
+            u"la": 0,
+            u"le": 6,
+            u"ne": 12,
+            u"ci": 19,
+            u"li": 20,
+            u"mi": 27,
+            u"si": 28,
+            u"ti": 29,
+            u"vi": 30,
+            u"lo": 31
+        }),
+    )
+
+    a_3 = [
+        Among(u"ando", -1, 1),
+        Among(u"endo", -1, 1),
+        Among(u"ar", -1, 2),
+        Among(u"er", -1, 2),
+        Among(u"ir", -1, 2)
+    ]
+
+    d_3 = (
+        (4, {
+            u"ando": 0,
+            u"endo": 1
+        }),
+        (2, {
+            u"ar": 2,
+            u"er": 3,
+            u"ir": 4
+        }),
+    )
+
+    a_4 = [
+        Among(u"ic", -1, -1),
+        Among(u"abil", -1, -1),
+        Among(u"os", -1, -1),
+        Among(u"iv", -1, 1)
+    ]
+
+    d_4 = (
+        (4, {
+            u"abil": 1
+        }),
+        (2, {
+            u"ic": 0,
+            u"os": 2,
+            u"iv": 3
+        }),
+    )
+
+    a_5 = [
+        Among(u"ic", -1, 1),
+        Among(u"abil", -1, 1),
+        Among(u"iv", -1, 1)
+    ]
+
+    d_5 = (
+        (4, {
+            u"abil": 1
+        }),
+        (2, {
+            u"ic": 0,
+            u"iv": 2
+        }),
+    )
+
+    a_6 = [
+        Among(u"ica", -1, 1),
+        Among(u"logia", -1, 3),
+        Among(u"osa", -1, 1),
+        Among(u"ista", -1, 1),
+        Among(u"iva", -1, 9),
+        Among(u"anza", -1, 1),
+        Among(u"enza", -1, 5),
+        Among(u"ice", -1, 1),
+        Among(u"atrice", 7, 1),
+        Among(u"iche", -1, 1),
+        Among(u"logie", -1, 3),
+        Among(u"abile", -1, 1),
+        Among(u"ibile", -1, 1),
+        Among(u"usione", -1, 4),
+        Among(u"azione", -1, 2),
+        Among(u"uzione", -1, 4),
+        Among(u"atore", -1, 2),
+        Among(u"ose", -1, 1),
+        Among(u"ante", -1, 1),
+        Among(u"mente", -1, 1),
+        Among(u"amente", 19, 7),
+        Among(u"iste", -1, 1),
+        Among(u"ive", -1, 9),
+        Among(u"anze", -1, 1),
+        Among(u"enze", -1, 5),
+        Among(u"ici", -1, 1),
+        Among(u"atrici", 25, 1),
+        Among(u"ichi", -1, 1),
+        Among(u"abili", -1, 1),
+        Among(u"ibili", -1, 1),
+        Among(u"ismi", -1, 1),
+        Among(u"usioni", -1, 4),
+        Among(u"azioni", -1, 2),
+        Among(u"uzioni", -1, 4),
+        Among(u"atori", -1, 2),
+        Among(u"osi", -1, 1),
+        Among(u"anti", -1, 1),
+        Among(u"amenti", -1, 6),
+        Among(u"imenti", -1, 6),
+        Among(u"isti", -1, 1),
+        Among(u"ivi", -1, 9),
+        Among(u"ico", -1, 1),
+        Among(u"ismo", -1, 1),
+        Among(u"oso", -1, 1),
+        Among(u"amento", -1, 6),
+        Among(u"imento", -1, 6),
+        Among(u"ivo", -1, 9),
+        Among(u"it\u00E0", -1, 8),
+        Among(u"ist\u00E0", -1, 1),
+        Among(u"ist\u00E8", -1, 1),
+        Among(u"ist\u00EC", -1, 1)
+    ]
+
+    d_6 = (
+        (6, {
+            u"atrice": 8,
+            u"usione": 13,
+            u"azione": 14,
+            u"uzione": 15,
+            u"amente": 20,
+            u"atrici": 26,
+            u"usioni": 31,
+            u"azioni": 32,
+            u"uzioni": 33,
+            u"amenti": 37,
+            u"imenti": 38,
+            u"amento": 44,
+            u"imento": 45
+        }),
+        (5, {
+            u"logia": 1,
+            u"logie": 10,
+            u"abile": 11,
+            u"ibile": 12,
+            u"atore": 16,
+            u"mente": 19,
+            u"abili": 28,
+            u"ibili": 29,
+            u"atori": 34
+        }),
+        (4, {
+            u"ista": 3,
+            u"anza": 5,
+            u"enza": 6,
+            u"iche": 9,
+            u"ante": 18,
+            u"iste": 21,
+            u"anze": 23,
+            u"enze": 24,
+            u"ichi": 27,
+            u"ismi": 30,
+            u"anti": 36,
+            u"isti": 39,
+            u"ismo": 42,
+            u"ist\u00E0": 48,
+            u"ist\u00E8": 49,
+            u"ist\u00EC": 50
+        }),
+        (3, {
+            u"ica": 0,
+            u"osa": 2,
+            u"iva": 4,
+            u"ice": 7,
+            u"ose": 17,
+            u"ive": 22,
+            u"ici": 25,
+            u"osi": 35,
+            u"ivi": 40,
+            u"ico": 41,
+            u"oso": 43,
+            u"ivo": 46,
+            u"it\u00E0": 47
+        }),
+    )
+
+    a_7 = [
+        Among(u"isca", -1, 1),
+        Among(u"enda", -1, 1),
+        Among(u"ata", -1, 1),
+        Among(u"ita", -1, 1),
+        Among(u"uta", -1, 1),
+        Among(u"ava", -1, 1),
+        Among(u"eva", -1, 1),
+        Among(u"iva", -1, 1),
+        Among(u"erebbe", -1, 1),
+        Among(u"irebbe", -1, 1),
+        Among(u"isce", -1, 1),
+        Among(u"ende", -1, 1),
+        Among(u"are", -1, 1),
+        Among(u"ere", -1, 1),
+        Among(u"ire", -1, 1),
+        Among(u"asse", -1, 1),
+        Among(u"ate", -1, 1),
+        Among(u"avate", 16, 1),
+        Among(u"evate", 16, 1),
+        Among(u"ivate", 16, 1),
+        Among(u"ete", -1, 1),
+        Among(u"erete", 20, 1),
+        Among(u"irete", 20, 1),
+        Among(u"ite", -1, 1),
+        Among(u"ereste", -1, 1),
+        Among(u"ireste", -1, 1),
+        Among(u"ute", -1, 1),
+        Among(u"erai", -1, 1),
+        Among(u"irai", -1, 1),
+        Among(u"isci", -1, 1),
+        Among(u"endi", -1, 1),
+        Among(u"erei", -1, 1),
+        Among(u"irei", -1, 1),
+        Among(u"assi", -1, 1),
+        Among(u"ati", -1, 1),
+        Among(u"iti", -1, 1),
+        Among(u"eresti", -1, 1),
+        Among(u"iresti", -1, 1),
+        Among(u"uti", -1, 1),
+        Among(u"avi", -1, 1),
+        Among(u"evi", -1, 1),
+        Among(u"ivi", -1, 1),
+        Among(u"isco", -1, 1),
+        Among(u"ando", -1, 1),
+        Among(u"endo", -1, 1),
+        Among(u"Yamo", -1, 1),
+        Among(u"iamo", -1, 1),
+        Among(u"avamo", -1, 1),
+        Among(u"evamo", -1, 1),
+        Among(u"ivamo", -1, 1),
+        Among(u"eremo", -1, 1),
+        Among(u"iremo", -1, 1),
+        Among(u"assimo", -1, 1),
+        Among(u"ammo", -1, 1),
+        Among(u"emmo", -1, 1),
+        Among(u"eremmo", 54, 1),
+        Among(u"iremmo", 54, 1),
+        Among(u"immo", -1, 1),
+        Among(u"ano", -1, 1),
+        Among(u"iscano", 58, 1),
+        Among(u"avano", 58, 1),
+        Among(u"evano", 58, 1),
+        Among(u"ivano", 58, 1),
+        Among(u"eranno", -1, 1),
+        Among(u"iranno", -1, 1),
+        Among(u"ono", -1, 1),
+        Among(u"iscono", 65, 1),
+        Among(u"arono", 65, 1),
+        Among(u"erono", 65, 1),
+        Among(u"irono", 65, 1),
+        Among(u"erebbero", -1, 1),
+        Among(u"irebbero", -1, 1),
+        Among(u"assero", -1, 1),
+        Among(u"essero", -1, 1),
+        Among(u"issero", -1, 1),
+        Among(u"ato", -1, 1),
+        Among(u"ito", -1, 1),
+        Among(u"uto", -1, 1),
+        Among(u"avo", -1, 1),
+        Among(u"evo", -1, 1),
+        Among(u"ivo", -1, 1),
+        Among(u"ar", -1, 1),
+        Among(u"ir", -1, 1),
+        Among(u"er\u00E0", -1, 1),
+        Among(u"ir\u00E0", -1, 1),
+        Among(u"er\u00F2", -1, 1),
+        Among(u"ir\u00F2", -1, 1)
+    ]
+
+    d_7 = (
+        (8, {
+            u"erebbero": 70,
+            u"irebbero": 71
+        }),
+        (6, {
+            u"erebbe": 8,
+            u"irebbe": 9,
+            u"ereste": 24,
+            u"ireste": 25,
+            u"eresti": 36,
+            u"iresti": 37,
+            u"assimo": 52,
+            u"eremmo": 55,
+            u"iremmo": 56,
+            u"iscano": 59,
+            u"eranno": 63,
+            u"iranno": 64,
+            u"iscono": 66,
+            u"assero": 72,
+            u"essero": 73,
+            u"issero": 74
+        }),
+        (5, {
+            u"avate": 17,
+            u"evate": 18,
+            u"ivate": 19,
+            u"erete": 21,
+            u"irete": 22,
+            u"avamo": 47,
+            u"evamo": 48,
+            u"ivamo": 49,
+            u"eremo": 50,
+            u"iremo": 51,
+            u"avano": 60,
+            u"evano": 61,
+            u"ivano": 62,
+            u"arono": 67,
+            u"erono": 68,
+            u"irono": 69
+        }),
+        (4, {
+            u"isca": 0,
+            u"enda": 1,
+            u"isce": 10,
+            u"ende": 11,
+            u"asse": 15,
+            u"erai": 27,
+            u"irai": 28,
+            u"isci": 29,
+            u"endi": 30,
+            u"erei": 31,
+            u"irei": 32,
+            u"assi": 33,
+            u"isco": 42,
+            u"ando": 43,
+            u"endo": 44,
+            u"Yamo": 45,
+            u"iamo": 46,
+            u"ammo": 53,
+            u"emmo": 54,
+            u"immo": 57
+        }),
+        (3, {
+            u"ata": 2,
+            u"ita": 3,
+            u"uta": 4,
+            u"ava": 5,
+            u"eva": 6,
+            u"iva": 7,
+            u"are": 12,
+            u"ere": 13,
+            u"ire": 14,
+            u"ate": 16,
+            u"ete": 20,
+            u"ite": 23,
+            u"ute": 26,
+            u"ati": 34,
+            u"iti": 35,
+            u"uti": 38,
+            u"avi": 39,
+            u"evi": 40,
+            u"ivi": 41,
+            u"ano": 58,
+            u"ono": 65,
+            u"ato": 75,
+            u"ito": 76,
+            u"uto": 77,
+            u"avo": 78,
+            u"evo": 79,
+            u"ivo": 80,
+            u"er\u00E0": 83,
+            u"ir\u00E0": 84,
+            u"er\u00F2": 85,
+            u"ir\u00F2": 86
+        }),
+        (2, {
+            u"ar": 81,
+            u"ir": 82
+        }),
+    )
+
+    g_v = frozenset(u"aeiou\u00E0\u00E8\u00EC\u00F2\u00F9")
+
+    g_AEIO = frozenset(u"aeio\u00E0\u00E8\u00EC\u00F2")
+
+    g_CG = frozenset(u"cg")
+
+    I_p2 = 0
+    I_p1 = 0
+    I_pV = 0
+
+    def copy_from(self, other):
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        self.I_pV = other.I_pV
+        super.copy_from(other)
+
+    def r_prelude(self):
+        # (, line 34
+        # test, line 35
+        v_1 = self.cursor
+        # repeat, line 35
+        while True:
+            lab1 = False
+            v_2 = self.cursor
+            while True:
+                # (, line 35
+                # [, line 36
+                self.bra = self.cursor
+                # substring, line 36
+                among_var = self.find_among(ItalianStemmer.a_0, ItalianStemmer.d_0)
+                if among_var == 0:
+                    break
+                # ], line 36
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 37
+                    # <-, line 37
+                    if not self.slice_from(u"\u00E0"):
+                        return False
+                elif among_var == 2:
+                    # (, line 38
+                    # <-, line 38
+                    if not self.slice_from(u"\u00E8"):
+                        return False
+                elif among_var == 3:
+                    # (, line 39
+                    # <-, line 39
+                    if not self.slice_from(u"\u00EC"):
+                        return False
+                elif among_var == 4:
+                    # (, line 40
+                    # <-, line 40
+                    if not self.slice_from(u"\u00F2"):
+                        return False
+                elif among_var == 5:
+                    # (, line 41
+                    # <-, line 41
+                    if not self.slice_from(u"\u00F9"):
+                        return False
+                elif among_var == 6:
+                    # (, line 42
+                    # <-, line 42
+                    if not self.slice_from(u"qU"):
+                        return False
+                elif among_var == 7:
+                    # (, line 43
+                    # next, line 43
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_2
+            break
+        self.cursor = v_1
+        # repeat, line 46
+        while True:
+            lab4 = False
+            v_3 = self.cursor
+            while True:
+                lab5 = False
+                # goto, line 46
+                while True:
+                    lab6 = False
+                    v_4 = self.cursor
+                    while True:
+                        lab7 = False
+                        # (, line 46
+                        if not self.in_grouping(ItalianStemmer.g_v):
+                            break
+                        # [, line 47
+                        self.bra = self.cursor
+                        # or, line 47
+                        while True:
+                            lab8 = False
+                            v_5 = self.cursor
+                            while True:
+                                # (, line 47
+                                # literal, line 47
+                                if not self.eq_s(1, u"u"):
+                                    break
+                                # ], line 47
+                                self.ket = self.cursor
+                                if not self.in_grouping(ItalianStemmer.g_v):
+                                    break
+                                # <-, line 47
+                                if not self.slice_from(u"U"):
+                                    return False
+                                lab8 = True
+                                break
+                            if lab8:
+                                break
+                            self.cursor = v_5
+                            # (, line 48
+                            # literal, line 48
+                            if not self.eq_s(1, u"i"):
+                                lab7 = True
+                                break
+                            # ], line 48
+                            self.ket = self.cursor
+                            if not self.in_grouping(ItalianStemmer.g_v):
+                                lab7 = True
+                                break
+                            # <-, line 48
+                            if not self.slice_from(u"I"):
+                                return False
+                            break
+                        if lab7:
+                            break
+                        self.cursor = v_4
+                        lab6 = True
+                        break
+                    if lab6:
+                        break
+                    self.cursor = v_4
+                    if self.cursor >= self.limit:
+                        lab5 = True
+                        break
+                    self.cursor += 1
+                if lab5:
+                    break
+                lab4 = True
+                break
+            if lab4:
+                continue
+            self.cursor = v_3
+            break
+        return True
+
+    def r_mark_regions(self):
+        # (, line 52
+        self.I_pV = self.limit
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # do, line 58
+        v_1 = self.cursor
+        while True:
+            lab0 = False
+            # (, line 58
+            # or, line 60
+            while True:
+                lab1 = False
+                v_2 = self.cursor
+                while True:
+                    lab2 = False
+                    # (, line 59
+                    if not self.in_grouping(ItalianStemmer.g_v):
+                        break
+                    # or, line 59
+                    while True:
+                        lab3 = False
+                        v_3 = self.cursor
+                        while True:
+                            # (, line 59
+                            if not self.out_grouping(ItalianStemmer.g_v):
+                                break
+                            # gopast, line 59
+                            if not self.go_out_grouping(ItalianStemmer.g_v):
+                                break
+                            self.cursor += 1
+                            lab3 = True
+                            break
+                        if lab3:
+                            break
+                        self.cursor = v_3
+                        # (, line 59
+                        if not self.in_grouping(ItalianStemmer.g_v):
+                            lab2 = True
+                            break
+                        # gopast, line 59
+                        if not self.go_in_grouping(ItalianStemmer.g_v):
+                            lab2 = True
+                            break
+                        self.cursor += 1
+                        break
+                    if lab2:
+                        break
+                    lab1 = True
+                    break
+                if lab1:
+                    break
+                self.cursor = v_2
+                # (, line 61
+                if not self.out_grouping(ItalianStemmer.g_v):
+                    lab0 = True
+                    break
+                # or, line 61
+                while True:
+                    lab5 = False
+                    v_4 = self.cursor
+                    while True:
+                        # (, line 61
+                        if not self.out_grouping(ItalianStemmer.g_v):
+                            break
+                        # gopast, line 61
+                        if not self.go_out_grouping(ItalianStemmer.g_v):
+                            break
+                        self.cursor += 1
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = v_4
+                    # (, line 61
+                    if not self.in_grouping(ItalianStemmer.g_v):
+                        lab0 = True
+                        break
+                    # next, line 61
+                    if self.cursor >= self.limit:
+                        lab0 = True
+                        break
+                    self.cursor += 1
+                    break
+                if lab0:
+                    break
+                break
+            if lab0:
+                break
+            # setmark pV, line 62
+            self.I_pV = self.cursor
+            break
+        self.cursor = v_1
+        # do, line 64
+        v_5 = self.cursor
+        while True:
+            # (, line 64
+            # gopast, line 65
+            if not self.go_out_grouping(ItalianStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 65
+            if not self.go_in_grouping(ItalianStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p1, line 65
+            self.I_p1 = self.cursor
+            # gopast, line 66
+            if not self.go_out_grouping(ItalianStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 66
+            if not self.go_in_grouping(ItalianStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p2, line 66
+            self.I_p2 = self.cursor
+            break
+        self.cursor = v_5
+        return True
+
+    def r_postlude(self):
+        # repeat, line 70
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 70
+                # [, line 72
+                self.bra = self.cursor
+                # substring, line 72
+                among_var = self.find_among(ItalianStemmer.a_1, ItalianStemmer.d_1)
+                if among_var == 0:
+                    break
+                # ], line 72
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 73
+                    # <-, line 73
+                    if not self.slice_from(u"i"):
+                        return False
+                elif among_var == 2:
+                    # (, line 74
+                    # <-, line 74
+                    if not self.slice_from(u"u"):
+                        return False
+                elif among_var == 3:
+                    # (, line 75
+                    # next, line 75
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_RV(self):
+        if not self.I_pV <= self.cursor:
+            return False
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_attached_pronoun(self):
+        # (, line 86
+        # [, line 87
+        self.ket = self.cursor
+        # substring, line 87
+        if self.find_among_b(ItalianStemmer.a_2, ItalianStemmer.d_2) == 0:
+            return False
+        # ], line 87
+        self.bra = self.cursor
+        # among, line 97
+        among_var = self.find_among_b(ItalianStemmer.a_3, ItalianStemmer.d_3)
+        if among_var == 0:
+            return False
+        # (, line 97
+        # call RV, line 97
+        if not self.r_RV():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 98
+            # delete, line 98
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 99
+            # <-, line 99
+            if not self.slice_from(u"e"):
+                return False
+        return True
+
+    def r_standard_suffix(self):
+        # (, line 103
+        # [, line 104
+        self.ket = self.cursor
+        # substring, line 104
+        among_var = self.find_among_b(ItalianStemmer.a_6, ItalianStemmer.d_6)
+        if among_var == 0:
+            return False
+        # ], line 104
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 111
+            # call R2, line 111
+            if not self.r_R2():
+                return False
+            # delete, line 111
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 113
+            # call R2, line 113
+            if not self.r_R2():
+                return False
+            # delete, line 113
+            if not self.slice_del():
+                return False
+
+            # try, line 114
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 114
+                # [, line 114
+                self.ket = self.cursor
+                # literal, line 114
+                if not self.eq_s_b(2, u"ic"):
+                    self.cursor = self.limit - v_1
+                    break
+                # ], line 114
+                self.bra = self.cursor
+                # call R2, line 114
+                if not self.r_R2():
+                    self.cursor = self.limit - v_1
+                    break
+                # delete, line 114
+                if not self.slice_del():
+                    return False
+
+                break
+        elif among_var == 3:
+            # (, line 117
+            # call R2, line 117
+            if not self.r_R2():
+                return False
+            # <-, line 117
+            if not self.slice_from(u"log"):
+                return False
+        elif among_var == 4:
+            # (, line 119
+            # call R2, line 119
+            if not self.r_R2():
+                return False
+            # <-, line 119
+            if not self.slice_from(u"u"):
+                return False
+        elif among_var == 5:
+            # (, line 121
+            # call R2, line 121
+            if not self.r_R2():
+                return False
+            # <-, line 121
+            if not self.slice_from(u"ente"):
+                return False
+        elif among_var == 6:
+            # (, line 123
+            # call RV, line 123
+            if not self.r_RV():
+                return False
+            # delete, line 123
+            if not self.slice_del():
+                return False
+
+        elif among_var == 7:
+            # (, line 124
+            # call R1, line 125
+            if not self.r_R1():
+                return False
+            # delete, line 125
+            if not self.slice_del():
+                return False
+
+            # try, line 126
+            v_2 = self.limit - self.cursor
+            while True:
+                # (, line 126
+                # [, line 127
+                self.ket = self.cursor
+                # substring, line 127
+                among_var = self.find_among_b(ItalianStemmer.a_4, ItalianStemmer.d_4)
+                if among_var == 0:
+                    self.cursor = self.limit - v_2
+                    break
+                # ], line 127
+                self.bra = self.cursor
+                # call R2, line 127
+                if not self.r_R2():
+                    self.cursor = self.limit - v_2
+                    break
+                # delete, line 127
+                if not self.slice_del():
+                    return False
+
+                if among_var == 0:
+                    self.cursor = self.limit - v_2
+                    break
+                elif among_var == 1:
+                    # (, line 128
+                    # [, line 128
+                    self.ket = self.cursor
+                    # literal, line 128
+                    if not self.eq_s_b(2, u"at"):
+                        self.cursor = self.limit - v_2
+                        break
+                    # ], line 128
+                    self.bra = self.cursor
+                    # call R2, line 128
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_2
+                        break
+                    # delete, line 128
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 8:
+            # (, line 133
+            # call R2, line 134
+            if not self.r_R2():
+                return False
+            # delete, line 134
+            if not self.slice_del():
+                return False
+
+            # try, line 135
+            v_3 = self.limit - self.cursor
+            while True:
+                # (, line 135
+                # [, line 136
+                self.ket = self.cursor
+                # substring, line 136
+                among_var = self.find_among_b(ItalianStemmer.a_5, ItalianStemmer.d_5)
+                if among_var == 0:
+                    self.cursor = self.limit - v_3
+                    break
+                # ], line 136
+                self.bra = self.cursor
+                if among_var == 0:
+                    self.cursor = self.limit - v_3
+                    break
+                elif among_var == 1:
+                    # (, line 137
+                    # call R2, line 137
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_3
+                        break
+                    # delete, line 137
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 9:
+            # (, line 141
+            # call R2, line 142
+            if not self.r_R2():
+                return False
+            # delete, line 142
+            if not self.slice_del():
+                return False
+
+            # try, line 143
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 143
+                # [, line 143
+                self.ket = self.cursor
+                # literal, line 143
+                if not self.eq_s_b(2, u"at"):
+                    self.cursor = self.limit - v_4
+                    break
+                # ], line 143
+                self.bra = self.cursor
+                # call R2, line 143
+                if not self.r_R2():
+                    self.cursor = self.limit - v_4
+                    break
+                # delete, line 143
+                if not self.slice_del():
+                    return False
+
+                # [, line 143
+                self.ket = self.cursor
+                # literal, line 143
+                if not self.eq_s_b(2, u"ic"):
+                    self.cursor = self.limit - v_4
+                    break
+                # ], line 143
+                self.bra = self.cursor
+                # call R2, line 143
+                if not self.r_R2():
+                    self.cursor = self.limit - v_4
+                    break
+                # delete, line 143
+                if not self.slice_del():
+                    return False
+
+                break
+        return True
+
+    def r_verb_suffix(self):
+        # setlimit, line 148
+        v_1 = self.limit - self.cursor
+        # tomark, line 148
+        if self.cursor < self.I_pV:
+            return False
+        self.cursor = self.I_pV
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 148
+        # [, line 149
+        self.ket = self.cursor
+        # substring, line 149
+        among_var = self.find_among_b(ItalianStemmer.a_7, ItalianStemmer.d_7)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 149
+        self.bra = self.cursor
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        elif among_var == 1:
+            # (, line 163
+            # delete, line 163
+            if not self.slice_del():
+                return False
+
+        self.limit_backward = v_2
+        return True
+
+    def r_vowel_suffix(self):
+        # (, line 170
+        # try, line 171
+        v_1 = self.limit - self.cursor
+        while True:
+            # (, line 171
+            # [, line 172
+            self.ket = self.cursor
+            if not self.in_grouping_b(ItalianStemmer.g_AEIO):
+                self.cursor = self.limit - v_1
+                break
+            # ], line 172
+            self.bra = self.cursor
+            # call RV, line 172
+            if not self.r_RV():
+                self.cursor = self.limit - v_1
+                break
+            # delete, line 172
+            if not self.slice_del():
+                return False
+
+            # [, line 173
+            self.ket = self.cursor
+            # literal, line 173
+            if not self.eq_s_b(1, u"i"):
+                self.cursor = self.limit - v_1
+                break
+            # ], line 173
+            self.bra = self.cursor
+            # call RV, line 173
+            if not self.r_RV():
+                self.cursor = self.limit - v_1
+                break
+            # delete, line 173
+            if not self.slice_del():
+                return False
+
+            break
+        # try, line 175
+        v_2 = self.limit - self.cursor
+        while True:
+            # (, line 175
+            # [, line 176
+            self.ket = self.cursor
+            # literal, line 176
+            if not self.eq_s_b(1, u"h"):
+                self.cursor = self.limit - v_2
+                break
+            # ], line 176
+            self.bra = self.cursor
+            if not self.in_grouping_b(ItalianStemmer.g_CG):
+                self.cursor = self.limit - v_2
+                break
+            # call RV, line 176
+            if not self.r_RV():
+                self.cursor = self.limit - v_2
+                break
+            # delete, line 176
+            if not self.slice_del():
+                return False
+
+            break
+        return True
+
+    def _stem(self):
+        # (, line 181
+        # do, line 182
+        v_1 = self.cursor
+        while True:
+            # call prelude, line 182
+            if not self.r_prelude():
+                break
+            break
+        self.cursor = v_1
+        # do, line 183
+        v_2 = self.cursor
+        while True:
+            # call mark_regions, line 183
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_2
+        # backwards, line 184
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 184
+        # do, line 185
+        v_3 = self.limit - self.cursor
+        while True:
+            # call attached_pronoun, line 185
+            if not self.r_attached_pronoun():
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 186
+        v_4 = self.limit - self.cursor
+        while True:
+            lab3 = False
+            # (, line 186
+            # or, line 186
+            while True:
+                lab4 = False
+                v_5 = self.limit - self.cursor
+                while True:
+                    # call standard_suffix, line 186
+                    if not self.r_standard_suffix():
+                        break
+                    lab4 = True
+                    break
+                if lab4:
+                    break
+                self.cursor = self.limit - v_5
+                # call verb_suffix, line 186
+                if not self.r_verb_suffix():
+                    lab3 = True
+                    break
+                break
+            if lab3:
+                break
+            break
+        self.cursor = self.limit - v_4
+        # do, line 187
+        v_6 = self.limit - self.cursor
+        while True:
+            # call vowel_suffix, line 187
+            if not self.r_vowel_suffix():
+                break
+            break
+        self.cursor = self.limit - v_6
+        self.cursor = self.limit_backward
+        # do, line 189
+        v_7 = self.cursor
+        while True:
+            # call postlude, line 189
+            if not self.r_postlude():
+                break
+            break
+        self.cursor = v_7
+        return True
@@ -0,0 +1,353 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class NorwegianStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"a", -1, 1),
+        Among(u"e", -1, 1),
+        Among(u"ede", 1, 1),
+        Among(u"ande", 1, 1),
+        Among(u"ende", 1, 1),
+        Among(u"ane", 1, 1),
+        Among(u"ene", 1, 1),
+        Among(u"hetene", 6, 1),
+        Among(u"erte", 1, 3),
+        Among(u"en", -1, 1),
+        Among(u"heten", 9, 1),
+        Among(u"ar", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"heter", 12, 1),
+        Among(u"s", -1, 2),
+        Among(u"as", 14, 1),
+        Among(u"es", 14, 1),
+        Among(u"edes", 16, 1),
+        Among(u"endes", 16, 1),
+        Among(u"enes", 16, 1),
+        Among(u"hetenes", 19, 1),
+        Among(u"ens", 14, 1),
+        Among(u"hetens", 21, 1),
+        Among(u"ers", 14, 1),
+        Among(u"ets", 14, 1),
+        Among(u"et", -1, 1),
+        Among(u"het", 25, 1),
+        Among(u"ert", -1, 3),
+        Among(u"ast", -1, 1)
+    ]
+
+    d_0 = (
+        (7, {
+            u"hetenes": 20
+        }),
+        (6, {
+            u"hetene": 7,
+            u"hetens": 22
+        }),
+        (5, {
+            u"heten": 10,
+            u"heter": 13,
+            u"endes": 18
+        }),
+        (4, {
+            u"ande": 3,
+            u"ende": 4,
+            u"erte": 8,
+            u"edes": 17,
+            u"enes": 19
+        }),
+        (3, {
+            u"ede": 2,
+            u"ane": 5,
+            u"ene": 6,
+            u"ens": 21,
+            u"ers": 23,
+            u"ets": 24,
+            u"het": 26,
+            u"ert": 27,
+            u"ast": 28
+        }),
+        (2, {
+            u"en": 9,
+            u"ar": 11,
+            u"er": 12,
+            u"as": 15,
+            u"es": 16,
+            u"et": 25
+        }),
+        (1, {
+            u"a": 0,
+            u"e": 1,
+            u"s": 14
+        }),
+    )
+
+    a_1 = [
+        Among(u"dt", -1, -1),
+        Among(u"vt", -1, -1)
+    ]
+
+    d_1 = (
+        (2, {
+            u"dt": 0,
+            u"vt": 1
+        }),
+    )
+
+    a_2 = [
+        Among(u"leg", -1, 1),
+        Among(u"eleg", 0, 1),
+        Among(u"ig", -1, 1),
+        Among(u"eig", 2, 1),
+        Among(u"lig", 2, 1),
+        Among(u"elig", 4, 1),
+        Among(u"els", -1, 1),
+        Among(u"lov", -1, 1),
+        Among(u"elov", 7, 1),
+        Among(u"slov", 7, 1),
+        Among(u"hetslov", 9, 1)
+    ]
+
+    d_2 = (
+        (7, {
+            u"hetslov": 10
+        }),
+        (4, {
+            u"eleg": 1,
+            u"elig": 5,
+            u"elov": 8,
+            u"slov": 9
+        }),
+        (3, {
+            u"leg": 0,
+            u"eig": 3,
+            u"lig": 4,
+            u"els": 6,
+            u"lov": 7
+        }),
+        (2, {
+            u"ig": 2
+        }),
+    )
+
+    g_v = frozenset(u"aeiouy\u00E6\u00E5\u00F8")
+
+    g_s_ending = frozenset(u"bcdfghjlmnoprtvyz")
+
+    I_x = 0
+    I_p1 = 0
+
+    def copy_from(self, other):
+        self.I_x = other.I_x
+        self.I_p1 = other.I_p1
+        super.copy_from(other)
+
+    def r_mark_regions(self):
+        # (, line 26
+        self.I_p1 = self.limit
+        # test, line 30
+        v_1 = self.cursor
+        # (, line 30
+        # hop, line 30
+        c = self.cursor + 3
+        if 0 > c or c > self.limit:
+            return False
+        self.cursor = c
+        # setmark x, line 30
+        self.I_x = self.cursor
+        self.cursor = v_1
+        # goto, line 31
+        if not self.go_out_grouping(NorwegianStemmer.g_v):
+            return False
+        # gopast, line 31
+        if not self.go_in_grouping(NorwegianStemmer.g_v):
+            return False
+        self.cursor += 1
+        # setmark p1, line 31
+        self.I_p1 = self.cursor
+        # try, line 32
+        while True:
+            # (, line 32
+            if not (self.I_p1 < self.I_x):
+                break
+            self.I_p1 = self.I_x
+            break
+        return True
+
+    def r_main_suffix(self):
+        # (, line 37
+        # setlimit, line 38
+        v_1 = self.limit - self.cursor
+        # tomark, line 38
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 38
+        # [, line 38
+        self.ket = self.cursor
+        # substring, line 38
+        among_var = self.find_among_b(NorwegianStemmer.a_0, NorwegianStemmer.d_0)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 38
+        self.bra = self.cursor
+        self.limit_backward = v_2
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 44
+            # delete, line 44
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 46
+            # or, line 46
+            while True:
+                lab0 = False
+                v_3 = self.limit - self.cursor
+                while True:
+                    if not self.in_grouping_b(NorwegianStemmer.g_s_ending):
+                        break
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_3
+                # (, line 46
+                # literal, line 46
+                if not self.eq_s_b(1, u"k"):
+                    return False
+                if not self.out_grouping_b(NorwegianStemmer.g_v):
+                    return False
+                break
+            # delete, line 46
+            if not self.slice_del():
+                return False
+
+        elif among_var == 3:
+            # (, line 48
+            # <-, line 48
+            if not self.slice_from(u"er"):
+                return False
+        return True
+
+    def r_consonant_pair(self):
+        # (, line 52
+        # test, line 53
+        v_1 = self.limit - self.cursor
+        # (, line 53
+        # setlimit, line 54
+        v_2 = self.limit - self.cursor
+        # tomark, line 54
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_3 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_2
+        # (, line 54
+        # [, line 54
+        self.ket = self.cursor
+        # substring, line 54
+        if self.find_among_b(NorwegianStemmer.a_1, NorwegianStemmer.d_1) == 0:
+            self.limit_backward = v_3
+            return False
+        # ], line 54
+        self.bra = self.cursor
+        self.limit_backward = v_3
+        self.cursor = self.limit - v_1
+        # next, line 59
+        if self.cursor <= self.limit_backward:
+            return False
+        self.cursor -= 1
+        # ], line 59
+        self.bra = self.cursor
+        # delete, line 59
+        if not self.slice_del():
+            return False
+
+        return True
+
+    def r_other_suffix(self):
+        # (, line 62
+        # setlimit, line 63
+        v_1 = self.limit - self.cursor
+        # tomark, line 63
+        if self.cursor < self.I_p1:
+            return False
+        self.cursor = self.I_p1
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 63
+        # [, line 63
+        self.ket = self.cursor
+        # substring, line 63
+        among_var = self.find_among_b(NorwegianStemmer.a_2, NorwegianStemmer.d_2)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 63
+        self.bra = self.cursor
+        self.limit_backward = v_2
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 67
+            # delete, line 67
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def _stem(self):
+        # (, line 72
+        # do, line 74
+        v_1 = self.cursor
+        while True:
+            # call mark_regions, line 74
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_1
+        # backwards, line 75
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 75
+        # do, line 76
+        v_2 = self.limit - self.cursor
+        while True:
+            # call main_suffix, line 76
+            if not self.r_main_suffix():
+                break
+            break
+        self.cursor = self.limit - v_2
+        # do, line 77
+        v_3 = self.limit - self.cursor
+        while True:
+            # call consonant_pair, line 77
+            if not self.r_consonant_pair():
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 78
+        v_4 = self.limit - self.cursor
+        while True:
+            # call other_suffix, line 78
+            if not self.r_other_suffix():
+                break
+            break
+        self.cursor = self.limit - v_4
+        self.cursor = self.limit_backward
+        return True
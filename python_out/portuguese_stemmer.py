@@ -0,0 +1,1179 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class PortugueseStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"", -1, 3),
+        Among(u"\u00E3", 0, 1),
+        Among(u"\u00F5", 0, 2)
+    ]
+
+    d_0 = (
+        (1, {
+            u"\u00E3": 1,
+            u"\u00F5": 2
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"", -1, 3),
+        Among(u"a~", 0, 1),
+        Among(u"o~", 0, 2)
+    ]
+
+    d_1 = (
+        (2, {
+            u"a~": 1,
+            u"o~": 2
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_2 = [
+        Among(u"ic", -1, -1),
+        Among(u"ad", -1, -1),
+        Among(u"os", -1, -1),
+        Among(u"iv", -1, 1)
+    ]
+
+    d_2 = (
+        (2, {
+            u"ic": 0,
+            u"ad": 1,
+            u"os": 2,
+            u"iv": 3
+        }),
+    )
+
+    a_3 = [
+        Among(u"ante", -1, 1),
+        Among(u"avel", -1, 1),
+        Among(u"\u00EDvel", -1, 1)
+    ]
+
+    d_3 = (
+        (4, {
+            u"ante": 0,
+            u"avel": 1,
+            u"\u00EDvel": 2
+        }),
+    )
+
+    a_4 = [
+        Among(u"ic", -1, 1),
+        Among(u"abil", -1, 1),
+        Among(u"iv", -1, 1)
+    ]
+
+    d_4 = (
+        (4, {
+            u"abil": 1
+        }),
+        (2, {
+            u"ic": 0,
+            u"iv": 2
+        }),
+    )
+
+    a_5 = [
+        Among(u"ica", -1, 1),
+        Among(u"\u00E2ncia", -1, 1),
+        Among(u"\u00EAncia", -1, 4),
+        Among(u"logia", -1, 2),
+        Among(u"ira", -1, 9),
+        Among(u"adora", -1, 1),
+        Among(u"osa", -1, 1),
+        Among(u"ista", -1, 1),
+        Among(u"iva", -1, 8),
+        Among(u"eza", -1, 1),
+        Among(u"idade", -1, 7),
+        Among(u"ante", -1, 1),
+        Among(u"mente", -1, 6),
+        Among(u"amente", 12, 5),
+        Among(u"\u00E1vel", -1, 1),
+        Among(u"\u00EDvel", -1, 1),
+        Among(u"ico", -1, 1),
+        Among(u"ismo", -1, 1),
+        Among(u"oso", -1, 1),
+        Among(u"amento", -1, 1),
+        Among(u"imento", -1, 1),
+        Among(u"ivo", -1, 8),
+        Among(u"a\u00E7a~o", -1, 1),
+        Among(u"u\u00E7a~o", -1, 3),
+        Among(u"ador", -1, 1),
+        Among(u"icas", -1, 1),
+        Among(u"\u00EAncias", -1, 4),
+        Among(u"logias", -1, 2),
+        Among(u"iras", -1, 9),
+        Among(u"adoras", -1, 1),
+        Among(u"osas", -1, 1),
+        Among(u"istas", -1, 1),
+        Among(u"ivas", -1, 8),
+        Among(u"ezas", -1, 1),
+        Among(u"idades", -1, 7),
+        Among(u"adores", -1, 1),
+        Among(u"antes", -1, 1),
+        Among(u"a\u00E7o~es", -1, 1),
+        Among(u"u\u00E7o~es", -1, 3),
+        Among(u"icos", -1, 1),
+        Among(u"ismos", -1, 1),
+        Among(u"osos", -1, 1),
+        Among(u"amentos", -1, 1),
+        Among(u"imentos", -1, 1),
+        Among(u"ivos", -1, 8)
+    ]
+
+    d_5 = (
+        (7, {
+            u"amentos": 42,
+            u"imentos": 43
+        }),
+        (6, {
+            u"amente": 13,
+            u"amento": 19,
+            u"imento": 20,
+            u"\u00EAncias": 26,
+            u"logias": 27,
+            u"adoras": 29,
+            u"idades": 34,
+            u"adores": 35,
+            u"a\u00E7o~es": 37,
+            u"u\u00E7o~es": 38
+        }),
+        (5, {
+            u"\u00E2ncia": 1,
+            u"\u00EAncia": 2,
+            u"logia": 3,
+            u"adora": 5,
+            u"idade": 10,
+            u"mente": 12,
+            u"a\u00E7a~o": 22,
+            u"u\u00E7a~o": 23,
+            u"istas": 31,
+            u"antes": 36,
+            u"ismos": 40
+        }),
+        (4, {
+            u"ista": 7,
+            u"ante": 11,
+            u"\u00E1vel": 14,
+            u"\u00EDvel": 15,
+            u"ismo": 17,
+            u"ador": 24,
+            u"icas": 25,
+            u"iras": 28,
+            u"osas": 30,
+            u"ivas": 32,
+            u"ezas": 33,
+            u"icos": 39,
+            u"osos": 41,
+            u"ivos": 44
+        }),
+        (3, {
+            u"ica": 0,
+            u"ira": 4,
+            u"osa": 6,
+            u"iva": 8,
+            u"eza": 9,
+            u"ico": 16,
+            u"oso": 18,
+            u"ivo": 21
+        }),
+    )
+
+    a_6 = [
+        Among(u"ada", -1, 1),
+        Among(u"ida", -1, 1),
+        Among(u"ia", -1, 1),
+        Among(u"aria", 2, 1),
+        Among(u"eria", 2, 1),
+        Among(u"iria", 2, 1),
+        Among(u"ara", -1, 1),
+        Among(u"era", -1, 1),
+        Among(u"ira", -1, 1),
+        Among(u"ava", -1, 1),
+        Among(u"asse", -1, 1),
+        Among(u"esse", -1, 1),
+        Among(u"isse", -1, 1),
+        Among(u"aste", -1, 1),
+        Among(u"este", -1, 1),
+        Among(u"iste", -1, 1),
+        Among(u"ei", -1, 1),
+        Among(u"arei", 16, 1),
+        Among(u"erei", 16, 1),
+        Among(u"irei", 16, 1),
+        Among(u"am", -1, 1),
+        Among(u"iam", 20, 1),
+        Among(u"ariam", 21, 1),
+        Among(u"eriam", 21, 1),
+        Among(u"iriam", 21, 1),
+        Among(u"aram", 20, 1),
+        Among(u"eram", 20, 1),
+        Among(u"iram", 20, 1),
+        Among(u"avam", 20, 1),
+        Among(u"em", -1, 1),
+        Among(u"arem", 29, 1),
+        Among(u"erem", 29, 1),
+        Among(u"irem", 29, 1),
+        Among(u"assem", 29, 1),
+        Among(u"essem", 29, 1),
+        Among(u"issem", 29, 1),
+        Among(u"ado", -1, 1),
+        Among(u"ido", -1, 1),
+        Among(u"ando", -1, 1),
+        Among(u"endo", -1, 1),
+        Among(u"indo", -1, 1),
+        Among(u"ara~o", -1, 1),
+        Among(u"era~o", -1, 1),
+        Among(u"ira~o", -1, 1),
+        Among(u"ar", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"ir", -1, 1),
+        Among(u"as", -1, 1),
+        Among(u"adas", 47, 1),
+        Among(u"idas", 47, 1),
+        Among(u"ias", 47, 1),
+        Among(u"arias", 50, 1),
+        Among(u"erias", 50, 1),
+        Among(u"irias", 50, 1),
+        Among(u"aras", 47, 1),
+        Among(u"eras", 47, 1),
+        Among(u"iras", 47, 1),
+        Among(u"avas", 47, 1),
+        Among(u"es", -1, 1),
+        Among(u"ardes", 58, 1),
+        Among(u"erdes", 58, 1),
+        Among(u"irdes", 58, 1),
+        Among(u"ares", 58, 1),
+        Among(u"eres", 58, 1),
+        Among(u"ires", 58, 1),
+        Among(u"asses", 58, 1),
+        Among(u"esses", 58, 1),
+        Among(u"isses", 58, 1),
+        Among(u"astes", 58, 1),
+        Among(u"estes", 58, 1),
+        Among(u"istes", 58, 1),
+        Among(u"is", -1, 1),
+        Among(u"ais", 71, 1),
+        Among(u"eis", 71, 1),
+        Among(u"areis", 73, 1),
+        Among(u"ereis", 73, 1),
+        Among(u"ireis", 73, 1),
+        Among(u"\u00E1reis", 73, 1),
+        Among(u"\u00E9reis", 73, 1),
+        Among(u"\u00EDreis", 73, 1),
+        Among(u"\u00E1sseis", 73, 1),
+        Among(u"\u00E9sseis", 73, 1),
+        Among(u"\u00EDsseis", 73, 1),
+        Among(u"\u00E1veis", 73, 1),
+        Among(u"\u00EDeis", 73, 1),
+        Among(u"ar\u00EDeis", 84, 1),
+        Among(u"er\u00EDeis", 84, 1),
+        Among(u"ir\u00EDeis", 84, 1),
+        Among(u"ados", -1, 1),
+        Among(u"idos", -1, 1),
+        Among(u"amos", -1, 1),
+        Among(u"\u00E1ramos", 90, 1),
+        Among(u"\u00E9ramos", 90, 1),
+        Among(u"\u00EDramos", 90, 1),
+        Among(u"\u00E1vamos", 90, 1),
+        Among(u"\u00EDamos", 90, 1),
+        Among(u"ar\u00EDamos", 95, 1),
+        Among(u"er\u00EDamos", 95, 1),
+        Among(u"ir\u00EDamos", 95, 1),
+        Among(u"emos", -1, 1),
+        Among(u"aremos", 99, 1),
+        Among(u"eremos", 99, 1),
+        Among(u"iremos", 99, 1),
+        Among(u"\u00E1ssemos", 99, 1),
+        Among(u"\u00EAssemos", 99, 1),
+        Among(u"\u00EDssemos", 99, 1),
+        Among(u"imos", -1, 1),
+        Among(u"armos", -1, 1),
+        Among(u"ermos", -1, 1),
+        Among(u"irmos", -1, 1),
+        Among(u"\u00E1mos", -1, 1),
+        Among(u"ar\u00E1s", -1, 1),
+        Among(u"er\u00E1s", -1, 1),
+        Among(u"ir\u00E1s", -1, 1),
+        Among(u"eu", -1, 1),
+        Among(u"iu", -1, 1),
+        Among(u"ou", -1, 1),
+        Among(u"ar\u00E1", -1, 1),
+        Among(u"er\u00E1", -1, 1),
+        Among(u"ir\u00E1", -1, 1)
+    ]
+
+    d_6 = (
+        (7, {
+            u"ar\u00EDamos": 96,
+            u"er\u00EDamos": 97,
+            u"ir\u00EDamos": 98,
+            u"\u00E1ssemos": 103,
+            u"\u00EAssemos": 104,
+            u"\u00EDssemos": 105
+        }),
+        (6, {
+            u"\u00E1sseis": 80,
+            u"\u00E9sseis": 81,
+            u"\u00EDsseis": 82,
+            u"ar\u00EDeis": 85,
+            u"er\u00EDeis": 86,
+            u"ir\u00EDeis": 87,
+            u"\u00E1ramos": 91,
+            u"\u00E9ramos": 92,
+            u"\u00EDramos": 93,
+            u"\u00E1vamos": 94,
+            u"aremos": 100,
+            u"eremos": 101,
+            u"iremos": 102
+        }),
+        (5, {
+            u"ariam": 22,
+            u"eriam": 23,
+            u"iriam": 24,
+            u"assem": 33,
+            u"essem": 34,
+            u"issem": 35,
+            u"ara~o": 41,
+            u"era~o": 42,
+            u"ira~o": 43,
+            u"arias": 51,
+            u"erias": 52,
+            u"irias": 53,
+            u"ardes": 59,
+            u"erdes": 60,
+            u"irdes": 61,
+            u"asses": 65,
+            u"esses": 66,
+            u"isses": 67,
+            u"astes": 68,
+            u"estes": 69,
+            u"istes": 70,
+            u"areis": 74,
+            u"ereis": 75,
+            u"ireis": 76,
+            u"\u00E1reis": 77,
+            u"\u00E9reis": 78,
+            u"\u00EDreis": 79,
+            u"\u00E1veis": 83,
+            u"\u00EDamos": 95,
+            u"armos": 107,
+            u"ermos": 108,
+            u"irmos": 109
+        }),
+        (4, {
+            u"aria": 3,
+            u"eria": 4,
+            u"iria": 5,
+            u"asse": 10,
+            u"esse": 11,
+            u"isse": 12,
+            u"aste": 13,
+            u"este": 14,
+            u"iste": 15,
+            u"arei": 17,
+            u"erei": 18,
+            u"irei": 19,
+            u"aram": 25,
+            u"eram": 26,
+            u"iram": 27,
+            u"avam": 28,
+            u"arem": 30,
+            u"erem": 31,
+            u"irem": 32,
+            u"ando": 38,
+            u"endo": 39,
+            u"indo": 40,
+            u"adas": 48,
+            u"idas": 49,
+            u"aras": 54,
+            u"eras": 55,
+            u"iras": 56,
+            u"avas": 57,
+            u"ares": 62,
+            u"eres": 63,
+            u"ires": 64,
+            u"\u00EDeis": 84,
+            u"ados": 88,
+            u"idos": 89,
+            u"amos": 90,
+            u"emos": 99,
+            u"imos": 106,
+            u"\u00E1mos": 110,
+            u"ar\u00E1s": 111,
+            u"er\u00E1s": 112,
+            u"ir\u00E1s": 113
+        }),
+        (3, {
+            u"ada": 0,
+            u"ida": 1,
+            u"ara": 6,
+            u"era": 7,
+            u"ira": 8,
+            u"ava": 9,
+            u"iam": 21,
+            u"ado": 36,
+            u"ido": 37,
+            u"ias": 50,
+            u"ais": 72,
+            u"eis": 73,
+            u"ar\u00E1": 117,
+            u"er\u00E1": 118,
+            u"ir\u00E1": 119
+        }),
+        (2, {
+            u"ia": 2,
+            u"ei": 16,
+            u"am": 20,
+            u"em": 29,
+            u"ar": 44,
+            u"er": 45,
+            u"ir": 46,
+            u"as": 47,
+            u"es": 58,
+            u"is": 71,
+            u"eu": 114,
+            u"iu": 115,
+            u"ou": 116
+        }),
+    )
+
+    a_7 = [
+        Among(u"a", -1, 1),
+        Among(u"i", -1, 1),
+        Among(u"o", -1, 1),
+        Among(u"os", -1, 1),
+        Among(u"\u00E1", -1, 1),
+        Among(u"\u00ED", -1, 1),
+        Among(u"\u00F3", -1, 1)
+    ]
+
+    d_7 = (
+        (2, {
+            u"os": 3
+        }),
+        (1, {
+            u"a": 0,
+            u"i": 1,
+            u"o": 2,
+            u"\u00E1": 4,
+            u"\u00ED": 5,
+            u"\u00F3": 6
+        }),
+    )
+
+    a_8 = [
+        Among(u"e", -1, 1),
+        Among(u"\u00E7", -1, 2),
+        Among(u"\u00E9", -1, 1),
+        Among(u"\u00EA", -1, 1)
+    ]
+
+    d_8 = (
+        (1, {
+            u"e": 0,
+            u"\u00E7": 1,
+            u"\u00E9": 2,
+            u"\u00EA": 3
+        }),
+    )
+
+    g_v = frozenset(u"aeiou\u00E1\u00E9\u00ED\u00F3\u00FA\u00E2\u00EA\u00F4")
+
+    I_p2 = 0
+    I_p1 = 0
+    I_pV = 0
+
+    def copy_from(self, other):
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        self.I_pV = other.I_pV
+        super.copy_from(other)
+
+    def r_prelude(self):
+        # repeat, line 36
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 36
+                # [, line 37
+                self.bra = self.cursor
+                # substring, line 37
+                among_var = self.find_among(PortugueseStemmer.a_0, PortugueseStemmer.d_0)
+                if among_var == 0:
+                    break
+                # ], line 37
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 38
+                    # <-, line 38
+                    if not self.slice_from(u"a~"):
+                        return False
+                elif among_var == 2:
+                    # (, line 39
+                    # <-, line 39
+                    if not self.slice_from(u"o~"):
+                        return False
+                elif among_var == 3:
+                    # (, line 40
+                    # next, line 40
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_mark_regions(self):
+        # (, line 44
+        self.I_pV = self.limit
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # do, line 50
+        v_1 = self.cursor
+        while True:
+            lab0 = False
+            # (, line 50
+            # or, line 52
+            while True:
+                lab1 = False
+                v_2 = self.cursor
+                while True:
+                    lab2 = False
+                    # (, line 51
+                    if not self.in_grouping(PortugueseStemmer.g_v):
+                        break
+                    # or, line 51
+                    while True:
+                        lab3 = False
+                        v_3 = self.cursor
+                        while True:
+                            # (, line 51
+                            if not self.out_grouping(PortugueseStemmer.g_v):
+                                break
+                            # gopast, line 51
+                            if not self.go_out_grouping(PortugueseStemmer.g_v):
+                                break
+                            self.cursor += 1
+                            lab3 = True
+                            break
+                        if lab3:
+                            break
+                        self.cursor = v_3
+                        # (, line 51
+                        if not self.in_grouping(PortugueseStemmer.g_v):
+                            lab2 = True
+                            break
+                        # gopast, line 51
+                        if not self.go_in_grouping(PortugueseStemmer.g_v):
+                            lab2 = True
+                            break
+                        self.cursor += 1
+                        break
+                    if lab2:
+                        break
+                    lab1 = True
+                    break
+                if lab1:
+                    break
+                self.cursor = v_2
+                # (, line 53
+                if not self.out_grouping(PortugueseStemmer.g_v):
+                    lab0 = True
+                    break
+                # or, line 53
+                while True:
+                    lab5 = False
+                    v_4 = self.cursor
+                    while True:
+                        # (, line 53
+                        if not self.out_grouping(PortugueseStemmer.g_v):
+                            break
+                        # gopast, line 53
+                        if not self.go_out_grouping(PortugueseStemmer.g_v):
+                            break
+                        self.cursor += 1
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = v_4
+                    # (, line 53
+                    if not self.in_grouping(PortugueseStemmer.g_v):
+                        lab0 = True
+                        break
+                    # next, line 53
+                    if self.cursor >= self.limit:
+                        lab0 = True
+                        break
+                    self.cursor += 1
+                    break
+                if lab0:
+                    break
+                break
+            if lab0:
+                break
+            # setmark pV, line 54
+            self.I_pV = self.cursor
+            break
+        self.cursor = v_1
+        # do, line 56
+        v_5 = self.cursor
+        while True:
+            # (, line 56
+            # gopast, line 57
+            if not self.go_out_grouping(PortugueseStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 57
+            if not self.go_in_grouping(PortugueseStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p1, line 57
+            self.I_p1 = self.cursor
+            # gopast, line 58
+            if not self.go_out_grouping(PortugueseStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 58
+            if not self.go_in_grouping(PortugueseStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p2, line 58
+            self.I_p2 = self.cursor
+            break
+        self.cursor = v_5
+        return True
+
+    def r_postlude(self):
+        # repeat, line 62
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 62
+                # [, line 63
+                self.bra = self.cursor
+                # substring, line 63
+                among_var = self.find_among(PortugueseStemmer.a_1, PortugueseStemmer.d_1)
+                if among_var == 0:
+                    break
+                # ], line 63
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 64
+                    # <-, line 64
+                    if not self.slice_from(u"\u00E3"):
+                        return False
+                elif among_var == 2:
+                    # (, line 65
+                    # <-, line 65
+                    if not self.slice_from(u"\u00F5"):
+                        return False
+                elif among_var == 3:
+                    # (, line 66
+                    # next, line 66
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_RV(self):
+        if not self.I_pV <= self.cursor:
+            return False
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_standard_suffix(self):
+        # (, line 76
+        # [, line 77
+        self.ket = self.cursor
+        # substring, line 77
+        among_var = self.find_among_b(PortugueseStemmer.a_5, PortugueseStemmer.d_5)
+        if among_var == 0:
+            return False
+        # ], line 77
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 92
+            # call R2, line 93
+            if not self.r_R2():
+                return False
+            # delete, line 93
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 97
+            # call R2, line 98
+            if not self.r_R2():
+                return False
+            # <-, line 98
+            if not self.slice_from(u"log"):
+                return False
+        elif among_var == 3:
+            # (, line 101
+            # call R2, line 102
+            if not self.r_R2():
+                return False
+            # <-, line 102
+            if not self.slice_from(u"u"):
+                return False
+        elif among_var == 4:
+            # (, line 105
+            # call R2, line 106
+            if not self.r_R2():
+                return False
+            # <-, line 106
+            if not self.slice_from(u"ente"):
+                return False
+        elif among_var == 5:
+            # (, line 109
+            # call R1, line 110
+            if not self.r_R1():
+                return False
+            # delete, line 110
+            if not self.slice_del():
+                return False
+
+            # try, line 111
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 111
+                # [, line 112
+                self.ket = self.cursor
+                # substring, line 112
+                among_var = self.find_among_b(PortugueseStemmer.a_2, PortugueseStemmer.d_2)
+                if among_var == 0:
+                    self.cursor = self.limit - v_1
+                    break
+                # ], line 112
+                self.bra = self.cursor
+                # call R2, line 112
+                if not self.r_R2():
+                    self.cursor = self.limit - v_1
+                    break
+                # delete, line 112
+                if not self.slice_del():
+                    return False
+
+                if among_var == 0:
+                    self.cursor = self.limit - v_1
+                    break
+                elif among_var == 1:
+                    # (, line 113
+                    # [, line 113
+                    self.ket = self.cursor
+                    # literal, line 113
+                    if not self.eq_s_b(2, u"at"):
+                        self.cursor = self.limit - v_1
+                        break
+                    # ], line 113
+                    self.bra = self.cursor
+                    # call R2, line 113
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_1
+                        break
+                    # delete, line 113
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 6:
+            # (, line 121
+            # call R2, line 122
+            if not self.r_R2():
+                return False
+            # delete, line 122
+            if not self.slice_del():
+                return False
+
+            # try, line 123
+            v_2 = self.limit - self.cursor
+            while True:
+                # (, line 123
+                # [, line 124
+                self.ket = self.cursor
+                # substring, line 124
+                among_var = self.find_among_b(PortugueseStemmer.a_3, PortugueseStemmer.d_3)
+                if among_var == 0:
+                    self.cursor = self.limit - v_2
+                    break
+                # ], line 124
+                self.bra = self.cursor
+                if among_var == 0:
+                    self.cursor = self.limit - v_2
+                    break
+                elif among_var == 1:
+                    # (, line 127
+                    # call R2, line 127
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_2
+                        break
+                    # delete, line 127
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 7:
+            # (, line 133
+            # call R2, line 134
+            if not self.r_R2():
+                return False
+            # delete, line 134
+            if not self.slice_del():
+                return False
+
+            # try, line 135
+            v_3 = self.limit - self.cursor
+            while True:
+                # (, line 135
+                # [, line 136
+                self.ket = self.cursor
+                # substring, line 136
+                among_var = self.find_among_b(PortugueseStemmer.a_4, PortugueseStemmer.d_4)
+                if among_var == 0:
+                    self.cursor = self.limit - v_3
+                    break
+                # ], line 136
+                self.bra = self.cursor
+                if among_var == 0:
+                    self.cursor = self.limit - v_3
+                    break
+                elif among_var == 1:
+                    # (, line 139
+                    # call R2, line 139
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_3
+                        break
+                    # delete, line 139
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 8:
+            # (, line 145
+            # call R2, line 146
+            if not self.r_R2():
+                return False
+            # delete, line 146
+            if not self.slice_del():
+                return False
+
+            # try, line 147
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 147
+                # [, line 148
+                self.ket = self.cursor
+                # literal, line 148
+                if not self.eq_s_b(2, u"at"):
+                    self.cursor = self.limit - v_4
+                    break
+                # ], line 148
+                self.bra = self.cursor
+                # call R2, line 148
+                if not self.r_R2():
+                    self.cursor = self.limit - v_4
+                    break
+                # delete, line 148
+                if not self.slice_del():
+                    return False
+
+                break
+        elif among_var == 9:
+            # (, line 152
+            # call RV, line 153
+            if not self.r_RV():
+                return False
+            # literal, line 153
+            if not self.eq_s_b(1, u"e"):
+                return False
+            # <-, line 154
+            if not self.slice_from(u"ir"):
+                return False
+        return True
+
+    def r_verb_suffix(self):
+        # setlimit, line 159
+        v_1 = self.limit - self.cursor
+        # tomark, line 159
+        if self.cursor < self.I_pV:
+            return False
+        self.cursor = self.I_pV
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 159
+        # [, line 160
+        self.ket = self.cursor
+        # substring, line 160
+        among_var = self.find_among_b(PortugueseStemmer.a_6, PortugueseStemmer.d_6)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 160
+        self.bra = self.cursor
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        elif among_var == 1:
+            # (, line 179
+            # delete, line 179
+            if not self.slice_del():
+                return False
+
+        self.limit_backward = v_2
+        return True
+
+    def r_residual_suffix(self):
+        # (, line 183
+        # [, line 184
+        self.ket = self.cursor
+        # substring, line 184
+        among_var = self.find_among_b(PortugueseStemmer.a_7, PortugueseStemmer.d_7)
+        if among_var == 0:
+            return False
+        # ], line 184
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 187
+            # call RV, line 187
+            if not self.r_RV():
+                return False
+            # delete, line 187
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_residual_form(self):
+        # (, line 191
+        # [, line 192
+        self.ket = self.cursor
+        # substring, line 192
+        among_var = self.find_among_b(PortugueseStemmer.a_8, PortugueseStemmer.d_8)
+        if among_var == 0:
+            return False
+        # ], line 192
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 194
+            # call RV, line 194
+            if not self.r_RV():
+                return False
+            # delete, line 194
+            if not self.slice_del():
+                return False
+
+            # [, line 194
+            self.ket = self.cursor
+            # or, line 194
+            while True:
+                lab0 = False
+                v_1 = self.limit - self.cursor
+                while True:
+                    # (, line 194
+                    # literal, line 194
+                    if not self.eq_s_b(1, u"u"):
+                        break
+                    # ], line 194
+                    self.bra = self.cursor
+                    # test, line 194
+                    v_2 = self.limit - self.cursor
+                    # literal, line 194
+                    if not self.eq_s_b(1, u"g"):
+                        break
+                    self.cursor = self.limit - v_2
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_1
+                # (, line 195
+                # literal, line 195
+                if not self.eq_s_b(1, u"i"):
+                    return False
+                # ], line 195
+                self.bra = self.cursor
+                # test, line 195
+                v_3 = self.limit - self.cursor
+                # literal, line 195
+                if not self.eq_s_b(1, u"c"):
+                    return False
+                self.cursor = self.limit - v_3
+                break
+            # call RV, line 195
+            if not self.r_RV():
+                return False
+            # delete, line 195
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 196
+            # <-, line 196
+            if not self.slice_from(u"c"):
+                return False
+        return True
+
+    def _stem(self):
+        # (, line 201
+        # do, line 202
+        v_1 = self.cursor
+        while True:
+            # call prelude, line 202
+            if not self.r_prelude():
+                break
+            break
+        self.cursor = v_1
+        # do, line 203
+        v_2 = self.cursor
+        while True:
+            # call mark_regions, line 203
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_2
+        # backwards, line 204
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 204
+        # do, line 205
+        v_3 = self.limit - self.cursor
+        while True:
+            lab2 = False
+            # (, line 205
+            # or, line 209
+            while True:
+                lab3 = False
+                v_4 = self.limit - self.cursor
+                while True:
+                    lab4 = False
+                    # (, line 206
+                    # and, line 207
+                    v_5 = self.limit - self.cursor
+                    # (, line 206
+                    # or, line 206
+                    while True:
+                        lab5 = False
+                        v_6 = self.limit - self.cursor
+                        while True:
+                            # call standard_suffix, line 206
+                            if not self.r_standard_suffix():
+                                break
+                            lab5 = True
+                            break
+                        if lab5:
+                            break
+                        self.cursor = self.limit - v_6
+                        # call verb_suffix, line 206
+                        if not self.r_verb_suffix():
+                            lab4 = True
+                            break
+                        break
+                    if lab4:
+                        break
+                    self.cursor = self.limit - v_5
+                    # do, line 207
+                    v_7 = self.limit - self.cursor
+                    while True:
+                        # (, line 207
+                        # [, line 207
+                        self.ket = self.cursor
+                        # literal, line 207
+                        if not self.eq_s_b(1, u"i"):
+                            break
+                        # ], line 207
+                        self.bra = self.cursor
+                        # test, line 207
+                        v_8 = self.limit - self.cursor
+                        # literal, line 207
+                        if not self.eq_s_b(1, u"c"):
+                            break
+                        self.cursor = self.limit - v_8
+                        # call RV, line 207
+                        if not self.r_RV():
+                            break
+                        # delete, line 207
+                        if not self.slice_del():
+                            return False
+
+                        break
+                    self.cursor = self.limit - v_7
+                    lab3 = True
+                    break
+                if lab3:
+                    break
+                self.cursor = self.limit - v_4
+                # call residual_suffix, line 209
+                if not self.r_residual_suffix():
+                    lab2 = True
+                    break
+                break
+            if lab2:
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 211
+        v_9 = self.limit - self.cursor
+        while True:
+            # call residual_form, line 211
+            if not self.r_residual_form():
+                break
+            break
+        self.cursor = self.limit - v_9
+        self.cursor = self.limit_backward
+        # do, line 213
+        v_10 = self.cursor
+        while True:
+            # call postlude, line 213
+            if not self.r_postlude():
+                break
+            break
+        self.cursor = v_10
+        return True
@@ -0,0 +1,819 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class RussianStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"\u0432", -1, 1),
+        Among(u"\u0438\u0432", 0, 2),
+        Among(u"\u044B\u0432", 0, 2),
+        Among(u"\u0432\u0448\u0438", -1, 1),
+        Among(u"\u0438\u0432\u0448\u0438", 3, 2),
+        Among(u"\u044B\u0432\u0448\u0438", 3, 2),
+        Among(u"\u0432\u0448\u0438\u0441\u044C", -1, 1),
+        Among(u"\u0438\u0432\u0448\u0438\u0441\u044C", 6, 2),
+        Among(u"\u044B\u0432\u0448\u0438\u0441\u044C", 6, 2)
+    ]
+
+    d_0 = (
+        (6, {
+            u"\u0438\u0432\u0448\u0438\u0441\u044C": 7,
+            u"\u044B\u0432\u0448\u0438\u0441\u044C": 8
+        }),
+        (5, {
+            u"\u0432\u0448\u0438\u0441\u044C": 6
+        }),
+        (4, {
+            u"\u0438\u0432\u0448\u0438": 4,
+            u"\u044B\u0432\u0448\u0438": 5
+        }),
+        (3, {
+            u"\u0432\u0448\u0438": 3
+        }),
+        (2, {
+            u"\u0438\u0432": 1,
+            u"\u044B\u0432": 2
+        }),
+        (1, {
+            u"\u0432": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"\u0435\u0435", -1, 1),
+        Among(u"\u0438\u0435", -1, 1),
+        Among(u"\u043E\u0435", -1, 1),
+        Among(u"\u044B\u0435", -1, 1),
+        Among(u"\u0438\u043C\u0438", -1, 1),
+        Among(u"\u044B\u043C\u0438", -1, 1),
+        Among(u"\u0435\u0439", -1, 1),
+        Among(u"\u0438\u0439", -1, 1),
+        Among(u"\u043E\u0439", -1, 1),
+        Among(u"\u044B\u0439", -1, 1),
+        Among(u"\u0435\u043C", -1, 1),
+        Among(u"\u0438\u043C", -1, 1),
+        Among(u"\u043E\u043C", -1, 1),
+        Among(u"\u044B\u043C", -1, 1),
+        Among(u"\u0435\u0433\u043E", -1, 1),
+        Among(u"\u043E\u0433\u043E", -1, 1),
+        Among(u"\u0435\u043C\u0443", -1, 1),
+        Among(u"\u043E\u043C\u0443", -1, 1),
+        Among(u"\u0438\u0445", -1, 1),
+        Among(u"\u044B\u0445", -1, 1),
+        Among(u"\u0435\u044E", -1, 1),
+        Among(u"\u043E\u044E", -1, 1),
+        Among(u"\u0443\u044E", -1, 1),
+        Among(u"\u044E\u044E", -1, 1),
+        Among(u"\u0430\u044F", -1, 1),
+        Among(u"\u044F\u044F", -1, 1)
+    ]
+
+    d_1 = (
+        (3, {
+            u"\u0438\u043C\u0438": 4,
+            u"\u044B\u043C\u0438": 5,
+            u"\u0435\u0433\u043E": 14,
+            u"\u043E\u0433\u043E": 15,
+            u"\u0435\u043C\u0443": 16,
+            u"\u043E\u043C\u0443": 17
+        }),
+        (2, {
+            u"\u0435\u0435": 0,
+            u"\u0438\u0435": 1,
+            u"\u043E\u0435": 2,
+            u"\u044B\u0435": 3,
+            u"\u0435\u0439": 6,
+            u"\u0438\u0439": 7,
+            u"\u043E\u0439": 8,
+            u"\u044B\u0439": 9,
+            u"\u0435\u043C": 10,
+            u"\u0438\u043C": 11,
+            u"\u043E\u043C": 12,
+            u"\u044B\u043C": 13,
+            u"\u0438\u0445": 18,
+            u"\u044B\u0445": 19,
+            u"\u0435\u044E": 20,
+            u"\u043E\u044E": 21,
+            u"\u0443\u044E": 22,
+            u"\u044E\u044E": 23,
+            u"\u0430\u044F": 24,
+            u"\u044F\u044F": 25
+        }),
+    )
+
+    a_2 = [
+        Among(u"\u0435\u043C", -1, 1),
+        Among(u"\u043D\u043D", -1, 1),
+        Among(u"\u0432\u0448", -1, 1),
+        Among(u"\u0438\u0432\u0448", 2, 2),
+        Among(u"\u044B\u0432\u0448", 2, 2),
+        Among(u"\u0449", -1, 1),
+        Among(u"\u044E\u0449", 5, 1),
+        Among(u"\u0443\u044E\u0449", 6, 2)
+    ]
+
+    d_2 = (
+        (3, {
+            u"\u0438\u0432\u0448": 3,
+            u"\u044B\u0432\u0448": 4,
+            u"\u0443\u044E\u0449": 7
+        }),
+        (2, {
+            u"\u0435\u043C": 0,
+            u"\u043D\u043D": 1,
+            u"\u0432\u0448": 2,
+            u"\u044E\u0449": 6
+        }),
+        (1, {
+            u"\u0449": 5
+        }),
+    )
+
+    a_3 = [
+        Among(u"\u0441\u044C", -1, 1),
+        Among(u"\u0441\u044F", -1, 1)
+    ]
+
+    d_3 = (
+        (2, {
+            u"\u0441\u044C": 0,
+            u"\u0441\u044F": 1
+        }),
+    )
+
+    a_4 = [
+        Among(u"\u043B\u0430", -1, 1),
+        Among(u"\u0438\u043B\u0430", 0, 2),
+        Among(u"\u044B\u043B\u0430", 0, 2),
+        Among(u"\u043D\u0430", -1, 1),
+        Among(u"\u0435\u043D\u0430", 3, 2),
+        Among(u"\u0435\u0442\u0435", -1, 1),
+        Among(u"\u0438\u0442\u0435", -1, 2),
+        Among(u"\u0439\u0442\u0435", -1, 1),
+        Among(u"\u0435\u0439\u0442\u0435", 7, 2),
+        Among(u"\u0443\u0439\u0442\u0435", 7, 2),
+        Among(u"\u043B\u0438", -1, 1),
+        Among(u"\u0438\u043B\u0438", 10, 2),
+        Among(u"\u044B\u043B\u0438", 10, 2),
+        Among(u"\u0439", -1, 1),
+        Among(u"\u0435\u0439", 13, 2),
+        Among(u"\u0443\u0439", 13, 2),
+        Among(u"\u043B", -1, 1),
+        Among(u"\u0438\u043B", 16, 2),
+        Among(u"\u044B\u043B", 16, 2),
+        Among(u"\u0435\u043C", -1, 1),
+        Among(u"\u0438\u043C", -1, 2),
+        Among(u"\u044B\u043C", -1, 2),
+        Among(u"\u043D", -1, 1),
+        Among(u"\u0435\u043D", 22, 2),
+        Among(u"\u043B\u043E", -1, 1),
+        Among(u"\u0438\u043B\u043E", 24, 2),
+        Among(u"\u044B\u043B\u043E", 24, 2),
+        Among(u"\u043D\u043E", -1, 1),
+        Among(u"\u0435\u043D\u043E", 27, 2),
+        Among(u"\u043D\u043D\u043E", 27, 1),
+        Among(u"\u0435\u0442", -1, 1),
+        Among(u"\u0443\u0435\u0442", 30, 2),
+        Among(u"\u0438\u0442", -1, 2),
+        Among(u"\u044B\u0442", -1, 2),
+        Among(u"\u044E\u0442", -1, 1),
+        Among(u"\u0443\u044E\u0442", 34, 2),
+        Among(u"\u044F\u0442", -1, 2),
+        Among(u"\u043D\u044B", -1, 1),
+        Among(u"\u0435\u043D\u044B", 37, 2),
+        Among(u"\u0442\u044C", -1, 1),
+        Among(u"\u0438\u0442\u044C", 39, 2),
+        Among(u"\u044B\u0442\u044C", 39, 2),
+        Among(u"\u0435\u0448\u044C", -1, 1),
+        Among(u"\u0438\u0448\u044C", -1, 2),
+        Among(u"\u044E", -1, 2),
+        Among(u"\u0443\u044E", 44, 2)
+    ]
+
+    d_4 = (
+        (4, {
+            u"\u0435\u0439\u0442\u0435": 8,
+            u"\u0443\u0439\u0442\u0435": 9
+        }),
+        (3, {
+            u"\u0438\u043B\u0430": 1,
+            u"\u044B\u043B\u0430": 2,
+            u"\u0435\u043D\u0430": 4,
+            u"\u0435\u0442\u0435": 5,
+            u"\u0438\u0442\u0435": 6,
+            u"\u0439\u0442\u0435": 7,
+            u"\u0438\u043B\u0438": 11,
+            u"\u044B\u043B\u0438": 12,
+            u"\u0438\u043B\u043E": 25,
+            u"\u044B\u043B\u043E": 26,
+            u"\u0435\u043D\u043E": 28,
+            u"\u043D\u043D\u043E": 29,
+            u"\u0443\u0435\u0442": 31,
+            u"\u0443\u044E\u0442": 35,
+            u"\u0435\u043D\u044B": 38,
+            u"\u0438\u0442\u044C": 40,
+            u"\u044B\u0442\u044C": 41,
+            u"\u0435\u0448\u044C": 42,
+            u"\u0438\u0448\u044C": 43
+        }),
+        (2, {
+            u"\u043B\u0430": 0,
+            u"\u043D\u0430": 3,
+            u"\u043B\u0438": 10,
+            u"\u0435\u0439": 14,
+            u"\u0443\u0439": 15,
+            u"\u0438\u043B": 17,
+            u"\u044B\u043B": 18,
+            u"\u0435\u043C": 19,
+            u"\u0438\u043C": 20,
+            u"\u044B\u043C": 21,
+            u"\u0435\u043D": 23,
+            u"\u043B\u043E": 24,
+            u"\u043D\u043E": 27,
+            u"\u0435\u0442": 30,
+            u"\u0438\u0442": 32,
+            u"\u044B\u0442": 33,
+            u"\u044E\u0442": 34,
+            u"\u044F\u0442": 36,
+            u"\u043D\u044B": 37,
+            u"\u0442\u044C": 39,
+            u"\u0443\u044E": 45
+        }),
+        (1, {
+            u"\u0439": 13,
+            u"\u043B": 16,
+            u"\u043D": 22,
+            u"\u044E": 44
+        }),
+    )
+
+    a_5 = [
+        Among(u"\u0430", -1, 1),
+        Among(u"\u0435\u0432", -1, 1),
+        Among(u"\u043E\u0432", -1, 1),
+        Among(u"\u0435", -1, 1),
+        Among(u"\u0438\u0435", 3, 1),
+        Among(u"\u044C\u0435", 3, 1),
+        Among(u"\u0438", -1, 1),
+        Among(u"\u0435\u0438", 6, 1),
+        Among(u"\u0438\u0438", 6, 1),
+        Among(u"\u0430\u043C\u0438", 6, 1),
+        Among(u"\u044F\u043C\u0438", 6, 1),
+        Among(u"\u0438\u044F\u043C\u0438", 10, 1),
+        Among(u"\u0439", -1, 1),
+        Among(u"\u0435\u0439", 12, 1),
+        Among(u"\u0438\u0435\u0439", 13, 1),
+        Among(u"\u0438\u0439", 12, 1),
+        Among(u"\u043E\u0439", 12, 1),
+        Among(u"\u0430\u043C", -1, 1),
+        Among(u"\u0435\u043C", -1, 1),
+        Among(u"\u0438\u0435\u043C", 18, 1),
+        Among(u"\u043E\u043C", -1, 1),
+        Among(u"\u044F\u043C", -1, 1),
+        Among(u"\u0438\u044F\u043C", 21, 1),
+        Among(u"\u043E", -1, 1),
+        Among(u"\u0443", -1, 1),
+        Among(u"\u0430\u0445", -1, 1),
+        Among(u"\u044F\u0445", -1, 1),
+        Among(u"\u0438\u044F\u0445", 26, 1),
+        Among(u"\u044B", -1, 1),
+        Among(u"\u044C", -1, 1),
+        Among(u"\u044E", -1, 1),
+        Among(u"\u0438\u044E", 30, 1),
+        Among(u"\u044C\u044E", 30, 1),
+        Among(u"\u044F", -1, 1),
+        Among(u"\u0438\u044F", 33, 1),
+        Among(u"\u044C\u044F", 33, 1)
+    ]
+
+    d_5 = (
+        (4, {
+            u"\u0438\u044F\u043C\u0438": 11
+        }),
+        (3, {
+            u"\u0430\u043C\u0438": 9,
+            u"\u044F\u043C\u0438": 10,
+            u"\u0438\u0435\u0439": 14,
+            u"\u0438\u0435\u043C": 19,
+            u"\u0438\u044F\u043C": 22,
+            u"\u0438\u044F\u0445": 27
+        }),
+        (2, {
+            u"\u0435\u0432": 1,
+            u"\u043E\u0432": 2,
+            u"\u0438\u0435": 4,
+            u"\u044C\u0435": 5,
+            u"\u0435\u0438": 7,
+            u"\u0438\u0438": 8,
+            u"\u0435\u0439": 13,
+            u"\u0438\u0439": 15,
+            u"\u043E\u0439": 16,
+            u"\u0430\u043C": 17,
+            u"\u0435\u043C": 18,
+            u"\u043E\u043C": 20,
+            u"\u044F\u043C": 21,
+            u"\u0430\u0445": 25,
+            u"\u044F\u0445": 26,
+            u"\u0438\u044E": 31,
+            u"\u044C\u044E": 32,
+            u"\u0438\u044F": 34,
+            u"\u044C\u044F": 35
+        }),
+        (1, {
+            u"\u0430": 0,
+            u"\u0435": 3,
+            u"\u0438": 6,
+            u"\u0439": 12,
+            u"\u043E": 23,
+            u"\u0443": 24,
+            u"\u044B": 28,
+            u"\u044C": 29,
+            u"\u044E": 30,
+            u"\u044F": 33
+        }),
+    )
+
+    a_6 = [
+        Among(u"\u043E\u0441\u0442", -1, 1),
+        Among(u"\u043E\u0441\u0442\u044C", -1, 1)
+    ]
+
+    d_6 = (
+        (4, {
+            u"\u043E\u0441\u0442\u044C": 1
+        }),
+        (3, {
+            u"\u043E\u0441\u0442": 0
+        }),
+    )
+
+    a_7 = [
+        Among(u"\u0435\u0439\u0448\u0435", -1, 1),
+        Among(u"\u043D", -1, 2),
+        Among(u"\u0435\u0439\u0448", -1, 1),
+        Among(u"\u044C", -1, 3)
+    ]
+
+    d_7 = (
+        (4, {
+            u"\u0435\u0439\u0448\u0435": 0
+        }),
+        (3, {
+            u"\u0435\u0439\u0448": 2
+        }),
+        (1, {
+            u"\u043D": 1,
+            u"\u044C": 3
+        }),
+    )
+
+    g_v = frozenset(u"\u0430\u0435\u0438\u043E\u0443\u044B\u044D\u044E\u044F")
+
+    I_p2 = 0
+    I_pV = 0
+
+    def copy_from(self, other):
+        self.I_p2 = other.I_p2
+        self.I_pV = other.I_pV
+        super.copy_from(other)
+
+    def r_mark_regions(self):
+        # (, line 57
+        self.I_pV = self.limit
+        self.I_p2 = self.limit
+        # do, line 61
+        v_1 = self.cursor
+        while True:
+            # (, line 61
+            # gopast, line 62
+            if not self.go_out_grouping(RussianStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark pV, line 62
+            self.I_pV = self.cursor
+            # gopast, line 62
+            if not self.go_in_grouping(RussianStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 63
+            if not self.go_out_grouping(RussianStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 63
+            if not self.go_in_grouping(RussianStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p2, line 63
+            self.I_p2 = self.cursor
+            break
+        self.cursor = v_1
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_perfective_gerund(self):
+        # (, line 71
+        # [, line 72
+        self.ket = self.cursor
+        # substring, line 72
+        among_var = self.find_among_b(RussianStemmer.a_0, RussianStemmer.d_0)
+        if among_var == 0:
+            return False
+        # ], line 72
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 76
+            # or, line 76
+            while True:
+                lab0 = False
+                v_1 = self.limit - self.cursor
+                while True:
+                    # literal, line 76
+                    if not self.eq_s_b(1, u"\u0430"):
+                        break
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_1
+                # literal, line 76
+                if not self.eq_s_b(1, u"\u044F"):
+                    return False
+                break
+            # delete, line 76
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 83
+            # delete, line 83
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_adjective(self):
+        # (, line 87
+        # [, line 88
+        self.ket = self.cursor
+        # substring, line 88
+        among_var = self.find_among_b(RussianStemmer.a_1, RussianStemmer.d_1)
+        if among_var == 0:
+            return False
+        # ], line 88
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 97
+            # delete, line 97
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_adjectival(self):
+        # (, line 101
+        # call adjective, line 102
+        if not self.r_adjective():
+            return False
+        # try, line 109
+        v_1 = self.limit - self.cursor
+        while True:
+            lab0 = False
+            # (, line 109
+            # [, line 110
+            self.ket = self.cursor
+            # substring, line 110
+            among_var = self.find_among_b(RussianStemmer.a_2, RussianStemmer.d_2)
+            if among_var == 0:
+                self.cursor = self.limit - v_1
+                break
+            # ], line 110
+            self.bra = self.cursor
+            if among_var == 0:
+                self.cursor = self.limit - v_1
+                break
+            elif among_var == 1:
+                # (, line 115
+                # or, line 115
+                while True:
+                    lab1 = False
+                    v_2 = self.limit - self.cursor
+                    while True:
+                        # literal, line 115
+                        if not self.eq_s_b(1, u"\u0430"):
+                            break
+                        lab1 = True
+                        break
+                    if lab1:
+                        break
+                    self.cursor = self.limit - v_2
+                    # literal, line 115
+                    if not self.eq_s_b(1, u"\u044F"):
+                        self.cursor = self.limit - v_1
+                        lab0 = True
+                        break
+                    break
+                if lab0:
+                    break
+                # delete, line 115
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 2:
+                # (, line 122
+                # delete, line 122
+                if not self.slice_del():
+                    return False
+
+            break
+        return True
+
+    def r_reflexive(self):
+        # (, line 128
+        # [, line 129
+        self.ket = self.cursor
+        # substring, line 129
+        among_var = self.find_among_b(RussianStemmer.a_3, RussianStemmer.d_3)
+        if among_var == 0:
+            return False
+        # ], line 129
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 132
+            # delete, line 132
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_verb(self):
+        # (, line 136
+        # [, line 137
+        self.ket = self.cursor
+        # substring, line 137
+        among_var = self.find_among_b(RussianStemmer.a_4, RussianStemmer.d_4)
+        if among_var == 0:
+            return False
+        # ], line 137
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 143
+            # or, line 143
+            while True:
+                lab0 = False
+                v_1 = self.limit - self.cursor
+                while True:
+                    # literal, line 143
+                    if not self.eq_s_b(1, u"\u0430"):
+                        break
+                    lab0 = True
+                    break
+                if lab0:
+                    break
+                self.cursor = self.limit - v_1
+                # literal, line 143
+                if not self.eq_s_b(1, u"\u044F"):
+                    return False
+                break
+            # delete, line 143
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 151
+            # delete, line 151
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_noun(self):
+        # (, line 159
+        # [, line 160
+        self.ket = self.cursor
+        # substring, line 160
+        among_var = self.find_among_b(RussianStemmer.a_5, RussianStemmer.d_5)
+        if among_var == 0:
+            return False
+        # ], line 160
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 167
+            # delete, line 167
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_derivational(self):
+        # (, line 175
+        # [, line 176
+        self.ket = self.cursor
+        # substring, line 176
+        among_var = self.find_among_b(RussianStemmer.a_6, RussianStemmer.d_6)
+        if among_var == 0:
+            return False
+        # ], line 176
+        self.bra = self.cursor
+        # call R2, line 176
+        if not self.r_R2():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 179
+            # delete, line 179
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_tidy_up(self):
+        # (, line 183
+        # [, line 184
+        self.ket = self.cursor
+        # substring, line 184
+        among_var = self.find_among_b(RussianStemmer.a_7, RussianStemmer.d_7)
+        if among_var == 0:
+            return False
+        # ], line 184
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 188
+            # delete, line 188
+            if not self.slice_del():
+                return False
+
+            # [, line 189
+            self.ket = self.cursor
+            # literal, line 189
+            if not self.eq_s_b(1, u"\u043D"):
+                return False
+            # ], line 189
+            self.bra = self.cursor
+            # literal, line 189
+            if not self.eq_s_b(1, u"\u043D"):
+                return False
+            # delete, line 189
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 192
+            # literal, line 192
+            if not self.eq_s_b(1, u"\u043D"):
+                return False
+            # delete, line 192
+            if not self.slice_del():
+                return False
+
+        elif among_var == 3:
+            # (, line 194
+            # delete, line 194
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def _stem(self):
+        # (, line 199
+        # do, line 201
+        v_1 = self.cursor
+        while True:
+            # call mark_regions, line 201
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_1
+        # backwards, line 202
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # setlimit, line 202
+        v_2 = self.limit - self.cursor
+        # tomark, line 202
+        if self.cursor < self.I_pV:
+            return False
+        self.cursor = self.I_pV
+        v_3 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_2
+        # (, line 202
+        # do, line 203
+        v_4 = self.limit - self.cursor
+        while True:
+            lab1 = False
+            # (, line 203
+            # or, line 204
+            while True:
+                lab2 = False
+                v_5 = self.limit - self.cursor
+                while True:
+                    # call perfective_gerund, line 204
+                    if not self.r_perfective_gerund():
+                        break
+                    lab2 = True
+                    break
+                if lab2:
+                    break
+                self.cursor = self.limit - v_5
+                # (, line 205
+                # try, line 205
+                v_6 = self.limit - self.cursor
+                while True:
+                    # call reflexive, line 205
+                    if not self.r_reflexive():
+                        self.cursor = self.limit - v_6
+                        break
+                    break
+                # or, line 206
+                while True:
+                    lab5 = False
+                    v_7 = self.limit - self.cursor
+                    while True:
+                        # call adjectival, line 206
+                        if not self.r_adjectival():
+                            break
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = self.limit - v_7
+                    while True:
+                        # call verb, line 206
+                        if not self.r_verb():
+                            break
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = self.limit - v_7
+                    # call noun, line 206
+                    if not self.r_noun():
+                        lab1 = True
+                        break
+                    break
+                if lab1:
+                    break
+                break
+            if lab1:
+                break
+            break
+        self.cursor = self.limit - v_4
+        # try, line 209
+        v_8 = self.limit - self.cursor
+        while True:
+            # (, line 209
+            # [, line 209
+            self.ket = self.cursor
+            # literal, line 209
+            if not self.eq_s_b(1, u"\u0438"):
+                self.cursor = self.limit - v_8
+                break
+            # ], line 209
+            self.bra = self.cursor
+            # delete, line 209
+            if not self.slice_del():
+                return False
+
+            break
+        # do, line 212
+        v_9 = self.limit - self.cursor
+        while True:
+            # call derivational, line 212
+            if not self.r_derivational():
+                break
+            break
+        self.cursor = self.limit - v_9
+        # do, line 213
+        v_10 = self.limit - self.cursor
+        while True:
+            # call tidy_up, line 213
+            if not self.r_tidy_up():
+                break
+            break
+        self.cursor = self.limit - v_10
+        self.limit_backward = v_3
+        self.cursor = self.limit_backward
+        return True
@@ -0,0 +1,1270 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class SpanishStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"", -1, 6),
+        Among(u"\u00E1", 0, 1),
+        Among(u"\u00E9", 0, 2),
+        Among(u"\u00ED", 0, 3),
+        Among(u"\u00F3", 0, 4),
+        Among(u"\u00FA", 0, 5)
+    ]
+
+    d_0 = (
+        (1, {
+            u"\u00E1": 1,
+            u"\u00E9": 2,
+            u"\u00ED": 3,
+            u"\u00F3": 4,
+            u"\u00FA": 5
+        }),
+        (0, {
+            u"": 0
+        }),
+    )
+
+    a_1 = [
+        Among(u"la", -1, -1),
+        Among(u"sela", 0, -1),
+        Among(u"le", -1, -1),
+        Among(u"me", -1, -1),
+        Among(u"se", -1, -1),
+        Among(u"lo", -1, -1),
+        Among(u"selo", 5, -1),
+        Among(u"las", -1, -1),
+        Among(u"selas", 7, -1),
+        Among(u"les", -1, -1),
+        Among(u"los", -1, -1),
+        Among(u"selos", 10, -1),
+        Among(u"nos", -1, -1)
+    ]
+
+    d_1 = (
+        (5, {
+            u"selas": 8,
+            u"selos": 11
+        }),
+        (4, {
+            u"sela": 1,
+            u"selo": 6
+        }),
+        (3, {
+            u"las": 7,
+            u"les": 9,
+            u"los": 10,
+            u"nos": 12
+        }),
+        (2, {
+            u"la": 0,
+            u"le": 2,
+            u"me": 3,
+            u"se": 4,
+            u"lo": 5
+        }),
+    )
+
+    a_2 = [
+        Among(u"ando", -1, 6),
+        Among(u"iendo", -1, 6),
+        Among(u"yendo", -1, 7),
+        Among(u"\u00E1ndo", -1, 2),
+        Among(u"i\u00E9ndo", -1, 1),
+        Among(u"ar", -1, 6),
+        Among(u"er", -1, 6),
+        Among(u"ir", -1, 6),
+        Among(u"\u00E1r", -1, 3),
+        Among(u"\u00E9r", -1, 4),
+        Among(u"\u00EDr", -1, 5)
+    ]
+
+    d_2 = (
+        (5, {
+            u"iendo": 1,
+            u"yendo": 2,
+            u"i\u00E9ndo": 4
+        }),
+        (4, {
+            u"ando": 0,
+            u"\u00E1ndo": 3
+        }),
+        (2, {
+            u"ar": 5,
+            u"er": 6,
+            u"ir": 7,
+            u"\u00E1r": 8,
+            u"\u00E9r": 9,
+            u"\u00EDr": 10
+        }),
+    )
+
+    a_3 = [
+        Among(u"ic", -1, -1),
+        Among(u"ad", -1, -1),
+        Among(u"os", -1, -1),
+        Among(u"iv", -1, 1)
+    ]
+
+    d_3 = (
+        (2, {
+            u"ic": 0,
+            u"ad": 1,
+            u"os": 2,
+            u"iv": 3
+        }),
+    )
+
+    a_4 = [
+        Among(u"able", -1, 1),
+        Among(u"ible", -1, 1),
+        Among(u"ante", -1, 1)
+    ]
+
+    d_4 = (
+        (4, {
+            u"able": 0,
+            u"ible": 1,
+            u"ante": 2
+        }),
+    )
+
+    a_5 = [
+        Among(u"ic", -1, 1),
+        Among(u"abil", -1, 1),
+        Among(u"iv", -1, 1)
+    ]
+
+    d_5 = (
+        (4, {
+            u"abil": 1
+        }),
+        (2, {
+            u"ic": 0,
+            u"iv": 2
+        }),
+    )
+
+    a_6 = [
+        Among(u"ica", -1, 1),
+        Among(u"ancia", -1, 2),
+        Among(u"encia", -1, 5),
+        Among(u"adora", -1, 2),
+        Among(u"osa", -1, 1),
+        Among(u"ista", -1, 1),
+        Among(u"iva", -1, 9),
+        Among(u"anza", -1, 1),
+        Among(u"log\u00EDa", -1, 3),
+        Among(u"idad", -1, 8),
+        Among(u"able", -1, 1),
+        Among(u"ible", -1, 1),
+        Among(u"ante", -1, 2),
+        Among(u"mente", -1, 7),
+        Among(u"amente", 13, 6),
+        Among(u"aci\u00F3n", -1, 2),
+        Among(u"uci\u00F3n", -1, 4),
+        Among(u"ico", -1, 1),
+        Among(u"ismo", -1, 1),
+        Among(u"oso", -1, 1),
+        Among(u"amiento", -1, 1),
+        Among(u"imiento", -1, 1),
+        Among(u"ivo", -1, 9),
+        Among(u"ador", -1, 2),
+        Among(u"icas", -1, 1),
+        Among(u"ancias", -1, 2),
+        Among(u"encias", -1, 5),
+        Among(u"adoras", -1, 2),
+        Among(u"osas", -1, 1),
+        Among(u"istas", -1, 1),
+        Among(u"ivas", -1, 9),
+        Among(u"anzas", -1, 1),
+        Among(u"log\u00EDas", -1, 3),
+        Among(u"idades", -1, 8),
+        Among(u"ables", -1, 1),
+        Among(u"ibles", -1, 1),
+        Among(u"aciones", -1, 2),
+        Among(u"uciones", -1, 4),
+        Among(u"adores", -1, 2),
+        Among(u"antes", -1, 2),
+        Among(u"icos", -1, 1),
+        Among(u"ismos", -1, 1),
+        Among(u"osos", -1, 1),
+        Among(u"amientos", -1, 1),
+        Among(u"imientos", -1, 1),
+        Among(u"ivos", -1, 9)
+    ]
+
+    d_6 = (
+        (8, {
+            u"amientos": 43,
+            u"imientos": 44
+        }),
+        (7, {
+            u"amiento": 20,
+            u"imiento": 21,
+            u"aciones": 36,
+            u"uciones": 37
+        }),
+        (6, {
+            u"amente": 14,
+            u"ancias": 25,
+            u"encias": 26,
+            u"adoras": 27,
+            u"log\u00EDas": 32,
+            u"idades": 33,
+            u"adores": 38
+        }),
+        (5, {
+            u"ancia": 1,
+            u"encia": 2,
+            u"adora": 3,
+            u"log\u00EDa": 8,
+            u"mente": 13,
+            u"aci\u00F3n": 15,
+            u"uci\u00F3n": 16,
+            u"istas": 29,
+            u"anzas": 31,
+            u"ables": 34,
+            u"ibles": 35,
+            u"antes": 39,
+            u"ismos": 41
+        }),
+        (4, {
+            u"ista": 5,
+            u"anza": 7,
+            u"idad": 9,
+            u"able": 10,
+            u"ible": 11,
+            u"ante": 12,
+            u"ismo": 18,
+            u"ador": 23,
+            u"icas": 24,
+            u"osas": 28,
+            u"ivas": 30,
+            u"icos": 40,
+            u"osos": 42,
+            u"ivos": 45
+        }),
+        (3, {
+            u"ica": 0,
+            u"osa": 4,
+            u"iva": 6,
+            u"ico": 17,
+            u"oso": 19,
+            u"ivo": 22
+        }),
+    )
+
+    a_7 = [
+        Among(u"ya", -1, 1),
+        Among(u"ye", -1, 1),
+        Among(u"yan", -1, 1),
+        Among(u"yen", -1, 1),
+        Among(u"yeron", -1, 1),
+        Among(u"yendo", -1, 1),
+        Among(u"yo", -1, 1),
+        Among(u"yas", -1, 1),
+        Among(u"yes", -1, 1),
+        Among(u"yais", -1, 1),
+        Among(u"yamos", -1, 1),
+        Among(u"y\u00F3", -1, 1)
+    ]
+
+    d_7 = (
+        (5, {
+            u"yeron": 4,
+            u"yendo": 5,
+            u"yamos": 10
+        }),
+        (4, {
+            u"yais": 9
+        }),
+        (3, {
+            u"yan": 2,
+            u"yen": 3,
+            u"yas": 7,
+            u"yes": 8
+        }),
+        (2, {
+            u"ya": 0,
+            u"ye": 1,
+            u"yo": 6,
+            u"y\u00F3": 11
+        }),
+    )
+
+    a_8 = [
+        Among(u"aba", -1, 2),
+        Among(u"ada", -1, 2),
+        Among(u"ida", -1, 2),
+        Among(u"ara", -1, 2),
+        Among(u"iera", -1, 2),
+        Among(u"\u00EDa", -1, 2),
+        Among(u"ar\u00EDa", 5, 2),
+        Among(u"er\u00EDa", 5, 2),
+        Among(u"ir\u00EDa", 5, 2),
+        Among(u"ad", -1, 2),
+        Among(u"ed", -1, 2),
+        Among(u"id", -1, 2),
+        Among(u"ase", -1, 2),
+        Among(u"iese", -1, 2),
+        Among(u"aste", -1, 2),
+        Among(u"iste", -1, 2),
+        Among(u"an", -1, 2),
+        Among(u"aban", 16, 2),
+        Among(u"aran", 16, 2),
+        Among(u"ieran", 16, 2),
+        Among(u"\u00EDan", 16, 2),
+        Among(u"ar\u00EDan", 20, 2),
+        Among(u"er\u00EDan", 20, 2),
+        Among(u"ir\u00EDan", 20, 2),
+        Among(u"en", -1, 1),
+        Among(u"asen", 24, 2),
+        Among(u"iesen", 24, 2),
+        Among(u"aron", -1, 2),
+        Among(u"ieron", -1, 2),
+        Among(u"ar\u00E1n", -1, 2),
+        Among(u"er\u00E1n", -1, 2),
+        Among(u"ir\u00E1n", -1, 2),
+        Among(u"ado", -1, 2),
+        Among(u"ido", -1, 2),
+        Among(u"ando", -1, 2),
+        Among(u"iendo", -1, 2),
+        Among(u"ar", -1, 2),
+        Among(u"er", -1, 2),
+        Among(u"ir", -1, 2),
+        Among(u"as", -1, 2),
+        Among(u"abas", 39, 2),
+        Among(u"adas", 39, 2),
+        Among(u"idas", 39, 2),
+        Among(u"aras", 39, 2),
+        Among(u"ieras", 39, 2),
+        Among(u"\u00EDas", 39, 2),
+        Among(u"ar\u00EDas", 45, 2),
+        Among(u"er\u00EDas", 45, 2),
+        Among(u"ir\u00EDas", 45, 2),
+        Among(u"es", -1, 1),
+        Among(u"ases", 49, 2),
+        Among(u"ieses", 49, 2),
+        Among(u"abais", -1, 2),
+        Among(u"arais", -1, 2),
+        Among(u"ierais", -1, 2),
+        Among(u"\u00EDais", -1, 2),
+        Among(u"ar\u00EDais", 55, 2),
+        Among(u"er\u00EDais", 55, 2),
+        Among(u"ir\u00EDais", 55, 2),
+        Among(u"aseis", -1, 2),
+        Among(u"ieseis", -1, 2),
+        Among(u"asteis", -1, 2),
+        Among(u"isteis", -1, 2),
+        Among(u"\u00E1is", -1, 2),
+        Among(u"\u00E9is", -1, 1),
+        Among(u"ar\u00E9is", 64, 2),
+        Among(u"er\u00E9is", 64, 2),
+        Among(u"ir\u00E9is", 64, 2),
+        Among(u"ados", -1, 2),
+        Among(u"idos", -1, 2),
+        Among(u"amos", -1, 2),
+        Among(u"\u00E1bamos", 70, 2),
+        Among(u"\u00E1ramos", 70, 2),
+        Among(u"i\u00E9ramos", 70, 2),
+        Among(u"\u00EDamos", 70, 2),
+        Among(u"ar\u00EDamos", 74, 2),
+        Among(u"er\u00EDamos", 74, 2),
+        Among(u"ir\u00EDamos", 74, 2),
+        Among(u"emos", -1, 1),
+        Among(u"aremos", 78, 2),
+        Among(u"eremos", 78, 2),
+        Among(u"iremos", 78, 2),
+        Among(u"\u00E1semos", 78, 2),
+        Among(u"i\u00E9semos", 78, 2),
+        Among(u"imos", -1, 2),
+        Among(u"ar\u00E1s", -1, 2),
+        Among(u"er\u00E1s", -1, 2),
+        Among(u"ir\u00E1s", -1, 2),
+        Among(u"\u00EDs", -1, 2),
+        Among(u"ar\u00E1", -1, 2),
+        Among(u"er\u00E1", -1, 2),
+        Among(u"ir\u00E1", -1, 2),
+        Among(u"ar\u00E9", -1, 2),
+        Among(u"er\u00E9", -1, 2),
+        Among(u"ir\u00E9", -1, 2),
+        Among(u"i\u00F3", -1, 2)
+    ]
+
+    d_8 = (
+        (7, {
+            u"i\u00E9ramos": 73,
+            u"ar\u00EDamos": 75,
+            u"er\u00EDamos": 76,
+            u"ir\u00EDamos": 77,
+            u"i\u00E9semos": 83
+        }),
+        (6, {
+            u"ierais": 54,
+            u"ar\u00EDais": 56,
+            u"er\u00EDais": 57,
+            u"ir\u00EDais": 58,
+            u"ieseis": 60,
+            u"asteis": 61,
+            u"isteis": 62,
+            u"\u00E1bamos": 71,
+            u"\u00E1ramos": 72,
+            u"aremos": 79,
+            u"eremos": 80,
+            u"iremos": 81,
+            u"\u00E1semos": 82
+        }),
+        (5, {
+            u"ieran": 19,
+            u"ar\u00EDan": 21,
+            u"er\u00EDan": 22,
+            u"ir\u00EDan": 23,
+            u"iesen": 26,
+            u"ieron": 28,
+            u"iendo": 35,
+            u"ieras": 44,
+            u"ar\u00EDas": 46,
+            u"er\u00EDas": 47,
+            u"ir\u00EDas": 48,
+            u"ieses": 51,
+            u"abais": 52,
+            u"arais": 53,
+            u"aseis": 59,
+            u"ar\u00E9is": 65,
+            u"er\u00E9is": 66,
+            u"ir\u00E9is": 67,
+            u"\u00EDamos": 74
+        }),
+        (4, {
+            u"iera": 4,
+            u"ar\u00EDa": 6,
+            u"er\u00EDa": 7,
+            u"ir\u00EDa": 8,
+            u"iese": 13,
+            u"aste": 14,
+            u"iste": 15,
+            u"aban": 17,
+            u"aran": 18,
+            u"asen": 25,
+            u"aron": 27,
+            u"ar\u00E1n": 29,
+            u"er\u00E1n": 30,
+            u"ir\u00E1n": 31,
+            u"ando": 34,
+            u"abas": 40,
+            u"adas": 41,
+            u"idas": 42,
+            u"aras": 43,
+            u"ases": 50,
+            u"\u00EDais": 55,
+            u"ados": 68,
+            u"idos": 69,
+            u"amos": 70,
+            u"emos": 78,
+            u"imos": 84,
+            u"ar\u00E1s": 85,
+            u"er\u00E1s": 86,
+            u"ir\u00E1s": 87
+        }),
+        (3, {
+            u"aba": 0,
+            u"ada": 1,
+            u"ida": 2,
+            u"ara": 3,
+            u"ase": 12,
+            u"\u00EDan": 20,
+            u"ado": 32,
+            u"ido": 33,
+            u"\u00EDas": 45,
+            u"\u00E1is": 63,
+            u"\u00E9is": 64,
+            u"ar\u00E1": 89,
+            u"er\u00E1": 90,
+            u"ir\u00E1": 91,
+            u"ar\u00E9": 92,
+            u"er\u00E9": 93,
+            u"ir\u00E9": 94
+        }),
+        (2, {
+            u"\u00EDa": 5,
+            u"ad": 9,
+            u"ed": 10,
+            u"id": 11,
+            u"an": 16,
+            u"en": 24,
+            u"ar": 36,
+            u"er": 37,
+            u"ir": 38,
+            u"as": 39,
+            u"es": 49,
+            u"\u00EDs": 88,
+            u"i\u00F3": 95
+        }),
+    )
+
+    a_9 = [
+        Among(u"a", -1, 1),
+        Among(u"e", -1, 2),
+        Among(u"o", -1, 1),
+        Among(u"os", -1, 1),
+        Among(u"\u00E1", -1, 1),
+        Among(u"\u00E9", -1, 2),
+        Among(u"\u00ED", -1, 1),
+        Among(u"\u00F3", -1, 1)
+    ]
+
+    d_9 = (
+        (2, {
+            u"os": 3
+        }),
+        (1, {
+            u"a": 0,
+            u"e": 1,
+            u"o": 2,
+            u"\u00E1": 4,
+            u"\u00E9": 5,
+            u"\u00ED": 6,
+            u"\u00F3": 7
+        }),
+    )
+
+    g_v = frozenset(u"aeiou\u00E1\u00E9\u00ED\u00F3\u00FA\u00FC")
+
+    I_p2 = 0
+    I_p1 = 0
+    I_pV = 0
+
+    def copy_from(self, other):
+        self.I_p2 = other.I_p2
+        self.I_p1 = other.I_p1
+        self.I_pV = other.I_pV
+        super.copy_from(other)
+
+    def r_mark_regions(self):
+        # (, line 31
+        self.I_pV = self.limit
+        self.I_p1 = self.limit
+        self.I_p2 = self.limit
+        # do, line 37
+        v_1 = self.cursor
+        while True:
+            lab0 = False
+            # (, line 37
+            # or, line 39
+            while True:
+                lab1 = False
+                v_2 = self.cursor
+                while True:
+                    lab2 = False
+                    # (, line 38
+                    if not self.in_grouping(SpanishStemmer.g_v):
+                        break
+                    # or, line 38
+                    while True:
+                        lab3 = False
+                        v_3 = self.cursor
+                        while True:
+                            # (, line 38
+                            if not self.out_grouping(SpanishStemmer.g_v):
+                                break
+                            # gopast, line 38
+                            if not self.go_out_grouping(SpanishStemmer.g_v):
+                                break
+                            self.cursor += 1
+                            lab3 = True
+                            break
+                        if lab3:
+                            break
+                        self.cursor = v_3
+                        # (, line 38
+                        if not self.in_grouping(SpanishStemmer.g_v):
+                            lab2 = True
+                            break
+                        # gopast, line 38
+                        if not self.go_in_grouping(SpanishStemmer.g_v):
+                            lab2 = True
+                            break
+                        self.cursor += 1
+                        break
+                    if lab2:
+                        break
+                    lab1 = True
+                    break
+                if lab1:
+                    break
+                self.cursor = v_2
+                # (, line 40
+                if not self.out_grouping(SpanishStemmer.g_v):
+                    lab0 = True
+                    break
+                # or, line 40
+                while True:
+                    lab5 = False
+                    v_4 = self.cursor
+                    while True:
+                        # (, line 40
+                        if not self.out_grouping(SpanishStemmer.g_v):
+                            break
+                        # gopast, line 40
+                        if not self.go_out_grouping(SpanishStemmer.g_v):
+                            break
+                        self.cursor += 1
+                        lab5 = True
+                        break
+                    if lab5:
+                        break
+                    self.cursor = v_4
+                    # (, line 40
+                    if not self.in_grouping(SpanishStemmer.g_v):
+                        lab0 = True
+                        break
+                    # next, line 40
+                    if self.cursor >= self.limit:
+                        lab0 = True
+                        break
+                    self.cursor += 1
+                    break
+                if lab0:
+                    break
+                break
+            if lab0:
+                break
+            # setmark pV, line 41
+            self.I_pV = self.cursor
+            break
+        self.cursor = v_1
+        # do, line 43
+        v_5 = self.cursor
+        while True:
+            # (, line 43
+            # gopast, line 44
+            if not self.go_out_grouping(SpanishStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 44
+            if not self.go_in_grouping(SpanishStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p1, line 44
+            self.I_p1 = self.cursor
+            # gopast, line 45
+            if not self.go_out_grouping(SpanishStemmer.g_v):
+                break
+            self.cursor += 1
+            # gopast, line 45
+            if not self.go_in_grouping(SpanishStemmer.g_v):
+                break
+            self.cursor += 1
+            # setmark p2, line 45
+            self.I_p2 = self.cursor
+            break
+        self.cursor = v_5
+        return True
+
+    def r_postlude(self):
+        # repeat, line 49
+        while True:
+            lab1 = False
+            v_1 = self.cursor
+            while True:
+                # (, line 49
+                # [, line 50
+                self.bra = self.cursor
+                # substring, line 50
+                among_var = self.find_among(SpanishStemmer.a_0, SpanishStemmer.d_0)
+                if among_var == 0:
+                    break
+                # ], line 50
+                self.ket = self.cursor
+                if among_var == 0:
+                    break
+                elif among_var == 1:
+                    # (, line 51
+                    # <-, line 51
+                    if not self.slice_from(u"a"):
+                        return False
+                elif among_var == 2:
+                    # (, line 52
+                    # <-, line 52
+                    if not self.slice_from(u"e"):
+                        return False
+                elif among_var == 3:
+                    # (, line 53
+                    # <-, line 53
+                    if not self.slice_from(u"i"):
+                        return False
+                elif among_var == 4:
+                    # (, line 54
+                    # <-, line 54
+                    if not self.slice_from(u"o"):
+                        return False
+                elif among_var == 5:
+                    # (, line 55
+                    # <-, line 55
+                    if not self.slice_from(u"u"):
+                        return False
+                elif among_var == 6:
+                    # (, line 57
+                    # next, line 57
+                    if self.cursor >= self.limit:
+                        break
+                    self.cursor += 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_1
+            break
+        return True
+
+    def r_RV(self):
+        if not self.I_pV <= self.cursor:
+            return False
+        return True
+
+    def r_R1(self):
+        if not self.I_p1 <= self.cursor:
+            return False
+        return True
+
+    def r_R2(self):
+        if not self.I_p2 <= self.cursor:
+            return False
+        return True
+
+    def r_attached_pronoun(self):
+        # (, line 67
+        # [, line 68
+        self.ket = self.cursor
+        # substring, line 68
+        if self.find_among_b(SpanishStemmer.a_1, SpanishStemmer.d_1) == 0:
+            return False
+        # ], line 68
+        self.bra = self.cursor
+        # substring, line 72
+        among_var = self.find_among_b(SpanishStemmer.a_2, SpanishStemmer.d_2)
+        if among_var == 0:
+            return False
+        # call RV, line 72
+        if not self.r_RV():
+            return False
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 73
+            # ], line 73
+            self.bra = self.cursor
+            # <-, line 73
+            if not self.slice_from(u"iendo"):
+                return False
+        elif among_var == 2:
+            # (, line 74
+            # ], line 74
+            self.bra = self.cursor
+            # <-, line 74
+            if not self.slice_from(u"ando"):
+                return False
+        elif among_var == 3:
+            # (, line 75
+            # ], line 75
+            self.bra = self.cursor
+            # <-, line 75
+            if not self.slice_from(u"ar"):
+                return False
+        elif among_var == 4:
+            # (, line 76
+            # ], line 76
+            self.bra = self.cursor
+            # <-, line 76
+            if not self.slice_from(u"er"):
+                return False
+        elif among_var == 5:
+            # (, line 77
+            # ], line 77
+            self.bra = self.cursor
+            # <-, line 77
+            if not self.slice_from(u"ir"):
+                return False
+        elif among_var == 6:
+            # (, line 81
+            # delete, line 81
+            if not self.slice_del():
+                return False
+
+        elif among_var == 7:
+            # (, line 82
+            # literal, line 82
+            if not self.eq_s_b(1, u"u"):
+                return False
+            # delete, line 82
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_standard_suffix(self):
+        # (, line 86
+        # [, line 87
+        self.ket = self.cursor
+        # substring, line 87
+        among_var = self.find_among_b(SpanishStemmer.a_6, SpanishStemmer.d_6)
+        if among_var == 0:
+            return False
+        # ], line 87
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 98
+            # call R2, line 99
+            if not self.r_R2():
+                return False
+            # delete, line 99
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 104
+            # call R2, line 105
+            if not self.r_R2():
+                return False
+            # delete, line 105
+            if not self.slice_del():
+                return False
+
+            # try, line 106
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 106
+                # [, line 106
+                self.ket = self.cursor
+                # literal, line 106
+                if not self.eq_s_b(2, u"ic"):
+                    self.cursor = self.limit - v_1
+                    break
+                # ], line 106
+                self.bra = self.cursor
+                # call R2, line 106
+                if not self.r_R2():
+                    self.cursor = self.limit - v_1
+                    break
+                # delete, line 106
+                if not self.slice_del():
+                    return False
+
+                break
+        elif among_var == 3:
+            # (, line 110
+            # call R2, line 111
+            if not self.r_R2():
+                return False
+            # <-, line 111
+            if not self.slice_from(u"log"):
+                return False
+        elif among_var == 4:
+            # (, line 114
+            # call R2, line 115
+            if not self.r_R2():
+                return False
+            # <-, line 115
+            if not self.slice_from(u"u"):
+                return False
+        elif among_var == 5:
+            # (, line 118
+            # call R2, line 119
+            if not self.r_R2():
+                return False
+            # <-, line 119
+            if not self.slice_from(u"ente"):
+                return False
+        elif among_var == 6:
+            # (, line 122
+            # call R1, line 123
+            if not self.r_R1():
+                return False
+            # delete, line 123
+            if not self.slice_del():
+                return False
+
+            # try, line 124
+            v_2 = self.limit - self.cursor
+            while True:
+                # (, line 124
+                # [, line 125
+                self.ket = self.cursor
+                # substring, line 125
+                among_var = self.find_among_b(SpanishStemmer.a_3, SpanishStemmer.d_3)
+                if among_var == 0:
+                    self.cursor = self.limit - v_2
+                    break
+                # ], line 125
+                self.bra = self.cursor
+                # call R2, line 125
+                if not self.r_R2():
+                    self.cursor = self.limit - v_2
+                    break
+                # delete, line 125
+                if not self.slice_del():
+                    return False
+
+                if among_var == 0:
+                    self.cursor = self.limit - v_2
+                    break
+                elif among_var == 1:
+                    # (, line 126
+                    # [, line 126
+                    self.ket = self.cursor
+                    # literal, line 126
+                    if not self.eq_s_b(2, u"at"):
+                        self.cursor = self.limit - v_2
+                        break
+                    # ], line 126
+                    self.bra = self.cursor
+                    # call R2, line 126
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_2
+                        break
+                    # delete, line 126
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 7:
+            # (, line 134
+            # call R2, line 135
+            if not self.r_R2():
+                return False
+            # delete, line 135
+            if not self.slice_del():
+                return False
+
+            # try, line 136
+            v_3 = self.limit - self.cursor
+            while True:
+                # (, line 136
+                # [, line 137
+                self.ket = self.cursor
+                # substring, line 137
+                among_var = self.find_among_b(SpanishStemmer.a_4, SpanishStemmer.d_4)
+                if among_var == 0:
+                    self.cursor = self.limit - v_3
+                    break
+                # ], line 137
+                self.bra = self.cursor
+                if among_var == 0:
+                    self.cursor = self.limit - v_3
+                    break
+                elif among_var == 1:
+                    # (, line 140
+                    # call R2, line 140
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_3
+                        break
+                    # delete, line 140
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 8:
+            # (, line 146
+            # call R2, line 147
+            if not self.r_R2():
+                return False
+            # delete, line 147
+            if not self.slice_del():
+                return False
+
+            # try, line 148
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 148
+                # [, line 149
+                self.ket = self.cursor
+                # substring, line 149
+                among_var = self.find_among_b(SpanishStemmer.a_5, SpanishStemmer.d_5)
+                if among_var == 0:
+                    self.cursor = self.limit - v_4
+                    break
+                # ], line 149
+                self.bra = self.cursor
+                if among_var == 0:
+                    self.cursor = self.limit - v_4
+                    break
+                elif among_var == 1:
+                    # (, line 152
+                    # call R2, line 152
+                    if not self.r_R2():
+                        self.cursor = self.limit - v_4
+                        break
+                    # delete, line 152
+                    if not self.slice_del():
+                        return False
+
+                break
+        elif among_var == 9:
+            # (, line 158
+            # call R2, line 159
+            if not self.r_R2():
+                return False
+            # delete, line 159
+            if not self.slice_del():
+                return False
+
+            # try, line 160
+            v_5 = self.limit - self.cursor
+            while True:
+                # (, line 160
+                # [, line 161
+                self.ket = self.cursor
+                # literal, line 161
+                if not self.eq_s_b(2, u"at"):
+                    self.cursor = self.limit - v_5
+                    break
+                # ], line 161
+                self.bra = self.cursor
+                # call R2, line 161
+                if not self.r_R2():
+                    self.cursor = self.limit - v_5
+                    break
+                # delete, line 161
+                if not self.slice_del():
+                    return False
+
+                break
+        return True
+
+    def r_y_verb_suffix(self):
+        # (, line 167
+        # setlimit, line 168
+        v_1 = self.limit - self.cursor
+        # tomark, line 168
+        if self.cursor < self.I_pV:
+            return False
+        self.cursor = self.I_pV
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 168
+        # [, line 168
+        self.ket = self.cursor
+        # substring, line 168
+        among_var = self.find_among_b(SpanishStemmer.a_7, SpanishStemmer.d_7)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 168
+        self.bra = self.cursor
+        self.limit_backward = v_2
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 171
+            # literal, line 171
+            if not self.eq_s_b(1, u"u"):
+                return False
+            # delete, line 171
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_verb_suffix(self):
+        # (, line 175
+        # setlimit, line 176
+        v_1 = self.limit - self.cursor
+        # tomark, line 176
+        if self.cursor < self.I_pV:
+            return False
+        self.cursor = self.I_pV
+        v_2 = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit - v_1
+        # (, line 176
+        # [, line 176
+        self.ket = self.cursor
+        # substring, line 176
+        among_var = self.find_among_b(SpanishStemmer.a_8, SpanishStemmer.d_8)
+        if among_var == 0:
+            self.limit_backward = v_2
+            return False
+        # ], line 176
+        self.bra = self.cursor
+        self.limit_backward = v_2
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 179
+            # try, line 179
+            v_3 = self.limit - self.cursor
+            while True:
+                # (, line 179
+                # literal, line 179
+                if not self.eq_s_b(1, u"u"):
+                    self.cursor = self.limit - v_3
+                    break
+                # test, line 179
+                v_4 = self.limit - self.cursor
+                # literal, line 179
+                if not self.eq_s_b(1, u"g"):
+                    self.cursor = self.limit - v_3
+                    break
+                self.cursor = self.limit - v_4
+                break
+            # ], line 179
+            self.bra = self.cursor
+            # delete, line 179
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 200
+            # delete, line 200
+            if not self.slice_del():
+                return False
+
+        return True
+
+    def r_residual_suffix(self):
+        # (, line 204
+        # [, line 205
+        self.ket = self.cursor
+        # substring, line 205
+        among_var = self.find_among_b(SpanishStemmer.a_9, SpanishStemmer.d_9)
+        if among_var == 0:
+            return False
+        # ], line 205
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 208
+            # call RV, line 208
+            if not self.r_RV():
+                return False
+            # delete, line 208
+            if not self.slice_del():
+                return False
+
+        elif among_var == 2:
+            # (, line 210
+            # call RV, line 210
+            if not self.r_RV():
+                return False
+            # delete, line 210
+            if not self.slice_del():
+                return False
+
+            # try, line 210
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 210
+                # [, line 210
+                self.ket = self.cursor
+                # literal, line 210
+                if not self.eq_s_b(1, u"u"):
+                    self.cursor = self.limit - v_1
+                    break
+                # ], line 210
+                self.bra = self.cursor
+                # test, line 210
+                v_2 = self.limit - self.cursor
+                # literal, line 210
+                if not self.eq_s_b(1, u"g"):
+                    self.cursor = self.limit - v_1
+                    break
+                self.cursor = self.limit - v_2
+                # call RV, line 210
+                if not self.r_RV():
+                    self.cursor = self.limit - v_1
+                    break
+                # delete, line 210
+                if not self.slice_del():
+                    return False
+
+                break
+        return True
+
+    def _stem(self):
+        # (, line 215
+        # do, line 216
+        v_1 = self.cursor
+        while True:
+            # call mark_regions, line 216
+            if not self.r_mark_regions():
+                break
+            break
+        self.cursor = v_1
+        # backwards, line 217
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 217
+        # do, line 218
+        v_2 = self.limit - self.cursor
+        while True:
+            # call attached_pronoun, line 218
+            if not self.r_attached_pronoun():
+                break
+            break
+        self.cursor = self.limit - v_2
+        # do, line 219
+        v_3 = self.limit - self.cursor
+        while True:
+            lab2 = False
+            # (, line 219
+            # or, line 219
+            while True:
+                lab3 = False
+                v_4 = self.limit - self.cursor
+                while True:
+                    # call standard_suffix, line 219
+                    if not self.r_standard_suffix():
+                        break
+                    lab3 = True
+                    break
+                if lab3:
+                    break
+                self.cursor = self.limit - v_4
+                while True:
+                    # call y_verb_suffix, line 220
+                    if not self.r_y_verb_suffix():
+                        break
+                    lab3 = True
+                    break
+                if lab3:
+                    break
+                self.cursor = self.limit - v_4
+                # call verb_suffix, line 221
+                if not self.r_verb_suffix():
+                    lab2 = True
+                    break
+                break
+            if lab2:
+                break
+            break
+        self.cursor = self.limit - v_3
+        # do, line 223
+        v_5 = self.limit - self.cursor
+        while True:
+            # call residual_suffix, line 223
+            if not self.r_residual_suffix():
+                break
+            break
+        self.cursor = self.limit - v_5
+        self.cursor = self.limit_backward
+        # do, line 225
+        v_6 = self.cursor
+        while True:
+            # call postlude, line 225
+            if not self.r_postlude():
+                break
+            break
+        self.cursor = v_6
+        return True
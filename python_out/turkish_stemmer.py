@@ -0,0 +1,2906 @@
+# self file was generated automatically by the Snowball to Python compiler
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class TurkishStemmer(BaseStemmer):
+    '''
+    self class was automatically generated by a Snowball to Python compiler
+    It implements the stemming algorithm defined by a snowball script.
+    '''
+
+    a_0 = [
+        Among(u"m", -1, -1),
+        Among(u"n", -1, -1),
+        Among(u"miz", -1, -1),
+        Among(u"niz", -1, -1),
+        Among(u"muz", -1, -1),
+        Among(u"nuz", -1, -1),
+        Among(u"m\u00FCz", -1, -1),
+        Among(u"n\u00FCz", -1, -1),
+        Among(u"m\u0131z", -1, -1),
+        Among(u"n\u0131z", -1, -1)
+    ]
+
+    d_0 = (
+        (3, {
+            u"miz": 2,
+            u"niz": 3,
+            u"muz": 4,
+            u"nuz": 5,
+            u"m\u00FCz": 6,
+            u"n\u00FCz": 7,
+            u"m\u0131z": 8,
+            u"n\u0131z": 9
+        }),
+        (1, {
+            u"m": 0,
+            u"n": 1
+        }),
+    )
+
+    a_1 = [
+        Among(u"leri", -1, -1),
+        Among(u"lar\u0131", -1, -1)
+    ]
+
+    d_1 = (
+        (4, {
+            u"leri": 0,
+            u"lar\u0131": 1
+        }),
+    )
+
+    a_2 = [
+        Among(u"ni", -1, -1),
+        Among(u"nu", -1, -1),
+        Among(u"n\u00FC", -1, -1),
+        Among(u"n\u0131", -1, -1)
+    ]
+
+    d_2 = (
+        (2, {
+            u"ni": 0,
+            u"nu": 1,
+            u"n\u00FC": 2,
+            u"n\u0131": 3
+        }),
+    )
+
+    a_3 = [
+        Among(u"in", -1, -1),
+        Among(u"un", -1, -1),
+        Among(u"\u00FCn", -1, -1),
+        Among(u"\u0131n", -1, -1)
+    ]
+
+    d_3 = (
+        (2, {
+            u"in": 0,
+            u"un": 1,
+            u"\u00FCn": 2,
+            u"\u0131n": 3
+        }),
+    )
+
+    a_4 = [
+        Among(u"a", -1, -1),
+        Among(u"e", -1, -1)
+    ]
+
+    d_4 = (
+        (1, {
+            u"a": 0,
+            u"e": 1
+        }),
+    )
+
+    a_5 = [
+        Among(u"na", -1, -1),
+        Among(u"ne", -1, -1)
+    ]
+
+    d_5 = (
+        (2, {
+            u"na": 0,
+            u"ne": 1
+        }),
+    )
+
+    a_6 = [
+        Among(u"da", -1, -1),
+        Among(u"ta", -1, -1),
+        Among(u"de", -1, -1),
+        Among(u"te", -1, -1)
+    ]
+
+    d_6 = (
+        (2, {
+            u"da": 0,
+            u"ta": 1,
+            u"de": 2,
+            u"te": 3
+        }),
+    )
+
+    a_7 = [
+        Among(u"nda", -1, -1),
+        Among(u"nde", -1, -1)
+    ]
+
+    d_7 = (
+        (3, {
+            u"nda": 0,
+            u"nde": 1
+        }),
+    )
+
+    a_8 = [
+        Among(u"dan", -1, -1),
+        Among(u"tan", -1, -1),
+        Among(u"den", -1, -1),
+        Among(u"ten", -1, -1)
+    ]
+
+    d_8 = (
+        (3, {
+            u"dan": 0,
+            u"tan": 1,
+            u"den": 2,
+            u"ten": 3
+        }),
+    )
+
+    a_9 = [
+        Among(u"ndan", -1, -1),
+        Among(u"nden", -1, -1)
+    ]
+
+    d_9 = (
+        (4, {
+            u"ndan": 0,
+            u"nden": 1
+        }),
+    )
+
+    a_10 = [
+        Among(u"la", -1, -1),
+        Among(u"le", -1, -1)
+    ]
+
+    d_10 = (
+        (2, {
+            u"la": 0,
+            u"le": 1
+        }),
+    )
+
+    a_11 = [
+        Among(u"ca", -1, -1),
+        Among(u"ce", -1, -1)
+    ]
+
+    d_11 = (
+        (2, {
+            u"ca": 0,
+            u"ce": 1
+        }),
+    )
+
+    a_12 = [
+        Among(u"im", -1, -1),
+        Among(u"um", -1, -1),
+        Among(u"\u00FCm", -1, -1),
+        Among(u"\u0131m", -1, -1)
+    ]
+
+    d_12 = (
+        (2, {
+            u"im": 0,
+            u"um": 1,
+            u"\u00FCm": 2,
+            u"\u0131m": 3
+        }),
+    )
+
+    a_13 = [
+        Among(u"sin", -1, -1),
+        Among(u"sun", -1, -1),
+        Among(u"s\u00FCn", -1, -1),
+        Among(u"s\u0131n", -1, -1)
+    ]
+
+    d_13 = (
+        (3, {
+            u"sin": 0,
+            u"sun": 1,
+            u"s\u00FCn": 2,
+            u"s\u0131n": 3
+        }),
+    )
+
+    a_14 = [
+        Among(u"iz", -1, -1),
+        Among(u"uz", -1, -1),
+        Among(u"\u00FCz", -1, -1),
+        Among(u"\u0131z", -1, -1)
+    ]
+
+    d_14 = (
+        (2, {
+            u"iz": 0,
+            u"uz": 1,
+            u"\u00FCz": 2,
+            u"\u0131z": 3
+        }),
+    )
+
+    a_15 = [
+        Among(u"siniz", -1, -1),
+        Among(u"sunuz", -1, -1),
+        Among(u"s\u00FCn\u00FCz", -1, -1),
+        Among(u"s\u0131n\u0131z", -1, -1)
+    ]
+
+    d_15 = (
+        (5, {
+            u"siniz": 0,
+            u"sunuz": 1,
+            u"s\u00FCn\u00FCz": 2,
+            u"s\u0131n\u0131z": 3
+        }),
+    )
+
+    a_16 = [
+        Among(u"lar", -1, -1),
+        Among(u"ler", -1, -1)
+    ]
+
+    d_16 = (
+        (3, {
+            u"lar": 0,
+            u"ler": 1
+        }),
+    )
+
+    a_17 = [
+        Among(u"niz", -1, -1),
+        Among(u"nuz", -1, -1),
+        Among(u"n\u00FCz", -1, -1),
+        Among(u"n\u0131z", -1, -1)
+    ]
+
+    d_17 = (
+        (3, {
+            u"niz": 0,
+            u"nuz": 1,
+            u"n\u00FCz": 2,
+            u"n\u0131z": 3
+        }),
+    )
+
+    a_18 = [
+        Among(u"dir", -1, -1),
+        Among(u"tir", -1, -1),
+        Among(u"dur", -1, -1),
+        Among(u"tur", -1, -1),
+        Among(u"d\u00FCr", -1, -1),
+        Among(u"t\u00FCr", -1, -1),
+        Among(u"d\u0131r", -1, -1),
+        Among(u"t\u0131r", -1, -1)
+    ]
+
+    d_18 = (
+        (3, {
+            u"dir": 0,
+            u"tir": 1,
+            u"dur": 2,
+            u"tur": 3,
+            u"d\u00FCr": 4,
+            u"t\u00FCr": 5,
+            u"d\u0131r": 6,
+            u"t\u0131r": 7
+        }),
+    )
+
+    a_19 = [
+        Among(u"cas\u0131na", -1, -1),
+        Among(u"cesine", -1, -1)
+    ]
+
+    d_19 = (
+        (6, {
+            u"cas\u0131na": 0,
+            u"cesine": 1
+        }),
+    )
+
+    a_20 = [
+        Among(u"di", -1, -1),
+        Among(u"ti", -1, -1),
+        Among(u"dik", -1, -1),
+        Among(u"tik", -1, -1),
+        Among(u"duk", -1, -1),
+        Among(u"tuk", -1, -1),
+        Among(u"d\u00FCk", -1, -1),
+        Among(u"t\u00FCk", -1, -1),
+        Among(u"d\u0131k", -1, -1),
+        Among(u"t\u0131k", -1, -1),
+        Among(u"dim", -1, -1),
+        Among(u"tim", -1, -1),
+        Among(u"dum", -1, -1),
+        Among(u"tum", -1, -1),
+        Among(u"d\u00FCm", -1, -1),
+        Among(u"t\u00FCm", -1, -1),
+        Among(u"d\u0131m", -1, -1),
+        Among(u"t\u0131m", -1, -1),
+        Among(u"din", -1, -1),
+        Among(u"tin", -1, -1),
+        Among(u"dun", -1, -1),
+        Among(u"tun", -1, -1),
+        Among(u"d\u00FCn", -1, -1),
+        Among(u"t\u00FCn", -1, -1),
+        Among(u"d\u0131n", -1, -1),
+        Among(u"t\u0131n", -1, -1),
+        Among(u"du", -1, -1),
+        Among(u"tu", -1, -1),
+        Among(u"d\u00FC", -1, -1),
+        Among(u"t\u00FC", -1, -1),
+        Among(u"d\u0131", -1, -1),
+        Among(u"t\u0131", -1, -1)
+    ]
+
+    d_20 = (
+        (3, {
+            u"dik": 2,
+            u"tik": 3,
+            u"duk": 4,
+            u"tuk": 5,
+            u"d\u00FCk": 6,
+            u"t\u00FCk": 7,
+            u"d\u0131k": 8,
+            u"t\u0131k": 9,
+            u"dim": 10,
+            u"tim": 11,
+            u"dum": 12,
+            u"tum": 13,
+            u"d\u00FCm": 14,
+            u"t\u00FCm": 15,
+            u"d\u0131m": 16,
+            u"t\u0131m": 17,
+            u"din": 18,
+            u"tin": 19,
+            u"dun": 20,
+            u"tun": 21,
+            u"d\u00FCn": 22,
+            u"t\u00FCn": 23,
+            u"d\u0131n": 24,
+            u"t\u0131n": 25
+        }),
+        (2, {
+            u"di": 0,
+            u"ti": 1,
+            u"du": 26,
+            u"tu": 27,
+            u"d\u00FC": 28,
+            u"t\u00FC": 29,
+            u"d\u0131": 30,
+            u"t\u0131": 31
+        }),
+    )
+
+    a_21 = [
+        Among(u"sa", -1, -1),
+        Among(u"se", -1, -1),
+        Among(u"sak", -1, -1),
+        Among(u"sek", -1, -1),
+        Among(u"sam", -1, -1),
+        Among(u"sem", -1, -1),
+        Among(u"san", -1, -1),
+        Among(u"sen", -1, -1)
+    ]
+
+    d_21 = (
+        (3, {
+            u"sak": 2,
+            u"sek": 3,
+            u"sam": 4,
+            u"sem": 5,
+            u"san": 6,
+            u"sen": 7
+        }),
+        (2, {
+            u"sa": 0,
+            u"se": 1
+        }),
+    )
+
+    a_22 = [
+        Among(u"mi\u015F", -1, -1),
+        Among(u"mu\u015F", -1, -1),
+        Among(u"m\u00FC\u015F", -1, -1),
+        Among(u"m\u0131\u015F", -1, -1)
+    ]
+
+    d_22 = (
+        (3, {
+            u"mi\u015F": 0,
+            u"mu\u015F": 1,
+            u"m\u00FC\u015F": 2,
+            u"m\u0131\u015F": 3
+        }),
+    )
+
+    a_23 = [
+        Among(u"b", -1, 1),
+        Among(u"c", -1, 2),
+        Among(u"d", -1, 3),
+        Among(u"\u011F", -1, 4)
+    ]
+
+    d_23 = (
+        (1, {
+            u"b": 0,
+            u"c": 1,
+            u"d": 2,
+            u"\u011F": 3
+        }),
+    )
+
+    g_vowel = frozenset(u"ae\u0131io\u00F6u\u00FC")
+
+    g_U = frozenset(u"\u0131iu\u00FC")
+
+    g_vowel1 = frozenset(u"a\u0131ou")
+
+    g_vowel2 = frozenset(u"ei\u00F6\u00FC")
+
+    g_vowel3 = frozenset(u"a\u0131")
+
+    g_vowel4 = frozenset(u"ei")
+
+    g_vowel5 = frozenset(u"ou")
+
+    g_vowel6 = frozenset(u"\u00F6\u00FC")
+
+    B_continue_stemming_noun_suffixes = False
+    I_strlen = 0
+
+    def copy_from(self, other):
+        self.B_continue_stemming_noun_suffixes = other.B_continue_stemming_noun_suffixes
+        self.I_strlen = other.I_strlen
+        super.copy_from(other)
+
+    def r_check_vowel_harmony(self):
+        # (, line 111
+        # test, line 112
+        v_1 = self.limit - self.cursor
+        # (, line 113
+        # (, line 114
+        # goto, line 114
+        if not self.go_out_grouping_b(TurkishStemmer.g_vowel):
+            return False
+        # (, line 115
+        # or, line 116
+        while True:
+            lab0 = False
+            v_2 = self.limit - self.cursor
+            while True:
+                # (, line 116
+                # literal, line 116
+                if not self.eq_s_b(1, u"a"):
+                    break
+                # goto, line 116
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel1):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            while True:
+                # (, line 117
+                # literal, line 117
+                if not self.eq_s_b(1, u"e"):
+                    break
+                # goto, line 117
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel2):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            while True:
+                # (, line 118
+                # literal, line 118
+                if not self.eq_s_b(1, u"\u0131"):
+                    break
+                # goto, line 118
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel3):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            while True:
+                # (, line 119
+                # literal, line 119
+                if not self.eq_s_b(1, u"i"):
+                    break
+                # goto, line 119
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel4):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            while True:
+                # (, line 120
+                # literal, line 120
+                if not self.eq_s_b(1, u"o"):
+                    break
+                # goto, line 120
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel5):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            while True:
+                # (, line 121
+                # literal, line 121
+                if not self.eq_s_b(1, u"\u00F6"):
+                    break
+                # goto, line 121
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel6):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            while True:
+                # (, line 122
+                # literal, line 122
+                if not self.eq_s_b(1, u"u"):
+                    break
+                # goto, line 122
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel5):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            # (, line 123
+            # literal, line 123
+            if not self.eq_s_b(1, u"\u00FC"):
+                return False
+            # goto, line 123
+            if not self.go_out_grouping_b(TurkishStemmer.g_vowel6):
+                return False
+            break
+        self.cursor = self.limit - v_1
+        return True
+
+    def r_mark_suffix_with_optional_n_consonant(self):
+        # (, line 132
+        # or, line 134
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 133
+                # (, line 133
+                # test, line 133
+                v_2 = self.limit - self.cursor
+                # literal, line 133
+                if not self.eq_s_b(1, u"n"):
+                    break
+                self.cursor = self.limit - v_2
+                # next, line 133
+                if self.cursor <= self.limit_backward:
+                    break
+                self.cursor -= 1
+                # (, line 133
+                # test, line 133
+                v_3 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                self.cursor = self.limit - v_3
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 135
+            # (, line 135
+            # not, line 135
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 135
+                # test, line 135
+                v_5 = self.limit - self.cursor
+                # literal, line 135
+                if not self.eq_s_b(1, u"n"):
+                    break
+                self.cursor = self.limit - v_5
+                return False
+            self.cursor = self.limit - v_4
+            # test, line 135
+            v_6 = self.limit - self.cursor
+            # (, line 135
+            # next, line 135
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            # (, line 135
+            # test, line 135
+            v_7 = self.limit - self.cursor
+            if not self.in_grouping_b(TurkishStemmer.g_vowel):
+                return False
+            self.cursor = self.limit - v_7
+            self.cursor = self.limit - v_6
+            break
+        return True
+
+    def r_mark_suffix_with_optional_s_consonant(self):
+        # (, line 143
+        # or, line 145
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 144
+                # (, line 144
+                # test, line 144
+                v_2 = self.limit - self.cursor
+                # literal, line 144
+                if not self.eq_s_b(1, u"s"):
+                    break
+                self.cursor = self.limit - v_2
+                # next, line 144
+                if self.cursor <= self.limit_backward:
+                    break
+                self.cursor -= 1
+                # (, line 144
+                # test, line 144
+                v_3 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                self.cursor = self.limit - v_3
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 146
+            # (, line 146
+            # not, line 146
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 146
+                # test, line 146
+                v_5 = self.limit - self.cursor
+                # literal, line 146
+                if not self.eq_s_b(1, u"s"):
+                    break
+                self.cursor = self.limit - v_5
+                return False
+            self.cursor = self.limit - v_4
+            # test, line 146
+            v_6 = self.limit - self.cursor
+            # (, line 146
+            # next, line 146
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            # (, line 146
+            # test, line 146
+            v_7 = self.limit - self.cursor
+            if not self.in_grouping_b(TurkishStemmer.g_vowel):
+                return False
+            self.cursor = self.limit - v_7
+            self.cursor = self.limit - v_6
+            break
+        return True
+
+    def r_mark_suffix_with_optional_y_consonant(self):
+        # (, line 153
+        # or, line 155
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 154
+                # (, line 154
+                # test, line 154
+                v_2 = self.limit - self.cursor
+                # literal, line 154
+                if not self.eq_s_b(1, u"y"):
+                    break
+                self.cursor = self.limit - v_2
+                # next, line 154
+                if self.cursor <= self.limit_backward:
+                    break
+                self.cursor -= 1
+                # (, line 154
+                # test, line 154
+                v_3 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                self.cursor = self.limit - v_3
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 156
+            # (, line 156
+            # not, line 156
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 156
+                # test, line 156
+                v_5 = self.limit - self.cursor
+                # literal, line 156
+                if not self.eq_s_b(1, u"y"):
+                    break
+                self.cursor = self.limit - v_5
+                return False
+            self.cursor = self.limit - v_4
+            # test, line 156
+            v_6 = self.limit - self.cursor
+            # (, line 156
+            # next, line 156
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            # (, line 156
+            # test, line 156
+            v_7 = self.limit - self.cursor
+            if not self.in_grouping_b(TurkishStemmer.g_vowel):
+                return False
+            self.cursor = self.limit - v_7
+            self.cursor = self.limit - v_6
+            break
+        return True
+
+    def r_mark_suffix_with_optional_U_vowel(self):
+        # (, line 159
+        # or, line 161
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 160
+                # (, line 160
+                # test, line 160
+                v_2 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_U):
+                    break
+                self.cursor = self.limit - v_2
+                # next, line 160
+                if self.cursor <= self.limit_backward:
+                    break
+                self.cursor -= 1
+                # (, line 160
+                # test, line 160
+                v_3 = self.limit - self.cursor
+                if not self.out_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                self.cursor = self.limit - v_3
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 162
+            # (, line 162
+            # not, line 162
+            v_4 = self.limit - self.cursor
+            while True:
+                # (, line 162
+                # test, line 162
+                v_5 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_U):
+                    break
+                self.cursor = self.limit - v_5
+                return False
+            self.cursor = self.limit - v_4
+            # test, line 162
+            v_6 = self.limit - self.cursor
+            # (, line 162
+            # next, line 162
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            # (, line 162
+            # test, line 162
+            v_7 = self.limit - self.cursor
+            if not self.out_grouping_b(TurkishStemmer.g_vowel):
+                return False
+            self.cursor = self.limit - v_7
+            self.cursor = self.limit - v_6
+            break
+        return True
+
+    def r_mark_possessives(self):
+        # (, line 166
+        # among, line 167
+        if self.find_among_b(TurkishStemmer.a_0, TurkishStemmer.d_0) == 0:
+            return False
+        # (, line 169
+        # call mark_suffix_with_optional_U_vowel, line 169
+        if not self.r_mark_suffix_with_optional_U_vowel():
+            return False
+        return True
+
+    def r_mark_sU(self):
+        # (, line 172
+        # call check_vowel_harmony, line 173
+        if not self.r_check_vowel_harmony():
+            return False
+        if not self.in_grouping_b(TurkishStemmer.g_U):
+            return False
+        # (, line 175
+        # call mark_suffix_with_optional_s_consonant, line 175
+        if not self.r_mark_suffix_with_optional_s_consonant():
+            return False
+        return True
+
+    def r_mark_lArI(self):
+        # (, line 178
+        # among, line 179
+        if self.find_among_b(TurkishStemmer.a_1, TurkishStemmer.d_1) == 0:
+            return False
+        return True
+
+    def r_mark_yU(self):
+        # (, line 182
+        # call check_vowel_harmony, line 183
+        if not self.r_check_vowel_harmony():
+            return False
+        if not self.in_grouping_b(TurkishStemmer.g_U):
+            return False
+        # (, line 185
+        # call mark_suffix_with_optional_y_consonant, line 185
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_nU(self):
+        # (, line 188
+        # call check_vowel_harmony, line 189
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 190
+        if self.find_among_b(TurkishStemmer.a_2, TurkishStemmer.d_2) == 0:
+            return False
+        return True
+
+    def r_mark_nUn(self):
+        # (, line 193
+        # call check_vowel_harmony, line 194
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 195
+        if self.find_among_b(TurkishStemmer.a_3, TurkishStemmer.d_3) == 0:
+            return False
+        # (, line 196
+        # call mark_suffix_with_optional_n_consonant, line 196
+        if not self.r_mark_suffix_with_optional_n_consonant():
+            return False
+        return True
+
+    def r_mark_yA(self):
+        # (, line 199
+        # call check_vowel_harmony, line 200
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 201
+        if self.find_among_b(TurkishStemmer.a_4, TurkishStemmer.d_4) == 0:
+            return False
+        # (, line 202
+        # call mark_suffix_with_optional_y_consonant, line 202
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_nA(self):
+        # (, line 205
+        # call check_vowel_harmony, line 206
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 207
+        if self.find_among_b(TurkishStemmer.a_5, TurkishStemmer.d_5) == 0:
+            return False
+        return True
+
+    def r_mark_DA(self):
+        # (, line 210
+        # call check_vowel_harmony, line 211
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 212
+        if self.find_among_b(TurkishStemmer.a_6, TurkishStemmer.d_6) == 0:
+            return False
+        return True
+
+    def r_mark_ndA(self):
+        # (, line 215
+        # call check_vowel_harmony, line 216
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 217
+        if self.find_among_b(TurkishStemmer.a_7, TurkishStemmer.d_7) == 0:
+            return False
+        return True
+
+    def r_mark_DAn(self):
+        # (, line 220
+        # call check_vowel_harmony, line 221
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 222
+        if self.find_among_b(TurkishStemmer.a_8, TurkishStemmer.d_8) == 0:
+            return False
+        return True
+
+    def r_mark_ndAn(self):
+        # (, line 225
+        # call check_vowel_harmony, line 226
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 227
+        if self.find_among_b(TurkishStemmer.a_9, TurkishStemmer.d_9) == 0:
+            return False
+        return True
+
+    def r_mark_ylA(self):
+        # (, line 230
+        # call check_vowel_harmony, line 231
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 232
+        if self.find_among_b(TurkishStemmer.a_10, TurkishStemmer.d_10) == 0:
+            return False
+        # (, line 233
+        # call mark_suffix_with_optional_y_consonant, line 233
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_ki(self):
+        # (, line 236
+        # literal, line 237
+        if not self.eq_s_b(2, u"ki"):
+            return False
+        return True
+
+    def r_mark_ncA(self):
+        # (, line 240
+        # call check_vowel_harmony, line 241
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 242
+        if self.find_among_b(TurkishStemmer.a_11, TurkishStemmer.d_11) == 0:
+            return False
+        # (, line 243
+        # call mark_suffix_with_optional_n_consonant, line 243
+        if not self.r_mark_suffix_with_optional_n_consonant():
+            return False
+        return True
+
+    def r_mark_yUm(self):
+        # (, line 246
+        # call check_vowel_harmony, line 247
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 248
+        if self.find_among_b(TurkishStemmer.a_12, TurkishStemmer.d_12) == 0:
+            return False
+        # (, line 249
+        # call mark_suffix_with_optional_y_consonant, line 249
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_sUn(self):
+        # (, line 252
+        # call check_vowel_harmony, line 253
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 254
+        if self.find_among_b(TurkishStemmer.a_13, TurkishStemmer.d_13) == 0:
+            return False
+        return True
+
+    def r_mark_yUz(self):
+        # (, line 257
+        # call check_vowel_harmony, line 258
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 259
+        if self.find_among_b(TurkishStemmer.a_14, TurkishStemmer.d_14) == 0:
+            return False
+        # (, line 260
+        # call mark_suffix_with_optional_y_consonant, line 260
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_sUnUz(self):
+        # (, line 263
+        # among, line 264
+        if self.find_among_b(TurkishStemmer.a_15, TurkishStemmer.d_15) == 0:
+            return False
+        return True
+
+    def r_mark_lAr(self):
+        # (, line 267
+        # call check_vowel_harmony, line 268
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 269
+        if self.find_among_b(TurkishStemmer.a_16, TurkishStemmer.d_16) == 0:
+            return False
+        return True
+
+    def r_mark_nUz(self):
+        # (, line 272
+        # call check_vowel_harmony, line 273
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 274
+        if self.find_among_b(TurkishStemmer.a_17, TurkishStemmer.d_17) == 0:
+            return False
+        return True
+
+    def r_mark_DUr(self):
+        # (, line 277
+        # call check_vowel_harmony, line 278
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 279
+        if self.find_among_b(TurkishStemmer.a_18, TurkishStemmer.d_18) == 0:
+            return False
+        return True
+
+    def r_mark_cAsInA(self):
+        # (, line 282
+        # among, line 283
+        if self.find_among_b(TurkishStemmer.a_19, TurkishStemmer.d_19) == 0:
+            return False
+        return True
+
+    def r_mark_yDU(self):
+        # (, line 286
+        # call check_vowel_harmony, line 287
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 288
+        if self.find_among_b(TurkishStemmer.a_20, TurkishStemmer.d_20) == 0:
+            return False
+        # (, line 292
+        # call mark_suffix_with_optional_y_consonant, line 292
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_ysA(self):
+        # (, line 296
+        # among, line 297
+        if self.find_among_b(TurkishStemmer.a_21, TurkishStemmer.d_21) == 0:
+            return False
+        # (, line 298
+        # call mark_suffix_with_optional_y_consonant, line 298
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_ymUs_(self):
+        # (, line 301
+        # call check_vowel_harmony, line 302
+        if not self.r_check_vowel_harmony():
+            return False
+        # among, line 303
+        if self.find_among_b(TurkishStemmer.a_22, TurkishStemmer.d_22) == 0:
+            return False
+        # (, line 304
+        # call mark_suffix_with_optional_y_consonant, line 304
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_mark_yken(self):
+        # (, line 307
+        # literal, line 308
+        if not self.eq_s_b(3, u"ken"):
+            return False
+        # (, line 308
+        # call mark_suffix_with_optional_y_consonant, line 308
+        if not self.r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def r_stem_nominal_verb_suffixes(self):
+        # (, line 311
+        # [, line 312
+        self.ket = self.cursor
+        # set continue_stemming_noun_suffixes, line 313
+        self.B_continue_stemming_noun_suffixes = True
+        # or, line 315
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                lab1 = False
+                # (, line 314
+                # or, line 314
+                while True:
+                    lab2 = False
+                    v_2 = self.limit - self.cursor
+                    while True:
+                        # call mark_ymUs_, line 314
+                        if not self.r_mark_ymUs_():
+                            break
+                        lab2 = True
+                        break
+                    if lab2:
+                        break
+                    self.cursor = self.limit - v_2
+                    while True:
+                        # call mark_yDU, line 314
+                        if not self.r_mark_yDU():
+                            break
+                        lab2 = True
+                        break
+                    if lab2:
+                        break
+                    self.cursor = self.limit - v_2
+                    while True:
+                        # call mark_ysA, line 314
+                        if not self.r_mark_ysA():
+                            break
+                        lab2 = True
+                        break
+                    if lab2:
+                        break
+                    self.cursor = self.limit - v_2
+                    # call mark_yken, line 314
+                    if not self.r_mark_yken():
+                        lab1 = True
+                        break
+                    break
+                if lab1:
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 316
+                # call mark_cAsInA, line 316
+                if not self.r_mark_cAsInA():
+                    break
+                # (, line 316
+                # or, line 316
+                while True:
+                    lab7 = False
+                    v_3 = self.limit - self.cursor
+                    while True:
+                        # call mark_sUnUz, line 316
+                        if not self.r_mark_sUnUz():
+                            break
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = self.limit - v_3
+                    while True:
+                        # call mark_lAr, line 316
+                        if not self.r_mark_lAr():
+                            break
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = self.limit - v_3
+                    while True:
+                        # call mark_yUm, line 316
+                        if not self.r_mark_yUm():
+                            break
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = self.limit - v_3
+                    while True:
+                        # call mark_sUn, line 316
+                        if not self.r_mark_sUn():
+                            break
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = self.limit - v_3
+                    while True:
+                        # call mark_yUz, line 316
+                        if not self.r_mark_yUz():
+                            break
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = self.limit - v_3
+                    break
+                # call mark_ymUs_, line 316
+                if not self.r_mark_ymUs_():
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 318
+                # call mark_lAr, line 319
+                if not self.r_mark_lAr():
+                    break
+                # ], line 319
+                self.bra = self.cursor
+                # delete, line 319
+                if not self.slice_del():
+                    return False
+
+                # try, line 319
+                v_4 = self.limit - self.cursor
+                while True:
+                    lab14 = False
+                    # (, line 319
+                    # [, line 319
+                    self.ket = self.cursor
+                    # (, line 319
+                    # or, line 319
+                    while True:
+                        lab15 = False
+                        v_5 = self.limit - self.cursor
+                        while True:
+                            # call mark_DUr, line 319
+                            if not self.r_mark_DUr():
+                                break
+                            lab15 = True
+                            break
+                        if lab15:
+                            break
+                        self.cursor = self.limit - v_5
+                        while True:
+                            # call mark_yDU, line 319
+                            if not self.r_mark_yDU():
+                                break
+                            lab15 = True
+                            break
+                        if lab15:
+                            break
+                        self.cursor = self.limit - v_5
+                        while True:
+                            # call mark_ysA, line 319
+                            if not self.r_mark_ysA():
+                                break
+                            lab15 = True
+                            break
+                        if lab15:
+                            break
+                        self.cursor = self.limit - v_5
+                        # call mark_ymUs_, line 319
+                        if not self.r_mark_ymUs_():
+                            self.cursor = self.limit - v_4
+                            lab14 = True
+                            break
+                        break
+                    if lab14:
+                        break
+                    break
+                # unset continue_stemming_noun_suffixes, line 320
+                self.B_continue_stemming_noun_suffixes = False
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                lab19 = False
+                # (, line 323
+                # call mark_nUz, line 323
+                if not self.r_mark_nUz():
+                    break
+                # (, line 323
+                # or, line 323
+                while True:
+                    lab20 = False
+                    v_6 = self.limit - self.cursor
+                    while True:
+                        # call mark_yDU, line 323
+                        if not self.r_mark_yDU():
+                            break
+                        lab20 = True
+                        break
+                    if lab20:
+                        break
+                    self.cursor = self.limit - v_6
+                    # call mark_ysA, line 323
+                    if not self.r_mark_ysA():
+                        lab19 = True
+                        break
+                    break
+                if lab19:
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                lab22 = False
+                # (, line 325
+                # (, line 325
+                # or, line 325
+                while True:
+                    lab23 = False
+                    v_7 = self.limit - self.cursor
+                    while True:
+                        # call mark_sUnUz, line 325
+                        if not self.r_mark_sUnUz():
+                            break
+                        lab23 = True
+                        break
+                    if lab23:
+                        break
+                    self.cursor = self.limit - v_7
+                    while True:
+                        # call mark_yUz, line 325
+                        if not self.r_mark_yUz():
+                            break
+                        lab23 = True
+                        break
+                    if lab23:
+                        break
+                    self.cursor = self.limit - v_7
+                    while True:
+                        # call mark_sUn, line 325
+                        if not self.r_mark_sUn():
+                            break
+                        lab23 = True
+                        break
+                    if lab23:
+                        break
+                    self.cursor = self.limit - v_7
+                    # call mark_yUm, line 325
+                    if not self.r_mark_yUm():
+                        lab22 = True
+                        break
+                    break
+                if lab22:
+                    break
+                # ], line 325
+                self.bra = self.cursor
+                # delete, line 325
+                if not self.slice_del():
+                    return False
+
+                # try, line 325
+                v_8 = self.limit - self.cursor
+                while True:
+                    # (, line 325
+                    # [, line 325
+                    self.ket = self.cursor
+                    # call mark_ymUs_, line 325
+                    if not self.r_mark_ymUs_():
+                        self.cursor = self.limit - v_8
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 327
+            # call mark_DUr, line 327
+            if not self.r_mark_DUr():
+                return False
+            # ], line 327
+            self.bra = self.cursor
+            # delete, line 327
+            if not self.slice_del():
+                return False
+
+            # try, line 327
+            v_9 = self.limit - self.cursor
+            while True:
+                # (, line 327
+                # [, line 327
+                self.ket = self.cursor
+                # (, line 327
+                # or, line 327
+                while True:
+                    lab29 = False
+                    v_10 = self.limit - self.cursor
+                    while True:
+                        # call mark_sUnUz, line 327
+                        if not self.r_mark_sUnUz():
+                            break
+                        lab29 = True
+                        break
+                    if lab29:
+                        break
+                    self.cursor = self.limit - v_10
+                    while True:
+                        # call mark_lAr, line 327
+                        if not self.r_mark_lAr():
+                            break
+                        lab29 = True
+                        break
+                    if lab29:
+                        break
+                    self.cursor = self.limit - v_10
+                    while True:
+                        # call mark_yUm, line 327
+                        if not self.r_mark_yUm():
+                            break
+                        lab29 = True
+                        break
+                    if lab29:
+                        break
+                    self.cursor = self.limit - v_10
+                    while True:
+                        # call mark_sUn, line 327
+                        if not self.r_mark_sUn():
+                            break
+                        lab29 = True
+                        break
+                    if lab29:
+                        break
+                    self.cursor = self.limit - v_10
+                    while True:
+                        # call mark_yUz, line 327
+                        if not self.r_mark_yUz():
+                            break
+                        lab29 = True
+                        break
+                    if lab29:
+                        break
+                    self.cursor = self.limit - v_10
+                    break
+                # call mark_ymUs_, line 327
+                if not self.r_mark_ymUs_():
+                    self.cursor = self.limit - v_9
+                    break
+                break
+            break
+        # ], line 328
+        self.bra = self.cursor
+        # delete, line 328
+        if not self.slice_del():
+            return False
+
+        return True
+
+    def r_stem_suffix_chain_before_ki(self):
+        # (, line 332
+        # [, line 333
+        self.ket = self.cursor
+        # call mark_ki, line 334
+        if not self.r_mark_ki():
+            return False
+        # (, line 335
+        # or, line 342
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 336
+                # call mark_DA, line 336
+                if not self.r_mark_DA():
+                    break
+                # ], line 336
+                self.bra = self.cursor
+                # delete, line 336
+                if not self.slice_del():
+                    return False
+
+                # try, line 336
+                v_2 = self.limit - self.cursor
+                while True:
+                    lab2 = False
+                    # (, line 336
+                    # [, line 336
+                    self.ket = self.cursor
+                    # or, line 338
+                    while True:
+                        lab3 = False
+                        v_3 = self.limit - self.cursor
+                        while True:
+                            # (, line 337
+                            # call mark_lAr, line 337
+                            if not self.r_mark_lAr():
+                                break
+                            # ], line 337
+                            self.bra = self.cursor
+                            # delete, line 337
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 337
+                            v_4 = self.limit - self.cursor
+                            while True:
+                                # (, line 337
+                                # call stem_suffix_chain_before_ki, line 337
+                                if not self.r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_4
+                                    break
+                                break
+                            lab3 = True
+                            break
+                        if lab3:
+                            break
+                        self.cursor = self.limit - v_3
+                        # (, line 339
+                        # call mark_possessives, line 339
+                        if not self.r_mark_possessives():
+                            self.cursor = self.limit - v_2
+                            lab2 = True
+                            break
+                        # ], line 339
+                        self.bra = self.cursor
+                        # delete, line 339
+                        if not self.slice_del():
+                            return False
+
+                        # try, line 339
+                        v_5 = self.limit - self.cursor
+                        while True:
+                            # (, line 339
+                            # [, line 339
+                            self.ket = self.cursor
+                            # call mark_lAr, line 339
+                            if not self.r_mark_lAr():
+                                self.cursor = self.limit - v_5
+                                break
+                            # ], line 339
+                            self.bra = self.cursor
+                            # delete, line 339
+                            if not self.slice_del():
+                                return False
+
+                            # call stem_suffix_chain_before_ki, line 339
+                            if not self.r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_5
+                                break
+                            break
+                        break
+                    if lab2:
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 343
+                # call mark_nUn, line 343
+                if not self.r_mark_nUn():
+                    break
+                # ], line 343
+                self.bra = self.cursor
+                # delete, line 343
+                if not self.slice_del():
+                    return False
+
+                # try, line 343
+                v_6 = self.limit - self.cursor
+                while True:
+                    lab8 = False
+                    # (, line 343
+                    # [, line 343
+                    self.ket = self.cursor
+                    # or, line 345
+                    while True:
+                        lab9 = False
+                        v_7 = self.limit - self.cursor
+                        while True:
+                            # (, line 344
+                            # call mark_lArI, line 344
+                            if not self.r_mark_lArI():
+                                break
+                            # ], line 344
+                            self.bra = self.cursor
+                            # delete, line 344
+                            if not self.slice_del():
+                                return False
+
+                            lab9 = True
+                            break
+                        if lab9:
+                            break
+                        self.cursor = self.limit - v_7
+                        while True:
+                            lab11 = False
+                            # (, line 346
+                            # [, line 346
+                            self.ket = self.cursor
+                            # or, line 346
+                            while True:
+                                lab12 = False
+                                v_8 = self.limit - self.cursor
+                                while True:
+                                    # call mark_possessives, line 346
+                                    if not self.r_mark_possessives():
+                                        break
+                                    lab12 = True
+                                    break
+                                if lab12:
+                                    break
+                                self.cursor = self.limit - v_8
+                                # call mark_sU, line 346
+                                if not self.r_mark_sU():
+                                    lab11 = True
+                                    break
+                                break
+                            if lab11:
+                                break
+                            # ], line 346
+                            self.bra = self.cursor
+                            # delete, line 346
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 346
+                            v_9 = self.limit - self.cursor
+                            while True:
+                                # (, line 346
+                                # [, line 346
+                                self.ket = self.cursor
+                                # call mark_lAr, line 346
+                                if not self.r_mark_lAr():
+                                    self.cursor = self.limit - v_9
+                                    break
+                                # ], line 346
+                                self.bra = self.cursor
+                                # delete, line 346
+                                if not self.slice_del():
+                                    return False
+
+                                # call stem_suffix_chain_before_ki, line 346
+                                if not self.r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_9
+                                    break
+                                break
+                            lab9 = True
+                            break
+                        if lab9:
+                            break
+                        self.cursor = self.limit - v_7
+                        # (, line 348
+                        # call stem_suffix_chain_before_ki, line 348
+                        if not self.r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_6
+                            lab8 = True
+                            break
+                        break
+                    if lab8:
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 351
+            # call mark_ndA, line 351
+            if not self.r_mark_ndA():
+                return False
+            # (, line 351
+            # or, line 353
+            while True:
+                lab15 = False
+                v_10 = self.limit - self.cursor
+                while True:
+                    # (, line 352
+                    # call mark_lArI, line 352
+                    if not self.r_mark_lArI():
+                        break
+                    # ], line 352
+                    self.bra = self.cursor
+                    # delete, line 352
+                    if not self.slice_del():
+                        return False
+
+                    lab15 = True
+                    break
+                if lab15:
+                    break
+                self.cursor = self.limit - v_10
+                while True:
+                    # (, line 354
+                    # (, line 354
+                    # call mark_sU, line 354
+                    if not self.r_mark_sU():
+                        break
+                    # ], line 354
+                    self.bra = self.cursor
+                    # delete, line 354
+                    if not self.slice_del():
+                        return False
+
+                    # try, line 354
+                    v_11 = self.limit - self.cursor
+                    while True:
+                        # (, line 354
+                        # [, line 354
+                        self.ket = self.cursor
+                        # call mark_lAr, line 354
+                        if not self.r_mark_lAr():
+                            self.cursor = self.limit - v_11
+                            break
+                        # ], line 354
+                        self.bra = self.cursor
+                        # delete, line 354
+                        if not self.slice_del():
+                            return False
+
+                        # call stem_suffix_chain_before_ki, line 354
+                        if not self.r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_11
+                            break
+                        break
+                    lab15 = True
+                    break
+                if lab15:
+                    break
+                self.cursor = self.limit - v_10
+                # (, line 356
+                # call stem_suffix_chain_before_ki, line 356
+                if not self.r_stem_suffix_chain_before_ki():
+                    return False
+                break
+            break
+        return True
+
+    def r_stem_noun_suffixes(self):
+        # (, line 361
+        # or, line 363
+        while True:
+            lab0 = False
+            v_1 = self.limit - self.cursor
+            while True:
+                # (, line 362
+                # [, line 362
+                self.ket = self.cursor
+                # call mark_lAr, line 362
+                if not self.r_mark_lAr():
+                    break
+                # ], line 362
+                self.bra = self.cursor
+                # delete, line 362
+                if not self.slice_del():
+                    return False
+
+                # try, line 362
+                v_2 = self.limit - self.cursor
+                while True:
+                    # (, line 362
+                    # call stem_suffix_chain_before_ki, line 362
+                    if not self.r_stem_suffix_chain_before_ki():
+                        self.cursor = self.limit - v_2
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 364
+                # [, line 364
+                self.ket = self.cursor
+                # call mark_ncA, line 364
+                if not self.r_mark_ncA():
+                    break
+                # ], line 364
+                self.bra = self.cursor
+                # delete, line 364
+                if not self.slice_del():
+                    return False
+
+                # try, line 365
+                v_3 = self.limit - self.cursor
+                while True:
+                    lab4 = False
+                    # (, line 365
+                    # or, line 367
+                    while True:
+                        lab5 = False
+                        v_4 = self.limit - self.cursor
+                        while True:
+                            # (, line 366
+                            # [, line 366
+                            self.ket = self.cursor
+                            # call mark_lArI, line 366
+                            if not self.r_mark_lArI():
+                                break
+                            # ], line 366
+                            self.bra = self.cursor
+                            # delete, line 366
+                            if not self.slice_del():
+                                return False
+
+                            lab5 = True
+                            break
+                        if lab5:
+                            break
+                        self.cursor = self.limit - v_4
+                        while True:
+                            lab7 = False
+                            # (, line 368
+                            # [, line 368
+                            self.ket = self.cursor
+                            # or, line 368
+                            while True:
+                                lab8 = False
+                                v_5 = self.limit - self.cursor
+                                while True:
+                                    # call mark_possessives, line 368
+                                    if not self.r_mark_possessives():
+                                        break
+                                    lab8 = True
+                                    break
+                                if lab8:
+                                    break
+                                self.cursor = self.limit - v_5
+                                # call mark_sU, line 368
+                                if not self.r_mark_sU():
+                                    lab7 = True
+                                    break
+                                break
+                            if lab7:
+                                break
+                            # ], line 368
+                            self.bra = self.cursor
+                            # delete, line 368
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 368
+                            v_6 = self.limit - self.cursor
+                            while True:
+                                # (, line 368
+                                # [, line 368
+                                self.ket = self.cursor
+                                # call mark_lAr, line 368
+                                if not self.r_mark_lAr():
+                                    self.cursor = self.limit - v_6
+                                    break
+                                # ], line 368
+                                self.bra = self.cursor
+                                # delete, line 368
+                                if not self.slice_del():
+                                    return False
+
+                                # call stem_suffix_chain_before_ki, line 368
+                                if not self.r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_6
+                                    break
+                                break
+                            lab5 = True
+                            break
+                        if lab5:
+                            break
+                        self.cursor = self.limit - v_4
+                        # (, line 370
+                        # [, line 370
+                        self.ket = self.cursor
+                        # call mark_lAr, line 370
+                        if not self.r_mark_lAr():
+                            self.cursor = self.limit - v_3
+                            lab4 = True
+                            break
+                        # ], line 370
+                        self.bra = self.cursor
+                        # delete, line 370
+                        if not self.slice_del():
+                            return False
+
+                        # call stem_suffix_chain_before_ki, line 370
+                        if not self.r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_3
+                            lab4 = True
+                            break
+                        break
+                    if lab4:
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                lab11 = False
+                # (, line 374
+                # [, line 374
+                self.ket = self.cursor
+                # (, line 374
+                # or, line 374
+                while True:
+                    lab12 = False
+                    v_7 = self.limit - self.cursor
+                    while True:
+                        # call mark_ndA, line 374
+                        if not self.r_mark_ndA():
+                            break
+                        lab12 = True
+                        break
+                    if lab12:
+                        break
+                    self.cursor = self.limit - v_7
+                    # call mark_nA, line 374
+                    if not self.r_mark_nA():
+                        lab11 = True
+                        break
+                    break
+                if lab11:
+                    break
+                # (, line 375
+                # or, line 377
+                while True:
+                    lab14 = False
+                    v_8 = self.limit - self.cursor
+                    while True:
+                        # (, line 376
+                        # call mark_lArI, line 376
+                        if not self.r_mark_lArI():
+                            break
+                        # ], line 376
+                        self.bra = self.cursor
+                        # delete, line 376
+                        if not self.slice_del():
+                            return False
+
+                        lab14 = True
+                        break
+                    if lab14:
+                        break
+                    self.cursor = self.limit - v_8
+                    while True:
+                        # (, line 378
+                        # call mark_sU, line 378
+                        if not self.r_mark_sU():
+                            break
+                        # ], line 378
+                        self.bra = self.cursor
+                        # delete, line 378
+                        if not self.slice_del():
+                            return False
+
+                        # try, line 378
+                        v_9 = self.limit - self.cursor
+                        while True:
+                            # (, line 378
+                            # [, line 378
+                            self.ket = self.cursor
+                            # call mark_lAr, line 378
+                            if not self.r_mark_lAr():
+                                self.cursor = self.limit - v_9
+                                break
+                            # ], line 378
+                            self.bra = self.cursor
+                            # delete, line 378
+                            if not self.slice_del():
+                                return False
+
+                            # call stem_suffix_chain_before_ki, line 378
+                            if not self.r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_9
+                                break
+                            break
+                        lab14 = True
+                        break
+                    if lab14:
+                        break
+                    self.cursor = self.limit - v_8
+                    # (, line 380
+                    # call stem_suffix_chain_before_ki, line 380
+                    if not self.r_stem_suffix_chain_before_ki():
+                        lab11 = True
+                        break
+                    break
+                if lab11:
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                lab18 = False
+                # (, line 384
+                # [, line 384
+                self.ket = self.cursor
+                # (, line 384
+                # or, line 384
+                while True:
+                    lab19 = False
+                    v_10 = self.limit - self.cursor
+                    while True:
+                        # call mark_ndAn, line 384
+                        if not self.r_mark_ndAn():
+                            break
+                        lab19 = True
+                        break
+                    if lab19:
+                        break
+                    self.cursor = self.limit - v_10
+                    # call mark_nU, line 384
+                    if not self.r_mark_nU():
+                        lab18 = True
+                        break
+                    break
+                if lab18:
+                    break
+                # (, line 384
+                # or, line 384
+                while True:
+                    lab21 = False
+                    v_11 = self.limit - self.cursor
+                    while True:
+                        # (, line 384
+                        # call mark_sU, line 384
+                        if not self.r_mark_sU():
+                            break
+                        # ], line 384
+                        self.bra = self.cursor
+                        # delete, line 384
+                        if not self.slice_del():
+                            return False
+
+                        # try, line 384
+                        v_12 = self.limit - self.cursor
+                        while True:
+                            # (, line 384
+                            # [, line 384
+                            self.ket = self.cursor
+                            # call mark_lAr, line 384
+                            if not self.r_mark_lAr():
+                                self.cursor = self.limit - v_12
+                                break
+                            # ], line 384
+                            self.bra = self.cursor
+                            # delete, line 384
+                            if not self.slice_del():
+                                return False
+
+                            # call stem_suffix_chain_before_ki, line 384
+                            if not self.r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_12
+                                break
+                            break
+                        lab21 = True
+                        break
+                    if lab21:
+                        break
+                    self.cursor = self.limit - v_11
+                    # (, line 384
+                    # call mark_lArI, line 384
+                    if not self.r_mark_lArI():
+                        lab18 = True
+                        break
+                    break
+                if lab18:
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 386
+                # [, line 386
+                self.ket = self.cursor
+                # call mark_DAn, line 386
+                if not self.r_mark_DAn():
+                    break
+                # ], line 386
+                self.bra = self.cursor
+                # delete, line 386
+                if not self.slice_del():
+                    return False
+
+                # try, line 386
+                v_13 = self.limit - self.cursor
+                while True:
+                    lab25 = False
+                    # (, line 386
+                    # [, line 386
+                    self.ket = self.cursor
+                    # (, line 387
+                    # or, line 389
+                    while True:
+                        lab26 = False
+                        v_14 = self.limit - self.cursor
+                        while True:
+                            # (, line 388
+                            # call mark_possessives, line 388
+                            if not self.r_mark_possessives():
+                                break
+                            # ], line 388
+                            self.bra = self.cursor
+                            # delete, line 388
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 388
+                            v_15 = self.limit - self.cursor
+                            while True:
+                                # (, line 388
+                                # [, line 388
+                                self.ket = self.cursor
+                                # call mark_lAr, line 388
+                                if not self.r_mark_lAr():
+                                    self.cursor = self.limit - v_15
+                                    break
+                                # ], line 388
+                                self.bra = self.cursor
+                                # delete, line 388
+                                if not self.slice_del():
+                                    return False
+
+                                # call stem_suffix_chain_before_ki, line 388
+                                if not self.r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_15
+                                    break
+                                break
+                            lab26 = True
+                            break
+                        if lab26:
+                            break
+                        self.cursor = self.limit - v_14
+                        while True:
+                            # (, line 390
+                            # call mark_lAr, line 390
+                            if not self.r_mark_lAr():
+                                break
+                            # ], line 390
+                            self.bra = self.cursor
+                            # delete, line 390
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 390
+                            v_16 = self.limit - self.cursor
+                            while True:
+                                # (, line 390
+                                # call stem_suffix_chain_before_ki, line 390
+                                if not self.r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_16
+                                    break
+                                break
+                            lab26 = True
+                            break
+                        if lab26:
+                            break
+                        self.cursor = self.limit - v_14
+                        # (, line 392
+                        # call stem_suffix_chain_before_ki, line 392
+                        if not self.r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_13
+                            lab25 = True
+                            break
+                        break
+                    if lab25:
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                lab31 = False
+                # (, line 396
+                # [, line 396
+                self.ket = self.cursor
+                # or, line 396
+                while True:
+                    lab32 = False
+                    v_17 = self.limit - self.cursor
+                    while True:
+                        # call mark_nUn, line 396
+                        if not self.r_mark_nUn():
+                            break
+                        lab32 = True
+                        break
+                    if lab32:
+                        break
+                    self.cursor = self.limit - v_17
+                    # call mark_ylA, line 396
+                    if not self.r_mark_ylA():
+                        lab31 = True
+                        break
+                    break
+                if lab31:
+                    break
+                # ], line 396
+                self.bra = self.cursor
+                # delete, line 396
+                if not self.slice_del():
+                    return False
+
+                # try, line 397
+                v_18 = self.limit - self.cursor
+                while True:
+                    lab34 = False
+                    # (, line 397
+                    # or, line 399
+                    while True:
+                        lab35 = False
+                        v_19 = self.limit - self.cursor
+                        while True:
+                            # (, line 398
+                            # [, line 398
+                            self.ket = self.cursor
+                            # call mark_lAr, line 398
+                            if not self.r_mark_lAr():
+                                break
+                            # ], line 398
+                            self.bra = self.cursor
+                            # delete, line 398
+                            if not self.slice_del():
+                                return False
+
+                            # call stem_suffix_chain_before_ki, line 398
+                            if not self.r_stem_suffix_chain_before_ki():
+                                break
+                            lab35 = True
+                            break
+                        if lab35:
+                            break
+                        self.cursor = self.limit - v_19
+                        while True:
+                            lab37 = False
+                            # (, line 400
+                            # [, line 400
+                            self.ket = self.cursor
+                            # or, line 400
+                            while True:
+                                lab38 = False
+                                v_20 = self.limit - self.cursor
+                                while True:
+                                    # call mark_possessives, line 400
+                                    if not self.r_mark_possessives():
+                                        break
+                                    lab38 = True
+                                    break
+                                if lab38:
+                                    break
+                                self.cursor = self.limit - v_20
+                                # call mark_sU, line 400
+                                if not self.r_mark_sU():
+                                    lab37 = True
+                                    break
+                                break
+                            if lab37:
+                                break
+                            # ], line 400
+                            self.bra = self.cursor
+                            # delete, line 400
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 400
+                            v_21 = self.limit - self.cursor
+                            while True:
+                                # (, line 400
+                                # [, line 400
+                                self.ket = self.cursor
+                                # call mark_lAr, line 400
+                                if not self.r_mark_lAr():
+                                    self.cursor = self.limit - v_21
+                                    break
+                                # ], line 400
+                                self.bra = self.cursor
+                                # delete, line 400
+                                if not self.slice_del():
+                                    return False
+
+                                # call stem_suffix_chain_before_ki, line 400
+                                if not self.r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_21
+                                    break
+                                break
+                            lab35 = True
+                            break
+                        if lab35:
+                            break
+                        self.cursor = self.limit - v_19
+                        # call stem_suffix_chain_before_ki, line 402
+                        if not self.r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_18
+                            lab34 = True
+                            break
+                        break
+                    if lab34:
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 406
+                # [, line 406
+                self.ket = self.cursor
+                # call mark_lArI, line 406
+                if not self.r_mark_lArI():
+                    break
+                # ], line 406
+                self.bra = self.cursor
+                # delete, line 406
+                if not self.slice_del():
+                    return False
+
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                # (, line 408
+                # call stem_suffix_chain_before_ki, line 408
+                if not self.r_stem_suffix_chain_before_ki():
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            while True:
+                lab43 = False
+                # (, line 410
+                # [, line 410
+                self.ket = self.cursor
+                # or, line 410
+                while True:
+                    lab44 = False
+                    v_22 = self.limit - self.cursor
+                    while True:
+                        # call mark_DA, line 410
+                        if not self.r_mark_DA():
+                            break
+                        lab44 = True
+                        break
+                    if lab44:
+                        break
+                    self.cursor = self.limit - v_22
+                    while True:
+                        # call mark_yU, line 410
+                        if not self.r_mark_yU():
+                            break
+                        lab44 = True
+                        break
+                    if lab44:
+                        break
+                    self.cursor = self.limit - v_22
+                    # call mark_yA, line 410
+                    if not self.r_mark_yA():
+                        lab43 = True
+                        break
+                    break
+                if lab43:
+                    break
+                # ], line 410
+                self.bra = self.cursor
+                # delete, line 410
+                if not self.slice_del():
+                    return False
+
+                # try, line 410
+                v_23 = self.limit - self.cursor
+                while True:
+                    lab47 = False
+                    # (, line 410
+                    # [, line 410
+                    self.ket = self.cursor
+                    # (, line 410
+                    # or, line 410
+                    while True:
+                        lab48 = False
+                        v_24 = self.limit - self.cursor
+                        while True:
+                            # (, line 410
+                            # call mark_possessives, line 410
+                            if not self.r_mark_possessives():
+                                break
+                            # ], line 410
+                            self.bra = self.cursor
+                            # delete, line 410
+                            if not self.slice_del():
+                                return False
+
+                            # try, line 410
+                            v_25 = self.limit - self.cursor
+                            while True:
+                                # (, line 410
+                                # [, line 410
+                                self.ket = self.cursor
+                                # call mark_lAr, line 410
+                                if not self.r_mark_lAr():
+                                    self.cursor = self.limit - v_25
+                                    break
+                                break
+                            lab48 = True
+                            break
+                        if lab48:
+                            break
+                        self.cursor = self.limit - v_24
+                        # call mark_lAr, line 410
+                        if not self.r_mark_lAr():
+                            self.cursor = self.limit - v_23
+                            lab47 = True
+                            break
+                        break
+                    if lab47:
+                        break
+                    # ], line 410
+                    self.bra = self.cursor
+                    # delete, line 410
+                    if not self.slice_del():
+                        return False
+
+                    # [, line 410
+                    self.ket = self.cursor
+                    # call stem_suffix_chain_before_ki, line 410
+                    if not self.r_stem_suffix_chain_before_ki():
+                        self.cursor = self.limit - v_23
+                        break
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_1
+            # (, line 412
+            # [, line 412
+            self.ket = self.cursor
+            # or, line 412
+            while True:
+                lab51 = False
+                v_26 = self.limit - self.cursor
+                while True:
+                    # call mark_possessives, line 412
+                    if not self.r_mark_possessives():
+                        break
+                    lab51 = True
+                    break
+                if lab51:
+                    break
+                self.cursor = self.limit - v_26
+                # call mark_sU, line 412
+                if not self.r_mark_sU():
+                    return False
+                break
+            # ], line 412
+            self.bra = self.cursor
+            # delete, line 412
+            if not self.slice_del():
+                return False
+
+            # try, line 412
+            v_27 = self.limit - self.cursor
+            while True:
+                # (, line 412
+                # [, line 412
+                self.ket = self.cursor
+                # call mark_lAr, line 412
+                if not self.r_mark_lAr():
+                    self.cursor = self.limit - v_27
+                    break
+                # ], line 412
+                self.bra = self.cursor
+                # delete, line 412
+                if not self.slice_del():
+                    return False
+
+                # call stem_suffix_chain_before_ki, line 412
+                if not self.r_stem_suffix_chain_before_ki():
+                    self.cursor = self.limit - v_27
+                    break
+                break
+            break
+        return True
+
+    def r_post_process_last_consonants(self):
+        # (, line 415
+        # [, line 416
+        self.ket = self.cursor
+        # substring, line 416
+        among_var = self.find_among_b(TurkishStemmer.a_23, TurkishStemmer.d_23)
+        if among_var == 0:
+            return False
+        # ], line 416
+        self.bra = self.cursor
+        if among_var == 0:
+            return False
+        elif among_var == 1:
+            # (, line 417
+            # <-, line 417
+            if not self.slice_from(u"p"):
+                return False
+        elif among_var == 2:
+            # (, line 418
+            # <-, line 418
+            if not self.slice_from(u"\u00E7"):
+                return False
+        elif among_var == 3:
+            # (, line 419
+            # <-, line 419
+            if not self.slice_from(u"t"):
+                return False
+        elif among_var == 4:
+            # (, line 420
+            # <-, line 420
+            if not self.slice_from(u"k"):
+                return False
+        return True
+
+    def r_append_U_to_stems_ending_with_d_or_g(self):
+        # (, line 430
+        # test, line 431
+        v_1 = self.limit - self.cursor
+        # (, line 431
+        # or, line 431
+        while True:
+            lab0 = False
+            v_2 = self.limit - self.cursor
+            while True:
+                # literal, line 431
+                if not self.eq_s_b(1, u"d"):
+                    break
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = self.limit - v_2
+            # literal, line 431
+            if not self.eq_s_b(1, u"g"):
+                return False
+            break
+        self.cursor = self.limit - v_1
+        # or, line 433
+        while True:
+            lab2 = False
+            v_3 = self.limit - self.cursor
+            while True:
+                lab3 = False
+                # (, line 432
+                # test, line 432
+                v_4 = self.limit - self.cursor
+                # (, line 432
+                # (, line 432
+                # goto, line 432
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                # or, line 432
+                while True:
+                    lab4 = False
+                    v_5 = self.limit - self.cursor
+                    while True:
+                        # literal, line 432
+                        if not self.eq_s_b(1, u"a"):
+                            break
+                        lab4 = True
+                        break
+                    if lab4:
+                        break
+                    self.cursor = self.limit - v_5
+                    # literal, line 432
+                    if not self.eq_s_b(1, u"\u0131"):
+                        lab3 = True
+                        break
+                    break
+                if lab3:
+                    break
+                self.cursor = self.limit - v_4
+                # <+, line 432
+                c = self.cursor
+                self.insert(self.cursor, self.cursor, u"\u0131")
+                self.cursor = c
+                lab2 = True
+                break
+            if lab2:
+                break
+            self.cursor = self.limit - v_3
+            while True:
+                lab6 = False
+                # (, line 434
+                # test, line 434
+                v_6 = self.limit - self.cursor
+                # (, line 434
+                # (, line 434
+                # goto, line 434
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                # or, line 434
+                while True:
+                    lab7 = False
+                    v_7 = self.limit - self.cursor
+                    while True:
+                        # literal, line 434
+                        if not self.eq_s_b(1, u"e"):
+                            break
+                        lab7 = True
+                        break
+                    if lab7:
+                        break
+                    self.cursor = self.limit - v_7
+                    # literal, line 434
+                    if not self.eq_s_b(1, u"i"):
+                        lab6 = True
+                        break
+                    break
+                if lab6:
+                    break
+                self.cursor = self.limit - v_6
+                # <+, line 434
+                c = self.cursor
+                self.insert(self.cursor, self.cursor, u"i")
+                self.cursor = c
+                lab2 = True
+                break
+            if lab2:
+                break
+            self.cursor = self.limit - v_3
+            while True:
+                lab9 = False
+                # (, line 436
+                # test, line 436
+                v_8 = self.limit - self.cursor
+                # (, line 436
+                # (, line 436
+                # goto, line 436
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel):
+                    break
+                # or, line 436
+                while True:
+                    lab10 = False
+                    v_9 = self.limit - self.cursor
+                    while True:
+                        # literal, line 436
+                        if not self.eq_s_b(1, u"o"):
+                            break
+                        lab10 = True
+                        break
+                    if lab10:
+                        break
+                    self.cursor = self.limit - v_9
+                    # literal, line 436
+                    if not self.eq_s_b(1, u"u"):
+                        lab9 = True
+                        break
+                    break
+                if lab9:
+                    break
+                self.cursor = self.limit - v_8
+                # <+, line 436
+                c = self.cursor
+                self.insert(self.cursor, self.cursor, u"u")
+                self.cursor = c
+                lab2 = True
+                break
+            if lab2:
+                break
+            self.cursor = self.limit - v_3
+            # (, line 438
+            # test, line 438
+            v_10 = self.limit - self.cursor
+            # (, line 438
+            # (, line 438
+            # goto, line 438
+            if not self.go_out_grouping_b(TurkishStemmer.g_vowel):
+                return False
+            # or, line 438
+            while True:
+                lab12 = False
+                v_11 = self.limit - self.cursor
+                while True:
+                    # literal, line 438
+                    if not self.eq_s_b(1, u"\u00F6"):
+                        break
+                    lab12 = True
+                    break
+                if lab12:
+                    break
+                self.cursor = self.limit - v_11
+                # literal, line 438
+                if not self.eq_s_b(1, u"\u00FC"):
+                    return False
+                break
+            self.cursor = self.limit - v_10
+            # <+, line 438
+            c = self.cursor
+            self.insert(self.cursor, self.cursor, u"\u00FC")
+            self.cursor = c
+            break
+        return True
+
+    def r_more_than_one_syllable_word(self):
+        # (, line 445
+        # test, line 446
+        v_1 = self.cursor
+        # (, line 446
+        # atleast, line 446
+        v_2 = 2
+        # atleast, line 446
+        while True:
+            lab1 = False
+            v_3 = self.cursor
+            while True:
+                # (, line 446
+                # gopast, line 446
+                if not self.go_out_grouping(TurkishStemmer.g_vowel):
+                    break
+                self.cursor += 1
+                v_2 -= 1
+                lab1 = True
+                break
+            if lab1:
+                continue
+            self.cursor = v_3
+            break
+        if v_2 > 0:
+            return False
+        self.cursor = v_1
+        return True
+
+    def r_is_reserved_word(self):
+        # (, line 449
+        # or, line 451
+        while True:
+            lab0 = False
+            v_1 = self.cursor
+            while True:
+                lab1 = False
+                # test, line 450
+                v_2 = self.cursor
+                # (, line 450
+                # gopast, line 450
+                while True:
+                    lab2 = False
+                    while True:
+                        # literal, line 450
+                        if not self.eq_s(2, u"ad"):
+                            break
+                        lab2 = True
+                        break
+                    if lab2:
+                        break
+                    if self.cursor >= self.limit:
+                        lab1 = True
+                        break
+                    self.cursor += 1
+                if lab1:
+                    break
+                # (, line 450
+                self.I_strlen = 2
+                # (, line 450
+                if not self.I_strlen == self.limit:
+                    break
+                self.cursor = v_2
+                lab0 = True
+                break
+            if lab0:
+                break
+            self.cursor = v_1
+            # test, line 452
+            v_4 = self.cursor
+            # (, line 452
+            # gopast, line 452
+            while True:
+                lab4 = False
+                while True:
+                    # literal, line 452
+                    if not self.eq_s(5, u"soyad"):
+                        break
+                    lab4 = True
+                    break
+                if lab4:
+                    break
+                if self.cursor >= self.limit:
+                    return False
+                self.cursor += 1
+            # (, line 452
+            self.I_strlen = 5
+            # (, line 452
+            if not self.I_strlen == self.limit:
+                return False
+            self.cursor = v_4
+            break
+        return True
+
+    def r_postlude(self):
+        # (, line 455
+        # not, line 456
+        v_1 = self.cursor
+        while True:
+            # (, line 456
+            # call is_reserved_word, line 456
+            if not self.r_is_reserved_word():
+                break
+            return False
+        self.cursor = v_1
+        # backwards, line 457
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 457
+        # do, line 458
+        v_2 = self.limit - self.cursor
+        while True:
+            # call append_U_to_stems_ending_with_d_or_g, line 458
+            if not self.r_append_U_to_stems_ending_with_d_or_g():
+                break
+            break
+        self.cursor = self.limit - v_2
+        # do, line 459
+        v_3 = self.limit - self.cursor
+        while True:
+            # call post_process_last_consonants, line 459
+            if not self.r_post_process_last_consonants():
+                break
+            break
+        self.cursor = self.limit - v_3
+        self.cursor = self.limit_backward
+        return True
+
+    def _stem(self):
+        # (, line 464
+        # (, line 465
+        # call more_than_one_syllable_word, line 465
+        if not self.r_more_than_one_syllable_word():
+            return False
+        # (, line 466
+        # backwards, line 467
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        # (, line 467
+        # do, line 468
+        v_1 = self.limit - self.cursor
+        while True:
+            # call stem_nominal_verb_suffixes, line 468
+            if not self.r_stem_nominal_verb_suffixes():
+                break
+            break
+        self.cursor = self.limit - v_1
+        # Boolean test continue_stemming_noun_suffixes, line 469
+        if not self.B_continue_stemming_noun_suffixes:
+            return False
+        # do, line 470
+        v_2 = self.limit - self.cursor
+        while True:
+            # call stem_noun_suffixes, line 470
+            if not self.r_stem_noun_suffixes():
+                break
+            break
+        self.cursor = self.limit - v_2
+        self.cursor = self.limit_backward
+        # call postlude, line 473
+        if not self.r_postlude():
+            return False
+        return True
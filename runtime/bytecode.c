@@ -0,0 +1,548 @@
+
+#include <limits.h>
+#include <string.h>
+
+#include "header.h"
+#include "bytecode.h"
+
+#define unless(C) if(!(C))
+
+/* An interpreter for algorithms compiled by snowball -bytecode. It runs
+   the syntax tree as the generated C would, with the same runtime
+   functions. With GCC, the op of each node is dispatched by computed goto
+   rather than by a switch. */
+
+struct run {
+    struct SN_env * z;
+    const struct sb_bc_program * prog;
+    int among_var;
+};
+
+static int run(struct run * r, int n);
+
+static int keep(struct run * r, const struct sb_bc_node * p) {
+    return p->backward ? r->z->l - r->z->c : r->z->c;
+}
+
+static void restore(struct run * r, const struct sb_bc_node * p, int k) {
+    r->z->c = p->backward ? r->z->l - k : k;
+}
+
+static int call(struct run * r, int n) {
+    int among_var = r->among_var;
+    int ret = run(r, n);
+    r->among_var = among_var;
+    return ret;
+}
+
+static int eval_AE(struct run * r, int n) {
+    const struct sb_bc_node * p = r->prog->nodes + n;
+    struct SN_env * z = r->z;
+    switch (p->op) {
+        case SB_OP_INTEGER: return z->I[p->arg];
+        case SB_OP_NUMBER: return p->arg;
+        case SB_OP_MAXINT: return INT_MAX;
+        case SB_OP_MININT: return INT_MIN;
+        case SB_OP_NEG: return - eval_AE(r, p->right);
+        case SB_OP_MULTIPLY: return eval_AE(r, p->left) * eval_AE(r, p->right);
+        case SB_OP_PLUS: return eval_AE(r, p->left) + eval_AE(r, p->right);
+        case SB_OP_MINUS: return eval_AE(r, p->left) - eval_AE(r, p->right);
+        case SB_OP_DIVIDE: return eval_AE(r, p->left) / eval_AE(r, p->right);
+        case SB_OP_SIZEOF: return SIZE(z->S[p->arg]);
+        case SB_OP_CURSOR: return z->c;
+        case SB_OP_LIMIT: return p->backward ? z->lb : z->l;
+        case SB_OP_SIZE: return SIZE(z->p);
+    }
+    return 0;
+}
+
+/* As find_among() and find_among_b() in utilities.c, on the strings of
+   among x. */
+
+static int lookup(struct run * r, const struct sb_bc_node * p, const struct sb_bc_among * x) {
+    struct SN_env * z = r->z;
+    const struct sb_bc_amongvec * v = r->prog->vecs + x->vec;
+    const unsigned char * blob = r->prog->blob;
+    int backward = p->backward;
+    int i = 0;
+    int j = x->count;
+    int c = z->c;
+    int common_i = 0;
+    int common_j = 0;
+    int first_key_inspected = 0;
+    const struct sb_bc_amongvec * w;
+
+    while (1) {
+        int k = i + ((j - i) >> 1);
+        int diff = 0;
+        int common = common_i < common_j ? common_i : common_j;
+        w = v + k;
+        {   const symbol * s = blob + w->s;
+            int i2;
+            for (i2 = common; i2 < w->s_size; i2++) {
+                if (backward) {
+                    if (c - common == z->lb) { diff = -1; break; }
+                    diff = z->p[c - 1 - common] - s[w->s_size - 1 - i2];
+                } else {
+                    if (c + common == z->l) { diff = -1; break; }
+                    diff = z->p[c + common] - s[i2];
+                }
+                if (diff != 0) break;
+                common++;
+            }
+        }
+        if (diff < 0) { j = k; common_j = common; }
+                 else { i = k; common_i = common; }
+        if (j - i <= 1) {
+            if (i > 0) break;
+            if (j == i) break;
+            if (first_key_inspected) break;
+            first_key_inspected = 1;
+        }
+    }
+    while (1) {
+        w = v + i;
+        if (common_i >= w->s_size) {
+            z->c = backward ? c - w->s_size : c + w->s_size;
+            if (w->function < 0) return w->result;
+            {   int res = call(r, w->function);
+                z->c = backward ? c - w->s_size : c + w->s_size;
+                if (res) return w->result;
+            }
+        }
+        i = w->substring_i;
+        if (i < 0) return 0;
+    }
+}
+
+static int run_among(struct run * r, const struct sb_bc_node * p) {
+    const struct sb_bc_among * x = r->prog->amongs + p->arg;
+    int case_number = 1;
+    int n;
+    unless (x->substring) {
+        r->among_var = lookup(r, p, x);
+        if (r->among_var == 0) return 0;
+    }
+    if (x->command_count == 0 && x->starter < 0) return 1;
+    if (x->starter >= 0) {
+        int ret = run(r, x->starter);
+        if (ret <= 0) return ret;
+    }
+    n = p->left;
+    if (n >= 0 && r->prog->nodes[n].op != SB_OP_LITERALSTRING) n = r->prog->nodes[n].right;
+    while (n >= 0) {
+        const struct sb_bc_node * q = r->prog->nodes + n;
+        if (q->op == SB_OP_BRA && q->left >= 0) {
+            if (case_number++ == r->among_var) return run(r, n);
+        }
+        n = q->right;
+    }
+    return 1;
+}
+
+static int run_GO(struct run * r, const struct sb_bc_node * p, int style) {
+    struct SN_env * z = r->z;
+    while (1) {
+        int k = keep(r, p);
+        int ret = run(r, p->left);
+        if (ret < 0) return ret;
+        if (ret) {
+            if (style == 1) restore(r, p, k); /* goto */
+            return 1;
+        }
+        restore(r, p, k);
+        if (r->prog->h->utf8) {
+            ret = p->backward ? skip_utf8(z->p, z->c, z->lb, 0, -1) :
+                                skip_utf8(z->p, z->c, 0, z->l, 1);
+            if (ret < 0) return 0;
+            z->c = ret;
+        } else {
+            if (p->backward ? z->c <= z->lb : z->c >= z->l) return 0;
+            z->c += p->backward ? -1 : 1;
+        }
+    }
+}
+
+/* Returns the number of times the command succeeded, or an error. */
+static int run_repeat(struct run * r, const struct sb_bc_node * p) {
+    int count = 0;
+    while (1) {
+        int k = keep(r, p);
+        int ret = run(r, p->left);
+        if (ret < 0) return ret;
+        if (ret == 0) { restore(r, p, k); return count; }
+        count++;
+    }
+}
+
+static int run_hop(struct run * r, const struct sb_bc_node * p, int n) {
+    struct SN_env * z = r->z;
+    int lb = p->backward ? z->lb : 0;
+    int ret;
+    if (r->prog->h->utf8) {
+        ret = skip_utf8(z->p, z->c, lb, z->l, p->backward ? -n : n);
+        if (ret < 0) return 0;
+    } else {
+        ret = p->backward ? z->c - n : z->c + n;
+        if (lb > ret || ret > z->l) return 0;
+    }
+    z->c = ret;
+    return 1;
+}
+
+static int run_dollar(struct run * r, const struct sb_bc_node * p) {
+    struct SN_env * z = r->z;
+    struct SN_env env = * z;
+    int ret;
+    z->p = z->S[p->arg];
+    z->lb = z->c = 0;
+    z->l = SIZE(z->p);
+    ret = run(r, p->left);
+    z->S[p->arg] = z->p;
+    * z = env;
+    return ret;
+}
+
+#ifdef __GNUC__
+#define OP(op) L_##op
+#define DISPATCH(op) goto *labels[op];
+#else
+#define OP(op) case SB_OP_##op
+#define DISPATCH(op) switch (op)
+#endif
+
+static int run(struct run * r, int n) {
+    const struct sb_bc_node * p = r->prog->nodes + n;
+    struct SN_env * z = r->z;
+    const unsigned char * blob = r->prog->blob;
+    int ret;
+#ifdef __GNUC__
+    static const void * const labels[] = {
+#define X(op) &&L_##op,
+        SB_OPS
+#undef X
+    };
+#endif
+
+    DISPATCH(p->op) {
+    OP(BRA):
+        for (n = p->left; n >= 0; n = r->prog->nodes[n].right) {
+            ret = run(r, n);
+            if (ret <= 0) return ret;
+        }
+        return 1;
+    OP(AND):
+        {   int k = keep(r, p);
+            for (n = p->left; n >= 0; n = r->prog->nodes[n].right) {
+                ret = run(r, n);
+                if (ret <= 0) return ret;
+                if (r->prog->nodes[n].right >= 0) restore(r, p, k);
+            }
+            return 1;
+        }
+    OP(OR):
+        {   int k = keep(r, p);
+            for (n = p->left; r->prog->nodes[n].right >= 0; n = r->prog->nodes[n].right) {
+                ret = run(r, n);
+                if (ret != 0) return ret;
+                restore(r, p, k);
+            }
+            return run(r, n);
+        }
+    OP(BACKWARDS):
+        z->lb = z->c; z->c = z->l;
+        ret = run(r, p->left);
+        if (ret <= 0) return ret;
+        z->c = z->lb;
+        return 1;
+    OP(NOT):
+        {   int k = keep(r, p);
+            ret = run(r, p->left);
+            if (ret != 0) return ret < 0 ? ret : 0;
+            restore(r, p, k);
+            return 1;
+        }
+    OP(SET): z->B[p->arg] = 1; return 1;
+    OP(UNSET): z->B[p->arg] = 0; return 1;
+    OP(TRY):
+    OP(DO):
+        {   int k = keep(r, p);
+            ret = run(r, p->left);
+            if (ret < 0) return ret;
+            if (p->op == SB_OP_DO || ret == 0) restore(r, p, k);
+            return 1;
+        }
+    OP(FAIL):
+        ret = run(r, p->left);
+        return ret < 0 ? ret : 0;
+    OP(REVERSE):
+    OP(TEST):
+        {   int k = keep(r, p);
+            ret = run(r, p->left);
+            if (ret <= 0) return ret;
+            restore(r, p, k);
+            return 1;
+        }
+    OP(GOTO): return run_GO(r, p, 1);
+    OP(GOPAST): return run_GO(r, p, 0);
+    OP(REPEAT):
+        ret = run_repeat(r, p);
+        return ret < 0 ? ret : 1;
+    OP(LOOP):
+        {   int i;
+            for (i = eval_AE(r, p->AE); i > 0; i--) {
+                ret = run(r, p->left);
+                if (ret <= 0) return ret;
+            }
+            return 1;
+        }
+    OP(ATLEAST):
+        {   int i = eval_AE(r, p->AE);
+            ret = run_repeat(r, p);
+            return ret < 0 ? ret : ret >= i;
+        }
+    OP(SETMARK): z->I[p->arg] = z->c; return 1;
+    OP(TOMARK):
+        {   int mark = eval_AE(r, p->AE);
+            if (p->backward ? z->c < mark : z->c > mark) return 0;
+            z->c = mark;
+            return 1;
+        }
+    OP(ATMARK): return z->c == eval_AE(r, p->AE);
+    OP(HOP): return run_hop(r, p, eval_AE(r, p->AE));
+    OP(NEXT): return run_hop(r, p, 1);
+    OP(TOLIMIT): z->c = p->backward ? z->lb : z->l; return 1;
+    OP(ATLIMIT): return p->backward ? z->c <= z->lb : z->c >= z->l;
+    OP(LEFTSLICE):
+        if (p->backward) z->ket = z->c; else z->bra = z->c;
+        return 1;
+    OP(RIGHTSLICE):
+        if (p->backward) z->bra = z->c; else z->ket = z->c;
+        return 1;
+    OP(ASSIGNTO):
+        z->S[p->arg] = assign_to(z, z->S[p->arg]);
+        return z->S[p->arg] == 0 ? -1 : 1;
+    OP(SLICETO):
+        z->S[p->arg] = slice_to(z, z->S[p->arg]);
+        return z->S[p->arg] == 0 ? -1 : 1;
+    OP(ASSIGN):
+    OP(INSERT):
+    OP(ATTACH):
+        {   int c_keep = z->c;
+            int bra = z->c, ket = z->c;
+            int keep_c = p->op != SB_OP_INSERT;
+            if (p->op == SB_OP_ASSIGN) {
+                if (p->backward) bra = z->lb; else ket = z->l;
+            }
+            if (p->backward) keep_c = !keep_c;
+            ret = p->size < 0 ? insert_v(z, bra, ket, z->S[p->arg]) :
+                                insert_s(z, bra, ket, p->size, blob + p->arg);
+            if (keep_c) z->c = c_keep;
+            return ret < 0 ? ret : 1;
+        }
+    OP(DELETE):
+        ret = slice_del(z);
+        return ret < 0 ? ret : 1;
+    OP(SLICEFROM):
+        ret = p->size < 0 ? slice_from_v(z, z->S[p->arg]) :
+                            slice_from_s(z, p->size, blob + p->arg);
+        return ret < 0 ? ret : 1;
+    OP(SETLIMIT):
+        {   int k = keep(r, p);
+            int mlimit;
+            ret = run(r, p->left);
+            if (ret <= 0) return ret;
+            if (p->backward) {
+                mlimit = z->lb; z->lb = z->c;
+            } else {
+                mlimit = z->l - z->c; z->l = z->c;
+            }
+            restore(r, p, k);
+            ret = run(r, p->aux);
+            if (p->backward) z->lb = mlimit; else z->l += mlimit;
+            return ret;
+        }
+    OP(DOLLAR): return run_dollar(r, p);
+    OP(MATHASSIGN): z->I[p->arg] = eval_AE(r, p->AE); return 1;
+    OP(PLUSASSIGN): z->I[p->arg] += eval_AE(r, p->AE); return 1;
+    OP(MINUSASSIGN): z->I[p->arg] -= eval_AE(r, p->AE); return 1;
+    OP(MULTIPLYASSIGN): z->I[p->arg] *= eval_AE(r, p->AE); return 1;
+    OP(DIVIDEASSIGN): z->I[p->arg] /= eval_AE(r, p->AE); return 1;
+    OP(EQ): return z->I[p->arg] == eval_AE(r, p->AE);
+    OP(NE): return z->I[p->arg] != eval_AE(r, p->AE);
+    OP(GR): return z->I[p->arg] > eval_AE(r, p->AE);
+    OP(GE): return z->I[p->arg] >= eval_AE(r, p->AE);
+    OP(LS): return z->I[p->arg] < eval_AE(r, p->AE);
+    OP(LE): return z->I[p->arg] <= eval_AE(r, p->AE);
+    OP(CALL): return call(r, p->arg);
+    OP(GROUPING):
+    OP(NON):
+        {   const struct sb_bc_grouping * q = r->prog->groupings + p->arg;
+            const unsigned char * s = blob + q->bitmap;
+            if (r->prog->h->utf8) {
+                if (p->op == SB_OP_GROUPING)
+                    ret = p->backward ? in_grouping_b_U(z, s, q->min, q->max, 0) :
+                                        in_grouping_U(z, s, q->min, q->max, 0);
+                else
+                    ret = p->backward ? out_grouping_b_U(z, s, q->min, q->max, 0) :
+                                        out_grouping_U(z, s, q->min, q->max, 0);
+            } else {
+                if (p->op == SB_OP_GROUPING)
+                    ret = p->backward ? in_grouping_b(z, s, q->min, q->max, 0) :
+                                        in_grouping(z, s, q->min, q->max, 0);
+                else
+                    ret = p->backward ? out_grouping_b(z, s, q->min, q->max, 0) :
+                                        out_grouping(z, s, q->min, q->max, 0);
+            }
+            return ret == 0;
+        }
+    OP(NAME):
+        return p->backward ? eq_v_b(z, z->S[p->arg]) : eq_v(z, z->S[p->arg]);
+    OP(LITERALSTRING):
+        return p->backward ? eq_s_b(z, p->size, blob + p->arg) :
+                             eq_s(z, p->size, blob + p->arg);
+    OP(AMONG): return run_among(r, p);
+    OP(SUBSTRING):
+        r->among_var = lookup(r, p, r->prog->amongs + p->arg);
+        return r->among_var != 0;
+    OP(BOOLTEST): return z->B[p->arg];
+    OP(FALSE): return 0;
+    OP(TRUE): return 1;
+    OP(INTEGER):
+    OP(NUMBER):
+    OP(MAXINT):
+    OP(MININT):
+    OP(NEG):
+    OP(MULTIPLY):
+    OP(PLUS):
+    OP(MINUS):
+    OP(DIVIDE):
+    OP(SIZEOF):
+    OP(CURSOR):
+    OP(LIMIT):
+    OP(SIZE):
+        return -1;
+    }
+    return -1;
+}
+
+#undef OP
+#undef DISPATCH
+
+extern int run_bytecode(struct SN_env * z, const struct sb_bc_program * prog, int node) {
+    struct run r;
+    r.z = z;
+    r.prog = prog;
+    r.among_var = 0;
+    return run(&r, node);
+}
+
+/* The checks of bytecode_open(): that n is a node, or -1 if none is
+   allowed, etc. */
+#define NODE(n, none) ((n) >= ((none) ? -1 : 0) && (n) < h->node_count)
+#define BYTES(offset, size) \
+    ((offset) >= 0 && (size) >= 0 && (offset) <= h->blob_size - (size))
+
+static int check_node(const struct sb_bc_header * h, const struct sb_bc_node * p) {
+    unless (p->op >= 0 && p->op < SB_OP_COUNT &&
+            NODE(p->left, 1) && NODE(p->right, 1) &&
+            NODE(p->aux, 1) && NODE(p->AE, 1)) return 0;
+    switch (p->op) {
+        case SB_OP_SET: case SB_OP_UNSET: case SB_OP_BOOLTEST:
+            return p->arg >= 0 && p->arg < h->booleans;
+        case SB_OP_SETMARK: case SB_OP_MATHASSIGN: case SB_OP_PLUSASSIGN:
+        case SB_OP_MINUSASSIGN: case SB_OP_MULTIPLYASSIGN:
+        case SB_OP_DIVIDEASSIGN: case SB_OP_EQ: case SB_OP_NE: case SB_OP_GR:
+        case SB_OP_GE: case SB_OP_LS: case SB_OP_LE: case SB_OP_INTEGER:
+            return p->arg >= 0 && p->arg < h->integers;
+        case SB_OP_ASSIGNTO: case SB_OP_SLICETO: case SB_OP_DOLLAR:
+        case SB_OP_NAME: case SB_OP_SIZEOF:
+            return p->arg >= 0 && p->arg < h->strings;
+        case SB_OP_ASSIGN: case SB_OP_INSERT: case SB_OP_ATTACH:
+        case SB_OP_SLICEFROM: case SB_OP_LITERALSTRING:
+            if (p->size < 0) return p->op != SB_OP_LITERALSTRING &&
+                                    p->arg >= 0 && p->arg < h->strings;
+            return BYTES(p->arg, p->size);
+        case SB_OP_CALL:
+            return NODE(p->arg, 0);
+        case SB_OP_GROUPING: case SB_OP_NON:
+            return p->arg >= 0 && p->arg < h->grouping_count;
+        case SB_OP_AMONG: case SB_OP_SUBSTRING:
+            return p->arg >= 0 && p->arg < h->among_count;
+        case SB_OP_OR:
+            return p->left >= 0;
+    }
+    return 1;
+}
+
+/* Finds the parts of a compiled algorithm of size bytes at data, returning
+   0, or -1 if it isn't one, or isn't for this version of the format. The
+   indexes and offsets are checked to be in range, but the file must still
+   come from snowball, as an algorithm can loop forever. */
+extern int bytecode_open(struct sb_bc_program * prog, const void * data, size_t size) {
+    const struct sb_bc_header * h = (const struct sb_bc_header *) data;
+    size_t n;
+    int i;
+    if (size < sizeof(struct sb_bc_header)) return -1;
+    if (memcmp(h->magic, SB_BYTECODE_MAGIC, 8) != 0 ||
+        h->version != SB_BYTECODE_VERSION ||
+        h->node_count < 0 || h->among_count < 0 || h->amongvec_count < 0 ||
+        h->grouping_count < 0 || h->external_count < 0 || h->strings < 0 ||
+        h->integers < 0 || h->booleans < 0 || h->blob_size < 0 ||
+        memchr(h->version_of_stemmer, 0, sizeof h->version_of_stemmer) == NULL) return -1;
+    n = sizeof(struct sb_bc_header) +
+        h->node_count * sizeof(struct sb_bc_node) +
+        h->among_count * sizeof(struct sb_bc_among) +
+        h->amongvec_count * sizeof(struct sb_bc_amongvec) +
+        h->grouping_count * sizeof(struct sb_bc_grouping) +
+        h->external_count * sizeof(struct sb_bc_external) +
+        h->blob_size;
+    if (n != size) return -1;
+
+    prog->h = h;
+    prog->nodes = (const struct sb_bc_node *) (h + 1);
+    prog->amongs = (const struct sb_bc_among *) (prog->nodes + h->node_count);
+    prog->vecs = (const struct sb_bc_amongvec *) (prog->amongs + h->among_count);
+    prog->groupings = (const struct sb_bc_grouping *) (prog->vecs + h->amongvec_count);
+    prog->externals = (const struct sb_bc_external *) (prog->groupings + h->grouping_count);
+    prog->blob = (const unsigned char *) (prog->externals + h->external_count);
+
+    for (i = 0; i < h->node_count; i++)
+        unless (check_node(h, prog->nodes + i)) return -1;
+    for (i = 0; i < h->among_count; i++) {
+        const struct sb_bc_among * x = prog->amongs + i;
+        int j;
+        unless (x->count > 0 && x->vec >= 0 &&
+                x->vec <= h->amongvec_count - x->count &&
+                x->command_count >= 0 && NODE(x->starter, 1)) return -1;
+        for (j = 0; j < x->count; j++) {
+            const struct sb_bc_amongvec * v = prog->vecs + x->vec + j;
+            unless (BYTES(v->s, v->s_size) && v->substring_i >= -1 &&
+                    v->substring_i < x->count && NODE(v->function, 1)) return -1;
+        }
+    }
+    for (i = 0; i < h->grouping_count; i++) {
+        const struct sb_bc_grouping * q = prog->groupings + i;
+        unless (q->min >= 0 && q->max >= q->min &&
+                BYTES(q->bitmap, (q->max - q->min) / 8 + 1)) return -1;
+    }
+    for (i = 0; i < h->external_count; i++) {
+        const struct sb_bc_external * e = prog->externals + i;
+        unless (BYTES(e->name, e->name_size) && NODE(e->node, 0)) return -1;
+    }
+    return 0;
+}
+
+#undef NODE
+#undef BYTES
+
+/* The index of the external of the given name, or -1. */
+extern int bytecode_external(const struct sb_bc_program * prog, const char * name) {
+    int i;
+    for (i = 0; i < prog->h->external_count; i++) {
+        const struct sb_bc_external * e = prog->externals + i;
+        if ((size_t) e->name_size == strlen(name) &&
+            memcmp(prog->blob + e->name, name, e->name_size) == 0) return i;
+    }
+    return -1;
+}
@@ -0,0 +1,116 @@
+
+/* Layout of an algorithm compiled by snowball -bytecode, and run by
+ * run_bytecode() in runtime/bytecode.c for sb_stemmer_new_from_file().
+ *
+ * The header below is followed by the arrays of nodes, amongs, among
+ * strings, groupings and externals, and then blob_size bytes holding the
+ * literal strings, the strings of the amongs, the bitmaps of the groupings
+ * and the names of the externals, all in the byte order of the machine
+ * which wrote it. Nodes, amongs etc are referred to by their index in
+ * their array, or -1 for none, and the bytes of the blob by their offset
+ * in it.
+ *
+ * The nodes are those of the syntax tree: the commands of a node are its
+ * left child, and its right sibling, and so on.
+ */
+
+#include <stddef.h>
+
+#define SB_BYTECODE_MAGIC "SBBYTEC\n"
+#define SB_BYTECODE_VERSION 1
+
+#define SB_OPS \
+    X(BRA) X(AND) X(OR) X(BACKWARDS) X(NOT) X(SET) X(UNSET) X(TRY) X(DO) \
+    X(FAIL) X(REVERSE) X(TEST) X(GOTO) X(GOPAST) X(REPEAT) X(LOOP) \
+    X(ATLEAST) X(SETMARK) X(TOMARK) X(ATMARK) X(HOP) X(NEXT) X(TOLIMIT) \
+    X(ATLIMIT) X(LEFTSLICE) X(RIGHTSLICE) X(ASSIGNTO) X(SLICETO) \
+    X(ASSIGN) X(INSERT) X(ATTACH) X(DELETE) X(SLICEFROM) X(SETLIMIT) \
+    X(DOLLAR) X(MATHASSIGN) X(PLUSASSIGN) X(MINUSASSIGN) \
+    X(MULTIPLYASSIGN) X(DIVIDEASSIGN) X(EQ) X(NE) X(GR) X(GE) X(LS) X(LE) \
+    X(CALL) X(GROUPING) X(NON) X(NAME) X(LITERALSTRING) X(AMONG) \
+    X(SUBSTRING) X(BOOLTEST) X(FALSE) X(TRUE) \
+    X(INTEGER) X(NUMBER) X(MAXINT) X(MININT) X(NEG) X(MULTIPLY) X(PLUS) \
+    X(MINUS) X(DIVIDE) X(SIZEOF) X(CURSOR) X(LIMIT) X(SIZE)
+
+enum sb_op {
+#define X(op) SB_OP_##op,
+    SB_OPS
+#undef X
+    SB_OP_COUNT
+};
+
+struct sb_bc_header {
+    char magic[8];
+    int version;
+    int utf8;               /* whether the strings are in UTF-8 */
+    int node_count;
+    int among_count;
+    int amongvec_count;     /* the strings of all the amongs */
+    int grouping_count;
+    int external_count;
+    int strings;            /* ) number of variables */
+    int integers;           /* ) of each type */
+    int booleans;           /* ) */
+    int blob_size;
+    char version_of_stemmer[24]; /* as ~pversion() of the generated C */
+};
+
+struct sb_bc_node {
+    int op;
+    int backward;
+    int left;
+    int right;
+    int aux;                /* the command of setlimit ... for */
+    int AE;                 /* arithmetic expression */
+    int arg;                /* variable, number, among, grouping, or the
+                               node of the routine called, or the offset
+                               of a literal string */
+    int size;               /* size of the literal string, or -1 if the
+                               string is the variable arg */
+};
+
+struct sb_bc_among {
+    int vec;                /* first of its strings */
+    int count;
+    int command_count;
+    int starter;
+    int substring;          /* whether a substring command does the lookup */
+};
+
+struct sb_bc_amongvec {     /* as struct among in runtime/header.h */
+    int s;
+    int s_size;
+    int substring_i;
+    int result;
+    int function;           /* node of the routine to call, or -1 */
+};
+
+struct sb_bc_grouping {
+    int bitmap;
+    int min;
+    int max;
+};
+
+struct sb_bc_external {
+    int name;
+    int name_size;
+    int node;
+    int max_growth;         /* as for sb_stemmer_max_length() */
+};
+
+/* The parts of a mapped file, as found by bytecode_open(). */
+struct sb_bc_program {
+    const struct sb_bc_header * h;
+    const struct sb_bc_node * nodes;
+    const struct sb_bc_among * amongs;
+    const struct sb_bc_amongvec * vecs;
+    const struct sb_bc_grouping * groupings;
+    const struct sb_bc_external * externals;
+    const unsigned char * blob;
+};
+
+struct SN_env;
+
+extern int bytecode_open(struct sb_bc_program * prog, const void * data, size_t size);
+extern int bytecode_external(const struct sb_bc_program * prog, const char * name);
+extern int run_bytecode(struct SN_env * z, const struct sb_bc_program * prog, int node);
@@ -12,12 +12,40 @@
 #define SET_SIZE(p, n) ((int *)(p))[-1] = n
 #define CAPACITY(p)    ((int *)(p))[-2]
 
+/* Hints from snowball -profile: which way a test usually goes, a routine
+   seldom called, and the start of a path seldom taken. */
+#ifdef __GNUC__
+#define SB_LIKELY(C)   __builtin_expect(!!(C), 1)
+#define SB_UNLIKELY(C) __builtin_expect(!!(C), 0)
+#define SB_COLD        __attribute__((cold))
+#else
+#define SB_LIKELY(C)   (C)
+#define SB_UNLIKELY(C) (C)
+#define SB_COLD
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#define SB_COLD_PATH(L) L: __attribute__((cold, unused))
+#else
+#define SB_COLD_PATH(L)
+#endif
+
 struct among
 {   int s_size;     /* number of chars in string */
     const symbol * s;       /* search string */
     int substring_i;/* index to longest matching substring */
     int result;     /* result of the lookup */
-    int (* function)(struct SN_env *);
+    int function;   /* number of the routine to call, or 0 */
+};
+
+/* Table of frequent words and their stems, built by snowball -hotwords:
+   slot holds groups of four ints, the offset and size in s of a word and
+   then of its stem. */
+struct hotwords
+{   int bucket_count;
+    int slot_count;
+    const int * d;          /* displacement of each bucket */
+    const int * slot;
+    const symbol * s;
 };
 
 extern symbol * create_s(void);
@@ -42,6 +70,16 @@ extern int eq_v_b(struct SN_env * z, const symbol * p);
 
 extern int find_among(struct SN_env * z, const struct among * v, int v_size);
 extern int find_among_b(struct SN_env * z, const struct among * v, int v_size);
+extern int find_among_next(struct SN_env * z, const struct among * v, int i, int ret);
+extern int find_among_next_b(struct SN_env * z, const struct among * v, int i, int ret);
+extern int find_among_counted(struct SN_env * z, const struct among * v, int v_size,
+                              unsigned long * counts);
+extern int find_among_b_counted(struct SN_env * z, const struct among * v, int v_size,
+                                unsigned long * counts);
+extern int find_among_next_counted(struct SN_env * z, const struct among * v, int i, int ret,
+                                   unsigned long * counts);
+extern int find_among_next_b_counted(struct SN_env * z, const struct among * v, int i, int ret,
+                                     unsigned long * counts);
 
 extern int replace_s(struct SN_env * z, int c_bra, int c_ket, int s_size, const symbol * s, int * adjustment);
 extern int slice_from_s(struct SN_env * z, int s_size, const symbol * s);
@@ -54,5 +92,8 @@ extern int insert_v(struct SN_env * z, int bra, int ket, const symbol * p);
 extern symbol * slice_to(struct SN_env * z, symbol * p);
 extern symbol * assign_to(struct SN_env * z, symbol * p);
 
+extern int check_hotwords(const struct hotwords * h, int size);
+extern int find_hotword(struct SN_env * z, const struct hotwords * h);
+
 extern void debug(struct SN_env * z, int number, int line_count);
 
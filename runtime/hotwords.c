@@ -0,0 +1,103 @@
+#include <stdlib.h> /* for malloc, free */
+#include <string.h> /* for memcmp */
+
+#include "hotwords.h"
+
+#define MAX_SEED 65536  /* before trying again with more slots */
+
+extern unsigned int sb_hotword_hash(const void * p, int width, int n, int seed) {
+    unsigned int h = 2166136261U ^ (unsigned int) seed * 0x9E3779B9U;
+    int i;
+    if (width == 1) {
+        const unsigned char * q = (const unsigned char *) p;
+        for (i = 0; i < n; i++) h = (h ^ q[i]) * 16777619U;
+    } else {
+        const unsigned short * q = (const unsigned short *) p;
+        for (i = 0; i < n; i++) h = (h ^ q[i]) * 16777619U;
+    }
+    return h;
+}
+
+static const void * word_of(const void * s, int width, const struct sb_hotword * x) {
+    return (const char *) s + x->word * width;
+}
+
+/* A word given twice is placed once: both copies are in the same bucket. */
+extern int sb_place_hotwords(struct sb_hotword * e, int n, const void * s, int width,
+                             int bucket_count, int slot_count, int * d, int * slot) {
+    int * order = (int *) malloc((n + 1) * sizeof(int));
+    int * start = (int *) malloc((bucket_count + 2) * sizeof(int));
+    int * bucket_order = (int *) malloc((bucket_count + 1) * sizeof(int));
+    int * member_slot = (int *) malloc((n + 1) * sizeof(int));
+    int placed = 0;
+    int k = 0;
+    int i;
+
+    if (order == NULL || start == NULL || bucket_order == NULL || member_slot == NULL) {
+        placed = -2;
+        goto out;
+    }
+
+    /* sort the entries by bucket, and the buckets by size */
+    for (i = 0; i < n; i++)
+        e[i].bucket = sb_hotword_hash(word_of(s, width, e + i), width, e[i].word_size, 0) % bucket_count;
+    for (i = 0; i <= bucket_count + 1; i++) start[i] = 0;
+    for (i = 0; i < n; i++) start[e[i].bucket + 2]++;
+    for (i = 2; i <= bucket_count + 1; i++) start[i] += start[i - 1];
+    for (i = 0; i < n; i++) order[start[e[i].bucket + 1]++] = i;
+    {
+        int max = 0;
+        int size;
+        for (i = 0; i < bucket_count; i++)
+            if (start[i + 1] - start[i] > max) max = start[i + 1] - start[i];
+        for (size = max; size > 0; size--)
+            for (i = 0; i < bucket_count; i++)
+                if (start[i + 1] - start[i] == size) bucket_order[k++] = i;
+    }
+    for (i = 0; i < bucket_count; i++) d[i] = 0;
+    for (i = 0; i < 4 * slot_count; i++) slot[i] = -1;
+
+    for (i = 0; i < k; i++) {
+        int b = bucket_order[i];
+        int * member = order + start[b];
+        int size = 0;
+        int seed;
+        int j;
+        for (j = 0; j < start[b + 1] - start[b]; j++) {
+            struct sb_hotword * x = e + member[j];
+            int m;
+            for (m = 0; m < size; m++) {
+                struct sb_hotword * y = e + member[m];
+                if (x->word_size == y->word_size &&
+                    memcmp(word_of(s, width, x), word_of(s, width, y), x->word_size * width) == 0) break;
+            }
+            if (m == size) member[size++] = member[j];
+        }
+        for (seed = 1; seed < MAX_SEED; seed++) {
+            for (j = 0; j < size; j++) {
+                struct sb_hotword * x = e + member[j];
+                int m;
+                member_slot[j] = sb_hotword_hash(word_of(s, width, x), width, x->word_size, seed) % slot_count;
+                if (slot[4 * member_slot[j] + 1] >= 0) break;
+                for (m = 0; m < j; m++) if (member_slot[m] == member_slot[j]) break;
+                if (m < j) break;
+            }
+            if (j == size) break;
+        }
+        if (seed == MAX_SEED) { placed = -1; break; }
+        d[b] = seed;
+        for (j = 0; j < size; j++) {
+            struct sb_hotword * x = e + member[j];
+            int * q = slot + 4 * member_slot[j];
+            q[0] = x->word; q[1] = x->word_size;
+            q[2] = x->stem; q[3] = x->stem_size;
+        }
+        placed += size;
+    }
+out:
+    free(order);
+    free(start);
+    free(bucket_order);
+    free(member_slot);
+    return placed;
+}
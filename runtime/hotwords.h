@@ -0,0 +1,38 @@
+
+/* Building the perfect hash table of frequent words and their stems which
+ * find_hotword() in runtime/utilities.c looks words up in, as done by
+ * snowball -hotwords and by examples/stemdict.c.
+ *
+ * The table is built by hash and displace: each word goes in bucket
+ * hash(word, 0) % bucket_count, and then in slot hash(word, d) %
+ * slot_count, where d is chosen for each bucket in turn, largest first, so
+ * that its words all land in empty slots.
+ *
+ * The compiler's symbols are wider than the runtime's, so the words are
+ * given with the size of their symbols, which only holds the value of a
+ * byte when they are looked up by the runtime.
+ */
+
+#define SB_HOTWORD_BUCKETS(n) ((n) / 4 + 1)   /* about four words a bucket */
+#define SB_HOTWORD_SLOTS(n) ((n) + (n) / 4 + 1)
+#define SB_HOTWORD_MORE_SLOTS(k) ((k) + (k) / 8 + 1)
+
+struct sb_hotword {
+    int word;           /* offset of the word */
+    int word_size;
+    int stem;           /* offset of its stem, which may be the word itself */
+    int stem_size;
+    int bucket;         /* set by sb_place_hotwords() */
+};
+
+/* width is the size of the symbols at p, 1 or 2 */
+extern unsigned int sb_hotword_hash(const void * p, int width, int n, int seed);
+
+/* Places the n entries e, whose words are in s, in d[bucket_count] and
+ * slot[4 * slot_count]. Returns the number of words placed, which is less
+ * than n if a word is given twice, -1 if some bucket can't be placed, so
+ * that the caller should try again with SB_HOTWORD_MORE_SLOTS(slot_count),
+ * and -2 if out of memory.
+ */
+extern int sb_place_hotwords(struct sb_hotword * e, int n, const void * s, int width,
+                             int bucket_count, int slot_count, int * d, int * slot);
@@ -0,0 +1,444 @@
+
+/* Runtime support for stemmers generated by the Snowball to C++ compiler
+   (snowball -c++). Everything is a template on the symbol type, so that a
+   stemmer and this runtime can be inlined into the code using it:
+
+       unsigned char       the string is held in UTF-8
+       char16_t, char32_t  each symbol is a character
+
+   The among tables and literal strings of a generated stemmer are emitted in
+   both forms, and the right ones are picked by the width of the symbol.
+   They are defined in the generated header as well as declared, so C++11 and
+   later will do.
+*/
+
+#ifndef SNOWBALL_RUNTIME_HPP
+#define SNOWBALL_RUNTIME_HPP
+
+#include <cstdio>      /* for printf, used by debug() */
+#include <stdexcept>   /* for std::logic_error */
+#include <type_traits> /* for std::is_unsigned */
+#include <utility>     /* for std::swap */
+#include <vector>
+
+namespace snowball {
+
+template <typename T>
+struct among {
+    int s_size;          /* number of symbols in s */
+    const T * s;         /* search string */
+    int substring_i;     /* index to longest matching substring */
+    int result;          /* result of the lookup */
+    int function;        /* number of the routine to call, or 0 */
+};
+
+/* No routines to call from an among. */
+struct no_among_func {
+    bool operator()(int) const { return false; }
+};
+
+template <typename symbol>
+class program {
+
+    static_assert(std::is_unsigned<symbol>::value,
+                  "the symbol type must be unsigned");
+
+  public:
+    void set_current(const symbol * s, int size) {
+        p.assign(s, s + size);
+        c = 0; l = size; lb = 0;
+        bra = 0; ket = size;
+    }
+
+    const symbol * current() const { return p.data(); }
+    int length() const { return l; }
+
+  protected:
+    enum { utf8 = sizeof(symbol) == 1 };
+
+    std::vector<symbol> p;
+    int c = 0;
+    int l = 0;
+    int lb = 0;
+    int bra = 0;
+    int ket = 0;
+
+    /* What '$' needs to save and restore besides the string itself. */
+    struct cursors { int c, l, lb, bra, ket; };
+
+    cursors save_cursors() const { cursors r = { c, l, lb, bra, ket }; return r; }
+
+    void restore_cursors(const cursors & r) {
+        c = r.c; l = r.l; lb = r.lb; bra = r.bra; ket = r.ket;
+    }
+
+    /* Returns the position n characters on from c (back from c if n is
+       negative), or -1 if that would pass lb or l. */
+    int hop(int c, int lb, int l, int n) const {
+        if (!utf8) {
+            int ret = c + n;
+            return lb > ret || ret > l ? -1 : ret;
+        }
+        if (n >= 0) {
+            for (; n > 0; n--) {
+                int b;
+                if (c >= l) return -1;
+                b = p[c++];
+                if (b >= 0xC0) {   /* 1100 0000 */
+                    while (c < l) {
+                        b = p[c];
+                        if (b >= 0xC0 || b < 0x80) break;
+                        /* break unless b is 10------ */
+                        c++;
+                    }
+                }
+            }
+        } else {
+            for (; n < 0; n++) {
+                int b;
+                if (c <= lb) return -1;
+                b = p[--c];
+                if (b >= 0x80) {   /* 1000 0000 */
+                    while (c > lb) {
+                        b = p[c];
+                        if (b >= 0xC0) break; /* 1100 0000 */
+                        c--;
+                    }
+                }
+            }
+        }
+        return c;
+    }
+
+    /* Reads the character after c into ch, returning the number of symbols
+       it takes, or 0 at the limit l. */
+    int get_char(int c, int l, int & ch) const {
+        int b0, b1;
+        if (c >= l) return 0;
+        b0 = p[c++];
+        if (!utf8 || b0 < 0xC0 || c == l) {   /* 1100 0000 */
+            ch = b0; return 1;
+        }
+        b1 = p[c++];
+        if (b0 < 0xE0 || c == l) {   /* 1110 0000 */
+            ch = (b0 & 0x1F) << 6 | (b1 & 0x3F); return 2;
+        }
+        ch = (b0 & 0xF) << 12 | (b1 & 0x3F) << 6 | (p[c] & 0x3F); return 3;
+    }
+
+    /* Likewise for the character before c, with limit lb. */
+    int get_char_b(int c, int lb, int & ch) const {
+        int b0, b1;
+        if (c <= lb) return 0;
+        b0 = p[--c];
+        if (!utf8 || b0 < 0x80 || c == lb) {   /* 1000 0000 */
+            ch = b0; return 1;
+        }
+        b1 = p[--c];
+        if (b1 >= 0xC0 || c == lb) {   /* 1100 0000 */
+            ch = (b1 & 0x1F) << 6 | (b0 & 0x3F); return 2;
+        }
+        ch = (p[c] & 0xF) << 12 | (b1 & 0x3F) << 6 | (b0 & 0x3F); return 3;
+    }
+
+    static bool in_set(const unsigned char * s, int min, int max, int ch) {
+        return !(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0);
+    }
+
+    /* The grouping tests return 0 if they moved c over one (or with repeat
+       set, all) matching characters, -1 at the limit, and otherwise the
+       width of the character which did not match. */
+
+    int in_grouping(const unsigned char * s, int min, int max, int repeat) {
+        do {
+            int ch;
+            int w = get_char(c, l, ch);
+            if (!w) return -1;
+            if (!in_set(s, min, max, ch)) return w;
+            c += w;
+        } while (repeat);
+        return 0;
+    }
+
+    int in_grouping_b(const unsigned char * s, int min, int max, int repeat) {
+        do {
+            int ch;
+            int w = get_char_b(c, lb, ch);
+            if (!w) return -1;
+            if (!in_set(s, min, max, ch)) return w;
+            c -= w;
+        } while (repeat);
+        return 0;
+    }
+
+    int out_grouping(const unsigned char * s, int min, int max, int repeat) {
+        do {
+            int ch;
+            int w = get_char(c, l, ch);
+            if (!w) return -1;
+            if (in_set(s, min, max, ch)) return w;
+            c += w;
+        } while (repeat);
+        return 0;
+    }
+
+    int out_grouping_b(const unsigned char * s, int min, int max, int repeat) {
+        do {
+            int ch;
+            int w = get_char_b(c, lb, ch);
+            if (!w) return -1;
+            if (in_set(s, min, max, ch)) return w;
+            c -= w;
+        } while (repeat);
+        return 0;
+    }
+
+    template <typename T>
+    bool eq_s(int s_size, const T * s) {
+        int i;
+        if (l - c < s_size) return false;
+        for (i = 0; i < s_size; i++) if (p[c + i] != s[i]) return false;
+        c += s_size;
+        return true;
+    }
+
+    template <typename T>
+    bool eq_s_b(int s_size, const T * s) {
+        int i;
+        if (c - lb < s_size) return false;
+        for (i = 0; i < s_size; i++) if (p[c - s_size + i] != s[i]) return false;
+        c -= s_size;
+        return true;
+    }
+
+    template <typename T, int N>
+    bool eq_s(const T (& s)[N]) { return eq_s(N, s); }
+
+    template <typename T, int N>
+    bool eq_s_b(const T (& s)[N]) { return eq_s_b(N, s); }
+
+    bool eq_v(const std::vector<symbol> & s) { return eq_s(int(s.size()), s.data()); }
+    bool eq_v_b(const std::vector<symbol> & s) { return eq_s_b(int(s.size()), s.data()); }
+
+    /* call_among_func(n) calls routine number n of the among. */
+
+    template <typename T, int N, typename F>
+    int find_among(const among<T> (& v)[N], F call_among_func) {
+
+        int i = 0;
+        int j = N;
+
+        int c = this->c; int l = this->l;
+        const symbol * q = p.data() + c;
+
+        const among<T> * w;
+
+        int common_i = 0;
+        int common_j = 0;
+
+        int first_key_inspected = 0;
+
+        while (1) {
+            int k = i + ((j - i) >> 1);
+            int diff = 0;
+            int common = common_i < common_j ? common_i : common_j; /* smaller */
+            w = v + k;
+            {
+                int i2; for (i2 = common; i2 < w->s_size; i2++) {
+                    if (c + common == l) { diff = -1; break; }
+                    diff = int(q[common]) - int(w->s[i2]);
+                    if (diff != 0) break;
+                    common++;
+                }
+            }
+            if (diff < 0) { j = k; common_j = common; }
+                     else { i = k; common_i = common; }
+            if (j - i <= 1) {
+                if (i > 0) break; /* v->s has been inspected */
+                if (j == i) break; /* only one item in v */
+
+                /* - but now we need to go round once more to get
+                   v->s inspected. This looks messy, but is actually
+                   the optimal approach.  */
+
+                if (first_key_inspected) break;
+                first_key_inspected = 1;
+            }
+        }
+        while (1) {
+            w = v + i;
+            if (common_i >= w->s_size) {
+                this->c = c + w->s_size;
+                if (w->function == 0) return w->result;
+                {
+                    bool res = call_among_func(w->function);
+                    this->c = c + w->s_size;
+                    if (res) return w->result;
+                }
+            }
+            i = w->substring_i;
+            if (i < 0) return 0;
+        }
+    }
+
+    /* find_among_b is for backwards processing. Same comments apply */
+
+    template <typename T, int N, typename F>
+    int find_among_b(const among<T> (& v)[N], F call_among_func) {
+
+        int i = 0;
+        int j = N;
+
+        int c = this->c; int lb = this->lb;
+        const symbol * q = p.data() + c - 1;
+
+        const among<T> * w;
+
+        int common_i = 0;
+        int common_j = 0;
+
+        int first_key_inspected = 0;
+
+        while (1) {
+            int k = i + ((j - i) >> 1);
+            int diff = 0;
+            int common = common_i < common_j ? common_i : common_j;
+            w = v + k;
+            {
+                int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
+                    if (c - common == lb) { diff = -1; break; }
+                    diff = int(q[- common]) - int(w->s[i2]);
+                    if (diff != 0) break;
+                    common++;
+                }
+            }
+            if (diff < 0) { j = k; common_j = common; }
+                     else { i = k; common_i = common; }
+            if (j - i <= 1) {
+                if (i > 0) break;
+                if (j == i) break;
+                if (first_key_inspected) break;
+                first_key_inspected = 1;
+            }
+        }
+        while (1) {
+            w = v + i;
+            if (common_i >= w->s_size) {
+                this->c = c - w->s_size;
+                if (w->function == 0) return w->result;
+                {
+                    bool res = call_among_func(w->function);
+                    this->c = c - w->s_size;
+                    if (res) return w->result;
+                }
+            }
+            i = w->substring_i;
+            if (i < 0) return 0;
+        }
+    }
+
+    template <typename T, int N>
+    int find_among(const among<T> (& v)[N]) { return find_among(v, no_among_func()); }
+
+    template <typename T, int N>
+    int find_among_b(const among<T> (& v)[N]) { return find_among_b(v, no_among_func()); }
+
+    /* Replaces the symbols between c_bra and c_ket by the s_size symbols at
+       s, returning the change in length. */
+    template <typename T>
+    int replace_s(int c_bra, int c_ket, int s_size, const T * s) {
+        int adjustment = s_size - (c_ket - c_bra);
+        int i;
+        if (adjustment > 0) {
+            p.insert(p.begin() + c_ket, adjustment, symbol());
+        } else if (adjustment < 0) {
+            p.erase(p.begin() + c_ket + adjustment, p.begin() + c_ket);
+        }
+        if (adjustment != 0) {
+            l += adjustment;
+            if (c >= c_ket)
+                c += adjustment;
+            else
+                if (c > c_bra)
+                    c = c_bra;
+        }
+        for (i = 0; i < s_size; i++) p[c_bra + i] = symbol(s[i]);
+        return adjustment;
+    }
+
+    void slice_check() const {
+        if (bra < 0 ||
+            bra > ket ||
+            ket > l ||
+            l > int(p.size()))
+            throw std::logic_error("snowball: faulty slice operation");
+    }
+
+    template <typename T>
+    void slice_from_s(int s_size, const T * s) {
+        slice_check();
+        replace_s(bra, ket, s_size, s);
+    }
+
+    template <typename T, int N>
+    void slice_from(const T (& s)[N]) { slice_from_s(N, s); }
+
+    void slice_from_v(const std::vector<symbol> & s) {
+        /* s may be an alias of part of p if it came from slice_to */
+        std::vector<symbol> t(s);
+        slice_from_s(int(t.size()), t.data());
+    }
+
+    void slice_del() { slice_from_s(0, static_cast<const symbol *>(0)); }
+
+    template <typename T>
+    void insert_s(int bra, int ket, int s_size, const T * s) {
+        int adjustment = replace_s(bra, ket, s_size, s);
+        if (bra <= this->bra) this->bra += adjustment;
+        if (bra <= this->ket) this->ket += adjustment;
+    }
+
+    template <typename T, int N>
+    void insert(int bra, int ket, const T (& s)[N]) { insert_s(bra, ket, N, s); }
+
+    void insert_v(int bra, int ket, const std::vector<symbol> & s) {
+        std::vector<symbol> t(s);
+        insert_s(bra, ket, int(t.size()), t.data());
+    }
+
+    void slice_to(std::vector<symbol> & s) const {
+        slice_check();
+        s.assign(p.begin() + bra, p.begin() + ket);
+    }
+
+    void assign_to(std::vector<symbol> & s) const {
+        s.assign(p.begin(), p.begin() + l);
+    }
+
+    /* The string and cursors of '$ s' are swapped in and out of the
+       program, as the C runtime does with a copy of the SN_env. */
+    void swap_current(std::vector<symbol> & s) { std::swap(p, s); }
+
+    void debug(int number, int line_count) const {
+        int i;
+        int limit = int(p.size());
+        if (number >= 0) std::printf("%3d (line %4d): [%d]'", number, line_count, limit);
+        for (i = 0; i <= limit; i++) {
+            if (lb == i) std::printf("{");
+            if (bra == i) std::printf("[");
+            if (c == i) std::printf("|");
+            if (ket == i) std::printf("]");
+            if (l == i) std::printf("}");
+            if (i < limit) {
+                int ch = p[i];
+                if (ch == 0) ch = '#';
+                std::printf("%c", ch);
+            }
+        }
+        std::printf("'\n");
+    }
+};
+
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <string.h>
 
 #include "header.h"
+#include "hotwords.h"
 
 #define unless(C) if(!(C))
 
@@ -209,6 +210,12 @@ extern int eq_v_b(struct SN_env * z, const symbol * p) {
     return eq_s_b(z, SIZE(p), p);
 }
 
+/* Returns the result of the longest string of v matching at the cursor,
+   with the cursor after it, or 0 if none does. A result is positive, or
+   -1 for a string followed by (). If that string has a routine, it returns
+   -2 - i instead, i being the index of the string: the caller calls the
+   routine, puts the cursor back, and then calls find_among_next(). */
+
 extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
 
     int i = 0;
@@ -255,12 +262,7 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
         w = v + i;
         if (common_i >= w->s_size) {
             z->c = c + w->s_size;
-            if (w->function == 0) return w->result;
-            {
-                int res = w->function(z);
-                z->c = c + w->s_size;
-                if (res) return w->result;
-            }
+            return w->function == 0 ? w->result : -2 - i;
         }
         i = w->substring_i;
         if (i < 0) return 0;
@@ -310,18 +312,91 @@ extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
         w = v + i;
         if (common_i >= w->s_size) {
             z->c = c - w->s_size;
-            if (w->function == 0) return w->result;
-            {
-                int res = w->function(z);
-                z->c = c - w->s_size;
-                if (res) return w->result;
-            }
+            return w->function == 0 ? w->result : -2 - i;
         }
         i = w->substring_i;
         if (i < 0) return 0;
     }
 }
 
+/* find_among_next() goes on from string i of v, whose routine returned
+   ret, with the cursor after the string. The strings it goes on to are
+   shorter ones which begin it (end it, for find_among_next_b()), and so
+   match too. Returns as find_among(). */
+
+extern int find_among_next(struct SN_env * z, const struct among * v, int i, int ret) {
+    int c = z->c - v[i].s_size;
+    if (ret) return v[i].result;
+    i = v[i].substring_i;
+    if (i < 0) return 0;
+    z->c = c + v[i].s_size;
+    return v[i].function == 0 ? v[i].result : -2 - i;
+}
+
+extern int find_among_next_b(struct SN_env * z, const struct among * v, int i, int ret) {
+    int c = z->c + v[i].s_size;
+    if (ret) return v[i].result;
+    i = v[i].substring_i;
+    if (i < 0) return 0;
+    z->c = c - v[i].s_size;
+    return v[i].function == 0 ? v[i].result : -2 - i;
+}
+
+/* For snowball -instrument: as the functions above, but counting the
+   lookup in counts[0], and the string of v matched, if any, in
+   counts[1 + i], once the result is known. find_among() doesn't give the
+   string, which is found again by its size and the text it matched. */
+
+static void count_among(const struct among * v, int v_size, const symbol * p,
+                        int size, unsigned long * counts) {
+    int i;
+    counts[0]++;
+    for (i = 0; i < v_size; i++) {
+        if (v[i].s_size == size && memcmp(v[i].s, p, size * sizeof(symbol)) == 0) {
+            counts[1 + i]++;
+            return;
+        }
+    }
+}
+
+extern int find_among_counted(struct SN_env * z, const struct among * v, int v_size,
+                              unsigned long * counts) {
+    int c = z->c;
+    int result = find_among(z, v, v_size);
+    if (result < -1) return result;
+    if (result == 0) { counts[0]++; return 0; }
+    count_among(v, v_size, z->p + c, z->c - c, counts);
+    return result;
+}
+
+extern int find_among_b_counted(struct SN_env * z, const struct among * v, int v_size,
+                                unsigned long * counts) {
+    int c = z->c;
+    int result = find_among_b(z, v, v_size);
+    if (result < -1) return result;
+    if (result == 0) { counts[0]++; return 0; }
+    count_among(v, v_size, z->p + z->c, c - z->c, counts);
+    return result;
+}
+
+extern int find_among_next_counted(struct SN_env * z, const struct among * v, int i, int ret,
+                                   unsigned long * counts) {
+    int result = find_among_next(z, v, i, ret);
+    if (result < -1) return result;
+    counts[0]++;
+    if (result != 0) counts[1 + (ret ? i : v[i].substring_i)]++;
+    return result;
+}
+
+extern int find_among_next_b_counted(struct SN_env * z, const struct among * v, int i, int ret,
+                                     unsigned long * counts) {
+    int result = find_among_next_b(z, v, i, ret);
+    if (result < -1) return result;
+    counts[0]++;
+    if (result != 0) counts[1 + (ret ? i : v[i].substring_i)]++;
+    return result;
+}
+
 
 /* Increase the size of the buffer pointed to by p to at least n symbols.
  * If insufficient memory, returns NULL and frees the old buffer.
@@ -455,6 +530,36 @@ extern symbol * assign_to(struct SN_env * z, symbol * p) {
     return p;
 }
 
+/* Checks a table from outside the program, such as a mapped file, before
+   find_hotword() trusts it: that each displacement is a seed, and that each
+   slot is empty (all -1) or has a word and a stem within the size symbols
+   of h->s. Returns 0 if so, and -1 if not. */
+extern int check_hotwords(const struct hotwords * h, int size) {
+    int i;
+    if (h->bucket_count <= 0 || h->slot_count <= 0 || size < 0) return -1;
+    for (i = 0; i < h->bucket_count; i++)
+        if (h->d[i] < 0) return -1;
+    for (i = 0; i < h->slot_count; i++) {
+        const int * e = h->slot + 4 * i;
+        int j;
+        if (e[0] == -1 && e[1] == -1 && e[2] == -1 && e[3] == -1) continue;
+        for (j = 0; j < 4; j += 2)
+            if (e[j] < 0 || e[j + 1] < 0 || e[j] > size - e[j + 1]) return -1;
+    }
+    return 0;
+}
+
+/* Looks the whole of z->p up in h, as built by sb_place_hotwords(), and
+   if it is there replaces it with its stem. Returns 1 if found, 0 if not,
+   and -1 on error. */
+extern int find_hotword(struct SN_env * z, const struct hotwords * h) {
+    int b = sb_hotword_hash(z->p, sizeof(symbol), z->l, 0) % h->bucket_count;
+    const int * e = h->slot + 4 * (sb_hotword_hash(z->p, sizeof(symbol), z->l, h->d[b]) % h->slot_count);
+    if (e[1] != z->l || memcmp(z->p, h->s + e[0], z->l * sizeof(symbol)) != 0) return 0;
+    if (e[2] == e[0]) return 1;
+    return replace_s(z, 0, z->l, e[3], h->s + e[2], NULL) < 0 ? -1 : 1;
+}
+
 #if 0
 extern void debug(struct SN_env * z, int number, int line_count) {
     int i;
@@ -0,0 +1,20 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * english_ISO_8859_1_create_env(void);
+extern void english_ISO_8859_1_close_env(struct SN_env * z);
+extern const char * english_ISO_8859_1_version(void);
+
+extern int english_ISO_8859_1_stem_light(struct SN_env * z);
+#define english_ISO_8859_1_stem_light_max_growth 2
+extern int english_ISO_8859_1_stem(struct SN_env * z);
+#define english_ISO_8859_1_stem_max_growth 3
+
+#ifdef __cplusplus
+}
+#endif
+
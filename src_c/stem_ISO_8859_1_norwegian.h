@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * norwegian_ISO_8859_1_create_env(void);
+extern void norwegian_ISO_8859_1_close_env(struct SN_env * z);
+extern const char * norwegian_ISO_8859_1_version(void);
+
+extern int norwegian_ISO_8859_1_stem(struct SN_env * z);
+#define norwegian_ISO_8859_1_stem_max_growth 0
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * porter_ISO_8859_1_create_env(void);
+extern void porter_ISO_8859_1_close_env(struct SN_env * z);
+extern const char * porter_ISO_8859_1_version(void);
+
+extern int porter_ISO_8859_1_stem(struct SN_env * z);
+#define porter_ISO_8859_1_stem_max_growth 1
+
+#ifdef __cplusplus
+}
+#endif
+
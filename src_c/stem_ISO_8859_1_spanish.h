@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * spanish_ISO_8859_1_create_env(void);
+extern void spanish_ISO_8859_1_close_env(struct SN_env * z);
+extern const char * spanish_ISO_8859_1_version(void);
+
+extern int spanish_ISO_8859_1_stem(struct SN_env * z);
+#define spanish_ISO_8859_1_stem_max_growth 5
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * hungarian_ISO_8859_2_create_env(void);
+extern void hungarian_ISO_8859_2_close_env(struct SN_env * z);
+extern const char * hungarian_ISO_8859_2_version(void);
+
+extern int hungarian_ISO_8859_2_stem(struct SN_env * z);
+#define hungarian_ISO_8859_2_stem_max_growth 0
+
+#ifdef __cplusplus
+}
+#endif
+
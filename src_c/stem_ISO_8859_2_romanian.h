@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * romanian_ISO_8859_2_create_env(void);
+extern void romanian_ISO_8859_2_close_env(struct SN_env * z);
+extern const char * romanian_ISO_8859_2_version(void);
+
+extern int romanian_ISO_8859_2_stem(struct SN_env * z);
+#define romanian_ISO_8859_2_stem_max_growth 1
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * russian_KOI8_R_create_env(void);
+extern void russian_KOI8_R_close_env(struct SN_env * z);
+extern const char * russian_KOI8_R_version(void);
+
+extern int russian_KOI8_R_stem(struct SN_env * z);
+#define russian_KOI8_R_stem_max_growth 0
+
+#ifdef __cplusplus
+}
+#endif
+
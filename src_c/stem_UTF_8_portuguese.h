@@ -0,0 +1,18 @@
+
+/* This file was generated automatically by the Snowball to ANSI C compiler */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * portuguese_UTF_8_create_env(void);
+extern void portuguese_UTF_8_close_env(struct SN_env * z);
+extern const char * portuguese_UTF_8_version(void);
+
+extern int portuguese_UTF_8_stem(struct SN_env * z);
+#define portuguese_UTF_8_stem_max_growth 0
+
+#ifdef __cplusplus
+}
+#endif
+
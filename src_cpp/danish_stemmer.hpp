@@ -0,0 +1,419 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_DANISH_STEMMER_HPP
+#define SNOWBALL_DANISH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct danish_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128 };
+    static constexpr unsigned char g_s_ending[] = { 239, 254, 42, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16 };
+};
+
+template <bool utf8> struct danish_stemmer_data;
+
+template <>
+struct danish_stemmer_data<true> : danish_stemmer_groupings {
+    static constexpr unsigned char s_0_0[3] = { 'h', 'e', 'd' };
+    static constexpr unsigned char s_0_1[5] = { 'e', 't', 'h', 'e', 'd' };
+    static constexpr unsigned char s_0_2[4] = { 'e', 'r', 'e', 'd' };
+    static constexpr unsigned char s_0_3[1] = { 'e' };
+    static constexpr unsigned char s_0_4[5] = { 'e', 'r', 'e', 'd', 'e' };
+    static constexpr unsigned char s_0_5[4] = { 'e', 'n', 'd', 'e' };
+    static constexpr unsigned char s_0_6[6] = { 'e', 'r', 'e', 'n', 'd', 'e' };
+    static constexpr unsigned char s_0_7[3] = { 'e', 'n', 'e' };
+    static constexpr unsigned char s_0_8[4] = { 'e', 'r', 'n', 'e' };
+    static constexpr unsigned char s_0_9[3] = { 'e', 'r', 'e' };
+    static constexpr unsigned char s_0_10[2] = { 'e', 'n' };
+    static constexpr unsigned char s_0_11[5] = { 'h', 'e', 'd', 'e', 'n' };
+    static constexpr unsigned char s_0_12[4] = { 'e', 'r', 'e', 'n' };
+    static constexpr unsigned char s_0_13[2] = { 'e', 'r' };
+    static constexpr unsigned char s_0_14[5] = { 'h', 'e', 'd', 'e', 'r' };
+    static constexpr unsigned char s_0_15[4] = { 'e', 'r', 'e', 'r' };
+    static constexpr unsigned char s_0_16[1] = { 's' };
+    static constexpr unsigned char s_0_17[4] = { 'h', 'e', 'd', 's' };
+    static constexpr unsigned char s_0_18[2] = { 'e', 's' };
+    static constexpr unsigned char s_0_19[5] = { 'e', 'n', 'd', 'e', 's' };
+    static constexpr unsigned char s_0_20[7] = { 'e', 'r', 'e', 'n', 'd', 'e', 's' };
+    static constexpr unsigned char s_0_21[4] = { 'e', 'n', 'e', 's' };
+    static constexpr unsigned char s_0_22[5] = { 'e', 'r', 'n', 'e', 's' };
+    static constexpr unsigned char s_0_23[4] = { 'e', 'r', 'e', 's' };
+    static constexpr unsigned char s_0_24[3] = { 'e', 'n', 's' };
+    static constexpr unsigned char s_0_25[6] = { 'h', 'e', 'd', 'e', 'n', 's' };
+    static constexpr unsigned char s_0_26[5] = { 'e', 'r', 'e', 'n', 's' };
+    static constexpr unsigned char s_0_27[3] = { 'e', 'r', 's' };
+    static constexpr unsigned char s_0_28[3] = { 'e', 't', 's' };
+    static constexpr unsigned char s_0_29[5] = { 'e', 'r', 'e', 't', 's' };
+    static constexpr unsigned char s_0_30[2] = { 'e', 't' };
+    static constexpr unsigned char s_0_31[4] = { 'e', 'r', 'e', 't' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 3, s_0_0, -1, 1, 0 },
+    /*  1 */ { 5, s_0_1, 0, 1, 0 },
+    /*  2 */ { 4, s_0_2, -1, 1, 0 },
+    /*  3 */ { 1, s_0_3, -1, 1, 0 },
+    /*  4 */ { 5, s_0_4, 3, 1, 0 },
+    /*  5 */ { 4, s_0_5, 3, 1, 0 },
+    /*  6 */ { 6, s_0_6, 5, 1, 0 },
+    /*  7 */ { 3, s_0_7, 3, 1, 0 },
+    /*  8 */ { 4, s_0_8, 3, 1, 0 },
+    /*  9 */ { 3, s_0_9, 3, 1, 0 },
+    /* 10 */ { 2, s_0_10, -1, 1, 0 },
+    /* 11 */ { 5, s_0_11, 10, 1, 0 },
+    /* 12 */ { 4, s_0_12, 10, 1, 0 },
+    /* 13 */ { 2, s_0_13, -1, 1, 0 },
+    /* 14 */ { 5, s_0_14, 13, 1, 0 },
+    /* 15 */ { 4, s_0_15, 13, 1, 0 },
+    /* 16 */ { 1, s_0_16, -1, 2, 0 },
+    /* 17 */ { 4, s_0_17, 16, 1, 0 },
+    /* 18 */ { 2, s_0_18, 16, 1, 0 },
+    /* 19 */ { 5, s_0_19, 18, 1, 0 },
+    /* 20 */ { 7, s_0_20, 19, 1, 0 },
+    /* 21 */ { 4, s_0_21, 18, 1, 0 },
+    /* 22 */ { 5, s_0_22, 18, 1, 0 },
+    /* 23 */ { 4, s_0_23, 18, 1, 0 },
+    /* 24 */ { 3, s_0_24, 16, 1, 0 },
+    /* 25 */ { 6, s_0_25, 24, 1, 0 },
+    /* 26 */ { 5, s_0_26, 24, 1, 0 },
+    /* 27 */ { 3, s_0_27, 16, 1, 0 },
+    /* 28 */ { 3, s_0_28, 16, 1, 0 },
+    /* 29 */ { 5, s_0_29, 28, 1, 0 },
+    /* 30 */ { 2, s_0_30, -1, 1, 0 },
+    /* 31 */ { 4, s_0_31, 30, 1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[2] = { 'g', 'd' };
+    static constexpr unsigned char s_1_1[2] = { 'd', 't' };
+    static constexpr unsigned char s_1_2[2] = { 'g', 't' };
+    static constexpr unsigned char s_1_3[2] = { 'k', 't' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 },
+    /*  2 */ { 2, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'i', 'g' };
+    static constexpr unsigned char s_2_1[3] = { 'l', 'i', 'g' };
+    static constexpr unsigned char s_2_2[4] = { 'e', 'l', 'i', 'g' };
+    static constexpr unsigned char s_2_3[3] = { 'e', 'l', 's' };
+    static constexpr unsigned char s_2_4[5] = { 'l', 0xC3, 0xB8, 's', 't' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 3, s_2_1, 0, 1, 0 },
+    /*  2 */ { 4, s_2_2, 1, 1, 0 },
+    /*  3 */ { 3, s_2_3, -1, 1, 0 },
+    /*  4 */ { 5, s_2_4, -1, 2, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 's', 't' };
+    static constexpr unsigned char s_1[] = { 'i', 'g' };
+    static constexpr unsigned char s_2[] = { 'l', 0xC3, 0xB8, 's' };
+};
+
+template <>
+struct danish_stemmer_data<false> : danish_stemmer_groupings {
+    static constexpr char32_t s_0_0[3] = { 'h', 'e', 'd' };
+    static constexpr char32_t s_0_1[5] = { 'e', 't', 'h', 'e', 'd' };
+    static constexpr char32_t s_0_2[4] = { 'e', 'r', 'e', 'd' };
+    static constexpr char32_t s_0_3[1] = { 'e' };
+    static constexpr char32_t s_0_4[5] = { 'e', 'r', 'e', 'd', 'e' };
+    static constexpr char32_t s_0_5[4] = { 'e', 'n', 'd', 'e' };
+    static constexpr char32_t s_0_6[6] = { 'e', 'r', 'e', 'n', 'd', 'e' };
+    static constexpr char32_t s_0_7[3] = { 'e', 'n', 'e' };
+    static constexpr char32_t s_0_8[4] = { 'e', 'r', 'n', 'e' };
+    static constexpr char32_t s_0_9[3] = { 'e', 'r', 'e' };
+    static constexpr char32_t s_0_10[2] = { 'e', 'n' };
+    static constexpr char32_t s_0_11[5] = { 'h', 'e', 'd', 'e', 'n' };
+    static constexpr char32_t s_0_12[4] = { 'e', 'r', 'e', 'n' };
+    static constexpr char32_t s_0_13[2] = { 'e', 'r' };
+    static constexpr char32_t s_0_14[5] = { 'h', 'e', 'd', 'e', 'r' };
+    static constexpr char32_t s_0_15[4] = { 'e', 'r', 'e', 'r' };
+    static constexpr char32_t s_0_16[1] = { 's' };
+    static constexpr char32_t s_0_17[4] = { 'h', 'e', 'd', 's' };
+    static constexpr char32_t s_0_18[2] = { 'e', 's' };
+    static constexpr char32_t s_0_19[5] = { 'e', 'n', 'd', 'e', 's' };
+    static constexpr char32_t s_0_20[7] = { 'e', 'r', 'e', 'n', 'd', 'e', 's' };
+    static constexpr char32_t s_0_21[4] = { 'e', 'n', 'e', 's' };
+    static constexpr char32_t s_0_22[5] = { 'e', 'r', 'n', 'e', 's' };
+    static constexpr char32_t s_0_23[4] = { 'e', 'r', 'e', 's' };
+    static constexpr char32_t s_0_24[3] = { 'e', 'n', 's' };
+    static constexpr char32_t s_0_25[6] = { 'h', 'e', 'd', 'e', 'n', 's' };
+    static constexpr char32_t s_0_26[5] = { 'e', 'r', 'e', 'n', 's' };
+    static constexpr char32_t s_0_27[3] = { 'e', 'r', 's' };
+    static constexpr char32_t s_0_28[3] = { 'e', 't', 's' };
+    static constexpr char32_t s_0_29[5] = { 'e', 'r', 'e', 't', 's' };
+    static constexpr char32_t s_0_30[2] = { 'e', 't' };
+    static constexpr char32_t s_0_31[4] = { 'e', 'r', 'e', 't' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 3, s_0_0, -1, 1, 0 },
+    /*  1 */ { 5, s_0_1, 0, 1, 0 },
+    /*  2 */ { 4, s_0_2, -1, 1, 0 },
+    /*  3 */ { 1, s_0_3, -1, 1, 0 },
+    /*  4 */ { 5, s_0_4, 3, 1, 0 },
+    /*  5 */ { 4, s_0_5, 3, 1, 0 },
+    /*  6 */ { 6, s_0_6, 5, 1, 0 },
+    /*  7 */ { 3, s_0_7, 3, 1, 0 },
+    /*  8 */ { 4, s_0_8, 3, 1, 0 },
+    /*  9 */ { 3, s_0_9, 3, 1, 0 },
+    /* 10 */ { 2, s_0_10, -1, 1, 0 },
+    /* 11 */ { 5, s_0_11, 10, 1, 0 },
+    /* 12 */ { 4, s_0_12, 10, 1, 0 },
+    /* 13 */ { 2, s_0_13, -1, 1, 0 },
+    /* 14 */ { 5, s_0_14, 13, 1, 0 },
+    /* 15 */ { 4, s_0_15, 13, 1, 0 },
+    /* 16 */ { 1, s_0_16, -1, 2, 0 },
+    /* 17 */ { 4, s_0_17, 16, 1, 0 },
+    /* 18 */ { 2, s_0_18, 16, 1, 0 },
+    /* 19 */ { 5, s_0_19, 18, 1, 0 },
+    /* 20 */ { 7, s_0_20, 19, 1, 0 },
+    /* 21 */ { 4, s_0_21, 18, 1, 0 },
+    /* 22 */ { 5, s_0_22, 18, 1, 0 },
+    /* 23 */ { 4, s_0_23, 18, 1, 0 },
+    /* 24 */ { 3, s_0_24, 16, 1, 0 },
+    /* 25 */ { 6, s_0_25, 24, 1, 0 },
+    /* 26 */ { 5, s_0_26, 24, 1, 0 },
+    /* 27 */ { 3, s_0_27, 16, 1, 0 },
+    /* 28 */ { 3, s_0_28, 16, 1, 0 },
+    /* 29 */ { 5, s_0_29, 28, 1, 0 },
+    /* 30 */ { 2, s_0_30, -1, 1, 0 },
+    /* 31 */ { 4, s_0_31, 30, 1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[2] = { 'g', 'd' };
+    static constexpr char32_t s_1_1[2] = { 'd', 't' };
+    static constexpr char32_t s_1_2[2] = { 'g', 't' };
+    static constexpr char32_t s_1_3[2] = { 'k', 't' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 },
+    /*  2 */ { 2, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'i', 'g' };
+    static constexpr char32_t s_2_1[3] = { 'l', 'i', 'g' };
+    static constexpr char32_t s_2_2[4] = { 'e', 'l', 'i', 'g' };
+    static constexpr char32_t s_2_3[3] = { 'e', 'l', 's' };
+    static constexpr char32_t s_2_4[4] = { 'l', 0xF8, 's', 't' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 3, s_2_1, 0, 1, 0 },
+    /*  2 */ { 4, s_2_2, 1, 1, 0 },
+    /*  3 */ { 3, s_2_3, -1, 1, 0 },
+    /*  4 */ { 4, s_2_4, -1, 2, 0 }
+    };
+    static constexpr char32_t s_0[] = { 's', 't' };
+    static constexpr char32_t s_1[] = { 'i', 'g' };
+    static constexpr char32_t s_2[] = { 'l', 0xF8, 's' };
+};
+
+template <typename symbol>
+class danish_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef danish_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 31 */
+        {   int c_test = c; /* test, line 33 */
+            {   int ret = hop(c, 0, l, 3); /* hop, line 33 */
+                if (ret < 0) return false;
+                c = ret;
+            }
+            I_x = c; /* setmark x, line 33 */
+            c = c_test;
+        }
+        if (out_grouping(data::g_v, 97, 248, 1) < 0) return false; /* goto */ /* grouping v, line 34 */
+        {    /* gopast */ /* non v, line 34 */
+            int ret = in_grouping(data::g_v, 97, 248, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p1 = c; /* setmark p1, line 34 */
+         /* try, line 35 */
+        if (!(I_p1 < I_x)) goto lab0; /* $p1 < <integer expression>, line 35 */
+        I_p1 = I_x; /* $p1 = <integer expression>, line 35 */
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_main_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 41 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 41 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 41 */
+            if (c <= lb || p[c - 1] >> 5 != 3 || !((1851440 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 41 */
+            among_var = find_among_b(data::a_0); /* substring, line 41 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 41 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 48 */
+                break;
+            case 2:
+                if (in_grouping_b(data::g_s_ending, 97, 229, 0)) return false; /* grouping s_ending, line 50 */
+                slice_del(); /* delete, line 50 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_consonant_pair() {
+        {   int m_test = l - c; /* test, line 55 */
+            {   int mlimit; /* setlimit, line 56 */
+                int m1 = l - c; (void)m1;
+                if (c < I_p1) return false;
+                c = I_p1; /* tomark, line 56 */
+                mlimit = lb; lb = c;
+                c = l - m1;
+                ket = c; /* [, line 56 */
+                if (c - 1 <= lb || (p[c - 1] != 100 && p[c - 1] != 116)) { lb = mlimit; return false; } /* substring, line 56 */
+                if (!find_among_b(data::a_1)) { lb = mlimit; return false; } /* substring, line 56 */
+                bra = c; /* ], line 56 */
+                lb = mlimit;
+            }
+            c = l - m_test;
+        }
+        {   int ret = hop(c, lb, l, -1); /* next, line 62 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        bra = c; /* ], line 62 */
+        slice_del(); /* delete, line 62 */
+        return true;
+    }
+
+  private:
+    bool r_other_suffix() {
+        int among_var;
+        {   int m1 = l - c; (void)m1; /* do, line 66 */
+            ket = c; /* [, line 66 */
+            if (!eq_s_b(data::s_0)) goto lab0; /* literal, line 66 */
+            bra = c; /* ], line 66 */
+            if (!eq_s_b(data::s_1)) goto lab0; /* literal, line 66 */
+            slice_del(); /* delete, line 66 */
+        lab0:
+            c = l - m1;
+        }
+        {   int mlimit; /* setlimit, line 67 */
+            int m2 = l - c; (void)m2;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 67 */
+            mlimit = lb; lb = c;
+            c = l - m2;
+            ket = c; /* [, line 67 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1572992 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 67 */
+            among_var = find_among_b(data::a_2); /* substring, line 67 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 67 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 70 */
+                {   int m3 = l - c; (void)m3; /* do, line 70 */
+                    if (!r_consonant_pair()) goto lab1; /* call consonant_pair, line 70 */
+                lab1:
+                    c = l - m3;
+                }
+                break;
+            case 2:
+                slice_from(data::s_2); /* <-, line 72 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_undouble() {
+        {   int mlimit; /* setlimit, line 76 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 76 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 76 */
+            if (out_grouping_b(data::g_v, 97, 248, 0)) { lb = mlimit; return false; } /* non v, line 76 */
+            bra = c; /* ], line 76 */
+            slice_to(S_ch); /* -> ch, line 76 */
+            lb = mlimit;
+        }
+        if (!eq_v_b(S_ch)) return false; /* name ch, line 77 */
+        slice_del(); /* delete, line 78 */
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 84 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 84 */
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 85 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 86 */
+            if (!r_main_suffix()) goto lab1; /* call main_suffix, line 86 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 87 */
+            if (!r_consonant_pair()) goto lab2; /* call consonant_pair, line 87 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 88 */
+            if (!r_other_suffix()) goto lab3; /* call other_suffix, line 88 */
+        lab3:
+            c = l - m4;
+        }
+        {   int m5 = l - c; (void)m5; /* do, line 89 */
+            if (!r_undouble()) goto lab4; /* call undouble, line 89 */
+        lab4:
+            c = l - m5;
+        }
+        c = lb;
+        return true;
+    }
+
+  private:
+    int I_x = 0;
+    int I_p1 = 0;
+    std::vector<symbol> S_ch;
+};
+
+}
+
+#endif
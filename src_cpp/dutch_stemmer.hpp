@@ -0,0 +1,641 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_DUTCH_STEMMER_HPP
+#define SNOWBALL_DUTCH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct dutch_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+    static constexpr unsigned char g_v_I[] = { 1, 0, 0, 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+    static constexpr unsigned char g_v_j[] = { 17, 67, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+};
+
+template <bool utf8> struct dutch_stemmer_data;
+
+template <>
+struct dutch_stemmer_data<true> : dutch_stemmer_groupings {
+    static constexpr unsigned char s_0_1[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_0_2[2] = { 0xC3, 0xA4 };
+    static constexpr unsigned char s_0_3[2] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_0_4[2] = { 0xC3, 0xAB };
+    static constexpr unsigned char s_0_5[2] = { 0xC3, 0xAD };
+    static constexpr unsigned char s_0_6[2] = { 0xC3, 0xAF };
+    static constexpr unsigned char s_0_7[2] = { 0xC3, 0xB3 };
+    static constexpr unsigned char s_0_8[2] = { 0xC3, 0xB6 };
+    static constexpr unsigned char s_0_9[2] = { 0xC3, 0xBA };
+    static constexpr unsigned char s_0_10[2] = { 0xC3, 0xBC };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 6, 0 },
+    /*  1 */ { 2, s_0_1, 0, 1, 0 },
+    /*  2 */ { 2, s_0_2, 0, 1, 0 },
+    /*  3 */ { 2, s_0_3, 0, 2, 0 },
+    /*  4 */ { 2, s_0_4, 0, 2, 0 },
+    /*  5 */ { 2, s_0_5, 0, 3, 0 },
+    /*  6 */ { 2, s_0_6, 0, 3, 0 },
+    /*  7 */ { 2, s_0_7, 0, 4, 0 },
+    /*  8 */ { 2, s_0_8, 0, 4, 0 },
+    /*  9 */ { 2, s_0_9, 0, 5, 0 },
+    /* 10 */ { 2, s_0_10, 0, 5, 0 }
+    };
+
+    static constexpr unsigned char s_1_1[1] = { 'I' };
+    static constexpr unsigned char s_1_2[1] = { 'Y' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_1_1, 0, 2, 0 },
+    /*  2 */ { 1, s_1_2, 0, 1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'd', 'd' };
+    static constexpr unsigned char s_2_1[2] = { 'k', 'k' };
+    static constexpr unsigned char s_2_2[2] = { 't', 't' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[3] = { 'e', 'n', 'e' };
+    static constexpr unsigned char s_3_1[2] = { 's', 'e' };
+    static constexpr unsigned char s_3_2[2] = { 'e', 'n' };
+    static constexpr unsigned char s_3_3[5] = { 'h', 'e', 'd', 'e', 'n' };
+    static constexpr unsigned char s_3_4[1] = { 's' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 3, s_3_0, -1, 2, 0 },
+    /*  1 */ { 2, s_3_1, -1, 3, 0 },
+    /*  2 */ { 2, s_3_2, -1, 2, 0 },
+    /*  3 */ { 5, s_3_3, 2, 1, 0 },
+    /*  4 */ { 1, s_3_4, -1, 3, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[3] = { 'e', 'n', 'd' };
+    static constexpr unsigned char s_4_1[2] = { 'i', 'g' };
+    static constexpr unsigned char s_4_2[3] = { 'i', 'n', 'g' };
+    static constexpr unsigned char s_4_3[4] = { 'l', 'i', 'j', 'k' };
+    static constexpr unsigned char s_4_4[4] = { 'b', 'a', 'a', 'r' };
+    static constexpr unsigned char s_4_5[3] = { 'b', 'a', 'r' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 3, s_4_0, -1, 1, 0 },
+    /*  1 */ { 2, s_4_1, -1, 2, 0 },
+    /*  2 */ { 3, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 3, 0 },
+    /*  4 */ { 4, s_4_4, -1, 4, 0 },
+    /*  5 */ { 3, s_4_5, -1, 5, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 'a', 'a' };
+    static constexpr unsigned char s_5_1[2] = { 'e', 'e' };
+    static constexpr unsigned char s_5_2[2] = { 'o', 'o' };
+    static constexpr unsigned char s_5_3[2] = { 'u', 'u' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, -1, 0 },
+    /*  1 */ { 2, s_5_1, -1, -1, 0 },
+    /*  2 */ { 2, s_5_2, -1, -1, 0 },
+    /*  3 */ { 2, s_5_3, -1, -1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'a' };
+    static constexpr unsigned char s_1[] = { 'e' };
+    static constexpr unsigned char s_2[] = { 'i' };
+    static constexpr unsigned char s_3[] = { 'o' };
+    static constexpr unsigned char s_4[] = { 'u' };
+    static constexpr unsigned char s_5[] = { 'y' };
+    static constexpr unsigned char s_6[] = { 'Y' };
+    static constexpr unsigned char s_7[] = { 'i' };
+    static constexpr unsigned char s_8[] = { 'I' };
+    static constexpr unsigned char s_9[] = { 'y' };
+    static constexpr unsigned char s_10[] = { 'Y' };
+    static constexpr unsigned char s_11[] = { 'y' };
+    static constexpr unsigned char s_12[] = { 'i' };
+    static constexpr unsigned char s_13[] = { 'e' };
+    static constexpr unsigned char s_14[] = { 'g', 'e', 'm' };
+    static constexpr unsigned char s_15[] = { 'h', 'e', 'i', 'd' };
+    static constexpr unsigned char s_16[] = { 'h', 'e', 'i', 'd' };
+    static constexpr unsigned char s_17[] = { 'c' };
+    static constexpr unsigned char s_18[] = { 'e', 'n' };
+    static constexpr unsigned char s_19[] = { 'i', 'g' };
+    static constexpr unsigned char s_20[] = { 'e' };
+    static constexpr unsigned char s_21[] = { 'e' };
+};
+
+template <>
+struct dutch_stemmer_data<false> : dutch_stemmer_groupings {
+    static constexpr char32_t s_0_1[1] = { 0xE1 };
+    static constexpr char32_t s_0_2[1] = { 0xE4 };
+    static constexpr char32_t s_0_3[1] = { 0xE9 };
+    static constexpr char32_t s_0_4[1] = { 0xEB };
+    static constexpr char32_t s_0_5[1] = { 0xED };
+    static constexpr char32_t s_0_6[1] = { 0xEF };
+    static constexpr char32_t s_0_7[1] = { 0xF3 };
+    static constexpr char32_t s_0_8[1] = { 0xF6 };
+    static constexpr char32_t s_0_9[1] = { 0xFA };
+    static constexpr char32_t s_0_10[1] = { 0xFC };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 6, 0 },
+    /*  1 */ { 1, s_0_1, 0, 1, 0 },
+    /*  2 */ { 1, s_0_2, 0, 1, 0 },
+    /*  3 */ { 1, s_0_3, 0, 2, 0 },
+    /*  4 */ { 1, s_0_4, 0, 2, 0 },
+    /*  5 */ { 1, s_0_5, 0, 3, 0 },
+    /*  6 */ { 1, s_0_6, 0, 3, 0 },
+    /*  7 */ { 1, s_0_7, 0, 4, 0 },
+    /*  8 */ { 1, s_0_8, 0, 4, 0 },
+    /*  9 */ { 1, s_0_9, 0, 5, 0 },
+    /* 10 */ { 1, s_0_10, 0, 5, 0 }
+    };
+
+    static constexpr char32_t s_1_1[1] = { 'I' };
+    static constexpr char32_t s_1_2[1] = { 'Y' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_1_1, 0, 2, 0 },
+    /*  2 */ { 1, s_1_2, 0, 1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'd', 'd' };
+    static constexpr char32_t s_2_1[2] = { 'k', 'k' };
+    static constexpr char32_t s_2_2[2] = { 't', 't' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[3] = { 'e', 'n', 'e' };
+    static constexpr char32_t s_3_1[2] = { 's', 'e' };
+    static constexpr char32_t s_3_2[2] = { 'e', 'n' };
+    static constexpr char32_t s_3_3[5] = { 'h', 'e', 'd', 'e', 'n' };
+    static constexpr char32_t s_3_4[1] = { 's' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 3, s_3_0, -1, 2, 0 },
+    /*  1 */ { 2, s_3_1, -1, 3, 0 },
+    /*  2 */ { 2, s_3_2, -1, 2, 0 },
+    /*  3 */ { 5, s_3_3, 2, 1, 0 },
+    /*  4 */ { 1, s_3_4, -1, 3, 0 }
+    };
+
+    static constexpr char32_t s_4_0[3] = { 'e', 'n', 'd' };
+    static constexpr char32_t s_4_1[2] = { 'i', 'g' };
+    static constexpr char32_t s_4_2[3] = { 'i', 'n', 'g' };
+    static constexpr char32_t s_4_3[4] = { 'l', 'i', 'j', 'k' };
+    static constexpr char32_t s_4_4[4] = { 'b', 'a', 'a', 'r' };
+    static constexpr char32_t s_4_5[3] = { 'b', 'a', 'r' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 3, s_4_0, -1, 1, 0 },
+    /*  1 */ { 2, s_4_1, -1, 2, 0 },
+    /*  2 */ { 3, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 3, 0 },
+    /*  4 */ { 4, s_4_4, -1, 4, 0 },
+    /*  5 */ { 3, s_4_5, -1, 5, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 'a', 'a' };
+    static constexpr char32_t s_5_1[2] = { 'e', 'e' };
+    static constexpr char32_t s_5_2[2] = { 'o', 'o' };
+    static constexpr char32_t s_5_3[2] = { 'u', 'u' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, -1, 0 },
+    /*  1 */ { 2, s_5_1, -1, -1, 0 },
+    /*  2 */ { 2, s_5_2, -1, -1, 0 },
+    /*  3 */ { 2, s_5_3, -1, -1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'a' };
+    static constexpr char32_t s_1[] = { 'e' };
+    static constexpr char32_t s_2[] = { 'i' };
+    static constexpr char32_t s_3[] = { 'o' };
+    static constexpr char32_t s_4[] = { 'u' };
+    static constexpr char32_t s_5[] = { 'y' };
+    static constexpr char32_t s_6[] = { 'Y' };
+    static constexpr char32_t s_7[] = { 'i' };
+    static constexpr char32_t s_8[] = { 'I' };
+    static constexpr char32_t s_9[] = { 'y' };
+    static constexpr char32_t s_10[] = { 'Y' };
+    static constexpr char32_t s_11[] = { 'y' };
+    static constexpr char32_t s_12[] = { 'i' };
+    static constexpr char32_t s_13[] = { 'e' };
+    static constexpr char32_t s_14[] = { 'g', 'e', 'm' };
+    static constexpr char32_t s_15[] = { 'h', 'e', 'i', 'd' };
+    static constexpr char32_t s_16[] = { 'h', 'e', 'i', 'd' };
+    static constexpr char32_t s_17[] = { 'c' };
+    static constexpr char32_t s_18[] = { 'e', 'n' };
+    static constexpr char32_t s_19[] = { 'i', 'g' };
+    static constexpr char32_t s_20[] = { 'e' };
+    static constexpr char32_t s_21[] = { 'e' };
+};
+
+template <typename symbol>
+class dutch_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef dutch_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        int among_var;
+        {   int c_test = c; /* test, line 42 */
+            while(1) { /* repeat, line 42 */
+                int c1 = c;
+                bra = c; /* [, line 43 */
+                among_var = find_among(data::a_0); /* substring, line 43 */
+                if (!among_var) goto lab0;
+                ket = c; /* ], line 43 */
+                switch(among_var) {
+                    case 0: goto lab0;
+                    case 1:
+                        slice_from(data::s_0); /* <-, line 45 */
+                        break;
+                    case 2:
+                        slice_from(data::s_1); /* <-, line 47 */
+                        break;
+                    case 3:
+                        slice_from(data::s_2); /* <-, line 49 */
+                        break;
+                    case 4:
+                        slice_from(data::s_3); /* <-, line 51 */
+                        break;
+                    case 5:
+                        slice_from(data::s_4); /* <-, line 53 */
+                        break;
+                    case 6:
+                        {   int ret = hop(c, 0, l, 1); /* next, line 54 */
+                            if (ret < 0) goto lab0;
+                            c = ret;
+                        }
+                        break;
+                }
+                continue;
+            lab0:
+                c = c1;
+                break;
+            }
+            c = c_test;
+        }
+        {   int c_keep = c; /* try, line 57 */
+            bra = c; /* [, line 57 */
+            if (!eq_s(data::s_5)) { c = c_keep; goto lab1; } /* literal, line 57 */
+            ket = c; /* ], line 57 */
+            slice_from(data::s_6); /* <-, line 57 */
+        lab1:
+            ;
+        }
+        while(1) { /* repeat, line 58 */
+            int c2 = c;
+            while(1) { /* goto, line 58 */
+                int c3 = c;
+                if (in_grouping(data::g_v, 97, 232, 0)) goto lab3; /* grouping v, line 59 */
+                bra = c; /* [, line 59 */
+                {   int c4 = c; /* or, line 59 */
+                    if (!eq_s(data::s_7)) goto lab5; /* literal, line 59 */
+                    ket = c; /* ], line 59 */
+                    if (in_grouping(data::g_v, 97, 232, 0)) goto lab5; /* grouping v, line 59 */
+                    slice_from(data::s_8); /* <-, line 59 */
+                    goto lab4;
+                lab5:
+                    c = c4;
+                    if (!eq_s(data::s_9)) goto lab3; /* literal, line 60 */
+                    ket = c; /* ], line 60 */
+                    slice_from(data::s_10); /* <-, line 60 */
+                }
+            lab4:
+                c = c3;
+                break;
+            lab3:
+                c = c3;
+                {   int ret = hop(c, 0, l, 1); /* goto, line 58 */
+                    if (ret < 0) goto lab2;
+                    c = ret;
+                }
+            }
+            continue;
+        lab2:
+            c = c2;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 66 */
+        I_p2 = l; /* $p2 = <integer expression>, line 67 */
+        {    /* gopast */ /* grouping v, line 69 */
+            int ret = out_grouping(data::g_v, 97, 232, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        {    /* gopast */ /* non v, line 69 */
+            int ret = in_grouping(data::g_v, 97, 232, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p1 = c; /* setmark p1, line 69 */
+         /* try, line 70 */
+        if (!(I_p1 < 3)) goto lab0; /* $p1 < <integer expression>, line 70 */
+        I_p1 = 3; /* $p1 = <integer expression>, line 70 */
+    lab0:
+        {    /* gopast */ /* grouping v, line 71 */
+            int ret = out_grouping(data::g_v, 97, 232, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        {    /* gopast */ /* non v, line 71 */
+            int ret = in_grouping(data::g_v, 97, 232, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p2 = c; /* setmark p2, line 71 */
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 75 */
+            int c1 = c;
+            bra = c; /* [, line 77 */
+            if (c >= l || (p[c] != 73 && p[c] != 89)) among_var = 3; else /* substring, line 77 */
+            among_var = find_among(data::a_1); /* substring, line 77 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 77 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_11); /* <-, line 78 */
+                    break;
+                case 2:
+                    slice_from(data::s_12); /* <-, line 79 */
+                    break;
+                case 3:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 80 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 87 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 88 */
+        return true;
+    }
+
+  private:
+    bool r_undouble() {
+        {   int m_test = l - c; /* test, line 91 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1050640 >> (p[c - 1] & 0x1f)) & 1)) return false; /* among, line 91 */
+            if (!find_among_b(data::a_2)) return false; /* among, line 91 */
+            c = l - m_test;
+        }
+        ket = c; /* [, line 91 */
+        {   int ret = hop(c, lb, l, -1); /* next, line 91 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        bra = c; /* ], line 91 */
+        slice_del(); /* delete, line 91 */
+        return true;
+    }
+
+  private:
+    bool r_e_ending() {
+        B_e_found = false; /* unset e_found, line 95 */
+        ket = c; /* [, line 96 */
+        if (!eq_s_b(data::s_13)) return false; /* literal, line 96 */
+        bra = c; /* ], line 96 */
+        if (!r_R1()) return false; /* call R1, line 96 */
+        {   int m_test = l - c; /* test, line 96 */
+            if (out_grouping_b(data::g_v, 97, 232, 0)) return false; /* non v, line 96 */
+            c = l - m_test;
+        }
+        slice_del(); /* delete, line 96 */
+        B_e_found = true; /* set e_found, line 97 */
+        if (!r_undouble()) return false; /* call undouble, line 98 */
+        return true;
+    }
+
+  private:
+    bool r_en_ending() {
+        if (!r_R1()) return false; /* call R1, line 102 */
+        {   int m1 = l - c; (void)m1; /* and, line 102 */
+            if (out_grouping_b(data::g_v, 97, 232, 0)) return false; /* non v, line 102 */
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* not, line 102 */
+                if (!eq_s_b(data::s_14)) goto lab0; /* literal, line 102 */
+                return false;
+            lab0:
+                c = l - m2;
+            }
+        }
+        slice_del(); /* delete, line 102 */
+        if (!r_undouble()) return false; /* call undouble, line 103 */
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        {   int m1 = l - c; (void)m1; /* do, line 107 */
+            ket = c; /* [, line 108 */
+            if (c <= lb || p[c - 1] >> 5 != 3 || !((540704 >> (p[c - 1] & 0x1f)) & 1)) goto lab0; /* substring, line 108 */
+            among_var = find_among_b(data::a_3); /* substring, line 108 */
+            if (!among_var) goto lab0;
+            bra = c; /* ], line 108 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    if (!r_R1()) goto lab0; /* call R1, line 110 */
+                    slice_from(data::s_15); /* <-, line 110 */
+                    break;
+                case 2:
+                    if (!r_en_ending()) goto lab0; /* call en_ending, line 113 */
+                    break;
+                case 3:
+                    if (!r_R1()) goto lab0; /* call R1, line 116 */
+                    if (out_grouping_b(data::g_v_j, 97, 232, 0)) goto lab0; /* non v_j, line 116 */
+                    slice_del(); /* delete, line 116 */
+                    break;
+            }
+        lab0:
+            c = l - m1;
+        }
+        {   int m2 = l - c; (void)m2; /* do, line 120 */
+            if (!r_e_ending()) goto lab1; /* call e_ending, line 120 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 122 */
+            ket = c; /* [, line 122 */
+            if (!eq_s_b(data::s_16)) goto lab2; /* literal, line 122 */
+            bra = c; /* ], line 122 */
+            if (!r_R2()) goto lab2; /* call R2, line 122 */
+            {   int m4 = l - c; (void)m4; /* not, line 122 */
+                if (!eq_s_b(data::s_17)) goto lab3; /* literal, line 122 */
+                goto lab2;
+            lab3:
+                c = l - m4;
+            }
+            slice_del(); /* delete, line 122 */
+            ket = c; /* [, line 123 */
+            if (!eq_s_b(data::s_18)) goto lab2; /* literal, line 123 */
+            bra = c; /* ], line 123 */
+            if (!r_en_ending()) goto lab2; /* call en_ending, line 123 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m5 = l - c; (void)m5; /* do, line 126 */
+            ket = c; /* [, line 127 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((264336 >> (p[c - 1] & 0x1f)) & 1)) goto lab4; /* substring, line 127 */
+            among_var = find_among_b(data::a_4); /* substring, line 127 */
+            if (!among_var) goto lab4;
+            bra = c; /* ], line 127 */
+            switch(among_var) {
+                case 0: goto lab4;
+                case 1:
+                    if (!r_R2()) goto lab4; /* call R2, line 129 */
+                    slice_del(); /* delete, line 129 */
+                    {   int m6 = l - c; (void)m6; /* or, line 130 */
+                        ket = c; /* [, line 130 */
+                        if (!eq_s_b(data::s_19)) goto lab6; /* literal, line 130 */
+                        bra = c; /* ], line 130 */
+                        if (!r_R2()) goto lab6; /* call R2, line 130 */
+                        {   int m7 = l - c; (void)m7; /* not, line 130 */
+                            if (!eq_s_b(data::s_20)) goto lab7; /* literal, line 130 */
+                            goto lab6;
+                        lab7:
+                            c = l - m7;
+                        }
+                        slice_del(); /* delete, line 130 */
+                        goto lab5;
+                    lab6:
+                        c = l - m6;
+                        if (!r_undouble()) goto lab4; /* call undouble, line 130 */
+                    }
+                lab5:
+                    break;
+                case 2:
+                    if (!r_R2()) goto lab4; /* call R2, line 133 */
+                    {   int m8 = l - c; (void)m8; /* not, line 133 */
+                        if (!eq_s_b(data::s_21)) goto lab8; /* literal, line 133 */
+                        goto lab4;
+                    lab8:
+                        c = l - m8;
+                    }
+                    slice_del(); /* delete, line 133 */
+                    break;
+                case 3:
+                    if (!r_R2()) goto lab4; /* call R2, line 136 */
+                    slice_del(); /* delete, line 136 */
+                    if (!r_e_ending()) goto lab4; /* call e_ending, line 136 */
+                    break;
+                case 4:
+                    if (!r_R2()) goto lab4; /* call R2, line 139 */
+                    slice_del(); /* delete, line 139 */
+                    break;
+                case 5:
+                    if (!r_R2()) goto lab4; /* call R2, line 142 */
+                    if (!B_e_found) goto lab4; /* Boolean test e_found, line 142 */
+                    slice_del(); /* delete, line 142 */
+                    break;
+            }
+        lab4:
+            c = l - m5;
+        }
+        {   int m9 = l - c; (void)m9; /* do, line 146 */
+            if (out_grouping_b(data::g_v_I, 73, 232, 0)) goto lab9; /* non v_I, line 147 */
+            {   int m_test = l - c; /* test, line 148 */
+                if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((2129954 >> (p[c - 1] & 0x1f)) & 1)) goto lab9; /* among, line 149 */
+                if (!find_among_b(data::a_5)) goto lab9; /* among, line 149 */
+                if (out_grouping_b(data::g_v, 97, 232, 0)) goto lab9; /* non v, line 150 */
+                c = l - m_test;
+            }
+            ket = c; /* [, line 152 */
+            {   int ret = hop(c, lb, l, -1); /* next, line 152 */
+                if (ret < 0) goto lab9;
+                c = ret;
+            }
+            bra = c; /* ], line 152 */
+            slice_del(); /* delete, line 152 */
+        lab9:
+            c = l - m9;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 159 */
+            if (!r_prelude()) goto lab0; /* call prelude, line 159 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 160 */
+            if (!r_mark_regions()) goto lab1; /* call mark_regions, line 160 */
+        lab1:
+            c = c2;
+        }
+        lb = c; c = l; /* backwards, line 161 */
+
+        {   int m3 = l - c; (void)m3; /* do, line 162 */
+            if (!r_standard_suffix()) goto lab2; /* call standard_suffix, line 162 */
+        lab2:
+            c = l - m3;
+        }
+        c = lb;
+        {   int c4 = c; /* do, line 163 */
+            if (!r_postlude()) goto lab3; /* call postlude, line 163 */
+        lab3:
+            c = c4;
+        }
+        return true;
+    }
+
+  private:
+    int I_p2 = 0;
+    int I_p1 = 0;
+    bool B_e_found = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,1275 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_ENGLISH_STEMMER_HPP
+#define SNOWBALL_ENGLISH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct english_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1 };
+    static constexpr unsigned char g_v_WXY[] = { 1, 17, 65, 208, 1 };
+    static constexpr unsigned char g_valid_LI[] = { 55, 141, 2 };
+};
+
+template <bool utf8> struct english_stemmer_data;
+
+template <>
+struct english_stemmer_data<true> : english_stemmer_groupings {
+    static constexpr unsigned char s_0_0[5] = { 'a', 'r', 's', 'e', 'n' };
+    static constexpr unsigned char s_0_1[6] = { 'c', 'o', 'm', 'm', 'u', 'n' };
+    static constexpr unsigned char s_0_2[5] = { 'g', 'e', 'n', 'e', 'r' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 5, s_0_0, -1, -1, 0 },
+    /*  1 */ { 6, s_0_1, -1, -1, 0 },
+    /*  2 */ { 5, s_0_2, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[1] = { '\'' };
+    static constexpr unsigned char s_1_1[3] = { '\'', 's', '\'' };
+    static constexpr unsigned char s_1_2[2] = { '\'', 's' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 1, s_1_0, -1, 1, 0 },
+    /*  1 */ { 3, s_1_1, 0, 1, 0 },
+    /*  2 */ { 2, s_1_2, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[3] = { 'i', 'e', 'd' };
+    static constexpr unsigned char s_2_1[1] = { 's' };
+    static constexpr unsigned char s_2_2[3] = { 'i', 'e', 's' };
+    static constexpr unsigned char s_2_3[4] = { 's', 's', 'e', 's' };
+    static constexpr unsigned char s_2_4[2] = { 's', 's' };
+    static constexpr unsigned char s_2_5[2] = { 'u', 's' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, 2, 0 },
+    /*  1 */ { 1, s_2_1, -1, 3, 0 },
+    /*  2 */ { 3, s_2_2, 1, 2, 0 },
+    /*  3 */ { 4, s_2_3, 1, 1, 0 },
+    /*  4 */ { 2, s_2_4, 1, -1, 0 },
+    /*  5 */ { 2, s_2_5, 1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_3_1[2] = { 'b', 'b' };
+    static constexpr unsigned char s_3_2[2] = { 'd', 'd' };
+    static constexpr unsigned char s_3_3[2] = { 'f', 'f' };
+    static constexpr unsigned char s_3_4[2] = { 'g', 'g' };
+    static constexpr unsigned char s_3_5[2] = { 'b', 'l' };
+    static constexpr unsigned char s_3_6[2] = { 'm', 'm' };
+    static constexpr unsigned char s_3_7[2] = { 'n', 'n' };
+    static constexpr unsigned char s_3_8[2] = { 'p', 'p' };
+    static constexpr unsigned char s_3_9[2] = { 'r', 'r' };
+    static constexpr unsigned char s_3_10[2] = { 'a', 't' };
+    static constexpr unsigned char s_3_11[2] = { 't', 't' };
+    static constexpr unsigned char s_3_12[2] = { 'i', 'z' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_3_1, 0, 2, 0 },
+    /*  2 */ { 2, s_3_2, 0, 2, 0 },
+    /*  3 */ { 2, s_3_3, 0, 2, 0 },
+    /*  4 */ { 2, s_3_4, 0, 2, 0 },
+    /*  5 */ { 2, s_3_5, 0, 1, 0 },
+    /*  6 */ { 2, s_3_6, 0, 2, 0 },
+    /*  7 */ { 2, s_3_7, 0, 2, 0 },
+    /*  8 */ { 2, s_3_8, 0, 2, 0 },
+    /*  9 */ { 2, s_3_9, 0, 2, 0 },
+    /* 10 */ { 2, s_3_10, 0, 1, 0 },
+    /* 11 */ { 2, s_3_11, 0, 2, 0 },
+    /* 12 */ { 2, s_3_12, 0, 1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[2] = { 'e', 'd' };
+    static constexpr unsigned char s_4_1[3] = { 'e', 'e', 'd' };
+    static constexpr unsigned char s_4_2[3] = { 'i', 'n', 'g' };
+    static constexpr unsigned char s_4_3[4] = { 'e', 'd', 'l', 'y' };
+    static constexpr unsigned char s_4_4[5] = { 'e', 'e', 'd', 'l', 'y' };
+    static constexpr unsigned char s_4_5[5] = { 'i', 'n', 'g', 'l', 'y' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 2, 0 },
+    /*  1 */ { 3, s_4_1, 0, 1, 0 },
+    /*  2 */ { 3, s_4_2, -1, 2, 0 },
+    /*  3 */ { 4, s_4_3, -1, 2, 0 },
+    /*  4 */ { 5, s_4_4, 3, 1, 0 },
+    /*  5 */ { 5, s_4_5, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[4] = { 'a', 'n', 'c', 'i' };
+    static constexpr unsigned char s_5_1[4] = { 'e', 'n', 'c', 'i' };
+    static constexpr unsigned char s_5_2[3] = { 'o', 'g', 'i' };
+    static constexpr unsigned char s_5_3[2] = { 'l', 'i' };
+    static constexpr unsigned char s_5_4[3] = { 'b', 'l', 'i' };
+    static constexpr unsigned char s_5_5[4] = { 'a', 'b', 'l', 'i' };
+    static constexpr unsigned char s_5_6[4] = { 'a', 'l', 'l', 'i' };
+    static constexpr unsigned char s_5_7[5] = { 'f', 'u', 'l', 'l', 'i' };
+    static constexpr unsigned char s_5_8[6] = { 'l', 'e', 's', 's', 'l', 'i' };
+    static constexpr unsigned char s_5_9[5] = { 'o', 'u', 's', 'l', 'i' };
+    static constexpr unsigned char s_5_10[5] = { 'e', 'n', 't', 'l', 'i' };
+    static constexpr unsigned char s_5_11[5] = { 'a', 'l', 'i', 't', 'i' };
+    static constexpr unsigned char s_5_12[6] = { 'b', 'i', 'l', 'i', 't', 'i' };
+    static constexpr unsigned char s_5_13[5] = { 'i', 'v', 'i', 't', 'i' };
+    static constexpr unsigned char s_5_14[6] = { 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr unsigned char s_5_15[7] = { 'a', 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr unsigned char s_5_16[5] = { 'a', 'l', 'i', 's', 'm' };
+    static constexpr unsigned char s_5_17[5] = { 'a', 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_5_18[7] = { 'i', 'z', 'a', 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_5_19[4] = { 'i', 'z', 'e', 'r' };
+    static constexpr unsigned char s_5_20[4] = { 'a', 't', 'o', 'r' };
+    static constexpr unsigned char s_5_21[7] = { 'i', 'v', 'e', 'n', 'e', 's', 's' };
+    static constexpr unsigned char s_5_22[7] = { 'f', 'u', 'l', 'n', 'e', 's', 's' };
+    static constexpr unsigned char s_5_23[7] = { 'o', 'u', 's', 'n', 'e', 's', 's' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 4, s_5_0, -1, 3, 0 },
+    /*  1 */ { 4, s_5_1, -1, 2, 0 },
+    /*  2 */ { 3, s_5_2, -1, 13, 0 },
+    /*  3 */ { 2, s_5_3, -1, 16, 0 },
+    /*  4 */ { 3, s_5_4, 3, 12, 0 },
+    /*  5 */ { 4, s_5_5, 4, 4, 0 },
+    /*  6 */ { 4, s_5_6, 3, 8, 0 },
+    /*  7 */ { 5, s_5_7, 3, 14, 0 },
+    /*  8 */ { 6, s_5_8, 3, 15, 0 },
+    /*  9 */ { 5, s_5_9, 3, 10, 0 },
+    /* 10 */ { 5, s_5_10, 3, 5, 0 },
+    /* 11 */ { 5, s_5_11, -1, 8, 0 },
+    /* 12 */ { 6, s_5_12, -1, 12, 0 },
+    /* 13 */ { 5, s_5_13, -1, 11, 0 },
+    /* 14 */ { 6, s_5_14, -1, 1, 0 },
+    /* 15 */ { 7, s_5_15, 14, 7, 0 },
+    /* 16 */ { 5, s_5_16, -1, 8, 0 },
+    /* 17 */ { 5, s_5_17, -1, 7, 0 },
+    /* 18 */ { 7, s_5_18, 17, 6, 0 },
+    /* 19 */ { 4, s_5_19, -1, 6, 0 },
+    /* 20 */ { 4, s_5_20, -1, 7, 0 },
+    /* 21 */ { 7, s_5_21, -1, 11, 0 },
+    /* 22 */ { 7, s_5_22, -1, 9, 0 },
+    /* 23 */ { 7, s_5_23, -1, 10, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[5] = { 'i', 'c', 'a', 't', 'e' };
+    static constexpr unsigned char s_6_1[5] = { 'a', 't', 'i', 'v', 'e' };
+    static constexpr unsigned char s_6_2[5] = { 'a', 'l', 'i', 'z', 'e' };
+    static constexpr unsigned char s_6_3[5] = { 'i', 'c', 'i', 't', 'i' };
+    static constexpr unsigned char s_6_4[4] = { 'i', 'c', 'a', 'l' };
+    static constexpr unsigned char s_6_5[6] = { 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr unsigned char s_6_6[7] = { 'a', 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr unsigned char s_6_7[3] = { 'f', 'u', 'l' };
+    static constexpr unsigned char s_6_8[4] = { 'n', 'e', 's', 's' };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 5, s_6_0, -1, 4, 0 },
+    /*  1 */ { 5, s_6_1, -1, 6, 0 },
+    /*  2 */ { 5, s_6_2, -1, 3, 0 },
+    /*  3 */ { 5, s_6_3, -1, 4, 0 },
+    /*  4 */ { 4, s_6_4, -1, 4, 0 },
+    /*  5 */ { 6, s_6_5, -1, 1, 0 },
+    /*  6 */ { 7, s_6_6, 5, 2, 0 },
+    /*  7 */ { 3, s_6_7, -1, 5, 0 },
+    /*  8 */ { 4, s_6_8, -1, 5, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_7_1[4] = { 'a', 'n', 'c', 'e' };
+    static constexpr unsigned char s_7_2[4] = { 'e', 'n', 'c', 'e' };
+    static constexpr unsigned char s_7_3[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_7_4[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr unsigned char s_7_5[3] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_7_6[3] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_7_7[3] = { 'i', 'z', 'e' };
+    static constexpr unsigned char s_7_8[3] = { 'i', 't', 'i' };
+    static constexpr unsigned char s_7_9[2] = { 'a', 'l' };
+    static constexpr unsigned char s_7_10[3] = { 'i', 's', 'm' };
+    static constexpr unsigned char s_7_11[3] = { 'i', 'o', 'n' };
+    static constexpr unsigned char s_7_12[2] = { 'e', 'r' };
+    static constexpr unsigned char s_7_13[3] = { 'o', 'u', 's' };
+    static constexpr unsigned char s_7_14[3] = { 'a', 'n', 't' };
+    static constexpr unsigned char s_7_15[3] = { 'e', 'n', 't' };
+    static constexpr unsigned char s_7_16[4] = { 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_7_17[5] = { 'e', 'm', 'e', 'n', 't' };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 2, s_7_0, -1, 1, 0 },
+    /*  1 */ { 4, s_7_1, -1, 1, 0 },
+    /*  2 */ { 4, s_7_2, -1, 1, 0 },
+    /*  3 */ { 4, s_7_3, -1, 1, 0 },
+    /*  4 */ { 4, s_7_4, -1, 1, 0 },
+    /*  5 */ { 3, s_7_5, -1, 1, 0 },
+    /*  6 */ { 3, s_7_6, -1, 1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 3, s_7_8, -1, 1, 0 },
+    /*  9 */ { 2, s_7_9, -1, 1, 0 },
+    /* 10 */ { 3, s_7_10, -1, 1, 0 },
+    /* 11 */ { 3, s_7_11, -1, 2, 0 },
+    /* 12 */ { 2, s_7_12, -1, 1, 0 },
+    /* 13 */ { 3, s_7_13, -1, 1, 0 },
+    /* 14 */ { 3, s_7_14, -1, 1, 0 },
+    /* 15 */ { 3, s_7_15, -1, 1, 0 },
+    /* 16 */ { 4, s_7_16, 15, 1, 0 },
+    /* 17 */ { 5, s_7_17, 16, 1, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[1] = { 'e' };
+    static constexpr unsigned char s_8_1[1] = { 'l' };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, 1, 0 },
+    /*  1 */ { 1, s_8_1, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_9_0[7] = { 's', 'u', 'c', 'c', 'e', 'e', 'd' };
+    static constexpr unsigned char s_9_1[7] = { 'p', 'r', 'o', 'c', 'e', 'e', 'd' };
+    static constexpr unsigned char s_9_2[6] = { 'e', 'x', 'c', 'e', 'e', 'd' };
+    static constexpr unsigned char s_9_3[7] = { 'c', 'a', 'n', 'n', 'i', 'n', 'g' };
+    static constexpr unsigned char s_9_4[6] = { 'i', 'n', 'n', 'i', 'n', 'g' };
+    static constexpr unsigned char s_9_5[7] = { 'e', 'a', 'r', 'r', 'i', 'n', 'g' };
+    static constexpr unsigned char s_9_6[7] = { 'h', 'e', 'r', 'r', 'i', 'n', 'g' };
+    static constexpr unsigned char s_9_7[6] = { 'o', 'u', 't', 'i', 'n', 'g' };
+
+    static constexpr among<unsigned char> a_9[] = {
+    /*  0 */ { 7, s_9_0, -1, -1, 0 },
+    /*  1 */ { 7, s_9_1, -1, -1, 0 },
+    /*  2 */ { 6, s_9_2, -1, -1, 0 },
+    /*  3 */ { 7, s_9_3, -1, -1, 0 },
+    /*  4 */ { 6, s_9_4, -1, -1, 0 },
+    /*  5 */ { 7, s_9_5, -1, -1, 0 },
+    /*  6 */ { 7, s_9_6, -1, -1, 0 },
+    /*  7 */ { 6, s_9_7, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_10_0[5] = { 'a', 'n', 'd', 'e', 's' };
+    static constexpr unsigned char s_10_1[5] = { 'a', 't', 'l', 'a', 's' };
+    static constexpr unsigned char s_10_2[4] = { 'b', 'i', 'a', 's' };
+    static constexpr unsigned char s_10_3[6] = { 'c', 'o', 's', 'm', 'o', 's' };
+    static constexpr unsigned char s_10_4[5] = { 'd', 'y', 'i', 'n', 'g' };
+    static constexpr unsigned char s_10_5[5] = { 'e', 'a', 'r', 'l', 'y' };
+    static constexpr unsigned char s_10_6[6] = { 'g', 'e', 'n', 't', 'l', 'y' };
+    static constexpr unsigned char s_10_7[4] = { 'h', 'o', 'w', 'e' };
+    static constexpr unsigned char s_10_8[4] = { 'i', 'd', 'l', 'y' };
+    static constexpr unsigned char s_10_9[5] = { 'l', 'y', 'i', 'n', 'g' };
+    static constexpr unsigned char s_10_10[4] = { 'n', 'e', 'w', 's' };
+    static constexpr unsigned char s_10_11[4] = { 'o', 'n', 'l', 'y' };
+    static constexpr unsigned char s_10_12[6] = { 's', 'i', 'n', 'g', 'l', 'y' };
+    static constexpr unsigned char s_10_13[5] = { 's', 'k', 'i', 'e', 's' };
+    static constexpr unsigned char s_10_14[4] = { 's', 'k', 'i', 's' };
+    static constexpr unsigned char s_10_15[3] = { 's', 'k', 'y' };
+    static constexpr unsigned char s_10_16[5] = { 't', 'y', 'i', 'n', 'g' };
+    static constexpr unsigned char s_10_17[4] = { 'u', 'g', 'l', 'y' };
+
+    static constexpr among<unsigned char> a_10[] = {
+    /*  0 */ { 5, s_10_0, -1, -1, 0 },
+    /*  1 */ { 5, s_10_1, -1, -1, 0 },
+    /*  2 */ { 4, s_10_2, -1, -1, 0 },
+    /*  3 */ { 6, s_10_3, -1, -1, 0 },
+    /*  4 */ { 5, s_10_4, -1, 3, 0 },
+    /*  5 */ { 5, s_10_5, -1, 9, 0 },
+    /*  6 */ { 6, s_10_6, -1, 7, 0 },
+    /*  7 */ { 4, s_10_7, -1, -1, 0 },
+    /*  8 */ { 4, s_10_8, -1, 6, 0 },
+    /*  9 */ { 5, s_10_9, -1, 4, 0 },
+    /* 10 */ { 4, s_10_10, -1, -1, 0 },
+    /* 11 */ { 4, s_10_11, -1, 10, 0 },
+    /* 12 */ { 6, s_10_12, -1, 11, 0 },
+    /* 13 */ { 5, s_10_13, -1, 2, 0 },
+    /* 14 */ { 4, s_10_14, -1, 1, 0 },
+    /* 15 */ { 3, s_10_15, -1, -1, 0 },
+    /* 16 */ { 5, s_10_16, -1, 5, 0 },
+    /* 17 */ { 4, s_10_17, -1, 8, 0 }
+    };
+    static constexpr unsigned char s_0[] = { '\'' };
+    static constexpr unsigned char s_1[] = { 'y' };
+    static constexpr unsigned char s_2[] = { 'Y' };
+    static constexpr unsigned char s_3[] = { 'y' };
+    static constexpr unsigned char s_4[] = { 'Y' };
+    static constexpr unsigned char s_5[] = { 's', 's' };
+    static constexpr unsigned char s_6[] = { 'i' };
+    static constexpr unsigned char s_7[] = { 'i', 'e' };
+    static constexpr unsigned char s_8[] = { 'e', 'e' };
+    static constexpr unsigned char s_9[] = { 'e' };
+    static constexpr unsigned char s_10[] = { 'e' };
+    static constexpr unsigned char s_11[] = { 'y' };
+    static constexpr unsigned char s_12[] = { 'Y' };
+    static constexpr unsigned char s_13[] = { 'i' };
+    static constexpr unsigned char s_14[] = { 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_15[] = { 'e', 'n', 'c', 'e' };
+    static constexpr unsigned char s_16[] = { 'a', 'n', 'c', 'e' };
+    static constexpr unsigned char s_17[] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_18[] = { 'e', 'n', 't' };
+    static constexpr unsigned char s_19[] = { 'i', 'z', 'e' };
+    static constexpr unsigned char s_20[] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_21[] = { 'a', 'l' };
+    static constexpr unsigned char s_22[] = { 'f', 'u', 'l' };
+    static constexpr unsigned char s_23[] = { 'o', 'u', 's' };
+    static constexpr unsigned char s_24[] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_25[] = { 'b', 'l', 'e' };
+    static constexpr unsigned char s_26[] = { 'l' };
+    static constexpr unsigned char s_27[] = { 'o', 'g' };
+    static constexpr unsigned char s_28[] = { 'f', 'u', 'l' };
+    static constexpr unsigned char s_29[] = { 'l', 'e', 's', 's' };
+    static constexpr unsigned char s_30[] = { 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_31[] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_32[] = { 'a', 'l' };
+    static constexpr unsigned char s_33[] = { 'i', 'c' };
+    static constexpr unsigned char s_34[] = { 's' };
+    static constexpr unsigned char s_35[] = { 't' };
+    static constexpr unsigned char s_36[] = { 'l' };
+    static constexpr unsigned char s_37[] = { 's', 'k', 'i' };
+    static constexpr unsigned char s_38[] = { 's', 'k', 'y' };
+    static constexpr unsigned char s_39[] = { 'd', 'i', 'e' };
+    static constexpr unsigned char s_40[] = { 'l', 'i', 'e' };
+    static constexpr unsigned char s_41[] = { 't', 'i', 'e' };
+    static constexpr unsigned char s_42[] = { 'i', 'd', 'l' };
+    static constexpr unsigned char s_43[] = { 'g', 'e', 'n', 't', 'l' };
+    static constexpr unsigned char s_44[] = { 'u', 'g', 'l', 'i' };
+    static constexpr unsigned char s_45[] = { 'e', 'a', 'r', 'l', 'i' };
+    static constexpr unsigned char s_46[] = { 'o', 'n', 'l', 'i' };
+    static constexpr unsigned char s_47[] = { 's', 'i', 'n', 'g', 'l' };
+    static constexpr unsigned char s_48[] = { 'Y' };
+    static constexpr unsigned char s_49[] = { 'y' };
+};
+
+template <>
+struct english_stemmer_data<false> : english_stemmer_groupings {
+    static constexpr char32_t s_0_0[5] = { 'a', 'r', 's', 'e', 'n' };
+    static constexpr char32_t s_0_1[6] = { 'c', 'o', 'm', 'm', 'u', 'n' };
+    static constexpr char32_t s_0_2[5] = { 'g', 'e', 'n', 'e', 'r' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 5, s_0_0, -1, -1, 0 },
+    /*  1 */ { 6, s_0_1, -1, -1, 0 },
+    /*  2 */ { 5, s_0_2, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[1] = { '\'' };
+    static constexpr char32_t s_1_1[3] = { '\'', 's', '\'' };
+    static constexpr char32_t s_1_2[2] = { '\'', 's' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 1, s_1_0, -1, 1, 0 },
+    /*  1 */ { 3, s_1_1, 0, 1, 0 },
+    /*  2 */ { 2, s_1_2, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[3] = { 'i', 'e', 'd' };
+    static constexpr char32_t s_2_1[1] = { 's' };
+    static constexpr char32_t s_2_2[3] = { 'i', 'e', 's' };
+    static constexpr char32_t s_2_3[4] = { 's', 's', 'e', 's' };
+    static constexpr char32_t s_2_4[2] = { 's', 's' };
+    static constexpr char32_t s_2_5[2] = { 'u', 's' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, 2, 0 },
+    /*  1 */ { 1, s_2_1, -1, 3, 0 },
+    /*  2 */ { 3, s_2_2, 1, 2, 0 },
+    /*  3 */ { 4, s_2_3, 1, 1, 0 },
+    /*  4 */ { 2, s_2_4, 1, -1, 0 },
+    /*  5 */ { 2, s_2_5, 1, -1, 0 }
+    };
+
+    static constexpr char32_t s_3_1[2] = { 'b', 'b' };
+    static constexpr char32_t s_3_2[2] = { 'd', 'd' };
+    static constexpr char32_t s_3_3[2] = { 'f', 'f' };
+    static constexpr char32_t s_3_4[2] = { 'g', 'g' };
+    static constexpr char32_t s_3_5[2] = { 'b', 'l' };
+    static constexpr char32_t s_3_6[2] = { 'm', 'm' };
+    static constexpr char32_t s_3_7[2] = { 'n', 'n' };
+    static constexpr char32_t s_3_8[2] = { 'p', 'p' };
+    static constexpr char32_t s_3_9[2] = { 'r', 'r' };
+    static constexpr char32_t s_3_10[2] = { 'a', 't' };
+    static constexpr char32_t s_3_11[2] = { 't', 't' };
+    static constexpr char32_t s_3_12[2] = { 'i', 'z' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_3_1, 0, 2, 0 },
+    /*  2 */ { 2, s_3_2, 0, 2, 0 },
+    /*  3 */ { 2, s_3_3, 0, 2, 0 },
+    /*  4 */ { 2, s_3_4, 0, 2, 0 },
+    /*  5 */ { 2, s_3_5, 0, 1, 0 },
+    /*  6 */ { 2, s_3_6, 0, 2, 0 },
+    /*  7 */ { 2, s_3_7, 0, 2, 0 },
+    /*  8 */ { 2, s_3_8, 0, 2, 0 },
+    /*  9 */ { 2, s_3_9, 0, 2, 0 },
+    /* 10 */ { 2, s_3_10, 0, 1, 0 },
+    /* 11 */ { 2, s_3_11, 0, 2, 0 },
+    /* 12 */ { 2, s_3_12, 0, 1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[2] = { 'e', 'd' };
+    static constexpr char32_t s_4_1[3] = { 'e', 'e', 'd' };
+    static constexpr char32_t s_4_2[3] = { 'i', 'n', 'g' };
+    static constexpr char32_t s_4_3[4] = { 'e', 'd', 'l', 'y' };
+    static constexpr char32_t s_4_4[5] = { 'e', 'e', 'd', 'l', 'y' };
+    static constexpr char32_t s_4_5[5] = { 'i', 'n', 'g', 'l', 'y' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 2, 0 },
+    /*  1 */ { 3, s_4_1, 0, 1, 0 },
+    /*  2 */ { 3, s_4_2, -1, 2, 0 },
+    /*  3 */ { 4, s_4_3, -1, 2, 0 },
+    /*  4 */ { 5, s_4_4, 3, 1, 0 },
+    /*  5 */ { 5, s_4_5, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_5_0[4] = { 'a', 'n', 'c', 'i' };
+    static constexpr char32_t s_5_1[4] = { 'e', 'n', 'c', 'i' };
+    static constexpr char32_t s_5_2[3] = { 'o', 'g', 'i' };
+    static constexpr char32_t s_5_3[2] = { 'l', 'i' };
+    static constexpr char32_t s_5_4[3] = { 'b', 'l', 'i' };
+    static constexpr char32_t s_5_5[4] = { 'a', 'b', 'l', 'i' };
+    static constexpr char32_t s_5_6[4] = { 'a', 'l', 'l', 'i' };
+    static constexpr char32_t s_5_7[5] = { 'f', 'u', 'l', 'l', 'i' };
+    static constexpr char32_t s_5_8[6] = { 'l', 'e', 's', 's', 'l', 'i' };
+    static constexpr char32_t s_5_9[5] = { 'o', 'u', 's', 'l', 'i' };
+    static constexpr char32_t s_5_10[5] = { 'e', 'n', 't', 'l', 'i' };
+    static constexpr char32_t s_5_11[5] = { 'a', 'l', 'i', 't', 'i' };
+    static constexpr char32_t s_5_12[6] = { 'b', 'i', 'l', 'i', 't', 'i' };
+    static constexpr char32_t s_5_13[5] = { 'i', 'v', 'i', 't', 'i' };
+    static constexpr char32_t s_5_14[6] = { 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr char32_t s_5_15[7] = { 'a', 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr char32_t s_5_16[5] = { 'a', 'l', 'i', 's', 'm' };
+    static constexpr char32_t s_5_17[5] = { 'a', 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_5_18[7] = { 'i', 'z', 'a', 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_5_19[4] = { 'i', 'z', 'e', 'r' };
+    static constexpr char32_t s_5_20[4] = { 'a', 't', 'o', 'r' };
+    static constexpr char32_t s_5_21[7] = { 'i', 'v', 'e', 'n', 'e', 's', 's' };
+    static constexpr char32_t s_5_22[7] = { 'f', 'u', 'l', 'n', 'e', 's', 's' };
+    static constexpr char32_t s_5_23[7] = { 'o', 'u', 's', 'n', 'e', 's', 's' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 4, s_5_0, -1, 3, 0 },
+    /*  1 */ { 4, s_5_1, -1, 2, 0 },
+    /*  2 */ { 3, s_5_2, -1, 13, 0 },
+    /*  3 */ { 2, s_5_3, -1, 16, 0 },
+    /*  4 */ { 3, s_5_4, 3, 12, 0 },
+    /*  5 */ { 4, s_5_5, 4, 4, 0 },
+    /*  6 */ { 4, s_5_6, 3, 8, 0 },
+    /*  7 */ { 5, s_5_7, 3, 14, 0 },
+    /*  8 */ { 6, s_5_8, 3, 15, 0 },
+    /*  9 */ { 5, s_5_9, 3, 10, 0 },
+    /* 10 */ { 5, s_5_10, 3, 5, 0 },
+    /* 11 */ { 5, s_5_11, -1, 8, 0 },
+    /* 12 */ { 6, s_5_12, -1, 12, 0 },
+    /* 13 */ { 5, s_5_13, -1, 11, 0 },
+    /* 14 */ { 6, s_5_14, -1, 1, 0 },
+    /* 15 */ { 7, s_5_15, 14, 7, 0 },
+    /* 16 */ { 5, s_5_16, -1, 8, 0 },
+    /* 17 */ { 5, s_5_17, -1, 7, 0 },
+    /* 18 */ { 7, s_5_18, 17, 6, 0 },
+    /* 19 */ { 4, s_5_19, -1, 6, 0 },
+    /* 20 */ { 4, s_5_20, -1, 7, 0 },
+    /* 21 */ { 7, s_5_21, -1, 11, 0 },
+    /* 22 */ { 7, s_5_22, -1, 9, 0 },
+    /* 23 */ { 7, s_5_23, -1, 10, 0 }
+    };
+
+    static constexpr char32_t s_6_0[5] = { 'i', 'c', 'a', 't', 'e' };
+    static constexpr char32_t s_6_1[5] = { 'a', 't', 'i', 'v', 'e' };
+    static constexpr char32_t s_6_2[5] = { 'a', 'l', 'i', 'z', 'e' };
+    static constexpr char32_t s_6_3[5] = { 'i', 'c', 'i', 't', 'i' };
+    static constexpr char32_t s_6_4[4] = { 'i', 'c', 'a', 'l' };
+    static constexpr char32_t s_6_5[6] = { 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr char32_t s_6_6[7] = { 'a', 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr char32_t s_6_7[3] = { 'f', 'u', 'l' };
+    static constexpr char32_t s_6_8[4] = { 'n', 'e', 's', 's' };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 5, s_6_0, -1, 4, 0 },
+    /*  1 */ { 5, s_6_1, -1, 6, 0 },
+    /*  2 */ { 5, s_6_2, -1, 3, 0 },
+    /*  3 */ { 5, s_6_3, -1, 4, 0 },
+    /*  4 */ { 4, s_6_4, -1, 4, 0 },
+    /*  5 */ { 6, s_6_5, -1, 1, 0 },
+    /*  6 */ { 7, s_6_6, 5, 2, 0 },
+    /*  7 */ { 3, s_6_7, -1, 5, 0 },
+    /*  8 */ { 4, s_6_8, -1, 5, 0 }
+    };
+
+    static constexpr char32_t s_7_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_7_1[4] = { 'a', 'n', 'c', 'e' };
+    static constexpr char32_t s_7_2[4] = { 'e', 'n', 'c', 'e' };
+    static constexpr char32_t s_7_3[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_7_4[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr char32_t s_7_5[3] = { 'a', 't', 'e' };
+    static constexpr char32_t s_7_6[3] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_7_7[3] = { 'i', 'z', 'e' };
+    static constexpr char32_t s_7_8[3] = { 'i', 't', 'i' };
+    static constexpr char32_t s_7_9[2] = { 'a', 'l' };
+    static constexpr char32_t s_7_10[3] = { 'i', 's', 'm' };
+    static constexpr char32_t s_7_11[3] = { 'i', 'o', 'n' };
+    static constexpr char32_t s_7_12[2] = { 'e', 'r' };
+    static constexpr char32_t s_7_13[3] = { 'o', 'u', 's' };
+    static constexpr char32_t s_7_14[3] = { 'a', 'n', 't' };
+    static constexpr char32_t s_7_15[3] = { 'e', 'n', 't' };
+    static constexpr char32_t s_7_16[4] = { 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_7_17[5] = { 'e', 'm', 'e', 'n', 't' };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 2, s_7_0, -1, 1, 0 },
+    /*  1 */ { 4, s_7_1, -1, 1, 0 },
+    /*  2 */ { 4, s_7_2, -1, 1, 0 },
+    /*  3 */ { 4, s_7_3, -1, 1, 0 },
+    /*  4 */ { 4, s_7_4, -1, 1, 0 },
+    /*  5 */ { 3, s_7_5, -1, 1, 0 },
+    /*  6 */ { 3, s_7_6, -1, 1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 3, s_7_8, -1, 1, 0 },
+    /*  9 */ { 2, s_7_9, -1, 1, 0 },
+    /* 10 */ { 3, s_7_10, -1, 1, 0 },
+    /* 11 */ { 3, s_7_11, -1, 2, 0 },
+    /* 12 */ { 2, s_7_12, -1, 1, 0 },
+    /* 13 */ { 3, s_7_13, -1, 1, 0 },
+    /* 14 */ { 3, s_7_14, -1, 1, 0 },
+    /* 15 */ { 3, s_7_15, -1, 1, 0 },
+    /* 16 */ { 4, s_7_16, 15, 1, 0 },
+    /* 17 */ { 5, s_7_17, 16, 1, 0 }
+    };
+
+    static constexpr char32_t s_8_0[1] = { 'e' };
+    static constexpr char32_t s_8_1[1] = { 'l' };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, 1, 0 },
+    /*  1 */ { 1, s_8_1, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_9_0[7] = { 's', 'u', 'c', 'c', 'e', 'e', 'd' };
+    static constexpr char32_t s_9_1[7] = { 'p', 'r', 'o', 'c', 'e', 'e', 'd' };
+    static constexpr char32_t s_9_2[6] = { 'e', 'x', 'c', 'e', 'e', 'd' };
+    static constexpr char32_t s_9_3[7] = { 'c', 'a', 'n', 'n', 'i', 'n', 'g' };
+    static constexpr char32_t s_9_4[6] = { 'i', 'n', 'n', 'i', 'n', 'g' };
+    static constexpr char32_t s_9_5[7] = { 'e', 'a', 'r', 'r', 'i', 'n', 'g' };
+    static constexpr char32_t s_9_6[7] = { 'h', 'e', 'r', 'r', 'i', 'n', 'g' };
+    static constexpr char32_t s_9_7[6] = { 'o', 'u', 't', 'i', 'n', 'g' };
+
+    static constexpr among<char32_t> a_9[] = {
+    /*  0 */ { 7, s_9_0, -1, -1, 0 },
+    /*  1 */ { 7, s_9_1, -1, -1, 0 },
+    /*  2 */ { 6, s_9_2, -1, -1, 0 },
+    /*  3 */ { 7, s_9_3, -1, -1, 0 },
+    /*  4 */ { 6, s_9_4, -1, -1, 0 },
+    /*  5 */ { 7, s_9_5, -1, -1, 0 },
+    /*  6 */ { 7, s_9_6, -1, -1, 0 },
+    /*  7 */ { 6, s_9_7, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_10_0[5] = { 'a', 'n', 'd', 'e', 's' };
+    static constexpr char32_t s_10_1[5] = { 'a', 't', 'l', 'a', 's' };
+    static constexpr char32_t s_10_2[4] = { 'b', 'i', 'a', 's' };
+    static constexpr char32_t s_10_3[6] = { 'c', 'o', 's', 'm', 'o', 's' };
+    static constexpr char32_t s_10_4[5] = { 'd', 'y', 'i', 'n', 'g' };
+    static constexpr char32_t s_10_5[5] = { 'e', 'a', 'r', 'l', 'y' };
+    static constexpr char32_t s_10_6[6] = { 'g', 'e', 'n', 't', 'l', 'y' };
+    static constexpr char32_t s_10_7[4] = { 'h', 'o', 'w', 'e' };
+    static constexpr char32_t s_10_8[4] = { 'i', 'd', 'l', 'y' };
+    static constexpr char32_t s_10_9[5] = { 'l', 'y', 'i', 'n', 'g' };
+    static constexpr char32_t s_10_10[4] = { 'n', 'e', 'w', 's' };
+    static constexpr char32_t s_10_11[4] = { 'o', 'n', 'l', 'y' };
+    static constexpr char32_t s_10_12[6] = { 's', 'i', 'n', 'g', 'l', 'y' };
+    static constexpr char32_t s_10_13[5] = { 's', 'k', 'i', 'e', 's' };
+    static constexpr char32_t s_10_14[4] = { 's', 'k', 'i', 's' };
+    static constexpr char32_t s_10_15[3] = { 's', 'k', 'y' };
+    static constexpr char32_t s_10_16[5] = { 't', 'y', 'i', 'n', 'g' };
+    static constexpr char32_t s_10_17[4] = { 'u', 'g', 'l', 'y' };
+
+    static constexpr among<char32_t> a_10[] = {
+    /*  0 */ { 5, s_10_0, -1, -1, 0 },
+    /*  1 */ { 5, s_10_1, -1, -1, 0 },
+    /*  2 */ { 4, s_10_2, -1, -1, 0 },
+    /*  3 */ { 6, s_10_3, -1, -1, 0 },
+    /*  4 */ { 5, s_10_4, -1, 3, 0 },
+    /*  5 */ { 5, s_10_5, -1, 9, 0 },
+    /*  6 */ { 6, s_10_6, -1, 7, 0 },
+    /*  7 */ { 4, s_10_7, -1, -1, 0 },
+    /*  8 */ { 4, s_10_8, -1, 6, 0 },
+    /*  9 */ { 5, s_10_9, -1, 4, 0 },
+    /* 10 */ { 4, s_10_10, -1, -1, 0 },
+    /* 11 */ { 4, s_10_11, -1, 10, 0 },
+    /* 12 */ { 6, s_10_12, -1, 11, 0 },
+    /* 13 */ { 5, s_10_13, -1, 2, 0 },
+    /* 14 */ { 4, s_10_14, -1, 1, 0 },
+    /* 15 */ { 3, s_10_15, -1, -1, 0 },
+    /* 16 */ { 5, s_10_16, -1, 5, 0 },
+    /* 17 */ { 4, s_10_17, -1, 8, 0 }
+    };
+    static constexpr char32_t s_0[] = { '\'' };
+    static constexpr char32_t s_1[] = { 'y' };
+    static constexpr char32_t s_2[] = { 'Y' };
+    static constexpr char32_t s_3[] = { 'y' };
+    static constexpr char32_t s_4[] = { 'Y' };
+    static constexpr char32_t s_5[] = { 's', 's' };
+    static constexpr char32_t s_6[] = { 'i' };
+    static constexpr char32_t s_7[] = { 'i', 'e' };
+    static constexpr char32_t s_8[] = { 'e', 'e' };
+    static constexpr char32_t s_9[] = { 'e' };
+    static constexpr char32_t s_10[] = { 'e' };
+    static constexpr char32_t s_11[] = { 'y' };
+    static constexpr char32_t s_12[] = { 'Y' };
+    static constexpr char32_t s_13[] = { 'i' };
+    static constexpr char32_t s_14[] = { 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_15[] = { 'e', 'n', 'c', 'e' };
+    static constexpr char32_t s_16[] = { 'a', 'n', 'c', 'e' };
+    static constexpr char32_t s_17[] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_18[] = { 'e', 'n', 't' };
+    static constexpr char32_t s_19[] = { 'i', 'z', 'e' };
+    static constexpr char32_t s_20[] = { 'a', 't', 'e' };
+    static constexpr char32_t s_21[] = { 'a', 'l' };
+    static constexpr char32_t s_22[] = { 'f', 'u', 'l' };
+    static constexpr char32_t s_23[] = { 'o', 'u', 's' };
+    static constexpr char32_t s_24[] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_25[] = { 'b', 'l', 'e' };
+    static constexpr char32_t s_26[] = { 'l' };
+    static constexpr char32_t s_27[] = { 'o', 'g' };
+    static constexpr char32_t s_28[] = { 'f', 'u', 'l' };
+    static constexpr char32_t s_29[] = { 'l', 'e', 's', 's' };
+    static constexpr char32_t s_30[] = { 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_31[] = { 'a', 't', 'e' };
+    static constexpr char32_t s_32[] = { 'a', 'l' };
+    static constexpr char32_t s_33[] = { 'i', 'c' };
+    static constexpr char32_t s_34[] = { 's' };
+    static constexpr char32_t s_35[] = { 't' };
+    static constexpr char32_t s_36[] = { 'l' };
+    static constexpr char32_t s_37[] = { 's', 'k', 'i' };
+    static constexpr char32_t s_38[] = { 's', 'k', 'y' };
+    static constexpr char32_t s_39[] = { 'd', 'i', 'e' };
+    static constexpr char32_t s_40[] = { 'l', 'i', 'e' };
+    static constexpr char32_t s_41[] = { 't', 'i', 'e' };
+    static constexpr char32_t s_42[] = { 'i', 'd', 'l' };
+    static constexpr char32_t s_43[] = { 'g', 'e', 'n', 't', 'l' };
+    static constexpr char32_t s_44[] = { 'u', 'g', 'l', 'i' };
+    static constexpr char32_t s_45[] = { 'e', 'a', 'r', 'l', 'i' };
+    static constexpr char32_t s_46[] = { 'o', 'n', 'l', 'i' };
+    static constexpr char32_t s_47[] = { 's', 'i', 'n', 'g', 'l' };
+    static constexpr char32_t s_48[] = { 'Y' };
+    static constexpr char32_t s_49[] = { 'y' };
+};
+
+template <typename symbol>
+class english_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef english_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        B_Y_found = false; /* unset Y_found, line 26 */
+        {   int c1 = c; /* do, line 27 */
+            bra = c; /* [, line 27 */
+            if (!eq_s(data::s_0)) goto lab0; /* literal, line 27 */
+            ket = c; /* ], line 27 */
+            slice_del(); /* delete, line 27 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 28 */
+            bra = c; /* [, line 28 */
+            if (!eq_s(data::s_1)) goto lab1; /* literal, line 28 */
+            ket = c; /* ], line 28 */
+            slice_from(data::s_2); /* <-, line 28 */
+            B_Y_found = true; /* set Y_found, line 28 */
+        lab1:
+            c = c2;
+        }
+        {   int c3 = c; /* do, line 29 */
+            while(1) { /* repeat, line 29 */
+                int c4 = c;
+                while(1) { /* goto, line 29 */
+                    int c5 = c;
+                    if (in_grouping(data::g_v, 97, 121, 0)) goto lab4; /* grouping v, line 29 */
+                    bra = c; /* [, line 29 */
+                    if (!eq_s(data::s_3)) goto lab4; /* literal, line 29 */
+                    ket = c; /* ], line 29 */
+                    c = c5;
+                    break;
+                lab4:
+                    c = c5;
+                    {   int ret = hop(c, 0, l, 1); /* goto, line 29 */
+                        if (ret < 0) goto lab3;
+                        c = ret;
+                    }
+                }
+                slice_from(data::s_4); /* <-, line 29 */
+                B_Y_found = true; /* set Y_found, line 29 */
+                continue;
+            lab3:
+                c = c4;
+                break;
+            }
+            c = c3;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 33 */
+        I_p2 = l; /* $p2 = <integer expression>, line 34 */
+        {   int c1 = c; /* do, line 35 */
+            {   int c2 = c; /* or, line 41 */
+                if (!find_among(data::a_0)) goto lab2; /* among, line 36 */
+                goto lab1;
+            lab2:
+                c = c2;
+                {    /* gopast */ /* grouping v, line 41 */
+                    int ret = out_grouping(data::g_v, 97, 121, 1);
+                    if (ret < 0) goto lab0;
+                    c += ret;
+                }
+                {    /* gopast */ /* non v, line 41 */
+                    int ret = in_grouping(data::g_v, 97, 121, 1);
+                    if (ret < 0) goto lab0;
+                    c += ret;
+                }
+            }
+        lab1:
+            I_p1 = c; /* setmark p1, line 42 */
+            {    /* gopast */ /* grouping v, line 43 */
+                int ret = out_grouping(data::g_v, 97, 121, 1);
+                if (ret < 0) goto lab0;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 43 */
+                int ret = in_grouping(data::g_v, 97, 121, 1);
+                if (ret < 0) goto lab0;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 43 */
+        lab0:
+            c = c1;
+        }
+        return true;
+    }
+
+  private:
+    bool r_shortv() {
+        {   int m1 = l - c; (void)m1; /* or, line 51 */
+            if (out_grouping_b(data::g_v_WXY, 89, 121, 0)) goto lab1; /* non v_WXY, line 50 */
+            if (in_grouping_b(data::g_v, 97, 121, 0)) goto lab1; /* grouping v, line 50 */
+            if (out_grouping_b(data::g_v, 97, 121, 0)) goto lab1; /* non v, line 50 */
+            goto lab0;
+        lab1:
+            c = l - m1;
+            if (out_grouping_b(data::g_v, 97, 121, 0)) return false; /* non v, line 52 */
+            if (in_grouping_b(data::g_v, 97, 121, 0)) return false; /* grouping v, line 52 */
+            if (c > lb) return false; /* atlimit, line 52 */
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 55 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 56 */
+        return true;
+    }
+
+  private:
+    bool r_Step_1a() {
+        int among_var;
+        {   int m_keep = l - c; /* try, line 59 */
+            ket = c; /* [, line 60 */
+            if (c <= lb || (p[c - 1] != 39 && p[c - 1] != 115)) { c = l - m_keep; goto lab0; } /* substring, line 60 */
+            among_var = find_among_b(data::a_1); /* substring, line 60 */
+            if (!among_var) { c = l - m_keep; goto lab0; }
+            bra = c; /* ], line 60 */
+            switch(among_var) {
+                case 0: { c = l - m_keep; goto lab0; }
+                case 1:
+                    slice_del(); /* delete, line 62 */
+                    break;
+            }
+        lab0:
+            ;
+        }
+        ket = c; /* [, line 65 */
+        if (c <= lb || (p[c - 1] != 100 && p[c - 1] != 115)) return false; /* substring, line 65 */
+        among_var = find_among_b(data::a_2); /* substring, line 65 */
+        if (!among_var) return false;
+        bra = c; /* ], line 65 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_5); /* <-, line 66 */
+                break;
+            case 2:
+                {   int m1 = l - c; (void)m1; /* or, line 68 */
+                    {   int ret = hop(c, lb, l, -2); /* hop, line 68 */
+                        if (ret < 0) goto lab2;
+                        c = ret;
+                    }
+                    slice_from(data::s_6); /* <-, line 68 */
+                    goto lab1;
+                lab2:
+                    c = l - m1;
+                    slice_from(data::s_7); /* <-, line 68 */
+                }
+            lab1:
+                break;
+            case 3:
+                {   int ret = hop(c, lb, l, -1); /* next, line 69 */
+                    if (ret < 0) return false;
+                    c = ret;
+                }
+                {    /* gopast */ /* grouping v, line 69 */
+                    int ret = out_grouping_b(data::g_v, 97, 121, 1);
+                    if (ret < 0) return false;
+                    c -= ret;
+                }
+                slice_del(); /* delete, line 69 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_1b() {
+        int among_var;
+        ket = c; /* [, line 75 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((33554576 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 75 */
+        among_var = find_among_b(data::a_4); /* substring, line 75 */
+        if (!among_var) return false;
+        bra = c; /* ], line 75 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_R1()) return false; /* call R1, line 77 */
+                slice_from(data::s_8); /* <-, line 77 */
+                break;
+            case 2:
+                {   int m_test = l - c; /* test, line 80 */
+                    {    /* gopast */ /* grouping v, line 80 */
+                        int ret = out_grouping_b(data::g_v, 97, 121, 1);
+                        if (ret < 0) return false;
+                        c -= ret;
+                    }
+                    c = l - m_test;
+                }
+                slice_del(); /* delete, line 80 */
+                {   int m_test = l - c; /* test, line 81 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((68514004 >> (p[c - 1] & 0x1f)) & 1)) among_var = 3; else /* substring, line 81 */
+                    among_var = find_among_b(data::a_3); /* substring, line 81 */
+                    if (!among_var) return false;
+                    c = l - m_test;
+                }
+                switch(among_var) {
+                    case 0: return false;
+                    case 1:
+                        {   int c_keep = c; /* <+, line 83 */
+                            insert(c, c, data::s_9);
+                            c = c_keep;
+                        }
+                        break;
+                    case 2:
+                        ket = c; /* [, line 86 */
+                        {   int ret = hop(c, lb, l, -1); /* next, line 86 */
+                            if (ret < 0) return false;
+                            c = ret;
+                        }
+                        bra = c; /* ], line 86 */
+                        slice_del(); /* delete, line 86 */
+                        break;
+                    case 3:
+                        if (c != I_p1) return false; /* atmark, line 87 */
+                        {   int m_test = l - c; /* test, line 87 */
+                            if (!r_shortv()) return false; /* call shortv, line 87 */
+                            c = l - m_test;
+                        }
+                        {   int c_keep = c; /* <+, line 87 */
+                            insert(c, c, data::s_10);
+                            c = c_keep;
+                        }
+                        break;
+                }
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_1c() {
+        ket = c; /* [, line 94 */
+        {   int m1 = l - c; (void)m1; /* or, line 94 */
+            if (!eq_s_b(data::s_11)) goto lab1; /* literal, line 94 */
+            goto lab0;
+        lab1:
+            c = l - m1;
+            if (!eq_s_b(data::s_12)) return false; /* literal, line 94 */
+        }
+    lab0:
+        bra = c; /* ], line 94 */
+        if (out_grouping_b(data::g_v, 97, 121, 0)) return false; /* non v, line 95 */
+        {   int m2 = l - c; (void)m2; /* not, line 95 */
+            if (c > lb) goto lab2; /* atlimit, line 95 */
+            return false;
+        lab2:
+            c = l - m2;
+        }
+        slice_from(data::s_13); /* <-, line 96 */
+        return true;
+    }
+
+  private:
+    bool r_Step_2() {
+        int among_var;
+        ket = c; /* [, line 100 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((815616 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 100 */
+        among_var = find_among_b(data::a_5); /* substring, line 100 */
+        if (!among_var) return false;
+        bra = c; /* ], line 100 */
+        if (!r_R1()) return false; /* call R1, line 100 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_14); /* <-, line 101 */
+                break;
+            case 2:
+                slice_from(data::s_15); /* <-, line 102 */
+                break;
+            case 3:
+                slice_from(data::s_16); /* <-, line 103 */
+                break;
+            case 4:
+                slice_from(data::s_17); /* <-, line 104 */
+                break;
+            case 5:
+                slice_from(data::s_18); /* <-, line 105 */
+                break;
+            case 6:
+                slice_from(data::s_19); /* <-, line 107 */
+                break;
+            case 7:
+                slice_from(data::s_20); /* <-, line 109 */
+                break;
+            case 8:
+                slice_from(data::s_21); /* <-, line 111 */
+                break;
+            case 9:
+                slice_from(data::s_22); /* <-, line 112 */
+                break;
+            case 10:
+                slice_from(data::s_23); /* <-, line 114 */
+                break;
+            case 11:
+                slice_from(data::s_24); /* <-, line 116 */
+                break;
+            case 12:
+                slice_from(data::s_25); /* <-, line 118 */
+                break;
+            case 13:
+                if (!eq_s_b(data::s_26)) return false; /* literal, line 119 */
+                slice_from(data::s_27); /* <-, line 119 */
+                break;
+            case 14:
+                slice_from(data::s_28); /* <-, line 120 */
+                break;
+            case 15:
+                slice_from(data::s_29); /* <-, line 121 */
+                break;
+            case 16:
+                if (in_grouping_b(data::g_valid_LI, 99, 116, 0)) return false; /* grouping valid_LI, line 122 */
+                slice_del(); /* delete, line 122 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_3() {
+        int among_var;
+        ket = c; /* [, line 127 */
+        if (c - 2 <= lb || p[c - 1] >> 5 != 3 || !((528928 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 127 */
+        among_var = find_among_b(data::a_6); /* substring, line 127 */
+        if (!among_var) return false;
+        bra = c; /* ], line 127 */
+        if (!r_R1()) return false; /* call R1, line 127 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_30); /* <-, line 128 */
+                break;
+            case 2:
+                slice_from(data::s_31); /* <-, line 129 */
+                break;
+            case 3:
+                slice_from(data::s_32); /* <-, line 130 */
+                break;
+            case 4:
+                slice_from(data::s_33); /* <-, line 132 */
+                break;
+            case 5:
+                slice_del(); /* delete, line 134 */
+                break;
+            case 6:
+                if (!r_R2()) return false; /* call R2, line 136 */
+                slice_del(); /* delete, line 136 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_4() {
+        int among_var;
+        ket = c; /* [, line 141 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1864232 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 141 */
+        among_var = find_among_b(data::a_7); /* substring, line 141 */
+        if (!among_var) return false;
+        bra = c; /* ], line 141 */
+        if (!r_R2()) return false; /* call R2, line 141 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 144 */
+                break;
+            case 2:
+                {   int m1 = l - c; (void)m1; /* or, line 145 */
+                    if (!eq_s_b(data::s_34)) goto lab1; /* literal, line 145 */
+                    goto lab0;
+                lab1:
+                    c = l - m1;
+                    if (!eq_s_b(data::s_35)) return false; /* literal, line 145 */
+                }
+            lab0:
+                slice_del(); /* delete, line 145 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_5() {
+        int among_var;
+        ket = c; /* [, line 150 */
+        if (c <= lb || (p[c - 1] != 101 && p[c - 1] != 108)) return false; /* substring, line 150 */
+        among_var = find_among_b(data::a_8); /* substring, line 150 */
+        if (!among_var) return false;
+        bra = c; /* ], line 150 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m1 = l - c; (void)m1; /* or, line 151 */
+                    if (!r_R2()) goto lab1; /* call R2, line 151 */
+                    goto lab0;
+                lab1:
+                    c = l - m1;
+                    if (!r_R1()) return false; /* call R1, line 151 */
+                    {   int m2 = l - c; (void)m2; /* not, line 151 */
+                        if (!r_shortv()) goto lab2; /* call shortv, line 151 */
+                        return false;
+                    lab2:
+                        c = l - m2;
+                    }
+                }
+            lab0:
+                slice_del(); /* delete, line 151 */
+                break;
+            case 2:
+                if (!r_R2()) return false; /* call R2, line 152 */
+                if (!eq_s_b(data::s_36)) return false; /* literal, line 152 */
+                slice_del(); /* delete, line 152 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_exception2() {
+        ket = c; /* [, line 158 */
+        if (c - 5 <= lb || (p[c - 1] != 100 && p[c - 1] != 103)) return false; /* substring, line 158 */
+        if (!find_among_b(data::a_9)) return false; /* substring, line 158 */
+        bra = c; /* ], line 158 */
+        if (c > lb) return false; /* atlimit, line 158 */
+        return true;
+    }
+
+  private:
+    bool r_exception1() {
+        int among_var;
+        bra = c; /* [, line 170 */
+        among_var = find_among(data::a_10); /* substring, line 170 */
+        if (!among_var) return false;
+        ket = c; /* ], line 170 */
+        if (c < l) return false; /* atlimit, line 170 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_37); /* <-, line 174 */
+                break;
+            case 2:
+                slice_from(data::s_38); /* <-, line 175 */
+                break;
+            case 3:
+                slice_from(data::s_39); /* <-, line 176 */
+                break;
+            case 4:
+                slice_from(data::s_40); /* <-, line 177 */
+                break;
+            case 5:
+                slice_from(data::s_41); /* <-, line 178 */
+                break;
+            case 6:
+                slice_from(data::s_42); /* <-, line 182 */
+                break;
+            case 7:
+                slice_from(data::s_43); /* <-, line 183 */
+                break;
+            case 8:
+                slice_from(data::s_44); /* <-, line 184 */
+                break;
+            case 9:
+                slice_from(data::s_45); /* <-, line 185 */
+                break;
+            case 10:
+                slice_from(data::s_46); /* <-, line 186 */
+                break;
+            case 11:
+                slice_from(data::s_47); /* <-, line 187 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        if (!B_Y_found) return false; /* Boolean test Y_found, line 203 */
+        while(1) { /* repeat, line 203 */
+            int c1 = c;
+            while(1) { /* goto, line 203 */
+                int c2 = c;
+                bra = c; /* [, line 203 */
+                if (!eq_s(data::s_48)) goto lab1; /* literal, line 203 */
+                ket = c; /* ], line 203 */
+                c = c2;
+                break;
+            lab1:
+                c = c2;
+                {   int ret = hop(c, 0, l, 1); /* goto, line 203 */
+                    if (ret < 0) goto lab0;
+                    c = ret;
+                }
+            }
+            slice_from(data::s_49); /* <-, line 203 */
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* or, line 207 */
+            if (!r_exception1()) goto lab1; /* call exception1, line 207 */
+            goto lab0;
+        lab1:
+            c = c1;
+            {   int c2 = c; /* not, line 208 */
+                {   int ret = hop(c, 0, l, 3); /* hop, line 208 */
+                    if (ret < 0) goto lab3;
+                    c = ret;
+                }
+                goto lab2;
+            lab3:
+                c = c2;
+            }
+            goto lab0;
+        lab2:
+            c = c1;
+            {   int c3 = c; /* do, line 209 */
+                if (!r_prelude()) goto lab4; /* call prelude, line 209 */
+            lab4:
+                c = c3;
+            }
+            {   int c4 = c; /* do, line 210 */
+                if (!r_mark_regions()) goto lab5; /* call mark_regions, line 210 */
+            lab5:
+                c = c4;
+            }
+            lb = c; c = l; /* backwards, line 211 */
+
+            {   int m5 = l - c; (void)m5; /* do, line 213 */
+                if (!r_Step_1a()) goto lab6; /* call Step_1a, line 213 */
+            lab6:
+                c = l - m5;
+            }
+            {   int m6 = l - c; (void)m6; /* or, line 215 */
+                if (!r_exception2()) goto lab8; /* call exception2, line 215 */
+                goto lab7;
+            lab8:
+                c = l - m6;
+                {   int m7 = l - c; (void)m7; /* do, line 217 */
+                    if (!r_Step_1b()) goto lab9; /* call Step_1b, line 217 */
+                lab9:
+                    c = l - m7;
+                }
+                {   int m8 = l - c; (void)m8; /* do, line 218 */
+                    if (!r_Step_1c()) goto lab10; /* call Step_1c, line 218 */
+                lab10:
+                    c = l - m8;
+                }
+                {   int m9 = l - c; (void)m9; /* do, line 220 */
+                    if (!r_Step_2()) goto lab11; /* call Step_2, line 220 */
+                lab11:
+                    c = l - m9;
+                }
+                {   int m10 = l - c; (void)m10; /* do, line 221 */
+                    if (!r_Step_3()) goto lab12; /* call Step_3, line 221 */
+                lab12:
+                    c = l - m10;
+                }
+                {   int m11 = l - c; (void)m11; /* do, line 222 */
+                    if (!r_Step_4()) goto lab13; /* call Step_4, line 222 */
+                lab13:
+                    c = l - m11;
+                }
+                {   int m12 = l - c; (void)m12; /* do, line 224 */
+                    if (!r_Step_5()) goto lab14; /* call Step_5, line 224 */
+                lab14:
+                    c = l - m12;
+                }
+            }
+        lab7:
+            c = lb;
+            {   int c13 = c; /* do, line 227 */
+                if (!r_postlude()) goto lab15; /* call postlude, line 227 */
+            lab15:
+                c = c13;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool B_Y_found = false;
+    int I_p2 = 0;
+    int I_p1 = 0;
+};
+
+}
+
+#endif
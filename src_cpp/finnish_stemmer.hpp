@@ -0,0 +1,950 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_FINNISH_STEMMER_HPP
+#define SNOWBALL_FINNISH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct finnish_stemmer_groupings {
+    static constexpr unsigned char g_AEI[] = { 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8 };
+    static constexpr unsigned char g_V1[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32 };
+    static constexpr unsigned char g_V2[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32 };
+    static constexpr unsigned char g_particle_end[] = { 17, 97, 24, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32 };
+};
+
+template <bool utf8> struct finnish_stemmer_data;
+
+template <>
+struct finnish_stemmer_data<true> : finnish_stemmer_groupings {
+    static constexpr unsigned char s_0_0[2] = { 'p', 'a' };
+    static constexpr unsigned char s_0_1[3] = { 's', 't', 'i' };
+    static constexpr unsigned char s_0_2[4] = { 'k', 'a', 'a', 'n' };
+    static constexpr unsigned char s_0_3[3] = { 'h', 'a', 'n' };
+    static constexpr unsigned char s_0_4[3] = { 'k', 'i', 'n' };
+    static constexpr unsigned char s_0_5[4] = { 'h', 0xC3, 0xA4, 'n' };
+    static constexpr unsigned char s_0_6[6] = { 'k', 0xC3, 0xA4, 0xC3, 0xA4, 'n' };
+    static constexpr unsigned char s_0_7[2] = { 'k', 'o' };
+    static constexpr unsigned char s_0_8[3] = { 'p', 0xC3, 0xA4 };
+    static constexpr unsigned char s_0_9[3] = { 'k', 0xC3, 0xB6 };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 2, s_0_0, -1, 1, 0 },
+    /*  1 */ { 3, s_0_1, -1, 2, 0 },
+    /*  2 */ { 4, s_0_2, -1, 1, 0 },
+    /*  3 */ { 3, s_0_3, -1, 1, 0 },
+    /*  4 */ { 3, s_0_4, -1, 1, 0 },
+    /*  5 */ { 4, s_0_5, -1, 1, 0 },
+    /*  6 */ { 6, s_0_6, -1, 1, 0 },
+    /*  7 */ { 2, s_0_7, -1, 1, 0 },
+    /*  8 */ { 3, s_0_8, -1, 1, 0 },
+    /*  9 */ { 3, s_0_9, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[3] = { 'l', 'l', 'a' };
+    static constexpr unsigned char s_1_1[2] = { 'n', 'a' };
+    static constexpr unsigned char s_1_2[3] = { 's', 's', 'a' };
+    static constexpr unsigned char s_1_3[2] = { 't', 'a' };
+    static constexpr unsigned char s_1_4[3] = { 'l', 't', 'a' };
+    static constexpr unsigned char s_1_5[3] = { 's', 't', 'a' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 3, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 },
+    /*  2 */ { 3, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 },
+    /*  4 */ { 3, s_1_4, 3, -1, 0 },
+    /*  5 */ { 3, s_1_5, 3, -1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[4] = { 'l', 'l', 0xC3, 0xA4 };
+    static constexpr unsigned char s_2_1[3] = { 'n', 0xC3, 0xA4 };
+    static constexpr unsigned char s_2_2[4] = { 's', 's', 0xC3, 0xA4 };
+    static constexpr unsigned char s_2_3[3] = { 't', 0xC3, 0xA4 };
+    static constexpr unsigned char s_2_4[4] = { 'l', 't', 0xC3, 0xA4 };
+    static constexpr unsigned char s_2_5[4] = { 's', 't', 0xC3, 0xA4 };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 4, s_2_0, -1, -1, 0 },
+    /*  1 */ { 3, s_2_1, -1, -1, 0 },
+    /*  2 */ { 4, s_2_2, -1, -1, 0 },
+    /*  3 */ { 3, s_2_3, -1, -1, 0 },
+    /*  4 */ { 4, s_2_4, 3, -1, 0 },
+    /*  5 */ { 4, s_2_5, 3, -1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[3] = { 'l', 'l', 'e' };
+    static constexpr unsigned char s_3_1[3] = { 'i', 'n', 'e' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 3, s_3_0, -1, -1, 0 },
+    /*  1 */ { 3, s_3_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[3] = { 'n', 's', 'a' };
+    static constexpr unsigned char s_4_1[3] = { 'm', 'm', 'e' };
+    static constexpr unsigned char s_4_2[3] = { 'n', 'n', 'e' };
+    static constexpr unsigned char s_4_3[2] = { 'n', 'i' };
+    static constexpr unsigned char s_4_4[2] = { 's', 'i' };
+    static constexpr unsigned char s_4_5[2] = { 'a', 'n' };
+    static constexpr unsigned char s_4_6[2] = { 'e', 'n' };
+    static constexpr unsigned char s_4_7[3] = { 0xC3, 0xA4, 'n' };
+    static constexpr unsigned char s_4_8[4] = { 'n', 's', 0xC3, 0xA4 };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 3, s_4_0, -1, 3, 0 },
+    /*  1 */ { 3, s_4_1, -1, 3, 0 },
+    /*  2 */ { 3, s_4_2, -1, 3, 0 },
+    /*  3 */ { 2, s_4_3, -1, 2, 0 },
+    /*  4 */ { 2, s_4_4, -1, 1, 0 },
+    /*  5 */ { 2, s_4_5, -1, 4, 0 },
+    /*  6 */ { 2, s_4_6, -1, 6, 0 },
+    /*  7 */ { 3, s_4_7, -1, 5, 0 },
+    /*  8 */ { 4, s_4_8, -1, 3, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 'a', 'a' };
+    static constexpr unsigned char s_5_1[2] = { 'e', 'e' };
+    static constexpr unsigned char s_5_2[2] = { 'i', 'i' };
+    static constexpr unsigned char s_5_3[2] = { 'o', 'o' };
+    static constexpr unsigned char s_5_4[2] = { 'u', 'u' };
+    static constexpr unsigned char s_5_5[4] = { 0xC3, 0xA4, 0xC3, 0xA4 };
+    static constexpr unsigned char s_5_6[4] = { 0xC3, 0xB6, 0xC3, 0xB6 };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, -1, 0 },
+    /*  1 */ { 2, s_5_1, -1, -1, 0 },
+    /*  2 */ { 2, s_5_2, -1, -1, 0 },
+    /*  3 */ { 2, s_5_3, -1, -1, 0 },
+    /*  4 */ { 2, s_5_4, -1, -1, 0 },
+    /*  5 */ { 4, s_5_5, -1, -1, 0 },
+    /*  6 */ { 4, s_5_6, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[1] = { 'a' };
+    static constexpr unsigned char s_6_1[3] = { 'l', 'l', 'a' };
+    static constexpr unsigned char s_6_2[2] = { 'n', 'a' };
+    static constexpr unsigned char s_6_3[3] = { 's', 's', 'a' };
+    static constexpr unsigned char s_6_4[2] = { 't', 'a' };
+    static constexpr unsigned char s_6_5[3] = { 'l', 't', 'a' };
+    static constexpr unsigned char s_6_6[3] = { 's', 't', 'a' };
+    static constexpr unsigned char s_6_7[3] = { 't', 't', 'a' };
+    static constexpr unsigned char s_6_8[3] = { 'l', 'l', 'e' };
+    static constexpr unsigned char s_6_9[3] = { 'i', 'n', 'e' };
+    static constexpr unsigned char s_6_10[3] = { 'k', 's', 'i' };
+    static constexpr unsigned char s_6_11[1] = { 'n' };
+    static constexpr unsigned char s_6_12[3] = { 'h', 'a', 'n' };
+    static constexpr unsigned char s_6_13[3] = { 'd', 'e', 'n' };
+    static constexpr unsigned char s_6_14[4] = { 's', 'e', 'e', 'n' };
+    static constexpr unsigned char s_6_15[3] = { 'h', 'e', 'n' };
+    static constexpr unsigned char s_6_16[4] = { 't', 't', 'e', 'n' };
+    static constexpr unsigned char s_6_17[3] = { 'h', 'i', 'n' };
+    static constexpr unsigned char s_6_18[4] = { 's', 'i', 'i', 'n' };
+    static constexpr unsigned char s_6_19[3] = { 'h', 'o', 'n' };
+    static constexpr unsigned char s_6_20[4] = { 'h', 0xC3, 0xA4, 'n' };
+    static constexpr unsigned char s_6_21[4] = { 'h', 0xC3, 0xB6, 'n' };
+    static constexpr unsigned char s_6_22[2] = { 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_23[4] = { 'l', 'l', 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_24[3] = { 'n', 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_25[4] = { 's', 's', 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_26[3] = { 't', 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_27[4] = { 'l', 't', 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_28[4] = { 's', 't', 0xC3, 0xA4 };
+    static constexpr unsigned char s_6_29[4] = { 't', 't', 0xC3, 0xA4 };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 1, s_6_0, -1, 8, 0 },
+    /*  1 */ { 3, s_6_1, 0, -1, 0 },
+    /*  2 */ { 2, s_6_2, 0, -1, 0 },
+    /*  3 */ { 3, s_6_3, 0, -1, 0 },
+    /*  4 */ { 2, s_6_4, 0, -1, 0 },
+    /*  5 */ { 3, s_6_5, 4, -1, 0 },
+    /*  6 */ { 3, s_6_6, 4, -1, 0 },
+    /*  7 */ { 3, s_6_7, 4, 9, 0 },
+    /*  8 */ { 3, s_6_8, -1, -1, 0 },
+    /*  9 */ { 3, s_6_9, -1, -1, 0 },
+    /* 10 */ { 3, s_6_10, -1, -1, 0 },
+    /* 11 */ { 1, s_6_11, -1, 7, 0 },
+    /* 12 */ { 3, s_6_12, 11, 1, 0 },
+    /* 13 */ { 3, s_6_13, 11, -1, 1 },
+    /* 14 */ { 4, s_6_14, 11, -1, 2 },
+    /* 15 */ { 3, s_6_15, 11, 2, 0 },
+    /* 16 */ { 4, s_6_16, 11, -1, 1 },
+    /* 17 */ { 3, s_6_17, 11, 3, 0 },
+    /* 18 */ { 4, s_6_18, 11, -1, 1 },
+    /* 19 */ { 3, s_6_19, 11, 4, 0 },
+    /* 20 */ { 4, s_6_20, 11, 5, 0 },
+    /* 21 */ { 4, s_6_21, 11, 6, 0 },
+    /* 22 */ { 2, s_6_22, -1, 8, 0 },
+    /* 23 */ { 4, s_6_23, 22, -1, 0 },
+    /* 24 */ { 3, s_6_24, 22, -1, 0 },
+    /* 25 */ { 4, s_6_25, 22, -1, 0 },
+    /* 26 */ { 3, s_6_26, 22, -1, 0 },
+    /* 27 */ { 4, s_6_27, 26, -1, 0 },
+    /* 28 */ { 4, s_6_28, 26, -1, 0 },
+    /* 29 */ { 4, s_6_29, 26, 9, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[3] = { 'e', 'j', 'a' };
+    static constexpr unsigned char s_7_1[3] = { 'm', 'm', 'a' };
+    static constexpr unsigned char s_7_2[4] = { 'i', 'm', 'm', 'a' };
+    static constexpr unsigned char s_7_3[3] = { 'm', 'p', 'a' };
+    static constexpr unsigned char s_7_4[4] = { 'i', 'm', 'p', 'a' };
+    static constexpr unsigned char s_7_5[3] = { 'm', 'm', 'i' };
+    static constexpr unsigned char s_7_6[4] = { 'i', 'm', 'm', 'i' };
+    static constexpr unsigned char s_7_7[3] = { 'm', 'p', 'i' };
+    static constexpr unsigned char s_7_8[4] = { 'i', 'm', 'p', 'i' };
+    static constexpr unsigned char s_7_9[4] = { 'e', 'j', 0xC3, 0xA4 };
+    static constexpr unsigned char s_7_10[4] = { 'm', 'm', 0xC3, 0xA4 };
+    static constexpr unsigned char s_7_11[5] = { 'i', 'm', 'm', 0xC3, 0xA4 };
+    static constexpr unsigned char s_7_12[4] = { 'm', 'p', 0xC3, 0xA4 };
+    static constexpr unsigned char s_7_13[5] = { 'i', 'm', 'p', 0xC3, 0xA4 };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 3, s_7_0, -1, -1, 0 },
+    /*  1 */ { 3, s_7_1, -1, 1, 0 },
+    /*  2 */ { 4, s_7_2, 1, -1, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 4, s_7_4, 3, -1, 0 },
+    /*  5 */ { 3, s_7_5, -1, 1, 0 },
+    /*  6 */ { 4, s_7_6, 5, -1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 4, s_7_8, 7, -1, 0 },
+    /*  9 */ { 4, s_7_9, -1, -1, 0 },
+    /* 10 */ { 4, s_7_10, -1, 1, 0 },
+    /* 11 */ { 5, s_7_11, 10, -1, 0 },
+    /* 12 */ { 4, s_7_12, -1, 1, 0 },
+    /* 13 */ { 5, s_7_13, 12, -1, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[1] = { 'i' };
+    static constexpr unsigned char s_8_1[1] = { 'j' };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, -1, 0 },
+    /*  1 */ { 1, s_8_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_9_0[3] = { 'm', 'm', 'a' };
+    static constexpr unsigned char s_9_1[4] = { 'i', 'm', 'm', 'a' };
+
+    static constexpr among<unsigned char> a_9[] = {
+    /*  0 */ { 3, s_9_0, -1, 1, 0 },
+    /*  1 */ { 4, s_9_1, 0, -1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'k' };
+    static constexpr unsigned char s_1[] = { 'k', 's', 'e' };
+    static constexpr unsigned char s_2[] = { 'k', 's', 'i' };
+    static constexpr unsigned char s_3[] = { 'i' };
+    static constexpr unsigned char s_4[] = { 'a' };
+    static constexpr unsigned char s_5[] = { 'e' };
+    static constexpr unsigned char s_6[] = { 'i' };
+    static constexpr unsigned char s_7[] = { 'o' };
+    static constexpr unsigned char s_8[] = { 0xC3, 0xA4 };
+    static constexpr unsigned char s_9[] = { 0xC3, 0xB6 };
+    static constexpr unsigned char s_10[] = { 'i', 'e' };
+    static constexpr unsigned char s_11[] = { 'e' };
+    static constexpr unsigned char s_12[] = { 'p', 'o' };
+    static constexpr unsigned char s_13[] = { 't' };
+    static constexpr unsigned char s_14[] = { 'p', 'o' };
+    static constexpr unsigned char s_15[] = { 'j' };
+    static constexpr unsigned char s_16[] = { 'o' };
+    static constexpr unsigned char s_17[] = { 'u' };
+    static constexpr unsigned char s_18[] = { 'o' };
+    static constexpr unsigned char s_19[] = { 'j' };
+};
+
+template <>
+struct finnish_stemmer_data<false> : finnish_stemmer_groupings {
+    static constexpr char32_t s_0_0[2] = { 'p', 'a' };
+    static constexpr char32_t s_0_1[3] = { 's', 't', 'i' };
+    static constexpr char32_t s_0_2[4] = { 'k', 'a', 'a', 'n' };
+    static constexpr char32_t s_0_3[3] = { 'h', 'a', 'n' };
+    static constexpr char32_t s_0_4[3] = { 'k', 'i', 'n' };
+    static constexpr char32_t s_0_5[3] = { 'h', 0xE4, 'n' };
+    static constexpr char32_t s_0_6[4] = { 'k', 0xE4, 0xE4, 'n' };
+    static constexpr char32_t s_0_7[2] = { 'k', 'o' };
+    static constexpr char32_t s_0_8[2] = { 'p', 0xE4 };
+    static constexpr char32_t s_0_9[2] = { 'k', 0xF6 };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 2, s_0_0, -1, 1, 0 },
+    /*  1 */ { 3, s_0_1, -1, 2, 0 },
+    /*  2 */ { 4, s_0_2, -1, 1, 0 },
+    /*  3 */ { 3, s_0_3, -1, 1, 0 },
+    /*  4 */ { 3, s_0_4, -1, 1, 0 },
+    /*  5 */ { 3, s_0_5, -1, 1, 0 },
+    /*  6 */ { 4, s_0_6, -1, 1, 0 },
+    /*  7 */ { 2, s_0_7, -1, 1, 0 },
+    /*  8 */ { 2, s_0_8, -1, 1, 0 },
+    /*  9 */ { 2, s_0_9, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[3] = { 'l', 'l', 'a' };
+    static constexpr char32_t s_1_1[2] = { 'n', 'a' };
+    static constexpr char32_t s_1_2[3] = { 's', 's', 'a' };
+    static constexpr char32_t s_1_3[2] = { 't', 'a' };
+    static constexpr char32_t s_1_4[3] = { 'l', 't', 'a' };
+    static constexpr char32_t s_1_5[3] = { 's', 't', 'a' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 3, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 },
+    /*  2 */ { 3, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 },
+    /*  4 */ { 3, s_1_4, 3, -1, 0 },
+    /*  5 */ { 3, s_1_5, 3, -1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[3] = { 'l', 'l', 0xE4 };
+    static constexpr char32_t s_2_1[2] = { 'n', 0xE4 };
+    static constexpr char32_t s_2_2[3] = { 's', 's', 0xE4 };
+    static constexpr char32_t s_2_3[2] = { 't', 0xE4 };
+    static constexpr char32_t s_2_4[3] = { 'l', 't', 0xE4 };
+    static constexpr char32_t s_2_5[3] = { 's', 't', 0xE4 };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 3, s_2_2, -1, -1, 0 },
+    /*  3 */ { 2, s_2_3, -1, -1, 0 },
+    /*  4 */ { 3, s_2_4, 3, -1, 0 },
+    /*  5 */ { 3, s_2_5, 3, -1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[3] = { 'l', 'l', 'e' };
+    static constexpr char32_t s_3_1[3] = { 'i', 'n', 'e' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 3, s_3_0, -1, -1, 0 },
+    /*  1 */ { 3, s_3_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[3] = { 'n', 's', 'a' };
+    static constexpr char32_t s_4_1[3] = { 'm', 'm', 'e' };
+    static constexpr char32_t s_4_2[3] = { 'n', 'n', 'e' };
+    static constexpr char32_t s_4_3[2] = { 'n', 'i' };
+    static constexpr char32_t s_4_4[2] = { 's', 'i' };
+    static constexpr char32_t s_4_5[2] = { 'a', 'n' };
+    static constexpr char32_t s_4_6[2] = { 'e', 'n' };
+    static constexpr char32_t s_4_7[2] = { 0xE4, 'n' };
+    static constexpr char32_t s_4_8[3] = { 'n', 's', 0xE4 };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 3, s_4_0, -1, 3, 0 },
+    /*  1 */ { 3, s_4_1, -1, 3, 0 },
+    /*  2 */ { 3, s_4_2, -1, 3, 0 },
+    /*  3 */ { 2, s_4_3, -1, 2, 0 },
+    /*  4 */ { 2, s_4_4, -1, 1, 0 },
+    /*  5 */ { 2, s_4_5, -1, 4, 0 },
+    /*  6 */ { 2, s_4_6, -1, 6, 0 },
+    /*  7 */ { 2, s_4_7, -1, 5, 0 },
+    /*  8 */ { 3, s_4_8, -1, 3, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 'a', 'a' };
+    static constexpr char32_t s_5_1[2] = { 'e', 'e' };
+    static constexpr char32_t s_5_2[2] = { 'i', 'i' };
+    static constexpr char32_t s_5_3[2] = { 'o', 'o' };
+    static constexpr char32_t s_5_4[2] = { 'u', 'u' };
+    static constexpr char32_t s_5_5[2] = { 0xE4, 0xE4 };
+    static constexpr char32_t s_5_6[2] = { 0xF6, 0xF6 };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, -1, 0 },
+    /*  1 */ { 2, s_5_1, -1, -1, 0 },
+    /*  2 */ { 2, s_5_2, -1, -1, 0 },
+    /*  3 */ { 2, s_5_3, -1, -1, 0 },
+    /*  4 */ { 2, s_5_4, -1, -1, 0 },
+    /*  5 */ { 2, s_5_5, -1, -1, 0 },
+    /*  6 */ { 2, s_5_6, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_6_0[1] = { 'a' };
+    static constexpr char32_t s_6_1[3] = { 'l', 'l', 'a' };
+    static constexpr char32_t s_6_2[2] = { 'n', 'a' };
+    static constexpr char32_t s_6_3[3] = { 's', 's', 'a' };
+    static constexpr char32_t s_6_4[2] = { 't', 'a' };
+    static constexpr char32_t s_6_5[3] = { 'l', 't', 'a' };
+    static constexpr char32_t s_6_6[3] = { 's', 't', 'a' };
+    static constexpr char32_t s_6_7[3] = { 't', 't', 'a' };
+    static constexpr char32_t s_6_8[3] = { 'l', 'l', 'e' };
+    static constexpr char32_t s_6_9[3] = { 'i', 'n', 'e' };
+    static constexpr char32_t s_6_10[3] = { 'k', 's', 'i' };
+    static constexpr char32_t s_6_11[1] = { 'n' };
+    static constexpr char32_t s_6_12[3] = { 'h', 'a', 'n' };
+    static constexpr char32_t s_6_13[3] = { 'd', 'e', 'n' };
+    static constexpr char32_t s_6_14[4] = { 's', 'e', 'e', 'n' };
+    static constexpr char32_t s_6_15[3] = { 'h', 'e', 'n' };
+    static constexpr char32_t s_6_16[4] = { 't', 't', 'e', 'n' };
+    static constexpr char32_t s_6_17[3] = { 'h', 'i', 'n' };
+    static constexpr char32_t s_6_18[4] = { 's', 'i', 'i', 'n' };
+    static constexpr char32_t s_6_19[3] = { 'h', 'o', 'n' };
+    static constexpr char32_t s_6_20[3] = { 'h', 0xE4, 'n' };
+    static constexpr char32_t s_6_21[3] = { 'h', 0xF6, 'n' };
+    static constexpr char32_t s_6_22[1] = { 0xE4 };
+    static constexpr char32_t s_6_23[3] = { 'l', 'l', 0xE4 };
+    static constexpr char32_t s_6_24[2] = { 'n', 0xE4 };
+    static constexpr char32_t s_6_25[3] = { 's', 's', 0xE4 };
+    static constexpr char32_t s_6_26[2] = { 't', 0xE4 };
+    static constexpr char32_t s_6_27[3] = { 'l', 't', 0xE4 };
+    static constexpr char32_t s_6_28[3] = { 's', 't', 0xE4 };
+    static constexpr char32_t s_6_29[3] = { 't', 't', 0xE4 };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 1, s_6_0, -1, 8, 0 },
+    /*  1 */ { 3, s_6_1, 0, -1, 0 },
+    /*  2 */ { 2, s_6_2, 0, -1, 0 },
+    /*  3 */ { 3, s_6_3, 0, -1, 0 },
+    /*  4 */ { 2, s_6_4, 0, -1, 0 },
+    /*  5 */ { 3, s_6_5, 4, -1, 0 },
+    /*  6 */ { 3, s_6_6, 4, -1, 0 },
+    /*  7 */ { 3, s_6_7, 4, 9, 0 },
+    /*  8 */ { 3, s_6_8, -1, -1, 0 },
+    /*  9 */ { 3, s_6_9, -1, -1, 0 },
+    /* 10 */ { 3, s_6_10, -1, -1, 0 },
+    /* 11 */ { 1, s_6_11, -1, 7, 0 },
+    /* 12 */ { 3, s_6_12, 11, 1, 0 },
+    /* 13 */ { 3, s_6_13, 11, -1, 1 },
+    /* 14 */ { 4, s_6_14, 11, -1, 2 },
+    /* 15 */ { 3, s_6_15, 11, 2, 0 },
+    /* 16 */ { 4, s_6_16, 11, -1, 1 },
+    /* 17 */ { 3, s_6_17, 11, 3, 0 },
+    /* 18 */ { 4, s_6_18, 11, -1, 1 },
+    /* 19 */ { 3, s_6_19, 11, 4, 0 },
+    /* 20 */ { 3, s_6_20, 11, 5, 0 },
+    /* 21 */ { 3, s_6_21, 11, 6, 0 },
+    /* 22 */ { 1, s_6_22, -1, 8, 0 },
+    /* 23 */ { 3, s_6_23, 22, -1, 0 },
+    /* 24 */ { 2, s_6_24, 22, -1, 0 },
+    /* 25 */ { 3, s_6_25, 22, -1, 0 },
+    /* 26 */ { 2, s_6_26, 22, -1, 0 },
+    /* 27 */ { 3, s_6_27, 26, -1, 0 },
+    /* 28 */ { 3, s_6_28, 26, -1, 0 },
+    /* 29 */ { 3, s_6_29, 26, 9, 0 }
+    };
+
+    static constexpr char32_t s_7_0[3] = { 'e', 'j', 'a' };
+    static constexpr char32_t s_7_1[3] = { 'm', 'm', 'a' };
+    static constexpr char32_t s_7_2[4] = { 'i', 'm', 'm', 'a' };
+    static constexpr char32_t s_7_3[3] = { 'm', 'p', 'a' };
+    static constexpr char32_t s_7_4[4] = { 'i', 'm', 'p', 'a' };
+    static constexpr char32_t s_7_5[3] = { 'm', 'm', 'i' };
+    static constexpr char32_t s_7_6[4] = { 'i', 'm', 'm', 'i' };
+    static constexpr char32_t s_7_7[3] = { 'm', 'p', 'i' };
+    static constexpr char32_t s_7_8[4] = { 'i', 'm', 'p', 'i' };
+    static constexpr char32_t s_7_9[3] = { 'e', 'j', 0xE4 };
+    static constexpr char32_t s_7_10[3] = { 'm', 'm', 0xE4 };
+    static constexpr char32_t s_7_11[4] = { 'i', 'm', 'm', 0xE4 };
+    static constexpr char32_t s_7_12[3] = { 'm', 'p', 0xE4 };
+    static constexpr char32_t s_7_13[4] = { 'i', 'm', 'p', 0xE4 };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 3, s_7_0, -1, -1, 0 },
+    /*  1 */ { 3, s_7_1, -1, 1, 0 },
+    /*  2 */ { 4, s_7_2, 1, -1, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 4, s_7_4, 3, -1, 0 },
+    /*  5 */ { 3, s_7_5, -1, 1, 0 },
+    /*  6 */ { 4, s_7_6, 5, -1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 4, s_7_8, 7, -1, 0 },
+    /*  9 */ { 3, s_7_9, -1, -1, 0 },
+    /* 10 */ { 3, s_7_10, -1, 1, 0 },
+    /* 11 */ { 4, s_7_11, 10, -1, 0 },
+    /* 12 */ { 3, s_7_12, -1, 1, 0 },
+    /* 13 */ { 4, s_7_13, 12, -1, 0 }
+    };
+
+    static constexpr char32_t s_8_0[1] = { 'i' };
+    static constexpr char32_t s_8_1[1] = { 'j' };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, -1, 0 },
+    /*  1 */ { 1, s_8_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_9_0[3] = { 'm', 'm', 'a' };
+    static constexpr char32_t s_9_1[4] = { 'i', 'm', 'm', 'a' };
+
+    static constexpr among<char32_t> a_9[] = {
+    /*  0 */ { 3, s_9_0, -1, 1, 0 },
+    /*  1 */ { 4, s_9_1, 0, -1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'k' };
+    static constexpr char32_t s_1[] = { 'k', 's', 'e' };
+    static constexpr char32_t s_2[] = { 'k', 's', 'i' };
+    static constexpr char32_t s_3[] = { 'i' };
+    static constexpr char32_t s_4[] = { 'a' };
+    static constexpr char32_t s_5[] = { 'e' };
+    static constexpr char32_t s_6[] = { 'i' };
+    static constexpr char32_t s_7[] = { 'o' };
+    static constexpr char32_t s_8[] = { 0xE4 };
+    static constexpr char32_t s_9[] = { 0xF6 };
+    static constexpr char32_t s_10[] = { 'i', 'e' };
+    static constexpr char32_t s_11[] = { 'e' };
+    static constexpr char32_t s_12[] = { 'p', 'o' };
+    static constexpr char32_t s_13[] = { 't' };
+    static constexpr char32_t s_14[] = { 'p', 'o' };
+    static constexpr char32_t s_15[] = { 'j' };
+    static constexpr char32_t s_16[] = { 'o' };
+    static constexpr char32_t s_17[] = { 'u' };
+    static constexpr char32_t s_18[] = { 'o' };
+    static constexpr char32_t s_19[] = { 'j' };
+};
+
+template <typename symbol>
+class finnish_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef finnish_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 43 */
+        I_p2 = l; /* $p2 = <integer expression>, line 44 */
+        if (out_grouping(data::g_V1, 97, 246, 1) < 0) return false; /* goto */ /* grouping V1, line 46 */
+        {    /* gopast */ /* non V1, line 46 */
+            int ret = in_grouping(data::g_V1, 97, 246, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p1 = c; /* setmark p1, line 46 */
+        if (out_grouping(data::g_V1, 97, 246, 1) < 0) return false; /* goto */ /* grouping V1, line 47 */
+        {    /* gopast */ /* non V1, line 47 */
+            int ret = in_grouping(data::g_V1, 97, 246, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p2 = c; /* setmark p2, line 47 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 52 */
+        return true;
+    }
+
+  private:
+    bool r_particle_etc() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 55 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 55 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 55 */
+            among_var = find_among_b(data::a_0); /* substring, line 55 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 55 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (in_grouping_b(data::g_particle_end, 97, 246, 0)) return false; /* grouping particle_end, line 62 */
+                break;
+            case 2:
+                if (!r_R2()) return false; /* call R2, line 64 */
+                break;
+        }
+        slice_del(); /* delete, line 66 */
+        return true;
+    }
+
+  private:
+    bool r_possessive() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 69 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 69 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 69 */
+            among_var = find_among_b(data::a_4); /* substring, line 69 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 69 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m2 = l - c; (void)m2; /* not, line 72 */
+                    if (!eq_s_b(data::s_0)) goto lab0; /* literal, line 72 */
+                    return false;
+                lab0:
+                    c = l - m2;
+                }
+                slice_del(); /* delete, line 72 */
+                break;
+            case 2:
+                slice_del(); /* delete, line 74 */
+                ket = c; /* [, line 74 */
+                if (!eq_s_b(data::s_1)) return false; /* literal, line 74 */
+                bra = c; /* ], line 74 */
+                slice_from(data::s_2); /* <-, line 74 */
+                break;
+            case 3:
+                slice_del(); /* delete, line 78 */
+                break;
+            case 4:
+                if (c - 1 <= lb || p[c - 1] != 97) return false; /* among, line 81 */
+                if (!find_among_b(data::a_1)) return false; /* among, line 81 */
+                slice_del(); /* delete, line 81 */
+                break;
+            case 5:
+                if (!find_among_b(data::a_2)) return false; /* among, line 83 */
+                slice_del(); /* delete, line 84 */
+                break;
+            case 6:
+                if (c - 2 <= lb || p[c - 1] != 101) return false; /* among, line 86 */
+                if (!find_among_b(data::a_3)) return false; /* among, line 86 */
+                slice_del(); /* delete, line 86 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_LONG() {
+        if (!find_among_b(data::a_5)) return false; /* among, line 91 */
+        return true;
+    }
+
+  private:
+    bool r_VI() {
+        if (!eq_s_b(data::s_3)) return false; /* literal, line 93 */
+        if (in_grouping_b(data::g_V2, 97, 246, 0)) return false; /* grouping V2, line 93 */
+        return true;
+    }
+
+  private:
+    bool r_case_ending() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 96 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 96 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 96 */
+            among_var = find_among_b(data::a_6, [this](int function) { return af_~I0(function); }); /* substring, line 96 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 96 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!eq_s_b(data::s_4)) return false; /* literal, line 98 */
+                break;
+            case 2:
+                if (!eq_s_b(data::s_5)) return false; /* literal, line 99 */
+                break;
+            case 3:
+                if (!eq_s_b(data::s_6)) return false; /* literal, line 100 */
+                break;
+            case 4:
+                if (!eq_s_b(data::s_7)) return false; /* literal, line 101 */
+                break;
+            case 5:
+                if (!eq_s_b(data::s_8)) return false; /* literal, line 102 */
+                break;
+            case 6:
+                if (!eq_s_b(data::s_9)) return false; /* literal, line 103 */
+                break;
+            case 7:
+                {   int m_keep = l - c; /* try, line 111 */
+                    {   int m2 = l - c; (void)m2; /* and, line 113 */
+                        {   int m3 = l - c; (void)m3; /* or, line 112 */
+                            if (!r_LONG()) goto lab2; /* call LONG, line 111 */
+                            goto lab1;
+                        lab2:
+                            c = l - m3;
+                            if (!eq_s_b(data::s_10)) { c = l - m_keep; goto lab0; } /* literal, line 112 */
+                        }
+                    lab1:
+                        c = l - m2;
+                        {   int ret = hop(c, lb, l, -1); /* next, line 113 */
+                            if (ret < 0) { c = l - m_keep; goto lab0; }
+                            c = ret;
+                        }
+                    }
+                    bra = c; /* ], line 113 */
+                lab0:
+                    ;
+                }
+                break;
+            case 8:
+                if (in_grouping_b(data::g_V1, 97, 246, 0)) return false; /* grouping V1, line 119 */
+                if (out_grouping_b(data::g_V1, 97, 246, 0)) return false; /* non V1, line 119 */
+                break;
+            case 9:
+                if (!eq_s_b(data::s_11)) return false; /* literal, line 121 */
+                break;
+        }
+        slice_del(); /* delete, line 138 */
+        B_ending_removed = true; /* set ending_removed, line 139 */
+        return true;
+    }
+
+  private:
+    bool r_other_endings() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 142 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p2) return false;
+            c = I_p2; /* tomark, line 142 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 142 */
+            among_var = find_among_b(data::a_7); /* substring, line 142 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 142 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m2 = l - c; (void)m2; /* not, line 146 */
+                    if (!eq_s_b(data::s_12)) goto lab0; /* literal, line 146 */
+                    return false;
+                lab0:
+                    c = l - m2;
+                }
+                break;
+        }
+        slice_del(); /* delete, line 151 */
+        return true;
+    }
+
+  private:
+    bool r_i_plural() {
+        {   int mlimit; /* setlimit, line 154 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 154 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 154 */
+            if (c <= lb || (p[c - 1] != 105 && p[c - 1] != 106)) { lb = mlimit; return false; } /* substring, line 154 */
+            if (!find_among_b(data::a_8)) { lb = mlimit; return false; } /* substring, line 154 */
+            bra = c; /* ], line 154 */
+            lb = mlimit;
+        }
+        slice_del(); /* delete, line 158 */
+        return true;
+    }
+
+  private:
+    bool r_t_plural() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 161 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 161 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 162 */
+            if (!eq_s_b(data::s_13)) { lb = mlimit; return false; } /* literal, line 162 */
+            bra = c; /* ], line 162 */
+            {   int m_test = l - c; /* test, line 162 */
+                if (in_grouping_b(data::g_V1, 97, 246, 0)) { lb = mlimit; return false; } /* grouping V1, line 162 */
+                c = l - m_test;
+            }
+            slice_del(); /* delete, line 163 */
+            lb = mlimit;
+        }
+        {   int mlimit; /* setlimit, line 165 */
+            int m2 = l - c; (void)m2;
+            if (c < I_p2) return false;
+            c = I_p2; /* tomark, line 165 */
+            mlimit = lb; lb = c;
+            c = l - m2;
+            ket = c; /* [, line 165 */
+            if (c - 2 <= lb || p[c - 1] != 97) { lb = mlimit; return false; } /* substring, line 165 */
+            among_var = find_among_b(data::a_9); /* substring, line 165 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 165 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m3 = l - c; (void)m3; /* not, line 167 */
+                    if (!eq_s_b(data::s_14)) goto lab0; /* literal, line 167 */
+                    return false;
+                lab0:
+                    c = l - m3;
+                }
+                break;
+        }
+        slice_del(); /* delete, line 170 */
+        return true;
+    }
+
+  private:
+    bool r_tidy() {
+        {   int mlimit; /* setlimit, line 173 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 173 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* do, line 174 */
+                {   int m3 = l - c; (void)m3; /* and, line 174 */
+                    if (!r_LONG()) goto lab0; /* call LONG, line 174 */
+                    c = l - m3;
+                    ket = c; /* [, line 174 */
+                    {   int ret = hop(c, lb, l, -1); /* next, line 174 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    bra = c; /* ], line 174 */
+                    slice_del(); /* delete, line 174 */
+                }
+            lab0:
+                c = l - m2;
+            }
+            {   int m4 = l - c; (void)m4; /* do, line 175 */
+                ket = c; /* [, line 175 */
+                if (in_grouping_b(data::g_AEI, 97, 228, 0)) goto lab1; /* grouping AEI, line 175 */
+                bra = c; /* ], line 175 */
+                if (out_grouping_b(data::g_V1, 97, 246, 0)) goto lab1; /* non V1, line 175 */
+                slice_del(); /* delete, line 175 */
+            lab1:
+                c = l - m4;
+            }
+            {   int m5 = l - c; (void)m5; /* do, line 176 */
+                ket = c; /* [, line 176 */
+                if (!eq_s_b(data::s_15)) goto lab2; /* literal, line 176 */
+                bra = c; /* ], line 176 */
+                {   int m6 = l - c; (void)m6; /* or, line 176 */
+                    if (!eq_s_b(data::s_16)) goto lab4; /* literal, line 176 */
+                    goto lab3;
+                lab4:
+                    c = l - m6;
+                    if (!eq_s_b(data::s_17)) goto lab2; /* literal, line 176 */
+                }
+            lab3:
+                slice_del(); /* delete, line 176 */
+            lab2:
+                c = l - m5;
+            }
+            {   int m7 = l - c; (void)m7; /* do, line 177 */
+                ket = c; /* [, line 177 */
+                if (!eq_s_b(data::s_18)) goto lab5; /* literal, line 177 */
+                bra = c; /* ], line 177 */
+                if (!eq_s_b(data::s_19)) goto lab5; /* literal, line 177 */
+                slice_del(); /* delete, line 177 */
+            lab5:
+                c = l - m7;
+            }
+            lb = mlimit;
+        }
+        if (in_grouping_b(data::g_V1, 97, 246, 1) < 0) return false; /* goto */ /* non V1, line 179 */
+        ket = c; /* [, line 179 */
+        {   int ret = hop(c, lb, l, -1); /* next, line 179 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        bra = c; /* ], line 179 */
+        slice_to(S_x); /* -> x, line 179 */
+        if (!eq_v_b(S_x)) return false; /* name x, line 179 */
+        slice_del(); /* delete, line 179 */
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 185 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 185 */
+        lab0:
+            c = c1;
+        }
+        B_ending_removed = false; /* unset ending_removed, line 186 */
+        lb = c; c = l; /* backwards, line 187 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 188 */
+            if (!r_particle_etc()) goto lab1; /* call particle_etc, line 188 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 189 */
+            if (!r_possessive()) goto lab2; /* call possessive, line 189 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 190 */
+            if (!r_case_ending()) goto lab3; /* call case_ending, line 190 */
+        lab3:
+            c = l - m4;
+        }
+        {   int m5 = l - c; (void)m5; /* do, line 191 */
+            if (!r_other_endings()) goto lab4; /* call other_endings, line 191 */
+        lab4:
+            c = l - m5;
+        }
+        {   int m6 = l - c; (void)m6; /* or, line 192 */
+            if (!B_ending_removed) goto lab6; /* Boolean test ending_removed, line 192 */
+            {   int m7 = l - c; (void)m7; /* do, line 192 */
+                if (!r_i_plural()) goto lab7; /* call i_plural, line 192 */
+            lab7:
+                c = l - m7;
+            }
+            goto lab5;
+        lab6:
+            c = l - m6;
+            {   int m8 = l - c; (void)m8; /* do, line 192 */
+                if (!r_t_plural()) goto lab8; /* call t_plural, line 192 */
+            lab8:
+                c = l - m8;
+            }
+        }
+    lab5:
+        {   int m9 = l - c; (void)m9; /* do, line 193 */
+            if (!r_tidy()) goto lab9; /* call tidy, line 193 */
+        lab9:
+            c = l - m9;
+        }
+        c = lb;
+        return true;
+    }
+
+  private:
+    bool af_6(int function) {
+        switch (function) {
+            case 1: return r_VI();
+            case 2: return r_LONG();
+        }
+        return false;
+    }
+
+  private:
+    bool B_ending_removed = false;
+    std::vector<symbol> S_x;
+    int I_p2 = 0;
+    int I_p1 = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,1411 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_FRENCH_STEMMER_HPP
+#define SNOWBALL_FRENCH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct french_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 130, 103, 8, 5 };
+    static constexpr unsigned char g_keep_with_s[] = { 1, 65, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+};
+
+template <bool utf8> struct french_stemmer_data;
+
+template <>
+struct french_stemmer_data<true> : french_stemmer_groupings {
+    static constexpr unsigned char s_0_0[3] = { 'c', 'o', 'l' };
+    static constexpr unsigned char s_0_1[3] = { 'p', 'a', 'r' };
+    static constexpr unsigned char s_0_2[3] = { 't', 'a', 'p' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 3, s_0_0, -1, -1, 0 },
+    /*  1 */ { 3, s_0_1, -1, -1, 0 },
+    /*  2 */ { 3, s_0_2, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_1_1[1] = { 'I' };
+    static constexpr unsigned char s_1_2[1] = { 'U' };
+    static constexpr unsigned char s_1_3[1] = { 'Y' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 4, 0 },
+    /*  1 */ { 1, s_1_1, 0, 1, 0 },
+    /*  2 */ { 1, s_1_2, 0, 2, 0 },
+    /*  3 */ { 1, s_1_3, 0, 3, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[3] = { 'i', 'q', 'U' };
+    static constexpr unsigned char s_2_1[3] = { 'a', 'b', 'l' };
+    static constexpr unsigned char s_2_2[4] = { 'I', 0xC3, 0xA8, 'r' };
+    static constexpr unsigned char s_2_3[4] = { 'i', 0xC3, 0xA8, 'r' };
+    static constexpr unsigned char s_2_4[3] = { 'e', 'u', 's' };
+    static constexpr unsigned char s_2_5[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, 3, 0 },
+    /*  1 */ { 3, s_2_1, -1, 3, 0 },
+    /*  2 */ { 4, s_2_2, -1, 4, 0 },
+    /*  3 */ { 4, s_2_3, -1, 4, 0 },
+    /*  4 */ { 3, s_2_4, -1, 2, 0 },
+    /*  5 */ { 2, s_2_5, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_3_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_3_2[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 2, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 },
+    /*  2 */ { 2, s_3_2, -1, 3, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[4] = { 'i', 'q', 'U', 'e' };
+    static constexpr unsigned char s_4_1[6] = { 'a', 't', 'r', 'i', 'c', 'e' };
+    static constexpr unsigned char s_4_2[4] = { 'a', 'n', 'c', 'e' };
+    static constexpr unsigned char s_4_3[4] = { 'e', 'n', 'c', 'e' };
+    static constexpr unsigned char s_4_4[5] = { 'l', 'o', 'g', 'i', 'e' };
+    static constexpr unsigned char s_4_5[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_4_6[4] = { 'i', 's', 'm', 'e' };
+    static constexpr unsigned char s_4_7[4] = { 'e', 'u', 's', 'e' };
+    static constexpr unsigned char s_4_8[4] = { 'i', 's', 't', 'e' };
+    static constexpr unsigned char s_4_9[3] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_4_10[2] = { 'i', 'f' };
+    static constexpr unsigned char s_4_11[5] = { 'u', 's', 'i', 'o', 'n' };
+    static constexpr unsigned char s_4_12[5] = { 'a', 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_4_13[5] = { 'u', 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_4_14[5] = { 'a', 't', 'e', 'u', 'r' };
+    static constexpr unsigned char s_4_15[5] = { 'i', 'q', 'U', 'e', 's' };
+    static constexpr unsigned char s_4_16[7] = { 'a', 't', 'r', 'i', 'c', 'e', 's' };
+    static constexpr unsigned char s_4_17[5] = { 'a', 'n', 'c', 'e', 's' };
+    static constexpr unsigned char s_4_18[5] = { 'e', 'n', 'c', 'e', 's' };
+    static constexpr unsigned char s_4_19[6] = { 'l', 'o', 'g', 'i', 'e', 's' };
+    static constexpr unsigned char s_4_20[5] = { 'a', 'b', 'l', 'e', 's' };
+    static constexpr unsigned char s_4_21[5] = { 'i', 's', 'm', 'e', 's' };
+    static constexpr unsigned char s_4_22[5] = { 'e', 'u', 's', 'e', 's' };
+    static constexpr unsigned char s_4_23[5] = { 'i', 's', 't', 'e', 's' };
+    static constexpr unsigned char s_4_24[4] = { 'i', 'v', 'e', 's' };
+    static constexpr unsigned char s_4_25[3] = { 'i', 'f', 's' };
+    static constexpr unsigned char s_4_26[6] = { 'u', 's', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_4_27[6] = { 'a', 't', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_4_28[6] = { 'u', 't', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_4_29[6] = { 'a', 't', 'e', 'u', 'r', 's' };
+    static constexpr unsigned char s_4_30[5] = { 'm', 'e', 'n', 't', 's' };
+    static constexpr unsigned char s_4_31[6] = { 'e', 'm', 'e', 'n', 't', 's' };
+    static constexpr unsigned char s_4_32[9] = { 'i', 's', 's', 'e', 'm', 'e', 'n', 't', 's' };
+    static constexpr unsigned char s_4_33[5] = { 'i', 't', 0xC3, 0xA9, 's' };
+    static constexpr unsigned char s_4_34[4] = { 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_4_35[5] = { 'e', 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_4_36[8] = { 'i', 's', 's', 'e', 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_4_37[6] = { 'a', 'm', 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_4_38[6] = { 'e', 'm', 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_4_39[3] = { 'a', 'u', 'x' };
+    static constexpr unsigned char s_4_40[4] = { 'e', 'a', 'u', 'x' };
+    static constexpr unsigned char s_4_41[3] = { 'e', 'u', 'x' };
+    static constexpr unsigned char s_4_42[4] = { 'i', 't', 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 4, s_4_0, -1, 1, 0 },
+    /*  1 */ { 6, s_4_1, -1, 2, 0 },
+    /*  2 */ { 4, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 5, 0 },
+    /*  4 */ { 5, s_4_4, -1, 3, 0 },
+    /*  5 */ { 4, s_4_5, -1, 1, 0 },
+    /*  6 */ { 4, s_4_6, -1, 1, 0 },
+    /*  7 */ { 4, s_4_7, -1, 11, 0 },
+    /*  8 */ { 4, s_4_8, -1, 1, 0 },
+    /*  9 */ { 3, s_4_9, -1, 8, 0 },
+    /* 10 */ { 2, s_4_10, -1, 8, 0 },
+    /* 11 */ { 5, s_4_11, -1, 4, 0 },
+    /* 12 */ { 5, s_4_12, -1, 2, 0 },
+    /* 13 */ { 5, s_4_13, -1, 4, 0 },
+    /* 14 */ { 5, s_4_14, -1, 2, 0 },
+    /* 15 */ { 5, s_4_15, -1, 1, 0 },
+    /* 16 */ { 7, s_4_16, -1, 2, 0 },
+    /* 17 */ { 5, s_4_17, -1, 1, 0 },
+    /* 18 */ { 5, s_4_18, -1, 5, 0 },
+    /* 19 */ { 6, s_4_19, -1, 3, 0 },
+    /* 20 */ { 5, s_4_20, -1, 1, 0 },
+    /* 21 */ { 5, s_4_21, -1, 1, 0 },
+    /* 22 */ { 5, s_4_22, -1, 11, 0 },
+    /* 23 */ { 5, s_4_23, -1, 1, 0 },
+    /* 24 */ { 4, s_4_24, -1, 8, 0 },
+    /* 25 */ { 3, s_4_25, -1, 8, 0 },
+    /* 26 */ { 6, s_4_26, -1, 4, 0 },
+    /* 27 */ { 6, s_4_27, -1, 2, 0 },
+    /* 28 */ { 6, s_4_28, -1, 4, 0 },
+    /* 29 */ { 6, s_4_29, -1, 2, 0 },
+    /* 30 */ { 5, s_4_30, -1, 15, 0 },
+    /* 31 */ { 6, s_4_31, 30, 6, 0 },
+    /* 32 */ { 9, s_4_32, 31, 12, 0 },
+    /* 33 */ { 5, s_4_33, -1, 7, 0 },
+    /* 34 */ { 4, s_4_34, -1, 15, 0 },
+    /* 35 */ { 5, s_4_35, 34, 6, 0 },
+    /* 36 */ { 8, s_4_36, 35, 12, 0 },
+    /* 37 */ { 6, s_4_37, 34, 13, 0 },
+    /* 38 */ { 6, s_4_38, 34, 14, 0 },
+    /* 39 */ { 3, s_4_39, -1, 10, 0 },
+    /* 40 */ { 4, s_4_40, 39, 9, 0 },
+    /* 41 */ { 3, s_4_41, -1, 1, 0 },
+    /* 42 */ { 4, s_4_42, -1, 7, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[3] = { 'i', 'r', 'a' };
+    static constexpr unsigned char s_5_1[2] = { 'i', 'e' };
+    static constexpr unsigned char s_5_2[4] = { 'i', 's', 's', 'e' };
+    static constexpr unsigned char s_5_3[7] = { 'i', 's', 's', 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_5_4[1] = { 'i' };
+    static constexpr unsigned char s_5_5[4] = { 'i', 'r', 'a', 'i' };
+    static constexpr unsigned char s_5_6[2] = { 'i', 'r' };
+    static constexpr unsigned char s_5_7[4] = { 'i', 'r', 'a', 's' };
+    static constexpr unsigned char s_5_8[3] = { 'i', 'e', 's' };
+    static constexpr unsigned char s_5_9[5] = { 0xC3, 0xAE, 'm', 'e', 's' };
+    static constexpr unsigned char s_5_10[5] = { 'i', 's', 's', 'e', 's' };
+    static constexpr unsigned char s_5_11[8] = { 'i', 's', 's', 'a', 'n', 't', 'e', 's' };
+    static constexpr unsigned char s_5_12[5] = { 0xC3, 0xAE, 't', 'e', 's' };
+    static constexpr unsigned char s_5_13[2] = { 'i', 's' };
+    static constexpr unsigned char s_5_14[5] = { 'i', 'r', 'a', 'i', 's' };
+    static constexpr unsigned char s_5_15[6] = { 'i', 's', 's', 'a', 'i', 's' };
+    static constexpr unsigned char s_5_16[6] = { 'i', 'r', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_5_17[7] = { 'i', 's', 's', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_5_18[5] = { 'i', 'r', 'o', 'n', 's' };
+    static constexpr unsigned char s_5_19[6] = { 'i', 's', 's', 'o', 'n', 's' };
+    static constexpr unsigned char s_5_20[7] = { 'i', 's', 's', 'a', 'n', 't', 's' };
+    static constexpr unsigned char s_5_21[2] = { 'i', 't' };
+    static constexpr unsigned char s_5_22[5] = { 'i', 'r', 'a', 'i', 't' };
+    static constexpr unsigned char s_5_23[6] = { 'i', 's', 's', 'a', 'i', 't' };
+    static constexpr unsigned char s_5_24[6] = { 'i', 's', 's', 'a', 'n', 't' };
+    static constexpr unsigned char s_5_25[7] = { 'i', 'r', 'a', 'I', 'e', 'n', 't' };
+    static constexpr unsigned char s_5_26[8] = { 'i', 's', 's', 'a', 'I', 'e', 'n', 't' };
+    static constexpr unsigned char s_5_27[5] = { 'i', 'r', 'e', 'n', 't' };
+    static constexpr unsigned char s_5_28[6] = { 'i', 's', 's', 'e', 'n', 't' };
+    static constexpr unsigned char s_5_29[5] = { 'i', 'r', 'o', 'n', 't' };
+    static constexpr unsigned char s_5_30[3] = { 0xC3, 0xAE, 't' };
+    static constexpr unsigned char s_5_31[5] = { 'i', 'r', 'i', 'e', 'z' };
+    static constexpr unsigned char s_5_32[6] = { 'i', 's', 's', 'i', 'e', 'z' };
+    static constexpr unsigned char s_5_33[4] = { 'i', 'r', 'e', 'z' };
+    static constexpr unsigned char s_5_34[5] = { 'i', 's', 's', 'e', 'z' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 3, s_5_0, -1, 1, 0 },
+    /*  1 */ { 2, s_5_1, -1, 1, 0 },
+    /*  2 */ { 4, s_5_2, -1, 1, 0 },
+    /*  3 */ { 7, s_5_3, -1, 1, 0 },
+    /*  4 */ { 1, s_5_4, -1, 1, 0 },
+    /*  5 */ { 4, s_5_5, 4, 1, 0 },
+    /*  6 */ { 2, s_5_6, -1, 1, 0 },
+    /*  7 */ { 4, s_5_7, -1, 1, 0 },
+    /*  8 */ { 3, s_5_8, -1, 1, 0 },
+    /*  9 */ { 5, s_5_9, -1, 1, 0 },
+    /* 10 */ { 5, s_5_10, -1, 1, 0 },
+    /* 11 */ { 8, s_5_11, -1, 1, 0 },
+    /* 12 */ { 5, s_5_12, -1, 1, 0 },
+    /* 13 */ { 2, s_5_13, -1, 1, 0 },
+    /* 14 */ { 5, s_5_14, 13, 1, 0 },
+    /* 15 */ { 6, s_5_15, 13, 1, 0 },
+    /* 16 */ { 6, s_5_16, -1, 1, 0 },
+    /* 17 */ { 7, s_5_17, -1, 1, 0 },
+    /* 18 */ { 5, s_5_18, -1, 1, 0 },
+    /* 19 */ { 6, s_5_19, -1, 1, 0 },
+    /* 20 */ { 7, s_5_20, -1, 1, 0 },
+    /* 21 */ { 2, s_5_21, -1, 1, 0 },
+    /* 22 */ { 5, s_5_22, 21, 1, 0 },
+    /* 23 */ { 6, s_5_23, 21, 1, 0 },
+    /* 24 */ { 6, s_5_24, -1, 1, 0 },
+    /* 25 */ { 7, s_5_25, -1, 1, 0 },
+    /* 26 */ { 8, s_5_26, -1, 1, 0 },
+    /* 27 */ { 5, s_5_27, -1, 1, 0 },
+    /* 28 */ { 6, s_5_28, -1, 1, 0 },
+    /* 29 */ { 5, s_5_29, -1, 1, 0 },
+    /* 30 */ { 3, s_5_30, -1, 1, 0 },
+    /* 31 */ { 5, s_5_31, -1, 1, 0 },
+    /* 32 */ { 6, s_5_32, -1, 1, 0 },
+    /* 33 */ { 4, s_5_33, -1, 1, 0 },
+    /* 34 */ { 5, s_5_34, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[1] = { 'a' };
+    static constexpr unsigned char s_6_1[3] = { 'e', 'r', 'a' };
+    static constexpr unsigned char s_6_2[4] = { 'a', 's', 's', 'e' };
+    static constexpr unsigned char s_6_3[4] = { 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_4[3] = { 0xC3, 0xA9, 'e' };
+    static constexpr unsigned char s_6_5[2] = { 'a', 'i' };
+    static constexpr unsigned char s_6_6[4] = { 'e', 'r', 'a', 'i' };
+    static constexpr unsigned char s_6_7[2] = { 'e', 'r' };
+    static constexpr unsigned char s_6_8[2] = { 'a', 's' };
+    static constexpr unsigned char s_6_9[4] = { 'e', 'r', 'a', 's' };
+    static constexpr unsigned char s_6_10[5] = { 0xC3, 0xA2, 'm', 'e', 's' };
+    static constexpr unsigned char s_6_11[5] = { 'a', 's', 's', 'e', 's' };
+    static constexpr unsigned char s_6_12[5] = { 'a', 'n', 't', 'e', 's' };
+    static constexpr unsigned char s_6_13[5] = { 0xC3, 0xA2, 't', 'e', 's' };
+    static constexpr unsigned char s_6_14[4] = { 0xC3, 0xA9, 'e', 's' };
+    static constexpr unsigned char s_6_15[3] = { 'a', 'i', 's' };
+    static constexpr unsigned char s_6_16[5] = { 'e', 'r', 'a', 'i', 's' };
+    static constexpr unsigned char s_6_17[4] = { 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_6_18[6] = { 'e', 'r', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_6_19[7] = { 'a', 's', 's', 'i', 'o', 'n', 's' };
+    static constexpr unsigned char s_6_20[5] = { 'e', 'r', 'o', 'n', 's' };
+    static constexpr unsigned char s_6_21[4] = { 'a', 'n', 't', 's' };
+    static constexpr unsigned char s_6_22[3] = { 0xC3, 0xA9, 's' };
+    static constexpr unsigned char s_6_23[3] = { 'a', 'i', 't' };
+    static constexpr unsigned char s_6_24[5] = { 'e', 'r', 'a', 'i', 't' };
+    static constexpr unsigned char s_6_25[3] = { 'a', 'n', 't' };
+    static constexpr unsigned char s_6_26[5] = { 'a', 'I', 'e', 'n', 't' };
+    static constexpr unsigned char s_6_27[7] = { 'e', 'r', 'a', 'I', 'e', 'n', 't' };
+    static constexpr unsigned char s_6_28[6] = { 0xC3, 0xA8, 'r', 'e', 'n', 't' };
+    static constexpr unsigned char s_6_29[6] = { 'a', 's', 's', 'e', 'n', 't' };
+    static constexpr unsigned char s_6_30[5] = { 'e', 'r', 'o', 'n', 't' };
+    static constexpr unsigned char s_6_31[3] = { 0xC3, 0xA2, 't' };
+    static constexpr unsigned char s_6_32[2] = { 'e', 'z' };
+    static constexpr unsigned char s_6_33[3] = { 'i', 'e', 'z' };
+    static constexpr unsigned char s_6_34[5] = { 'e', 'r', 'i', 'e', 'z' };
+    static constexpr unsigned char s_6_35[6] = { 'a', 's', 's', 'i', 'e', 'z' };
+    static constexpr unsigned char s_6_36[4] = { 'e', 'r', 'e', 'z' };
+    static constexpr unsigned char s_6_37[2] = { 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 1, s_6_0, -1, 3, 0 },
+    /*  1 */ { 3, s_6_1, 0, 2, 0 },
+    /*  2 */ { 4, s_6_2, -1, 3, 0 },
+    /*  3 */ { 4, s_6_3, -1, 3, 0 },
+    /*  4 */ { 3, s_6_4, -1, 2, 0 },
+    /*  5 */ { 2, s_6_5, -1, 3, 0 },
+    /*  6 */ { 4, s_6_6, 5, 2, 0 },
+    /*  7 */ { 2, s_6_7, -1, 2, 0 },
+    /*  8 */ { 2, s_6_8, -1, 3, 0 },
+    /*  9 */ { 4, s_6_9, 8, 2, 0 },
+    /* 10 */ { 5, s_6_10, -1, 3, 0 },
+    /* 11 */ { 5, s_6_11, -1, 3, 0 },
+    /* 12 */ { 5, s_6_12, -1, 3, 0 },
+    /* 13 */ { 5, s_6_13, -1, 3, 0 },
+    /* 14 */ { 4, s_6_14, -1, 2, 0 },
+    /* 15 */ { 3, s_6_15, -1, 3, 0 },
+    /* 16 */ { 5, s_6_16, 15, 2, 0 },
+    /* 17 */ { 4, s_6_17, -1, 1, 0 },
+    /* 18 */ { 6, s_6_18, 17, 2, 0 },
+    /* 19 */ { 7, s_6_19, 17, 3, 0 },
+    /* 20 */ { 5, s_6_20, -1, 2, 0 },
+    /* 21 */ { 4, s_6_21, -1, 3, 0 },
+    /* 22 */ { 3, s_6_22, -1, 2, 0 },
+    /* 23 */ { 3, s_6_23, -1, 3, 0 },
+    /* 24 */ { 5, s_6_24, 23, 2, 0 },
+    /* 25 */ { 3, s_6_25, -1, 3, 0 },
+    /* 26 */ { 5, s_6_26, -1, 3, 0 },
+    /* 27 */ { 7, s_6_27, 26, 2, 0 },
+    /* 28 */ { 6, s_6_28, -1, 2, 0 },
+    /* 29 */ { 6, s_6_29, -1, 3, 0 },
+    /* 30 */ { 5, s_6_30, -1, 2, 0 },
+    /* 31 */ { 3, s_6_31, -1, 3, 0 },
+    /* 32 */ { 2, s_6_32, -1, 2, 0 },
+    /* 33 */ { 3, s_6_33, 32, 2, 0 },
+    /* 34 */ { 5, s_6_34, 33, 2, 0 },
+    /* 35 */ { 6, s_6_35, 33, 3, 0 },
+    /* 36 */ { 4, s_6_36, 32, 2, 0 },
+    /* 37 */ { 2, s_6_37, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[1] = { 'e' };
+    static constexpr unsigned char s_7_1[5] = { 'I', 0xC3, 0xA8, 'r', 'e' };
+    static constexpr unsigned char s_7_2[5] = { 'i', 0xC3, 0xA8, 'r', 'e' };
+    static constexpr unsigned char s_7_3[3] = { 'i', 'o', 'n' };
+    static constexpr unsigned char s_7_4[3] = { 'I', 'e', 'r' };
+    static constexpr unsigned char s_7_5[3] = { 'i', 'e', 'r' };
+    static constexpr unsigned char s_7_6[2] = { 0xC3, 0xAB };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 1, s_7_0, -1, 3, 0 },
+    /*  1 */ { 5, s_7_1, 0, 2, 0 },
+    /*  2 */ { 5, s_7_2, 0, 2, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 3, s_7_4, -1, 2, 0 },
+    /*  5 */ { 3, s_7_5, -1, 2, 0 },
+    /*  6 */ { 2, s_7_6, -1, 4, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[3] = { 'e', 'l', 'l' };
+    static constexpr unsigned char s_8_1[4] = { 'e', 'i', 'l', 'l' };
+    static constexpr unsigned char s_8_2[3] = { 'e', 'n', 'n' };
+    static constexpr unsigned char s_8_3[3] = { 'o', 'n', 'n' };
+    static constexpr unsigned char s_8_4[3] = { 'e', 't', 't' };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 3, s_8_0, -1, -1, 0 },
+    /*  1 */ { 4, s_8_1, -1, -1, 0 },
+    /*  2 */ { 3, s_8_2, -1, -1, 0 },
+    /*  3 */ { 3, s_8_3, -1, -1, 0 },
+    /*  4 */ { 3, s_8_4, -1, -1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'u' };
+    static constexpr unsigned char s_1[] = { 'U' };
+    static constexpr unsigned char s_2[] = { 'i' };
+    static constexpr unsigned char s_3[] = { 'I' };
+    static constexpr unsigned char s_4[] = { 'y' };
+    static constexpr unsigned char s_5[] = { 'Y' };
+    static constexpr unsigned char s_6[] = { 'y' };
+    static constexpr unsigned char s_7[] = { 'Y' };
+    static constexpr unsigned char s_8[] = { 'q' };
+    static constexpr unsigned char s_9[] = { 'u' };
+    static constexpr unsigned char s_10[] = { 'U' };
+    static constexpr unsigned char s_11[] = { 'i' };
+    static constexpr unsigned char s_12[] = { 'u' };
+    static constexpr unsigned char s_13[] = { 'y' };
+    static constexpr unsigned char s_14[] = { 'i', 'c' };
+    static constexpr unsigned char s_15[] = { 'i', 'q', 'U' };
+    static constexpr unsigned char s_16[] = { 'l', 'o', 'g' };
+    static constexpr unsigned char s_17[] = { 'u' };
+    static constexpr unsigned char s_18[] = { 'e', 'n', 't' };
+    static constexpr unsigned char s_19[] = { 'a', 't' };
+    static constexpr unsigned char s_20[] = { 'e', 'u', 'x' };
+    static constexpr unsigned char s_21[] = { 'i' };
+    static constexpr unsigned char s_22[] = { 'a', 'b', 'l' };
+    static constexpr unsigned char s_23[] = { 'i', 'q', 'U' };
+    static constexpr unsigned char s_24[] = { 'a', 't' };
+    static constexpr unsigned char s_25[] = { 'i', 'c' };
+    static constexpr unsigned char s_26[] = { 'i', 'q', 'U' };
+    static constexpr unsigned char s_27[] = { 'e', 'a', 'u' };
+    static constexpr unsigned char s_28[] = { 'a', 'l' };
+    static constexpr unsigned char s_29[] = { 'e', 'u', 'x' };
+    static constexpr unsigned char s_30[] = { 'a', 'n', 't' };
+    static constexpr unsigned char s_31[] = { 'e', 'n', 't' };
+    static constexpr unsigned char s_32[] = { 'e' };
+    static constexpr unsigned char s_33[] = { 's' };
+    static constexpr unsigned char s_34[] = { 's' };
+    static constexpr unsigned char s_35[] = { 't' };
+    static constexpr unsigned char s_36[] = { 'i' };
+    static constexpr unsigned char s_37[] = { 'g', 'u' };
+    static constexpr unsigned char s_38[] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_39[] = { 0xC3, 0xA8 };
+    static constexpr unsigned char s_40[] = { 'e' };
+    static constexpr unsigned char s_41[] = { 'Y' };
+    static constexpr unsigned char s_42[] = { 'i' };
+    static constexpr unsigned char s_43[] = { 0xC3, 0xA7 };
+    static constexpr unsigned char s_44[] = { 'c' };
+};
+
+template <>
+struct french_stemmer_data<false> : french_stemmer_groupings {
+    static constexpr char32_t s_0_0[3] = { 'c', 'o', 'l' };
+    static constexpr char32_t s_0_1[3] = { 'p', 'a', 'r' };
+    static constexpr char32_t s_0_2[3] = { 't', 'a', 'p' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 3, s_0_0, -1, -1, 0 },
+    /*  1 */ { 3, s_0_1, -1, -1, 0 },
+    /*  2 */ { 3, s_0_2, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_1_1[1] = { 'I' };
+    static constexpr char32_t s_1_2[1] = { 'U' };
+    static constexpr char32_t s_1_3[1] = { 'Y' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 4, 0 },
+    /*  1 */ { 1, s_1_1, 0, 1, 0 },
+    /*  2 */ { 1, s_1_2, 0, 2, 0 },
+    /*  3 */ { 1, s_1_3, 0, 3, 0 }
+    };
+
+    static constexpr char32_t s_2_0[3] = { 'i', 'q', 'U' };
+    static constexpr char32_t s_2_1[3] = { 'a', 'b', 'l' };
+    static constexpr char32_t s_2_2[3] = { 'I', 0xE8, 'r' };
+    static constexpr char32_t s_2_3[3] = { 'i', 0xE8, 'r' };
+    static constexpr char32_t s_2_4[3] = { 'e', 'u', 's' };
+    static constexpr char32_t s_2_5[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, 3, 0 },
+    /*  1 */ { 3, s_2_1, -1, 3, 0 },
+    /*  2 */ { 3, s_2_2, -1, 4, 0 },
+    /*  3 */ { 3, s_2_3, -1, 4, 0 },
+    /*  4 */ { 3, s_2_4, -1, 2, 0 },
+    /*  5 */ { 2, s_2_5, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_3_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_3_2[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 2, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 },
+    /*  2 */ { 2, s_3_2, -1, 3, 0 }
+    };
+
+    static constexpr char32_t s_4_0[4] = { 'i', 'q', 'U', 'e' };
+    static constexpr char32_t s_4_1[6] = { 'a', 't', 'r', 'i', 'c', 'e' };
+    static constexpr char32_t s_4_2[4] = { 'a', 'n', 'c', 'e' };
+    static constexpr char32_t s_4_3[4] = { 'e', 'n', 'c', 'e' };
+    static constexpr char32_t s_4_4[5] = { 'l', 'o', 'g', 'i', 'e' };
+    static constexpr char32_t s_4_5[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_4_6[4] = { 'i', 's', 'm', 'e' };
+    static constexpr char32_t s_4_7[4] = { 'e', 'u', 's', 'e' };
+    static constexpr char32_t s_4_8[4] = { 'i', 's', 't', 'e' };
+    static constexpr char32_t s_4_9[3] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_4_10[2] = { 'i', 'f' };
+    static constexpr char32_t s_4_11[5] = { 'u', 's', 'i', 'o', 'n' };
+    static constexpr char32_t s_4_12[5] = { 'a', 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_4_13[5] = { 'u', 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_4_14[5] = { 'a', 't', 'e', 'u', 'r' };
+    static constexpr char32_t s_4_15[5] = { 'i', 'q', 'U', 'e', 's' };
+    static constexpr char32_t s_4_16[7] = { 'a', 't', 'r', 'i', 'c', 'e', 's' };
+    static constexpr char32_t s_4_17[5] = { 'a', 'n', 'c', 'e', 's' };
+    static constexpr char32_t s_4_18[5] = { 'e', 'n', 'c', 'e', 's' };
+    static constexpr char32_t s_4_19[6] = { 'l', 'o', 'g', 'i', 'e', 's' };
+    static constexpr char32_t s_4_20[5] = { 'a', 'b', 'l', 'e', 's' };
+    static constexpr char32_t s_4_21[5] = { 'i', 's', 'm', 'e', 's' };
+    static constexpr char32_t s_4_22[5] = { 'e', 'u', 's', 'e', 's' };
+    static constexpr char32_t s_4_23[5] = { 'i', 's', 't', 'e', 's' };
+    static constexpr char32_t s_4_24[4] = { 'i', 'v', 'e', 's' };
+    static constexpr char32_t s_4_25[3] = { 'i', 'f', 's' };
+    static constexpr char32_t s_4_26[6] = { 'u', 's', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_4_27[6] = { 'a', 't', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_4_28[6] = { 'u', 't', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_4_29[6] = { 'a', 't', 'e', 'u', 'r', 's' };
+    static constexpr char32_t s_4_30[5] = { 'm', 'e', 'n', 't', 's' };
+    static constexpr char32_t s_4_31[6] = { 'e', 'm', 'e', 'n', 't', 's' };
+    static constexpr char32_t s_4_32[9] = { 'i', 's', 's', 'e', 'm', 'e', 'n', 't', 's' };
+    static constexpr char32_t s_4_33[4] = { 'i', 't', 0xE9, 's' };
+    static constexpr char32_t s_4_34[4] = { 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_4_35[5] = { 'e', 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_4_36[8] = { 'i', 's', 's', 'e', 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_4_37[6] = { 'a', 'm', 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_4_38[6] = { 'e', 'm', 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_4_39[3] = { 'a', 'u', 'x' };
+    static constexpr char32_t s_4_40[4] = { 'e', 'a', 'u', 'x' };
+    static constexpr char32_t s_4_41[3] = { 'e', 'u', 'x' };
+    static constexpr char32_t s_4_42[3] = { 'i', 't', 0xE9 };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 4, s_4_0, -1, 1, 0 },
+    /*  1 */ { 6, s_4_1, -1, 2, 0 },
+    /*  2 */ { 4, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 5, 0 },
+    /*  4 */ { 5, s_4_4, -1, 3, 0 },
+    /*  5 */ { 4, s_4_5, -1, 1, 0 },
+    /*  6 */ { 4, s_4_6, -1, 1, 0 },
+    /*  7 */ { 4, s_4_7, -1, 11, 0 },
+    /*  8 */ { 4, s_4_8, -1, 1, 0 },
+    /*  9 */ { 3, s_4_9, -1, 8, 0 },
+    /* 10 */ { 2, s_4_10, -1, 8, 0 },
+    /* 11 */ { 5, s_4_11, -1, 4, 0 },
+    /* 12 */ { 5, s_4_12, -1, 2, 0 },
+    /* 13 */ { 5, s_4_13, -1, 4, 0 },
+    /* 14 */ { 5, s_4_14, -1, 2, 0 },
+    /* 15 */ { 5, s_4_15, -1, 1, 0 },
+    /* 16 */ { 7, s_4_16, -1, 2, 0 },
+    /* 17 */ { 5, s_4_17, -1, 1, 0 },
+    /* 18 */ { 5, s_4_18, -1, 5, 0 },
+    /* 19 */ { 6, s_4_19, -1, 3, 0 },
+    /* 20 */ { 5, s_4_20, -1, 1, 0 },
+    /* 21 */ { 5, s_4_21, -1, 1, 0 },
+    /* 22 */ { 5, s_4_22, -1, 11, 0 },
+    /* 23 */ { 5, s_4_23, -1, 1, 0 },
+    /* 24 */ { 4, s_4_24, -1, 8, 0 },
+    /* 25 */ { 3, s_4_25, -1, 8, 0 },
+    /* 26 */ { 6, s_4_26, -1, 4, 0 },
+    /* 27 */ { 6, s_4_27, -1, 2, 0 },
+    /* 28 */ { 6, s_4_28, -1, 4, 0 },
+    /* 29 */ { 6, s_4_29, -1, 2, 0 },
+    /* 30 */ { 5, s_4_30, -1, 15, 0 },
+    /* 31 */ { 6, s_4_31, 30, 6, 0 },
+    /* 32 */ { 9, s_4_32, 31, 12, 0 },
+    /* 33 */ { 4, s_4_33, -1, 7, 0 },
+    /* 34 */ { 4, s_4_34, -1, 15, 0 },
+    /* 35 */ { 5, s_4_35, 34, 6, 0 },
+    /* 36 */ { 8, s_4_36, 35, 12, 0 },
+    /* 37 */ { 6, s_4_37, 34, 13, 0 },
+    /* 38 */ { 6, s_4_38, 34, 14, 0 },
+    /* 39 */ { 3, s_4_39, -1, 10, 0 },
+    /* 40 */ { 4, s_4_40, 39, 9, 0 },
+    /* 41 */ { 3, s_4_41, -1, 1, 0 },
+    /* 42 */ { 3, s_4_42, -1, 7, 0 }
+    };
+
+    static constexpr char32_t s_5_0[3] = { 'i', 'r', 'a' };
+    static constexpr char32_t s_5_1[2] = { 'i', 'e' };
+    static constexpr char32_t s_5_2[4] = { 'i', 's', 's', 'e' };
+    static constexpr char32_t s_5_3[7] = { 'i', 's', 's', 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_5_4[1] = { 'i' };
+    static constexpr char32_t s_5_5[4] = { 'i', 'r', 'a', 'i' };
+    static constexpr char32_t s_5_6[2] = { 'i', 'r' };
+    static constexpr char32_t s_5_7[4] = { 'i', 'r', 'a', 's' };
+    static constexpr char32_t s_5_8[3] = { 'i', 'e', 's' };
+    static constexpr char32_t s_5_9[4] = { 0xEE, 'm', 'e', 's' };
+    static constexpr char32_t s_5_10[5] = { 'i', 's', 's', 'e', 's' };
+    static constexpr char32_t s_5_11[8] = { 'i', 's', 's', 'a', 'n', 't', 'e', 's' };
+    static constexpr char32_t s_5_12[4] = { 0xEE, 't', 'e', 's' };
+    static constexpr char32_t s_5_13[2] = { 'i', 's' };
+    static constexpr char32_t s_5_14[5] = { 'i', 'r', 'a', 'i', 's' };
+    static constexpr char32_t s_5_15[6] = { 'i', 's', 's', 'a', 'i', 's' };
+    static constexpr char32_t s_5_16[6] = { 'i', 'r', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_5_17[7] = { 'i', 's', 's', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_5_18[5] = { 'i', 'r', 'o', 'n', 's' };
+    static constexpr char32_t s_5_19[6] = { 'i', 's', 's', 'o', 'n', 's' };
+    static constexpr char32_t s_5_20[7] = { 'i', 's', 's', 'a', 'n', 't', 's' };
+    static constexpr char32_t s_5_21[2] = { 'i', 't' };
+    static constexpr char32_t s_5_22[5] = { 'i', 'r', 'a', 'i', 't' };
+    static constexpr char32_t s_5_23[6] = { 'i', 's', 's', 'a', 'i', 't' };
+    static constexpr char32_t s_5_24[6] = { 'i', 's', 's', 'a', 'n', 't' };
+    static constexpr char32_t s_5_25[7] = { 'i', 'r', 'a', 'I', 'e', 'n', 't' };
+    static constexpr char32_t s_5_26[8] = { 'i', 's', 's', 'a', 'I', 'e', 'n', 't' };
+    static constexpr char32_t s_5_27[5] = { 'i', 'r', 'e', 'n', 't' };
+    static constexpr char32_t s_5_28[6] = { 'i', 's', 's', 'e', 'n', 't' };
+    static constexpr char32_t s_5_29[5] = { 'i', 'r', 'o', 'n', 't' };
+    static constexpr char32_t s_5_30[2] = { 0xEE, 't' };
+    static constexpr char32_t s_5_31[5] = { 'i', 'r', 'i', 'e', 'z' };
+    static constexpr char32_t s_5_32[6] = { 'i', 's', 's', 'i', 'e', 'z' };
+    static constexpr char32_t s_5_33[4] = { 'i', 'r', 'e', 'z' };
+    static constexpr char32_t s_5_34[5] = { 'i', 's', 's', 'e', 'z' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 3, s_5_0, -1, 1, 0 },
+    /*  1 */ { 2, s_5_1, -1, 1, 0 },
+    /*  2 */ { 4, s_5_2, -1, 1, 0 },
+    /*  3 */ { 7, s_5_3, -1, 1, 0 },
+    /*  4 */ { 1, s_5_4, -1, 1, 0 },
+    /*  5 */ { 4, s_5_5, 4, 1, 0 },
+    /*  6 */ { 2, s_5_6, -1, 1, 0 },
+    /*  7 */ { 4, s_5_7, -1, 1, 0 },
+    /*  8 */ { 3, s_5_8, -1, 1, 0 },
+    /*  9 */ { 4, s_5_9, -1, 1, 0 },
+    /* 10 */ { 5, s_5_10, -1, 1, 0 },
+    /* 11 */ { 8, s_5_11, -1, 1, 0 },
+    /* 12 */ { 4, s_5_12, -1, 1, 0 },
+    /* 13 */ { 2, s_5_13, -1, 1, 0 },
+    /* 14 */ { 5, s_5_14, 13, 1, 0 },
+    /* 15 */ { 6, s_5_15, 13, 1, 0 },
+    /* 16 */ { 6, s_5_16, -1, 1, 0 },
+    /* 17 */ { 7, s_5_17, -1, 1, 0 },
+    /* 18 */ { 5, s_5_18, -1, 1, 0 },
+    /* 19 */ { 6, s_5_19, -1, 1, 0 },
+    /* 20 */ { 7, s_5_20, -1, 1, 0 },
+    /* 21 */ { 2, s_5_21, -1, 1, 0 },
+    /* 22 */ { 5, s_5_22, 21, 1, 0 },
+    /* 23 */ { 6, s_5_23, 21, 1, 0 },
+    /* 24 */ { 6, s_5_24, -1, 1, 0 },
+    /* 25 */ { 7, s_5_25, -1, 1, 0 },
+    /* 26 */ { 8, s_5_26, -1, 1, 0 },
+    /* 27 */ { 5, s_5_27, -1, 1, 0 },
+    /* 28 */ { 6, s_5_28, -1, 1, 0 },
+    /* 29 */ { 5, s_5_29, -1, 1, 0 },
+    /* 30 */ { 2, s_5_30, -1, 1, 0 },
+    /* 31 */ { 5, s_5_31, -1, 1, 0 },
+    /* 32 */ { 6, s_5_32, -1, 1, 0 },
+    /* 33 */ { 4, s_5_33, -1, 1, 0 },
+    /* 34 */ { 5, s_5_34, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_6_0[1] = { 'a' };
+    static constexpr char32_t s_6_1[3] = { 'e', 'r', 'a' };
+    static constexpr char32_t s_6_2[4] = { 'a', 's', 's', 'e' };
+    static constexpr char32_t s_6_3[4] = { 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_6_4[2] = { 0xE9, 'e' };
+    static constexpr char32_t s_6_5[2] = { 'a', 'i' };
+    static constexpr char32_t s_6_6[4] = { 'e', 'r', 'a', 'i' };
+    static constexpr char32_t s_6_7[2] = { 'e', 'r' };
+    static constexpr char32_t s_6_8[2] = { 'a', 's' };
+    static constexpr char32_t s_6_9[4] = { 'e', 'r', 'a', 's' };
+    static constexpr char32_t s_6_10[4] = { 0xE2, 'm', 'e', 's' };
+    static constexpr char32_t s_6_11[5] = { 'a', 's', 's', 'e', 's' };
+    static constexpr char32_t s_6_12[5] = { 'a', 'n', 't', 'e', 's' };
+    static constexpr char32_t s_6_13[4] = { 0xE2, 't', 'e', 's' };
+    static constexpr char32_t s_6_14[3] = { 0xE9, 'e', 's' };
+    static constexpr char32_t s_6_15[3] = { 'a', 'i', 's' };
+    static constexpr char32_t s_6_16[5] = { 'e', 'r', 'a', 'i', 's' };
+    static constexpr char32_t s_6_17[4] = { 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_6_18[6] = { 'e', 'r', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_6_19[7] = { 'a', 's', 's', 'i', 'o', 'n', 's' };
+    static constexpr char32_t s_6_20[5] = { 'e', 'r', 'o', 'n', 's' };
+    static constexpr char32_t s_6_21[4] = { 'a', 'n', 't', 's' };
+    static constexpr char32_t s_6_22[2] = { 0xE9, 's' };
+    static constexpr char32_t s_6_23[3] = { 'a', 'i', 't' };
+    static constexpr char32_t s_6_24[5] = { 'e', 'r', 'a', 'i', 't' };
+    static constexpr char32_t s_6_25[3] = { 'a', 'n', 't' };
+    static constexpr char32_t s_6_26[5] = { 'a', 'I', 'e', 'n', 't' };
+    static constexpr char32_t s_6_27[7] = { 'e', 'r', 'a', 'I', 'e', 'n', 't' };
+    static constexpr char32_t s_6_28[5] = { 0xE8, 'r', 'e', 'n', 't' };
+    static constexpr char32_t s_6_29[6] = { 'a', 's', 's', 'e', 'n', 't' };
+    static constexpr char32_t s_6_30[5] = { 'e', 'r', 'o', 'n', 't' };
+    static constexpr char32_t s_6_31[2] = { 0xE2, 't' };
+    static constexpr char32_t s_6_32[2] = { 'e', 'z' };
+    static constexpr char32_t s_6_33[3] = { 'i', 'e', 'z' };
+    static constexpr char32_t s_6_34[5] = { 'e', 'r', 'i', 'e', 'z' };
+    static constexpr char32_t s_6_35[6] = { 'a', 's', 's', 'i', 'e', 'z' };
+    static constexpr char32_t s_6_36[4] = { 'e', 'r', 'e', 'z' };
+    static constexpr char32_t s_6_37[1] = { 0xE9 };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 1, s_6_0, -1, 3, 0 },
+    /*  1 */ { 3, s_6_1, 0, 2, 0 },
+    /*  2 */ { 4, s_6_2, -1, 3, 0 },
+    /*  3 */ { 4, s_6_3, -1, 3, 0 },
+    /*  4 */ { 2, s_6_4, -1, 2, 0 },
+    /*  5 */ { 2, s_6_5, -1, 3, 0 },
+    /*  6 */ { 4, s_6_6, 5, 2, 0 },
+    /*  7 */ { 2, s_6_7, -1, 2, 0 },
+    /*  8 */ { 2, s_6_8, -1, 3, 0 },
+    /*  9 */ { 4, s_6_9, 8, 2, 0 },
+    /* 10 */ { 4, s_6_10, -1, 3, 0 },
+    /* 11 */ { 5, s_6_11, -1, 3, 0 },
+    /* 12 */ { 5, s_6_12, -1, 3, 0 },
+    /* 13 */ { 4, s_6_13, -1, 3, 0 },
+    /* 14 */ { 3, s_6_14, -1, 2, 0 },
+    /* 15 */ { 3, s_6_15, -1, 3, 0 },
+    /* 16 */ { 5, s_6_16, 15, 2, 0 },
+    /* 17 */ { 4, s_6_17, -1, 1, 0 },
+    /* 18 */ { 6, s_6_18, 17, 2, 0 },
+    /* 19 */ { 7, s_6_19, 17, 3, 0 },
+    /* 20 */ { 5, s_6_20, -1, 2, 0 },
+    /* 21 */ { 4, s_6_21, -1, 3, 0 },
+    /* 22 */ { 2, s_6_22, -1, 2, 0 },
+    /* 23 */ { 3, s_6_23, -1, 3, 0 },
+    /* 24 */ { 5, s_6_24, 23, 2, 0 },
+    /* 25 */ { 3, s_6_25, -1, 3, 0 },
+    /* 26 */ { 5, s_6_26, -1, 3, 0 },
+    /* 27 */ { 7, s_6_27, 26, 2, 0 },
+    /* 28 */ { 5, s_6_28, -1, 2, 0 },
+    /* 29 */ { 6, s_6_29, -1, 3, 0 },
+    /* 30 */ { 5, s_6_30, -1, 2, 0 },
+    /* 31 */ { 2, s_6_31, -1, 3, 0 },
+    /* 32 */ { 2, s_6_32, -1, 2, 0 },
+    /* 33 */ { 3, s_6_33, 32, 2, 0 },
+    /* 34 */ { 5, s_6_34, 33, 2, 0 },
+    /* 35 */ { 6, s_6_35, 33, 3, 0 },
+    /* 36 */ { 4, s_6_36, 32, 2, 0 },
+    /* 37 */ { 1, s_6_37, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_7_0[1] = { 'e' };
+    static constexpr char32_t s_7_1[4] = { 'I', 0xE8, 'r', 'e' };
+    static constexpr char32_t s_7_2[4] = { 'i', 0xE8, 'r', 'e' };
+    static constexpr char32_t s_7_3[3] = { 'i', 'o', 'n' };
+    static constexpr char32_t s_7_4[3] = { 'I', 'e', 'r' };
+    static constexpr char32_t s_7_5[3] = { 'i', 'e', 'r' };
+    static constexpr char32_t s_7_6[1] = { 0xEB };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 1, s_7_0, -1, 3, 0 },
+    /*  1 */ { 4, s_7_1, 0, 2, 0 },
+    /*  2 */ { 4, s_7_2, 0, 2, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 3, s_7_4, -1, 2, 0 },
+    /*  5 */ { 3, s_7_5, -1, 2, 0 },
+    /*  6 */ { 1, s_7_6, -1, 4, 0 }
+    };
+
+    static constexpr char32_t s_8_0[3] = { 'e', 'l', 'l' };
+    static constexpr char32_t s_8_1[4] = { 'e', 'i', 'l', 'l' };
+    static constexpr char32_t s_8_2[3] = { 'e', 'n', 'n' };
+    static constexpr char32_t s_8_3[3] = { 'o', 'n', 'n' };
+    static constexpr char32_t s_8_4[3] = { 'e', 't', 't' };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 3, s_8_0, -1, -1, 0 },
+    /*  1 */ { 4, s_8_1, -1, -1, 0 },
+    /*  2 */ { 3, s_8_2, -1, -1, 0 },
+    /*  3 */ { 3, s_8_3, -1, -1, 0 },
+    /*  4 */ { 3, s_8_4, -1, -1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'u' };
+    static constexpr char32_t s_1[] = { 'U' };
+    static constexpr char32_t s_2[] = { 'i' };
+    static constexpr char32_t s_3[] = { 'I' };
+    static constexpr char32_t s_4[] = { 'y' };
+    static constexpr char32_t s_5[] = { 'Y' };
+    static constexpr char32_t s_6[] = { 'y' };
+    static constexpr char32_t s_7[] = { 'Y' };
+    static constexpr char32_t s_8[] = { 'q' };
+    static constexpr char32_t s_9[] = { 'u' };
+    static constexpr char32_t s_10[] = { 'U' };
+    static constexpr char32_t s_11[] = { 'i' };
+    static constexpr char32_t s_12[] = { 'u' };
+    static constexpr char32_t s_13[] = { 'y' };
+    static constexpr char32_t s_14[] = { 'i', 'c' };
+    static constexpr char32_t s_15[] = { 'i', 'q', 'U' };
+    static constexpr char32_t s_16[] = { 'l', 'o', 'g' };
+    static constexpr char32_t s_17[] = { 'u' };
+    static constexpr char32_t s_18[] = { 'e', 'n', 't' };
+    static constexpr char32_t s_19[] = { 'a', 't' };
+    static constexpr char32_t s_20[] = { 'e', 'u', 'x' };
+    static constexpr char32_t s_21[] = { 'i' };
+    static constexpr char32_t s_22[] = { 'a', 'b', 'l' };
+    static constexpr char32_t s_23[] = { 'i', 'q', 'U' };
+    static constexpr char32_t s_24[] = { 'a', 't' };
+    static constexpr char32_t s_25[] = { 'i', 'c' };
+    static constexpr char32_t s_26[] = { 'i', 'q', 'U' };
+    static constexpr char32_t s_27[] = { 'e', 'a', 'u' };
+    static constexpr char32_t s_28[] = { 'a', 'l' };
+    static constexpr char32_t s_29[] = { 'e', 'u', 'x' };
+    static constexpr char32_t s_30[] = { 'a', 'n', 't' };
+    static constexpr char32_t s_31[] = { 'e', 'n', 't' };
+    static constexpr char32_t s_32[] = { 'e' };
+    static constexpr char32_t s_33[] = { 's' };
+    static constexpr char32_t s_34[] = { 's' };
+    static constexpr char32_t s_35[] = { 't' };
+    static constexpr char32_t s_36[] = { 'i' };
+    static constexpr char32_t s_37[] = { 'g', 'u' };
+    static constexpr char32_t s_38[] = { 0xE9 };
+    static constexpr char32_t s_39[] = { 0xE8 };
+    static constexpr char32_t s_40[] = { 'e' };
+    static constexpr char32_t s_41[] = { 'Y' };
+    static constexpr char32_t s_42[] = { 'i' };
+    static constexpr char32_t s_43[] = { 0xE7 };
+    static constexpr char32_t s_44[] = { 'c' };
+};
+
+template <typename symbol>
+class french_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef french_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        while(1) { /* repeat, line 38 */
+            int c1 = c;
+            while(1) { /* goto, line 38 */
+                int c2 = c;
+                {   int c3 = c; /* or, line 44 */
+                    if (in_grouping(data::g_v, 97, 251, 0)) goto lab3; /* grouping v, line 40 */
+                    bra = c; /* [, line 40 */
+                    {   int c4 = c; /* or, line 40 */
+                        if (!eq_s(data::s_0)) goto lab5; /* literal, line 40 */
+                        ket = c; /* ], line 40 */
+                        if (in_grouping(data::g_v, 97, 251, 0)) goto lab5; /* grouping v, line 40 */
+                        slice_from(data::s_1); /* <-, line 40 */
+                        goto lab4;
+                    lab5:
+                        c = c4;
+                        if (!eq_s(data::s_2)) goto lab6; /* literal, line 41 */
+                        ket = c; /* ], line 41 */
+                        if (in_grouping(data::g_v, 97, 251, 0)) goto lab6; /* grouping v, line 41 */
+                        slice_from(data::s_3); /* <-, line 41 */
+                        goto lab4;
+                    lab6:
+                        c = c4;
+                        if (!eq_s(data::s_4)) goto lab3; /* literal, line 42 */
+                        ket = c; /* ], line 42 */
+                        slice_from(data::s_5); /* <-, line 42 */
+                    }
+                lab4:
+                    goto lab2;
+                lab3:
+                    c = c3;
+                    bra = c; /* [, line 45 */
+                    if (!eq_s(data::s_6)) goto lab7; /* literal, line 45 */
+                    ket = c; /* ], line 45 */
+                    if (in_grouping(data::g_v, 97, 251, 0)) goto lab7; /* grouping v, line 45 */
+                    slice_from(data::s_7); /* <-, line 45 */
+                    goto lab2;
+                lab7:
+                    c = c3;
+                    if (!eq_s(data::s_8)) goto lab1; /* literal, line 47 */
+                    bra = c; /* [, line 47 */
+                    if (!eq_s(data::s_9)) goto lab1; /* literal, line 47 */
+                    ket = c; /* ], line 47 */
+                    slice_from(data::s_10); /* <-, line 47 */
+                }
+            lab2:
+                c = c2;
+                break;
+            lab1:
+                c = c2;
+                {   int ret = hop(c, 0, l, 1); /* goto, line 38 */
+                    if (ret < 0) goto lab0;
+                    c = ret;
+                }
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_pV = l; /* $pV = <integer expression>, line 52 */
+        I_p1 = l; /* $p1 = <integer expression>, line 53 */
+        I_p2 = l; /* $p2 = <integer expression>, line 54 */
+        {   int c1 = c; /* do, line 56 */
+            {   int c2 = c; /* or, line 58 */
+                if (in_grouping(data::g_v, 97, 251, 0)) goto lab2; /* grouping v, line 57 */
+                if (in_grouping(data::g_v, 97, 251, 0)) goto lab2; /* grouping v, line 57 */
+                {   int ret = hop(c, 0, l, 1); /* next, line 57 */
+                    if (ret < 0) goto lab2;
+                    c = ret;
+                }
+                goto lab1;
+            lab2:
+                c = c2;
+                if (!find_among(data::a_0)) goto lab3; /* among, line 59 */
+                goto lab1;
+            lab3:
+                c = c2;
+                {   int ret = hop(c, 0, l, 1); /* next, line 66 */
+                    if (ret < 0) goto lab0;
+                    c = ret;
+                }
+                {    /* gopast */ /* grouping v, line 66 */
+                    int ret = out_grouping(data::g_v, 97, 251, 1);
+                    if (ret < 0) goto lab0;
+                    c += ret;
+                }
+            }
+        lab1:
+            I_pV = c; /* setmark pV, line 67 */
+        lab0:
+            c = c1;
+        }
+        {   int c3 = c; /* do, line 69 */
+            {    /* gopast */ /* grouping v, line 70 */
+                int ret = out_grouping(data::g_v, 97, 251, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 70 */
+                int ret = in_grouping(data::g_v, 97, 251, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 70 */
+            {    /* gopast */ /* grouping v, line 71 */
+                int ret = out_grouping(data::g_v, 97, 251, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 71 */
+                int ret = in_grouping(data::g_v, 97, 251, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 71 */
+        lab4:
+            c = c3;
+        }
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 75 */
+            int c1 = c;
+            bra = c; /* [, line 77 */
+            if (c >= l || p[c] >> 5 != 2 || !((35652096 >> (p[c] & 0x1f)) & 1)) among_var = 4; else /* substring, line 77 */
+            among_var = find_among(data::a_1); /* substring, line 77 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 77 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_11); /* <-, line 78 */
+                    break;
+                case 2:
+                    slice_from(data::s_12); /* <-, line 79 */
+                    break;
+                case 3:
+                    slice_from(data::s_13); /* <-, line 80 */
+                    break;
+                case 4:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 81 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_RV() {
+        if (!(I_pV <= c)) return false; /* $pV <= <integer expression>, line 87 */
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 88 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 89 */
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        ket = c; /* [, line 92 */
+        among_var = find_among_b(data::a_4); /* substring, line 92 */
+        if (!among_var) return false;
+        bra = c; /* ], line 92 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_R2()) return false; /* call R2, line 96 */
+                slice_del(); /* delete, line 96 */
+                break;
+            case 2:
+                if (!r_R2()) return false; /* call R2, line 99 */
+                slice_del(); /* delete, line 99 */
+                {   int m_keep = l - c; /* try, line 100 */
+                    ket = c; /* [, line 100 */
+                    if (!eq_s_b(data::s_14)) { c = l - m_keep; goto lab0; } /* literal, line 100 */
+                    bra = c; /* ], line 100 */
+                    {   int m1 = l - c; (void)m1; /* or, line 100 */
+                        if (!r_R2()) goto lab2; /* call R2, line 100 */
+                        slice_del(); /* delete, line 100 */
+                        goto lab1;
+                    lab2:
+                        c = l - m1;
+                        slice_from(data::s_15); /* <-, line 100 */
+                    }
+                lab1:
+                lab0:
+                    ;
+                }
+                break;
+            case 3:
+                if (!r_R2()) return false; /* call R2, line 104 */
+                slice_from(data::s_16); /* <-, line 104 */
+                break;
+            case 4:
+                if (!r_R2()) return false; /* call R2, line 107 */
+                slice_from(data::s_17); /* <-, line 107 */
+                break;
+            case 5:
+                if (!r_R2()) return false; /* call R2, line 110 */
+                slice_from(data::s_18); /* <-, line 110 */
+                break;
+            case 6:
+                if (!r_RV()) return false; /* call RV, line 114 */
+                slice_del(); /* delete, line 114 */
+                {   int m_keep = l - c; /* try, line 115 */
+                    ket = c; /* [, line 116 */
+                    among_var = find_among_b(data::a_2); /* substring, line 116 */
+                    if (!among_var) { c = l - m_keep; goto lab3; }
+                    bra = c; /* ], line 116 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab3; }
+                        case 1:
+                            if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 117 */
+                            slice_del(); /* delete, line 117 */
+                            ket = c; /* [, line 117 */
+                            if (!eq_s_b(data::s_19)) { c = l - m_keep; goto lab3; } /* literal, line 117 */
+                            bra = c; /* ], line 117 */
+                            if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 117 */
+                            slice_del(); /* delete, line 117 */
+                            break;
+                        case 2:
+                            {   int m2 = l - c; (void)m2; /* or, line 118 */
+                                if (!r_R2()) goto lab5; /* call R2, line 118 */
+                                slice_del(); /* delete, line 118 */
+                                goto lab4;
+                            lab5:
+                                c = l - m2;
+                                if (!r_R1()) { c = l - m_keep; goto lab3; } /* call R1, line 118 */
+                                slice_from(data::s_20); /* <-, line 118 */
+                            }
+                        lab4:
+                            break;
+                        case 3:
+                            if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 120 */
+                            slice_del(); /* delete, line 120 */
+                            break;
+                        case 4:
+                            if (!r_RV()) { c = l - m_keep; goto lab3; } /* call RV, line 122 */
+                            slice_from(data::s_21); /* <-, line 122 */
+                            break;
+                    }
+                lab3:
+                    ;
+                }
+                break;
+            case 7:
+                if (!r_R2()) return false; /* call R2, line 129 */
+                slice_del(); /* delete, line 129 */
+                {   int m_keep = l - c; /* try, line 130 */
+                    ket = c; /* [, line 131 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4198408 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab6; } /* substring, line 131 */
+                    among_var = find_among_b(data::a_3); /* substring, line 131 */
+                    if (!among_var) { c = l - m_keep; goto lab6; }
+                    bra = c; /* ], line 131 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab6; }
+                        case 1:
+                            {   int m3 = l - c; (void)m3; /* or, line 132 */
+                                if (!r_R2()) goto lab8; /* call R2, line 132 */
+                                slice_del(); /* delete, line 132 */
+                                goto lab7;
+                            lab8:
+                                c = l - m3;
+                                slice_from(data::s_22); /* <-, line 132 */
+                            }
+                        lab7:
+                            break;
+                        case 2:
+                            {   int m4 = l - c; (void)m4; /* or, line 133 */
+                                if (!r_R2()) goto lab10; /* call R2, line 133 */
+                                slice_del(); /* delete, line 133 */
+                                goto lab9;
+                            lab10:
+                                c = l - m4;
+                                slice_from(data::s_23); /* <-, line 133 */
+                            }
+                        lab9:
+                            break;
+                        case 3:
+                            if (!r_R2()) { c = l - m_keep; goto lab6; } /* call R2, line 134 */
+                            slice_del(); /* delete, line 134 */
+                            break;
+                    }
+                lab6:
+                    ;
+                }
+                break;
+            case 8:
+                if (!r_R2()) return false; /* call R2, line 141 */
+                slice_del(); /* delete, line 141 */
+                {   int m_keep = l - c; /* try, line 142 */
+                    ket = c; /* [, line 142 */
+                    if (!eq_s_b(data::s_24)) { c = l - m_keep; goto lab11; } /* literal, line 142 */
+                    bra = c; /* ], line 142 */
+                    if (!r_R2()) { c = l - m_keep; goto lab11; } /* call R2, line 142 */
+                    slice_del(); /* delete, line 142 */
+                    ket = c; /* [, line 142 */
+                    if (!eq_s_b(data::s_25)) { c = l - m_keep; goto lab11; } /* literal, line 142 */
+                    bra = c; /* ], line 142 */
+                    {   int m5 = l - c; (void)m5; /* or, line 142 */
+                        if (!r_R2()) goto lab13; /* call R2, line 142 */
+                        slice_del(); /* delete, line 142 */
+                        goto lab12;
+                    lab13:
+                        c = l - m5;
+                        slice_from(data::s_26); /* <-, line 142 */
+                    }
+                lab12:
+                lab11:
+                    ;
+                }
+                break;
+            case 9:
+                slice_from(data::s_27); /* <-, line 144 */
+                break;
+            case 10:
+                if (!r_R1()) return false; /* call R1, line 145 */
+                slice_from(data::s_28); /* <-, line 145 */
+                break;
+            case 11:
+                {   int m6 = l - c; (void)m6; /* or, line 147 */
+                    if (!r_R2()) goto lab15; /* call R2, line 147 */
+                    slice_del(); /* delete, line 147 */
+                    goto lab14;
+                lab15:
+                    c = l - m6;
+                    if (!r_R1()) return false; /* call R1, line 147 */
+                    slice_from(data::s_29); /* <-, line 147 */
+                }
+            lab14:
+                break;
+            case 12:
+                if (!r_R1()) return false; /* call R1, line 150 */
+                if (out_grouping_b(data::g_v, 97, 251, 0)) return false; /* non v, line 150 */
+                slice_del(); /* delete, line 150 */
+                break;
+            case 13:
+                if (!r_RV()) return false; /* call RV, line 155 */
+                slice_from(data::s_30); /* <-, line 155 */
+                return false; /* fail, line 155 */
+                break;
+            case 14:
+                if (!r_RV()) return false; /* call RV, line 156 */
+                slice_from(data::s_31); /* <-, line 156 */
+                return false; /* fail, line 156 */
+                break;
+            case 15:
+                {   int m_test = l - c; /* test, line 158 */
+                    if (in_grouping_b(data::g_v, 97, 251, 0)) return false; /* grouping v, line 158 */
+                    if (!r_RV()) return false; /* call RV, line 158 */
+                    c = l - m_test;
+                }
+                slice_del(); /* delete, line 158 */
+                return false; /* fail, line 158 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_i_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 163 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 163 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 164 */
+            if (c <= lb || p[c - 1] >> 5 != 3 || !((68944418 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 164 */
+            among_var = find_among_b(data::a_5); /* substring, line 164 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 164 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    if (out_grouping_b(data::g_v, 97, 251, 0)) { lb = mlimit; return false; } /* non v, line 170 */
+                    slice_del(); /* delete, line 170 */
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 174 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 174 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 175 */
+            among_var = find_among_b(data::a_6); /* substring, line 175 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 175 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    if (!r_R2()) { lb = mlimit; return false; } /* call R2, line 177 */
+                    slice_del(); /* delete, line 177 */
+                    break;
+                case 2:
+                    slice_del(); /* delete, line 185 */
+                    break;
+                case 3:
+                    slice_del(); /* delete, line 190 */
+                    {   int m_keep = l - c; /* try, line 191 */
+                        ket = c; /* [, line 191 */
+                        if (!eq_s_b(data::s_32)) { c = l - m_keep; goto lab0; } /* literal, line 191 */
+                        bra = c; /* ], line 191 */
+                        slice_del(); /* delete, line 191 */
+                    lab0:
+                        ;
+                    }
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_residual_suffix() {
+        int among_var;
+        {   int m_keep = l - c; /* try, line 199 */
+            ket = c; /* [, line 199 */
+            if (!eq_s_b(data::s_33)) { c = l - m_keep; goto lab0; } /* literal, line 199 */
+            bra = c; /* ], line 199 */
+            {   int m_test = l - c; /* test, line 199 */
+                if (out_grouping_b(data::g_keep_with_s, 97, 232, 0)) { c = l - m_keep; goto lab0; } /* non keep_with_s, line 199 */
+                c = l - m_test;
+            }
+            slice_del(); /* delete, line 199 */
+        lab0:
+            ;
+        }
+        {   int mlimit; /* setlimit, line 200 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 200 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 201 */
+            among_var = find_among_b(data::a_7); /* substring, line 201 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 201 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    if (!r_R2()) { lb = mlimit; return false; } /* call R2, line 202 */
+                    {   int m2 = l - c; (void)m2; /* or, line 202 */
+                        if (!eq_s_b(data::s_34)) goto lab2; /* literal, line 202 */
+                        goto lab1;
+                    lab2:
+                        c = l - m2;
+                        if (!eq_s_b(data::s_35)) { lb = mlimit; return false; } /* literal, line 202 */
+                    }
+                lab1:
+                    slice_del(); /* delete, line 202 */
+                    break;
+                case 2:
+                    slice_from(data::s_36); /* <-, line 204 */
+                    break;
+                case 3:
+                    slice_del(); /* delete, line 205 */
+                    break;
+                case 4:
+                    if (!eq_s_b(data::s_37)) { lb = mlimit; return false; } /* literal, line 206 */
+                    slice_del(); /* delete, line 206 */
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_un_double() {
+        {   int m_test = l - c; /* test, line 212 */
+            if (c - 2 <= lb || p[c - 1] >> 5 != 3 || !((1069056 >> (p[c - 1] & 0x1f)) & 1)) return false; /* among, line 212 */
+            if (!find_among_b(data::a_8)) return false; /* among, line 212 */
+            c = l - m_test;
+        }
+        ket = c; /* [, line 212 */
+        {   int ret = hop(c, lb, l, -1); /* next, line 212 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        bra = c; /* ], line 212 */
+        slice_del(); /* delete, line 212 */
+        return true;
+    }
+
+  private:
+    bool r_un_accent() {
+        {   int i = 1;
+            while(1) { /* atleast, line 216 */
+                if (out_grouping_b(data::g_v, 97, 251, 0)) goto lab0; /* non v, line 216 */
+                i--;
+                continue;
+            lab0:
+                break;
+            }
+            if (i > 0) return false;
+        }
+        ket = c; /* [, line 217 */
+        {   int m1 = l - c; (void)m1; /* or, line 217 */
+            if (!eq_s_b(data::s_38)) goto lab2; /* literal, line 217 */
+            goto lab1;
+        lab2:
+            c = l - m1;
+            if (!eq_s_b(data::s_39)) return false; /* literal, line 217 */
+        }
+    lab1:
+        bra = c; /* ], line 217 */
+        slice_from(data::s_40); /* <-, line 217 */
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 223 */
+            if (!r_prelude()) goto lab0; /* call prelude, line 223 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 224 */
+            if (!r_mark_regions()) goto lab1; /* call mark_regions, line 224 */
+        lab1:
+            c = c2;
+        }
+        lb = c; c = l; /* backwards, line 225 */
+
+        {   int m3 = l - c; (void)m3; /* do, line 227 */
+            {   int m4 = l - c; (void)m4; /* or, line 237 */
+                {   int m5 = l - c; (void)m5; /* and, line 233 */
+                    {   int m6 = l - c; (void)m6; /* or, line 229 */
+                        if (!r_standard_suffix()) goto lab6; /* call standard_suffix, line 229 */
+                        goto lab5;
+                    lab6:
+                        c = l - m6;
+                        if (!r_i_verb_suffix()) goto lab7; /* call i_verb_suffix, line 230 */
+                        goto lab5;
+                    lab7:
+                        c = l - m6;
+                        if (!r_verb_suffix()) goto lab4; /* call verb_suffix, line 231 */
+                    }
+                lab5:
+                    c = l - m5;
+                    {   int m_keep = l - c; /* try, line 234 */
+                        ket = c; /* [, line 234 */
+                        {   int m7 = l - c; (void)m7; /* or, line 234 */
+                            if (!eq_s_b(data::s_41)) goto lab10; /* literal, line 234 */
+                            bra = c; /* ], line 234 */
+                            slice_from(data::s_42); /* <-, line 234 */
+                            goto lab9;
+                        lab10:
+                            c = l - m7;
+                            if (!eq_s_b(data::s_43)) { c = l - m_keep; goto lab8; } /* literal, line 235 */
+                            bra = c; /* ], line 235 */
+                            slice_from(data::s_44); /* <-, line 235 */
+                        }
+                    lab9:
+                    lab8:
+                        ;
+                    }
+                }
+                goto lab3;
+            lab4:
+                c = l - m4;
+                if (!r_residual_suffix()) goto lab2; /* call residual_suffix, line 238 */
+            }
+        lab3:
+        lab2:
+            c = l - m3;
+        }
+        {   int m8 = l - c; (void)m8; /* do, line 243 */
+            if (!r_un_double()) goto lab11; /* call un_double, line 243 */
+        lab11:
+            c = l - m8;
+        }
+        {   int m9 = l - c; (void)m9; /* do, line 244 */
+            if (!r_un_accent()) goto lab12; /* call un_accent, line 244 */
+        lab12:
+            c = l - m9;
+        }
+        c = lb;
+        {   int c10 = c; /* do, line 246 */
+            if (!r_postlude()) goto lab13; /* call postlude, line 246 */
+        lab13:
+            c = c10;
+        }
+        return true;
+    }
+
+  private:
+    int I_p2 = 0;
+    int I_p1 = 0;
+    int I_pV = 0;
+};
+
+}
+
+#endif
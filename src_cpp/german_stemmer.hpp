@@ -0,0 +1,559 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_GERMAN_STEMMER_HPP
+#define SNOWBALL_GERMAN_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct german_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32, 8 };
+    static constexpr unsigned char g_s_ending[] = { 117, 30, 5 };
+    static constexpr unsigned char g_st_ending[] = { 117, 30, 4 };
+};
+
+template <bool utf8> struct german_stemmer_data;
+
+template <>
+struct german_stemmer_data<true> : german_stemmer_groupings {
+    static constexpr unsigned char s_0_1[1] = { 'U' };
+    static constexpr unsigned char s_0_2[1] = { 'Y' };
+    static constexpr unsigned char s_0_3[2] = { 0xC3, 0xA4 };
+    static constexpr unsigned char s_0_4[2] = { 0xC3, 0xB6 };
+    static constexpr unsigned char s_0_5[2] = { 0xC3, 0xBC };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 6, 0 },
+    /*  1 */ { 1, s_0_1, 0, 2, 0 },
+    /*  2 */ { 1, s_0_2, 0, 1, 0 },
+    /*  3 */ { 2, s_0_3, 0, 3, 0 },
+    /*  4 */ { 2, s_0_4, 0, 4, 0 },
+    /*  5 */ { 2, s_0_5, 0, 5, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[1] = { 'e' };
+    static constexpr unsigned char s_1_1[2] = { 'e', 'm' };
+    static constexpr unsigned char s_1_2[2] = { 'e', 'n' };
+    static constexpr unsigned char s_1_3[3] = { 'e', 'r', 'n' };
+    static constexpr unsigned char s_1_4[2] = { 'e', 'r' };
+    static constexpr unsigned char s_1_5[1] = { 's' };
+    static constexpr unsigned char s_1_6[2] = { 'e', 's' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 1, s_1_0, -1, 2, 0 },
+    /*  1 */ { 2, s_1_1, -1, 1, 0 },
+    /*  2 */ { 2, s_1_2, -1, 2, 0 },
+    /*  3 */ { 3, s_1_3, -1, 1, 0 },
+    /*  4 */ { 2, s_1_4, -1, 1, 0 },
+    /*  5 */ { 1, s_1_5, -1, 3, 0 },
+    /*  6 */ { 2, s_1_6, 5, 2, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'e', 'n' };
+    static constexpr unsigned char s_2_1[2] = { 'e', 'r' };
+    static constexpr unsigned char s_2_2[2] = { 's', 't' };
+    static constexpr unsigned char s_2_3[3] = { 'e', 's', 't' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 2, s_2_1, -1, 1, 0 },
+    /*  2 */ { 2, s_2_2, -1, 2, 0 },
+    /*  3 */ { 3, s_2_3, 2, 1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[2] = { 'i', 'g' };
+    static constexpr unsigned char s_3_1[4] = { 'l', 'i', 'c', 'h' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[3] = { 'e', 'n', 'd' };
+    static constexpr unsigned char s_4_1[2] = { 'i', 'g' };
+    static constexpr unsigned char s_4_2[3] = { 'u', 'n', 'g' };
+    static constexpr unsigned char s_4_3[4] = { 'l', 'i', 'c', 'h' };
+    static constexpr unsigned char s_4_4[4] = { 'i', 's', 'c', 'h' };
+    static constexpr unsigned char s_4_5[2] = { 'i', 'k' };
+    static constexpr unsigned char s_4_6[4] = { 'h', 'e', 'i', 't' };
+    static constexpr unsigned char s_4_7[4] = { 'k', 'e', 'i', 't' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 3, s_4_0, -1, 1, 0 },
+    /*  1 */ { 2, s_4_1, -1, 2, 0 },
+    /*  2 */ { 3, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 3, 0 },
+    /*  4 */ { 4, s_4_4, -1, 2, 0 },
+    /*  5 */ { 2, s_4_5, -1, 2, 0 },
+    /*  6 */ { 4, s_4_6, -1, 3, 0 },
+    /*  7 */ { 4, s_4_7, -1, 4, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 0xC3, 0x9F };
+    static constexpr unsigned char s_1[] = { 's', 's' };
+    static constexpr unsigned char s_2[] = { 'u' };
+    static constexpr unsigned char s_3[] = { 'U' };
+    static constexpr unsigned char s_4[] = { 'y' };
+    static constexpr unsigned char s_5[] = { 'Y' };
+    static constexpr unsigned char s_6[] = { 'y' };
+    static constexpr unsigned char s_7[] = { 'u' };
+    static constexpr unsigned char s_8[] = { 'a' };
+    static constexpr unsigned char s_9[] = { 'o' };
+    static constexpr unsigned char s_10[] = { 'u' };
+    static constexpr unsigned char s_11[] = { 's' };
+    static constexpr unsigned char s_12[] = { 'n', 'i', 's' };
+    static constexpr unsigned char s_13[] = { 'i', 'g' };
+    static constexpr unsigned char s_14[] = { 'e' };
+    static constexpr unsigned char s_15[] = { 'e' };
+    static constexpr unsigned char s_16[] = { 'e', 'r' };
+    static constexpr unsigned char s_17[] = { 'e', 'n' };
+};
+
+template <>
+struct german_stemmer_data<false> : german_stemmer_groupings {
+    static constexpr char32_t s_0_1[1] = { 'U' };
+    static constexpr char32_t s_0_2[1] = { 'Y' };
+    static constexpr char32_t s_0_3[1] = { 0xE4 };
+    static constexpr char32_t s_0_4[1] = { 0xF6 };
+    static constexpr char32_t s_0_5[1] = { 0xFC };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 6, 0 },
+    /*  1 */ { 1, s_0_1, 0, 2, 0 },
+    /*  2 */ { 1, s_0_2, 0, 1, 0 },
+    /*  3 */ { 1, s_0_3, 0, 3, 0 },
+    /*  4 */ { 1, s_0_4, 0, 4, 0 },
+    /*  5 */ { 1, s_0_5, 0, 5, 0 }
+    };
+
+    static constexpr char32_t s_1_0[1] = { 'e' };
+    static constexpr char32_t s_1_1[2] = { 'e', 'm' };
+    static constexpr char32_t s_1_2[2] = { 'e', 'n' };
+    static constexpr char32_t s_1_3[3] = { 'e', 'r', 'n' };
+    static constexpr char32_t s_1_4[2] = { 'e', 'r' };
+    static constexpr char32_t s_1_5[1] = { 's' };
+    static constexpr char32_t s_1_6[2] = { 'e', 's' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 1, s_1_0, -1, 2, 0 },
+    /*  1 */ { 2, s_1_1, -1, 1, 0 },
+    /*  2 */ { 2, s_1_2, -1, 2, 0 },
+    /*  3 */ { 3, s_1_3, -1, 1, 0 },
+    /*  4 */ { 2, s_1_4, -1, 1, 0 },
+    /*  5 */ { 1, s_1_5, -1, 3, 0 },
+    /*  6 */ { 2, s_1_6, 5, 2, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'e', 'n' };
+    static constexpr char32_t s_2_1[2] = { 'e', 'r' };
+    static constexpr char32_t s_2_2[2] = { 's', 't' };
+    static constexpr char32_t s_2_3[3] = { 'e', 's', 't' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 2, s_2_1, -1, 1, 0 },
+    /*  2 */ { 2, s_2_2, -1, 2, 0 },
+    /*  3 */ { 3, s_2_3, 2, 1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[2] = { 'i', 'g' };
+    static constexpr char32_t s_3_1[4] = { 'l', 'i', 'c', 'h' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[3] = { 'e', 'n', 'd' };
+    static constexpr char32_t s_4_1[2] = { 'i', 'g' };
+    static constexpr char32_t s_4_2[3] = { 'u', 'n', 'g' };
+    static constexpr char32_t s_4_3[4] = { 'l', 'i', 'c', 'h' };
+    static constexpr char32_t s_4_4[4] = { 'i', 's', 'c', 'h' };
+    static constexpr char32_t s_4_5[2] = { 'i', 'k' };
+    static constexpr char32_t s_4_6[4] = { 'h', 'e', 'i', 't' };
+    static constexpr char32_t s_4_7[4] = { 'k', 'e', 'i', 't' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 3, s_4_0, -1, 1, 0 },
+    /*  1 */ { 2, s_4_1, -1, 2, 0 },
+    /*  2 */ { 3, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 3, 0 },
+    /*  4 */ { 4, s_4_4, -1, 2, 0 },
+    /*  5 */ { 2, s_4_5, -1, 2, 0 },
+    /*  6 */ { 4, s_4_6, -1, 3, 0 },
+    /*  7 */ { 4, s_4_7, -1, 4, 0 }
+    };
+    static constexpr char32_t s_0[] = { 0xDF };
+    static constexpr char32_t s_1[] = { 's', 's' };
+    static constexpr char32_t s_2[] = { 'u' };
+    static constexpr char32_t s_3[] = { 'U' };
+    static constexpr char32_t s_4[] = { 'y' };
+    static constexpr char32_t s_5[] = { 'Y' };
+    static constexpr char32_t s_6[] = { 'y' };
+    static constexpr char32_t s_7[] = { 'u' };
+    static constexpr char32_t s_8[] = { 'a' };
+    static constexpr char32_t s_9[] = { 'o' };
+    static constexpr char32_t s_10[] = { 'u' };
+    static constexpr char32_t s_11[] = { 's' };
+    static constexpr char32_t s_12[] = { 'n', 'i', 's' };
+    static constexpr char32_t s_13[] = { 'i', 'g' };
+    static constexpr char32_t s_14[] = { 'e' };
+    static constexpr char32_t s_15[] = { 'e' };
+    static constexpr char32_t s_16[] = { 'e', 'r' };
+    static constexpr char32_t s_17[] = { 'e', 'n' };
+};
+
+template <typename symbol>
+class german_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef german_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        {   int c_test = c; /* test, line 35 */
+            while(1) { /* repeat, line 35 */
+                int c1 = c;
+                {   int c2 = c; /* or, line 38 */
+                    bra = c; /* [, line 37 */
+                    if (!eq_s(data::s_0)) goto lab2; /* literal, line 37 */
+                    ket = c; /* ], line 37 */
+                    slice_from(data::s_1); /* <-, line 37 */
+                    goto lab1;
+                lab2:
+                    c = c2;
+                    {   int ret = hop(c, 0, l, 1); /* next, line 38 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                }
+            lab1:
+                continue;
+            lab0:
+                c = c1;
+                break;
+            }
+            c = c_test;
+        }
+        while(1) { /* repeat, line 41 */
+            int c3 = c;
+            while(1) { /* goto, line 41 */
+                int c4 = c;
+                if (in_grouping(data::g_v, 97, 252, 0)) goto lab4; /* grouping v, line 42 */
+                bra = c; /* [, line 42 */
+                {   int c5 = c; /* or, line 42 */
+                    if (!eq_s(data::s_2)) goto lab6; /* literal, line 42 */
+                    ket = c; /* ], line 42 */
+                    if (in_grouping(data::g_v, 97, 252, 0)) goto lab6; /* grouping v, line 42 */
+                    slice_from(data::s_3); /* <-, line 42 */
+                    goto lab5;
+                lab6:
+                    c = c5;
+                    if (!eq_s(data::s_4)) goto lab4; /* literal, line 43 */
+                    ket = c; /* ], line 43 */
+                    if (in_grouping(data::g_v, 97, 252, 0)) goto lab4; /* grouping v, line 43 */
+                    slice_from(data::s_5); /* <-, line 43 */
+                }
+            lab5:
+                c = c4;
+                break;
+            lab4:
+                c = c4;
+                {   int ret = hop(c, 0, l, 1); /* goto, line 41 */
+                    if (ret < 0) goto lab3;
+                    c = ret;
+                }
+            }
+            continue;
+        lab3:
+            c = c3;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 49 */
+        I_p2 = l; /* $p2 = <integer expression>, line 50 */
+        {   int c_test = c; /* test, line 52 */
+            {   int ret = hop(c, 0, l, 3); /* hop, line 52 */
+                if (ret < 0) return false;
+                c = ret;
+            }
+            I_x = c; /* setmark x, line 52 */
+            c = c_test;
+        }
+        {    /* gopast */ /* grouping v, line 54 */
+            int ret = out_grouping(data::g_v, 97, 252, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        {    /* gopast */ /* non v, line 54 */
+            int ret = in_grouping(data::g_v, 97, 252, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p1 = c; /* setmark p1, line 54 */
+         /* try, line 55 */
+        if (!(I_p1 < I_x)) goto lab0; /* $p1 < <integer expression>, line 55 */
+        I_p1 = I_x; /* $p1 = <integer expression>, line 55 */
+    lab0:
+        {    /* gopast */ /* grouping v, line 56 */
+            int ret = out_grouping(data::g_v, 97, 252, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        {    /* gopast */ /* non v, line 56 */
+            int ret = in_grouping(data::g_v, 97, 252, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p2 = c; /* setmark p2, line 56 */
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 60 */
+            int c1 = c;
+            bra = c; /* [, line 62 */
+            among_var = find_among(data::a_0); /* substring, line 62 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 62 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_6); /* <-, line 63 */
+                    break;
+                case 2:
+                    slice_from(data::s_7); /* <-, line 64 */
+                    break;
+                case 3:
+                    slice_from(data::s_8); /* <-, line 65 */
+                    break;
+                case 4:
+                    slice_from(data::s_9); /* <-, line 66 */
+                    break;
+                case 5:
+                    slice_from(data::s_10); /* <-, line 67 */
+                    break;
+                case 6:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 68 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 75 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 76 */
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        {   int m1 = l - c; (void)m1; /* do, line 79 */
+            ket = c; /* [, line 80 */
+            if (c <= lb || p[c - 1] >> 5 != 3 || !((811040 >> (p[c - 1] & 0x1f)) & 1)) goto lab0; /* substring, line 80 */
+            among_var = find_among_b(data::a_1); /* substring, line 80 */
+            if (!among_var) goto lab0;
+            bra = c; /* ], line 80 */
+            if (!r_R1()) goto lab0; /* call R1, line 80 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_del(); /* delete, line 82 */
+                    break;
+                case 2:
+                    slice_del(); /* delete, line 85 */
+                    {   int m_keep = l - c; /* try, line 86 */
+                        ket = c; /* [, line 86 */
+                        if (!eq_s_b(data::s_11)) { c = l - m_keep; goto lab1; } /* literal, line 86 */
+                        bra = c; /* ], line 86 */
+                        if (!eq_s_b(data::s_12)) { c = l - m_keep; goto lab1; } /* literal, line 86 */
+                        slice_del(); /* delete, line 86 */
+                    lab1:
+                        ;
+                    }
+                    break;
+                case 3:
+                    if (in_grouping_b(data::g_s_ending, 98, 116, 0)) goto lab0; /* grouping s_ending, line 89 */
+                    slice_del(); /* delete, line 89 */
+                    break;
+            }
+        lab0:
+            c = l - m1;
+        }
+        {   int m2 = l - c; (void)m2; /* do, line 93 */
+            ket = c; /* [, line 94 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1327104 >> (p[c - 1] & 0x1f)) & 1)) goto lab2; /* substring, line 94 */
+            among_var = find_among_b(data::a_2); /* substring, line 94 */
+            if (!among_var) goto lab2;
+            bra = c; /* ], line 94 */
+            if (!r_R1()) goto lab2; /* call R1, line 94 */
+            switch(among_var) {
+                case 0: goto lab2;
+                case 1:
+                    slice_del(); /* delete, line 96 */
+                    break;
+                case 2:
+                    if (in_grouping_b(data::g_st_ending, 98, 116, 0)) goto lab2; /* grouping st_ending, line 99 */
+                    {   int ret = hop(c, lb, l, -3); /* hop, line 99 */
+                        if (ret < 0) goto lab2;
+                        c = ret;
+                    }
+                    slice_del(); /* delete, line 99 */
+                    break;
+            }
+        lab2:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 103 */
+            ket = c; /* [, line 104 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1051024 >> (p[c - 1] & 0x1f)) & 1)) goto lab3; /* substring, line 104 */
+            among_var = find_among_b(data::a_4); /* substring, line 104 */
+            if (!among_var) goto lab3;
+            bra = c; /* ], line 104 */
+            if (!r_R2()) goto lab3; /* call R2, line 104 */
+            switch(among_var) {
+                case 0: goto lab3;
+                case 1:
+                    slice_del(); /* delete, line 106 */
+                    {   int m_keep = l - c; /* try, line 107 */
+                        ket = c; /* [, line 107 */
+                        if (!eq_s_b(data::s_13)) { c = l - m_keep; goto lab4; } /* literal, line 107 */
+                        bra = c; /* ], line 107 */
+                        {   int m4 = l - c; (void)m4; /* not, line 107 */
+                            if (!eq_s_b(data::s_14)) goto lab5; /* literal, line 107 */
+                            { c = l - m_keep; goto lab4; }
+                        lab5:
+                            c = l - m4;
+                        }
+                        if (!r_R2()) { c = l - m_keep; goto lab4; } /* call R2, line 107 */
+                        slice_del(); /* delete, line 107 */
+                    lab4:
+                        ;
+                    }
+                    break;
+                case 2:
+                    {   int m5 = l - c; (void)m5; /* not, line 110 */
+                        if (!eq_s_b(data::s_15)) goto lab6; /* literal, line 110 */
+                        goto lab3;
+                    lab6:
+                        c = l - m5;
+                    }
+                    slice_del(); /* delete, line 110 */
+                    break;
+                case 3:
+                    slice_del(); /* delete, line 113 */
+                    {   int m_keep = l - c; /* try, line 114 */
+                        ket = c; /* [, line 115 */
+                        {   int m6 = l - c; (void)m6; /* or, line 115 */
+                            if (!eq_s_b(data::s_16)) goto lab9; /* literal, line 115 */
+                            goto lab8;
+                        lab9:
+                            c = l - m6;
+                            if (!eq_s_b(data::s_17)) { c = l - m_keep; goto lab7; } /* literal, line 115 */
+                        }
+                    lab8:
+                        bra = c; /* ], line 115 */
+                        if (!r_R1()) { c = l - m_keep; goto lab7; } /* call R1, line 115 */
+                        slice_del(); /* delete, line 115 */
+                    lab7:
+                        ;
+                    }
+                    break;
+                case 4:
+                    slice_del(); /* delete, line 119 */
+                    {   int m_keep = l - c; /* try, line 120 */
+                        ket = c; /* [, line 121 */
+                        if (c - 1 <= lb || (p[c - 1] != 103 && p[c - 1] != 104)) { c = l - m_keep; goto lab10; } /* substring, line 121 */
+                        among_var = find_among_b(data::a_3); /* substring, line 121 */
+                        if (!among_var) { c = l - m_keep; goto lab10; }
+                        bra = c; /* ], line 121 */
+                        if (!r_R2()) { c = l - m_keep; goto lab10; } /* call R2, line 121 */
+                        switch(among_var) {
+                            case 0: { c = l - m_keep; goto lab10; }
+                            case 1:
+                                slice_del(); /* delete, line 123 */
+                                break;
+                        }
+                    lab10:
+                        ;
+                    }
+                    break;
+            }
+        lab3:
+            c = l - m3;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 134 */
+            if (!r_prelude()) goto lab0; /* call prelude, line 134 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 135 */
+            if (!r_mark_regions()) goto lab1; /* call mark_regions, line 135 */
+        lab1:
+            c = c2;
+        }
+        lb = c; c = l; /* backwards, line 136 */
+
+        {   int m3 = l - c; (void)m3; /* do, line 137 */
+            if (!r_standard_suffix()) goto lab2; /* call standard_suffix, line 137 */
+        lab2:
+            c = l - m3;
+        }
+        c = lb;
+        {   int c4 = c; /* do, line 138 */
+            if (!r_postlude()) goto lab3; /* call postlude, line 138 */
+        lab3:
+            c = c4;
+        }
+        return true;
+    }
+
+  private:
+    int I_x = 0;
+    int I_p2 = 0;
+    int I_p1 = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,1447 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_HUNGARIAN_STEMMER_HPP
+#define SNOWBALL_HUNGARIAN_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct hungarian_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 36, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1 };
+};
+
+template <bool utf8> struct hungarian_stemmer_data;
+
+template <>
+struct hungarian_stemmer_data<true> : hungarian_stemmer_groupings {
+    static constexpr unsigned char s_0_0[2] = { 'c', 's' };
+    static constexpr unsigned char s_0_1[3] = { 'd', 'z', 's' };
+    static constexpr unsigned char s_0_2[2] = { 'g', 'y' };
+    static constexpr unsigned char s_0_3[2] = { 'l', 'y' };
+    static constexpr unsigned char s_0_4[2] = { 'n', 'y' };
+    static constexpr unsigned char s_0_5[2] = { 's', 'z' };
+    static constexpr unsigned char s_0_6[2] = { 't', 'y' };
+    static constexpr unsigned char s_0_7[2] = { 'z', 's' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 2, s_0_0, -1, -1, 0 },
+    /*  1 */ { 3, s_0_1, -1, -1, 0 },
+    /*  2 */ { 2, s_0_2, -1, -1, 0 },
+    /*  3 */ { 2, s_0_3, -1, -1, 0 },
+    /*  4 */ { 2, s_0_4, -1, -1, 0 },
+    /*  5 */ { 2, s_0_5, -1, -1, 0 },
+    /*  6 */ { 2, s_0_6, -1, -1, 0 },
+    /*  7 */ { 2, s_0_7, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_1_1[2] = { 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, 1, 0 },
+    /*  1 */ { 2, s_1_1, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'b', 'b' };
+    static constexpr unsigned char s_2_1[2] = { 'c', 'c' };
+    static constexpr unsigned char s_2_2[2] = { 'd', 'd' };
+    static constexpr unsigned char s_2_3[2] = { 'f', 'f' };
+    static constexpr unsigned char s_2_4[2] = { 'g', 'g' };
+    static constexpr unsigned char s_2_5[2] = { 'j', 'j' };
+    static constexpr unsigned char s_2_6[2] = { 'k', 'k' };
+    static constexpr unsigned char s_2_7[2] = { 'l', 'l' };
+    static constexpr unsigned char s_2_8[2] = { 'm', 'm' };
+    static constexpr unsigned char s_2_9[2] = { 'n', 'n' };
+    static constexpr unsigned char s_2_10[2] = { 'p', 'p' };
+    static constexpr unsigned char s_2_11[2] = { 'r', 'r' };
+    static constexpr unsigned char s_2_12[3] = { 'c', 'c', 's' };
+    static constexpr unsigned char s_2_13[2] = { 's', 's' };
+    static constexpr unsigned char s_2_14[3] = { 'z', 'z', 's' };
+    static constexpr unsigned char s_2_15[2] = { 't', 't' };
+    static constexpr unsigned char s_2_16[2] = { 'v', 'v' };
+    static constexpr unsigned char s_2_17[3] = { 'g', 'g', 'y' };
+    static constexpr unsigned char s_2_18[3] = { 'l', 'l', 'y' };
+    static constexpr unsigned char s_2_19[3] = { 'n', 'n', 'y' };
+    static constexpr unsigned char s_2_20[3] = { 't', 't', 'y' };
+    static constexpr unsigned char s_2_21[3] = { 's', 's', 'z' };
+    static constexpr unsigned char s_2_22[2] = { 'z', 'z' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 },
+    /*  3 */ { 2, s_2_3, -1, -1, 0 },
+    /*  4 */ { 2, s_2_4, -1, -1, 0 },
+    /*  5 */ { 2, s_2_5, -1, -1, 0 },
+    /*  6 */ { 2, s_2_6, -1, -1, 0 },
+    /*  7 */ { 2, s_2_7, -1, -1, 0 },
+    /*  8 */ { 2, s_2_8, -1, -1, 0 },
+    /*  9 */ { 2, s_2_9, -1, -1, 0 },
+    /* 10 */ { 2, s_2_10, -1, -1, 0 },
+    /* 11 */ { 2, s_2_11, -1, -1, 0 },
+    /* 12 */ { 3, s_2_12, -1, -1, 0 },
+    /* 13 */ { 2, s_2_13, -1, -1, 0 },
+    /* 14 */ { 3, s_2_14, -1, -1, 0 },
+    /* 15 */ { 2, s_2_15, -1, -1, 0 },
+    /* 16 */ { 2, s_2_16, -1, -1, 0 },
+    /* 17 */ { 3, s_2_17, -1, -1, 0 },
+    /* 18 */ { 3, s_2_18, -1, -1, 0 },
+    /* 19 */ { 3, s_2_19, -1, -1, 0 },
+    /* 20 */ { 3, s_2_20, -1, -1, 0 },
+    /* 21 */ { 3, s_2_21, -1, -1, 0 },
+    /* 22 */ { 2, s_2_22, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[2] = { 'a', 'l' };
+    static constexpr unsigned char s_3_1[2] = { 'e', 'l' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 1, 0 },
+    /*  1 */ { 2, s_3_1, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[2] = { 'b', 'a' };
+    static constexpr unsigned char s_4_1[2] = { 'r', 'a' };
+    static constexpr unsigned char s_4_2[2] = { 'b', 'e' };
+    static constexpr unsigned char s_4_3[2] = { 'r', 'e' };
+    static constexpr unsigned char s_4_4[2] = { 'i', 'g' };
+    static constexpr unsigned char s_4_5[3] = { 'n', 'a', 'k' };
+    static constexpr unsigned char s_4_6[3] = { 'n', 'e', 'k' };
+    static constexpr unsigned char s_4_7[3] = { 'v', 'a', 'l' };
+    static constexpr unsigned char s_4_8[3] = { 'v', 'e', 'l' };
+    static constexpr unsigned char s_4_9[2] = { 'u', 'l' };
+    static constexpr unsigned char s_4_10[4] = { 'n', 0xC3, 0xA1, 'l' };
+    static constexpr unsigned char s_4_11[4] = { 'n', 0xC3, 0xA9, 'l' };
+    static constexpr unsigned char s_4_12[4] = { 'b', 0xC3, 0xB3, 'l' };
+    static constexpr unsigned char s_4_13[4] = { 'r', 0xC3, 0xB3, 'l' };
+    static constexpr unsigned char s_4_14[4] = { 't', 0xC3, 0xB3, 'l' };
+    static constexpr unsigned char s_4_15[3] = { 0xC3, 0xBC, 'l' };
+    static constexpr unsigned char s_4_16[4] = { 'b', 0xC5, 0x91, 'l' };
+    static constexpr unsigned char s_4_17[4] = { 'r', 0xC5, 0x91, 'l' };
+    static constexpr unsigned char s_4_18[4] = { 't', 0xC5, 0x91, 'l' };
+    static constexpr unsigned char s_4_19[1] = { 'n' };
+    static constexpr unsigned char s_4_20[2] = { 'a', 'n' };
+    static constexpr unsigned char s_4_21[3] = { 'b', 'a', 'n' };
+    static constexpr unsigned char s_4_22[2] = { 'e', 'n' };
+    static constexpr unsigned char s_4_23[3] = { 'b', 'e', 'n' };
+    static constexpr unsigned char s_4_24[7] = { 'k', 0xC3, 0xA9, 'p', 'p', 'e', 'n' };
+    static constexpr unsigned char s_4_25[2] = { 'o', 'n' };
+    static constexpr unsigned char s_4_26[3] = { 0xC3, 0xB6, 'n' };
+    static constexpr unsigned char s_4_27[5] = { 'k', 0xC3, 0xA9, 'p', 'p' };
+    static constexpr unsigned char s_4_28[3] = { 'k', 'o', 'r' };
+    static constexpr unsigned char s_4_29[1] = { 't' };
+    static constexpr unsigned char s_4_30[2] = { 'a', 't' };
+    static constexpr unsigned char s_4_31[2] = { 'e', 't' };
+    static constexpr unsigned char s_4_32[5] = { 'k', 0xC3, 0xA9, 'n', 't' };
+    static constexpr unsigned char s_4_33[7] = { 'a', 'n', 'k', 0xC3, 0xA9, 'n', 't' };
+    static constexpr unsigned char s_4_34[7] = { 'e', 'n', 'k', 0xC3, 0xA9, 'n', 't' };
+    static constexpr unsigned char s_4_35[7] = { 'o', 'n', 'k', 0xC3, 0xA9, 'n', 't' };
+    static constexpr unsigned char s_4_36[2] = { 'o', 't' };
+    static constexpr unsigned char s_4_37[4] = { 0xC3, 0xA9, 'r', 't' };
+    static constexpr unsigned char s_4_38[3] = { 0xC3, 0xB6, 't' };
+    static constexpr unsigned char s_4_39[3] = { 'h', 'e', 'z' };
+    static constexpr unsigned char s_4_40[3] = { 'h', 'o', 'z' };
+    static constexpr unsigned char s_4_41[4] = { 'h', 0xC3, 0xB6, 'z' };
+    static constexpr unsigned char s_4_42[3] = { 'v', 0xC3, 0xA1 };
+    static constexpr unsigned char s_4_43[3] = { 'v', 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, -1, 0 },
+    /*  1 */ { 2, s_4_1, -1, -1, 0 },
+    /*  2 */ { 2, s_4_2, -1, -1, 0 },
+    /*  3 */ { 2, s_4_3, -1, -1, 0 },
+    /*  4 */ { 2, s_4_4, -1, -1, 0 },
+    /*  5 */ { 3, s_4_5, -1, -1, 0 },
+    /*  6 */ { 3, s_4_6, -1, -1, 0 },
+    /*  7 */ { 3, s_4_7, -1, -1, 0 },
+    /*  8 */ { 3, s_4_8, -1, -1, 0 },
+    /*  9 */ { 2, s_4_9, -1, -1, 0 },
+    /* 10 */ { 4, s_4_10, -1, -1, 0 },
+    /* 11 */ { 4, s_4_11, -1, -1, 0 },
+    /* 12 */ { 4, s_4_12, -1, -1, 0 },
+    /* 13 */ { 4, s_4_13, -1, -1, 0 },
+    /* 14 */ { 4, s_4_14, -1, -1, 0 },
+    /* 15 */ { 3, s_4_15, -1, -1, 0 },
+    /* 16 */ { 4, s_4_16, -1, -1, 0 },
+    /* 17 */ { 4, s_4_17, -1, -1, 0 },
+    /* 18 */ { 4, s_4_18, -1, -1, 0 },
+    /* 19 */ { 1, s_4_19, -1, -1, 0 },
+    /* 20 */ { 2, s_4_20, 19, -1, 0 },
+    /* 21 */ { 3, s_4_21, 20, -1, 0 },
+    /* 22 */ { 2, s_4_22, 19, -1, 0 },
+    /* 23 */ { 3, s_4_23, 22, -1, 0 },
+    /* 24 */ { 7, s_4_24, 22, -1, 0 },
+    /* 25 */ { 2, s_4_25, 19, -1, 0 },
+    /* 26 */ { 3, s_4_26, 19, -1, 0 },
+    /* 27 */ { 5, s_4_27, -1, -1, 0 },
+    /* 28 */ { 3, s_4_28, -1, -1, 0 },
+    /* 29 */ { 1, s_4_29, -1, -1, 0 },
+    /* 30 */ { 2, s_4_30, 29, -1, 0 },
+    /* 31 */ { 2, s_4_31, 29, -1, 0 },
+    /* 32 */ { 5, s_4_32, 29, -1, 0 },
+    /* 33 */ { 7, s_4_33, 32, -1, 0 },
+    /* 34 */ { 7, s_4_34, 32, -1, 0 },
+    /* 35 */ { 7, s_4_35, 32, -1, 0 },
+    /* 36 */ { 2, s_4_36, 29, -1, 0 },
+    /* 37 */ { 4, s_4_37, 29, -1, 0 },
+    /* 38 */ { 3, s_4_38, 29, -1, 0 },
+    /* 39 */ { 3, s_4_39, -1, -1, 0 },
+    /* 40 */ { 3, s_4_40, -1, -1, 0 },
+    /* 41 */ { 4, s_4_41, -1, -1, 0 },
+    /* 42 */ { 3, s_4_42, -1, -1, 0 },
+    /* 43 */ { 3, s_4_43, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[3] = { 0xC3, 0xA1, 'n' };
+    static constexpr unsigned char s_5_1[3] = { 0xC3, 0xA9, 'n' };
+    static constexpr unsigned char s_5_2[8] = { 0xC3, 0xA1, 'n', 'k', 0xC3, 0xA9, 'n', 't' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 3, s_5_0, -1, 2, 0 },
+    /*  1 */ { 3, s_5_1, -1, 1, 0 },
+    /*  2 */ { 8, s_5_2, -1, 3, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[4] = { 's', 't', 'u', 'l' };
+    static constexpr unsigned char s_6_1[5] = { 'a', 's', 't', 'u', 'l' };
+    static constexpr unsigned char s_6_2[6] = { 0xC3, 0xA1, 's', 't', 'u', 'l' };
+    static constexpr unsigned char s_6_3[5] = { 's', 't', 0xC3, 0xBC, 'l' };
+    static constexpr unsigned char s_6_4[6] = { 'e', 's', 't', 0xC3, 0xBC, 'l' };
+    static constexpr unsigned char s_6_5[7] = { 0xC3, 0xA9, 's', 't', 0xC3, 0xBC, 'l' };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 4, s_6_0, -1, 2, 0 },
+    /*  1 */ { 5, s_6_1, 0, 1, 0 },
+    /*  2 */ { 6, s_6_2, 0, 3, 0 },
+    /*  3 */ { 5, s_6_3, -1, 2, 0 },
+    /*  4 */ { 6, s_6_4, 3, 1, 0 },
+    /*  5 */ { 7, s_6_5, 3, 4, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_7_1[2] = { 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 2, s_7_0, -1, 1, 0 },
+    /*  1 */ { 2, s_7_1, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[1] = { 'k' };
+    static constexpr unsigned char s_8_1[2] = { 'a', 'k' };
+    static constexpr unsigned char s_8_2[2] = { 'e', 'k' };
+    static constexpr unsigned char s_8_3[2] = { 'o', 'k' };
+    static constexpr unsigned char s_8_4[3] = { 0xC3, 0xA1, 'k' };
+    static constexpr unsigned char s_8_5[3] = { 0xC3, 0xA9, 'k' };
+    static constexpr unsigned char s_8_6[3] = { 0xC3, 0xB6, 'k' };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, 7, 0 },
+    /*  1 */ { 2, s_8_1, 0, 4, 0 },
+    /*  2 */ { 2, s_8_2, 0, 6, 0 },
+    /*  3 */ { 2, s_8_3, 0, 5, 0 },
+    /*  4 */ { 3, s_8_4, 0, 1, 0 },
+    /*  5 */ { 3, s_8_5, 0, 2, 0 },
+    /*  6 */ { 3, s_8_6, 0, 3, 0 }
+    };
+
+    static constexpr unsigned char s_9_0[3] = { 0xC3, 0xA9, 'i' };
+    static constexpr unsigned char s_9_1[5] = { 0xC3, 0xA1, 0xC3, 0xA9, 'i' };
+    static constexpr unsigned char s_9_2[5] = { 0xC3, 0xA9, 0xC3, 0xA9, 'i' };
+    static constexpr unsigned char s_9_3[2] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_4[3] = { 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_5[4] = { 'a', 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_6[4] = { 'e', 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_7[4] = { 'o', 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_8[5] = { 0xC3, 0xA1, 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_9[5] = { 0xC3, 0xA9, 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_10[5] = { 0xC3, 0xB6, 'k', 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_11[4] = { 0xC3, 0xA9, 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_9[] = {
+    /*  0 */ { 3, s_9_0, -1, 7, 0 },
+    /*  1 */ { 5, s_9_1, 0, 6, 0 },
+    /*  2 */ { 5, s_9_2, 0, 5, 0 },
+    /*  3 */ { 2, s_9_3, -1, 9, 0 },
+    /*  4 */ { 3, s_9_4, 3, 4, 0 },
+    /*  5 */ { 4, s_9_5, 4, 1, 0 },
+    /*  6 */ { 4, s_9_6, 4, 1, 0 },
+    /*  7 */ { 4, s_9_7, 4, 1, 0 },
+    /*  8 */ { 5, s_9_8, 4, 3, 0 },
+    /*  9 */ { 5, s_9_9, 4, 2, 0 },
+    /* 10 */ { 5, s_9_10, 4, 1, 0 },
+    /* 11 */ { 4, s_9_11, 3, 8, 0 }
+    };
+
+    static constexpr unsigned char s_10_0[1] = { 'a' };
+    static constexpr unsigned char s_10_1[2] = { 'j', 'a' };
+    static constexpr unsigned char s_10_2[1] = { 'd' };
+    static constexpr unsigned char s_10_3[2] = { 'a', 'd' };
+    static constexpr unsigned char s_10_4[2] = { 'e', 'd' };
+    static constexpr unsigned char s_10_5[2] = { 'o', 'd' };
+    static constexpr unsigned char s_10_6[3] = { 0xC3, 0xA1, 'd' };
+    static constexpr unsigned char s_10_7[3] = { 0xC3, 0xA9, 'd' };
+    static constexpr unsigned char s_10_8[3] = { 0xC3, 0xB6, 'd' };
+    static constexpr unsigned char s_10_9[1] = { 'e' };
+    static constexpr unsigned char s_10_10[2] = { 'j', 'e' };
+    static constexpr unsigned char s_10_11[2] = { 'n', 'k' };
+    static constexpr unsigned char s_10_12[3] = { 'u', 'n', 'k' };
+    static constexpr unsigned char s_10_13[4] = { 0xC3, 0xA1, 'n', 'k' };
+    static constexpr unsigned char s_10_14[4] = { 0xC3, 0xA9, 'n', 'k' };
+    static constexpr unsigned char s_10_15[4] = { 0xC3, 0xBC, 'n', 'k' };
+    static constexpr unsigned char s_10_16[2] = { 'u', 'k' };
+    static constexpr unsigned char s_10_17[3] = { 'j', 'u', 'k' };
+    static constexpr unsigned char s_10_18[5] = { 0xC3, 0xA1, 'j', 'u', 'k' };
+    static constexpr unsigned char s_10_19[3] = { 0xC3, 0xBC, 'k' };
+    static constexpr unsigned char s_10_20[4] = { 'j', 0xC3, 0xBC, 'k' };
+    static constexpr unsigned char s_10_21[6] = { 0xC3, 0xA9, 'j', 0xC3, 0xBC, 'k' };
+    static constexpr unsigned char s_10_22[1] = { 'm' };
+    static constexpr unsigned char s_10_23[2] = { 'a', 'm' };
+    static constexpr unsigned char s_10_24[2] = { 'e', 'm' };
+    static constexpr unsigned char s_10_25[2] = { 'o', 'm' };
+    static constexpr unsigned char s_10_26[3] = { 0xC3, 0xA1, 'm' };
+    static constexpr unsigned char s_10_27[3] = { 0xC3, 0xA9, 'm' };
+    static constexpr unsigned char s_10_28[1] = { 'o' };
+    static constexpr unsigned char s_10_29[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_10_30[2] = { 0xC3, 0xA9 };
+
+    static constexpr among<unsigned char> a_10[] = {
+    /*  0 */ { 1, s_10_0, -1, 18, 0 },
+    /*  1 */ { 2, s_10_1, 0, 17, 0 },
+    /*  2 */ { 1, s_10_2, -1, 16, 0 },
+    /*  3 */ { 2, s_10_3, 2, 13, 0 },
+    /*  4 */ { 2, s_10_4, 2, 13, 0 },
+    /*  5 */ { 2, s_10_5, 2, 13, 0 },
+    /*  6 */ { 3, s_10_6, 2, 14, 0 },
+    /*  7 */ { 3, s_10_7, 2, 15, 0 },
+    /*  8 */ { 3, s_10_8, 2, 13, 0 },
+    /*  9 */ { 1, s_10_9, -1, 18, 0 },
+    /* 10 */ { 2, s_10_10, 9, 17, 0 },
+    /* 11 */ { 2, s_10_11, -1, 4, 0 },
+    /* 12 */ { 3, s_10_12, 11, 1, 0 },
+    /* 13 */ { 4, s_10_13, 11, 2, 0 },
+    /* 14 */ { 4, s_10_14, 11, 3, 0 },
+    /* 15 */ { 4, s_10_15, 11, 1, 0 },
+    /* 16 */ { 2, s_10_16, -1, 8, 0 },
+    /* 17 */ { 3, s_10_17, 16, 7, 0 },
+    /* 18 */ { 5, s_10_18, 17, 5, 0 },
+    /* 19 */ { 3, s_10_19, -1, 8, 0 },
+    /* 20 */ { 4, s_10_20, 19, 7, 0 },
+    /* 21 */ { 6, s_10_21, 20, 6, 0 },
+    /* 22 */ { 1, s_10_22, -1, 12, 0 },
+    /* 23 */ { 2, s_10_23, 22, 9, 0 },
+    /* 24 */ { 2, s_10_24, 22, 9, 0 },
+    /* 25 */ { 2, s_10_25, 22, 9, 0 },
+    /* 26 */ { 3, s_10_26, 22, 10, 0 },
+    /* 27 */ { 3, s_10_27, 22, 11, 0 },
+    /* 28 */ { 1, s_10_28, -1, 18, 0 },
+    /* 29 */ { 2, s_10_29, -1, 19, 0 },
+    /* 30 */ { 2, s_10_30, -1, 20, 0 }
+    };
+
+    static constexpr unsigned char s_11_0[2] = { 'i', 'd' };
+    static constexpr unsigned char s_11_1[3] = { 'a', 'i', 'd' };
+    static constexpr unsigned char s_11_2[4] = { 'j', 'a', 'i', 'd' };
+    static constexpr unsigned char s_11_3[3] = { 'e', 'i', 'd' };
+    static constexpr unsigned char s_11_4[4] = { 'j', 'e', 'i', 'd' };
+    static constexpr unsigned char s_11_5[4] = { 0xC3, 0xA1, 'i', 'd' };
+    static constexpr unsigned char s_11_6[4] = { 0xC3, 0xA9, 'i', 'd' };
+    static constexpr unsigned char s_11_7[1] = { 'i' };
+    static constexpr unsigned char s_11_8[2] = { 'a', 'i' };
+    static constexpr unsigned char s_11_9[3] = { 'j', 'a', 'i' };
+    static constexpr unsigned char s_11_10[2] = { 'e', 'i' };
+    static constexpr unsigned char s_11_11[3] = { 'j', 'e', 'i' };
+    static constexpr unsigned char s_11_12[3] = { 0xC3, 0xA1, 'i' };
+    static constexpr unsigned char s_11_13[3] = { 0xC3, 0xA9, 'i' };
+    static constexpr unsigned char s_11_14[4] = { 'i', 't', 'e', 'k' };
+    static constexpr unsigned char s_11_15[5] = { 'e', 'i', 't', 'e', 'k' };
+    static constexpr unsigned char s_11_16[6] = { 'j', 'e', 'i', 't', 'e', 'k' };
+    static constexpr unsigned char s_11_17[6] = { 0xC3, 0xA9, 'i', 't', 'e', 'k' };
+    static constexpr unsigned char s_11_18[2] = { 'i', 'k' };
+    static constexpr unsigned char s_11_19[3] = { 'a', 'i', 'k' };
+    static constexpr unsigned char s_11_20[4] = { 'j', 'a', 'i', 'k' };
+    static constexpr unsigned char s_11_21[3] = { 'e', 'i', 'k' };
+    static constexpr unsigned char s_11_22[4] = { 'j', 'e', 'i', 'k' };
+    static constexpr unsigned char s_11_23[4] = { 0xC3, 0xA1, 'i', 'k' };
+    static constexpr unsigned char s_11_24[4] = { 0xC3, 0xA9, 'i', 'k' };
+    static constexpr unsigned char s_11_25[3] = { 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_26[4] = { 'a', 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_27[5] = { 'j', 'a', 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_28[4] = { 'e', 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_29[5] = { 'j', 'e', 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_30[5] = { 0xC3, 0xA1, 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_31[5] = { 0xC3, 0xA9, 'i', 'n', 'k' };
+    static constexpr unsigned char s_11_32[5] = { 'a', 'i', 't', 'o', 'k' };
+    static constexpr unsigned char s_11_33[6] = { 'j', 'a', 'i', 't', 'o', 'k' };
+    static constexpr unsigned char s_11_34[6] = { 0xC3, 0xA1, 'i', 't', 'o', 'k' };
+    static constexpr unsigned char s_11_35[2] = { 'i', 'm' };
+    static constexpr unsigned char s_11_36[3] = { 'a', 'i', 'm' };
+    static constexpr unsigned char s_11_37[4] = { 'j', 'a', 'i', 'm' };
+    static constexpr unsigned char s_11_38[3] = { 'e', 'i', 'm' };
+    static constexpr unsigned char s_11_39[4] = { 'j', 'e', 'i', 'm' };
+    static constexpr unsigned char s_11_40[4] = { 0xC3, 0xA1, 'i', 'm' };
+    static constexpr unsigned char s_11_41[4] = { 0xC3, 0xA9, 'i', 'm' };
+
+    static constexpr among<unsigned char> a_11[] = {
+    /*  0 */ { 2, s_11_0, -1, 10, 0 },
+    /*  1 */ { 3, s_11_1, 0, 9, 0 },
+    /*  2 */ { 4, s_11_2, 1, 6, 0 },
+    /*  3 */ { 3, s_11_3, 0, 9, 0 },
+    /*  4 */ { 4, s_11_4, 3, 6, 0 },
+    /*  5 */ { 4, s_11_5, 0, 7, 0 },
+    /*  6 */ { 4, s_11_6, 0, 8, 0 },
+    /*  7 */ { 1, s_11_7, -1, 15, 0 },
+    /*  8 */ { 2, s_11_8, 7, 14, 0 },
+    /*  9 */ { 3, s_11_9, 8, 11, 0 },
+    /* 10 */ { 2, s_11_10, 7, 14, 0 },
+    /* 11 */ { 3, s_11_11, 10, 11, 0 },
+    /* 12 */ { 3, s_11_12, 7, 12, 0 },
+    /* 13 */ { 3, s_11_13, 7, 13, 0 },
+    /* 14 */ { 4, s_11_14, -1, 24, 0 },
+    /* 15 */ { 5, s_11_15, 14, 21, 0 },
+    /* 16 */ { 6, s_11_16, 15, 20, 0 },
+    /* 17 */ { 6, s_11_17, 14, 23, 0 },
+    /* 18 */ { 2, s_11_18, -1, 29, 0 },
+    /* 19 */ { 3, s_11_19, 18, 26, 0 },
+    /* 20 */ { 4, s_11_20, 19, 25, 0 },
+    /* 21 */ { 3, s_11_21, 18, 26, 0 },
+    /* 22 */ { 4, s_11_22, 21, 25, 0 },
+    /* 23 */ { 4, s_11_23, 18, 27, 0 },
+    /* 24 */ { 4, s_11_24, 18, 28, 0 },
+    /* 25 */ { 3, s_11_25, -1, 20, 0 },
+    /* 26 */ { 4, s_11_26, 25, 17, 0 },
+    /* 27 */ { 5, s_11_27, 26, 16, 0 },
+    /* 28 */ { 4, s_11_28, 25, 17, 0 },
+    /* 29 */ { 5, s_11_29, 28, 16, 0 },
+    /* 30 */ { 5, s_11_30, 25, 18, 0 },
+    /* 31 */ { 5, s_11_31, 25, 19, 0 },
+    /* 32 */ { 5, s_11_32, -1, 21, 0 },
+    /* 33 */ { 6, s_11_33, 32, 20, 0 },
+    /* 34 */ { 6, s_11_34, -1, 22, 0 },
+    /* 35 */ { 2, s_11_35, -1, 5, 0 },
+    /* 36 */ { 3, s_11_36, 35, 4, 0 },
+    /* 37 */ { 4, s_11_37, 36, 1, 0 },
+    /* 38 */ { 3, s_11_38, 35, 4, 0 },
+    /* 39 */ { 4, s_11_39, 38, 1, 0 },
+    /* 40 */ { 4, s_11_40, 35, 2, 0 },
+    /* 41 */ { 4, s_11_41, 35, 3, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'a' };
+    static constexpr unsigned char s_1[] = { 'e' };
+    static constexpr unsigned char s_2[] = { 'e' };
+    static constexpr unsigned char s_3[] = { 'a' };
+    static constexpr unsigned char s_4[] = { 'a' };
+    static constexpr unsigned char s_5[] = { 'a' };
+    static constexpr unsigned char s_6[] = { 'e' };
+    static constexpr unsigned char s_7[] = { 'a' };
+    static constexpr unsigned char s_8[] = { 'e' };
+    static constexpr unsigned char s_9[] = { 'e' };
+    static constexpr unsigned char s_10[] = { 'a' };
+    static constexpr unsigned char s_11[] = { 'e' };
+    static constexpr unsigned char s_12[] = { 'a' };
+    static constexpr unsigned char s_13[] = { 'e' };
+    static constexpr unsigned char s_14[] = { 'a' };
+    static constexpr unsigned char s_15[] = { 'e' };
+    static constexpr unsigned char s_16[] = { 'a' };
+    static constexpr unsigned char s_17[] = { 'e' };
+    static constexpr unsigned char s_18[] = { 'a' };
+    static constexpr unsigned char s_19[] = { 'e' };
+    static constexpr unsigned char s_20[] = { 'a' };
+    static constexpr unsigned char s_21[] = { 'e' };
+    static constexpr unsigned char s_22[] = { 'a' };
+    static constexpr unsigned char s_23[] = { 'e' };
+    static constexpr unsigned char s_24[] = { 'a' };
+    static constexpr unsigned char s_25[] = { 'e' };
+    static constexpr unsigned char s_26[] = { 'a' };
+    static constexpr unsigned char s_27[] = { 'e' };
+    static constexpr unsigned char s_28[] = { 'a' };
+    static constexpr unsigned char s_29[] = { 'e' };
+    static constexpr unsigned char s_30[] = { 'a' };
+    static constexpr unsigned char s_31[] = { 'e' };
+    static constexpr unsigned char s_32[] = { 'a' };
+    static constexpr unsigned char s_33[] = { 'e' };
+    static constexpr unsigned char s_34[] = { 'a' };
+    static constexpr unsigned char s_35[] = { 'e' };
+};
+
+template <>
+struct hungarian_stemmer_data<false> : hungarian_stemmer_groupings {
+    static constexpr char32_t s_0_0[2] = { 'c', 's' };
+    static constexpr char32_t s_0_1[3] = { 'd', 'z', 's' };
+    static constexpr char32_t s_0_2[2] = { 'g', 'y' };
+    static constexpr char32_t s_0_3[2] = { 'l', 'y' };
+    static constexpr char32_t s_0_4[2] = { 'n', 'y' };
+    static constexpr char32_t s_0_5[2] = { 's', 'z' };
+    static constexpr char32_t s_0_6[2] = { 't', 'y' };
+    static constexpr char32_t s_0_7[2] = { 'z', 's' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 2, s_0_0, -1, -1, 0 },
+    /*  1 */ { 3, s_0_1, -1, -1, 0 },
+    /*  2 */ { 2, s_0_2, -1, -1, 0 },
+    /*  3 */ { 2, s_0_3, -1, -1, 0 },
+    /*  4 */ { 2, s_0_4, -1, -1, 0 },
+    /*  5 */ { 2, s_0_5, -1, -1, 0 },
+    /*  6 */ { 2, s_0_6, -1, -1, 0 },
+    /*  7 */ { 2, s_0_7, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[1] = { 0xE1 };
+    static constexpr char32_t s_1_1[1] = { 0xE9 };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 1, s_1_0, -1, 1, 0 },
+    /*  1 */ { 1, s_1_1, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'b', 'b' };
+    static constexpr char32_t s_2_1[2] = { 'c', 'c' };
+    static constexpr char32_t s_2_2[2] = { 'd', 'd' };
+    static constexpr char32_t s_2_3[2] = { 'f', 'f' };
+    static constexpr char32_t s_2_4[2] = { 'g', 'g' };
+    static constexpr char32_t s_2_5[2] = { 'j', 'j' };
+    static constexpr char32_t s_2_6[2] = { 'k', 'k' };
+    static constexpr char32_t s_2_7[2] = { 'l', 'l' };
+    static constexpr char32_t s_2_8[2] = { 'm', 'm' };
+    static constexpr char32_t s_2_9[2] = { 'n', 'n' };
+    static constexpr char32_t s_2_10[2] = { 'p', 'p' };
+    static constexpr char32_t s_2_11[2] = { 'r', 'r' };
+    static constexpr char32_t s_2_12[3] = { 'c', 'c', 's' };
+    static constexpr char32_t s_2_13[2] = { 's', 's' };
+    static constexpr char32_t s_2_14[3] = { 'z', 'z', 's' };
+    static constexpr char32_t s_2_15[2] = { 't', 't' };
+    static constexpr char32_t s_2_16[2] = { 'v', 'v' };
+    static constexpr char32_t s_2_17[3] = { 'g', 'g', 'y' };
+    static constexpr char32_t s_2_18[3] = { 'l', 'l', 'y' };
+    static constexpr char32_t s_2_19[3] = { 'n', 'n', 'y' };
+    static constexpr char32_t s_2_20[3] = { 't', 't', 'y' };
+    static constexpr char32_t s_2_21[3] = { 's', 's', 'z' };
+    static constexpr char32_t s_2_22[2] = { 'z', 'z' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 },
+    /*  3 */ { 2, s_2_3, -1, -1, 0 },
+    /*  4 */ { 2, s_2_4, -1, -1, 0 },
+    /*  5 */ { 2, s_2_5, -1, -1, 0 },
+    /*  6 */ { 2, s_2_6, -1, -1, 0 },
+    /*  7 */ { 2, s_2_7, -1, -1, 0 },
+    /*  8 */ { 2, s_2_8, -1, -1, 0 },
+    /*  9 */ { 2, s_2_9, -1, -1, 0 },
+    /* 10 */ { 2, s_2_10, -1, -1, 0 },
+    /* 11 */ { 2, s_2_11, -1, -1, 0 },
+    /* 12 */ { 3, s_2_12, -1, -1, 0 },
+    /* 13 */ { 2, s_2_13, -1, -1, 0 },
+    /* 14 */ { 3, s_2_14, -1, -1, 0 },
+    /* 15 */ { 2, s_2_15, -1, -1, 0 },
+    /* 16 */ { 2, s_2_16, -1, -1, 0 },
+    /* 17 */ { 3, s_2_17, -1, -1, 0 },
+    /* 18 */ { 3, s_2_18, -1, -1, 0 },
+    /* 19 */ { 3, s_2_19, -1, -1, 0 },
+    /* 20 */ { 3, s_2_20, -1, -1, 0 },
+    /* 21 */ { 3, s_2_21, -1, -1, 0 },
+    /* 22 */ { 2, s_2_22, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[2] = { 'a', 'l' };
+    static constexpr char32_t s_3_1[2] = { 'e', 'l' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 1, 0 },
+    /*  1 */ { 2, s_3_1, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_4_0[2] = { 'b', 'a' };
+    static constexpr char32_t s_4_1[2] = { 'r', 'a' };
+    static constexpr char32_t s_4_2[2] = { 'b', 'e' };
+    static constexpr char32_t s_4_3[2] = { 'r', 'e' };
+    static constexpr char32_t s_4_4[2] = { 'i', 'g' };
+    static constexpr char32_t s_4_5[3] = { 'n', 'a', 'k' };
+    static constexpr char32_t s_4_6[3] = { 'n', 'e', 'k' };
+    static constexpr char32_t s_4_7[3] = { 'v', 'a', 'l' };
+    static constexpr char32_t s_4_8[3] = { 'v', 'e', 'l' };
+    static constexpr char32_t s_4_9[2] = { 'u', 'l' };
+    static constexpr char32_t s_4_10[3] = { 'n', 0xE1, 'l' };
+    static constexpr char32_t s_4_11[3] = { 'n', 0xE9, 'l' };
+    static constexpr char32_t s_4_12[3] = { 'b', 0xF3, 'l' };
+    static constexpr char32_t s_4_13[3] = { 'r', 0xF3, 'l' };
+    static constexpr char32_t s_4_14[3] = { 't', 0xF3, 'l' };
+    static constexpr char32_t s_4_15[2] = { 0xFC, 'l' };
+    static constexpr char32_t s_4_16[3] = { 'b', 0x151, 'l' };
+    static constexpr char32_t s_4_17[3] = { 'r', 0x151, 'l' };
+    static constexpr char32_t s_4_18[3] = { 't', 0x151, 'l' };
+    static constexpr char32_t s_4_19[1] = { 'n' };
+    static constexpr char32_t s_4_20[2] = { 'a', 'n' };
+    static constexpr char32_t s_4_21[3] = { 'b', 'a', 'n' };
+    static constexpr char32_t s_4_22[2] = { 'e', 'n' };
+    static constexpr char32_t s_4_23[3] = { 'b', 'e', 'n' };
+    static constexpr char32_t s_4_24[6] = { 'k', 0xE9, 'p', 'p', 'e', 'n' };
+    static constexpr char32_t s_4_25[2] = { 'o', 'n' };
+    static constexpr char32_t s_4_26[2] = { 0xF6, 'n' };
+    static constexpr char32_t s_4_27[4] = { 'k', 0xE9, 'p', 'p' };
+    static constexpr char32_t s_4_28[3] = { 'k', 'o', 'r' };
+    static constexpr char32_t s_4_29[1] = { 't' };
+    static constexpr char32_t s_4_30[2] = { 'a', 't' };
+    static constexpr char32_t s_4_31[2] = { 'e', 't' };
+    static constexpr char32_t s_4_32[4] = { 'k', 0xE9, 'n', 't' };
+    static constexpr char32_t s_4_33[6] = { 'a', 'n', 'k', 0xE9, 'n', 't' };
+    static constexpr char32_t s_4_34[6] = { 'e', 'n', 'k', 0xE9, 'n', 't' };
+    static constexpr char32_t s_4_35[6] = { 'o', 'n', 'k', 0xE9, 'n', 't' };
+    static constexpr char32_t s_4_36[2] = { 'o', 't' };
+    static constexpr char32_t s_4_37[3] = { 0xE9, 'r', 't' };
+    static constexpr char32_t s_4_38[2] = { 0xF6, 't' };
+    static constexpr char32_t s_4_39[3] = { 'h', 'e', 'z' };
+    static constexpr char32_t s_4_40[3] = { 'h', 'o', 'z' };
+    static constexpr char32_t s_4_41[3] = { 'h', 0xF6, 'z' };
+    static constexpr char32_t s_4_42[2] = { 'v', 0xE1 };
+    static constexpr char32_t s_4_43[2] = { 'v', 0xE9 };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, -1, 0 },
+    /*  1 */ { 2, s_4_1, -1, -1, 0 },
+    /*  2 */ { 2, s_4_2, -1, -1, 0 },
+    /*  3 */ { 2, s_4_3, -1, -1, 0 },
+    /*  4 */ { 2, s_4_4, -1, -1, 0 },
+    /*  5 */ { 3, s_4_5, -1, -1, 0 },
+    /*  6 */ { 3, s_4_6, -1, -1, 0 },
+    /*  7 */ { 3, s_4_7, -1, -1, 0 },
+    /*  8 */ { 3, s_4_8, -1, -1, 0 },
+    /*  9 */ { 2, s_4_9, -1, -1, 0 },
+    /* 10 */ { 3, s_4_10, -1, -1, 0 },
+    /* 11 */ { 3, s_4_11, -1, -1, 0 },
+    /* 12 */ { 3, s_4_12, -1, -1, 0 },
+    /* 13 */ { 3, s_4_13, -1, -1, 0 },
+    /* 14 */ { 3, s_4_14, -1, -1, 0 },
+    /* 15 */ { 2, s_4_15, -1, -1, 0 },
+    /* 16 */ { 3, s_4_16, -1, -1, 0 },
+    /* 17 */ { 3, s_4_17, -1, -1, 0 },
+    /* 18 */ { 3, s_4_18, -1, -1, 0 },
+    /* 19 */ { 1, s_4_19, -1, -1, 0 },
+    /* 20 */ { 2, s_4_20, 19, -1, 0 },
+    /* 21 */ { 3, s_4_21, 20, -1, 0 },
+    /* 22 */ { 2, s_4_22, 19, -1, 0 },
+    /* 23 */ { 3, s_4_23, 22, -1, 0 },
+    /* 24 */ { 6, s_4_24, 22, -1, 0 },
+    /* 25 */ { 2, s_4_25, 19, -1, 0 },
+    /* 26 */ { 2, s_4_26, 19, -1, 0 },
+    /* 27 */ { 4, s_4_27, -1, -1, 0 },
+    /* 28 */ { 3, s_4_28, -1, -1, 0 },
+    /* 29 */ { 1, s_4_29, -1, -1, 0 },
+    /* 30 */ { 2, s_4_30, 29, -1, 0 },
+    /* 31 */ { 2, s_4_31, 29, -1, 0 },
+    /* 32 */ { 4, s_4_32, 29, -1, 0 },
+    /* 33 */ { 6, s_4_33, 32, -1, 0 },
+    /* 34 */ { 6, s_4_34, 32, -1, 0 },
+    /* 35 */ { 6, s_4_35, 32, -1, 0 },
+    /* 36 */ { 2, s_4_36, 29, -1, 0 },
+    /* 37 */ { 3, s_4_37, 29, -1, 0 },
+    /* 38 */ { 2, s_4_38, 29, -1, 0 },
+    /* 39 */ { 3, s_4_39, -1, -1, 0 },
+    /* 40 */ { 3, s_4_40, -1, -1, 0 },
+    /* 41 */ { 3, s_4_41, -1, -1, 0 },
+    /* 42 */ { 2, s_4_42, -1, -1, 0 },
+    /* 43 */ { 2, s_4_43, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 0xE1, 'n' };
+    static constexpr char32_t s_5_1[2] = { 0xE9, 'n' };
+    static constexpr char32_t s_5_2[6] = { 0xE1, 'n', 'k', 0xE9, 'n', 't' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 2, 0 },
+    /*  1 */ { 2, s_5_1, -1, 1, 0 },
+    /*  2 */ { 6, s_5_2, -1, 3, 0 }
+    };
+
+    static constexpr char32_t s_6_0[4] = { 's', 't', 'u', 'l' };
+    static constexpr char32_t s_6_1[5] = { 'a', 's', 't', 'u', 'l' };
+    static constexpr char32_t s_6_2[5] = { 0xE1, 's', 't', 'u', 'l' };
+    static constexpr char32_t s_6_3[4] = { 's', 't', 0xFC, 'l' };
+    static constexpr char32_t s_6_4[5] = { 'e', 's', 't', 0xFC, 'l' };
+    static constexpr char32_t s_6_5[5] = { 0xE9, 's', 't', 0xFC, 'l' };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 4, s_6_0, -1, 2, 0 },
+    /*  1 */ { 5, s_6_1, 0, 1, 0 },
+    /*  2 */ { 5, s_6_2, 0, 3, 0 },
+    /*  3 */ { 4, s_6_3, -1, 2, 0 },
+    /*  4 */ { 5, s_6_4, 3, 1, 0 },
+    /*  5 */ { 5, s_6_5, 3, 4, 0 }
+    };
+
+    static constexpr char32_t s_7_0[1] = { 0xE1 };
+    static constexpr char32_t s_7_1[1] = { 0xE9 };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 1, s_7_0, -1, 1, 0 },
+    /*  1 */ { 1, s_7_1, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_8_0[1] = { 'k' };
+    static constexpr char32_t s_8_1[2] = { 'a', 'k' };
+    static constexpr char32_t s_8_2[2] = { 'e', 'k' };
+    static constexpr char32_t s_8_3[2] = { 'o', 'k' };
+    static constexpr char32_t s_8_4[2] = { 0xE1, 'k' };
+    static constexpr char32_t s_8_5[2] = { 0xE9, 'k' };
+    static constexpr char32_t s_8_6[2] = { 0xF6, 'k' };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, 7, 0 },
+    /*  1 */ { 2, s_8_1, 0, 4, 0 },
+    /*  2 */ { 2, s_8_2, 0, 6, 0 },
+    /*  3 */ { 2, s_8_3, 0, 5, 0 },
+    /*  4 */ { 2, s_8_4, 0, 1, 0 },
+    /*  5 */ { 2, s_8_5, 0, 2, 0 },
+    /*  6 */ { 2, s_8_6, 0, 3, 0 }
+    };
+
+    static constexpr char32_t s_9_0[2] = { 0xE9, 'i' };
+    static constexpr char32_t s_9_1[3] = { 0xE1, 0xE9, 'i' };
+    static constexpr char32_t s_9_2[3] = { 0xE9, 0xE9, 'i' };
+    static constexpr char32_t s_9_3[1] = { 0xE9 };
+    static constexpr char32_t s_9_4[2] = { 'k', 0xE9 };
+    static constexpr char32_t s_9_5[3] = { 'a', 'k', 0xE9 };
+    static constexpr char32_t s_9_6[3] = { 'e', 'k', 0xE9 };
+    static constexpr char32_t s_9_7[3] = { 'o', 'k', 0xE9 };
+    static constexpr char32_t s_9_8[3] = { 0xE1, 'k', 0xE9 };
+    static constexpr char32_t s_9_9[3] = { 0xE9, 'k', 0xE9 };
+    static constexpr char32_t s_9_10[3] = { 0xF6, 'k', 0xE9 };
+    static constexpr char32_t s_9_11[2] = { 0xE9, 0xE9 };
+
+    static constexpr among<char32_t> a_9[] = {
+    /*  0 */ { 2, s_9_0, -1, 7, 0 },
+    /*  1 */ { 3, s_9_1, 0, 6, 0 },
+    /*  2 */ { 3, s_9_2, 0, 5, 0 },
+    /*  3 */ { 1, s_9_3, -1, 9, 0 },
+    /*  4 */ { 2, s_9_4, 3, 4, 0 },
+    /*  5 */ { 3, s_9_5, 4, 1, 0 },
+    /*  6 */ { 3, s_9_6, 4, 1, 0 },
+    /*  7 */ { 3, s_9_7, 4, 1, 0 },
+    /*  8 */ { 3, s_9_8, 4, 3, 0 },
+    /*  9 */ { 3, s_9_9, 4, 2, 0 },
+    /* 10 */ { 3, s_9_10, 4, 1, 0 },
+    /* 11 */ { 2, s_9_11, 3, 8, 0 }
+    };
+
+    static constexpr char32_t s_10_0[1] = { 'a' };
+    static constexpr char32_t s_10_1[2] = { 'j', 'a' };
+    static constexpr char32_t s_10_2[1] = { 'd' };
+    static constexpr char32_t s_10_3[2] = { 'a', 'd' };
+    static constexpr char32_t s_10_4[2] = { 'e', 'd' };
+    static constexpr char32_t s_10_5[2] = { 'o', 'd' };
+    static constexpr char32_t s_10_6[2] = { 0xE1, 'd' };
+    static constexpr char32_t s_10_7[2] = { 0xE9, 'd' };
+    static constexpr char32_t s_10_8[2] = { 0xF6, 'd' };
+    static constexpr char32_t s_10_9[1] = { 'e' };
+    static constexpr char32_t s_10_10[2] = { 'j', 'e' };
+    static constexpr char32_t s_10_11[2] = { 'n', 'k' };
+    static constexpr char32_t s_10_12[3] = { 'u', 'n', 'k' };
+    static constexpr char32_t s_10_13[3] = { 0xE1, 'n', 'k' };
+    static constexpr char32_t s_10_14[3] = { 0xE9, 'n', 'k' };
+    static constexpr char32_t s_10_15[3] = { 0xFC, 'n', 'k' };
+    static constexpr char32_t s_10_16[2] = { 'u', 'k' };
+    static constexpr char32_t s_10_17[3] = { 'j', 'u', 'k' };
+    static constexpr char32_t s_10_18[4] = { 0xE1, 'j', 'u', 'k' };
+    static constexpr char32_t s_10_19[2] = { 0xFC, 'k' };
+    static constexpr char32_t s_10_20[3] = { 'j', 0xFC, 'k' };
+    static constexpr char32_t s_10_21[4] = { 0xE9, 'j', 0xFC, 'k' };
+    static constexpr char32_t s_10_22[1] = { 'm' };
+    static constexpr char32_t s_10_23[2] = { 'a', 'm' };
+    static constexpr char32_t s_10_24[2] = { 'e', 'm' };
+    static constexpr char32_t s_10_25[2] = { 'o', 'm' };
+    static constexpr char32_t s_10_26[2] = { 0xE1, 'm' };
+    static constexpr char32_t s_10_27[2] = { 0xE9, 'm' };
+    static constexpr char32_t s_10_28[1] = { 'o' };
+    static constexpr char32_t s_10_29[1] = { 0xE1 };
+    static constexpr char32_t s_10_30[1] = { 0xE9 };
+
+    static constexpr among<char32_t> a_10[] = {
+    /*  0 */ { 1, s_10_0, -1, 18, 0 },
+    /*  1 */ { 2, s_10_1, 0, 17, 0 },
+    /*  2 */ { 1, s_10_2, -1, 16, 0 },
+    /*  3 */ { 2, s_10_3, 2, 13, 0 },
+    /*  4 */ { 2, s_10_4, 2, 13, 0 },
+    /*  5 */ { 2, s_10_5, 2, 13, 0 },
+    /*  6 */ { 2, s_10_6, 2, 14, 0 },
+    /*  7 */ { 2, s_10_7, 2, 15, 0 },
+    /*  8 */ { 2, s_10_8, 2, 13, 0 },
+    /*  9 */ { 1, s_10_9, -1, 18, 0 },
+    /* 10 */ { 2, s_10_10, 9, 17, 0 },
+    /* 11 */ { 2, s_10_11, -1, 4, 0 },
+    /* 12 */ { 3, s_10_12, 11, 1, 0 },
+    /* 13 */ { 3, s_10_13, 11, 2, 0 },
+    /* 14 */ { 3, s_10_14, 11, 3, 0 },
+    /* 15 */ { 3, s_10_15, 11, 1, 0 },
+    /* 16 */ { 2, s_10_16, -1, 8, 0 },
+    /* 17 */ { 3, s_10_17, 16, 7, 0 },
+    /* 18 */ { 4, s_10_18, 17, 5, 0 },
+    /* 19 */ { 2, s_10_19, -1, 8, 0 },
+    /* 20 */ { 3, s_10_20, 19, 7, 0 },
+    /* 21 */ { 4, s_10_21, 20, 6, 0 },
+    /* 22 */ { 1, s_10_22, -1, 12, 0 },
+    /* 23 */ { 2, s_10_23, 22, 9, 0 },
+    /* 24 */ { 2, s_10_24, 22, 9, 0 },
+    /* 25 */ { 2, s_10_25, 22, 9, 0 },
+    /* 26 */ { 2, s_10_26, 22, 10, 0 },
+    /* 27 */ { 2, s_10_27, 22, 11, 0 },
+    /* 28 */ { 1, s_10_28, -1, 18, 0 },
+    /* 29 */ { 1, s_10_29, -1, 19, 0 },
+    /* 30 */ { 1, s_10_30, -1, 20, 0 }
+    };
+
+    static constexpr char32_t s_11_0[2] = { 'i', 'd' };
+    static constexpr char32_t s_11_1[3] = { 'a', 'i', 'd' };
+    static constexpr char32_t s_11_2[4] = { 'j', 'a', 'i', 'd' };
+    static constexpr char32_t s_11_3[3] = { 'e', 'i', 'd' };
+    static constexpr char32_t s_11_4[4] = { 'j', 'e', 'i', 'd' };
+    static constexpr char32_t s_11_5[3] = { 0xE1, 'i', 'd' };
+    static constexpr char32_t s_11_6[3] = { 0xE9, 'i', 'd' };
+    static constexpr char32_t s_11_7[1] = { 'i' };
+    static constexpr char32_t s_11_8[2] = { 'a', 'i' };
+    static constexpr char32_t s_11_9[3] = { 'j', 'a', 'i' };
+    static constexpr char32_t s_11_10[2] = { 'e', 'i' };
+    static constexpr char32_t s_11_11[3] = { 'j', 'e', 'i' };
+    static constexpr char32_t s_11_12[2] = { 0xE1, 'i' };
+    static constexpr char32_t s_11_13[2] = { 0xE9, 'i' };
+    static constexpr char32_t s_11_14[4] = { 'i', 't', 'e', 'k' };
+    static constexpr char32_t s_11_15[5] = { 'e', 'i', 't', 'e', 'k' };
+    static constexpr char32_t s_11_16[6] = { 'j', 'e', 'i', 't', 'e', 'k' };
+    static constexpr char32_t s_11_17[5] = { 0xE9, 'i', 't', 'e', 'k' };
+    static constexpr char32_t s_11_18[2] = { 'i', 'k' };
+    static constexpr char32_t s_11_19[3] = { 'a', 'i', 'k' };
+    static constexpr char32_t s_11_20[4] = { 'j', 'a', 'i', 'k' };
+    static constexpr char32_t s_11_21[3] = { 'e', 'i', 'k' };
+    static constexpr char32_t s_11_22[4] = { 'j', 'e', 'i', 'k' };
+    static constexpr char32_t s_11_23[3] = { 0xE1, 'i', 'k' };
+    static constexpr char32_t s_11_24[3] = { 0xE9, 'i', 'k' };
+    static constexpr char32_t s_11_25[3] = { 'i', 'n', 'k' };
+    static constexpr char32_t s_11_26[4] = { 'a', 'i', 'n', 'k' };
+    static constexpr char32_t s_11_27[5] = { 'j', 'a', 'i', 'n', 'k' };
+    static constexpr char32_t s_11_28[4] = { 'e', 'i', 'n', 'k' };
+    static constexpr char32_t s_11_29[5] = { 'j', 'e', 'i', 'n', 'k' };
+    static constexpr char32_t s_11_30[4] = { 0xE1, 'i', 'n', 'k' };
+    static constexpr char32_t s_11_31[4] = { 0xE9, 'i', 'n', 'k' };
+    static constexpr char32_t s_11_32[5] = { 'a', 'i', 't', 'o', 'k' };
+    static constexpr char32_t s_11_33[6] = { 'j', 'a', 'i', 't', 'o', 'k' };
+    static constexpr char32_t s_11_34[5] = { 0xE1, 'i', 't', 'o', 'k' };
+    static constexpr char32_t s_11_35[2] = { 'i', 'm' };
+    static constexpr char32_t s_11_36[3] = { 'a', 'i', 'm' };
+    static constexpr char32_t s_11_37[4] = { 'j', 'a', 'i', 'm' };
+    static constexpr char32_t s_11_38[3] = { 'e', 'i', 'm' };
+    static constexpr char32_t s_11_39[4] = { 'j', 'e', 'i', 'm' };
+    static constexpr char32_t s_11_40[3] = { 0xE1, 'i', 'm' };
+    static constexpr char32_t s_11_41[3] = { 0xE9, 'i', 'm' };
+
+    static constexpr among<char32_t> a_11[] = {
+    /*  0 */ { 2, s_11_0, -1, 10, 0 },
+    /*  1 */ { 3, s_11_1, 0, 9, 0 },
+    /*  2 */ { 4, s_11_2, 1, 6, 0 },
+    /*  3 */ { 3, s_11_3, 0, 9, 0 },
+    /*  4 */ { 4, s_11_4, 3, 6, 0 },
+    /*  5 */ { 3, s_11_5, 0, 7, 0 },
+    /*  6 */ { 3, s_11_6, 0, 8, 0 },
+    /*  7 */ { 1, s_11_7, -1, 15, 0 },
+    /*  8 */ { 2, s_11_8, 7, 14, 0 },
+    /*  9 */ { 3, s_11_9, 8, 11, 0 },
+    /* 10 */ { 2, s_11_10, 7, 14, 0 },
+    /* 11 */ { 3, s_11_11, 10, 11, 0 },
+    /* 12 */ { 2, s_11_12, 7, 12, 0 },
+    /* 13 */ { 2, s_11_13, 7, 13, 0 },
+    /* 14 */ { 4, s_11_14, -1, 24, 0 },
+    /* 15 */ { 5, s_11_15, 14, 21, 0 },
+    /* 16 */ { 6, s_11_16, 15, 20, 0 },
+    /* 17 */ { 5, s_11_17, 14, 23, 0 },
+    /* 18 */ { 2, s_11_18, -1, 29, 0 },
+    /* 19 */ { 3, s_11_19, 18, 26, 0 },
+    /* 20 */ { 4, s_11_20, 19, 25, 0 },
+    /* 21 */ { 3, s_11_21, 18, 26, 0 },
+    /* 22 */ { 4, s_11_22, 21, 25, 0 },
+    /* 23 */ { 3, s_11_23, 18, 27, 0 },
+    /* 24 */ { 3, s_11_24, 18, 28, 0 },
+    /* 25 */ { 3, s_11_25, -1, 20, 0 },
+    /* 26 */ { 4, s_11_26, 25, 17, 0 },
+    /* 27 */ { 5, s_11_27, 26, 16, 0 },
+    /* 28 */ { 4, s_11_28, 25, 17, 0 },
+    /* 29 */ { 5, s_11_29, 28, 16, 0 },
+    /* 30 */ { 4, s_11_30, 25, 18, 0 },
+    /* 31 */ { 4, s_11_31, 25, 19, 0 },
+    /* 32 */ { 5, s_11_32, -1, 21, 0 },
+    /* 33 */ { 6, s_11_33, 32, 20, 0 },
+    /* 34 */ { 5, s_11_34, -1, 22, 0 },
+    /* 35 */ { 2, s_11_35, -1, 5, 0 },
+    /* 36 */ { 3, s_11_36, 35, 4, 0 },
+    /* 37 */ { 4, s_11_37, 36, 1, 0 },
+    /* 38 */ { 3, s_11_38, 35, 4, 0 },
+    /* 39 */ { 4, s_11_39, 38, 1, 0 },
+    /* 40 */ { 3, s_11_40, 35, 2, 0 },
+    /* 41 */ { 3, s_11_41, 35, 3, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'a' };
+    static constexpr char32_t s_1[] = { 'e' };
+    static constexpr char32_t s_2[] = { 'e' };
+    static constexpr char32_t s_3[] = { 'a' };
+    static constexpr char32_t s_4[] = { 'a' };
+    static constexpr char32_t s_5[] = { 'a' };
+    static constexpr char32_t s_6[] = { 'e' };
+    static constexpr char32_t s_7[] = { 'a' };
+    static constexpr char32_t s_8[] = { 'e' };
+    static constexpr char32_t s_9[] = { 'e' };
+    static constexpr char32_t s_10[] = { 'a' };
+    static constexpr char32_t s_11[] = { 'e' };
+    static constexpr char32_t s_12[] = { 'a' };
+    static constexpr char32_t s_13[] = { 'e' };
+    static constexpr char32_t s_14[] = { 'a' };
+    static constexpr char32_t s_15[] = { 'e' };
+    static constexpr char32_t s_16[] = { 'a' };
+    static constexpr char32_t s_17[] = { 'e' };
+    static constexpr char32_t s_18[] = { 'a' };
+    static constexpr char32_t s_19[] = { 'e' };
+    static constexpr char32_t s_20[] = { 'a' };
+    static constexpr char32_t s_21[] = { 'e' };
+    static constexpr char32_t s_22[] = { 'a' };
+    static constexpr char32_t s_23[] = { 'e' };
+    static constexpr char32_t s_24[] = { 'a' };
+    static constexpr char32_t s_25[] = { 'e' };
+    static constexpr char32_t s_26[] = { 'a' };
+    static constexpr char32_t s_27[] = { 'e' };
+    static constexpr char32_t s_28[] = { 'a' };
+    static constexpr char32_t s_29[] = { 'e' };
+    static constexpr char32_t s_30[] = { 'a' };
+    static constexpr char32_t s_31[] = { 'e' };
+    static constexpr char32_t s_32[] = { 'a' };
+    static constexpr char32_t s_33[] = { 'e' };
+    static constexpr char32_t s_34[] = { 'a' };
+    static constexpr char32_t s_35[] = { 'e' };
+};
+
+template <typename symbol>
+class hungarian_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef hungarian_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 46 */
+        {   int c1 = c; /* or, line 51 */
+            if (in_grouping(data::g_v, 97, 369, 0)) goto lab1; /* grouping v, line 48 */
+            if (in_grouping(data::g_v, 97, 369, 1) < 0) goto lab1; /* goto */ /* non v, line 48 */
+            {   int c2 = c; /* or, line 49 */
+                if (!find_among(data::a_0)) goto lab3; /* among, line 49 */
+                goto lab2;
+            lab3:
+                c = c2;
+                {   int ret = hop(c, 0, l, 1); /* next, line 49 */
+                    if (ret < 0) goto lab1;
+                    c = ret;
+                }
+            }
+        lab2:
+            I_p1 = c; /* setmark p1, line 50 */
+            goto lab0;
+        lab1:
+            c = c1;
+            if (out_grouping(data::g_v, 97, 369, 0)) return false; /* non v, line 53 */
+            {    /* gopast */ /* grouping v, line 53 */
+                int ret = out_grouping(data::g_v, 97, 369, 1);
+                if (ret < 0) return false;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 53 */
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 58 */
+        return true;
+    }
+
+  private:
+    bool r_v_ending() {
+        int among_var;
+        ket = c; /* [, line 61 */
+        among_var = find_among_b(data::a_1); /* substring, line 61 */
+        if (!among_var) return false;
+        bra = c; /* ], line 61 */
+        if (!r_R1()) return false; /* call R1, line 61 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_0); /* <-, line 62 */
+                break;
+            case 2:
+                slice_from(data::s_1); /* <-, line 63 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_double() {
+        {   int m_test = l - c; /* test, line 68 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((106790108 >> (p[c - 1] & 0x1f)) & 1)) return false; /* among, line 68 */
+            if (!find_among_b(data::a_2)) return false; /* among, line 68 */
+            c = l - m_test;
+        }
+        return true;
+    }
+
+  private:
+    bool r_undouble() {
+        {   int ret = hop(c, lb, l, -1); /* next, line 73 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        ket = c; /* [, line 73 */
+        {   int ret = hop(c, lb, l, -1); /* hop, line 73 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        bra = c; /* ], line 73 */
+        slice_del(); /* delete, line 73 */
+        return true;
+    }
+
+  private:
+    bool r_instrum() {
+        int among_var;
+        ket = c; /* [, line 77 */
+        if (c - 1 <= lb || p[c - 1] != 108) return false; /* substring, line 77 */
+        among_var = find_among_b(data::a_3); /* substring, line 77 */
+        if (!among_var) return false;
+        bra = c; /* ], line 77 */
+        if (!r_R1()) return false; /* call R1, line 77 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_double()) return false; /* call double, line 78 */
+                break;
+            case 2:
+                if (!r_double()) return false; /* call double, line 79 */
+                break;
+        }
+        slice_del(); /* delete, line 81 */
+        if (!r_undouble()) return false; /* call undouble, line 82 */
+        return true;
+    }
+
+  private:
+    bool r_case() {
+        ket = c; /* [, line 87 */
+        if (!find_among_b(data::a_4)) return false; /* substring, line 87 */
+        bra = c; /* ], line 87 */
+        if (!r_R1()) return false; /* call R1, line 87 */
+        slice_del(); /* delete, line 111 */
+        if (!r_v_ending()) return false; /* call v_ending, line 112 */
+        return true;
+    }
+
+  private:
+    bool r_case_special() {
+        int among_var;
+        ket = c; /* [, line 116 */
+        if (c - 1 <= lb || (p[c - 1] != 110 && p[c - 1] != 116)) return false; /* substring, line 116 */
+        among_var = find_among_b(data::a_5); /* substring, line 116 */
+        if (!among_var) return false;
+        bra = c; /* ], line 116 */
+        if (!r_R1()) return false; /* call R1, line 116 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_2); /* <-, line 117 */
+                break;
+            case 2:
+                slice_from(data::s_3); /* <-, line 118 */
+                break;
+            case 3:
+                slice_from(data::s_4); /* <-, line 119 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_case_other() {
+        int among_var;
+        ket = c; /* [, line 124 */
+        if (c - 3 <= lb || p[c - 1] != 108) return false; /* substring, line 124 */
+        among_var = find_among_b(data::a_6); /* substring, line 124 */
+        if (!among_var) return false;
+        bra = c; /* ], line 124 */
+        if (!r_R1()) return false; /* call R1, line 124 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 125 */
+                break;
+            case 2:
+                slice_del(); /* delete, line 126 */
+                break;
+            case 3:
+                slice_from(data::s_5); /* <-, line 127 */
+                break;
+            case 4:
+                slice_from(data::s_6); /* <-, line 128 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_factive() {
+        int among_var;
+        ket = c; /* [, line 133 */
+        among_var = find_among_b(data::a_7); /* substring, line 133 */
+        if (!among_var) return false;
+        bra = c; /* ], line 133 */
+        if (!r_R1()) return false; /* call R1, line 133 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_double()) return false; /* call double, line 134 */
+                break;
+            case 2:
+                if (!r_double()) return false; /* call double, line 135 */
+                break;
+        }
+        slice_del(); /* delete, line 137 */
+        if (!r_undouble()) return false; /* call undouble, line 138 */
+        return true;
+    }
+
+  private:
+    bool r_plural() {
+        int among_var;
+        ket = c; /* [, line 142 */
+        if (c <= lb || p[c - 1] != 107) return false; /* substring, line 142 */
+        among_var = find_among_b(data::a_8); /* substring, line 142 */
+        if (!among_var) return false;
+        bra = c; /* ], line 142 */
+        if (!r_R1()) return false; /* call R1, line 142 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_7); /* <-, line 143 */
+                break;
+            case 2:
+                slice_from(data::s_8); /* <-, line 144 */
+                break;
+            case 3:
+                slice_del(); /* delete, line 145 */
+                break;
+            case 4:
+                slice_del(); /* delete, line 146 */
+                break;
+            case 5:
+                slice_del(); /* delete, line 147 */
+                break;
+            case 6:
+                slice_del(); /* delete, line 148 */
+                break;
+            case 7:
+                slice_del(); /* delete, line 149 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_owned() {
+        int among_var;
+        ket = c; /* [, line 154 */
+        among_var = find_among_b(data::a_9); /* substring, line 154 */
+        if (!among_var) return false;
+        bra = c; /* ], line 154 */
+        if (!r_R1()) return false; /* call R1, line 154 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 155 */
+                break;
+            case 2:
+                slice_from(data::s_9); /* <-, line 156 */
+                break;
+            case 3:
+                slice_from(data::s_10); /* <-, line 157 */
+                break;
+            case 4:
+                slice_del(); /* delete, line 158 */
+                break;
+            case 5:
+                slice_from(data::s_11); /* <-, line 159 */
+                break;
+            case 6:
+                slice_from(data::s_12); /* <-, line 160 */
+                break;
+            case 7:
+                slice_del(); /* delete, line 161 */
+                break;
+            case 8:
+                slice_from(data::s_13); /* <-, line 162 */
+                break;
+            case 9:
+                slice_del(); /* delete, line 163 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_sing_owner() {
+        int among_var;
+        ket = c; /* [, line 168 */
+        among_var = find_among_b(data::a_10); /* substring, line 168 */
+        if (!among_var) return false;
+        bra = c; /* ], line 168 */
+        if (!r_R1()) return false; /* call R1, line 168 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 169 */
+                break;
+            case 2:
+                slice_from(data::s_14); /* <-, line 170 */
+                break;
+            case 3:
+                slice_from(data::s_15); /* <-, line 171 */
+                break;
+            case 4:
+                slice_del(); /* delete, line 172 */
+                break;
+            case 5:
+                slice_from(data::s_16); /* <-, line 173 */
+                break;
+            case 6:
+                slice_from(data::s_17); /* <-, line 174 */
+                break;
+            case 7:
+                slice_del(); /* delete, line 175 */
+                break;
+            case 8:
+                slice_del(); /* delete, line 176 */
+                break;
+            case 9:
+                slice_del(); /* delete, line 177 */
+                break;
+            case 10:
+                slice_from(data::s_18); /* <-, line 178 */
+                break;
+            case 11:
+                slice_from(data::s_19); /* <-, line 179 */
+                break;
+            case 12:
+                slice_del(); /* delete, line 180 */
+                break;
+            case 13:
+                slice_del(); /* delete, line 181 */
+                break;
+            case 14:
+                slice_from(data::s_20); /* <-, line 182 */
+                break;
+            case 15:
+                slice_from(data::s_21); /* <-, line 183 */
+                break;
+            case 16:
+                slice_del(); /* delete, line 184 */
+                break;
+            case 17:
+                slice_del(); /* delete, line 185 */
+                break;
+            case 18:
+                slice_del(); /* delete, line 186 */
+                break;
+            case 19:
+                slice_from(data::s_22); /* <-, line 187 */
+                break;
+            case 20:
+                slice_from(data::s_23); /* <-, line 188 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_plur_owner() {
+        int among_var;
+        ket = c; /* [, line 193 */
+        if (c <= lb || p[c - 1] >> 5 != 3 || !((10768 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 193 */
+        among_var = find_among_b(data::a_11); /* substring, line 193 */
+        if (!among_var) return false;
+        bra = c; /* ], line 193 */
+        if (!r_R1()) return false; /* call R1, line 193 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 194 */
+                break;
+            case 2:
+                slice_from(data::s_24); /* <-, line 195 */
+                break;
+            case 3:
+                slice_from(data::s_25); /* <-, line 196 */
+                break;
+            case 4:
+                slice_del(); /* delete, line 197 */
+                break;
+            case 5:
+                slice_del(); /* delete, line 198 */
+                break;
+            case 6:
+                slice_del(); /* delete, line 199 */
+                break;
+            case 7:
+                slice_from(data::s_26); /* <-, line 200 */
+                break;
+            case 8:
+                slice_from(data::s_27); /* <-, line 201 */
+                break;
+            case 9:
+                slice_del(); /* delete, line 202 */
+                break;
+            case 10:
+                slice_del(); /* delete, line 203 */
+                break;
+            case 11:
+                slice_del(); /* delete, line 204 */
+                break;
+            case 12:
+                slice_from(data::s_28); /* <-, line 205 */
+                break;
+            case 13:
+                slice_from(data::s_29); /* <-, line 206 */
+                break;
+            case 14:
+                slice_del(); /* delete, line 207 */
+                break;
+            case 15:
+                slice_del(); /* delete, line 208 */
+                break;
+            case 16:
+                slice_del(); /* delete, line 209 */
+                break;
+            case 17:
+                slice_del(); /* delete, line 210 */
+                break;
+            case 18:
+                slice_from(data::s_30); /* <-, line 211 */
+                break;
+            case 19:
+                slice_from(data::s_31); /* <-, line 212 */
+                break;
+            case 20:
+                slice_del(); /* delete, line 214 */
+                break;
+            case 21:
+                slice_del(); /* delete, line 215 */
+                break;
+            case 22:
+                slice_from(data::s_32); /* <-, line 216 */
+                break;
+            case 23:
+                slice_from(data::s_33); /* <-, line 217 */
+                break;
+            case 24:
+                slice_del(); /* delete, line 218 */
+                break;
+            case 25:
+                slice_del(); /* delete, line 219 */
+                break;
+            case 26:
+                slice_del(); /* delete, line 220 */
+                break;
+            case 27:
+                slice_from(data::s_34); /* <-, line 221 */
+                break;
+            case 28:
+                slice_from(data::s_35); /* <-, line 222 */
+                break;
+            case 29:
+                slice_del(); /* delete, line 223 */
+                break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 229 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 229 */
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 230 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 231 */
+            if (!r_instrum()) goto lab1; /* call instrum, line 231 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 232 */
+            if (!r_case()) goto lab2; /* call case, line 232 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 233 */
+            if (!r_case_special()) goto lab3; /* call case_special, line 233 */
+        lab3:
+            c = l - m4;
+        }
+        {   int m5 = l - c; (void)m5; /* do, line 234 */
+            if (!r_case_other()) goto lab4; /* call case_other, line 234 */
+        lab4:
+            c = l - m5;
+        }
+        {   int m6 = l - c; (void)m6; /* do, line 235 */
+            if (!r_factive()) goto lab5; /* call factive, line 235 */
+        lab5:
+            c = l - m6;
+        }
+        {   int m7 = l - c; (void)m7; /* do, line 236 */
+            if (!r_owned()) goto lab6; /* call owned, line 236 */
+        lab6:
+            c = l - m7;
+        }
+        {   int m8 = l - c; (void)m8; /* do, line 237 */
+            if (!r_sing_owner()) goto lab7; /* call sing_owner, line 237 */
+        lab7:
+            c = l - m8;
+        }
+        {   int m9 = l - c; (void)m9; /* do, line 238 */
+            if (!r_plur_owner()) goto lab8; /* call plur_owner, line 238 */
+        lab8:
+            c = l - m9;
+        }
+        {   int m10 = l - c; (void)m10; /* do, line 239 */
+            if (!r_plural()) goto lab9; /* call plural, line 239 */
+        lab9:
+            c = l - m10;
+        }
+        c = lb;
+        return true;
+    }
+
+  private:
+    int I_p1 = 0;
+};
+
+}
+
+#endif
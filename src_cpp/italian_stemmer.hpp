@@ -0,0 +1,1389 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_ITALIAN_STEMMER_HPP
+#define SNOWBALL_ITALIAN_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct italian_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 8, 2, 1 };
+    static constexpr unsigned char g_AEIO[] = { 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 8, 2 };
+    static constexpr unsigned char g_CG[] = { 17 };
+};
+
+template <bool utf8> struct italian_stemmer_data;
+
+template <>
+struct italian_stemmer_data<true> : italian_stemmer_groupings {
+    static constexpr unsigned char s_0_1[2] = { 'q', 'u' };
+    static constexpr unsigned char s_0_2[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_0_3[2] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_0_4[2] = { 0xC3, 0xAD };
+    static constexpr unsigned char s_0_5[2] = { 0xC3, 0xB3 };
+    static constexpr unsigned char s_0_6[2] = { 0xC3, 0xBA };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 7, 0 },
+    /*  1 */ { 2, s_0_1, 0, 6, 0 },
+    /*  2 */ { 2, s_0_2, 0, 1, 0 },
+    /*  3 */ { 2, s_0_3, 0, 2, 0 },
+    /*  4 */ { 2, s_0_4, 0, 3, 0 },
+    /*  5 */ { 2, s_0_5, 0, 4, 0 },
+    /*  6 */ { 2, s_0_6, 0, 5, 0 }
+    };
+
+    static constexpr unsigned char s_1_1[1] = { 'I' };
+    static constexpr unsigned char s_1_2[1] = { 'U' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_1_1, 0, 1, 0 },
+    /*  2 */ { 1, s_1_2, 0, 2, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'l', 'a' };
+    static constexpr unsigned char s_2_1[4] = { 'c', 'e', 'l', 'a' };
+    static constexpr unsigned char s_2_2[6] = { 'g', 'l', 'i', 'e', 'l', 'a' };
+    static constexpr unsigned char s_2_3[4] = { 'm', 'e', 'l', 'a' };
+    static constexpr unsigned char s_2_4[4] = { 't', 'e', 'l', 'a' };
+    static constexpr unsigned char s_2_5[4] = { 'v', 'e', 'l', 'a' };
+    static constexpr unsigned char s_2_6[2] = { 'l', 'e' };
+    static constexpr unsigned char s_2_7[4] = { 'c', 'e', 'l', 'e' };
+    static constexpr unsigned char s_2_8[6] = { 'g', 'l', 'i', 'e', 'l', 'e' };
+    static constexpr unsigned char s_2_9[4] = { 'm', 'e', 'l', 'e' };
+    static constexpr unsigned char s_2_10[4] = { 't', 'e', 'l', 'e' };
+    static constexpr unsigned char s_2_11[4] = { 'v', 'e', 'l', 'e' };
+    static constexpr unsigned char s_2_12[2] = { 'n', 'e' };
+    static constexpr unsigned char s_2_13[4] = { 'c', 'e', 'n', 'e' };
+    static constexpr unsigned char s_2_14[6] = { 'g', 'l', 'i', 'e', 'n', 'e' };
+    static constexpr unsigned char s_2_15[4] = { 'm', 'e', 'n', 'e' };
+    static constexpr unsigned char s_2_16[4] = { 's', 'e', 'n', 'e' };
+    static constexpr unsigned char s_2_17[4] = { 't', 'e', 'n', 'e' };
+    static constexpr unsigned char s_2_18[4] = { 'v', 'e', 'n', 'e' };
+    static constexpr unsigned char s_2_19[2] = { 'c', 'i' };
+    static constexpr unsigned char s_2_20[2] = { 'l', 'i' };
+    static constexpr unsigned char s_2_21[4] = { 'c', 'e', 'l', 'i' };
+    static constexpr unsigned char s_2_22[6] = { 'g', 'l', 'i', 'e', 'l', 'i' };
+    static constexpr unsigned char s_2_23[4] = { 'm', 'e', 'l', 'i' };
+    static constexpr unsigned char s_2_24[4] = { 't', 'e', 'l', 'i' };
+    static constexpr unsigned char s_2_25[4] = { 'v', 'e', 'l', 'i' };
+    static constexpr unsigned char s_2_26[3] = { 'g', 'l', 'i' };
+    static constexpr unsigned char s_2_27[2] = { 'm', 'i' };
+    static constexpr unsigned char s_2_28[2] = { 's', 'i' };
+    static constexpr unsigned char s_2_29[2] = { 't', 'i' };
+    static constexpr unsigned char s_2_30[2] = { 'v', 'i' };
+    static constexpr unsigned char s_2_31[2] = { 'l', 'o' };
+    static constexpr unsigned char s_2_32[4] = { 'c', 'e', 'l', 'o' };
+    static constexpr unsigned char s_2_33[6] = { 'g', 'l', 'i', 'e', 'l', 'o' };
+    static constexpr unsigned char s_2_34[4] = { 'm', 'e', 'l', 'o' };
+    static constexpr unsigned char s_2_35[4] = { 't', 'e', 'l', 'o' };
+    static constexpr unsigned char s_2_36[4] = { 'v', 'e', 'l', 'o' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 4, s_2_1, 0, -1, 0 },
+    /*  2 */ { 6, s_2_2, 0, -1, 0 },
+    /*  3 */ { 4, s_2_3, 0, -1, 0 },
+    /*  4 */ { 4, s_2_4, 0, -1, 0 },
+    /*  5 */ { 4, s_2_5, 0, -1, 0 },
+    /*  6 */ { 2, s_2_6, -1, -1, 0 },
+    /*  7 */ { 4, s_2_7, 6, -1, 0 },
+    /*  8 */ { 6, s_2_8, 6, -1, 0 },
+    /*  9 */ { 4, s_2_9, 6, -1, 0 },
+    /* 10 */ { 4, s_2_10, 6, -1, 0 },
+    /* 11 */ { 4, s_2_11, 6, -1, 0 },
+    /* 12 */ { 2, s_2_12, -1, -1, 0 },
+    /* 13 */ { 4, s_2_13, 12, -1, 0 },
+    /* 14 */ { 6, s_2_14, 12, -1, 0 },
+    /* 15 */ { 4, s_2_15, 12, -1, 0 },
+    /* 16 */ { 4, s_2_16, 12, -1, 0 },
+    /* 17 */ { 4, s_2_17, 12, -1, 0 },
+    /* 18 */ { 4, s_2_18, 12, -1, 0 },
+    /* 19 */ { 2, s_2_19, -1, -1, 0 },
+    /* 20 */ { 2, s_2_20, -1, -1, 0 },
+    /* 21 */ { 4, s_2_21, 20, -1, 0 },
+    /* 22 */ { 6, s_2_22, 20, -1, 0 },
+    /* 23 */ { 4, s_2_23, 20, -1, 0 },
+    /* 24 */ { 4, s_2_24, 20, -1, 0 },
+    /* 25 */ { 4, s_2_25, 20, -1, 0 },
+    /* 26 */ { 3, s_2_26, 20, -1, 0 },
+    /* 27 */ { 2, s_2_27, -1, -1, 0 },
+    /* 28 */ { 2, s_2_28, -1, -1, 0 },
+    /* 29 */ { 2, s_2_29, -1, -1, 0 },
+    /* 30 */ { 2, s_2_30, -1, -1, 0 },
+    /* 31 */ { 2, s_2_31, -1, -1, 0 },
+    /* 32 */ { 4, s_2_32, 31, -1, 0 },
+    /* 33 */ { 6, s_2_33, 31, -1, 0 },
+    /* 34 */ { 4, s_2_34, 31, -1, 0 },
+    /* 35 */ { 4, s_2_35, 31, -1, 0 },
+    /* 36 */ { 4, s_2_36, 31, -1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr unsigned char s_3_1[4] = { 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_3_2[2] = { 'a', 'r' };
+    static constexpr unsigned char s_3_3[2] = { 'e', 'r' };
+    static constexpr unsigned char s_3_4[2] = { 'i', 'r' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 },
+    /*  2 */ { 2, s_3_2, -1, 2, 0 },
+    /*  3 */ { 2, s_3_3, -1, 2, 0 },
+    /*  4 */ { 2, s_3_4, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_4_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_4_2[2] = { 'o', 's' };
+    static constexpr unsigned char s_4_3[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, -1, 0 },
+    /*  1 */ { 4, s_4_1, -1, -1, 0 },
+    /*  2 */ { 2, s_4_2, -1, -1, 0 },
+    /*  3 */ { 2, s_4_3, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_5_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_5_2[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[3] = { 'i', 'c', 'a' };
+    static constexpr unsigned char s_6_1[5] = { 'l', 'o', 'g', 'i', 'a' };
+    static constexpr unsigned char s_6_2[3] = { 'o', 's', 'a' };
+    static constexpr unsigned char s_6_3[4] = { 'i', 's', 't', 'a' };
+    static constexpr unsigned char s_6_4[3] = { 'i', 'v', 'a' };
+    static constexpr unsigned char s_6_5[4] = { 'a', 'n', 'z', 'a' };
+    static constexpr unsigned char s_6_6[4] = { 'e', 'n', 'z', 'a' };
+    static constexpr unsigned char s_6_7[3] = { 'i', 'c', 'e' };
+    static constexpr unsigned char s_6_8[6] = { 'a', 't', 'r', 'i', 'c', 'e' };
+    static constexpr unsigned char s_6_9[4] = { 'i', 'c', 'h', 'e' };
+    static constexpr unsigned char s_6_10[5] = { 'l', 'o', 'g', 'i', 'e' };
+    static constexpr unsigned char s_6_11[5] = { 'a', 'b', 'i', 'l', 'e' };
+    static constexpr unsigned char s_6_12[5] = { 'i', 'b', 'i', 'l', 'e' };
+    static constexpr unsigned char s_6_13[6] = { 'u', 's', 'i', 'o', 'n', 'e' };
+    static constexpr unsigned char s_6_14[6] = { 'a', 'z', 'i', 'o', 'n', 'e' };
+    static constexpr unsigned char s_6_15[6] = { 'u', 'z', 'i', 'o', 'n', 'e' };
+    static constexpr unsigned char s_6_16[5] = { 'a', 't', 'o', 'r', 'e' };
+    static constexpr unsigned char s_6_17[3] = { 'o', 's', 'e' };
+    static constexpr unsigned char s_6_18[4] = { 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_19[5] = { 'm', 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_20[6] = { 'a', 'm', 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_21[4] = { 'i', 's', 't', 'e' };
+    static constexpr unsigned char s_6_22[3] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_6_23[4] = { 'a', 'n', 'z', 'e' };
+    static constexpr unsigned char s_6_24[4] = { 'e', 'n', 'z', 'e' };
+    static constexpr unsigned char s_6_25[3] = { 'i', 'c', 'i' };
+    static constexpr unsigned char s_6_26[6] = { 'a', 't', 'r', 'i', 'c', 'i' };
+    static constexpr unsigned char s_6_27[4] = { 'i', 'c', 'h', 'i' };
+    static constexpr unsigned char s_6_28[5] = { 'a', 'b', 'i', 'l', 'i' };
+    static constexpr unsigned char s_6_29[5] = { 'i', 'b', 'i', 'l', 'i' };
+    static constexpr unsigned char s_6_30[4] = { 'i', 's', 'm', 'i' };
+    static constexpr unsigned char s_6_31[6] = { 'u', 's', 'i', 'o', 'n', 'i' };
+    static constexpr unsigned char s_6_32[6] = { 'a', 'z', 'i', 'o', 'n', 'i' };
+    static constexpr unsigned char s_6_33[6] = { 'u', 'z', 'i', 'o', 'n', 'i' };
+    static constexpr unsigned char s_6_34[5] = { 'a', 't', 'o', 'r', 'i' };
+    static constexpr unsigned char s_6_35[3] = { 'o', 's', 'i' };
+    static constexpr unsigned char s_6_36[4] = { 'a', 'n', 't', 'i' };
+    static constexpr unsigned char s_6_37[6] = { 'a', 'm', 'e', 'n', 't', 'i' };
+    static constexpr unsigned char s_6_38[6] = { 'i', 'm', 'e', 'n', 't', 'i' };
+    static constexpr unsigned char s_6_39[4] = { 'i', 's', 't', 'i' };
+    static constexpr unsigned char s_6_40[3] = { 'i', 'v', 'i' };
+    static constexpr unsigned char s_6_41[3] = { 'i', 'c', 'o' };
+    static constexpr unsigned char s_6_42[4] = { 'i', 's', 'm', 'o' };
+    static constexpr unsigned char s_6_43[3] = { 'o', 's', 'o' };
+    static constexpr unsigned char s_6_44[6] = { 'a', 'm', 'e', 'n', 't', 'o' };
+    static constexpr unsigned char s_6_45[6] = { 'i', 'm', 'e', 'n', 't', 'o' };
+    static constexpr unsigned char s_6_46[3] = { 'i', 'v', 'o' };
+    static constexpr unsigned char s_6_47[4] = { 'i', 't', 0xC3, 0xA0 };
+    static constexpr unsigned char s_6_48[5] = { 'i', 's', 't', 0xC3, 0xA0 };
+    static constexpr unsigned char s_6_49[5] = { 'i', 's', 't', 0xC3, 0xA8 };
+    static constexpr unsigned char s_6_50[5] = { 'i', 's', 't', 0xC3, 0xAC };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 5, s_6_1, -1, 3, 0 },
+    /*  2 */ { 3, s_6_2, -1, 1, 0 },
+    /*  3 */ { 4, s_6_3, -1, 1, 0 },
+    /*  4 */ { 3, s_6_4, -1, 9, 0 },
+    /*  5 */ { 4, s_6_5, -1, 1, 0 },
+    /*  6 */ { 4, s_6_6, -1, 5, 0 },
+    /*  7 */ { 3, s_6_7, -1, 1, 0 },
+    /*  8 */ { 6, s_6_8, 7, 1, 0 },
+    /*  9 */ { 4, s_6_9, -1, 1, 0 },
+    /* 10 */ { 5, s_6_10, -1, 3, 0 },
+    /* 11 */ { 5, s_6_11, -1, 1, 0 },
+    /* 12 */ { 5, s_6_12, -1, 1, 0 },
+    /* 13 */ { 6, s_6_13, -1, 4, 0 },
+    /* 14 */ { 6, s_6_14, -1, 2, 0 },
+    /* 15 */ { 6, s_6_15, -1, 4, 0 },
+    /* 16 */ { 5, s_6_16, -1, 2, 0 },
+    /* 17 */ { 3, s_6_17, -1, 1, 0 },
+    /* 18 */ { 4, s_6_18, -1, 1, 0 },
+    /* 19 */ { 5, s_6_19, -1, 1, 0 },
+    /* 20 */ { 6, s_6_20, 19, 7, 0 },
+    /* 21 */ { 4, s_6_21, -1, 1, 0 },
+    /* 22 */ { 3, s_6_22, -1, 9, 0 },
+    /* 23 */ { 4, s_6_23, -1, 1, 0 },
+    /* 24 */ { 4, s_6_24, -1, 5, 0 },
+    /* 25 */ { 3, s_6_25, -1, 1, 0 },
+    /* 26 */ { 6, s_6_26, 25, 1, 0 },
+    /* 27 */ { 4, s_6_27, -1, 1, 0 },
+    /* 28 */ { 5, s_6_28, -1, 1, 0 },
+    /* 29 */ { 5, s_6_29, -1, 1, 0 },
+    /* 30 */ { 4, s_6_30, -1, 1, 0 },
+    /* 31 */ { 6, s_6_31, -1, 4, 0 },
+    /* 32 */ { 6, s_6_32, -1, 2, 0 },
+    /* 33 */ { 6, s_6_33, -1, 4, 0 },
+    /* 34 */ { 5, s_6_34, -1, 2, 0 },
+    /* 35 */ { 3, s_6_35, -1, 1, 0 },
+    /* 36 */ { 4, s_6_36, -1, 1, 0 },
+    /* 37 */ { 6, s_6_37, -1, 6, 0 },
+    /* 38 */ { 6, s_6_38, -1, 6, 0 },
+    /* 39 */ { 4, s_6_39, -1, 1, 0 },
+    /* 40 */ { 3, s_6_40, -1, 9, 0 },
+    /* 41 */ { 3, s_6_41, -1, 1, 0 },
+    /* 42 */ { 4, s_6_42, -1, 1, 0 },
+    /* 43 */ { 3, s_6_43, -1, 1, 0 },
+    /* 44 */ { 6, s_6_44, -1, 6, 0 },
+    /* 45 */ { 6, s_6_45, -1, 6, 0 },
+    /* 46 */ { 3, s_6_46, -1, 9, 0 },
+    /* 47 */ { 4, s_6_47, -1, 8, 0 },
+    /* 48 */ { 5, s_6_48, -1, 1, 0 },
+    /* 49 */ { 5, s_6_49, -1, 1, 0 },
+    /* 50 */ { 5, s_6_50, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[4] = { 'i', 's', 'c', 'a' };
+    static constexpr unsigned char s_7_1[4] = { 'e', 'n', 'd', 'a' };
+    static constexpr unsigned char s_7_2[3] = { 'a', 't', 'a' };
+    static constexpr unsigned char s_7_3[3] = { 'i', 't', 'a' };
+    static constexpr unsigned char s_7_4[3] = { 'u', 't', 'a' };
+    static constexpr unsigned char s_7_5[3] = { 'a', 'v', 'a' };
+    static constexpr unsigned char s_7_6[3] = { 'e', 'v', 'a' };
+    static constexpr unsigned char s_7_7[3] = { 'i', 'v', 'a' };
+    static constexpr unsigned char s_7_8[6] = { 'e', 'r', 'e', 'b', 'b', 'e' };
+    static constexpr unsigned char s_7_9[6] = { 'i', 'r', 'e', 'b', 'b', 'e' };
+    static constexpr unsigned char s_7_10[4] = { 'i', 's', 'c', 'e' };
+    static constexpr unsigned char s_7_11[4] = { 'e', 'n', 'd', 'e' };
+    static constexpr unsigned char s_7_12[3] = { 'a', 'r', 'e' };
+    static constexpr unsigned char s_7_13[3] = { 'e', 'r', 'e' };
+    static constexpr unsigned char s_7_14[3] = { 'i', 'r', 'e' };
+    static constexpr unsigned char s_7_15[4] = { 'a', 's', 's', 'e' };
+    static constexpr unsigned char s_7_16[3] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_7_17[5] = { 'a', 'v', 'a', 't', 'e' };
+    static constexpr unsigned char s_7_18[5] = { 'e', 'v', 'a', 't', 'e' };
+    static constexpr unsigned char s_7_19[5] = { 'i', 'v', 'a', 't', 'e' };
+    static constexpr unsigned char s_7_20[3] = { 'e', 't', 'e' };
+    static constexpr unsigned char s_7_21[5] = { 'e', 'r', 'e', 't', 'e' };
+    static constexpr unsigned char s_7_22[5] = { 'i', 'r', 'e', 't', 'e' };
+    static constexpr unsigned char s_7_23[3] = { 'i', 't', 'e' };
+    static constexpr unsigned char s_7_24[6] = { 'e', 'r', 'e', 's', 't', 'e' };
+    static constexpr unsigned char s_7_25[6] = { 'i', 'r', 'e', 's', 't', 'e' };
+    static constexpr unsigned char s_7_26[3] = { 'u', 't', 'e' };
+    static constexpr unsigned char s_7_27[4] = { 'e', 'r', 'a', 'i' };
+    static constexpr unsigned char s_7_28[4] = { 'i', 'r', 'a', 'i' };
+    static constexpr unsigned char s_7_29[4] = { 'i', 's', 'c', 'i' };
+    static constexpr unsigned char s_7_30[4] = { 'e', 'n', 'd', 'i' };
+    static constexpr unsigned char s_7_31[4] = { 'e', 'r', 'e', 'i' };
+    static constexpr unsigned char s_7_32[4] = { 'i', 'r', 'e', 'i' };
+    static constexpr unsigned char s_7_33[4] = { 'a', 's', 's', 'i' };
+    static constexpr unsigned char s_7_34[3] = { 'a', 't', 'i' };
+    static constexpr unsigned char s_7_35[3] = { 'i', 't', 'i' };
+    static constexpr unsigned char s_7_36[6] = { 'e', 'r', 'e', 's', 't', 'i' };
+    static constexpr unsigned char s_7_37[6] = { 'i', 'r', 'e', 's', 't', 'i' };
+    static constexpr unsigned char s_7_38[3] = { 'u', 't', 'i' };
+    static constexpr unsigned char s_7_39[3] = { 'a', 'v', 'i' };
+    static constexpr unsigned char s_7_40[3] = { 'e', 'v', 'i' };
+    static constexpr unsigned char s_7_41[3] = { 'i', 'v', 'i' };
+    static constexpr unsigned char s_7_42[4] = { 'i', 's', 'c', 'o' };
+    static constexpr unsigned char s_7_43[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr unsigned char s_7_44[4] = { 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_7_45[4] = { 'Y', 'a', 'm', 'o' };
+    static constexpr unsigned char s_7_46[4] = { 'i', 'a', 'm', 'o' };
+    static constexpr unsigned char s_7_47[5] = { 'a', 'v', 'a', 'm', 'o' };
+    static constexpr unsigned char s_7_48[5] = { 'e', 'v', 'a', 'm', 'o' };
+    static constexpr unsigned char s_7_49[5] = { 'i', 'v', 'a', 'm', 'o' };
+    static constexpr unsigned char s_7_50[5] = { 'e', 'r', 'e', 'm', 'o' };
+    static constexpr unsigned char s_7_51[5] = { 'i', 'r', 'e', 'm', 'o' };
+    static constexpr unsigned char s_7_52[6] = { 'a', 's', 's', 'i', 'm', 'o' };
+    static constexpr unsigned char s_7_53[4] = { 'a', 'm', 'm', 'o' };
+    static constexpr unsigned char s_7_54[4] = { 'e', 'm', 'm', 'o' };
+    static constexpr unsigned char s_7_55[6] = { 'e', 'r', 'e', 'm', 'm', 'o' };
+    static constexpr unsigned char s_7_56[6] = { 'i', 'r', 'e', 'm', 'm', 'o' };
+    static constexpr unsigned char s_7_57[4] = { 'i', 'm', 'm', 'o' };
+    static constexpr unsigned char s_7_58[3] = { 'a', 'n', 'o' };
+    static constexpr unsigned char s_7_59[6] = { 'i', 's', 'c', 'a', 'n', 'o' };
+    static constexpr unsigned char s_7_60[5] = { 'a', 'v', 'a', 'n', 'o' };
+    static constexpr unsigned char s_7_61[5] = { 'e', 'v', 'a', 'n', 'o' };
+    static constexpr unsigned char s_7_62[5] = { 'i', 'v', 'a', 'n', 'o' };
+    static constexpr unsigned char s_7_63[6] = { 'e', 'r', 'a', 'n', 'n', 'o' };
+    static constexpr unsigned char s_7_64[6] = { 'i', 'r', 'a', 'n', 'n', 'o' };
+    static constexpr unsigned char s_7_65[3] = { 'o', 'n', 'o' };
+    static constexpr unsigned char s_7_66[6] = { 'i', 's', 'c', 'o', 'n', 'o' };
+    static constexpr unsigned char s_7_67[5] = { 'a', 'r', 'o', 'n', 'o' };
+    static constexpr unsigned char s_7_68[5] = { 'e', 'r', 'o', 'n', 'o' };
+    static constexpr unsigned char s_7_69[5] = { 'i', 'r', 'o', 'n', 'o' };
+    static constexpr unsigned char s_7_70[8] = { 'e', 'r', 'e', 'b', 'b', 'e', 'r', 'o' };
+    static constexpr unsigned char s_7_71[8] = { 'i', 'r', 'e', 'b', 'b', 'e', 'r', 'o' };
+    static constexpr unsigned char s_7_72[6] = { 'a', 's', 's', 'e', 'r', 'o' };
+    static constexpr unsigned char s_7_73[6] = { 'e', 's', 's', 'e', 'r', 'o' };
+    static constexpr unsigned char s_7_74[6] = { 'i', 's', 's', 'e', 'r', 'o' };
+    static constexpr unsigned char s_7_75[3] = { 'a', 't', 'o' };
+    static constexpr unsigned char s_7_76[3] = { 'i', 't', 'o' };
+    static constexpr unsigned char s_7_77[3] = { 'u', 't', 'o' };
+    static constexpr unsigned char s_7_78[3] = { 'a', 'v', 'o' };
+    static constexpr unsigned char s_7_79[3] = { 'e', 'v', 'o' };
+    static constexpr unsigned char s_7_80[3] = { 'i', 'v', 'o' };
+    static constexpr unsigned char s_7_81[2] = { 'a', 'r' };
+    static constexpr unsigned char s_7_82[2] = { 'i', 'r' };
+    static constexpr unsigned char s_7_83[4] = { 'e', 'r', 0xC3, 0xA0 };
+    static constexpr unsigned char s_7_84[4] = { 'i', 'r', 0xC3, 0xA0 };
+    static constexpr unsigned char s_7_85[4] = { 'e', 'r', 0xC3, 0xB2 };
+    static constexpr unsigned char s_7_86[4] = { 'i', 'r', 0xC3, 0xB2 };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 4, s_7_0, -1, 1, 0 },
+    /*  1 */ { 4, s_7_1, -1, 1, 0 },
+    /*  2 */ { 3, s_7_2, -1, 1, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 3, s_7_4, -1, 1, 0 },
+    /*  5 */ { 3, s_7_5, -1, 1, 0 },
+    /*  6 */ { 3, s_7_6, -1, 1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 6, s_7_8, -1, 1, 0 },
+    /*  9 */ { 6, s_7_9, -1, 1, 0 },
+    /* 10 */ { 4, s_7_10, -1, 1, 0 },
+    /* 11 */ { 4, s_7_11, -1, 1, 0 },
+    /* 12 */ { 3, s_7_12, -1, 1, 0 },
+    /* 13 */ { 3, s_7_13, -1, 1, 0 },
+    /* 14 */ { 3, s_7_14, -1, 1, 0 },
+    /* 15 */ { 4, s_7_15, -1, 1, 0 },
+    /* 16 */ { 3, s_7_16, -1, 1, 0 },
+    /* 17 */ { 5, s_7_17, 16, 1, 0 },
+    /* 18 */ { 5, s_7_18, 16, 1, 0 },
+    /* 19 */ { 5, s_7_19, 16, 1, 0 },
+    /* 20 */ { 3, s_7_20, -1, 1, 0 },
+    /* 21 */ { 5, s_7_21, 20, 1, 0 },
+    /* 22 */ { 5, s_7_22, 20, 1, 0 },
+    /* 23 */ { 3, s_7_23, -1, 1, 0 },
+    /* 24 */ { 6, s_7_24, -1, 1, 0 },
+    /* 25 */ { 6, s_7_25, -1, 1, 0 },
+    /* 26 */ { 3, s_7_26, -1, 1, 0 },
+    /* 27 */ { 4, s_7_27, -1, 1, 0 },
+    /* 28 */ { 4, s_7_28, -1, 1, 0 },
+    /* 29 */ { 4, s_7_29, -1, 1, 0 },
+    /* 30 */ { 4, s_7_30, -1, 1, 0 },
+    /* 31 */ { 4, s_7_31, -1, 1, 0 },
+    /* 32 */ { 4, s_7_32, -1, 1, 0 },
+    /* 33 */ { 4, s_7_33, -1, 1, 0 },
+    /* 34 */ { 3, s_7_34, -1, 1, 0 },
+    /* 35 */ { 3, s_7_35, -1, 1, 0 },
+    /* 36 */ { 6, s_7_36, -1, 1, 0 },
+    /* 37 */ { 6, s_7_37, -1, 1, 0 },
+    /* 38 */ { 3, s_7_38, -1, 1, 0 },
+    /* 39 */ { 3, s_7_39, -1, 1, 0 },
+    /* 40 */ { 3, s_7_40, -1, 1, 0 },
+    /* 41 */ { 3, s_7_41, -1, 1, 0 },
+    /* 42 */ { 4, s_7_42, -1, 1, 0 },
+    /* 43 */ { 4, s_7_43, -1, 1, 0 },
+    /* 44 */ { 4, s_7_44, -1, 1, 0 },
+    /* 45 */ { 4, s_7_45, -1, 1, 0 },
+    /* 46 */ { 4, s_7_46, -1, 1, 0 },
+    /* 47 */ { 5, s_7_47, -1, 1, 0 },
+    /* 48 */ { 5, s_7_48, -1, 1, 0 },
+    /* 49 */ { 5, s_7_49, -1, 1, 0 },
+    /* 50 */ { 5, s_7_50, -1, 1, 0 },
+    /* 51 */ { 5, s_7_51, -1, 1, 0 },
+    /* 52 */ { 6, s_7_52, -1, 1, 0 },
+    /* 53 */ { 4, s_7_53, -1, 1, 0 },
+    /* 54 */ { 4, s_7_54, -1, 1, 0 },
+    /* 55 */ { 6, s_7_55, 54, 1, 0 },
+    /* 56 */ { 6, s_7_56, 54, 1, 0 },
+    /* 57 */ { 4, s_7_57, -1, 1, 0 },
+    /* 58 */ { 3, s_7_58, -1, 1, 0 },
+    /* 59 */ { 6, s_7_59, 58, 1, 0 },
+    /* 60 */ { 5, s_7_60, 58, 1, 0 },
+    /* 61 */ { 5, s_7_61, 58, 1, 0 },
+    /* 62 */ { 5, s_7_62, 58, 1, 0 },
+    /* 63 */ { 6, s_7_63, -1, 1, 0 },
+    /* 64 */ { 6, s_7_64, -1, 1, 0 },
+    /* 65 */ { 3, s_7_65, -1, 1, 0 },
+    /* 66 */ { 6, s_7_66, 65, 1, 0 },
+    /* 67 */ { 5, s_7_67, 65, 1, 0 },
+    /* 68 */ { 5, s_7_68, 65, 1, 0 },
+    /* 69 */ { 5, s_7_69, 65, 1, 0 },
+    /* 70 */ { 8, s_7_70, -1, 1, 0 },
+    /* 71 */ { 8, s_7_71, -1, 1, 0 },
+    /* 72 */ { 6, s_7_72, -1, 1, 0 },
+    /* 73 */ { 6, s_7_73, -1, 1, 0 },
+    /* 74 */ { 6, s_7_74, -1, 1, 0 },
+    /* 75 */ { 3, s_7_75, -1, 1, 0 },
+    /* 76 */ { 3, s_7_76, -1, 1, 0 },
+    /* 77 */ { 3, s_7_77, -1, 1, 0 },
+    /* 78 */ { 3, s_7_78, -1, 1, 0 },
+    /* 79 */ { 3, s_7_79, -1, 1, 0 },
+    /* 80 */ { 3, s_7_80, -1, 1, 0 },
+    /* 81 */ { 2, s_7_81, -1, 1, 0 },
+    /* 82 */ { 2, s_7_82, -1, 1, 0 },
+    /* 83 */ { 4, s_7_83, -1, 1, 0 },
+    /* 84 */ { 4, s_7_84, -1, 1, 0 },
+    /* 85 */ { 4, s_7_85, -1, 1, 0 },
+    /* 86 */ { 4, s_7_86, -1, 1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 0xC3, 0xA0 };
+    static constexpr unsigned char s_1[] = { 0xC3, 0xA8 };
+    static constexpr unsigned char s_2[] = { 0xC3, 0xAC };
+    static constexpr unsigned char s_3[] = { 0xC3, 0xB2 };
+    static constexpr unsigned char s_4[] = { 0xC3, 0xB9 };
+    static constexpr unsigned char s_5[] = { 'q', 'U' };
+    static constexpr unsigned char s_6[] = { 'u' };
+    static constexpr unsigned char s_7[] = { 'U' };
+    static constexpr unsigned char s_8[] = { 'i' };
+    static constexpr unsigned char s_9[] = { 'I' };
+    static constexpr unsigned char s_10[] = { 'i' };
+    static constexpr unsigned char s_11[] = { 'u' };
+    static constexpr unsigned char s_12[] = { 'e' };
+    static constexpr unsigned char s_13[] = { 'i', 'c' };
+    static constexpr unsigned char s_14[] = { 'l', 'o', 'g' };
+    static constexpr unsigned char s_15[] = { 'u' };
+    static constexpr unsigned char s_16[] = { 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_17[] = { 'a', 't' };
+    static constexpr unsigned char s_18[] = { 'a', 't' };
+    static constexpr unsigned char s_19[] = { 'i', 'c' };
+    static constexpr unsigned char s_20[] = { 'i' };
+    static constexpr unsigned char s_21[] = { 'h' };
+};
+
+template <>
+struct italian_stemmer_data<false> : italian_stemmer_groupings {
+    static constexpr char32_t s_0_1[2] = { 'q', 'u' };
+    static constexpr char32_t s_0_2[1] = { 0xE1 };
+    static constexpr char32_t s_0_3[1] = { 0xE9 };
+    static constexpr char32_t s_0_4[1] = { 0xED };
+    static constexpr char32_t s_0_5[1] = { 0xF3 };
+    static constexpr char32_t s_0_6[1] = { 0xFA };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 7, 0 },
+    /*  1 */ { 2, s_0_1, 0, 6, 0 },
+    /*  2 */ { 1, s_0_2, 0, 1, 0 },
+    /*  3 */ { 1, s_0_3, 0, 2, 0 },
+    /*  4 */ { 1, s_0_4, 0, 3, 0 },
+    /*  5 */ { 1, s_0_5, 0, 4, 0 },
+    /*  6 */ { 1, s_0_6, 0, 5, 0 }
+    };
+
+    static constexpr char32_t s_1_1[1] = { 'I' };
+    static constexpr char32_t s_1_2[1] = { 'U' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_1_1, 0, 1, 0 },
+    /*  2 */ { 1, s_1_2, 0, 2, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'l', 'a' };
+    static constexpr char32_t s_2_1[4] = { 'c', 'e', 'l', 'a' };
+    static constexpr char32_t s_2_2[6] = { 'g', 'l', 'i', 'e', 'l', 'a' };
+    static constexpr char32_t s_2_3[4] = { 'm', 'e', 'l', 'a' };
+    static constexpr char32_t s_2_4[4] = { 't', 'e', 'l', 'a' };
+    static constexpr char32_t s_2_5[4] = { 'v', 'e', 'l', 'a' };
+    static constexpr char32_t s_2_6[2] = { 'l', 'e' };
+    static constexpr char32_t s_2_7[4] = { 'c', 'e', 'l', 'e' };
+    static constexpr char32_t s_2_8[6] = { 'g', 'l', 'i', 'e', 'l', 'e' };
+    static constexpr char32_t s_2_9[4] = { 'm', 'e', 'l', 'e' };
+    static constexpr char32_t s_2_10[4] = { 't', 'e', 'l', 'e' };
+    static constexpr char32_t s_2_11[4] = { 'v', 'e', 'l', 'e' };
+    static constexpr char32_t s_2_12[2] = { 'n', 'e' };
+    static constexpr char32_t s_2_13[4] = { 'c', 'e', 'n', 'e' };
+    static constexpr char32_t s_2_14[6] = { 'g', 'l', 'i', 'e', 'n', 'e' };
+    static constexpr char32_t s_2_15[4] = { 'm', 'e', 'n', 'e' };
+    static constexpr char32_t s_2_16[4] = { 's', 'e', 'n', 'e' };
+    static constexpr char32_t s_2_17[4] = { 't', 'e', 'n', 'e' };
+    static constexpr char32_t s_2_18[4] = { 'v', 'e', 'n', 'e' };
+    static constexpr char32_t s_2_19[2] = { 'c', 'i' };
+    static constexpr char32_t s_2_20[2] = { 'l', 'i' };
+    static constexpr char32_t s_2_21[4] = { 'c', 'e', 'l', 'i' };
+    static constexpr char32_t s_2_22[6] = { 'g', 'l', 'i', 'e', 'l', 'i' };
+    static constexpr char32_t s_2_23[4] = { 'm', 'e', 'l', 'i' };
+    static constexpr char32_t s_2_24[4] = { 't', 'e', 'l', 'i' };
+    static constexpr char32_t s_2_25[4] = { 'v', 'e', 'l', 'i' };
+    static constexpr char32_t s_2_26[3] = { 'g', 'l', 'i' };
+    static constexpr char32_t s_2_27[2] = { 'm', 'i' };
+    static constexpr char32_t s_2_28[2] = { 's', 'i' };
+    static constexpr char32_t s_2_29[2] = { 't', 'i' };
+    static constexpr char32_t s_2_30[2] = { 'v', 'i' };
+    static constexpr char32_t s_2_31[2] = { 'l', 'o' };
+    static constexpr char32_t s_2_32[4] = { 'c', 'e', 'l', 'o' };
+    static constexpr char32_t s_2_33[6] = { 'g', 'l', 'i', 'e', 'l', 'o' };
+    static constexpr char32_t s_2_34[4] = { 'm', 'e', 'l', 'o' };
+    static constexpr char32_t s_2_35[4] = { 't', 'e', 'l', 'o' };
+    static constexpr char32_t s_2_36[4] = { 'v', 'e', 'l', 'o' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 4, s_2_1, 0, -1, 0 },
+    /*  2 */ { 6, s_2_2, 0, -1, 0 },
+    /*  3 */ { 4, s_2_3, 0, -1, 0 },
+    /*  4 */ { 4, s_2_4, 0, -1, 0 },
+    /*  5 */ { 4, s_2_5, 0, -1, 0 },
+    /*  6 */ { 2, s_2_6, -1, -1, 0 },
+    /*  7 */ { 4, s_2_7, 6, -1, 0 },
+    /*  8 */ { 6, s_2_8, 6, -1, 0 },
+    /*  9 */ { 4, s_2_9, 6, -1, 0 },
+    /* 10 */ { 4, s_2_10, 6, -1, 0 },
+    /* 11 */ { 4, s_2_11, 6, -1, 0 },
+    /* 12 */ { 2, s_2_12, -1, -1, 0 },
+    /* 13 */ { 4, s_2_13, 12, -1, 0 },
+    /* 14 */ { 6, s_2_14, 12, -1, 0 },
+    /* 15 */ { 4, s_2_15, 12, -1, 0 },
+    /* 16 */ { 4, s_2_16, 12, -1, 0 },
+    /* 17 */ { 4, s_2_17, 12, -1, 0 },
+    /* 18 */ { 4, s_2_18, 12, -1, 0 },
+    /* 19 */ { 2, s_2_19, -1, -1, 0 },
+    /* 20 */ { 2, s_2_20, -1, -1, 0 },
+    /* 21 */ { 4, s_2_21, 20, -1, 0 },
+    /* 22 */ { 6, s_2_22, 20, -1, 0 },
+    /* 23 */ { 4, s_2_23, 20, -1, 0 },
+    /* 24 */ { 4, s_2_24, 20, -1, 0 },
+    /* 25 */ { 4, s_2_25, 20, -1, 0 },
+    /* 26 */ { 3, s_2_26, 20, -1, 0 },
+    /* 27 */ { 2, s_2_27, -1, -1, 0 },
+    /* 28 */ { 2, s_2_28, -1, -1, 0 },
+    /* 29 */ { 2, s_2_29, -1, -1, 0 },
+    /* 30 */ { 2, s_2_30, -1, -1, 0 },
+    /* 31 */ { 2, s_2_31, -1, -1, 0 },
+    /* 32 */ { 4, s_2_32, 31, -1, 0 },
+    /* 33 */ { 6, s_2_33, 31, -1, 0 },
+    /* 34 */ { 4, s_2_34, 31, -1, 0 },
+    /* 35 */ { 4, s_2_35, 31, -1, 0 },
+    /* 36 */ { 4, s_2_36, 31, -1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr char32_t s_3_1[4] = { 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_3_2[2] = { 'a', 'r' };
+    static constexpr char32_t s_3_3[2] = { 'e', 'r' };
+    static constexpr char32_t s_3_4[2] = { 'i', 'r' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 },
+    /*  2 */ { 2, s_3_2, -1, 2, 0 },
+    /*  3 */ { 2, s_3_3, -1, 2, 0 },
+    /*  4 */ { 2, s_3_4, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_4_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_4_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_4_2[2] = { 'o', 's' };
+    static constexpr char32_t s_4_3[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, -1, 0 },
+    /*  1 */ { 4, s_4_1, -1, -1, 0 },
+    /*  2 */ { 2, s_4_2, -1, -1, 0 },
+    /*  3 */ { 2, s_4_3, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_5_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_5_2[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_6_0[3] = { 'i', 'c', 'a' };
+    static constexpr char32_t s_6_1[5] = { 'l', 'o', 'g', 'i', 'a' };
+    static constexpr char32_t s_6_2[3] = { 'o', 's', 'a' };
+    static constexpr char32_t s_6_3[4] = { 'i', 's', 't', 'a' };
+    static constexpr char32_t s_6_4[3] = { 'i', 'v', 'a' };
+    static constexpr char32_t s_6_5[4] = { 'a', 'n', 'z', 'a' };
+    static constexpr char32_t s_6_6[4] = { 'e', 'n', 'z', 'a' };
+    static constexpr char32_t s_6_7[3] = { 'i', 'c', 'e' };
+    static constexpr char32_t s_6_8[6] = { 'a', 't', 'r', 'i', 'c', 'e' };
+    static constexpr char32_t s_6_9[4] = { 'i', 'c', 'h', 'e' };
+    static constexpr char32_t s_6_10[5] = { 'l', 'o', 'g', 'i', 'e' };
+    static constexpr char32_t s_6_11[5] = { 'a', 'b', 'i', 'l', 'e' };
+    static constexpr char32_t s_6_12[5] = { 'i', 'b', 'i', 'l', 'e' };
+    static constexpr char32_t s_6_13[6] = { 'u', 's', 'i', 'o', 'n', 'e' };
+    static constexpr char32_t s_6_14[6] = { 'a', 'z', 'i', 'o', 'n', 'e' };
+    static constexpr char32_t s_6_15[6] = { 'u', 'z', 'i', 'o', 'n', 'e' };
+    static constexpr char32_t s_6_16[5] = { 'a', 't', 'o', 'r', 'e' };
+    static constexpr char32_t s_6_17[3] = { 'o', 's', 'e' };
+    static constexpr char32_t s_6_18[4] = { 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_6_19[5] = { 'm', 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_6_20[6] = { 'a', 'm', 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_6_21[4] = { 'i', 's', 't', 'e' };
+    static constexpr char32_t s_6_22[3] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_6_23[4] = { 'a', 'n', 'z', 'e' };
+    static constexpr char32_t s_6_24[4] = { 'e', 'n', 'z', 'e' };
+    static constexpr char32_t s_6_25[3] = { 'i', 'c', 'i' };
+    static constexpr char32_t s_6_26[6] = { 'a', 't', 'r', 'i', 'c', 'i' };
+    static constexpr char32_t s_6_27[4] = { 'i', 'c', 'h', 'i' };
+    static constexpr char32_t s_6_28[5] = { 'a', 'b', 'i', 'l', 'i' };
+    static constexpr char32_t s_6_29[5] = { 'i', 'b', 'i', 'l', 'i' };
+    static constexpr char32_t s_6_30[4] = { 'i', 's', 'm', 'i' };
+    static constexpr char32_t s_6_31[6] = { 'u', 's', 'i', 'o', 'n', 'i' };
+    static constexpr char32_t s_6_32[6] = { 'a', 'z', 'i', 'o', 'n', 'i' };
+    static constexpr char32_t s_6_33[6] = { 'u', 'z', 'i', 'o', 'n', 'i' };
+    static constexpr char32_t s_6_34[5] = { 'a', 't', 'o', 'r', 'i' };
+    static constexpr char32_t s_6_35[3] = { 'o', 's', 'i' };
+    static constexpr char32_t s_6_36[4] = { 'a', 'n', 't', 'i' };
+    static constexpr char32_t s_6_37[6] = { 'a', 'm', 'e', 'n', 't', 'i' };
+    static constexpr char32_t s_6_38[6] = { 'i', 'm', 'e', 'n', 't', 'i' };
+    static constexpr char32_t s_6_39[4] = { 'i', 's', 't', 'i' };
+    static constexpr char32_t s_6_40[3] = { 'i', 'v', 'i' };
+    static constexpr char32_t s_6_41[3] = { 'i', 'c', 'o' };
+    static constexpr char32_t s_6_42[4] = { 'i', 's', 'm', 'o' };
+    static constexpr char32_t s_6_43[3] = { 'o', 's', 'o' };
+    static constexpr char32_t s_6_44[6] = { 'a', 'm', 'e', 'n', 't', 'o' };
+    static constexpr char32_t s_6_45[6] = { 'i', 'm', 'e', 'n', 't', 'o' };
+    static constexpr char32_t s_6_46[3] = { 'i', 'v', 'o' };
+    static constexpr char32_t s_6_47[3] = { 'i', 't', 0xE0 };
+    static constexpr char32_t s_6_48[4] = { 'i', 's', 't', 0xE0 };
+    static constexpr char32_t s_6_49[4] = { 'i', 's', 't', 0xE8 };
+    static constexpr char32_t s_6_50[4] = { 'i', 's', 't', 0xEC };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 5, s_6_1, -1, 3, 0 },
+    /*  2 */ { 3, s_6_2, -1, 1, 0 },
+    /*  3 */ { 4, s_6_3, -1, 1, 0 },
+    /*  4 */ { 3, s_6_4, -1, 9, 0 },
+    /*  5 */ { 4, s_6_5, -1, 1, 0 },
+    /*  6 */ { 4, s_6_6, -1, 5, 0 },
+    /*  7 */ { 3, s_6_7, -1, 1, 0 },
+    /*  8 */ { 6, s_6_8, 7, 1, 0 },
+    /*  9 */ { 4, s_6_9, -1, 1, 0 },
+    /* 10 */ { 5, s_6_10, -1, 3, 0 },
+    /* 11 */ { 5, s_6_11, -1, 1, 0 },
+    /* 12 */ { 5, s_6_12, -1, 1, 0 },
+    /* 13 */ { 6, s_6_13, -1, 4, 0 },
+    /* 14 */ { 6, s_6_14, -1, 2, 0 },
+    /* 15 */ { 6, s_6_15, -1, 4, 0 },
+    /* 16 */ { 5, s_6_16, -1, 2, 0 },
+    /* 17 */ { 3, s_6_17, -1, 1, 0 },
+    /* 18 */ { 4, s_6_18, -1, 1, 0 },
+    /* 19 */ { 5, s_6_19, -1, 1, 0 },
+    /* 20 */ { 6, s_6_20, 19, 7, 0 },
+    /* 21 */ { 4, s_6_21, -1, 1, 0 },
+    /* 22 */ { 3, s_6_22, -1, 9, 0 },
+    /* 23 */ { 4, s_6_23, -1, 1, 0 },
+    /* 24 */ { 4, s_6_24, -1, 5, 0 },
+    /* 25 */ { 3, s_6_25, -1, 1, 0 },
+    /* 26 */ { 6, s_6_26, 25, 1, 0 },
+    /* 27 */ { 4, s_6_27, -1, 1, 0 },
+    /* 28 */ { 5, s_6_28, -1, 1, 0 },
+    /* 29 */ { 5, s_6_29, -1, 1, 0 },
+    /* 30 */ { 4, s_6_30, -1, 1, 0 },
+    /* 31 */ { 6, s_6_31, -1, 4, 0 },
+    /* 32 */ { 6, s_6_32, -1, 2, 0 },
+    /* 33 */ { 6, s_6_33, -1, 4, 0 },
+    /* 34 */ { 5, s_6_34, -1, 2, 0 },
+    /* 35 */ { 3, s_6_35, -1, 1, 0 },
+    /* 36 */ { 4, s_6_36, -1, 1, 0 },
+    /* 37 */ { 6, s_6_37, -1, 6, 0 },
+    /* 38 */ { 6, s_6_38, -1, 6, 0 },
+    /* 39 */ { 4, s_6_39, -1, 1, 0 },
+    /* 40 */ { 3, s_6_40, -1, 9, 0 },
+    /* 41 */ { 3, s_6_41, -1, 1, 0 },
+    /* 42 */ { 4, s_6_42, -1, 1, 0 },
+    /* 43 */ { 3, s_6_43, -1, 1, 0 },
+    /* 44 */ { 6, s_6_44, -1, 6, 0 },
+    /* 45 */ { 6, s_6_45, -1, 6, 0 },
+    /* 46 */ { 3, s_6_46, -1, 9, 0 },
+    /* 47 */ { 3, s_6_47, -1, 8, 0 },
+    /* 48 */ { 4, s_6_48, -1, 1, 0 },
+    /* 49 */ { 4, s_6_49, -1, 1, 0 },
+    /* 50 */ { 4, s_6_50, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_7_0[4] = { 'i', 's', 'c', 'a' };
+    static constexpr char32_t s_7_1[4] = { 'e', 'n', 'd', 'a' };
+    static constexpr char32_t s_7_2[3] = { 'a', 't', 'a' };
+    static constexpr char32_t s_7_3[3] = { 'i', 't', 'a' };
+    static constexpr char32_t s_7_4[3] = { 'u', 't', 'a' };
+    static constexpr char32_t s_7_5[3] = { 'a', 'v', 'a' };
+    static constexpr char32_t s_7_6[3] = { 'e', 'v', 'a' };
+    static constexpr char32_t s_7_7[3] = { 'i', 'v', 'a' };
+    static constexpr char32_t s_7_8[6] = { 'e', 'r', 'e', 'b', 'b', 'e' };
+    static constexpr char32_t s_7_9[6] = { 'i', 'r', 'e', 'b', 'b', 'e' };
+    static constexpr char32_t s_7_10[4] = { 'i', 's', 'c', 'e' };
+    static constexpr char32_t s_7_11[4] = { 'e', 'n', 'd', 'e' };
+    static constexpr char32_t s_7_12[3] = { 'a', 'r', 'e' };
+    static constexpr char32_t s_7_13[3] = { 'e', 'r', 'e' };
+    static constexpr char32_t s_7_14[3] = { 'i', 'r', 'e' };
+    static constexpr char32_t s_7_15[4] = { 'a', 's', 's', 'e' };
+    static constexpr char32_t s_7_16[3] = { 'a', 't', 'e' };
+    static constexpr char32_t s_7_17[5] = { 'a', 'v', 'a', 't', 'e' };
+    static constexpr char32_t s_7_18[5] = { 'e', 'v', 'a', 't', 'e' };
+    static constexpr char32_t s_7_19[5] = { 'i', 'v', 'a', 't', 'e' };
+    static constexpr char32_t s_7_20[3] = { 'e', 't', 'e' };
+    static constexpr char32_t s_7_21[5] = { 'e', 'r', 'e', 't', 'e' };
+    static constexpr char32_t s_7_22[5] = { 'i', 'r', 'e', 't', 'e' };
+    static constexpr char32_t s_7_23[3] = { 'i', 't', 'e' };
+    static constexpr char32_t s_7_24[6] = { 'e', 'r', 'e', 's', 't', 'e' };
+    static constexpr char32_t s_7_25[6] = { 'i', 'r', 'e', 's', 't', 'e' };
+    static constexpr char32_t s_7_26[3] = { 'u', 't', 'e' };
+    static constexpr char32_t s_7_27[4] = { 'e', 'r', 'a', 'i' };
+    static constexpr char32_t s_7_28[4] = { 'i', 'r', 'a', 'i' };
+    static constexpr char32_t s_7_29[4] = { 'i', 's', 'c', 'i' };
+    static constexpr char32_t s_7_30[4] = { 'e', 'n', 'd', 'i' };
+    static constexpr char32_t s_7_31[4] = { 'e', 'r', 'e', 'i' };
+    static constexpr char32_t s_7_32[4] = { 'i', 'r', 'e', 'i' };
+    static constexpr char32_t s_7_33[4] = { 'a', 's', 's', 'i' };
+    static constexpr char32_t s_7_34[3] = { 'a', 't', 'i' };
+    static constexpr char32_t s_7_35[3] = { 'i', 't', 'i' };
+    static constexpr char32_t s_7_36[6] = { 'e', 'r', 'e', 's', 't', 'i' };
+    static constexpr char32_t s_7_37[6] = { 'i', 'r', 'e', 's', 't', 'i' };
+    static constexpr char32_t s_7_38[3] = { 'u', 't', 'i' };
+    static constexpr char32_t s_7_39[3] = { 'a', 'v', 'i' };
+    static constexpr char32_t s_7_40[3] = { 'e', 'v', 'i' };
+    static constexpr char32_t s_7_41[3] = { 'i', 'v', 'i' };
+    static constexpr char32_t s_7_42[4] = { 'i', 's', 'c', 'o' };
+    static constexpr char32_t s_7_43[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr char32_t s_7_44[4] = { 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_7_45[4] = { 'Y', 'a', 'm', 'o' };
+    static constexpr char32_t s_7_46[4] = { 'i', 'a', 'm', 'o' };
+    static constexpr char32_t s_7_47[5] = { 'a', 'v', 'a', 'm', 'o' };
+    static constexpr char32_t s_7_48[5] = { 'e', 'v', 'a', 'm', 'o' };
+    static constexpr char32_t s_7_49[5] = { 'i', 'v', 'a', 'm', 'o' };
+    static constexpr char32_t s_7_50[5] = { 'e', 'r', 'e', 'm', 'o' };
+    static constexpr char32_t s_7_51[5] = { 'i', 'r', 'e', 'm', 'o' };
+    static constexpr char32_t s_7_52[6] = { 'a', 's', 's', 'i', 'm', 'o' };
+    static constexpr char32_t s_7_53[4] = { 'a', 'm', 'm', 'o' };
+    static constexpr char32_t s_7_54[4] = { 'e', 'm', 'm', 'o' };
+    static constexpr char32_t s_7_55[6] = { 'e', 'r', 'e', 'm', 'm', 'o' };
+    static constexpr char32_t s_7_56[6] = { 'i', 'r', 'e', 'm', 'm', 'o' };
+    static constexpr char32_t s_7_57[4] = { 'i', 'm', 'm', 'o' };
+    static constexpr char32_t s_7_58[3] = { 'a', 'n', 'o' };
+    static constexpr char32_t s_7_59[6] = { 'i', 's', 'c', 'a', 'n', 'o' };
+    static constexpr char32_t s_7_60[5] = { 'a', 'v', 'a', 'n', 'o' };
+    static constexpr char32_t s_7_61[5] = { 'e', 'v', 'a', 'n', 'o' };
+    static constexpr char32_t s_7_62[5] = { 'i', 'v', 'a', 'n', 'o' };
+    static constexpr char32_t s_7_63[6] = { 'e', 'r', 'a', 'n', 'n', 'o' };
+    static constexpr char32_t s_7_64[6] = { 'i', 'r', 'a', 'n', 'n', 'o' };
+    static constexpr char32_t s_7_65[3] = { 'o', 'n', 'o' };
+    static constexpr char32_t s_7_66[6] = { 'i', 's', 'c', 'o', 'n', 'o' };
+    static constexpr char32_t s_7_67[5] = { 'a', 'r', 'o', 'n', 'o' };
+    static constexpr char32_t s_7_68[5] = { 'e', 'r', 'o', 'n', 'o' };
+    static constexpr char32_t s_7_69[5] = { 'i', 'r', 'o', 'n', 'o' };
+    static constexpr char32_t s_7_70[8] = { 'e', 'r', 'e', 'b', 'b', 'e', 'r', 'o' };
+    static constexpr char32_t s_7_71[8] = { 'i', 'r', 'e', 'b', 'b', 'e', 'r', 'o' };
+    static constexpr char32_t s_7_72[6] = { 'a', 's', 's', 'e', 'r', 'o' };
+    static constexpr char32_t s_7_73[6] = { 'e', 's', 's', 'e', 'r', 'o' };
+    static constexpr char32_t s_7_74[6] = { 'i', 's', 's', 'e', 'r', 'o' };
+    static constexpr char32_t s_7_75[3] = { 'a', 't', 'o' };
+    static constexpr char32_t s_7_76[3] = { 'i', 't', 'o' };
+    static constexpr char32_t s_7_77[3] = { 'u', 't', 'o' };
+    static constexpr char32_t s_7_78[3] = { 'a', 'v', 'o' };
+    static constexpr char32_t s_7_79[3] = { 'e', 'v', 'o' };
+    static constexpr char32_t s_7_80[3] = { 'i', 'v', 'o' };
+    static constexpr char32_t s_7_81[2] = { 'a', 'r' };
+    static constexpr char32_t s_7_82[2] = { 'i', 'r' };
+    static constexpr char32_t s_7_83[3] = { 'e', 'r', 0xE0 };
+    static constexpr char32_t s_7_84[3] = { 'i', 'r', 0xE0 };
+    static constexpr char32_t s_7_85[3] = { 'e', 'r', 0xF2 };
+    static constexpr char32_t s_7_86[3] = { 'i', 'r', 0xF2 };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 4, s_7_0, -1, 1, 0 },
+    /*  1 */ { 4, s_7_1, -1, 1, 0 },
+    /*  2 */ { 3, s_7_2, -1, 1, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 3, s_7_4, -1, 1, 0 },
+    /*  5 */ { 3, s_7_5, -1, 1, 0 },
+    /*  6 */ { 3, s_7_6, -1, 1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 6, s_7_8, -1, 1, 0 },
+    /*  9 */ { 6, s_7_9, -1, 1, 0 },
+    /* 10 */ { 4, s_7_10, -1, 1, 0 },
+    /* 11 */ { 4, s_7_11, -1, 1, 0 },
+    /* 12 */ { 3, s_7_12, -1, 1, 0 },
+    /* 13 */ { 3, s_7_13, -1, 1, 0 },
+    /* 14 */ { 3, s_7_14, -1, 1, 0 },
+    /* 15 */ { 4, s_7_15, -1, 1, 0 },
+    /* 16 */ { 3, s_7_16, -1, 1, 0 },
+    /* 17 */ { 5, s_7_17, 16, 1, 0 },
+    /* 18 */ { 5, s_7_18, 16, 1, 0 },
+    /* 19 */ { 5, s_7_19, 16, 1, 0 },
+    /* 20 */ { 3, s_7_20, -1, 1, 0 },
+    /* 21 */ { 5, s_7_21, 20, 1, 0 },
+    /* 22 */ { 5, s_7_22, 20, 1, 0 },
+    /* 23 */ { 3, s_7_23, -1, 1, 0 },
+    /* 24 */ { 6, s_7_24, -1, 1, 0 },
+    /* 25 */ { 6, s_7_25, -1, 1, 0 },
+    /* 26 */ { 3, s_7_26, -1, 1, 0 },
+    /* 27 */ { 4, s_7_27, -1, 1, 0 },
+    /* 28 */ { 4, s_7_28, -1, 1, 0 },
+    /* 29 */ { 4, s_7_29, -1, 1, 0 },
+    /* 30 */ { 4, s_7_30, -1, 1, 0 },
+    /* 31 */ { 4, s_7_31, -1, 1, 0 },
+    /* 32 */ { 4, s_7_32, -1, 1, 0 },
+    /* 33 */ { 4, s_7_33, -1, 1, 0 },
+    /* 34 */ { 3, s_7_34, -1, 1, 0 },
+    /* 35 */ { 3, s_7_35, -1, 1, 0 },
+    /* 36 */ { 6, s_7_36, -1, 1, 0 },
+    /* 37 */ { 6, s_7_37, -1, 1, 0 },
+    /* 38 */ { 3, s_7_38, -1, 1, 0 },
+    /* 39 */ { 3, s_7_39, -1, 1, 0 },
+    /* 40 */ { 3, s_7_40, -1, 1, 0 },
+    /* 41 */ { 3, s_7_41, -1, 1, 0 },
+    /* 42 */ { 4, s_7_42, -1, 1, 0 },
+    /* 43 */ { 4, s_7_43, -1, 1, 0 },
+    /* 44 */ { 4, s_7_44, -1, 1, 0 },
+    /* 45 */ { 4, s_7_45, -1, 1, 0 },
+    /* 46 */ { 4, s_7_46, -1, 1, 0 },
+    /* 47 */ { 5, s_7_47, -1, 1, 0 },
+    /* 48 */ { 5, s_7_48, -1, 1, 0 },
+    /* 49 */ { 5, s_7_49, -1, 1, 0 },
+    /* 50 */ { 5, s_7_50, -1, 1, 0 },
+    /* 51 */ { 5, s_7_51, -1, 1, 0 },
+    /* 52 */ { 6, s_7_52, -1, 1, 0 },
+    /* 53 */ { 4, s_7_53, -1, 1, 0 },
+    /* 54 */ { 4, s_7_54, -1, 1, 0 },
+    /* 55 */ { 6, s_7_55, 54, 1, 0 },
+    /* 56 */ { 6, s_7_56, 54, 1, 0 },
+    /* 57 */ { 4, s_7_57, -1, 1, 0 },
+    /* 58 */ { 3, s_7_58, -1, 1, 0 },
+    /* 59 */ { 6, s_7_59, 58, 1, 0 },
+    /* 60 */ { 5, s_7_60, 58, 1, 0 },
+    /* 61 */ { 5, s_7_61, 58, 1, 0 },
+    /* 62 */ { 5, s_7_62, 58, 1, 0 },
+    /* 63 */ { 6, s_7_63, -1, 1, 0 },
+    /* 64 */ { 6, s_7_64, -1, 1, 0 },
+    /* 65 */ { 3, s_7_65, -1, 1, 0 },
+    /* 66 */ { 6, s_7_66, 65, 1, 0 },
+    /* 67 */ { 5, s_7_67, 65, 1, 0 },
+    /* 68 */ { 5, s_7_68, 65, 1, 0 },
+    /* 69 */ { 5, s_7_69, 65, 1, 0 },
+    /* 70 */ { 8, s_7_70, -1, 1, 0 },
+    /* 71 */ { 8, s_7_71, -1, 1, 0 },
+    /* 72 */ { 6, s_7_72, -1, 1, 0 },
+    /* 73 */ { 6, s_7_73, -1, 1, 0 },
+    /* 74 */ { 6, s_7_74, -1, 1, 0 },
+    /* 75 */ { 3, s_7_75, -1, 1, 0 },
+    /* 76 */ { 3, s_7_76, -1, 1, 0 },
+    /* 77 */ { 3, s_7_77, -1, 1, 0 },
+    /* 78 */ { 3, s_7_78, -1, 1, 0 },
+    /* 79 */ { 3, s_7_79, -1, 1, 0 },
+    /* 80 */ { 3, s_7_80, -1, 1, 0 },
+    /* 81 */ { 2, s_7_81, -1, 1, 0 },
+    /* 82 */ { 2, s_7_82, -1, 1, 0 },
+    /* 83 */ { 3, s_7_83, -1, 1, 0 },
+    /* 84 */ { 3, s_7_84, -1, 1, 0 },
+    /* 85 */ { 3, s_7_85, -1, 1, 0 },
+    /* 86 */ { 3, s_7_86, -1, 1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 0xE0 };
+    static constexpr char32_t s_1[] = { 0xE8 };
+    static constexpr char32_t s_2[] = { 0xEC };
+    static constexpr char32_t s_3[] = { 0xF2 };
+    static constexpr char32_t s_4[] = { 0xF9 };
+    static constexpr char32_t s_5[] = { 'q', 'U' };
+    static constexpr char32_t s_6[] = { 'u' };
+    static constexpr char32_t s_7[] = { 'U' };
+    static constexpr char32_t s_8[] = { 'i' };
+    static constexpr char32_t s_9[] = { 'I' };
+    static constexpr char32_t s_10[] = { 'i' };
+    static constexpr char32_t s_11[] = { 'u' };
+    static constexpr char32_t s_12[] = { 'e' };
+    static constexpr char32_t s_13[] = { 'i', 'c' };
+    static constexpr char32_t s_14[] = { 'l', 'o', 'g' };
+    static constexpr char32_t s_15[] = { 'u' };
+    static constexpr char32_t s_16[] = { 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_17[] = { 'a', 't' };
+    static constexpr char32_t s_18[] = { 'a', 't' };
+    static constexpr char32_t s_19[] = { 'i', 'c' };
+    static constexpr char32_t s_20[] = { 'i' };
+    static constexpr char32_t s_21[] = { 'h' };
+};
+
+template <typename symbol>
+class italian_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef italian_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        int among_var;
+        {   int c_test = c; /* test, line 35 */
+            while(1) { /* repeat, line 35 */
+                int c1 = c;
+                bra = c; /* [, line 36 */
+                among_var = find_among(data::a_0); /* substring, line 36 */
+                if (!among_var) goto lab0;
+                ket = c; /* ], line 36 */
+                switch(among_var) {
+                    case 0: goto lab0;
+                    case 1:
+                        slice_from(data::s_0); /* <-, line 37 */
+                        break;
+                    case 2:
+                        slice_from(data::s_1); /* <-, line 38 */
+                        break;
+                    case 3:
+                        slice_from(data::s_2); /* <-, line 39 */
+                        break;
+                    case 4:
+                        slice_from(data::s_3); /* <-, line 40 */
+                        break;
+                    case 5:
+                        slice_from(data::s_4); /* <-, line 41 */
+                        break;
+                    case 6:
+                        slice_from(data::s_5); /* <-, line 42 */
+                        break;
+                    case 7:
+                        {   int ret = hop(c, 0, l, 1); /* next, line 43 */
+                            if (ret < 0) goto lab0;
+                            c = ret;
+                        }
+                        break;
+                }
+                continue;
+            lab0:
+                c = c1;
+                break;
+            }
+            c = c_test;
+        }
+        while(1) { /* repeat, line 46 */
+            int c2 = c;
+            while(1) { /* goto, line 46 */
+                int c3 = c;
+                if (in_grouping(data::g_v, 97, 249, 0)) goto lab2; /* grouping v, line 47 */
+                bra = c; /* [, line 47 */
+                {   int c4 = c; /* or, line 47 */
+                    if (!eq_s(data::s_6)) goto lab4; /* literal, line 47 */
+                    ket = c; /* ], line 47 */
+                    if (in_grouping(data::g_v, 97, 249, 0)) goto lab4; /* grouping v, line 47 */
+                    slice_from(data::s_7); /* <-, line 47 */
+                    goto lab3;
+                lab4:
+                    c = c4;
+                    if (!eq_s(data::s_8)) goto lab2; /* literal, line 48 */
+                    ket = c; /* ], line 48 */
+                    if (in_grouping(data::g_v, 97, 249, 0)) goto lab2; /* grouping v, line 48 */
+                    slice_from(data::s_9); /* <-, line 48 */
+                }
+            lab3:
+                c = c3;
+                break;
+            lab2:
+                c = c3;
+                {   int ret = hop(c, 0, l, 1); /* goto, line 46 */
+                    if (ret < 0) goto lab1;
+                    c = ret;
+                }
+            }
+            continue;
+        lab1:
+            c = c2;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_pV = l; /* $pV = <integer expression>, line 54 */
+        I_p1 = l; /* $p1 = <integer expression>, line 55 */
+        I_p2 = l; /* $p2 = <integer expression>, line 56 */
+        {   int c1 = c; /* do, line 58 */
+            {   int c2 = c; /* or, line 60 */
+                if (in_grouping(data::g_v, 97, 249, 0)) goto lab2; /* grouping v, line 59 */
+                {   int c3 = c; /* or, line 59 */
+                    if (out_grouping(data::g_v, 97, 249, 0)) goto lab4; /* non v, line 59 */
+                    {    /* gopast */ /* grouping v, line 59 */
+                        int ret = out_grouping(data::g_v, 97, 249, 1);
+                        if (ret < 0) goto lab4;
+                        c += ret;
+                    }
+                    goto lab3;
+                lab4:
+                    c = c3;
+                    if (in_grouping(data::g_v, 97, 249, 0)) goto lab2; /* grouping v, line 59 */
+                    {    /* gopast */ /* non v, line 59 */
+                        int ret = in_grouping(data::g_v, 97, 249, 1);
+                        if (ret < 0) goto lab2;
+                        c += ret;
+                    }
+                }
+            lab3:
+                goto lab1;
+            lab2:
+                c = c2;
+                if (out_grouping(data::g_v, 97, 249, 0)) goto lab0; /* non v, line 61 */
+                {   int c4 = c; /* or, line 61 */
+                    if (out_grouping(data::g_v, 97, 249, 0)) goto lab6; /* non v, line 61 */
+                    {    /* gopast */ /* grouping v, line 61 */
+                        int ret = out_grouping(data::g_v, 97, 249, 1);
+                        if (ret < 0) goto lab6;
+                        c += ret;
+                    }
+                    goto lab5;
+                lab6:
+                    c = c4;
+                    if (in_grouping(data::g_v, 97, 249, 0)) goto lab0; /* grouping v, line 61 */
+                    {   int ret = hop(c, 0, l, 1); /* next, line 61 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                }
+            lab5:
+                ;
+            }
+        lab1:
+            I_pV = c; /* setmark pV, line 62 */
+        lab0:
+            c = c1;
+        }
+        {   int c5 = c; /* do, line 64 */
+            {    /* gopast */ /* grouping v, line 65 */
+                int ret = out_grouping(data::g_v, 97, 249, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 65 */
+                int ret = in_grouping(data::g_v, 97, 249, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 65 */
+            {    /* gopast */ /* grouping v, line 66 */
+                int ret = out_grouping(data::g_v, 97, 249, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 66 */
+                int ret = in_grouping(data::g_v, 97, 249, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 66 */
+        lab7:
+            c = c5;
+        }
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 70 */
+            int c1 = c;
+            bra = c; /* [, line 72 */
+            if (c >= l || (p[c] != 73 && p[c] != 85)) among_var = 3; else /* substring, line 72 */
+            among_var = find_among(data::a_1); /* substring, line 72 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 72 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_10); /* <-, line 73 */
+                    break;
+                case 2:
+                    slice_from(data::s_11); /* <-, line 74 */
+                    break;
+                case 3:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 75 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_RV() {
+        if (!(I_pV <= c)) return false; /* $pV <= <integer expression>, line 82 */
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 83 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 84 */
+        return true;
+    }
+
+  private:
+    bool r_attached_pronoun() {
+        int among_var;
+        ket = c; /* [, line 87 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((33314 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 87 */
+        if (!find_among_b(data::a_2)) return false; /* substring, line 87 */
+        bra = c; /* ], line 87 */
+        if (c - 1 <= lb || (p[c - 1] != 111 && p[c - 1] != 114)) return false; /* among, line 97 */
+        among_var = find_among_b(data::a_3); /* among, line 97 */
+        if (!among_var) return false;
+        if (!r_RV()) return false; /* call RV, line 97 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 98 */
+                break;
+            case 2:
+                slice_from(data::s_12); /* <-, line 99 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        ket = c; /* [, line 104 */
+        among_var = find_among_b(data::a_6); /* substring, line 104 */
+        if (!among_var) return false;
+        bra = c; /* ], line 104 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_R2()) return false; /* call R2, line 111 */
+                slice_del(); /* delete, line 111 */
+                break;
+            case 2:
+                if (!r_R2()) return false; /* call R2, line 113 */
+                slice_del(); /* delete, line 113 */
+                {   int m_keep = l - c; /* try, line 114 */
+                    ket = c; /* [, line 114 */
+                    if (!eq_s_b(data::s_13)) { c = l - m_keep; goto lab0; } /* literal, line 114 */
+                    bra = c; /* ], line 114 */
+                    if (!r_R2()) { c = l - m_keep; goto lab0; } /* call R2, line 114 */
+                    slice_del(); /* delete, line 114 */
+                lab0:
+                    ;
+                }
+                break;
+            case 3:
+                if (!r_R2()) return false; /* call R2, line 117 */
+                slice_from(data::s_14); /* <-, line 117 */
+                break;
+            case 4:
+                if (!r_R2()) return false; /* call R2, line 119 */
+                slice_from(data::s_15); /* <-, line 119 */
+                break;
+            case 5:
+                if (!r_R2()) return false; /* call R2, line 121 */
+                slice_from(data::s_16); /* <-, line 121 */
+                break;
+            case 6:
+                if (!r_RV()) return false; /* call RV, line 123 */
+                slice_del(); /* delete, line 123 */
+                break;
+            case 7:
+                if (!r_R1()) return false; /* call R1, line 125 */
+                slice_del(); /* delete, line 125 */
+                {   int m_keep = l - c; /* try, line 126 */
+                    ket = c; /* [, line 127 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4722696 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab1; } /* substring, line 127 */
+                    among_var = find_among_b(data::a_4); /* substring, line 127 */
+                    if (!among_var) { c = l - m_keep; goto lab1; }
+                    bra = c; /* ], line 127 */
+                    if (!r_R2()) { c = l - m_keep; goto lab1; } /* call R2, line 127 */
+                    slice_del(); /* delete, line 127 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab1; }
+                        case 1:
+                            ket = c; /* [, line 128 */
+                            if (!eq_s_b(data::s_17)) { c = l - m_keep; goto lab1; } /* literal, line 128 */
+                            bra = c; /* ], line 128 */
+                            if (!r_R2()) { c = l - m_keep; goto lab1; } /* call R2, line 128 */
+                            slice_del(); /* delete, line 128 */
+                            break;
+                    }
+                lab1:
+                    ;
+                }
+                break;
+            case 8:
+                if (!r_R2()) return false; /* call R2, line 134 */
+                slice_del(); /* delete, line 134 */
+                {   int m_keep = l - c; /* try, line 135 */
+                    ket = c; /* [, line 136 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4198408 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab2; } /* substring, line 136 */
+                    among_var = find_among_b(data::a_5); /* substring, line 136 */
+                    if (!among_var) { c = l - m_keep; goto lab2; }
+                    bra = c; /* ], line 136 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab2; }
+                        case 1:
+                            if (!r_R2()) { c = l - m_keep; goto lab2; } /* call R2, line 137 */
+                            slice_del(); /* delete, line 137 */
+                            break;
+                    }
+                lab2:
+                    ;
+                }
+                break;
+            case 9:
+                if (!r_R2()) return false; /* call R2, line 142 */
+                slice_del(); /* delete, line 142 */
+                {   int m_keep = l - c; /* try, line 143 */
+                    ket = c; /* [, line 143 */
+                    if (!eq_s_b(data::s_18)) { c = l - m_keep; goto lab3; } /* literal, line 143 */
+                    bra = c; /* ], line 143 */
+                    if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 143 */
+                    slice_del(); /* delete, line 143 */
+                    ket = c; /* [, line 143 */
+                    if (!eq_s_b(data::s_19)) { c = l - m_keep; goto lab3; } /* literal, line 143 */
+                    bra = c; /* ], line 143 */
+                    if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 143 */
+                    slice_del(); /* delete, line 143 */
+                lab3:
+                    ;
+                }
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 148 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 148 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 149 */
+            among_var = find_among_b(data::a_7); /* substring, line 149 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 149 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    slice_del(); /* delete, line 163 */
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_vowel_suffix() {
+        {   int m_keep = l - c; /* try, line 171 */
+            ket = c; /* [, line 172 */
+            if (in_grouping_b(data::g_AEIO, 97, 242, 0)) { c = l - m_keep; goto lab0; } /* grouping AEIO, line 172 */
+            bra = c; /* ], line 172 */
+            if (!r_RV()) { c = l - m_keep; goto lab0; } /* call RV, line 172 */
+            slice_del(); /* delete, line 172 */
+            ket = c; /* [, line 173 */
+            if (!eq_s_b(data::s_20)) { c = l - m_keep; goto lab0; } /* literal, line 173 */
+            bra = c; /* ], line 173 */
+            if (!r_RV()) { c = l - m_keep; goto lab0; } /* call RV, line 173 */
+            slice_del(); /* delete, line 173 */
+        lab0:
+            ;
+        }
+        {   int m_keep = l - c; /* try, line 175 */
+            ket = c; /* [, line 176 */
+            if (!eq_s_b(data::s_21)) { c = l - m_keep; goto lab1; } /* literal, line 176 */
+            bra = c; /* ], line 176 */
+            if (in_grouping_b(data::g_CG, 99, 103, 0)) { c = l - m_keep; goto lab1; } /* grouping CG, line 176 */
+            if (!r_RV()) { c = l - m_keep; goto lab1; } /* call RV, line 176 */
+            slice_del(); /* delete, line 176 */
+        lab1:
+            ;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 182 */
+            if (!r_prelude()) goto lab0; /* call prelude, line 182 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 183 */
+            if (!r_mark_regions()) goto lab1; /* call mark_regions, line 183 */
+        lab1:
+            c = c2;
+        }
+        lb = c; c = l; /* backwards, line 184 */
+
+        {   int m3 = l - c; (void)m3; /* do, line 185 */
+            if (!r_attached_pronoun()) goto lab2; /* call attached_pronoun, line 185 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 186 */
+            {   int m5 = l - c; (void)m5; /* or, line 186 */
+                if (!r_standard_suffix()) goto lab5; /* call standard_suffix, line 186 */
+                goto lab4;
+            lab5:
+                c = l - m5;
+                if (!r_verb_suffix()) goto lab3; /* call verb_suffix, line 186 */
+            }
+        lab4:
+        lab3:
+            c = l - m4;
+        }
+        {   int m6 = l - c; (void)m6; /* do, line 187 */
+            if (!r_vowel_suffix()) goto lab6; /* call vowel_suffix, line 187 */
+        lab6:
+            c = l - m6;
+        }
+        c = lb;
+        {   int c7 = c; /* do, line 189 */
+            if (!r_postlude()) goto lab7; /* call postlude, line 189 */
+        lab7:
+            c = c7;
+        }
+        return true;
+    }
+
+  private:
+    int I_p2 = 0;
+    int I_p1 = 0;
+    int I_pV = 0;
+};
+
+}
+
+#endif
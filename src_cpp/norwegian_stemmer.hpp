@@ -0,0 +1,390 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_NORWEGIAN_STEMMER_HPP
+#define SNOWBALL_NORWEGIAN_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct norwegian_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128 };
+    static constexpr unsigned char g_s_ending[] = { 119, 125, 149, 1 };
+};
+
+template <bool utf8> struct norwegian_stemmer_data;
+
+template <>
+struct norwegian_stemmer_data<true> : norwegian_stemmer_groupings {
+    static constexpr unsigned char s_0_0[1] = { 'a' };
+    static constexpr unsigned char s_0_1[1] = { 'e' };
+    static constexpr unsigned char s_0_2[3] = { 'e', 'd', 'e' };
+    static constexpr unsigned char s_0_3[4] = { 'a', 'n', 'd', 'e' };
+    static constexpr unsigned char s_0_4[4] = { 'e', 'n', 'd', 'e' };
+    static constexpr unsigned char s_0_5[3] = { 'a', 'n', 'e' };
+    static constexpr unsigned char s_0_6[3] = { 'e', 'n', 'e' };
+    static constexpr unsigned char s_0_7[6] = { 'h', 'e', 't', 'e', 'n', 'e' };
+    static constexpr unsigned char s_0_8[4] = { 'e', 'r', 't', 'e' };
+    static constexpr unsigned char s_0_9[2] = { 'e', 'n' };
+    static constexpr unsigned char s_0_10[5] = { 'h', 'e', 't', 'e', 'n' };
+    static constexpr unsigned char s_0_11[2] = { 'a', 'r' };
+    static constexpr unsigned char s_0_12[2] = { 'e', 'r' };
+    static constexpr unsigned char s_0_13[5] = { 'h', 'e', 't', 'e', 'r' };
+    static constexpr unsigned char s_0_14[1] = { 's' };
+    static constexpr unsigned char s_0_15[2] = { 'a', 's' };
+    static constexpr unsigned char s_0_16[2] = { 'e', 's' };
+    static constexpr unsigned char s_0_17[4] = { 'e', 'd', 'e', 's' };
+    static constexpr unsigned char s_0_18[5] = { 'e', 'n', 'd', 'e', 's' };
+    static constexpr unsigned char s_0_19[4] = { 'e', 'n', 'e', 's' };
+    static constexpr unsigned char s_0_20[7] = { 'h', 'e', 't', 'e', 'n', 'e', 's' };
+    static constexpr unsigned char s_0_21[3] = { 'e', 'n', 's' };
+    static constexpr unsigned char s_0_22[6] = { 'h', 'e', 't', 'e', 'n', 's' };
+    static constexpr unsigned char s_0_23[3] = { 'e', 'r', 's' };
+    static constexpr unsigned char s_0_24[3] = { 'e', 't', 's' };
+    static constexpr unsigned char s_0_25[2] = { 'e', 't' };
+    static constexpr unsigned char s_0_26[3] = { 'h', 'e', 't' };
+    static constexpr unsigned char s_0_27[3] = { 'e', 'r', 't' };
+    static constexpr unsigned char s_0_28[3] = { 'a', 's', 't' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 1, 0 },
+    /*  1 */ { 1, s_0_1, -1, 1, 0 },
+    /*  2 */ { 3, s_0_2, 1, 1, 0 },
+    /*  3 */ { 4, s_0_3, 1, 1, 0 },
+    /*  4 */ { 4, s_0_4, 1, 1, 0 },
+    /*  5 */ { 3, s_0_5, 1, 1, 0 },
+    /*  6 */ { 3, s_0_6, 1, 1, 0 },
+    /*  7 */ { 6, s_0_7, 6, 1, 0 },
+    /*  8 */ { 4, s_0_8, 1, 3, 0 },
+    /*  9 */ { 2, s_0_9, -1, 1, 0 },
+    /* 10 */ { 5, s_0_10, 9, 1, 0 },
+    /* 11 */ { 2, s_0_11, -1, 1, 0 },
+    /* 12 */ { 2, s_0_12, -1, 1, 0 },
+    /* 13 */ { 5, s_0_13, 12, 1, 0 },
+    /* 14 */ { 1, s_0_14, -1, 2, 0 },
+    /* 15 */ { 2, s_0_15, 14, 1, 0 },
+    /* 16 */ { 2, s_0_16, 14, 1, 0 },
+    /* 17 */ { 4, s_0_17, 16, 1, 0 },
+    /* 18 */ { 5, s_0_18, 16, 1, 0 },
+    /* 19 */ { 4, s_0_19, 16, 1, 0 },
+    /* 20 */ { 7, s_0_20, 19, 1, 0 },
+    /* 21 */ { 3, s_0_21, 14, 1, 0 },
+    /* 22 */ { 6, s_0_22, 21, 1, 0 },
+    /* 23 */ { 3, s_0_23, 14, 1, 0 },
+    /* 24 */ { 3, s_0_24, 14, 1, 0 },
+    /* 25 */ { 2, s_0_25, -1, 1, 0 },
+    /* 26 */ { 3, s_0_26, 25, 1, 0 },
+    /* 27 */ { 3, s_0_27, -1, 3, 0 },
+    /* 28 */ { 3, s_0_28, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[2] = { 'd', 't' };
+    static constexpr unsigned char s_1_1[2] = { 'v', 't' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[3] = { 'l', 'e', 'g' };
+    static constexpr unsigned char s_2_1[4] = { 'e', 'l', 'e', 'g' };
+    static constexpr unsigned char s_2_2[2] = { 'i', 'g' };
+    static constexpr unsigned char s_2_3[3] = { 'e', 'i', 'g' };
+    static constexpr unsigned char s_2_4[3] = { 'l', 'i', 'g' };
+    static constexpr unsigned char s_2_5[4] = { 'e', 'l', 'i', 'g' };
+    static constexpr unsigned char s_2_6[3] = { 'e', 'l', 's' };
+    static constexpr unsigned char s_2_7[3] = { 'l', 'o', 'v' };
+    static constexpr unsigned char s_2_8[4] = { 'e', 'l', 'o', 'v' };
+    static constexpr unsigned char s_2_9[4] = { 's', 'l', 'o', 'v' };
+    static constexpr unsigned char s_2_10[7] = { 'h', 'e', 't', 's', 'l', 'o', 'v' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, 1, 0 },
+    /*  1 */ { 4, s_2_1, 0, 1, 0 },
+    /*  2 */ { 2, s_2_2, -1, 1, 0 },
+    /*  3 */ { 3, s_2_3, 2, 1, 0 },
+    /*  4 */ { 3, s_2_4, 2, 1, 0 },
+    /*  5 */ { 4, s_2_5, 4, 1, 0 },
+    /*  6 */ { 3, s_2_6, -1, 1, 0 },
+    /*  7 */ { 3, s_2_7, -1, 1, 0 },
+    /*  8 */ { 4, s_2_8, 7, 1, 0 },
+    /*  9 */ { 4, s_2_9, 7, 1, 0 },
+    /* 10 */ { 7, s_2_10, 9, 1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'k' };
+    static constexpr unsigned char s_1[] = { 'e', 'r' };
+};
+
+template <>
+struct norwegian_stemmer_data<false> : norwegian_stemmer_groupings {
+    static constexpr char32_t s_0_0[1] = { 'a' };
+    static constexpr char32_t s_0_1[1] = { 'e' };
+    static constexpr char32_t s_0_2[3] = { 'e', 'd', 'e' };
+    static constexpr char32_t s_0_3[4] = { 'a', 'n', 'd', 'e' };
+    static constexpr char32_t s_0_4[4] = { 'e', 'n', 'd', 'e' };
+    static constexpr char32_t s_0_5[3] = { 'a', 'n', 'e' };
+    static constexpr char32_t s_0_6[3] = { 'e', 'n', 'e' };
+    static constexpr char32_t s_0_7[6] = { 'h', 'e', 't', 'e', 'n', 'e' };
+    static constexpr char32_t s_0_8[4] = { 'e', 'r', 't', 'e' };
+    static constexpr char32_t s_0_9[2] = { 'e', 'n' };
+    static constexpr char32_t s_0_10[5] = { 'h', 'e', 't', 'e', 'n' };
+    static constexpr char32_t s_0_11[2] = { 'a', 'r' };
+    static constexpr char32_t s_0_12[2] = { 'e', 'r' };
+    static constexpr char32_t s_0_13[5] = { 'h', 'e', 't', 'e', 'r' };
+    static constexpr char32_t s_0_14[1] = { 's' };
+    static constexpr char32_t s_0_15[2] = { 'a', 's' };
+    static constexpr char32_t s_0_16[2] = { 'e', 's' };
+    static constexpr char32_t s_0_17[4] = { 'e', 'd', 'e', 's' };
+    static constexpr char32_t s_0_18[5] = { 'e', 'n', 'd', 'e', 's' };
+    static constexpr char32_t s_0_19[4] = { 'e', 'n', 'e', 's' };
+    static constexpr char32_t s_0_20[7] = { 'h', 'e', 't', 'e', 'n', 'e', 's' };
+    static constexpr char32_t s_0_21[3] = { 'e', 'n', 's' };
+    static constexpr char32_t s_0_22[6] = { 'h', 'e', 't', 'e', 'n', 's' };
+    static constexpr char32_t s_0_23[3] = { 'e', 'r', 's' };
+    static constexpr char32_t s_0_24[3] = { 'e', 't', 's' };
+    static constexpr char32_t s_0_25[2] = { 'e', 't' };
+    static constexpr char32_t s_0_26[3] = { 'h', 'e', 't' };
+    static constexpr char32_t s_0_27[3] = { 'e', 'r', 't' };
+    static constexpr char32_t s_0_28[3] = { 'a', 's', 't' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 1, 0 },
+    /*  1 */ { 1, s_0_1, -1, 1, 0 },
+    /*  2 */ { 3, s_0_2, 1, 1, 0 },
+    /*  3 */ { 4, s_0_3, 1, 1, 0 },
+    /*  4 */ { 4, s_0_4, 1, 1, 0 },
+    /*  5 */ { 3, s_0_5, 1, 1, 0 },
+    /*  6 */ { 3, s_0_6, 1, 1, 0 },
+    /*  7 */ { 6, s_0_7, 6, 1, 0 },
+    /*  8 */ { 4, s_0_8, 1, 3, 0 },
+    /*  9 */ { 2, s_0_9, -1, 1, 0 },
+    /* 10 */ { 5, s_0_10, 9, 1, 0 },
+    /* 11 */ { 2, s_0_11, -1, 1, 0 },
+    /* 12 */ { 2, s_0_12, -1, 1, 0 },
+    /* 13 */ { 5, s_0_13, 12, 1, 0 },
+    /* 14 */ { 1, s_0_14, -1, 2, 0 },
+    /* 15 */ { 2, s_0_15, 14, 1, 0 },
+    /* 16 */ { 2, s_0_16, 14, 1, 0 },
+    /* 17 */ { 4, s_0_17, 16, 1, 0 },
+    /* 18 */ { 5, s_0_18, 16, 1, 0 },
+    /* 19 */ { 4, s_0_19, 16, 1, 0 },
+    /* 20 */ { 7, s_0_20, 19, 1, 0 },
+    /* 21 */ { 3, s_0_21, 14, 1, 0 },
+    /* 22 */ { 6, s_0_22, 21, 1, 0 },
+    /* 23 */ { 3, s_0_23, 14, 1, 0 },
+    /* 24 */ { 3, s_0_24, 14, 1, 0 },
+    /* 25 */ { 2, s_0_25, -1, 1, 0 },
+    /* 26 */ { 3, s_0_26, 25, 1, 0 },
+    /* 27 */ { 3, s_0_27, -1, 3, 0 },
+    /* 28 */ { 3, s_0_28, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[2] = { 'd', 't' };
+    static constexpr char32_t s_1_1[2] = { 'v', 't' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[3] = { 'l', 'e', 'g' };
+    static constexpr char32_t s_2_1[4] = { 'e', 'l', 'e', 'g' };
+    static constexpr char32_t s_2_2[2] = { 'i', 'g' };
+    static constexpr char32_t s_2_3[3] = { 'e', 'i', 'g' };
+    static constexpr char32_t s_2_4[3] = { 'l', 'i', 'g' };
+    static constexpr char32_t s_2_5[4] = { 'e', 'l', 'i', 'g' };
+    static constexpr char32_t s_2_6[3] = { 'e', 'l', 's' };
+    static constexpr char32_t s_2_7[3] = { 'l', 'o', 'v' };
+    static constexpr char32_t s_2_8[4] = { 'e', 'l', 'o', 'v' };
+    static constexpr char32_t s_2_9[4] = { 's', 'l', 'o', 'v' };
+    static constexpr char32_t s_2_10[7] = { 'h', 'e', 't', 's', 'l', 'o', 'v' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 3, s_2_0, -1, 1, 0 },
+    /*  1 */ { 4, s_2_1, 0, 1, 0 },
+    /*  2 */ { 2, s_2_2, -1, 1, 0 },
+    /*  3 */ { 3, s_2_3, 2, 1, 0 },
+    /*  4 */ { 3, s_2_4, 2, 1, 0 },
+    /*  5 */ { 4, s_2_5, 4, 1, 0 },
+    /*  6 */ { 3, s_2_6, -1, 1, 0 },
+    /*  7 */ { 3, s_2_7, -1, 1, 0 },
+    /*  8 */ { 4, s_2_8, 7, 1, 0 },
+    /*  9 */ { 4, s_2_9, 7, 1, 0 },
+    /* 10 */ { 7, s_2_10, 9, 1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'k' };
+    static constexpr char32_t s_1[] = { 'e', 'r' };
+};
+
+template <typename symbol>
+class norwegian_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef norwegian_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 28 */
+        {   int c_test = c; /* test, line 30 */
+            {   int ret = hop(c, 0, l, 3); /* hop, line 30 */
+                if (ret < 0) return false;
+                c = ret;
+            }
+            I_x = c; /* setmark x, line 30 */
+            c = c_test;
+        }
+        if (out_grouping(data::g_v, 97, 248, 1) < 0) return false; /* goto */ /* grouping v, line 31 */
+        {    /* gopast */ /* non v, line 31 */
+            int ret = in_grouping(data::g_v, 97, 248, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p1 = c; /* setmark p1, line 31 */
+         /* try, line 32 */
+        if (!(I_p1 < I_x)) goto lab0; /* $p1 < <integer expression>, line 32 */
+        I_p1 = I_x; /* $p1 = <integer expression>, line 32 */
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_main_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 38 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 38 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 38 */
+            if (c <= lb || p[c - 1] >> 5 != 3 || !((1851426 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 38 */
+            among_var = find_among_b(data::a_0); /* substring, line 38 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 38 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 44 */
+                break;
+            case 2:
+                {   int m2 = l - c; (void)m2; /* or, line 46 */
+                    if (in_grouping_b(data::g_s_ending, 98, 122, 0)) goto lab1; /* grouping s_ending, line 46 */
+                    goto lab0;
+                lab1:
+                    c = l - m2;
+                    if (!eq_s_b(data::s_0)) return false; /* literal, line 46 */
+                    if (out_grouping_b(data::g_v, 97, 248, 0)) return false; /* non v, line 46 */
+                }
+            lab0:
+                slice_del(); /* delete, line 46 */
+                break;
+            case 3:
+                slice_from(data::s_1); /* <-, line 48 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_consonant_pair() {
+        {   int m_test = l - c; /* test, line 53 */
+            {   int mlimit; /* setlimit, line 54 */
+                int m1 = l - c; (void)m1;
+                if (c < I_p1) return false;
+                c = I_p1; /* tomark, line 54 */
+                mlimit = lb; lb = c;
+                c = l - m1;
+                ket = c; /* [, line 54 */
+                if (c - 1 <= lb || p[c - 1] != 116) { lb = mlimit; return false; } /* substring, line 54 */
+                if (!find_among_b(data::a_1)) { lb = mlimit; return false; } /* substring, line 54 */
+                bra = c; /* ], line 54 */
+                lb = mlimit;
+            }
+            c = l - m_test;
+        }
+        {   int ret = hop(c, lb, l, -1); /* next, line 59 */
+            if (ret < 0) return false;
+            c = ret;
+        }
+        bra = c; /* ], line 59 */
+        slice_del(); /* delete, line 59 */
+        return true;
+    }
+
+  private:
+    bool r_other_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 63 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 63 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 63 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4718720 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 63 */
+            among_var = find_among_b(data::a_2); /* substring, line 63 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 63 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 67 */
+                break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 74 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 74 */
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 75 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 76 */
+            if (!r_main_suffix()) goto lab1; /* call main_suffix, line 76 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 77 */
+            if (!r_consonant_pair()) goto lab2; /* call consonant_pair, line 77 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 78 */
+            if (!r_other_suffix()) goto lab3; /* call other_suffix, line 78 */
+        lab3:
+            c = l - m4;
+        }
+        c = lb;
+        return true;
+    }
+
+  private:
+    int I_x = 0;
+    int I_p1 = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,843 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_PORTER_STEMMER_HPP
+#define SNOWBALL_PORTER_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct porter_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1 };
+    static constexpr unsigned char g_v_WXY[] = { 1, 17, 65, 208, 1 };
+};
+
+template <bool utf8> struct porter_stemmer_data;
+
+template <>
+struct porter_stemmer_data<true> : porter_stemmer_groupings {
+    static constexpr unsigned char s_0_0[1] = { 's' };
+    static constexpr unsigned char s_0_1[3] = { 'i', 'e', 's' };
+    static constexpr unsigned char s_0_2[4] = { 's', 's', 'e', 's' };
+    static constexpr unsigned char s_0_3[2] = { 's', 's' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 3, 0 },
+    /*  1 */ { 3, s_0_1, 0, 2, 0 },
+    /*  2 */ { 4, s_0_2, 0, 1, 0 },
+    /*  3 */ { 2, s_0_3, 0, -1, 0 }
+    };
+
+    static constexpr unsigned char s_1_1[2] = { 'b', 'b' };
+    static constexpr unsigned char s_1_2[2] = { 'd', 'd' };
+    static constexpr unsigned char s_1_3[2] = { 'f', 'f' };
+    static constexpr unsigned char s_1_4[2] = { 'g', 'g' };
+    static constexpr unsigned char s_1_5[2] = { 'b', 'l' };
+    static constexpr unsigned char s_1_6[2] = { 'm', 'm' };
+    static constexpr unsigned char s_1_7[2] = { 'n', 'n' };
+    static constexpr unsigned char s_1_8[2] = { 'p', 'p' };
+    static constexpr unsigned char s_1_9[2] = { 'r', 'r' };
+    static constexpr unsigned char s_1_10[2] = { 'a', 't' };
+    static constexpr unsigned char s_1_11[2] = { 't', 't' };
+    static constexpr unsigned char s_1_12[2] = { 'i', 'z' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_1_1, 0, 2, 0 },
+    /*  2 */ { 2, s_1_2, 0, 2, 0 },
+    /*  3 */ { 2, s_1_3, 0, 2, 0 },
+    /*  4 */ { 2, s_1_4, 0, 2, 0 },
+    /*  5 */ { 2, s_1_5, 0, 1, 0 },
+    /*  6 */ { 2, s_1_6, 0, 2, 0 },
+    /*  7 */ { 2, s_1_7, 0, 2, 0 },
+    /*  8 */ { 2, s_1_8, 0, 2, 0 },
+    /*  9 */ { 2, s_1_9, 0, 2, 0 },
+    /* 10 */ { 2, s_1_10, 0, 1, 0 },
+    /* 11 */ { 2, s_1_11, 0, 2, 0 },
+    /* 12 */ { 2, s_1_12, 0, 1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'e', 'd' };
+    static constexpr unsigned char s_2_1[3] = { 'e', 'e', 'd' };
+    static constexpr unsigned char s_2_2[3] = { 'i', 'n', 'g' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 2, 0 },
+    /*  1 */ { 3, s_2_1, 0, 1, 0 },
+    /*  2 */ { 3, s_2_2, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[4] = { 'a', 'n', 'c', 'i' };
+    static constexpr unsigned char s_3_1[4] = { 'e', 'n', 'c', 'i' };
+    static constexpr unsigned char s_3_2[4] = { 'a', 'b', 'l', 'i' };
+    static constexpr unsigned char s_3_3[3] = { 'e', 'l', 'i' };
+    static constexpr unsigned char s_3_4[4] = { 'a', 'l', 'l', 'i' };
+    static constexpr unsigned char s_3_5[5] = { 'o', 'u', 's', 'l', 'i' };
+    static constexpr unsigned char s_3_6[5] = { 'e', 'n', 't', 'l', 'i' };
+    static constexpr unsigned char s_3_7[5] = { 'a', 'l', 'i', 't', 'i' };
+    static constexpr unsigned char s_3_8[6] = { 'b', 'i', 'l', 'i', 't', 'i' };
+    static constexpr unsigned char s_3_9[5] = { 'i', 'v', 'i', 't', 'i' };
+    static constexpr unsigned char s_3_10[6] = { 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr unsigned char s_3_11[7] = { 'a', 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr unsigned char s_3_12[5] = { 'a', 'l', 'i', 's', 'm' };
+    static constexpr unsigned char s_3_13[5] = { 'a', 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_3_14[7] = { 'i', 'z', 'a', 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_3_15[4] = { 'i', 'z', 'e', 'r' };
+    static constexpr unsigned char s_3_16[4] = { 'a', 't', 'o', 'r' };
+    static constexpr unsigned char s_3_17[7] = { 'i', 'v', 'e', 'n', 'e', 's', 's' };
+    static constexpr unsigned char s_3_18[7] = { 'f', 'u', 'l', 'n', 'e', 's', 's' };
+    static constexpr unsigned char s_3_19[7] = { 'o', 'u', 's', 'n', 'e', 's', 's' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 3, 0 },
+    /*  1 */ { 4, s_3_1, -1, 2, 0 },
+    /*  2 */ { 4, s_3_2, -1, 4, 0 },
+    /*  3 */ { 3, s_3_3, -1, 6, 0 },
+    /*  4 */ { 4, s_3_4, -1, 9, 0 },
+    /*  5 */ { 5, s_3_5, -1, 12, 0 },
+    /*  6 */ { 5, s_3_6, -1, 5, 0 },
+    /*  7 */ { 5, s_3_7, -1, 10, 0 },
+    /*  8 */ { 6, s_3_8, -1, 14, 0 },
+    /*  9 */ { 5, s_3_9, -1, 13, 0 },
+    /* 10 */ { 6, s_3_10, -1, 1, 0 },
+    /* 11 */ { 7, s_3_11, 10, 8, 0 },
+    /* 12 */ { 5, s_3_12, -1, 10, 0 },
+    /* 13 */ { 5, s_3_13, -1, 8, 0 },
+    /* 14 */ { 7, s_3_14, 13, 7, 0 },
+    /* 15 */ { 4, s_3_15, -1, 7, 0 },
+    /* 16 */ { 4, s_3_16, -1, 8, 0 },
+    /* 17 */ { 7, s_3_17, -1, 13, 0 },
+    /* 18 */ { 7, s_3_18, -1, 11, 0 },
+    /* 19 */ { 7, s_3_19, -1, 12, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[5] = { 'i', 'c', 'a', 't', 'e' };
+    static constexpr unsigned char s_4_1[5] = { 'a', 't', 'i', 'v', 'e' };
+    static constexpr unsigned char s_4_2[5] = { 'a', 'l', 'i', 'z', 'e' };
+    static constexpr unsigned char s_4_3[5] = { 'i', 'c', 'i', 't', 'i' };
+    static constexpr unsigned char s_4_4[4] = { 'i', 'c', 'a', 'l' };
+    static constexpr unsigned char s_4_5[3] = { 'f', 'u', 'l' };
+    static constexpr unsigned char s_4_6[4] = { 'n', 'e', 's', 's' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 5, s_4_0, -1, 2, 0 },
+    /*  1 */ { 5, s_4_1, -1, 3, 0 },
+    /*  2 */ { 5, s_4_2, -1, 1, 0 },
+    /*  3 */ { 5, s_4_3, -1, 2, 0 },
+    /*  4 */ { 4, s_4_4, -1, 2, 0 },
+    /*  5 */ { 3, s_4_5, -1, 3, 0 },
+    /*  6 */ { 4, s_4_6, -1, 3, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_5_1[4] = { 'a', 'n', 'c', 'e' };
+    static constexpr unsigned char s_5_2[4] = { 'e', 'n', 'c', 'e' };
+    static constexpr unsigned char s_5_3[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_5_4[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr unsigned char s_5_5[3] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_5_6[3] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_5_7[3] = { 'i', 'z', 'e' };
+    static constexpr unsigned char s_5_8[3] = { 'i', 't', 'i' };
+    static constexpr unsigned char s_5_9[2] = { 'a', 'l' };
+    static constexpr unsigned char s_5_10[3] = { 'i', 's', 'm' };
+    static constexpr unsigned char s_5_11[3] = { 'i', 'o', 'n' };
+    static constexpr unsigned char s_5_12[2] = { 'e', 'r' };
+    static constexpr unsigned char s_5_13[3] = { 'o', 'u', 's' };
+    static constexpr unsigned char s_5_14[3] = { 'a', 'n', 't' };
+    static constexpr unsigned char s_5_15[3] = { 'e', 'n', 't' };
+    static constexpr unsigned char s_5_16[4] = { 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_5_17[5] = { 'e', 'm', 'e', 'n', 't' };
+    static constexpr unsigned char s_5_18[2] = { 'o', 'u' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 4, s_5_2, -1, 1, 0 },
+    /*  3 */ { 4, s_5_3, -1, 1, 0 },
+    /*  4 */ { 4, s_5_4, -1, 1, 0 },
+    /*  5 */ { 3, s_5_5, -1, 1, 0 },
+    /*  6 */ { 3, s_5_6, -1, 1, 0 },
+    /*  7 */ { 3, s_5_7, -1, 1, 0 },
+    /*  8 */ { 3, s_5_8, -1, 1, 0 },
+    /*  9 */ { 2, s_5_9, -1, 1, 0 },
+    /* 10 */ { 3, s_5_10, -1, 1, 0 },
+    /* 11 */ { 3, s_5_11, -1, 2, 0 },
+    /* 12 */ { 2, s_5_12, -1, 1, 0 },
+    /* 13 */ { 3, s_5_13, -1, 1, 0 },
+    /* 14 */ { 3, s_5_14, -1, 1, 0 },
+    /* 15 */ { 3, s_5_15, -1, 1, 0 },
+    /* 16 */ { 4, s_5_16, 15, 1, 0 },
+    /* 17 */ { 5, s_5_17, 16, 1, 0 },
+    /* 18 */ { 2, s_5_18, -1, 1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 's', 's' };
+    static constexpr unsigned char s_1[] = { 'i' };
+    static constexpr unsigned char s_2[] = { 'e', 'e' };
+    static constexpr unsigned char s_3[] = { 'e' };
+    static constexpr unsigned char s_4[] = { 'e' };
+    static constexpr unsigned char s_5[] = { 'y' };
+    static constexpr unsigned char s_6[] = { 'Y' };
+    static constexpr unsigned char s_7[] = { 'i' };
+    static constexpr unsigned char s_8[] = { 't', 'i', 'o', 'n' };
+    static constexpr unsigned char s_9[] = { 'e', 'n', 'c', 'e' };
+    static constexpr unsigned char s_10[] = { 'a', 'n', 'c', 'e' };
+    static constexpr unsigned char s_11[] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_12[] = { 'e', 'n', 't' };
+    static constexpr unsigned char s_13[] = { 'e' };
+    static constexpr unsigned char s_14[] = { 'i', 'z', 'e' };
+    static constexpr unsigned char s_15[] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_16[] = { 'a', 'l' };
+    static constexpr unsigned char s_17[] = { 'a', 'l' };
+    static constexpr unsigned char s_18[] = { 'f', 'u', 'l' };
+    static constexpr unsigned char s_19[] = { 'o', 'u', 's' };
+    static constexpr unsigned char s_20[] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_21[] = { 'b', 'l', 'e' };
+    static constexpr unsigned char s_22[] = { 'a', 'l' };
+    static constexpr unsigned char s_23[] = { 'i', 'c' };
+    static constexpr unsigned char s_24[] = { 's' };
+    static constexpr unsigned char s_25[] = { 't' };
+    static constexpr unsigned char s_26[] = { 'e' };
+    static constexpr unsigned char s_27[] = { 'l' };
+    static constexpr unsigned char s_28[] = { 'l' };
+    static constexpr unsigned char s_29[] = { 'y' };
+    static constexpr unsigned char s_30[] = { 'Y' };
+    static constexpr unsigned char s_31[] = { 'y' };
+    static constexpr unsigned char s_32[] = { 'Y' };
+    static constexpr unsigned char s_33[] = { 'Y' };
+    static constexpr unsigned char s_34[] = { 'y' };
+};
+
+template <>
+struct porter_stemmer_data<false> : porter_stemmer_groupings {
+    static constexpr char32_t s_0_0[1] = { 's' };
+    static constexpr char32_t s_0_1[3] = { 'i', 'e', 's' };
+    static constexpr char32_t s_0_2[4] = { 's', 's', 'e', 's' };
+    static constexpr char32_t s_0_3[2] = { 's', 's' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 3, 0 },
+    /*  1 */ { 3, s_0_1, 0, 2, 0 },
+    /*  2 */ { 4, s_0_2, 0, 1, 0 },
+    /*  3 */ { 2, s_0_3, 0, -1, 0 }
+    };
+
+    static constexpr char32_t s_1_1[2] = { 'b', 'b' };
+    static constexpr char32_t s_1_2[2] = { 'd', 'd' };
+    static constexpr char32_t s_1_3[2] = { 'f', 'f' };
+    static constexpr char32_t s_1_4[2] = { 'g', 'g' };
+    static constexpr char32_t s_1_5[2] = { 'b', 'l' };
+    static constexpr char32_t s_1_6[2] = { 'm', 'm' };
+    static constexpr char32_t s_1_7[2] = { 'n', 'n' };
+    static constexpr char32_t s_1_8[2] = { 'p', 'p' };
+    static constexpr char32_t s_1_9[2] = { 'r', 'r' };
+    static constexpr char32_t s_1_10[2] = { 'a', 't' };
+    static constexpr char32_t s_1_11[2] = { 't', 't' };
+    static constexpr char32_t s_1_12[2] = { 'i', 'z' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_1_1, 0, 2, 0 },
+    /*  2 */ { 2, s_1_2, 0, 2, 0 },
+    /*  3 */ { 2, s_1_3, 0, 2, 0 },
+    /*  4 */ { 2, s_1_4, 0, 2, 0 },
+    /*  5 */ { 2, s_1_5, 0, 1, 0 },
+    /*  6 */ { 2, s_1_6, 0, 2, 0 },
+    /*  7 */ { 2, s_1_7, 0, 2, 0 },
+    /*  8 */ { 2, s_1_8, 0, 2, 0 },
+    /*  9 */ { 2, s_1_9, 0, 2, 0 },
+    /* 10 */ { 2, s_1_10, 0, 1, 0 },
+    /* 11 */ { 2, s_1_11, 0, 2, 0 },
+    /* 12 */ { 2, s_1_12, 0, 1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'e', 'd' };
+    static constexpr char32_t s_2_1[3] = { 'e', 'e', 'd' };
+    static constexpr char32_t s_2_2[3] = { 'i', 'n', 'g' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 2, 0 },
+    /*  1 */ { 3, s_2_1, 0, 1, 0 },
+    /*  2 */ { 3, s_2_2, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_3_0[4] = { 'a', 'n', 'c', 'i' };
+    static constexpr char32_t s_3_1[4] = { 'e', 'n', 'c', 'i' };
+    static constexpr char32_t s_3_2[4] = { 'a', 'b', 'l', 'i' };
+    static constexpr char32_t s_3_3[3] = { 'e', 'l', 'i' };
+    static constexpr char32_t s_3_4[4] = { 'a', 'l', 'l', 'i' };
+    static constexpr char32_t s_3_5[5] = { 'o', 'u', 's', 'l', 'i' };
+    static constexpr char32_t s_3_6[5] = { 'e', 'n', 't', 'l', 'i' };
+    static constexpr char32_t s_3_7[5] = { 'a', 'l', 'i', 't', 'i' };
+    static constexpr char32_t s_3_8[6] = { 'b', 'i', 'l', 'i', 't', 'i' };
+    static constexpr char32_t s_3_9[5] = { 'i', 'v', 'i', 't', 'i' };
+    static constexpr char32_t s_3_10[6] = { 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr char32_t s_3_11[7] = { 'a', 't', 'i', 'o', 'n', 'a', 'l' };
+    static constexpr char32_t s_3_12[5] = { 'a', 'l', 'i', 's', 'm' };
+    static constexpr char32_t s_3_13[5] = { 'a', 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_3_14[7] = { 'i', 'z', 'a', 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_3_15[4] = { 'i', 'z', 'e', 'r' };
+    static constexpr char32_t s_3_16[4] = { 'a', 't', 'o', 'r' };
+    static constexpr char32_t s_3_17[7] = { 'i', 'v', 'e', 'n', 'e', 's', 's' };
+    static constexpr char32_t s_3_18[7] = { 'f', 'u', 'l', 'n', 'e', 's', 's' };
+    static constexpr char32_t s_3_19[7] = { 'o', 'u', 's', 'n', 'e', 's', 's' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 3, 0 },
+    /*  1 */ { 4, s_3_1, -1, 2, 0 },
+    /*  2 */ { 4, s_3_2, -1, 4, 0 },
+    /*  3 */ { 3, s_3_3, -1, 6, 0 },
+    /*  4 */ { 4, s_3_4, -1, 9, 0 },
+    /*  5 */ { 5, s_3_5, -1, 12, 0 },
+    /*  6 */ { 5, s_3_6, -1, 5, 0 },
+    /*  7 */ { 5, s_3_7, -1, 10, 0 },
+    /*  8 */ { 6, s_3_8, -1, 14, 0 },
+    /*  9 */ { 5, s_3_9, -1, 13, 0 },
+    /* 10 */ { 6, s_3_10, -1, 1, 0 },
+    /* 11 */ { 7, s_3_11, 10, 8, 0 },
+    /* 12 */ { 5, s_3_12, -1, 10, 0 },
+    /* 13 */ { 5, s_3_13, -1, 8, 0 },
+    /* 14 */ { 7, s_3_14, 13, 7, 0 },
+    /* 15 */ { 4, s_3_15, -1, 7, 0 },
+    /* 16 */ { 4, s_3_16, -1, 8, 0 },
+    /* 17 */ { 7, s_3_17, -1, 13, 0 },
+    /* 18 */ { 7, s_3_18, -1, 11, 0 },
+    /* 19 */ { 7, s_3_19, -1, 12, 0 }
+    };
+
+    static constexpr char32_t s_4_0[5] = { 'i', 'c', 'a', 't', 'e' };
+    static constexpr char32_t s_4_1[5] = { 'a', 't', 'i', 'v', 'e' };
+    static constexpr char32_t s_4_2[5] = { 'a', 'l', 'i', 'z', 'e' };
+    static constexpr char32_t s_4_3[5] = { 'i', 'c', 'i', 't', 'i' };
+    static constexpr char32_t s_4_4[4] = { 'i', 'c', 'a', 'l' };
+    static constexpr char32_t s_4_5[3] = { 'f', 'u', 'l' };
+    static constexpr char32_t s_4_6[4] = { 'n', 'e', 's', 's' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 5, s_4_0, -1, 2, 0 },
+    /*  1 */ { 5, s_4_1, -1, 3, 0 },
+    /*  2 */ { 5, s_4_2, -1, 1, 0 },
+    /*  3 */ { 5, s_4_3, -1, 2, 0 },
+    /*  4 */ { 4, s_4_4, -1, 2, 0 },
+    /*  5 */ { 3, s_4_5, -1, 3, 0 },
+    /*  6 */ { 4, s_4_6, -1, 3, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_5_1[4] = { 'a', 'n', 'c', 'e' };
+    static constexpr char32_t s_5_2[4] = { 'e', 'n', 'c', 'e' };
+    static constexpr char32_t s_5_3[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_5_4[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr char32_t s_5_5[3] = { 'a', 't', 'e' };
+    static constexpr char32_t s_5_6[3] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_5_7[3] = { 'i', 'z', 'e' };
+    static constexpr char32_t s_5_8[3] = { 'i', 't', 'i' };
+    static constexpr char32_t s_5_9[2] = { 'a', 'l' };
+    static constexpr char32_t s_5_10[3] = { 'i', 's', 'm' };
+    static constexpr char32_t s_5_11[3] = { 'i', 'o', 'n' };
+    static constexpr char32_t s_5_12[2] = { 'e', 'r' };
+    static constexpr char32_t s_5_13[3] = { 'o', 'u', 's' };
+    static constexpr char32_t s_5_14[3] = { 'a', 'n', 't' };
+    static constexpr char32_t s_5_15[3] = { 'e', 'n', 't' };
+    static constexpr char32_t s_5_16[4] = { 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_5_17[5] = { 'e', 'm', 'e', 'n', 't' };
+    static constexpr char32_t s_5_18[2] = { 'o', 'u' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 4, s_5_2, -1, 1, 0 },
+    /*  3 */ { 4, s_5_3, -1, 1, 0 },
+    /*  4 */ { 4, s_5_4, -1, 1, 0 },
+    /*  5 */ { 3, s_5_5, -1, 1, 0 },
+    /*  6 */ { 3, s_5_6, -1, 1, 0 },
+    /*  7 */ { 3, s_5_7, -1, 1, 0 },
+    /*  8 */ { 3, s_5_8, -1, 1, 0 },
+    /*  9 */ { 2, s_5_9, -1, 1, 0 },
+    /* 10 */ { 3, s_5_10, -1, 1, 0 },
+    /* 11 */ { 3, s_5_11, -1, 2, 0 },
+    /* 12 */ { 2, s_5_12, -1, 1, 0 },
+    /* 13 */ { 3, s_5_13, -1, 1, 0 },
+    /* 14 */ { 3, s_5_14, -1, 1, 0 },
+    /* 15 */ { 3, s_5_15, -1, 1, 0 },
+    /* 16 */ { 4, s_5_16, 15, 1, 0 },
+    /* 17 */ { 5, s_5_17, 16, 1, 0 },
+    /* 18 */ { 2, s_5_18, -1, 1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 's', 's' };
+    static constexpr char32_t s_1[] = { 'i' };
+    static constexpr char32_t s_2[] = { 'e', 'e' };
+    static constexpr char32_t s_3[] = { 'e' };
+    static constexpr char32_t s_4[] = { 'e' };
+    static constexpr char32_t s_5[] = { 'y' };
+    static constexpr char32_t s_6[] = { 'Y' };
+    static constexpr char32_t s_7[] = { 'i' };
+    static constexpr char32_t s_8[] = { 't', 'i', 'o', 'n' };
+    static constexpr char32_t s_9[] = { 'e', 'n', 'c', 'e' };
+    static constexpr char32_t s_10[] = { 'a', 'n', 'c', 'e' };
+    static constexpr char32_t s_11[] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_12[] = { 'e', 'n', 't' };
+    static constexpr char32_t s_13[] = { 'e' };
+    static constexpr char32_t s_14[] = { 'i', 'z', 'e' };
+    static constexpr char32_t s_15[] = { 'a', 't', 'e' };
+    static constexpr char32_t s_16[] = { 'a', 'l' };
+    static constexpr char32_t s_17[] = { 'a', 'l' };
+    static constexpr char32_t s_18[] = { 'f', 'u', 'l' };
+    static constexpr char32_t s_19[] = { 'o', 'u', 's' };
+    static constexpr char32_t s_20[] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_21[] = { 'b', 'l', 'e' };
+    static constexpr char32_t s_22[] = { 'a', 'l' };
+    static constexpr char32_t s_23[] = { 'i', 'c' };
+    static constexpr char32_t s_24[] = { 's' };
+    static constexpr char32_t s_25[] = { 't' };
+    static constexpr char32_t s_26[] = { 'e' };
+    static constexpr char32_t s_27[] = { 'l' };
+    static constexpr char32_t s_28[] = { 'l' };
+    static constexpr char32_t s_29[] = { 'y' };
+    static constexpr char32_t s_30[] = { 'Y' };
+    static constexpr char32_t s_31[] = { 'y' };
+    static constexpr char32_t s_32[] = { 'Y' };
+    static constexpr char32_t s_33[] = { 'Y' };
+    static constexpr char32_t s_34[] = { 'y' };
+};
+
+template <typename symbol>
+class porter_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef porter_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_shortv() {
+        if (out_grouping_b(data::g_v_WXY, 89, 121, 0)) return false; /* non v_WXY, line 19 */
+        if (in_grouping_b(data::g_v, 97, 121, 0)) return false; /* grouping v, line 19 */
+        if (out_grouping_b(data::g_v, 97, 121, 0)) return false; /* non v, line 19 */
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 21 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 22 */
+        return true;
+    }
+
+  private:
+    bool r_Step_1a() {
+        int among_var;
+        ket = c; /* [, line 25 */
+        if (c <= lb || p[c - 1] != 115) return false; /* substring, line 25 */
+        among_var = find_among_b(data::a_0); /* substring, line 25 */
+        if (!among_var) return false;
+        bra = c; /* ], line 25 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_0); /* <-, line 26 */
+                break;
+            case 2:
+                slice_from(data::s_1); /* <-, line 27 */
+                break;
+            case 3:
+                slice_del(); /* delete, line 29 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_1b() {
+        int among_var;
+        ket = c; /* [, line 34 */
+        if (c - 1 <= lb || (p[c - 1] != 100 && p[c - 1] != 103)) return false; /* substring, line 34 */
+        among_var = find_among_b(data::a_2); /* substring, line 34 */
+        if (!among_var) return false;
+        bra = c; /* ], line 34 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_R1()) return false; /* call R1, line 35 */
+                slice_from(data::s_2); /* <-, line 35 */
+                break;
+            case 2:
+                {   int m_test = l - c; /* test, line 38 */
+                    {    /* gopast */ /* grouping v, line 38 */
+                        int ret = out_grouping_b(data::g_v, 97, 121, 1);
+                        if (ret < 0) return false;
+                        c -= ret;
+                    }
+                    c = l - m_test;
+                }
+                slice_del(); /* delete, line 38 */
+                {   int m_test = l - c; /* test, line 39 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((68514004 >> (p[c - 1] & 0x1f)) & 1)) among_var = 3; else /* substring, line 39 */
+                    among_var = find_among_b(data::a_1); /* substring, line 39 */
+                    if (!among_var) return false;
+                    c = l - m_test;
+                }
+                switch(among_var) {
+                    case 0: return false;
+                    case 1:
+                        {   int c_keep = c; /* <+, line 41 */
+                            insert(c, c, data::s_3);
+                            c = c_keep;
+                        }
+                        break;
+                    case 2:
+                        ket = c; /* [, line 44 */
+                        {   int ret = hop(c, lb, l, -1); /* next, line 44 */
+                            if (ret < 0) return false;
+                            c = ret;
+                        }
+                        bra = c; /* ], line 44 */
+                        slice_del(); /* delete, line 44 */
+                        break;
+                    case 3:
+                        if (c != I_p1) return false; /* atmark, line 45 */
+                        {   int m_test = l - c; /* test, line 45 */
+                            if (!r_shortv()) return false; /* call shortv, line 45 */
+                            c = l - m_test;
+                        }
+                        {   int c_keep = c; /* <+, line 45 */
+                            insert(c, c, data::s_4);
+                            c = c_keep;
+                        }
+                        break;
+                }
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_1c() {
+        ket = c; /* [, line 52 */
+        {   int m1 = l - c; (void)m1; /* or, line 52 */
+            if (!eq_s_b(data::s_5)) goto lab1; /* literal, line 52 */
+            goto lab0;
+        lab1:
+            c = l - m1;
+            if (!eq_s_b(data::s_6)) return false; /* literal, line 52 */
+        }
+    lab0:
+        bra = c; /* ], line 52 */
+        {    /* gopast */ /* grouping v, line 53 */
+            int ret = out_grouping_b(data::g_v, 97, 121, 1);
+            if (ret < 0) return false;
+            c -= ret;
+        }
+        slice_from(data::s_7); /* <-, line 54 */
+        return true;
+    }
+
+  private:
+    bool r_Step_2() {
+        int among_var;
+        ket = c; /* [, line 58 */
+        if (c - 2 <= lb || p[c - 1] >> 5 != 3 || !((815616 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 58 */
+        among_var = find_among_b(data::a_3); /* substring, line 58 */
+        if (!among_var) return false;
+        bra = c; /* ], line 58 */
+        if (!r_R1()) return false; /* call R1, line 58 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_8); /* <-, line 59 */
+                break;
+            case 2:
+                slice_from(data::s_9); /* <-, line 60 */
+                break;
+            case 3:
+                slice_from(data::s_10); /* <-, line 61 */
+                break;
+            case 4:
+                slice_from(data::s_11); /* <-, line 62 */
+                break;
+            case 5:
+                slice_from(data::s_12); /* <-, line 63 */
+                break;
+            case 6:
+                slice_from(data::s_13); /* <-, line 64 */
+                break;
+            case 7:
+                slice_from(data::s_14); /* <-, line 66 */
+                break;
+            case 8:
+                slice_from(data::s_15); /* <-, line 68 */
+                break;
+            case 9:
+                slice_from(data::s_16); /* <-, line 69 */
+                break;
+            case 10:
+                slice_from(data::s_17); /* <-, line 71 */
+                break;
+            case 11:
+                slice_from(data::s_18); /* <-, line 72 */
+                break;
+            case 12:
+                slice_from(data::s_19); /* <-, line 74 */
+                break;
+            case 13:
+                slice_from(data::s_20); /* <-, line 76 */
+                break;
+            case 14:
+                slice_from(data::s_21); /* <-, line 77 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_3() {
+        int among_var;
+        ket = c; /* [, line 82 */
+        if (c - 2 <= lb || p[c - 1] >> 5 != 3 || !((528928 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 82 */
+        among_var = find_among_b(data::a_4); /* substring, line 82 */
+        if (!among_var) return false;
+        bra = c; /* ], line 82 */
+        if (!r_R1()) return false; /* call R1, line 82 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_22); /* <-, line 83 */
+                break;
+            case 2:
+                slice_from(data::s_23); /* <-, line 85 */
+                break;
+            case 3:
+                slice_del(); /* delete, line 87 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_4() {
+        int among_var;
+        ket = c; /* [, line 92 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((3961384 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 92 */
+        among_var = find_among_b(data::a_5); /* substring, line 92 */
+        if (!among_var) return false;
+        bra = c; /* ], line 92 */
+        if (!r_R2()) return false; /* call R2, line 92 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 95 */
+                break;
+            case 2:
+                {   int m1 = l - c; (void)m1; /* or, line 96 */
+                    if (!eq_s_b(data::s_24)) goto lab1; /* literal, line 96 */
+                    goto lab0;
+                lab1:
+                    c = l - m1;
+                    if (!eq_s_b(data::s_25)) return false; /* literal, line 96 */
+                }
+            lab0:
+                slice_del(); /* delete, line 96 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_Step_5a() {
+        ket = c; /* [, line 101 */
+        if (!eq_s_b(data::s_26)) return false; /* literal, line 101 */
+        bra = c; /* ], line 101 */
+        {   int m1 = l - c; (void)m1; /* or, line 102 */
+            if (!r_R2()) goto lab1; /* call R2, line 102 */
+            goto lab0;
+        lab1:
+            c = l - m1;
+            if (!r_R1()) return false; /* call R1, line 102 */
+            {   int m2 = l - c; (void)m2; /* not, line 102 */
+                if (!r_shortv()) goto lab2; /* call shortv, line 102 */
+                return false;
+            lab2:
+                c = l - m2;
+            }
+        }
+    lab0:
+        slice_del(); /* delete, line 103 */
+        return true;
+    }
+
+  private:
+    bool r_Step_5b() {
+        ket = c; /* [, line 107 */
+        if (!eq_s_b(data::s_27)) return false; /* literal, line 107 */
+        bra = c; /* ], line 107 */
+        if (!r_R2()) return false; /* call R2, line 108 */
+        if (!eq_s_b(data::s_28)) return false; /* literal, line 108 */
+        slice_del(); /* delete, line 109 */
+        return true;
+    }
+
+  public:
+    bool stem() {
+        B_Y_found = false; /* unset Y_found, line 115 */
+        {   int c1 = c; /* do, line 116 */
+            bra = c; /* [, line 116 */
+            if (!eq_s(data::s_29)) goto lab0; /* literal, line 116 */
+            ket = c; /* ], line 116 */
+            slice_from(data::s_30); /* <-, line 116 */
+            B_Y_found = true; /* set Y_found, line 116 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 117 */
+            while(1) { /* repeat, line 117 */
+                int c3 = c;
+                while(1) { /* goto, line 117 */
+                    int c4 = c;
+                    if (in_grouping(data::g_v, 97, 121, 0)) goto lab3; /* grouping v, line 117 */
+                    bra = c; /* [, line 117 */
+                    if (!eq_s(data::s_31)) goto lab3; /* literal, line 117 */
+                    ket = c; /* ], line 117 */
+                    c = c4;
+                    break;
+                lab3:
+                    c = c4;
+                    {   int ret = hop(c, 0, l, 1); /* goto, line 117 */
+                        if (ret < 0) goto lab2;
+                        c = ret;
+                    }
+                }
+                slice_from(data::s_32); /* <-, line 117 */
+                B_Y_found = true; /* set Y_found, line 117 */
+                continue;
+            lab2:
+                c = c3;
+                break;
+            }
+            c = c2;
+        }
+        I_p1 = l; /* $p1 = <integer expression>, line 119 */
+        I_p2 = l; /* $p2 = <integer expression>, line 120 */
+        {   int c5 = c; /* do, line 121 */
+            {    /* gopast */ /* grouping v, line 122 */
+                int ret = out_grouping(data::g_v, 97, 121, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 122 */
+                int ret = in_grouping(data::g_v, 97, 121, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 122 */
+            {    /* gopast */ /* grouping v, line 123 */
+                int ret = out_grouping(data::g_v, 97, 121, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 123 */
+                int ret = in_grouping(data::g_v, 97, 121, 1);
+                if (ret < 0) goto lab4;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 123 */
+        lab4:
+            c = c5;
+        }
+        lb = c; c = l; /* backwards, line 126 */
+
+        {   int m6 = l - c; (void)m6; /* do, line 127 */
+            if (!r_Step_1a()) goto lab5; /* call Step_1a, line 127 */
+        lab5:
+            c = l - m6;
+        }
+        {   int m7 = l - c; (void)m7; /* do, line 128 */
+            if (!r_Step_1b()) goto lab6; /* call Step_1b, line 128 */
+        lab6:
+            c = l - m7;
+        }
+        {   int m8 = l - c; (void)m8; /* do, line 129 */
+            if (!r_Step_1c()) goto lab7; /* call Step_1c, line 129 */
+        lab7:
+            c = l - m8;
+        }
+        {   int m9 = l - c; (void)m9; /* do, line 130 */
+            if (!r_Step_2()) goto lab8; /* call Step_2, line 130 */
+        lab8:
+            c = l - m9;
+        }
+        {   int m10 = l - c; (void)m10; /* do, line 131 */
+            if (!r_Step_3()) goto lab9; /* call Step_3, line 131 */
+        lab9:
+            c = l - m10;
+        }
+        {   int m11 = l - c; (void)m11; /* do, line 132 */
+            if (!r_Step_4()) goto lab10; /* call Step_4, line 132 */
+        lab10:
+            c = l - m11;
+        }
+        {   int m12 = l - c; (void)m12; /* do, line 133 */
+            if (!r_Step_5a()) goto lab11; /* call Step_5a, line 133 */
+        lab11:
+            c = l - m12;
+        }
+        {   int m13 = l - c; (void)m13; /* do, line 134 */
+            if (!r_Step_5b()) goto lab12; /* call Step_5b, line 134 */
+        lab12:
+            c = l - m13;
+        }
+        c = lb;
+        {   int c14 = c; /* do, line 137 */
+            if (!B_Y_found) goto lab13; /* Boolean test Y_found, line 137 */
+            while(1) { /* repeat, line 137 */
+                int c15 = c;
+                while(1) { /* goto, line 137 */
+                    int c16 = c;
+                    bra = c; /* [, line 137 */
+                    if (!eq_s(data::s_33)) goto lab15; /* literal, line 137 */
+                    ket = c; /* ], line 137 */
+                    c = c16;
+                    break;
+                lab15:
+                    c = c16;
+                    {   int ret = hop(c, 0, l, 1); /* goto, line 137 */
+                        if (ret < 0) goto lab14;
+                        c = ret;
+                    }
+                }
+                slice_from(data::s_34); /* <-, line 137 */
+                continue;
+            lab14:
+                c = c15;
+                break;
+            }
+        lab13:
+            c = c14;
+        }
+        return true;
+    }
+
+  private:
+    bool B_Y_found = false;
+    int I_p2 = 0;
+    int I_p1 = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,1345 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_PORTUGUESE_STEMMER_HPP
+#define SNOWBALL_PORTUGUESE_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct portuguese_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 19, 12, 2 };
+};
+
+template <bool utf8> struct portuguese_stemmer_data;
+
+template <>
+struct portuguese_stemmer_data<true> : portuguese_stemmer_groupings {
+    static constexpr unsigned char s_0_1[2] = { 0xC3, 0xA3 };
+    static constexpr unsigned char s_0_2[2] = { 0xC3, 0xB5 };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_0_1, 0, 1, 0 },
+    /*  2 */ { 2, s_0_2, 0, 2, 0 }
+    };
+
+    static constexpr unsigned char s_1_1[2] = { 'a', '~' };
+    static constexpr unsigned char s_1_2[2] = { 'o', '~' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_1_1, 0, 1, 0 },
+    /*  2 */ { 2, s_1_2, 0, 2, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_2_1[2] = { 'a', 'd' };
+    static constexpr unsigned char s_2_2[2] = { 'o', 's' };
+    static constexpr unsigned char s_2_3[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 },
+    /*  3 */ { 2, s_2_3, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[4] = { 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_3_1[4] = { 'a', 'v', 'e', 'l' };
+    static constexpr unsigned char s_3_2[5] = { 0xC3, 0xAD, 'v', 'e', 'l' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 },
+    /*  2 */ { 5, s_3_2, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_4_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_4_2[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 1, 0 },
+    /*  1 */ { 4, s_4_1, -1, 1, 0 },
+    /*  2 */ { 2, s_4_2, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[3] = { 'i', 'c', 'a' };
+    static constexpr unsigned char s_5_1[6] = { 0xC3, 0xA2, 'n', 'c', 'i', 'a' };
+    static constexpr unsigned char s_5_2[6] = { 0xC3, 0xAA, 'n', 'c', 'i', 'a' };
+    static constexpr unsigned char s_5_3[5] = { 'l', 'o', 'g', 'i', 'a' };
+    static constexpr unsigned char s_5_4[3] = { 'i', 'r', 'a' };
+    static constexpr unsigned char s_5_5[5] = { 'a', 'd', 'o', 'r', 'a' };
+    static constexpr unsigned char s_5_6[3] = { 'o', 's', 'a' };
+    static constexpr unsigned char s_5_7[4] = { 'i', 's', 't', 'a' };
+    static constexpr unsigned char s_5_8[3] = { 'i', 'v', 'a' };
+    static constexpr unsigned char s_5_9[3] = { 'e', 'z', 'a' };
+    static constexpr unsigned char s_5_10[5] = { 'i', 'd', 'a', 'd', 'e' };
+    static constexpr unsigned char s_5_11[4] = { 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_5_12[5] = { 'm', 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_5_13[6] = { 'a', 'm', 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_5_14[5] = { 0xC3, 0xA1, 'v', 'e', 'l' };
+    static constexpr unsigned char s_5_15[5] = { 0xC3, 0xAD, 'v', 'e', 'l' };
+    static constexpr unsigned char s_5_16[3] = { 'i', 'c', 'o' };
+    static constexpr unsigned char s_5_17[4] = { 'i', 's', 'm', 'o' };
+    static constexpr unsigned char s_5_18[3] = { 'o', 's', 'o' };
+    static constexpr unsigned char s_5_19[6] = { 'a', 'm', 'e', 'n', 't', 'o' };
+    static constexpr unsigned char s_5_20[6] = { 'i', 'm', 'e', 'n', 't', 'o' };
+    static constexpr unsigned char s_5_21[3] = { 'i', 'v', 'o' };
+    static constexpr unsigned char s_5_22[6] = { 'a', 0xC3, 0xA7, 'a', '~', 'o' };
+    static constexpr unsigned char s_5_23[6] = { 'u', 0xC3, 0xA7, 'a', '~', 'o' };
+    static constexpr unsigned char s_5_24[4] = { 'a', 'd', 'o', 'r' };
+    static constexpr unsigned char s_5_25[4] = { 'i', 'c', 'a', 's' };
+    static constexpr unsigned char s_5_26[7] = { 0xC3, 0xAA, 'n', 'c', 'i', 'a', 's' };
+    static constexpr unsigned char s_5_27[6] = { 'l', 'o', 'g', 'i', 'a', 's' };
+    static constexpr unsigned char s_5_28[4] = { 'i', 'r', 'a', 's' };
+    static constexpr unsigned char s_5_29[6] = { 'a', 'd', 'o', 'r', 'a', 's' };
+    static constexpr unsigned char s_5_30[4] = { 'o', 's', 'a', 's' };
+    static constexpr unsigned char s_5_31[5] = { 'i', 's', 't', 'a', 's' };
+    static constexpr unsigned char s_5_32[4] = { 'i', 'v', 'a', 's' };
+    static constexpr unsigned char s_5_33[4] = { 'e', 'z', 'a', 's' };
+    static constexpr unsigned char s_5_34[6] = { 'i', 'd', 'a', 'd', 'e', 's' };
+    static constexpr unsigned char s_5_35[6] = { 'a', 'd', 'o', 'r', 'e', 's' };
+    static constexpr unsigned char s_5_36[5] = { 'a', 'n', 't', 'e', 's' };
+    static constexpr unsigned char s_5_37[7] = { 'a', 0xC3, 0xA7, 'o', '~', 'e', 's' };
+    static constexpr unsigned char s_5_38[7] = { 'u', 0xC3, 0xA7, 'o', '~', 'e', 's' };
+    static constexpr unsigned char s_5_39[4] = { 'i', 'c', 'o', 's' };
+    static constexpr unsigned char s_5_40[5] = { 'i', 's', 'm', 'o', 's' };
+    static constexpr unsigned char s_5_41[4] = { 'o', 's', 'o', 's' };
+    static constexpr unsigned char s_5_42[7] = { 'a', 'm', 'e', 'n', 't', 'o', 's' };
+    static constexpr unsigned char s_5_43[7] = { 'i', 'm', 'e', 'n', 't', 'o', 's' };
+    static constexpr unsigned char s_5_44[4] = { 'i', 'v', 'o', 's' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 3, s_5_0, -1, 1, 0 },
+    /*  1 */ { 6, s_5_1, -1, 1, 0 },
+    /*  2 */ { 6, s_5_2, -1, 4, 0 },
+    /*  3 */ { 5, s_5_3, -1, 2, 0 },
+    /*  4 */ { 3, s_5_4, -1, 9, 0 },
+    /*  5 */ { 5, s_5_5, -1, 1, 0 },
+    /*  6 */ { 3, s_5_6, -1, 1, 0 },
+    /*  7 */ { 4, s_5_7, -1, 1, 0 },
+    /*  8 */ { 3, s_5_8, -1, 8, 0 },
+    /*  9 */ { 3, s_5_9, -1, 1, 0 },
+    /* 10 */ { 5, s_5_10, -1, 7, 0 },
+    /* 11 */ { 4, s_5_11, -1, 1, 0 },
+    /* 12 */ { 5, s_5_12, -1, 6, 0 },
+    /* 13 */ { 6, s_5_13, 12, 5, 0 },
+    /* 14 */ { 5, s_5_14, -1, 1, 0 },
+    /* 15 */ { 5, s_5_15, -1, 1, 0 },
+    /* 16 */ { 3, s_5_16, -1, 1, 0 },
+    /* 17 */ { 4, s_5_17, -1, 1, 0 },
+    /* 18 */ { 3, s_5_18, -1, 1, 0 },
+    /* 19 */ { 6, s_5_19, -1, 1, 0 },
+    /* 20 */ { 6, s_5_20, -1, 1, 0 },
+    /* 21 */ { 3, s_5_21, -1, 8, 0 },
+    /* 22 */ { 6, s_5_22, -1, 1, 0 },
+    /* 23 */ { 6, s_5_23, -1, 3, 0 },
+    /* 24 */ { 4, s_5_24, -1, 1, 0 },
+    /* 25 */ { 4, s_5_25, -1, 1, 0 },
+    /* 26 */ { 7, s_5_26, -1, 4, 0 },
+    /* 27 */ { 6, s_5_27, -1, 2, 0 },
+    /* 28 */ { 4, s_5_28, -1, 9, 0 },
+    /* 29 */ { 6, s_5_29, -1, 1, 0 },
+    /* 30 */ { 4, s_5_30, -1, 1, 0 },
+    /* 31 */ { 5, s_5_31, -1, 1, 0 },
+    /* 32 */ { 4, s_5_32, -1, 8, 0 },
+    /* 33 */ { 4, s_5_33, -1, 1, 0 },
+    /* 34 */ { 6, s_5_34, -1, 7, 0 },
+    /* 35 */ { 6, s_5_35, -1, 1, 0 },
+    /* 36 */ { 5, s_5_36, -1, 1, 0 },
+    /* 37 */ { 7, s_5_37, -1, 1, 0 },
+    /* 38 */ { 7, s_5_38, -1, 3, 0 },
+    /* 39 */ { 4, s_5_39, -1, 1, 0 },
+    /* 40 */ { 5, s_5_40, -1, 1, 0 },
+    /* 41 */ { 4, s_5_41, -1, 1, 0 },
+    /* 42 */ { 7, s_5_42, -1, 1, 0 },
+    /* 43 */ { 7, s_5_43, -1, 1, 0 },
+    /* 44 */ { 4, s_5_44, -1, 8, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[3] = { 'a', 'd', 'a' };
+    static constexpr unsigned char s_6_1[3] = { 'i', 'd', 'a' };
+    static constexpr unsigned char s_6_2[2] = { 'i', 'a' };
+    static constexpr unsigned char s_6_3[4] = { 'a', 'r', 'i', 'a' };
+    static constexpr unsigned char s_6_4[4] = { 'e', 'r', 'i', 'a' };
+    static constexpr unsigned char s_6_5[4] = { 'i', 'r', 'i', 'a' };
+    static constexpr unsigned char s_6_6[3] = { 'a', 'r', 'a' };
+    static constexpr unsigned char s_6_7[3] = { 'e', 'r', 'a' };
+    static constexpr unsigned char s_6_8[3] = { 'i', 'r', 'a' };
+    static constexpr unsigned char s_6_9[3] = { 'a', 'v', 'a' };
+    static constexpr unsigned char s_6_10[4] = { 'a', 's', 's', 'e' };
+    static constexpr unsigned char s_6_11[4] = { 'e', 's', 's', 'e' };
+    static constexpr unsigned char s_6_12[4] = { 'i', 's', 's', 'e' };
+    static constexpr unsigned char s_6_13[4] = { 'a', 's', 't', 'e' };
+    static constexpr unsigned char s_6_14[4] = { 'e', 's', 't', 'e' };
+    static constexpr unsigned char s_6_15[4] = { 'i', 's', 't', 'e' };
+    static constexpr unsigned char s_6_16[2] = { 'e', 'i' };
+    static constexpr unsigned char s_6_17[4] = { 'a', 'r', 'e', 'i' };
+    static constexpr unsigned char s_6_18[4] = { 'e', 'r', 'e', 'i' };
+    static constexpr unsigned char s_6_19[4] = { 'i', 'r', 'e', 'i' };
+    static constexpr unsigned char s_6_20[2] = { 'a', 'm' };
+    static constexpr unsigned char s_6_21[3] = { 'i', 'a', 'm' };
+    static constexpr unsigned char s_6_22[5] = { 'a', 'r', 'i', 'a', 'm' };
+    static constexpr unsigned char s_6_23[5] = { 'e', 'r', 'i', 'a', 'm' };
+    static constexpr unsigned char s_6_24[5] = { 'i', 'r', 'i', 'a', 'm' };
+    static constexpr unsigned char s_6_25[4] = { 'a', 'r', 'a', 'm' };
+    static constexpr unsigned char s_6_26[4] = { 'e', 'r', 'a', 'm' };
+    static constexpr unsigned char s_6_27[4] = { 'i', 'r', 'a', 'm' };
+    static constexpr unsigned char s_6_28[4] = { 'a', 'v', 'a', 'm' };
+    static constexpr unsigned char s_6_29[2] = { 'e', 'm' };
+    static constexpr unsigned char s_6_30[4] = { 'a', 'r', 'e', 'm' };
+    static constexpr unsigned char s_6_31[4] = { 'e', 'r', 'e', 'm' };
+    static constexpr unsigned char s_6_32[4] = { 'i', 'r', 'e', 'm' };
+    static constexpr unsigned char s_6_33[5] = { 'a', 's', 's', 'e', 'm' };
+    static constexpr unsigned char s_6_34[5] = { 'e', 's', 's', 'e', 'm' };
+    static constexpr unsigned char s_6_35[5] = { 'i', 's', 's', 'e', 'm' };
+    static constexpr unsigned char s_6_36[3] = { 'a', 'd', 'o' };
+    static constexpr unsigned char s_6_37[3] = { 'i', 'd', 'o' };
+    static constexpr unsigned char s_6_38[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr unsigned char s_6_39[4] = { 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_6_40[4] = { 'i', 'n', 'd', 'o' };
+    static constexpr unsigned char s_6_41[5] = { 'a', 'r', 'a', '~', 'o' };
+    static constexpr unsigned char s_6_42[5] = { 'e', 'r', 'a', '~', 'o' };
+    static constexpr unsigned char s_6_43[5] = { 'i', 'r', 'a', '~', 'o' };
+    static constexpr unsigned char s_6_44[2] = { 'a', 'r' };
+    static constexpr unsigned char s_6_45[2] = { 'e', 'r' };
+    static constexpr unsigned char s_6_46[2] = { 'i', 'r' };
+    static constexpr unsigned char s_6_47[2] = { 'a', 's' };
+    static constexpr unsigned char s_6_48[4] = { 'a', 'd', 'a', 's' };
+    static constexpr unsigned char s_6_49[4] = { 'i', 'd', 'a', 's' };
+    static constexpr unsigned char s_6_50[3] = { 'i', 'a', 's' };
+    static constexpr unsigned char s_6_51[5] = { 'a', 'r', 'i', 'a', 's' };
+    static constexpr unsigned char s_6_52[5] = { 'e', 'r', 'i', 'a', 's' };
+    static constexpr unsigned char s_6_53[5] = { 'i', 'r', 'i', 'a', 's' };
+    static constexpr unsigned char s_6_54[4] = { 'a', 'r', 'a', 's' };
+    static constexpr unsigned char s_6_55[4] = { 'e', 'r', 'a', 's' };
+    static constexpr unsigned char s_6_56[4] = { 'i', 'r', 'a', 's' };
+    static constexpr unsigned char s_6_57[4] = { 'a', 'v', 'a', 's' };
+    static constexpr unsigned char s_6_58[2] = { 'e', 's' };
+    static constexpr unsigned char s_6_59[5] = { 'a', 'r', 'd', 'e', 's' };
+    static constexpr unsigned char s_6_60[5] = { 'e', 'r', 'd', 'e', 's' };
+    static constexpr unsigned char s_6_61[5] = { 'i', 'r', 'd', 'e', 's' };
+    static constexpr unsigned char s_6_62[4] = { 'a', 'r', 'e', 's' };
+    static constexpr unsigned char s_6_63[4] = { 'e', 'r', 'e', 's' };
+    static constexpr unsigned char s_6_64[4] = { 'i', 'r', 'e', 's' };
+    static constexpr unsigned char s_6_65[5] = { 'a', 's', 's', 'e', 's' };
+    static constexpr unsigned char s_6_66[5] = { 'e', 's', 's', 'e', 's' };
+    static constexpr unsigned char s_6_67[5] = { 'i', 's', 's', 'e', 's' };
+    static constexpr unsigned char s_6_68[5] = { 'a', 's', 't', 'e', 's' };
+    static constexpr unsigned char s_6_69[5] = { 'e', 's', 't', 'e', 's' };
+    static constexpr unsigned char s_6_70[5] = { 'i', 's', 't', 'e', 's' };
+    static constexpr unsigned char s_6_71[2] = { 'i', 's' };
+    static constexpr unsigned char s_6_72[3] = { 'a', 'i', 's' };
+    static constexpr unsigned char s_6_73[3] = { 'e', 'i', 's' };
+    static constexpr unsigned char s_6_74[5] = { 'a', 'r', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_75[5] = { 'e', 'r', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_76[5] = { 'i', 'r', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_77[6] = { 0xC3, 0xA1, 'r', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_78[6] = { 0xC3, 0xA9, 'r', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_79[6] = { 0xC3, 0xAD, 'r', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_80[7] = { 0xC3, 0xA1, 's', 's', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_81[7] = { 0xC3, 0xA9, 's', 's', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_82[7] = { 0xC3, 0xAD, 's', 's', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_83[6] = { 0xC3, 0xA1, 'v', 'e', 'i', 's' };
+    static constexpr unsigned char s_6_84[5] = { 0xC3, 0xAD, 'e', 'i', 's' };
+    static constexpr unsigned char s_6_85[7] = { 'a', 'r', 0xC3, 0xAD, 'e', 'i', 's' };
+    static constexpr unsigned char s_6_86[7] = { 'e', 'r', 0xC3, 0xAD, 'e', 'i', 's' };
+    static constexpr unsigned char s_6_87[7] = { 'i', 'r', 0xC3, 0xAD, 'e', 'i', 's' };
+    static constexpr unsigned char s_6_88[4] = { 'a', 'd', 'o', 's' };
+    static constexpr unsigned char s_6_89[4] = { 'i', 'd', 'o', 's' };
+    static constexpr unsigned char s_6_90[4] = { 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_91[7] = { 0xC3, 0xA1, 'r', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_92[7] = { 0xC3, 0xA9, 'r', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_93[7] = { 0xC3, 0xAD, 'r', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_94[7] = { 0xC3, 0xA1, 'v', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_95[6] = { 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_96[8] = { 'a', 'r', 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_97[8] = { 'e', 'r', 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_98[8] = { 'i', 'r', 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_99[4] = { 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_100[6] = { 'a', 'r', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_101[6] = { 'e', 'r', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_102[6] = { 'i', 'r', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_103[8] = { 0xC3, 0xA1, 's', 's', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_104[8] = { 0xC3, 0xAA, 's', 's', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_105[8] = { 0xC3, 0xAD, 's', 's', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_106[4] = { 'i', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_107[5] = { 'a', 'r', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_108[5] = { 'e', 'r', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_109[5] = { 'i', 'r', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_110[5] = { 0xC3, 0xA1, 'm', 'o', 's' };
+    static constexpr unsigned char s_6_111[5] = { 'a', 'r', 0xC3, 0xA1, 's' };
+    static constexpr unsigned char s_6_112[5] = { 'e', 'r', 0xC3, 0xA1, 's' };
+    static constexpr unsigned char s_6_113[5] = { 'i', 'r', 0xC3, 0xA1, 's' };
+    static constexpr unsigned char s_6_114[2] = { 'e', 'u' };
+    static constexpr unsigned char s_6_115[2] = { 'i', 'u' };
+    static constexpr unsigned char s_6_116[2] = { 'o', 'u' };
+    static constexpr unsigned char s_6_117[4] = { 'a', 'r', 0xC3, 0xA1 };
+    static constexpr unsigned char s_6_118[4] = { 'e', 'r', 0xC3, 0xA1 };
+    static constexpr unsigned char s_6_119[4] = { 'i', 'r', 0xC3, 0xA1 };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 3, s_6_1, -1, 1, 0 },
+    /*  2 */ { 2, s_6_2, -1, 1, 0 },
+    /*  3 */ { 4, s_6_3, 2, 1, 0 },
+    /*  4 */ { 4, s_6_4, 2, 1, 0 },
+    /*  5 */ { 4, s_6_5, 2, 1, 0 },
+    /*  6 */ { 3, s_6_6, -1, 1, 0 },
+    /*  7 */ { 3, s_6_7, -1, 1, 0 },
+    /*  8 */ { 3, s_6_8, -1, 1, 0 },
+    /*  9 */ { 3, s_6_9, -1, 1, 0 },
+    /* 10 */ { 4, s_6_10, -1, 1, 0 },
+    /* 11 */ { 4, s_6_11, -1, 1, 0 },
+    /* 12 */ { 4, s_6_12, -1, 1, 0 },
+    /* 13 */ { 4, s_6_13, -1, 1, 0 },
+    /* 14 */ { 4, s_6_14, -1, 1, 0 },
+    /* 15 */ { 4, s_6_15, -1, 1, 0 },
+    /* 16 */ { 2, s_6_16, -1, 1, 0 },
+    /* 17 */ { 4, s_6_17, 16, 1, 0 },
+    /* 18 */ { 4, s_6_18, 16, 1, 0 },
+    /* 19 */ { 4, s_6_19, 16, 1, 0 },
+    /* 20 */ { 2, s_6_20, -1, 1, 0 },
+    /* 21 */ { 3, s_6_21, 20, 1, 0 },
+    /* 22 */ { 5, s_6_22, 21, 1, 0 },
+    /* 23 */ { 5, s_6_23, 21, 1, 0 },
+    /* 24 */ { 5, s_6_24, 21, 1, 0 },
+    /* 25 */ { 4, s_6_25, 20, 1, 0 },
+    /* 26 */ { 4, s_6_26, 20, 1, 0 },
+    /* 27 */ { 4, s_6_27, 20, 1, 0 },
+    /* 28 */ { 4, s_6_28, 20, 1, 0 },
+    /* 29 */ { 2, s_6_29, -1, 1, 0 },
+    /* 30 */ { 4, s_6_30, 29, 1, 0 },
+    /* 31 */ { 4, s_6_31, 29, 1, 0 },
+    /* 32 */ { 4, s_6_32, 29, 1, 0 },
+    /* 33 */ { 5, s_6_33, 29, 1, 0 },
+    /* 34 */ { 5, s_6_34, 29, 1, 0 },
+    /* 35 */ { 5, s_6_35, 29, 1, 0 },
+    /* 36 */ { 3, s_6_36, -1, 1, 0 },
+    /* 37 */ { 3, s_6_37, -1, 1, 0 },
+    /* 38 */ { 4, s_6_38, -1, 1, 0 },
+    /* 39 */ { 4, s_6_39, -1, 1, 0 },
+    /* 40 */ { 4, s_6_40, -1, 1, 0 },
+    /* 41 */ { 5, s_6_41, -1, 1, 0 },
+    /* 42 */ { 5, s_6_42, -1, 1, 0 },
+    /* 43 */ { 5, s_6_43, -1, 1, 0 },
+    /* 44 */ { 2, s_6_44, -1, 1, 0 },
+    /* 45 */ { 2, s_6_45, -1, 1, 0 },
+    /* 46 */ { 2, s_6_46, -1, 1, 0 },
+    /* 47 */ { 2, s_6_47, -1, 1, 0 },
+    /* 48 */ { 4, s_6_48, 47, 1, 0 },
+    /* 49 */ { 4, s_6_49, 47, 1, 0 },
+    /* 50 */ { 3, s_6_50, 47, 1, 0 },
+    /* 51 */ { 5, s_6_51, 50, 1, 0 },
+    /* 52 */ { 5, s_6_52, 50, 1, 0 },
+    /* 53 */ { 5, s_6_53, 50, 1, 0 },
+    /* 54 */ { 4, s_6_54, 47, 1, 0 },
+    /* 55 */ { 4, s_6_55, 47, 1, 0 },
+    /* 56 */ { 4, s_6_56, 47, 1, 0 },
+    /* 57 */ { 4, s_6_57, 47, 1, 0 },
+    /* 58 */ { 2, s_6_58, -1, 1, 0 },
+    /* 59 */ { 5, s_6_59, 58, 1, 0 },
+    /* 60 */ { 5, s_6_60, 58, 1, 0 },
+    /* 61 */ { 5, s_6_61, 58, 1, 0 },
+    /* 62 */ { 4, s_6_62, 58, 1, 0 },
+    /* 63 */ { 4, s_6_63, 58, 1, 0 },
+    /* 64 */ { 4, s_6_64, 58, 1, 0 },
+    /* 65 */ { 5, s_6_65, 58, 1, 0 },
+    /* 66 */ { 5, s_6_66, 58, 1, 0 },
+    /* 67 */ { 5, s_6_67, 58, 1, 0 },
+    /* 68 */ { 5, s_6_68, 58, 1, 0 },
+    /* 69 */ { 5, s_6_69, 58, 1, 0 },
+    /* 70 */ { 5, s_6_70, 58, 1, 0 },
+    /* 71 */ { 2, s_6_71, -1, 1, 0 },
+    /* 72 */ { 3, s_6_72, 71, 1, 0 },
+    /* 73 */ { 3, s_6_73, 71, 1, 0 },
+    /* 74 */ { 5, s_6_74, 73, 1, 0 },
+    /* 75 */ { 5, s_6_75, 73, 1, 0 },
+    /* 76 */ { 5, s_6_76, 73, 1, 0 },
+    /* 77 */ { 6, s_6_77, 73, 1, 0 },
+    /* 78 */ { 6, s_6_78, 73, 1, 0 },
+    /* 79 */ { 6, s_6_79, 73, 1, 0 },
+    /* 80 */ { 7, s_6_80, 73, 1, 0 },
+    /* 81 */ { 7, s_6_81, 73, 1, 0 },
+    /* 82 */ { 7, s_6_82, 73, 1, 0 },
+    /* 83 */ { 6, s_6_83, 73, 1, 0 },
+    /* 84 */ { 5, s_6_84, 73, 1, 0 },
+    /* 85 */ { 7, s_6_85, 84, 1, 0 },
+    /* 86 */ { 7, s_6_86, 84, 1, 0 },
+    /* 87 */ { 7, s_6_87, 84, 1, 0 },
+    /* 88 */ { 4, s_6_88, -1, 1, 0 },
+    /* 89 */ { 4, s_6_89, -1, 1, 0 },
+    /* 90 */ { 4, s_6_90, -1, 1, 0 },
+    /* 91 */ { 7, s_6_91, 90, 1, 0 },
+    /* 92 */ { 7, s_6_92, 90, 1, 0 },
+    /* 93 */ { 7, s_6_93, 90, 1, 0 },
+    /* 94 */ { 7, s_6_94, 90, 1, 0 },
+    /* 95 */ { 6, s_6_95, 90, 1, 0 },
+    /* 96 */ { 8, s_6_96, 95, 1, 0 },
+    /* 97 */ { 8, s_6_97, 95, 1, 0 },
+    /* 98 */ { 8, s_6_98, 95, 1, 0 },
+    /* 99 */ { 4, s_6_99, -1, 1, 0 },
+    /*100 */ { 6, s_6_100, 99, 1, 0 },
+    /*101 */ { 6, s_6_101, 99, 1, 0 },
+    /*102 */ { 6, s_6_102, 99, 1, 0 },
+    /*103 */ { 8, s_6_103, 99, 1, 0 },
+    /*104 */ { 8, s_6_104, 99, 1, 0 },
+    /*105 */ { 8, s_6_105, 99, 1, 0 },
+    /*106 */ { 4, s_6_106, -1, 1, 0 },
+    /*107 */ { 5, s_6_107, -1, 1, 0 },
+    /*108 */ { 5, s_6_108, -1, 1, 0 },
+    /*109 */ { 5, s_6_109, -1, 1, 0 },
+    /*110 */ { 5, s_6_110, -1, 1, 0 },
+    /*111 */ { 5, s_6_111, -1, 1, 0 },
+    /*112 */ { 5, s_6_112, -1, 1, 0 },
+    /*113 */ { 5, s_6_113, -1, 1, 0 },
+    /*114 */ { 2, s_6_114, -1, 1, 0 },
+    /*115 */ { 2, s_6_115, -1, 1, 0 },
+    /*116 */ { 2, s_6_116, -1, 1, 0 },
+    /*117 */ { 4, s_6_117, -1, 1, 0 },
+    /*118 */ { 4, s_6_118, -1, 1, 0 },
+    /*119 */ { 4, s_6_119, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[1] = { 'a' };
+    static constexpr unsigned char s_7_1[1] = { 'i' };
+    static constexpr unsigned char s_7_2[1] = { 'o' };
+    static constexpr unsigned char s_7_3[2] = { 'o', 's' };
+    static constexpr unsigned char s_7_4[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_7_5[2] = { 0xC3, 0xAD };
+    static constexpr unsigned char s_7_6[2] = { 0xC3, 0xB3 };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 1, s_7_0, -1, 1, 0 },
+    /*  1 */ { 1, s_7_1, -1, 1, 0 },
+    /*  2 */ { 1, s_7_2, -1, 1, 0 },
+    /*  3 */ { 2, s_7_3, -1, 1, 0 },
+    /*  4 */ { 2, s_7_4, -1, 1, 0 },
+    /*  5 */ { 2, s_7_5, -1, 1, 0 },
+    /*  6 */ { 2, s_7_6, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[1] = { 'e' };
+    static constexpr unsigned char s_8_1[2] = { 0xC3, 0xA7 };
+    static constexpr unsigned char s_8_2[2] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_8_3[2] = { 0xC3, 0xAA };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, 1, 0 },
+    /*  1 */ { 2, s_8_1, -1, 2, 0 },
+    /*  2 */ { 2, s_8_2, -1, 1, 0 },
+    /*  3 */ { 2, s_8_3, -1, 1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'a', '~' };
+    static constexpr unsigned char s_1[] = { 'o', '~' };
+    static constexpr unsigned char s_2[] = { 0xC3, 0xA3 };
+    static constexpr unsigned char s_3[] = { 0xC3, 0xB5 };
+    static constexpr unsigned char s_4[] = { 'l', 'o', 'g' };
+    static constexpr unsigned char s_5[] = { 'u' };
+    static constexpr unsigned char s_6[] = { 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_7[] = { 'a', 't' };
+    static constexpr unsigned char s_8[] = { 'a', 't' };
+    static constexpr unsigned char s_9[] = { 'e' };
+    static constexpr unsigned char s_10[] = { 'i', 'r' };
+    static constexpr unsigned char s_11[] = { 'u' };
+    static constexpr unsigned char s_12[] = { 'g' };
+    static constexpr unsigned char s_13[] = { 'i' };
+    static constexpr unsigned char s_14[] = { 'c' };
+    static constexpr unsigned char s_15[] = { 'c' };
+    static constexpr unsigned char s_16[] = { 'i' };
+    static constexpr unsigned char s_17[] = { 'c' };
+};
+
+template <>
+struct portuguese_stemmer_data<false> : portuguese_stemmer_groupings {
+    static constexpr char32_t s_0_1[1] = { 0xE3 };
+    static constexpr char32_t s_0_2[1] = { 0xF5 };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_0_1, 0, 1, 0 },
+    /*  2 */ { 1, s_0_2, 0, 2, 0 }
+    };
+
+    static constexpr char32_t s_1_1[2] = { 'a', '~' };
+    static constexpr char32_t s_1_2[2] = { 'o', '~' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 2, s_1_1, 0, 1, 0 },
+    /*  2 */ { 2, s_1_2, 0, 2, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_2_1[2] = { 'a', 'd' };
+    static constexpr char32_t s_2_2[2] = { 'o', 's' };
+    static constexpr char32_t s_2_3[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 },
+    /*  3 */ { 2, s_2_3, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[4] = { 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_3_1[4] = { 'a', 'v', 'e', 'l' };
+    static constexpr char32_t s_3_2[4] = { 0xED, 'v', 'e', 'l' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 },
+    /*  2 */ { 4, s_3_2, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_4_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_4_2[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 1, 0 },
+    /*  1 */ { 4, s_4_1, -1, 1, 0 },
+    /*  2 */ { 2, s_4_2, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_5_0[3] = { 'i', 'c', 'a' };
+    static constexpr char32_t s_5_1[5] = { 0xE2, 'n', 'c', 'i', 'a' };
+    static constexpr char32_t s_5_2[5] = { 0xEA, 'n', 'c', 'i', 'a' };
+    static constexpr char32_t s_5_3[5] = { 'l', 'o', 'g', 'i', 'a' };
+    static constexpr char32_t s_5_4[3] = { 'i', 'r', 'a' };
+    static constexpr char32_t s_5_5[5] = { 'a', 'd', 'o', 'r', 'a' };
+    static constexpr char32_t s_5_6[3] = { 'o', 's', 'a' };
+    static constexpr char32_t s_5_7[4] = { 'i', 's', 't', 'a' };
+    static constexpr char32_t s_5_8[3] = { 'i', 'v', 'a' };
+    static constexpr char32_t s_5_9[3] = { 'e', 'z', 'a' };
+    static constexpr char32_t s_5_10[5] = { 'i', 'd', 'a', 'd', 'e' };
+    static constexpr char32_t s_5_11[4] = { 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_5_12[5] = { 'm', 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_5_13[6] = { 'a', 'm', 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_5_14[4] = { 0xE1, 'v', 'e', 'l' };
+    static constexpr char32_t s_5_15[4] = { 0xED, 'v', 'e', 'l' };
+    static constexpr char32_t s_5_16[3] = { 'i', 'c', 'o' };
+    static constexpr char32_t s_5_17[4] = { 'i', 's', 'm', 'o' };
+    static constexpr char32_t s_5_18[3] = { 'o', 's', 'o' };
+    static constexpr char32_t s_5_19[6] = { 'a', 'm', 'e', 'n', 't', 'o' };
+    static constexpr char32_t s_5_20[6] = { 'i', 'm', 'e', 'n', 't', 'o' };
+    static constexpr char32_t s_5_21[3] = { 'i', 'v', 'o' };
+    static constexpr char32_t s_5_22[5] = { 'a', 0xE7, 'a', '~', 'o' };
+    static constexpr char32_t s_5_23[5] = { 'u', 0xE7, 'a', '~', 'o' };
+    static constexpr char32_t s_5_24[4] = { 'a', 'd', 'o', 'r' };
+    static constexpr char32_t s_5_25[4] = { 'i', 'c', 'a', 's' };
+    static constexpr char32_t s_5_26[6] = { 0xEA, 'n', 'c', 'i', 'a', 's' };
+    static constexpr char32_t s_5_27[6] = { 'l', 'o', 'g', 'i', 'a', 's' };
+    static constexpr char32_t s_5_28[4] = { 'i', 'r', 'a', 's' };
+    static constexpr char32_t s_5_29[6] = { 'a', 'd', 'o', 'r', 'a', 's' };
+    static constexpr char32_t s_5_30[4] = { 'o', 's', 'a', 's' };
+    static constexpr char32_t s_5_31[5] = { 'i', 's', 't', 'a', 's' };
+    static constexpr char32_t s_5_32[4] = { 'i', 'v', 'a', 's' };
+    static constexpr char32_t s_5_33[4] = { 'e', 'z', 'a', 's' };
+    static constexpr char32_t s_5_34[6] = { 'i', 'd', 'a', 'd', 'e', 's' };
+    static constexpr char32_t s_5_35[6] = { 'a', 'd', 'o', 'r', 'e', 's' };
+    static constexpr char32_t s_5_36[5] = { 'a', 'n', 't', 'e', 's' };
+    static constexpr char32_t s_5_37[6] = { 'a', 0xE7, 'o', '~', 'e', 's' };
+    static constexpr char32_t s_5_38[6] = { 'u', 0xE7, 'o', '~', 'e', 's' };
+    static constexpr char32_t s_5_39[4] = { 'i', 'c', 'o', 's' };
+    static constexpr char32_t s_5_40[5] = { 'i', 's', 'm', 'o', 's' };
+    static constexpr char32_t s_5_41[4] = { 'o', 's', 'o', 's' };
+    static constexpr char32_t s_5_42[7] = { 'a', 'm', 'e', 'n', 't', 'o', 's' };
+    static constexpr char32_t s_5_43[7] = { 'i', 'm', 'e', 'n', 't', 'o', 's' };
+    static constexpr char32_t s_5_44[4] = { 'i', 'v', 'o', 's' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 3, s_5_0, -1, 1, 0 },
+    /*  1 */ { 5, s_5_1, -1, 1, 0 },
+    /*  2 */ { 5, s_5_2, -1, 4, 0 },
+    /*  3 */ { 5, s_5_3, -1, 2, 0 },
+    /*  4 */ { 3, s_5_4, -1, 9, 0 },
+    /*  5 */ { 5, s_5_5, -1, 1, 0 },
+    /*  6 */ { 3, s_5_6, -1, 1, 0 },
+    /*  7 */ { 4, s_5_7, -1, 1, 0 },
+    /*  8 */ { 3, s_5_8, -1, 8, 0 },
+    /*  9 */ { 3, s_5_9, -1, 1, 0 },
+    /* 10 */ { 5, s_5_10, -1, 7, 0 },
+    /* 11 */ { 4, s_5_11, -1, 1, 0 },
+    /* 12 */ { 5, s_5_12, -1, 6, 0 },
+    /* 13 */ { 6, s_5_13, 12, 5, 0 },
+    /* 14 */ { 4, s_5_14, -1, 1, 0 },
+    /* 15 */ { 4, s_5_15, -1, 1, 0 },
+    /* 16 */ { 3, s_5_16, -1, 1, 0 },
+    /* 17 */ { 4, s_5_17, -1, 1, 0 },
+    /* 18 */ { 3, s_5_18, -1, 1, 0 },
+    /* 19 */ { 6, s_5_19, -1, 1, 0 },
+    /* 20 */ { 6, s_5_20, -1, 1, 0 },
+    /* 21 */ { 3, s_5_21, -1, 8, 0 },
+    /* 22 */ { 5, s_5_22, -1, 1, 0 },
+    /* 23 */ { 5, s_5_23, -1, 3, 0 },
+    /* 24 */ { 4, s_5_24, -1, 1, 0 },
+    /* 25 */ { 4, s_5_25, -1, 1, 0 },
+    /* 26 */ { 6, s_5_26, -1, 4, 0 },
+    /* 27 */ { 6, s_5_27, -1, 2, 0 },
+    /* 28 */ { 4, s_5_28, -1, 9, 0 },
+    /* 29 */ { 6, s_5_29, -1, 1, 0 },
+    /* 30 */ { 4, s_5_30, -1, 1, 0 },
+    /* 31 */ { 5, s_5_31, -1, 1, 0 },
+    /* 32 */ { 4, s_5_32, -1, 8, 0 },
+    /* 33 */ { 4, s_5_33, -1, 1, 0 },
+    /* 34 */ { 6, s_5_34, -1, 7, 0 },
+    /* 35 */ { 6, s_5_35, -1, 1, 0 },
+    /* 36 */ { 5, s_5_36, -1, 1, 0 },
+    /* 37 */ { 6, s_5_37, -1, 1, 0 },
+    /* 38 */ { 6, s_5_38, -1, 3, 0 },
+    /* 39 */ { 4, s_5_39, -1, 1, 0 },
+    /* 40 */ { 5, s_5_40, -1, 1, 0 },
+    /* 41 */ { 4, s_5_41, -1, 1, 0 },
+    /* 42 */ { 7, s_5_42, -1, 1, 0 },
+    /* 43 */ { 7, s_5_43, -1, 1, 0 },
+    /* 44 */ { 4, s_5_44, -1, 8, 0 }
+    };
+
+    static constexpr char32_t s_6_0[3] = { 'a', 'd', 'a' };
+    static constexpr char32_t s_6_1[3] = { 'i', 'd', 'a' };
+    static constexpr char32_t s_6_2[2] = { 'i', 'a' };
+    static constexpr char32_t s_6_3[4] = { 'a', 'r', 'i', 'a' };
+    static constexpr char32_t s_6_4[4] = { 'e', 'r', 'i', 'a' };
+    static constexpr char32_t s_6_5[4] = { 'i', 'r', 'i', 'a' };
+    static constexpr char32_t s_6_6[3] = { 'a', 'r', 'a' };
+    static constexpr char32_t s_6_7[3] = { 'e', 'r', 'a' };
+    static constexpr char32_t s_6_8[3] = { 'i', 'r', 'a' };
+    static constexpr char32_t s_6_9[3] = { 'a', 'v', 'a' };
+    static constexpr char32_t s_6_10[4] = { 'a', 's', 's', 'e' };
+    static constexpr char32_t s_6_11[4] = { 'e', 's', 's', 'e' };
+    static constexpr char32_t s_6_12[4] = { 'i', 's', 's', 'e' };
+    static constexpr char32_t s_6_13[4] = { 'a', 's', 't', 'e' };
+    static constexpr char32_t s_6_14[4] = { 'e', 's', 't', 'e' };
+    static constexpr char32_t s_6_15[4] = { 'i', 's', 't', 'e' };
+    static constexpr char32_t s_6_16[2] = { 'e', 'i' };
+    static constexpr char32_t s_6_17[4] = { 'a', 'r', 'e', 'i' };
+    static constexpr char32_t s_6_18[4] = { 'e', 'r', 'e', 'i' };
+    static constexpr char32_t s_6_19[4] = { 'i', 'r', 'e', 'i' };
+    static constexpr char32_t s_6_20[2] = { 'a', 'm' };
+    static constexpr char32_t s_6_21[3] = { 'i', 'a', 'm' };
+    static constexpr char32_t s_6_22[5] = { 'a', 'r', 'i', 'a', 'm' };
+    static constexpr char32_t s_6_23[5] = { 'e', 'r', 'i', 'a', 'm' };
+    static constexpr char32_t s_6_24[5] = { 'i', 'r', 'i', 'a', 'm' };
+    static constexpr char32_t s_6_25[4] = { 'a', 'r', 'a', 'm' };
+    static constexpr char32_t s_6_26[4] = { 'e', 'r', 'a', 'm' };
+    static constexpr char32_t s_6_27[4] = { 'i', 'r', 'a', 'm' };
+    static constexpr char32_t s_6_28[4] = { 'a', 'v', 'a', 'm' };
+    static constexpr char32_t s_6_29[2] = { 'e', 'm' };
+    static constexpr char32_t s_6_30[4] = { 'a', 'r', 'e', 'm' };
+    static constexpr char32_t s_6_31[4] = { 'e', 'r', 'e', 'm' };
+    static constexpr char32_t s_6_32[4] = { 'i', 'r', 'e', 'm' };
+    static constexpr char32_t s_6_33[5] = { 'a', 's', 's', 'e', 'm' };
+    static constexpr char32_t s_6_34[5] = { 'e', 's', 's', 'e', 'm' };
+    static constexpr char32_t s_6_35[5] = { 'i', 's', 's', 'e', 'm' };
+    static constexpr char32_t s_6_36[3] = { 'a', 'd', 'o' };
+    static constexpr char32_t s_6_37[3] = { 'i', 'd', 'o' };
+    static constexpr char32_t s_6_38[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr char32_t s_6_39[4] = { 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_6_40[4] = { 'i', 'n', 'd', 'o' };
+    static constexpr char32_t s_6_41[5] = { 'a', 'r', 'a', '~', 'o' };
+    static constexpr char32_t s_6_42[5] = { 'e', 'r', 'a', '~', 'o' };
+    static constexpr char32_t s_6_43[5] = { 'i', 'r', 'a', '~', 'o' };
+    static constexpr char32_t s_6_44[2] = { 'a', 'r' };
+    static constexpr char32_t s_6_45[2] = { 'e', 'r' };
+    static constexpr char32_t s_6_46[2] = { 'i', 'r' };
+    static constexpr char32_t s_6_47[2] = { 'a', 's' };
+    static constexpr char32_t s_6_48[4] = { 'a', 'd', 'a', 's' };
+    static constexpr char32_t s_6_49[4] = { 'i', 'd', 'a', 's' };
+    static constexpr char32_t s_6_50[3] = { 'i', 'a', 's' };
+    static constexpr char32_t s_6_51[5] = { 'a', 'r', 'i', 'a', 's' };
+    static constexpr char32_t s_6_52[5] = { 'e', 'r', 'i', 'a', 's' };
+    static constexpr char32_t s_6_53[5] = { 'i', 'r', 'i', 'a', 's' };
+    static constexpr char32_t s_6_54[4] = { 'a', 'r', 'a', 's' };
+    static constexpr char32_t s_6_55[4] = { 'e', 'r', 'a', 's' };
+    static constexpr char32_t s_6_56[4] = { 'i', 'r', 'a', 's' };
+    static constexpr char32_t s_6_57[4] = { 'a', 'v', 'a', 's' };
+    static constexpr char32_t s_6_58[2] = { 'e', 's' };
+    static constexpr char32_t s_6_59[5] = { 'a', 'r', 'd', 'e', 's' };
+    static constexpr char32_t s_6_60[5] = { 'e', 'r', 'd', 'e', 's' };
+    static constexpr char32_t s_6_61[5] = { 'i', 'r', 'd', 'e', 's' };
+    static constexpr char32_t s_6_62[4] = { 'a', 'r', 'e', 's' };
+    static constexpr char32_t s_6_63[4] = { 'e', 'r', 'e', 's' };
+    static constexpr char32_t s_6_64[4] = { 'i', 'r', 'e', 's' };
+    static constexpr char32_t s_6_65[5] = { 'a', 's', 's', 'e', 's' };
+    static constexpr char32_t s_6_66[5] = { 'e', 's', 's', 'e', 's' };
+    static constexpr char32_t s_6_67[5] = { 'i', 's', 's', 'e', 's' };
+    static constexpr char32_t s_6_68[5] = { 'a', 's', 't', 'e', 's' };
+    static constexpr char32_t s_6_69[5] = { 'e', 's', 't', 'e', 's' };
+    static constexpr char32_t s_6_70[5] = { 'i', 's', 't', 'e', 's' };
+    static constexpr char32_t s_6_71[2] = { 'i', 's' };
+    static constexpr char32_t s_6_72[3] = { 'a', 'i', 's' };
+    static constexpr char32_t s_6_73[3] = { 'e', 'i', 's' };
+    static constexpr char32_t s_6_74[5] = { 'a', 'r', 'e', 'i', 's' };
+    static constexpr char32_t s_6_75[5] = { 'e', 'r', 'e', 'i', 's' };
+    static constexpr char32_t s_6_76[5] = { 'i', 'r', 'e', 'i', 's' };
+    static constexpr char32_t s_6_77[5] = { 0xE1, 'r', 'e', 'i', 's' };
+    static constexpr char32_t s_6_78[5] = { 0xE9, 'r', 'e', 'i', 's' };
+    static constexpr char32_t s_6_79[5] = { 0xED, 'r', 'e', 'i', 's' };
+    static constexpr char32_t s_6_80[6] = { 0xE1, 's', 's', 'e', 'i', 's' };
+    static constexpr char32_t s_6_81[6] = { 0xE9, 's', 's', 'e', 'i', 's' };
+    static constexpr char32_t s_6_82[6] = { 0xED, 's', 's', 'e', 'i', 's' };
+    static constexpr char32_t s_6_83[5] = { 0xE1, 'v', 'e', 'i', 's' };
+    static constexpr char32_t s_6_84[4] = { 0xED, 'e', 'i', 's' };
+    static constexpr char32_t s_6_85[6] = { 'a', 'r', 0xED, 'e', 'i', 's' };
+    static constexpr char32_t s_6_86[6] = { 'e', 'r', 0xED, 'e', 'i', 's' };
+    static constexpr char32_t s_6_87[6] = { 'i', 'r', 0xED, 'e', 'i', 's' };
+    static constexpr char32_t s_6_88[4] = { 'a', 'd', 'o', 's' };
+    static constexpr char32_t s_6_89[4] = { 'i', 'd', 'o', 's' };
+    static constexpr char32_t s_6_90[4] = { 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_91[6] = { 0xE1, 'r', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_92[6] = { 0xE9, 'r', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_93[6] = { 0xED, 'r', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_94[6] = { 0xE1, 'v', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_95[5] = { 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_96[7] = { 'a', 'r', 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_97[7] = { 'e', 'r', 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_98[7] = { 'i', 'r', 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_6_99[4] = { 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_100[6] = { 'a', 'r', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_101[6] = { 'e', 'r', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_102[6] = { 'i', 'r', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_103[7] = { 0xE1, 's', 's', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_104[7] = { 0xEA, 's', 's', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_105[7] = { 0xED, 's', 's', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_6_106[4] = { 'i', 'm', 'o', 's' };
+    static constexpr char32_t s_6_107[5] = { 'a', 'r', 'm', 'o', 's' };
+    static constexpr char32_t s_6_108[5] = { 'e', 'r', 'm', 'o', 's' };
+    static constexpr char32_t s_6_109[5] = { 'i', 'r', 'm', 'o', 's' };
+    static constexpr char32_t s_6_110[4] = { 0xE1, 'm', 'o', 's' };
+    static constexpr char32_t s_6_111[4] = { 'a', 'r', 0xE1, 's' };
+    static constexpr char32_t s_6_112[4] = { 'e', 'r', 0xE1, 's' };
+    static constexpr char32_t s_6_113[4] = { 'i', 'r', 0xE1, 's' };
+    static constexpr char32_t s_6_114[2] = { 'e', 'u' };
+    static constexpr char32_t s_6_115[2] = { 'i', 'u' };
+    static constexpr char32_t s_6_116[2] = { 'o', 'u' };
+    static constexpr char32_t s_6_117[3] = { 'a', 'r', 0xE1 };
+    static constexpr char32_t s_6_118[3] = { 'e', 'r', 0xE1 };
+    static constexpr char32_t s_6_119[3] = { 'i', 'r', 0xE1 };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 3, s_6_1, -1, 1, 0 },
+    /*  2 */ { 2, s_6_2, -1, 1, 0 },
+    /*  3 */ { 4, s_6_3, 2, 1, 0 },
+    /*  4 */ { 4, s_6_4, 2, 1, 0 },
+    /*  5 */ { 4, s_6_5, 2, 1, 0 },
+    /*  6 */ { 3, s_6_6, -1, 1, 0 },
+    /*  7 */ { 3, s_6_7, -1, 1, 0 },
+    /*  8 */ { 3, s_6_8, -1, 1, 0 },
+    /*  9 */ { 3, s_6_9, -1, 1, 0 },
+    /* 10 */ { 4, s_6_10, -1, 1, 0 },
+    /* 11 */ { 4, s_6_11, -1, 1, 0 },
+    /* 12 */ { 4, s_6_12, -1, 1, 0 },
+    /* 13 */ { 4, s_6_13, -1, 1, 0 },
+    /* 14 */ { 4, s_6_14, -1, 1, 0 },
+    /* 15 */ { 4, s_6_15, -1, 1, 0 },
+    /* 16 */ { 2, s_6_16, -1, 1, 0 },
+    /* 17 */ { 4, s_6_17, 16, 1, 0 },
+    /* 18 */ { 4, s_6_18, 16, 1, 0 },
+    /* 19 */ { 4, s_6_19, 16, 1, 0 },
+    /* 20 */ { 2, s_6_20, -1, 1, 0 },
+    /* 21 */ { 3, s_6_21, 20, 1, 0 },
+    /* 22 */ { 5, s_6_22, 21, 1, 0 },
+    /* 23 */ { 5, s_6_23, 21, 1, 0 },
+    /* 24 */ { 5, s_6_24, 21, 1, 0 },
+    /* 25 */ { 4, s_6_25, 20, 1, 0 },
+    /* 26 */ { 4, s_6_26, 20, 1, 0 },
+    /* 27 */ { 4, s_6_27, 20, 1, 0 },
+    /* 28 */ { 4, s_6_28, 20, 1, 0 },
+    /* 29 */ { 2, s_6_29, -1, 1, 0 },
+    /* 30 */ { 4, s_6_30, 29, 1, 0 },
+    /* 31 */ { 4, s_6_31, 29, 1, 0 },
+    /* 32 */ { 4, s_6_32, 29, 1, 0 },
+    /* 33 */ { 5, s_6_33, 29, 1, 0 },
+    /* 34 */ { 5, s_6_34, 29, 1, 0 },
+    /* 35 */ { 5, s_6_35, 29, 1, 0 },
+    /* 36 */ { 3, s_6_36, -1, 1, 0 },
+    /* 37 */ { 3, s_6_37, -1, 1, 0 },
+    /* 38 */ { 4, s_6_38, -1, 1, 0 },
+    /* 39 */ { 4, s_6_39, -1, 1, 0 },
+    /* 40 */ { 4, s_6_40, -1, 1, 0 },
+    /* 41 */ { 5, s_6_41, -1, 1, 0 },
+    /* 42 */ { 5, s_6_42, -1, 1, 0 },
+    /* 43 */ { 5, s_6_43, -1, 1, 0 },
+    /* 44 */ { 2, s_6_44, -1, 1, 0 },
+    /* 45 */ { 2, s_6_45, -1, 1, 0 },
+    /* 46 */ { 2, s_6_46, -1, 1, 0 },
+    /* 47 */ { 2, s_6_47, -1, 1, 0 },
+    /* 48 */ { 4, s_6_48, 47, 1, 0 },
+    /* 49 */ { 4, s_6_49, 47, 1, 0 },
+    /* 50 */ { 3, s_6_50, 47, 1, 0 },
+    /* 51 */ { 5, s_6_51, 50, 1, 0 },
+    /* 52 */ { 5, s_6_52, 50, 1, 0 },
+    /* 53 */ { 5, s_6_53, 50, 1, 0 },
+    /* 54 */ { 4, s_6_54, 47, 1, 0 },
+    /* 55 */ { 4, s_6_55, 47, 1, 0 },
+    /* 56 */ { 4, s_6_56, 47, 1, 0 },
+    /* 57 */ { 4, s_6_57, 47, 1, 0 },
+    /* 58 */ { 2, s_6_58, -1, 1, 0 },
+    /* 59 */ { 5, s_6_59, 58, 1, 0 },
+    /* 60 */ { 5, s_6_60, 58, 1, 0 },
+    /* 61 */ { 5, s_6_61, 58, 1, 0 },
+    /* 62 */ { 4, s_6_62, 58, 1, 0 },
+    /* 63 */ { 4, s_6_63, 58, 1, 0 },
+    /* 64 */ { 4, s_6_64, 58, 1, 0 },
+    /* 65 */ { 5, s_6_65, 58, 1, 0 },
+    /* 66 */ { 5, s_6_66, 58, 1, 0 },
+    /* 67 */ { 5, s_6_67, 58, 1, 0 },
+    /* 68 */ { 5, s_6_68, 58, 1, 0 },
+    /* 69 */ { 5, s_6_69, 58, 1, 0 },
+    /* 70 */ { 5, s_6_70, 58, 1, 0 },
+    /* 71 */ { 2, s_6_71, -1, 1, 0 },
+    /* 72 */ { 3, s_6_72, 71, 1, 0 },
+    /* 73 */ { 3, s_6_73, 71, 1, 0 },
+    /* 74 */ { 5, s_6_74, 73, 1, 0 },
+    /* 75 */ { 5, s_6_75, 73, 1, 0 },
+    /* 76 */ { 5, s_6_76, 73, 1, 0 },
+    /* 77 */ { 5, s_6_77, 73, 1, 0 },
+    /* 78 */ { 5, s_6_78, 73, 1, 0 },
+    /* 79 */ { 5, s_6_79, 73, 1, 0 },
+    /* 80 */ { 6, s_6_80, 73, 1, 0 },
+    /* 81 */ { 6, s_6_81, 73, 1, 0 },
+    /* 82 */ { 6, s_6_82, 73, 1, 0 },
+    /* 83 */ { 5, s_6_83, 73, 1, 0 },
+    /* 84 */ { 4, s_6_84, 73, 1, 0 },
+    /* 85 */ { 6, s_6_85, 84, 1, 0 },
+    /* 86 */ { 6, s_6_86, 84, 1, 0 },
+    /* 87 */ { 6, s_6_87, 84, 1, 0 },
+    /* 88 */ { 4, s_6_88, -1, 1, 0 },
+    /* 89 */ { 4, s_6_89, -1, 1, 0 },
+    /* 90 */ { 4, s_6_90, -1, 1, 0 },
+    /* 91 */ { 6, s_6_91, 90, 1, 0 },
+    /* 92 */ { 6, s_6_92, 90, 1, 0 },
+    /* 93 */ { 6, s_6_93, 90, 1, 0 },
+    /* 94 */ { 6, s_6_94, 90, 1, 0 },
+    /* 95 */ { 5, s_6_95, 90, 1, 0 },
+    /* 96 */ { 7, s_6_96, 95, 1, 0 },
+    /* 97 */ { 7, s_6_97, 95, 1, 0 },
+    /* 98 */ { 7, s_6_98, 95, 1, 0 },
+    /* 99 */ { 4, s_6_99, -1, 1, 0 },
+    /*100 */ { 6, s_6_100, 99, 1, 0 },
+    /*101 */ { 6, s_6_101, 99, 1, 0 },
+    /*102 */ { 6, s_6_102, 99, 1, 0 },
+    /*103 */ { 7, s_6_103, 99, 1, 0 },
+    /*104 */ { 7, s_6_104, 99, 1, 0 },
+    /*105 */ { 7, s_6_105, 99, 1, 0 },
+    /*106 */ { 4, s_6_106, -1, 1, 0 },
+    /*107 */ { 5, s_6_107, -1, 1, 0 },
+    /*108 */ { 5, s_6_108, -1, 1, 0 },
+    /*109 */ { 5, s_6_109, -1, 1, 0 },
+    /*110 */ { 4, s_6_110, -1, 1, 0 },
+    /*111 */ { 4, s_6_111, -1, 1, 0 },
+    /*112 */ { 4, s_6_112, -1, 1, 0 },
+    /*113 */ { 4, s_6_113, -1, 1, 0 },
+    /*114 */ { 2, s_6_114, -1, 1, 0 },
+    /*115 */ { 2, s_6_115, -1, 1, 0 },
+    /*116 */ { 2, s_6_116, -1, 1, 0 },
+    /*117 */ { 3, s_6_117, -1, 1, 0 },
+    /*118 */ { 3, s_6_118, -1, 1, 0 },
+    /*119 */ { 3, s_6_119, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_7_0[1] = { 'a' };
+    static constexpr char32_t s_7_1[1] = { 'i' };
+    static constexpr char32_t s_7_2[1] = { 'o' };
+    static constexpr char32_t s_7_3[2] = { 'o', 's' };
+    static constexpr char32_t s_7_4[1] = { 0xE1 };
+    static constexpr char32_t s_7_5[1] = { 0xED };
+    static constexpr char32_t s_7_6[1] = { 0xF3 };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 1, s_7_0, -1, 1, 0 },
+    /*  1 */ { 1, s_7_1, -1, 1, 0 },
+    /*  2 */ { 1, s_7_2, -1, 1, 0 },
+    /*  3 */ { 2, s_7_3, -1, 1, 0 },
+    /*  4 */ { 1, s_7_4, -1, 1, 0 },
+    /*  5 */ { 1, s_7_5, -1, 1, 0 },
+    /*  6 */ { 1, s_7_6, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_8_0[1] = { 'e' };
+    static constexpr char32_t s_8_1[1] = { 0xE7 };
+    static constexpr char32_t s_8_2[1] = { 0xE9 };
+    static constexpr char32_t s_8_3[1] = { 0xEA };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 1, s_8_0, -1, 1, 0 },
+    /*  1 */ { 1, s_8_1, -1, 2, 0 },
+    /*  2 */ { 1, s_8_2, -1, 1, 0 },
+    /*  3 */ { 1, s_8_3, -1, 1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'a', '~' };
+    static constexpr char32_t s_1[] = { 'o', '~' };
+    static constexpr char32_t s_2[] = { 0xE3 };
+    static constexpr char32_t s_3[] = { 0xF5 };
+    static constexpr char32_t s_4[] = { 'l', 'o', 'g' };
+    static constexpr char32_t s_5[] = { 'u' };
+    static constexpr char32_t s_6[] = { 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_7[] = { 'a', 't' };
+    static constexpr char32_t s_8[] = { 'a', 't' };
+    static constexpr char32_t s_9[] = { 'e' };
+    static constexpr char32_t s_10[] = { 'i', 'r' };
+    static constexpr char32_t s_11[] = { 'u' };
+    static constexpr char32_t s_12[] = { 'g' };
+    static constexpr char32_t s_13[] = { 'i' };
+    static constexpr char32_t s_14[] = { 'c' };
+    static constexpr char32_t s_15[] = { 'c' };
+    static constexpr char32_t s_16[] = { 'i' };
+    static constexpr char32_t s_17[] = { 'c' };
+};
+
+template <typename symbol>
+class portuguese_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef portuguese_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        int among_var;
+        while(1) { /* repeat, line 36 */
+            int c1 = c;
+            bra = c; /* [, line 37 */
+            among_var = find_among(data::a_0); /* substring, line 37 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 37 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_0); /* <-, line 38 */
+                    break;
+                case 2:
+                    slice_from(data::s_1); /* <-, line 39 */
+                    break;
+                case 3:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 40 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_pV = l; /* $pV = <integer expression>, line 46 */
+        I_p1 = l; /* $p1 = <integer expression>, line 47 */
+        I_p2 = l; /* $p2 = <integer expression>, line 48 */
+        {   int c1 = c; /* do, line 50 */
+            {   int c2 = c; /* or, line 52 */
+                if (in_grouping(data::g_v, 97, 250, 0)) goto lab2; /* grouping v, line 51 */
+                {   int c3 = c; /* or, line 51 */
+                    if (out_grouping(data::g_v, 97, 250, 0)) goto lab4; /* non v, line 51 */
+                    {    /* gopast */ /* grouping v, line 51 */
+                        int ret = out_grouping(data::g_v, 97, 250, 1);
+                        if (ret < 0) goto lab4;
+                        c += ret;
+                    }
+                    goto lab3;
+                lab4:
+                    c = c3;
+                    if (in_grouping(data::g_v, 97, 250, 0)) goto lab2; /* grouping v, line 51 */
+                    {    /* gopast */ /* non v, line 51 */
+                        int ret = in_grouping(data::g_v, 97, 250, 1);
+                        if (ret < 0) goto lab2;
+                        c += ret;
+                    }
+                }
+            lab3:
+                goto lab1;
+            lab2:
+                c = c2;
+                if (out_grouping(data::g_v, 97, 250, 0)) goto lab0; /* non v, line 53 */
+                {   int c4 = c; /* or, line 53 */
+                    if (out_grouping(data::g_v, 97, 250, 0)) goto lab6; /* non v, line 53 */
+                    {    /* gopast */ /* grouping v, line 53 */
+                        int ret = out_grouping(data::g_v, 97, 250, 1);
+                        if (ret < 0) goto lab6;
+                        c += ret;
+                    }
+                    goto lab5;
+                lab6:
+                    c = c4;
+                    if (in_grouping(data::g_v, 97, 250, 0)) goto lab0; /* grouping v, line 53 */
+                    {   int ret = hop(c, 0, l, 1); /* next, line 53 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                }
+            lab5:
+                ;
+            }
+        lab1:
+            I_pV = c; /* setmark pV, line 54 */
+        lab0:
+            c = c1;
+        }
+        {   int c5 = c; /* do, line 56 */
+            {    /* gopast */ /* grouping v, line 57 */
+                int ret = out_grouping(data::g_v, 97, 250, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 57 */
+                int ret = in_grouping(data::g_v, 97, 250, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 57 */
+            {    /* gopast */ /* grouping v, line 58 */
+                int ret = out_grouping(data::g_v, 97, 250, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 58 */
+                int ret = in_grouping(data::g_v, 97, 250, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 58 */
+        lab7:
+            c = c5;
+        }
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 62 */
+            int c1 = c;
+            bra = c; /* [, line 63 */
+            among_var = find_among(data::a_1); /* substring, line 63 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 63 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_2); /* <-, line 64 */
+                    break;
+                case 2:
+                    slice_from(data::s_3); /* <-, line 65 */
+                    break;
+                case 3:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 66 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_RV() {
+        if (!(I_pV <= c)) return false; /* $pV <= <integer expression>, line 72 */
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 73 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 74 */
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        ket = c; /* [, line 77 */
+        if (c - 2 <= lb || p[c - 1] >> 5 != 3 || !((823330 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 77 */
+        among_var = find_among_b(data::a_5); /* substring, line 77 */
+        if (!among_var) return false;
+        bra = c; /* ], line 77 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_R2()) return false; /* call R2, line 93 */
+                slice_del(); /* delete, line 93 */
+                break;
+            case 2:
+                if (!r_R2()) return false; /* call R2, line 98 */
+                slice_from(data::s_4); /* <-, line 98 */
+                break;
+            case 3:
+                if (!r_R2()) return false; /* call R2, line 102 */
+                slice_from(data::s_5); /* <-, line 102 */
+                break;
+            case 4:
+                if (!r_R2()) return false; /* call R2, line 106 */
+                slice_from(data::s_6); /* <-, line 106 */
+                break;
+            case 5:
+                if (!r_R1()) return false; /* call R1, line 110 */
+                slice_del(); /* delete, line 110 */
+                {   int m_keep = l - c; /* try, line 111 */
+                    ket = c; /* [, line 112 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4718616 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab0; } /* substring, line 112 */
+                    among_var = find_among_b(data::a_2); /* substring, line 112 */
+                    if (!among_var) { c = l - m_keep; goto lab0; }
+                    bra = c; /* ], line 112 */
+                    if (!r_R2()) { c = l - m_keep; goto lab0; } /* call R2, line 112 */
+                    slice_del(); /* delete, line 112 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab0; }
+                        case 1:
+                            ket = c; /* [, line 113 */
+                            if (!eq_s_b(data::s_7)) { c = l - m_keep; goto lab0; } /* literal, line 113 */
+                            bra = c; /* ], line 113 */
+                            if (!r_R2()) { c = l - m_keep; goto lab0; } /* call R2, line 113 */
+                            slice_del(); /* delete, line 113 */
+                            break;
+                    }
+                lab0:
+                    ;
+                }
+                break;
+            case 6:
+                if (!r_R2()) return false; /* call R2, line 122 */
+                slice_del(); /* delete, line 122 */
+                {   int m_keep = l - c; /* try, line 123 */
+                    ket = c; /* [, line 124 */
+                    if (c - 3 <= lb || (p[c - 1] != 101 && p[c - 1] != 108)) { c = l - m_keep; goto lab1; } /* substring, line 124 */
+                    among_var = find_among_b(data::a_3); /* substring, line 124 */
+                    if (!among_var) { c = l - m_keep; goto lab1; }
+                    bra = c; /* ], line 124 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab1; }
+                        case 1:
+                            if (!r_R2()) { c = l - m_keep; goto lab1; } /* call R2, line 127 */
+                            slice_del(); /* delete, line 127 */
+                            break;
+                    }
+                lab1:
+                    ;
+                }
+                break;
+            case 7:
+                if (!r_R2()) return false; /* call R2, line 134 */
+                slice_del(); /* delete, line 134 */
+                {   int m_keep = l - c; /* try, line 135 */
+                    ket = c; /* [, line 136 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4198408 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab2; } /* substring, line 136 */
+                    among_var = find_among_b(data::a_4); /* substring, line 136 */
+                    if (!among_var) { c = l - m_keep; goto lab2; }
+                    bra = c; /* ], line 136 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab2; }
+                        case 1:
+                            if (!r_R2()) { c = l - m_keep; goto lab2; } /* call R2, line 139 */
+                            slice_del(); /* delete, line 139 */
+                            break;
+                    }
+                lab2:
+                    ;
+                }
+                break;
+            case 8:
+                if (!r_R2()) return false; /* call R2, line 146 */
+                slice_del(); /* delete, line 146 */
+                {   int m_keep = l - c; /* try, line 147 */
+                    ket = c; /* [, line 148 */
+                    if (!eq_s_b(data::s_8)) { c = l - m_keep; goto lab3; } /* literal, line 148 */
+                    bra = c; /* ], line 148 */
+                    if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 148 */
+                    slice_del(); /* delete, line 148 */
+                lab3:
+                    ;
+                }
+                break;
+            case 9:
+                if (!r_RV()) return false; /* call RV, line 153 */
+                if (!eq_s_b(data::s_9)) return false; /* literal, line 153 */
+                slice_from(data::s_10); /* <-, line 154 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 159 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 159 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 160 */
+            among_var = find_among_b(data::a_6); /* substring, line 160 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 160 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    slice_del(); /* delete, line 179 */
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_residual_suffix() {
+        int among_var;
+        ket = c; /* [, line 184 */
+        among_var = find_among_b(data::a_7); /* substring, line 184 */
+        if (!among_var) return false;
+        bra = c; /* ], line 184 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_RV()) return false; /* call RV, line 187 */
+                slice_del(); /* delete, line 187 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_residual_form() {
+        int among_var;
+        ket = c; /* [, line 192 */
+        among_var = find_among_b(data::a_8); /* substring, line 192 */
+        if (!among_var) return false;
+        bra = c; /* ], line 192 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_RV()) return false; /* call RV, line 194 */
+                slice_del(); /* delete, line 194 */
+                ket = c; /* [, line 194 */
+                {   int m1 = l - c; (void)m1; /* or, line 194 */
+                    if (!eq_s_b(data::s_11)) goto lab1; /* literal, line 194 */
+                    bra = c; /* ], line 194 */
+                    {   int m_test = l - c; /* test, line 194 */
+                        if (!eq_s_b(data::s_12)) goto lab1; /* literal, line 194 */
+                        c = l - m_test;
+                    }
+                    goto lab0;
+                lab1:
+                    c = l - m1;
+                    if (!eq_s_b(data::s_13)) return false; /* literal, line 195 */
+                    bra = c; /* ], line 195 */
+                    {   int m_test = l - c; /* test, line 195 */
+                        if (!eq_s_b(data::s_14)) return false; /* literal, line 195 */
+                        c = l - m_test;
+                    }
+                }
+            lab0:
+                if (!r_RV()) return false; /* call RV, line 195 */
+                slice_del(); /* delete, line 195 */
+                break;
+            case 2:
+                slice_from(data::s_15); /* <-, line 196 */
+                break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 202 */
+            if (!r_prelude()) goto lab0; /* call prelude, line 202 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 203 */
+            if (!r_mark_regions()) goto lab1; /* call mark_regions, line 203 */
+        lab1:
+            c = c2;
+        }
+        lb = c; c = l; /* backwards, line 204 */
+
+        {   int m3 = l - c; (void)m3; /* do, line 205 */
+            {   int m4 = l - c; (void)m4; /* or, line 209 */
+                {   int m5 = l - c; (void)m5; /* and, line 207 */
+                    {   int m6 = l - c; (void)m6; /* or, line 206 */
+                        if (!r_standard_suffix()) goto lab6; /* call standard_suffix, line 206 */
+                        goto lab5;
+                    lab6:
+                        c = l - m6;
+                        if (!r_verb_suffix()) goto lab4; /* call verb_suffix, line 206 */
+                    }
+                lab5:
+                    c = l - m5;
+                    {   int m7 = l - c; (void)m7; /* do, line 207 */
+                        ket = c; /* [, line 207 */
+                        if (!eq_s_b(data::s_16)) goto lab7; /* literal, line 207 */
+                        bra = c; /* ], line 207 */
+                        {   int m_test = l - c; /* test, line 207 */
+                            if (!eq_s_b(data::s_17)) goto lab7; /* literal, line 207 */
+                            c = l - m_test;
+                        }
+                        if (!r_RV()) goto lab7; /* call RV, line 207 */
+                        slice_del(); /* delete, line 207 */
+                    lab7:
+                        c = l - m7;
+                    }
+                }
+                goto lab3;
+            lab4:
+                c = l - m4;
+                if (!r_residual_suffix()) goto lab2; /* call residual_suffix, line 209 */
+            }
+        lab3:
+        lab2:
+            c = l - m3;
+        }
+        {   int m8 = l - c; (void)m8; /* do, line 211 */
+            if (!r_residual_form()) goto lab8; /* call residual_form, line 211 */
+        lab8:
+            c = l - m8;
+        }
+        c = lb;
+        {   int c9 = c; /* do, line 213 */
+            if (!r_postlude()) goto lab9; /* call postlude, line 213 */
+        lab9:
+            c = c9;
+        }
+        return true;
+    }
+
+  private:
+    int I_p2 = 0;
+    int I_p1 = 0;
+    int I_pV = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,1435 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_ROMANIAN_STEMMER_HPP
+#define SNOWBALL_ROMANIAN_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct romanian_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 32, 0, 0, 4 };
+};
+
+template <bool utf8> struct romanian_stemmer_data;
+
+template <>
+struct romanian_stemmer_data<true> : romanian_stemmer_groupings {
+    static constexpr unsigned char s_0_1[1] = { 'I' };
+    static constexpr unsigned char s_0_2[1] = { 'U' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_0_1, 0, 1, 0 },
+    /*  2 */ { 1, s_0_2, 0, 2, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[2] = { 'e', 'a' };
+    static constexpr unsigned char s_1_1[5] = { 'a', 0xC5, 0xA3, 'i', 'a' };
+    static constexpr unsigned char s_1_2[3] = { 'a', 'u', 'a' };
+    static constexpr unsigned char s_1_3[3] = { 'i', 'u', 'a' };
+    static constexpr unsigned char s_1_4[5] = { 'a', 0xC5, 0xA3, 'i', 'e' };
+    static constexpr unsigned char s_1_5[3] = { 'e', 'l', 'e' };
+    static constexpr unsigned char s_1_6[3] = { 'i', 'l', 'e' };
+    static constexpr unsigned char s_1_7[4] = { 'i', 'i', 'l', 'e' };
+    static constexpr unsigned char s_1_8[3] = { 'i', 'e', 'i' };
+    static constexpr unsigned char s_1_9[4] = { 'a', 't', 'e', 'i' };
+    static constexpr unsigned char s_1_10[2] = { 'i', 'i' };
+    static constexpr unsigned char s_1_11[4] = { 'u', 'l', 'u', 'i' };
+    static constexpr unsigned char s_1_12[2] = { 'u', 'l' };
+    static constexpr unsigned char s_1_13[4] = { 'e', 'l', 'o', 'r' };
+    static constexpr unsigned char s_1_14[4] = { 'i', 'l', 'o', 'r' };
+    static constexpr unsigned char s_1_15[5] = { 'i', 'i', 'l', 'o', 'r' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, 3, 0 },
+    /*  1 */ { 5, s_1_1, -1, 7, 0 },
+    /*  2 */ { 3, s_1_2, -1, 2, 0 },
+    /*  3 */ { 3, s_1_3, -1, 4, 0 },
+    /*  4 */ { 5, s_1_4, -1, 7, 0 },
+    /*  5 */ { 3, s_1_5, -1, 3, 0 },
+    /*  6 */ { 3, s_1_6, -1, 5, 0 },
+    /*  7 */ { 4, s_1_7, 6, 4, 0 },
+    /*  8 */ { 3, s_1_8, -1, 4, 0 },
+    /*  9 */ { 4, s_1_9, -1, 6, 0 },
+    /* 10 */ { 2, s_1_10, -1, 4, 0 },
+    /* 11 */ { 4, s_1_11, -1, 1, 0 },
+    /* 12 */ { 2, s_1_12, -1, 1, 0 },
+    /* 13 */ { 4, s_1_13, -1, 3, 0 },
+    /* 14 */ { 4, s_1_14, -1, 4, 0 },
+    /* 15 */ { 5, s_1_15, 14, 4, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[5] = { 'i', 'c', 'a', 'l', 'a' };
+    static constexpr unsigned char s_2_1[5] = { 'i', 'c', 'i', 'v', 'a' };
+    static constexpr unsigned char s_2_2[5] = { 'a', 't', 'i', 'v', 'a' };
+    static constexpr unsigned char s_2_3[5] = { 'i', 't', 'i', 'v', 'a' };
+    static constexpr unsigned char s_2_4[5] = { 'i', 'c', 'a', 'l', 'e' };
+    static constexpr unsigned char s_2_5[7] = { 'a', 0xC5, 0xA3, 'i', 'u', 'n', 'e' };
+    static constexpr unsigned char s_2_6[7] = { 'i', 0xC5, 0xA3, 'i', 'u', 'n', 'e' };
+    static constexpr unsigned char s_2_7[6] = { 'a', 't', 'o', 'a', 'r', 'e' };
+    static constexpr unsigned char s_2_8[6] = { 'i', 't', 'o', 'a', 'r', 'e' };
+    static constexpr unsigned char s_2_9[7] = { 0xC4, 0x83, 't', 'o', 'a', 'r', 'e' };
+    static constexpr unsigned char s_2_10[7] = { 'i', 'c', 'i', 't', 'a', 't', 'e' };
+    static constexpr unsigned char s_2_11[9] = { 'a', 'b', 'i', 'l', 'i', 't', 'a', 't', 'e' };
+    static constexpr unsigned char s_2_12[9] = { 'i', 'b', 'i', 'l', 'i', 't', 'a', 't', 'e' };
+    static constexpr unsigned char s_2_13[7] = { 'i', 'v', 'i', 't', 'a', 't', 'e' };
+    static constexpr unsigned char s_2_14[5] = { 'i', 'c', 'i', 'v', 'e' };
+    static constexpr unsigned char s_2_15[5] = { 'a', 't', 'i', 'v', 'e' };
+    static constexpr unsigned char s_2_16[5] = { 'i', 't', 'i', 'v', 'e' };
+    static constexpr unsigned char s_2_17[5] = { 'i', 'c', 'a', 'l', 'i' };
+    static constexpr unsigned char s_2_18[5] = { 'a', 't', 'o', 'r', 'i' };
+    static constexpr unsigned char s_2_19[7] = { 'i', 'c', 'a', 't', 'o', 'r', 'i' };
+    static constexpr unsigned char s_2_20[5] = { 'i', 't', 'o', 'r', 'i' };
+    static constexpr unsigned char s_2_21[6] = { 0xC4, 0x83, 't', 'o', 'r', 'i' };
+    static constexpr unsigned char s_2_22[7] = { 'i', 'c', 'i', 't', 'a', 't', 'i' };
+    static constexpr unsigned char s_2_23[9] = { 'a', 'b', 'i', 'l', 'i', 't', 'a', 't', 'i' };
+    static constexpr unsigned char s_2_24[7] = { 'i', 'v', 'i', 't', 'a', 't', 'i' };
+    static constexpr unsigned char s_2_25[5] = { 'i', 'c', 'i', 'v', 'i' };
+    static constexpr unsigned char s_2_26[5] = { 'a', 't', 'i', 'v', 'i' };
+    static constexpr unsigned char s_2_27[5] = { 'i', 't', 'i', 'v', 'i' };
+    static constexpr unsigned char s_2_28[7] = { 'i', 'c', 'i', 't', 0xC4, 0x83, 'i' };
+    static constexpr unsigned char s_2_29[9] = { 'a', 'b', 'i', 'l', 'i', 't', 0xC4, 0x83, 'i' };
+    static constexpr unsigned char s_2_30[7] = { 'i', 'v', 'i', 't', 0xC4, 0x83, 'i' };
+    static constexpr unsigned char s_2_31[9] = { 'i', 'c', 'i', 't', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_2_32[11] = { 'a', 'b', 'i', 'l', 'i', 't', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_2_33[9] = { 'i', 'v', 'i', 't', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_2_34[4] = { 'i', 'c', 'a', 'l' };
+    static constexpr unsigned char s_2_35[4] = { 'a', 't', 'o', 'r' };
+    static constexpr unsigned char s_2_36[6] = { 'i', 'c', 'a', 't', 'o', 'r' };
+    static constexpr unsigned char s_2_37[4] = { 'i', 't', 'o', 'r' };
+    static constexpr unsigned char s_2_38[5] = { 0xC4, 0x83, 't', 'o', 'r' };
+    static constexpr unsigned char s_2_39[4] = { 'i', 'c', 'i', 'v' };
+    static constexpr unsigned char s_2_40[4] = { 'a', 't', 'i', 'v' };
+    static constexpr unsigned char s_2_41[4] = { 'i', 't', 'i', 'v' };
+    static constexpr unsigned char s_2_42[6] = { 'i', 'c', 'a', 'l', 0xC4, 0x83 };
+    static constexpr unsigned char s_2_43[6] = { 'i', 'c', 'i', 'v', 0xC4, 0x83 };
+    static constexpr unsigned char s_2_44[6] = { 'a', 't', 'i', 'v', 0xC4, 0x83 };
+    static constexpr unsigned char s_2_45[6] = { 'i', 't', 'i', 'v', 0xC4, 0x83 };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 5, s_2_0, -1, 4, 0 },
+    /*  1 */ { 5, s_2_1, -1, 4, 0 },
+    /*  2 */ { 5, s_2_2, -1, 5, 0 },
+    /*  3 */ { 5, s_2_3, -1, 6, 0 },
+    /*  4 */ { 5, s_2_4, -1, 4, 0 },
+    /*  5 */ { 7, s_2_5, -1, 5, 0 },
+    /*  6 */ { 7, s_2_6, -1, 6, 0 },
+    /*  7 */ { 6, s_2_7, -1, 5, 0 },
+    /*  8 */ { 6, s_2_8, -1, 6, 0 },
+    /*  9 */ { 7, s_2_9, -1, 5, 0 },
+    /* 10 */ { 7, s_2_10, -1, 4, 0 },
+    /* 11 */ { 9, s_2_11, -1, 1, 0 },
+    /* 12 */ { 9, s_2_12, -1, 2, 0 },
+    /* 13 */ { 7, s_2_13, -1, 3, 0 },
+    /* 14 */ { 5, s_2_14, -1, 4, 0 },
+    /* 15 */ { 5, s_2_15, -1, 5, 0 },
+    /* 16 */ { 5, s_2_16, -1, 6, 0 },
+    /* 17 */ { 5, s_2_17, -1, 4, 0 },
+    /* 18 */ { 5, s_2_18, -1, 5, 0 },
+    /* 19 */ { 7, s_2_19, 18, 4, 0 },
+    /* 20 */ { 5, s_2_20, -1, 6, 0 },
+    /* 21 */ { 6, s_2_21, -1, 5, 0 },
+    /* 22 */ { 7, s_2_22, -1, 4, 0 },
+    /* 23 */ { 9, s_2_23, -1, 1, 0 },
+    /* 24 */ { 7, s_2_24, -1, 3, 0 },
+    /* 25 */ { 5, s_2_25, -1, 4, 0 },
+    /* 26 */ { 5, s_2_26, -1, 5, 0 },
+    /* 27 */ { 5, s_2_27, -1, 6, 0 },
+    /* 28 */ { 7, s_2_28, -1, 4, 0 },
+    /* 29 */ { 9, s_2_29, -1, 1, 0 },
+    /* 30 */ { 7, s_2_30, -1, 3, 0 },
+    /* 31 */ { 9, s_2_31, -1, 4, 0 },
+    /* 32 */ { 11, s_2_32, -1, 1, 0 },
+    /* 33 */ { 9, s_2_33, -1, 3, 0 },
+    /* 34 */ { 4, s_2_34, -1, 4, 0 },
+    /* 35 */ { 4, s_2_35, -1, 5, 0 },
+    /* 36 */ { 6, s_2_36, 35, 4, 0 },
+    /* 37 */ { 4, s_2_37, -1, 6, 0 },
+    /* 38 */ { 5, s_2_38, -1, 5, 0 },
+    /* 39 */ { 4, s_2_39, -1, 4, 0 },
+    /* 40 */ { 4, s_2_40, -1, 5, 0 },
+    /* 41 */ { 4, s_2_41, -1, 6, 0 },
+    /* 42 */ { 6, s_2_42, -1, 4, 0 },
+    /* 43 */ { 6, s_2_43, -1, 4, 0 },
+    /* 44 */ { 6, s_2_44, -1, 5, 0 },
+    /* 45 */ { 6, s_2_45, -1, 6, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[3] = { 'i', 'c', 'a' };
+    static constexpr unsigned char s_3_1[5] = { 'a', 'b', 'i', 'l', 'a' };
+    static constexpr unsigned char s_3_2[5] = { 'i', 'b', 'i', 'l', 'a' };
+    static constexpr unsigned char s_3_3[4] = { 'o', 'a', 's', 'a' };
+    static constexpr unsigned char s_3_4[3] = { 'a', 't', 'a' };
+    static constexpr unsigned char s_3_5[3] = { 'i', 't', 'a' };
+    static constexpr unsigned char s_3_6[4] = { 'a', 'n', 't', 'a' };
+    static constexpr unsigned char s_3_7[4] = { 'i', 's', 't', 'a' };
+    static constexpr unsigned char s_3_8[3] = { 'u', 't', 'a' };
+    static constexpr unsigned char s_3_9[3] = { 'i', 'v', 'a' };
+    static constexpr unsigned char s_3_10[2] = { 'i', 'c' };
+    static constexpr unsigned char s_3_11[3] = { 'i', 'c', 'e' };
+    static constexpr unsigned char s_3_12[5] = { 'a', 'b', 'i', 'l', 'e' };
+    static constexpr unsigned char s_3_13[5] = { 'i', 'b', 'i', 'l', 'e' };
+    static constexpr unsigned char s_3_14[4] = { 'i', 's', 'm', 'e' };
+    static constexpr unsigned char s_3_15[4] = { 'i', 'u', 'n', 'e' };
+    static constexpr unsigned char s_3_16[4] = { 'o', 'a', 's', 'e' };
+    static constexpr unsigned char s_3_17[3] = { 'a', 't', 'e' };
+    static constexpr unsigned char s_3_18[5] = { 'i', 't', 'a', 't', 'e' };
+    static constexpr unsigned char s_3_19[3] = { 'i', 't', 'e' };
+    static constexpr unsigned char s_3_20[4] = { 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_3_21[4] = { 'i', 's', 't', 'e' };
+    static constexpr unsigned char s_3_22[3] = { 'u', 't', 'e' };
+    static constexpr unsigned char s_3_23[3] = { 'i', 'v', 'e' };
+    static constexpr unsigned char s_3_24[3] = { 'i', 'c', 'i' };
+    static constexpr unsigned char s_3_25[5] = { 'a', 'b', 'i', 'l', 'i' };
+    static constexpr unsigned char s_3_26[5] = { 'i', 'b', 'i', 'l', 'i' };
+    static constexpr unsigned char s_3_27[4] = { 'i', 'u', 'n', 'i' };
+    static constexpr unsigned char s_3_28[5] = { 'a', 't', 'o', 'r', 'i' };
+    static constexpr unsigned char s_3_29[3] = { 'o', 's', 'i' };
+    static constexpr unsigned char s_3_30[3] = { 'a', 't', 'i' };
+    static constexpr unsigned char s_3_31[5] = { 'i', 't', 'a', 't', 'i' };
+    static constexpr unsigned char s_3_32[3] = { 'i', 't', 'i' };
+    static constexpr unsigned char s_3_33[4] = { 'a', 'n', 't', 'i' };
+    static constexpr unsigned char s_3_34[4] = { 'i', 's', 't', 'i' };
+    static constexpr unsigned char s_3_35[3] = { 'u', 't', 'i' };
+    static constexpr unsigned char s_3_36[5] = { 'i', 0xC5, 0x9F, 't', 'i' };
+    static constexpr unsigned char s_3_37[3] = { 'i', 'v', 'i' };
+    static constexpr unsigned char s_3_38[5] = { 'i', 't', 0xC4, 0x83, 'i' };
+    static constexpr unsigned char s_3_39[4] = { 'o', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_3_40[7] = { 'i', 't', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_3_41[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_3_42[4] = { 'i', 'b', 'i', 'l' };
+    static constexpr unsigned char s_3_43[3] = { 'i', 's', 'm' };
+    static constexpr unsigned char s_3_44[4] = { 'a', 't', 'o', 'r' };
+    static constexpr unsigned char s_3_45[2] = { 'o', 's' };
+    static constexpr unsigned char s_3_46[2] = { 'a', 't' };
+    static constexpr unsigned char s_3_47[2] = { 'i', 't' };
+    static constexpr unsigned char s_3_48[3] = { 'a', 'n', 't' };
+    static constexpr unsigned char s_3_49[3] = { 'i', 's', 't' };
+    static constexpr unsigned char s_3_50[2] = { 'u', 't' };
+    static constexpr unsigned char s_3_51[2] = { 'i', 'v' };
+    static constexpr unsigned char s_3_52[4] = { 'i', 'c', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_53[6] = { 'a', 'b', 'i', 'l', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_54[6] = { 'i', 'b', 'i', 'l', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_55[5] = { 'o', 'a', 's', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_56[4] = { 'a', 't', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_57[4] = { 'i', 't', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_58[5] = { 'a', 'n', 't', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_59[5] = { 'i', 's', 't', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_60[4] = { 'u', 't', 0xC4, 0x83 };
+    static constexpr unsigned char s_3_61[4] = { 'i', 'v', 0xC4, 0x83 };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 3, s_3_0, -1, 1, 0 },
+    /*  1 */ { 5, s_3_1, -1, 1, 0 },
+    /*  2 */ { 5, s_3_2, -1, 1, 0 },
+    /*  3 */ { 4, s_3_3, -1, 1, 0 },
+    /*  4 */ { 3, s_3_4, -1, 1, 0 },
+    /*  5 */ { 3, s_3_5, -1, 1, 0 },
+    /*  6 */ { 4, s_3_6, -1, 1, 0 },
+    /*  7 */ { 4, s_3_7, -1, 3, 0 },
+    /*  8 */ { 3, s_3_8, -1, 1, 0 },
+    /*  9 */ { 3, s_3_9, -1, 1, 0 },
+    /* 10 */ { 2, s_3_10, -1, 1, 0 },
+    /* 11 */ { 3, s_3_11, -1, 1, 0 },
+    /* 12 */ { 5, s_3_12, -1, 1, 0 },
+    /* 13 */ { 5, s_3_13, -1, 1, 0 },
+    /* 14 */ { 4, s_3_14, -1, 3, 0 },
+    /* 15 */ { 4, s_3_15, -1, 2, 0 },
+    /* 16 */ { 4, s_3_16, -1, 1, 0 },
+    /* 17 */ { 3, s_3_17, -1, 1, 0 },
+    /* 18 */ { 5, s_3_18, 17, 1, 0 },
+    /* 19 */ { 3, s_3_19, -1, 1, 0 },
+    /* 20 */ { 4, s_3_20, -1, 1, 0 },
+    /* 21 */ { 4, s_3_21, -1, 3, 0 },
+    /* 22 */ { 3, s_3_22, -1, 1, 0 },
+    /* 23 */ { 3, s_3_23, -1, 1, 0 },
+    /* 24 */ { 3, s_3_24, -1, 1, 0 },
+    /* 25 */ { 5, s_3_25, -1, 1, 0 },
+    /* 26 */ { 5, s_3_26, -1, 1, 0 },
+    /* 27 */ { 4, s_3_27, -1, 2, 0 },
+    /* 28 */ { 5, s_3_28, -1, 1, 0 },
+    /* 29 */ { 3, s_3_29, -1, 1, 0 },
+    /* 30 */ { 3, s_3_30, -1, 1, 0 },
+    /* 31 */ { 5, s_3_31, 30, 1, 0 },
+    /* 32 */ { 3, s_3_32, -1, 1, 0 },
+    /* 33 */ { 4, s_3_33, -1, 1, 0 },
+    /* 34 */ { 4, s_3_34, -1, 3, 0 },
+    /* 35 */ { 3, s_3_35, -1, 1, 0 },
+    /* 36 */ { 5, s_3_36, -1, 3, 0 },
+    /* 37 */ { 3, s_3_37, -1, 1, 0 },
+    /* 38 */ { 5, s_3_38, -1, 1, 0 },
+    /* 39 */ { 4, s_3_39, -1, 1, 0 },
+    /* 40 */ { 7, s_3_40, -1, 1, 0 },
+    /* 41 */ { 4, s_3_41, -1, 1, 0 },
+    /* 42 */ { 4, s_3_42, -1, 1, 0 },
+    /* 43 */ { 3, s_3_43, -1, 3, 0 },
+    /* 44 */ { 4, s_3_44, -1, 1, 0 },
+    /* 45 */ { 2, s_3_45, -1, 1, 0 },
+    /* 46 */ { 2, s_3_46, -1, 1, 0 },
+    /* 47 */ { 2, s_3_47, -1, 1, 0 },
+    /* 48 */ { 3, s_3_48, -1, 1, 0 },
+    /* 49 */ { 3, s_3_49, -1, 3, 0 },
+    /* 50 */ { 2, s_3_50, -1, 1, 0 },
+    /* 51 */ { 2, s_3_51, -1, 1, 0 },
+    /* 52 */ { 4, s_3_52, -1, 1, 0 },
+    /* 53 */ { 6, s_3_53, -1, 1, 0 },
+    /* 54 */ { 6, s_3_54, -1, 1, 0 },
+    /* 55 */ { 5, s_3_55, -1, 1, 0 },
+    /* 56 */ { 4, s_3_56, -1, 1, 0 },
+    /* 57 */ { 4, s_3_57, -1, 1, 0 },
+    /* 58 */ { 5, s_3_58, -1, 1, 0 },
+    /* 59 */ { 5, s_3_59, -1, 3, 0 },
+    /* 60 */ { 4, s_3_60, -1, 1, 0 },
+    /* 61 */ { 4, s_3_61, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[2] = { 'e', 'a' };
+    static constexpr unsigned char s_4_1[2] = { 'i', 'a' };
+    static constexpr unsigned char s_4_2[3] = { 'e', 's', 'c' };
+    static constexpr unsigned char s_4_3[4] = { 0xC4, 0x83, 's', 'c' };
+    static constexpr unsigned char s_4_4[3] = { 'i', 'n', 'd' };
+    static constexpr unsigned char s_4_5[4] = { 0xC3, 0xA2, 'n', 'd' };
+    static constexpr unsigned char s_4_6[3] = { 'a', 'r', 'e' };
+    static constexpr unsigned char s_4_7[3] = { 'e', 'r', 'e' };
+    static constexpr unsigned char s_4_8[3] = { 'i', 'r', 'e' };
+    static constexpr unsigned char s_4_9[4] = { 0xC3, 0xA2, 'r', 'e' };
+    static constexpr unsigned char s_4_10[2] = { 's', 'e' };
+    static constexpr unsigned char s_4_11[3] = { 'a', 's', 'e' };
+    static constexpr unsigned char s_4_12[4] = { 's', 'e', 's', 'e' };
+    static constexpr unsigned char s_4_13[3] = { 'i', 's', 'e' };
+    static constexpr unsigned char s_4_14[3] = { 'u', 's', 'e' };
+    static constexpr unsigned char s_4_15[4] = { 0xC3, 0xA2, 's', 'e' };
+    static constexpr unsigned char s_4_16[5] = { 'e', 0xC5, 0x9F, 't', 'e' };
+    static constexpr unsigned char s_4_17[6] = { 0xC4, 0x83, 0xC5, 0x9F, 't', 'e' };
+    static constexpr unsigned char s_4_18[3] = { 'e', 'z', 'e' };
+    static constexpr unsigned char s_4_19[2] = { 'a', 'i' };
+    static constexpr unsigned char s_4_20[3] = { 'e', 'a', 'i' };
+    static constexpr unsigned char s_4_21[3] = { 'i', 'a', 'i' };
+    static constexpr unsigned char s_4_22[3] = { 's', 'e', 'i' };
+    static constexpr unsigned char s_4_23[5] = { 'e', 0xC5, 0x9F, 't', 'i' };
+    static constexpr unsigned char s_4_24[6] = { 0xC4, 0x83, 0xC5, 0x9F, 't', 'i' };
+    static constexpr unsigned char s_4_25[2] = { 'u', 'i' };
+    static constexpr unsigned char s_4_26[3] = { 'e', 'z', 'i' };
+    static constexpr unsigned char s_4_27[3] = { 0xC3, 0xA2, 'i' };
+    static constexpr unsigned char s_4_28[4] = { 'a', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_29[5] = { 's', 'e', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_30[6] = { 'a', 's', 'e', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_31[7] = { 's', 'e', 's', 'e', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_32[6] = { 'i', 's', 'e', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_33[6] = { 'u', 's', 'e', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_34[7] = { 0xC3, 0xA2, 's', 'e', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_35[4] = { 'i', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_36[4] = { 'u', 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_37[5] = { 0xC3, 0xA2, 0xC5, 0x9F, 'i' };
+    static constexpr unsigned char s_4_38[4] = { 'a', 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_39[5] = { 'e', 'a', 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_40[5] = { 'i', 'a', 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_41[4] = { 'e', 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_42[4] = { 'i', 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_43[5] = { 0xC3, 0xA2, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_44[7] = { 'a', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_45[8] = { 's', 'e', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_46[9] = { 'a', 's', 'e', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_47[10] = { 's', 'e', 's', 'e', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_48[9] = { 'i', 's', 'e', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_49[9] = { 'u', 's', 'e', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_50[10] = { 0xC3, 0xA2, 's', 'e', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_51[7] = { 'i', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_52[7] = { 'u', 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_53[8] = { 0xC3, 0xA2, 'r', 0xC4, 0x83, 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_4_54[2] = { 'a', 'm' };
+    static constexpr unsigned char s_4_55[3] = { 'e', 'a', 'm' };
+    static constexpr unsigned char s_4_56[3] = { 'i', 'a', 'm' };
+    static constexpr unsigned char s_4_57[2] = { 'e', 'm' };
+    static constexpr unsigned char s_4_58[4] = { 'a', 's', 'e', 'm' };
+    static constexpr unsigned char s_4_59[5] = { 's', 'e', 's', 'e', 'm' };
+    static constexpr unsigned char s_4_60[4] = { 'i', 's', 'e', 'm' };
+    static constexpr unsigned char s_4_61[4] = { 'u', 's', 'e', 'm' };
+    static constexpr unsigned char s_4_62[5] = { 0xC3, 0xA2, 's', 'e', 'm' };
+    static constexpr unsigned char s_4_63[2] = { 'i', 'm' };
+    static constexpr unsigned char s_4_64[3] = { 0xC3, 0xA2, 'm' };
+    static constexpr unsigned char s_4_65[3] = { 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_66[5] = { 'a', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_67[6] = { 's', 'e', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_68[7] = { 'a', 's', 'e', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_69[8] = { 's', 'e', 's', 'e', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_70[7] = { 'i', 's', 'e', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_71[7] = { 'u', 's', 'e', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_72[8] = { 0xC3, 0xA2, 's', 'e', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_73[5] = { 'i', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_74[5] = { 'u', 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_75[6] = { 0xC3, 0xA2, 'r', 0xC4, 0x83, 'm' };
+    static constexpr unsigned char s_4_76[2] = { 'a', 'u' };
+    static constexpr unsigned char s_4_77[3] = { 'e', 'a', 'u' };
+    static constexpr unsigned char s_4_78[3] = { 'i', 'a', 'u' };
+    static constexpr unsigned char s_4_79[4] = { 'i', 'n', 'd', 'u' };
+    static constexpr unsigned char s_4_80[5] = { 0xC3, 0xA2, 'n', 'd', 'u' };
+    static constexpr unsigned char s_4_81[2] = { 'e', 'z' };
+    static constexpr unsigned char s_4_82[6] = { 'e', 'a', 's', 'c', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_83[4] = { 'a', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_84[5] = { 's', 'e', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_85[6] = { 'a', 's', 'e', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_86[7] = { 's', 'e', 's', 'e', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_87[6] = { 'i', 's', 'e', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_88[6] = { 'u', 's', 'e', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_89[7] = { 0xC3, 0xA2, 's', 'e', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_90[4] = { 'i', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_91[4] = { 'u', 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_92[5] = { 0xC3, 0xA2, 'r', 0xC4, 0x83 };
+    static constexpr unsigned char s_4_93[5] = { 'e', 'a', 'z', 0xC4, 0x83 };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 1, 0 },
+    /*  1 */ { 2, s_4_1, -1, 1, 0 },
+    /*  2 */ { 3, s_4_2, -1, 1, 0 },
+    /*  3 */ { 4, s_4_3, -1, 1, 0 },
+    /*  4 */ { 3, s_4_4, -1, 1, 0 },
+    /*  5 */ { 4, s_4_5, -1, 1, 0 },
+    /*  6 */ { 3, s_4_6, -1, 1, 0 },
+    /*  7 */ { 3, s_4_7, -1, 1, 0 },
+    /*  8 */ { 3, s_4_8, -1, 1, 0 },
+    /*  9 */ { 4, s_4_9, -1, 1, 0 },
+    /* 10 */ { 2, s_4_10, -1, 2, 0 },
+    /* 11 */ { 3, s_4_11, 10, 1, 0 },
+    /* 12 */ { 4, s_4_12, 10, 2, 0 },
+    /* 13 */ { 3, s_4_13, 10, 1, 0 },
+    /* 14 */ { 3, s_4_14, 10, 1, 0 },
+    /* 15 */ { 4, s_4_15, 10, 1, 0 },
+    /* 16 */ { 5, s_4_16, -1, 1, 0 },
+    /* 17 */ { 6, s_4_17, -1, 1, 0 },
+    /* 18 */ { 3, s_4_18, -1, 1, 0 },
+    /* 19 */ { 2, s_4_19, -1, 1, 0 },
+    /* 20 */ { 3, s_4_20, 19, 1, 0 },
+    /* 21 */ { 3, s_4_21, 19, 1, 0 },
+    /* 22 */ { 3, s_4_22, -1, 2, 0 },
+    /* 23 */ { 5, s_4_23, -1, 1, 0 },
+    /* 24 */ { 6, s_4_24, -1, 1, 0 },
+    /* 25 */ { 2, s_4_25, -1, 1, 0 },
+    /* 26 */ { 3, s_4_26, -1, 1, 0 },
+    /* 27 */ { 3, s_4_27, -1, 1, 0 },
+    /* 28 */ { 4, s_4_28, -1, 1, 0 },
+    /* 29 */ { 5, s_4_29, -1, 2, 0 },
+    /* 30 */ { 6, s_4_30, 29, 1, 0 },
+    /* 31 */ { 7, s_4_31, 29, 2, 0 },
+    /* 32 */ { 6, s_4_32, 29, 1, 0 },
+    /* 33 */ { 6, s_4_33, 29, 1, 0 },
+    /* 34 */ { 7, s_4_34, 29, 1, 0 },
+    /* 35 */ { 4, s_4_35, -1, 1, 0 },
+    /* 36 */ { 4, s_4_36, -1, 1, 0 },
+    /* 37 */ { 5, s_4_37, -1, 1, 0 },
+    /* 38 */ { 4, s_4_38, -1, 2, 0 },
+    /* 39 */ { 5, s_4_39, 38, 1, 0 },
+    /* 40 */ { 5, s_4_40, 38, 1, 0 },
+    /* 41 */ { 4, s_4_41, -1, 2, 0 },
+    /* 42 */ { 4, s_4_42, -1, 2, 0 },
+    /* 43 */ { 5, s_4_43, -1, 2, 0 },
+    /* 44 */ { 7, s_4_44, -1, 1, 0 },
+    /* 45 */ { 8, s_4_45, -1, 2, 0 },
+    /* 46 */ { 9, s_4_46, 45, 1, 0 },
+    /* 47 */ { 10, s_4_47, 45, 2, 0 },
+    /* 48 */ { 9, s_4_48, 45, 1, 0 },
+    /* 49 */ { 9, s_4_49, 45, 1, 0 },
+    /* 50 */ { 10, s_4_50, 45, 1, 0 },
+    /* 51 */ { 7, s_4_51, -1, 1, 0 },
+    /* 52 */ { 7, s_4_52, -1, 1, 0 },
+    /* 53 */ { 8, s_4_53, -1, 1, 0 },
+    /* 54 */ { 2, s_4_54, -1, 1, 0 },
+    /* 55 */ { 3, s_4_55, 54, 1, 0 },
+    /* 56 */ { 3, s_4_56, 54, 1, 0 },
+    /* 57 */ { 2, s_4_57, -1, 2, 0 },
+    /* 58 */ { 4, s_4_58, 57, 1, 0 },
+    /* 59 */ { 5, s_4_59, 57, 2, 0 },
+    /* 60 */ { 4, s_4_60, 57, 1, 0 },
+    /* 61 */ { 4, s_4_61, 57, 1, 0 },
+    /* 62 */ { 5, s_4_62, 57, 1, 0 },
+    /* 63 */ { 2, s_4_63, -1, 2, 0 },
+    /* 64 */ { 3, s_4_64, -1, 2, 0 },
+    /* 65 */ { 3, s_4_65, -1, 2, 0 },
+    /* 66 */ { 5, s_4_66, 65, 1, 0 },
+    /* 67 */ { 6, s_4_67, 65, 2, 0 },
+    /* 68 */ { 7, s_4_68, 67, 1, 0 },
+    /* 69 */ { 8, s_4_69, 67, 2, 0 },
+    /* 70 */ { 7, s_4_70, 67, 1, 0 },
+    /* 71 */ { 7, s_4_71, 67, 1, 0 },
+    /* 72 */ { 8, s_4_72, 67, 1, 0 },
+    /* 73 */ { 5, s_4_73, 65, 1, 0 },
+    /* 74 */ { 5, s_4_74, 65, 1, 0 },
+    /* 75 */ { 6, s_4_75, 65, 1, 0 },
+    /* 76 */ { 2, s_4_76, -1, 1, 0 },
+    /* 77 */ { 3, s_4_77, 76, 1, 0 },
+    /* 78 */ { 3, s_4_78, 76, 1, 0 },
+    /* 79 */ { 4, s_4_79, -1, 1, 0 },
+    /* 80 */ { 5, s_4_80, -1, 1, 0 },
+    /* 81 */ { 2, s_4_81, -1, 1, 0 },
+    /* 82 */ { 6, s_4_82, -1, 1, 0 },
+    /* 83 */ { 4, s_4_83, -1, 1, 0 },
+    /* 84 */ { 5, s_4_84, -1, 2, 0 },
+    /* 85 */ { 6, s_4_85, 84, 1, 0 },
+    /* 86 */ { 7, s_4_86, 84, 2, 0 },
+    /* 87 */ { 6, s_4_87, 84, 1, 0 },
+    /* 88 */ { 6, s_4_88, 84, 1, 0 },
+    /* 89 */ { 7, s_4_89, 84, 1, 0 },
+    /* 90 */ { 4, s_4_90, -1, 1, 0 },
+    /* 91 */ { 4, s_4_91, -1, 1, 0 },
+    /* 92 */ { 5, s_4_92, -1, 1, 0 },
+    /* 93 */ { 5, s_4_93, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[1] = { 'a' };
+    static constexpr unsigned char s_5_1[1] = { 'e' };
+    static constexpr unsigned char s_5_2[2] = { 'i', 'e' };
+    static constexpr unsigned char s_5_3[1] = { 'i' };
+    static constexpr unsigned char s_5_4[2] = { 0xC4, 0x83 };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 1, s_5_0, -1, 1, 0 },
+    /*  1 */ { 1, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, 1, 1, 0 },
+    /*  3 */ { 1, s_5_3, -1, 1, 0 },
+    /*  4 */ { 2, s_5_4, -1, 1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'u' };
+    static constexpr unsigned char s_1[] = { 'U' };
+    static constexpr unsigned char s_2[] = { 'i' };
+    static constexpr unsigned char s_3[] = { 'I' };
+    static constexpr unsigned char s_4[] = { 'i' };
+    static constexpr unsigned char s_5[] = { 'u' };
+    static constexpr unsigned char s_6[] = { 'a' };
+    static constexpr unsigned char s_7[] = { 'e' };
+    static constexpr unsigned char s_8[] = { 'i' };
+    static constexpr unsigned char s_9[] = { 'a', 'b' };
+    static constexpr unsigned char s_10[] = { 'i' };
+    static constexpr unsigned char s_11[] = { 'a', 't' };
+    static constexpr unsigned char s_12[] = { 'a', 0xC5, 0xA3, 'i' };
+    static constexpr unsigned char s_13[] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_14[] = { 'i', 'b', 'i', 'l' };
+    static constexpr unsigned char s_15[] = { 'i', 'v' };
+    static constexpr unsigned char s_16[] = { 'i', 'c' };
+    static constexpr unsigned char s_17[] = { 'a', 't' };
+    static constexpr unsigned char s_18[] = { 'i', 't' };
+    static constexpr unsigned char s_19[] = { 0xC5, 0xA3 };
+    static constexpr unsigned char s_20[] = { 't' };
+    static constexpr unsigned char s_21[] = { 'i', 's', 't' };
+    static constexpr unsigned char s_22[] = { 'u' };
+};
+
+template <>
+struct romanian_stemmer_data<false> : romanian_stemmer_groupings {
+    static constexpr char32_t s_0_1[1] = { 'I' };
+    static constexpr char32_t s_0_2[1] = { 'U' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 3, 0 },
+    /*  1 */ { 1, s_0_1, 0, 1, 0 },
+    /*  2 */ { 1, s_0_2, 0, 2, 0 }
+    };
+
+    static constexpr char32_t s_1_0[2] = { 'e', 'a' };
+    static constexpr char32_t s_1_1[4] = { 'a', 0x163, 'i', 'a' };
+    static constexpr char32_t s_1_2[3] = { 'a', 'u', 'a' };
+    static constexpr char32_t s_1_3[3] = { 'i', 'u', 'a' };
+    static constexpr char32_t s_1_4[4] = { 'a', 0x163, 'i', 'e' };
+    static constexpr char32_t s_1_5[3] = { 'e', 'l', 'e' };
+    static constexpr char32_t s_1_6[3] = { 'i', 'l', 'e' };
+    static constexpr char32_t s_1_7[4] = { 'i', 'i', 'l', 'e' };
+    static constexpr char32_t s_1_8[3] = { 'i', 'e', 'i' };
+    static constexpr char32_t s_1_9[4] = { 'a', 't', 'e', 'i' };
+    static constexpr char32_t s_1_10[2] = { 'i', 'i' };
+    static constexpr char32_t s_1_11[4] = { 'u', 'l', 'u', 'i' };
+    static constexpr char32_t s_1_12[2] = { 'u', 'l' };
+    static constexpr char32_t s_1_13[4] = { 'e', 'l', 'o', 'r' };
+    static constexpr char32_t s_1_14[4] = { 'i', 'l', 'o', 'r' };
+    static constexpr char32_t s_1_15[5] = { 'i', 'i', 'l', 'o', 'r' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, 3, 0 },
+    /*  1 */ { 4, s_1_1, -1, 7, 0 },
+    /*  2 */ { 3, s_1_2, -1, 2, 0 },
+    /*  3 */ { 3, s_1_3, -1, 4, 0 },
+    /*  4 */ { 4, s_1_4, -1, 7, 0 },
+    /*  5 */ { 3, s_1_5, -1, 3, 0 },
+    /*  6 */ { 3, s_1_6, -1, 5, 0 },
+    /*  7 */ { 4, s_1_7, 6, 4, 0 },
+    /*  8 */ { 3, s_1_8, -1, 4, 0 },
+    /*  9 */ { 4, s_1_9, -1, 6, 0 },
+    /* 10 */ { 2, s_1_10, -1, 4, 0 },
+    /* 11 */ { 4, s_1_11, -1, 1, 0 },
+    /* 12 */ { 2, s_1_12, -1, 1, 0 },
+    /* 13 */ { 4, s_1_13, -1, 3, 0 },
+    /* 14 */ { 4, s_1_14, -1, 4, 0 },
+    /* 15 */ { 5, s_1_15, 14, 4, 0 }
+    };
+
+    static constexpr char32_t s_2_0[5] = { 'i', 'c', 'a', 'l', 'a' };
+    static constexpr char32_t s_2_1[5] = { 'i', 'c', 'i', 'v', 'a' };
+    static constexpr char32_t s_2_2[5] = { 'a', 't', 'i', 'v', 'a' };
+    static constexpr char32_t s_2_3[5] = { 'i', 't', 'i', 'v', 'a' };
+    static constexpr char32_t s_2_4[5] = { 'i', 'c', 'a', 'l', 'e' };
+    static constexpr char32_t s_2_5[6] = { 'a', 0x163, 'i', 'u', 'n', 'e' };
+    static constexpr char32_t s_2_6[6] = { 'i', 0x163, 'i', 'u', 'n', 'e' };
+    static constexpr char32_t s_2_7[6] = { 'a', 't', 'o', 'a', 'r', 'e' };
+    static constexpr char32_t s_2_8[6] = { 'i', 't', 'o', 'a', 'r', 'e' };
+    static constexpr char32_t s_2_9[6] = { 0x103, 't', 'o', 'a', 'r', 'e' };
+    static constexpr char32_t s_2_10[7] = { 'i', 'c', 'i', 't', 'a', 't', 'e' };
+    static constexpr char32_t s_2_11[9] = { 'a', 'b', 'i', 'l', 'i', 't', 'a', 't', 'e' };
+    static constexpr char32_t s_2_12[9] = { 'i', 'b', 'i', 'l', 'i', 't', 'a', 't', 'e' };
+    static constexpr char32_t s_2_13[7] = { 'i', 'v', 'i', 't', 'a', 't', 'e' };
+    static constexpr char32_t s_2_14[5] = { 'i', 'c', 'i', 'v', 'e' };
+    static constexpr char32_t s_2_15[5] = { 'a', 't', 'i', 'v', 'e' };
+    static constexpr char32_t s_2_16[5] = { 'i', 't', 'i', 'v', 'e' };
+    static constexpr char32_t s_2_17[5] = { 'i', 'c', 'a', 'l', 'i' };
+    static constexpr char32_t s_2_18[5] = { 'a', 't', 'o', 'r', 'i' };
+    static constexpr char32_t s_2_19[7] = { 'i', 'c', 'a', 't', 'o', 'r', 'i' };
+    static constexpr char32_t s_2_20[5] = { 'i', 't', 'o', 'r', 'i' };
+    static constexpr char32_t s_2_21[5] = { 0x103, 't', 'o', 'r', 'i' };
+    static constexpr char32_t s_2_22[7] = { 'i', 'c', 'i', 't', 'a', 't', 'i' };
+    static constexpr char32_t s_2_23[9] = { 'a', 'b', 'i', 'l', 'i', 't', 'a', 't', 'i' };
+    static constexpr char32_t s_2_24[7] = { 'i', 'v', 'i', 't', 'a', 't', 'i' };
+    static constexpr char32_t s_2_25[5] = { 'i', 'c', 'i', 'v', 'i' };
+    static constexpr char32_t s_2_26[5] = { 'a', 't', 'i', 'v', 'i' };
+    static constexpr char32_t s_2_27[5] = { 'i', 't', 'i', 'v', 'i' };
+    static constexpr char32_t s_2_28[6] = { 'i', 'c', 'i', 't', 0x103, 'i' };
+    static constexpr char32_t s_2_29[8] = { 'a', 'b', 'i', 'l', 'i', 't', 0x103, 'i' };
+    static constexpr char32_t s_2_30[6] = { 'i', 'v', 'i', 't', 0x103, 'i' };
+    static constexpr char32_t s_2_31[7] = { 'i', 'c', 'i', 't', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_2_32[9] = { 'a', 'b', 'i', 'l', 'i', 't', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_2_33[7] = { 'i', 'v', 'i', 't', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_2_34[4] = { 'i', 'c', 'a', 'l' };
+    static constexpr char32_t s_2_35[4] = { 'a', 't', 'o', 'r' };
+    static constexpr char32_t s_2_36[6] = { 'i', 'c', 'a', 't', 'o', 'r' };
+    static constexpr char32_t s_2_37[4] = { 'i', 't', 'o', 'r' };
+    static constexpr char32_t s_2_38[4] = { 0x103, 't', 'o', 'r' };
+    static constexpr char32_t s_2_39[4] = { 'i', 'c', 'i', 'v' };
+    static constexpr char32_t s_2_40[4] = { 'a', 't', 'i', 'v' };
+    static constexpr char32_t s_2_41[4] = { 'i', 't', 'i', 'v' };
+    static constexpr char32_t s_2_42[5] = { 'i', 'c', 'a', 'l', 0x103 };
+    static constexpr char32_t s_2_43[5] = { 'i', 'c', 'i', 'v', 0x103 };
+    static constexpr char32_t s_2_44[5] = { 'a', 't', 'i', 'v', 0x103 };
+    static constexpr char32_t s_2_45[5] = { 'i', 't', 'i', 'v', 0x103 };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 5, s_2_0, -1, 4, 0 },
+    /*  1 */ { 5, s_2_1, -1, 4, 0 },
+    /*  2 */ { 5, s_2_2, -1, 5, 0 },
+    /*  3 */ { 5, s_2_3, -1, 6, 0 },
+    /*  4 */ { 5, s_2_4, -1, 4, 0 },
+    /*  5 */ { 6, s_2_5, -1, 5, 0 },
+    /*  6 */ { 6, s_2_6, -1, 6, 0 },
+    /*  7 */ { 6, s_2_7, -1, 5, 0 },
+    /*  8 */ { 6, s_2_8, -1, 6, 0 },
+    /*  9 */ { 6, s_2_9, -1, 5, 0 },
+    /* 10 */ { 7, s_2_10, -1, 4, 0 },
+    /* 11 */ { 9, s_2_11, -1, 1, 0 },
+    /* 12 */ { 9, s_2_12, -1, 2, 0 },
+    /* 13 */ { 7, s_2_13, -1, 3, 0 },
+    /* 14 */ { 5, s_2_14, -1, 4, 0 },
+    /* 15 */ { 5, s_2_15, -1, 5, 0 },
+    /* 16 */ { 5, s_2_16, -1, 6, 0 },
+    /* 17 */ { 5, s_2_17, -1, 4, 0 },
+    /* 18 */ { 5, s_2_18, -1, 5, 0 },
+    /* 19 */ { 7, s_2_19, 18, 4, 0 },
+    /* 20 */ { 5, s_2_20, -1, 6, 0 },
+    /* 21 */ { 5, s_2_21, -1, 5, 0 },
+    /* 22 */ { 7, s_2_22, -1, 4, 0 },
+    /* 23 */ { 9, s_2_23, -1, 1, 0 },
+    /* 24 */ { 7, s_2_24, -1, 3, 0 },
+    /* 25 */ { 5, s_2_25, -1, 4, 0 },
+    /* 26 */ { 5, s_2_26, -1, 5, 0 },
+    /* 27 */ { 5, s_2_27, -1, 6, 0 },
+    /* 28 */ { 6, s_2_28, -1, 4, 0 },
+    /* 29 */ { 8, s_2_29, -1, 1, 0 },
+    /* 30 */ { 6, s_2_30, -1, 3, 0 },
+    /* 31 */ { 7, s_2_31, -1, 4, 0 },
+    /* 32 */ { 9, s_2_32, -1, 1, 0 },
+    /* 33 */ { 7, s_2_33, -1, 3, 0 },
+    /* 34 */ { 4, s_2_34, -1, 4, 0 },
+    /* 35 */ { 4, s_2_35, -1, 5, 0 },
+    /* 36 */ { 6, s_2_36, 35, 4, 0 },
+    /* 37 */ { 4, s_2_37, -1, 6, 0 },
+    /* 38 */ { 4, s_2_38, -1, 5, 0 },
+    /* 39 */ { 4, s_2_39, -1, 4, 0 },
+    /* 40 */ { 4, s_2_40, -1, 5, 0 },
+    /* 41 */ { 4, s_2_41, -1, 6, 0 },
+    /* 42 */ { 5, s_2_42, -1, 4, 0 },
+    /* 43 */ { 5, s_2_43, -1, 4, 0 },
+    /* 44 */ { 5, s_2_44, -1, 5, 0 },
+    /* 45 */ { 5, s_2_45, -1, 6, 0 }
+    };
+
+    static constexpr char32_t s_3_0[3] = { 'i', 'c', 'a' };
+    static constexpr char32_t s_3_1[5] = { 'a', 'b', 'i', 'l', 'a' };
+    static constexpr char32_t s_3_2[5] = { 'i', 'b', 'i', 'l', 'a' };
+    static constexpr char32_t s_3_3[4] = { 'o', 'a', 's', 'a' };
+    static constexpr char32_t s_3_4[3] = { 'a', 't', 'a' };
+    static constexpr char32_t s_3_5[3] = { 'i', 't', 'a' };
+    static constexpr char32_t s_3_6[4] = { 'a', 'n', 't', 'a' };
+    static constexpr char32_t s_3_7[4] = { 'i', 's', 't', 'a' };
+    static constexpr char32_t s_3_8[3] = { 'u', 't', 'a' };
+    static constexpr char32_t s_3_9[3] = { 'i', 'v', 'a' };
+    static constexpr char32_t s_3_10[2] = { 'i', 'c' };
+    static constexpr char32_t s_3_11[3] = { 'i', 'c', 'e' };
+    static constexpr char32_t s_3_12[5] = { 'a', 'b', 'i', 'l', 'e' };
+    static constexpr char32_t s_3_13[5] = { 'i', 'b', 'i', 'l', 'e' };
+    static constexpr char32_t s_3_14[4] = { 'i', 's', 'm', 'e' };
+    static constexpr char32_t s_3_15[4] = { 'i', 'u', 'n', 'e' };
+    static constexpr char32_t s_3_16[4] = { 'o', 'a', 's', 'e' };
+    static constexpr char32_t s_3_17[3] = { 'a', 't', 'e' };
+    static constexpr char32_t s_3_18[5] = { 'i', 't', 'a', 't', 'e' };
+    static constexpr char32_t s_3_19[3] = { 'i', 't', 'e' };
+    static constexpr char32_t s_3_20[4] = { 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_3_21[4] = { 'i', 's', 't', 'e' };
+    static constexpr char32_t s_3_22[3] = { 'u', 't', 'e' };
+    static constexpr char32_t s_3_23[3] = { 'i', 'v', 'e' };
+    static constexpr char32_t s_3_24[3] = { 'i', 'c', 'i' };
+    static constexpr char32_t s_3_25[5] = { 'a', 'b', 'i', 'l', 'i' };
+    static constexpr char32_t s_3_26[5] = { 'i', 'b', 'i', 'l', 'i' };
+    static constexpr char32_t s_3_27[4] = { 'i', 'u', 'n', 'i' };
+    static constexpr char32_t s_3_28[5] = { 'a', 't', 'o', 'r', 'i' };
+    static constexpr char32_t s_3_29[3] = { 'o', 's', 'i' };
+    static constexpr char32_t s_3_30[3] = { 'a', 't', 'i' };
+    static constexpr char32_t s_3_31[5] = { 'i', 't', 'a', 't', 'i' };
+    static constexpr char32_t s_3_32[3] = { 'i', 't', 'i' };
+    static constexpr char32_t s_3_33[4] = { 'a', 'n', 't', 'i' };
+    static constexpr char32_t s_3_34[4] = { 'i', 's', 't', 'i' };
+    static constexpr char32_t s_3_35[3] = { 'u', 't', 'i' };
+    static constexpr char32_t s_3_36[4] = { 'i', 0x15F, 't', 'i' };
+    static constexpr char32_t s_3_37[3] = { 'i', 'v', 'i' };
+    static constexpr char32_t s_3_38[4] = { 'i', 't', 0x103, 'i' };
+    static constexpr char32_t s_3_39[3] = { 'o', 0x15F, 'i' };
+    static constexpr char32_t s_3_40[5] = { 'i', 't', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_3_41[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_3_42[4] = { 'i', 'b', 'i', 'l' };
+    static constexpr char32_t s_3_43[3] = { 'i', 's', 'm' };
+    static constexpr char32_t s_3_44[4] = { 'a', 't', 'o', 'r' };
+    static constexpr char32_t s_3_45[2] = { 'o', 's' };
+    static constexpr char32_t s_3_46[2] = { 'a', 't' };
+    static constexpr char32_t s_3_47[2] = { 'i', 't' };
+    static constexpr char32_t s_3_48[3] = { 'a', 'n', 't' };
+    static constexpr char32_t s_3_49[3] = { 'i', 's', 't' };
+    static constexpr char32_t s_3_50[2] = { 'u', 't' };
+    static constexpr char32_t s_3_51[2] = { 'i', 'v' };
+    static constexpr char32_t s_3_52[3] = { 'i', 'c', 0x103 };
+    static constexpr char32_t s_3_53[5] = { 'a', 'b', 'i', 'l', 0x103 };
+    static constexpr char32_t s_3_54[5] = { 'i', 'b', 'i', 'l', 0x103 };
+    static constexpr char32_t s_3_55[4] = { 'o', 'a', 's', 0x103 };
+    static constexpr char32_t s_3_56[3] = { 'a', 't', 0x103 };
+    static constexpr char32_t s_3_57[3] = { 'i', 't', 0x103 };
+    static constexpr char32_t s_3_58[4] = { 'a', 'n', 't', 0x103 };
+    static constexpr char32_t s_3_59[4] = { 'i', 's', 't', 0x103 };
+    static constexpr char32_t s_3_60[3] = { 'u', 't', 0x103 };
+    static constexpr char32_t s_3_61[3] = { 'i', 'v', 0x103 };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 3, s_3_0, -1, 1, 0 },
+    /*  1 */ { 5, s_3_1, -1, 1, 0 },
+    /*  2 */ { 5, s_3_2, -1, 1, 0 },
+    /*  3 */ { 4, s_3_3, -1, 1, 0 },
+    /*  4 */ { 3, s_3_4, -1, 1, 0 },
+    /*  5 */ { 3, s_3_5, -1, 1, 0 },
+    /*  6 */ { 4, s_3_6, -1, 1, 0 },
+    /*  7 */ { 4, s_3_7, -1, 3, 0 },
+    /*  8 */ { 3, s_3_8, -1, 1, 0 },
+    /*  9 */ { 3, s_3_9, -1, 1, 0 },
+    /* 10 */ { 2, s_3_10, -1, 1, 0 },
+    /* 11 */ { 3, s_3_11, -1, 1, 0 },
+    /* 12 */ { 5, s_3_12, -1, 1, 0 },
+    /* 13 */ { 5, s_3_13, -1, 1, 0 },
+    /* 14 */ { 4, s_3_14, -1, 3, 0 },
+    /* 15 */ { 4, s_3_15, -1, 2, 0 },
+    /* 16 */ { 4, s_3_16, -1, 1, 0 },
+    /* 17 */ { 3, s_3_17, -1, 1, 0 },
+    /* 18 */ { 5, s_3_18, 17, 1, 0 },
+    /* 19 */ { 3, s_3_19, -1, 1, 0 },
+    /* 20 */ { 4, s_3_20, -1, 1, 0 },
+    /* 21 */ { 4, s_3_21, -1, 3, 0 },
+    /* 22 */ { 3, s_3_22, -1, 1, 0 },
+    /* 23 */ { 3, s_3_23, -1, 1, 0 },
+    /* 24 */ { 3, s_3_24, -1, 1, 0 },
+    /* 25 */ { 5, s_3_25, -1, 1, 0 },
+    /* 26 */ { 5, s_3_26, -1, 1, 0 },
+    /* 27 */ { 4, s_3_27, -1, 2, 0 },
+    /* 28 */ { 5, s_3_28, -1, 1, 0 },
+    /* 29 */ { 3, s_3_29, -1, 1, 0 },
+    /* 30 */ { 3, s_3_30, -1, 1, 0 },
+    /* 31 */ { 5, s_3_31, 30, 1, 0 },
+    /* 32 */ { 3, s_3_32, -1, 1, 0 },
+    /* 33 */ { 4, s_3_33, -1, 1, 0 },
+    /* 34 */ { 4, s_3_34, -1, 3, 0 },
+    /* 35 */ { 3, s_3_35, -1, 1, 0 },
+    /* 36 */ { 4, s_3_36, -1, 3, 0 },
+    /* 37 */ { 3, s_3_37, -1, 1, 0 },
+    /* 38 */ { 4, s_3_38, -1, 1, 0 },
+    /* 39 */ { 3, s_3_39, -1, 1, 0 },
+    /* 40 */ { 5, s_3_40, -1, 1, 0 },
+    /* 41 */ { 4, s_3_41, -1, 1, 0 },
+    /* 42 */ { 4, s_3_42, -1, 1, 0 },
+    /* 43 */ { 3, s_3_43, -1, 3, 0 },
+    /* 44 */ { 4, s_3_44, -1, 1, 0 },
+    /* 45 */ { 2, s_3_45, -1, 1, 0 },
+    /* 46 */ { 2, s_3_46, -1, 1, 0 },
+    /* 47 */ { 2, s_3_47, -1, 1, 0 },
+    /* 48 */ { 3, s_3_48, -1, 1, 0 },
+    /* 49 */ { 3, s_3_49, -1, 3, 0 },
+    /* 50 */ { 2, s_3_50, -1, 1, 0 },
+    /* 51 */ { 2, s_3_51, -1, 1, 0 },
+    /* 52 */ { 3, s_3_52, -1, 1, 0 },
+    /* 53 */ { 5, s_3_53, -1, 1, 0 },
+    /* 54 */ { 5, s_3_54, -1, 1, 0 },
+    /* 55 */ { 4, s_3_55, -1, 1, 0 },
+    /* 56 */ { 3, s_3_56, -1, 1, 0 },
+    /* 57 */ { 3, s_3_57, -1, 1, 0 },
+    /* 58 */ { 4, s_3_58, -1, 1, 0 },
+    /* 59 */ { 4, s_3_59, -1, 3, 0 },
+    /* 60 */ { 3, s_3_60, -1, 1, 0 },
+    /* 61 */ { 3, s_3_61, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[2] = { 'e', 'a' };
+    static constexpr char32_t s_4_1[2] = { 'i', 'a' };
+    static constexpr char32_t s_4_2[3] = { 'e', 's', 'c' };
+    static constexpr char32_t s_4_3[3] = { 0x103, 's', 'c' };
+    static constexpr char32_t s_4_4[3] = { 'i', 'n', 'd' };
+    static constexpr char32_t s_4_5[3] = { 0xE2, 'n', 'd' };
+    static constexpr char32_t s_4_6[3] = { 'a', 'r', 'e' };
+    static constexpr char32_t s_4_7[3] = { 'e', 'r', 'e' };
+    static constexpr char32_t s_4_8[3] = { 'i', 'r', 'e' };
+    static constexpr char32_t s_4_9[3] = { 0xE2, 'r', 'e' };
+    static constexpr char32_t s_4_10[2] = { 's', 'e' };
+    static constexpr char32_t s_4_11[3] = { 'a', 's', 'e' };
+    static constexpr char32_t s_4_12[4] = { 's', 'e', 's', 'e' };
+    static constexpr char32_t s_4_13[3] = { 'i', 's', 'e' };
+    static constexpr char32_t s_4_14[3] = { 'u', 's', 'e' };
+    static constexpr char32_t s_4_15[3] = { 0xE2, 's', 'e' };
+    static constexpr char32_t s_4_16[4] = { 'e', 0x15F, 't', 'e' };
+    static constexpr char32_t s_4_17[4] = { 0x103, 0x15F, 't', 'e' };
+    static constexpr char32_t s_4_18[3] = { 'e', 'z', 'e' };
+    static constexpr char32_t s_4_19[2] = { 'a', 'i' };
+    static constexpr char32_t s_4_20[3] = { 'e', 'a', 'i' };
+    static constexpr char32_t s_4_21[3] = { 'i', 'a', 'i' };
+    static constexpr char32_t s_4_22[3] = { 's', 'e', 'i' };
+    static constexpr char32_t s_4_23[4] = { 'e', 0x15F, 't', 'i' };
+    static constexpr char32_t s_4_24[4] = { 0x103, 0x15F, 't', 'i' };
+    static constexpr char32_t s_4_25[2] = { 'u', 'i' };
+    static constexpr char32_t s_4_26[3] = { 'e', 'z', 'i' };
+    static constexpr char32_t s_4_27[2] = { 0xE2, 'i' };
+    static constexpr char32_t s_4_28[3] = { 'a', 0x15F, 'i' };
+    static constexpr char32_t s_4_29[4] = { 's', 'e', 0x15F, 'i' };
+    static constexpr char32_t s_4_30[5] = { 'a', 's', 'e', 0x15F, 'i' };
+    static constexpr char32_t s_4_31[6] = { 's', 'e', 's', 'e', 0x15F, 'i' };
+    static constexpr char32_t s_4_32[5] = { 'i', 's', 'e', 0x15F, 'i' };
+    static constexpr char32_t s_4_33[5] = { 'u', 's', 'e', 0x15F, 'i' };
+    static constexpr char32_t s_4_34[5] = { 0xE2, 's', 'e', 0x15F, 'i' };
+    static constexpr char32_t s_4_35[3] = { 'i', 0x15F, 'i' };
+    static constexpr char32_t s_4_36[3] = { 'u', 0x15F, 'i' };
+    static constexpr char32_t s_4_37[3] = { 0xE2, 0x15F, 'i' };
+    static constexpr char32_t s_4_38[3] = { 'a', 0x163, 'i' };
+    static constexpr char32_t s_4_39[4] = { 'e', 'a', 0x163, 'i' };
+    static constexpr char32_t s_4_40[4] = { 'i', 'a', 0x163, 'i' };
+    static constexpr char32_t s_4_41[3] = { 'e', 0x163, 'i' };
+    static constexpr char32_t s_4_42[3] = { 'i', 0x163, 'i' };
+    static constexpr char32_t s_4_43[3] = { 0xE2, 0x163, 'i' };
+    static constexpr char32_t s_4_44[5] = { 'a', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_45[6] = { 's', 'e', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_46[7] = { 'a', 's', 'e', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_47[8] = { 's', 'e', 's', 'e', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_48[7] = { 'i', 's', 'e', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_49[7] = { 'u', 's', 'e', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_50[7] = { 0xE2, 's', 'e', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_51[5] = { 'i', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_52[5] = { 'u', 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_53[5] = { 0xE2, 'r', 0x103, 0x163, 'i' };
+    static constexpr char32_t s_4_54[2] = { 'a', 'm' };
+    static constexpr char32_t s_4_55[3] = { 'e', 'a', 'm' };
+    static constexpr char32_t s_4_56[3] = { 'i', 'a', 'm' };
+    static constexpr char32_t s_4_57[2] = { 'e', 'm' };
+    static constexpr char32_t s_4_58[4] = { 'a', 's', 'e', 'm' };
+    static constexpr char32_t s_4_59[5] = { 's', 'e', 's', 'e', 'm' };
+    static constexpr char32_t s_4_60[4] = { 'i', 's', 'e', 'm' };
+    static constexpr char32_t s_4_61[4] = { 'u', 's', 'e', 'm' };
+    static constexpr char32_t s_4_62[4] = { 0xE2, 's', 'e', 'm' };
+    static constexpr char32_t s_4_63[2] = { 'i', 'm' };
+    static constexpr char32_t s_4_64[2] = { 0xE2, 'm' };
+    static constexpr char32_t s_4_65[2] = { 0x103, 'm' };
+    static constexpr char32_t s_4_66[4] = { 'a', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_67[5] = { 's', 'e', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_68[6] = { 'a', 's', 'e', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_69[7] = { 's', 'e', 's', 'e', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_70[6] = { 'i', 's', 'e', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_71[6] = { 'u', 's', 'e', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_72[6] = { 0xE2, 's', 'e', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_73[4] = { 'i', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_74[4] = { 'u', 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_75[4] = { 0xE2, 'r', 0x103, 'm' };
+    static constexpr char32_t s_4_76[2] = { 'a', 'u' };
+    static constexpr char32_t s_4_77[3] = { 'e', 'a', 'u' };
+    static constexpr char32_t s_4_78[3] = { 'i', 'a', 'u' };
+    static constexpr char32_t s_4_79[4] = { 'i', 'n', 'd', 'u' };
+    static constexpr char32_t s_4_80[4] = { 0xE2, 'n', 'd', 'u' };
+    static constexpr char32_t s_4_81[2] = { 'e', 'z' };
+    static constexpr char32_t s_4_82[5] = { 'e', 'a', 's', 'c', 0x103 };
+    static constexpr char32_t s_4_83[3] = { 'a', 'r', 0x103 };
+    static constexpr char32_t s_4_84[4] = { 's', 'e', 'r', 0x103 };
+    static constexpr char32_t s_4_85[5] = { 'a', 's', 'e', 'r', 0x103 };
+    static constexpr char32_t s_4_86[6] = { 's', 'e', 's', 'e', 'r', 0x103 };
+    static constexpr char32_t s_4_87[5] = { 'i', 's', 'e', 'r', 0x103 };
+    static constexpr char32_t s_4_88[5] = { 'u', 's', 'e', 'r', 0x103 };
+    static constexpr char32_t s_4_89[5] = { 0xE2, 's', 'e', 'r', 0x103 };
+    static constexpr char32_t s_4_90[3] = { 'i', 'r', 0x103 };
+    static constexpr char32_t s_4_91[3] = { 'u', 'r', 0x103 };
+    static constexpr char32_t s_4_92[3] = { 0xE2, 'r', 0x103 };
+    static constexpr char32_t s_4_93[4] = { 'e', 'a', 'z', 0x103 };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 1, 0 },
+    /*  1 */ { 2, s_4_1, -1, 1, 0 },
+    /*  2 */ { 3, s_4_2, -1, 1, 0 },
+    /*  3 */ { 3, s_4_3, -1, 1, 0 },
+    /*  4 */ { 3, s_4_4, -1, 1, 0 },
+    /*  5 */ { 3, s_4_5, -1, 1, 0 },
+    /*  6 */ { 3, s_4_6, -1, 1, 0 },
+    /*  7 */ { 3, s_4_7, -1, 1, 0 },
+    /*  8 */ { 3, s_4_8, -1, 1, 0 },
+    /*  9 */ { 3, s_4_9, -1, 1, 0 },
+    /* 10 */ { 2, s_4_10, -1, 2, 0 },
+    /* 11 */ { 3, s_4_11, 10, 1, 0 },
+    /* 12 */ { 4, s_4_12, 10, 2, 0 },
+    /* 13 */ { 3, s_4_13, 10, 1, 0 },
+    /* 14 */ { 3, s_4_14, 10, 1, 0 },
+    /* 15 */ { 3, s_4_15, 10, 1, 0 },
+    /* 16 */ { 4, s_4_16, -1, 1, 0 },
+    /* 17 */ { 4, s_4_17, -1, 1, 0 },
+    /* 18 */ { 3, s_4_18, -1, 1, 0 },
+    /* 19 */ { 2, s_4_19, -1, 1, 0 },
+    /* 20 */ { 3, s_4_20, 19, 1, 0 },
+    /* 21 */ { 3, s_4_21, 19, 1, 0 },
+    /* 22 */ { 3, s_4_22, -1, 2, 0 },
+    /* 23 */ { 4, s_4_23, -1, 1, 0 },
+    /* 24 */ { 4, s_4_24, -1, 1, 0 },
+    /* 25 */ { 2, s_4_25, -1, 1, 0 },
+    /* 26 */ { 3, s_4_26, -1, 1, 0 },
+    /* 27 */ { 2, s_4_27, -1, 1, 0 },
+    /* 28 */ { 3, s_4_28, -1, 1, 0 },
+    /* 29 */ { 4, s_4_29, -1, 2, 0 },
+    /* 30 */ { 5, s_4_30, 29, 1, 0 },
+    /* 31 */ { 6, s_4_31, 29, 2, 0 },
+    /* 32 */ { 5, s_4_32, 29, 1, 0 },
+    /* 33 */ { 5, s_4_33, 29, 1, 0 },
+    /* 34 */ { 5, s_4_34, 29, 1, 0 },
+    /* 35 */ { 3, s_4_35, -1, 1, 0 },
+    /* 36 */ { 3, s_4_36, -1, 1, 0 },
+    /* 37 */ { 3, s_4_37, -1, 1, 0 },
+    /* 38 */ { 3, s_4_38, -1, 2, 0 },
+    /* 39 */ { 4, s_4_39, 38, 1, 0 },
+    /* 40 */ { 4, s_4_40, 38, 1, 0 },
+    /* 41 */ { 3, s_4_41, -1, 2, 0 },
+    /* 42 */ { 3, s_4_42, -1, 2, 0 },
+    /* 43 */ { 3, s_4_43, -1, 2, 0 },
+    /* 44 */ { 5, s_4_44, -1, 1, 0 },
+    /* 45 */ { 6, s_4_45, -1, 2, 0 },
+    /* 46 */ { 7, s_4_46, 45, 1, 0 },
+    /* 47 */ { 8, s_4_47, 45, 2, 0 },
+    /* 48 */ { 7, s_4_48, 45, 1, 0 },
+    /* 49 */ { 7, s_4_49, 45, 1, 0 },
+    /* 50 */ { 7, s_4_50, 45, 1, 0 },
+    /* 51 */ { 5, s_4_51, -1, 1, 0 },
+    /* 52 */ { 5, s_4_52, -1, 1, 0 },
+    /* 53 */ { 5, s_4_53, -1, 1, 0 },
+    /* 54 */ { 2, s_4_54, -1, 1, 0 },
+    /* 55 */ { 3, s_4_55, 54, 1, 0 },
+    /* 56 */ { 3, s_4_56, 54, 1, 0 },
+    /* 57 */ { 2, s_4_57, -1, 2, 0 },
+    /* 58 */ { 4, s_4_58, 57, 1, 0 },
+    /* 59 */ { 5, s_4_59, 57, 2, 0 },
+    /* 60 */ { 4, s_4_60, 57, 1, 0 },
+    /* 61 */ { 4, s_4_61, 57, 1, 0 },
+    /* 62 */ { 4, s_4_62, 57, 1, 0 },
+    /* 63 */ { 2, s_4_63, -1, 2, 0 },
+    /* 64 */ { 2, s_4_64, -1, 2, 0 },
+    /* 65 */ { 2, s_4_65, -1, 2, 0 },
+    /* 66 */ { 4, s_4_66, 65, 1, 0 },
+    /* 67 */ { 5, s_4_67, 65, 2, 0 },
+    /* 68 */ { 6, s_4_68, 67, 1, 0 },
+    /* 69 */ { 7, s_4_69, 67, 2, 0 },
+    /* 70 */ { 6, s_4_70, 67, 1, 0 },
+    /* 71 */ { 6, s_4_71, 67, 1, 0 },
+    /* 72 */ { 6, s_4_72, 67, 1, 0 },
+    /* 73 */ { 4, s_4_73, 65, 1, 0 },
+    /* 74 */ { 4, s_4_74, 65, 1, 0 },
+    /* 75 */ { 4, s_4_75, 65, 1, 0 },
+    /* 76 */ { 2, s_4_76, -1, 1, 0 },
+    /* 77 */ { 3, s_4_77, 76, 1, 0 },
+    /* 78 */ { 3, s_4_78, 76, 1, 0 },
+    /* 79 */ { 4, s_4_79, -1, 1, 0 },
+    /* 80 */ { 4, s_4_80, -1, 1, 0 },
+    /* 81 */ { 2, s_4_81, -1, 1, 0 },
+    /* 82 */ { 5, s_4_82, -1, 1, 0 },
+    /* 83 */ { 3, s_4_83, -1, 1, 0 },
+    /* 84 */ { 4, s_4_84, -1, 2, 0 },
+    /* 85 */ { 5, s_4_85, 84, 1, 0 },
+    /* 86 */ { 6, s_4_86, 84, 2, 0 },
+    /* 87 */ { 5, s_4_87, 84, 1, 0 },
+    /* 88 */ { 5, s_4_88, 84, 1, 0 },
+    /* 89 */ { 5, s_4_89, 84, 1, 0 },
+    /* 90 */ { 3, s_4_90, -1, 1, 0 },
+    /* 91 */ { 3, s_4_91, -1, 1, 0 },
+    /* 92 */ { 3, s_4_92, -1, 1, 0 },
+    /* 93 */ { 4, s_4_93, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_5_0[1] = { 'a' };
+    static constexpr char32_t s_5_1[1] = { 'e' };
+    static constexpr char32_t s_5_2[2] = { 'i', 'e' };
+    static constexpr char32_t s_5_3[1] = { 'i' };
+    static constexpr char32_t s_5_4[1] = { 0x103 };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 1, s_5_0, -1, 1, 0 },
+    /*  1 */ { 1, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, 1, 1, 0 },
+    /*  3 */ { 1, s_5_3, -1, 1, 0 },
+    /*  4 */ { 1, s_5_4, -1, 1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'u' };
+    static constexpr char32_t s_1[] = { 'U' };
+    static constexpr char32_t s_2[] = { 'i' };
+    static constexpr char32_t s_3[] = { 'I' };
+    static constexpr char32_t s_4[] = { 'i' };
+    static constexpr char32_t s_5[] = { 'u' };
+    static constexpr char32_t s_6[] = { 'a' };
+    static constexpr char32_t s_7[] = { 'e' };
+    static constexpr char32_t s_8[] = { 'i' };
+    static constexpr char32_t s_9[] = { 'a', 'b' };
+    static constexpr char32_t s_10[] = { 'i' };
+    static constexpr char32_t s_11[] = { 'a', 't' };
+    static constexpr char32_t s_12[] = { 'a', 0x163, 'i' };
+    static constexpr char32_t s_13[] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_14[] = { 'i', 'b', 'i', 'l' };
+    static constexpr char32_t s_15[] = { 'i', 'v' };
+    static constexpr char32_t s_16[] = { 'i', 'c' };
+    static constexpr char32_t s_17[] = { 'a', 't' };
+    static constexpr char32_t s_18[] = { 'i', 't' };
+    static constexpr char32_t s_19[] = { 0x163 };
+    static constexpr char32_t s_20[] = { 't' };
+    static constexpr char32_t s_21[] = { 'i', 's', 't' };
+    static constexpr char32_t s_22[] = { 'u' };
+};
+
+template <typename symbol>
+class romanian_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef romanian_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_prelude() {
+        while(1) { /* repeat, line 32 */
+            int c1 = c;
+            while(1) { /* goto, line 32 */
+                int c2 = c;
+                if (in_grouping(data::g_v, 97, 259, 0)) goto lab1; /* grouping v, line 33 */
+                bra = c; /* [, line 33 */
+                {   int c3 = c; /* or, line 33 */
+                    if (!eq_s(data::s_0)) goto lab3; /* literal, line 33 */
+                    ket = c; /* ], line 33 */
+                    if (in_grouping(data::g_v, 97, 259, 0)) goto lab3; /* grouping v, line 33 */
+                    slice_from(data::s_1); /* <-, line 33 */
+                    goto lab2;
+                lab3:
+                    c = c3;
+                    if (!eq_s(data::s_2)) goto lab1; /* literal, line 34 */
+                    ket = c; /* ], line 34 */
+                    if (in_grouping(data::g_v, 97, 259, 0)) goto lab1; /* grouping v, line 34 */
+                    slice_from(data::s_3); /* <-, line 34 */
+                }
+            lab2:
+                c = c2;
+                break;
+            lab1:
+                c = c2;
+                {   int ret = hop(c, 0, l, 1); /* goto, line 32 */
+                    if (ret < 0) goto lab0;
+                    c = ret;
+                }
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_regions() {
+        I_pV = l; /* $pV = <integer expression>, line 40 */
+        I_p1 = l; /* $p1 = <integer expression>, line 41 */
+        I_p2 = l; /* $p2 = <integer expression>, line 42 */
+        {   int c1 = c; /* do, line 44 */
+            {   int c2 = c; /* or, line 46 */
+                if (in_grouping(data::g_v, 97, 259, 0)) goto lab2; /* grouping v, line 45 */
+                {   int c3 = c; /* or, line 45 */
+                    if (out_grouping(data::g_v, 97, 259, 0)) goto lab4; /* non v, line 45 */
+                    {    /* gopast */ /* grouping v, line 45 */
+                        int ret = out_grouping(data::g_v, 97, 259, 1);
+                        if (ret < 0) goto lab4;
+                        c += ret;
+                    }
+                    goto lab3;
+                lab4:
+                    c = c3;
+                    if (in_grouping(data::g_v, 97, 259, 0)) goto lab2; /* grouping v, line 45 */
+                    {    /* gopast */ /* non v, line 45 */
+                        int ret = in_grouping(data::g_v, 97, 259, 1);
+                        if (ret < 0) goto lab2;
+                        c += ret;
+                    }
+                }
+            lab3:
+                goto lab1;
+            lab2:
+                c = c2;
+                if (out_grouping(data::g_v, 97, 259, 0)) goto lab0; /* non v, line 47 */
+                {   int c4 = c; /* or, line 47 */
+                    if (out_grouping(data::g_v, 97, 259, 0)) goto lab6; /* non v, line 47 */
+                    {    /* gopast */ /* grouping v, line 47 */
+                        int ret = out_grouping(data::g_v, 97, 259, 1);
+                        if (ret < 0) goto lab6;
+                        c += ret;
+                    }
+                    goto lab5;
+                lab6:
+                    c = c4;
+                    if (in_grouping(data::g_v, 97, 259, 0)) goto lab0; /* grouping v, line 47 */
+                    {   int ret = hop(c, 0, l, 1); /* next, line 47 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                }
+            lab5:
+                ;
+            }
+        lab1:
+            I_pV = c; /* setmark pV, line 48 */
+        lab0:
+            c = c1;
+        }
+        {   int c5 = c; /* do, line 50 */
+            {    /* gopast */ /* grouping v, line 51 */
+                int ret = out_grouping(data::g_v, 97, 259, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 51 */
+                int ret = in_grouping(data::g_v, 97, 259, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 51 */
+            {    /* gopast */ /* grouping v, line 52 */
+                int ret = out_grouping(data::g_v, 97, 259, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 52 */
+                int ret = in_grouping(data::g_v, 97, 259, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 52 */
+        lab7:
+            c = c5;
+        }
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 56 */
+            int c1 = c;
+            bra = c; /* [, line 58 */
+            if (c >= l || (p[c] != 73 && p[c] != 85)) among_var = 3; else /* substring, line 58 */
+            among_var = find_among(data::a_0); /* substring, line 58 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 58 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_4); /* <-, line 59 */
+                    break;
+                case 2:
+                    slice_from(data::s_5); /* <-, line 60 */
+                    break;
+                case 3:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 61 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_RV() {
+        if (!(I_pV <= c)) return false; /* $pV <= <integer expression>, line 68 */
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 69 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 70 */
+        return true;
+    }
+
+  private:
+    bool r_step_0() {
+        int among_var;
+        ket = c; /* [, line 73 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((266786 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 73 */
+        among_var = find_among_b(data::a_1); /* substring, line 73 */
+        if (!among_var) return false;
+        bra = c; /* ], line 73 */
+        if (!r_R1()) return false; /* call R1, line 73 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 75 */
+                break;
+            case 2:
+                slice_from(data::s_6); /* <-, line 77 */
+                break;
+            case 3:
+                slice_from(data::s_7); /* <-, line 79 */
+                break;
+            case 4:
+                slice_from(data::s_8); /* <-, line 81 */
+                break;
+            case 5:
+                {   int m1 = l - c; (void)m1; /* not, line 83 */
+                    if (!eq_s_b(data::s_9)) goto lab0; /* literal, line 83 */
+                    return false;
+                lab0:
+                    c = l - m1;
+                }
+                slice_from(data::s_10); /* <-, line 83 */
+                break;
+            case 6:
+                slice_from(data::s_11); /* <-, line 85 */
+                break;
+            case 7:
+                slice_from(data::s_12); /* <-, line 87 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_combo_suffix() {
+        int among_var;
+        {   int m_test = l - c; /* test, line 91 */
+            ket = c; /* [, line 92 */
+            among_var = find_among_b(data::a_2); /* substring, line 92 */
+            if (!among_var) return false;
+            bra = c; /* ], line 92 */
+            if (!r_R1()) return false; /* call R1, line 92 */
+            switch(among_var) {
+                case 0: return false;
+                case 1:
+                    slice_from(data::s_13); /* <-, line 101 */
+                    break;
+                case 2:
+                    slice_from(data::s_14); /* <-, line 104 */
+                    break;
+                case 3:
+                    slice_from(data::s_15); /* <-, line 107 */
+                    break;
+                case 4:
+                    slice_from(data::s_16); /* <-, line 113 */
+                    break;
+                case 5:
+                    slice_from(data::s_17); /* <-, line 118 */
+                    break;
+                case 6:
+                    slice_from(data::s_18); /* <-, line 122 */
+                    break;
+            }
+            B_standard_suffix_removed = true; /* set standard_suffix_removed, line 125 */
+            c = l - m_test;
+        }
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        B_standard_suffix_removed = false; /* unset standard_suffix_removed, line 130 */
+        while(1) { /* repeat, line 131 */
+            int m1 = l - c; (void)m1;
+            if (!r_combo_suffix()) goto lab0; /* call combo_suffix, line 131 */
+            continue;
+        lab0:
+            c = l - m1;
+            break;
+        }
+        ket = c; /* [, line 132 */
+        among_var = find_among_b(data::a_3); /* substring, line 132 */
+        if (!among_var) return false;
+        bra = c; /* ], line 132 */
+        if (!r_R2()) return false; /* call R2, line 132 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 149 */
+                break;
+            case 2:
+                if (!eq_s_b(data::s_19)) return false; /* literal, line 152 */
+                bra = c; /* ], line 152 */
+                slice_from(data::s_20); /* <-, line 152 */
+                break;
+            case 3:
+                slice_from(data::s_21); /* <-, line 156 */
+                break;
+        }
+        B_standard_suffix_removed = true; /* set standard_suffix_removed, line 160 */
+        return true;
+    }
+
+  private:
+    bool r_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 164 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 164 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 165 */
+            among_var = find_among_b(data::a_4); /* substring, line 165 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 165 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    {   int m2 = l - c; (void)m2; /* or, line 200 */
+                        if (out_grouping_b(data::g_v, 97, 259, 0)) goto lab1; /* non v, line 200 */
+                        goto lab0;
+                    lab1:
+                        c = l - m2;
+                        if (!eq_s_b(data::s_22)) { lb = mlimit; return false; } /* literal, line 200 */
+                    }
+                lab0:
+                    slice_del(); /* delete, line 200 */
+                    break;
+                case 2:
+                    slice_del(); /* delete, line 214 */
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_vowel_suffix() {
+        int among_var;
+        ket = c; /* [, line 219 */
+        among_var = find_among_b(data::a_5); /* substring, line 219 */
+        if (!among_var) return false;
+        bra = c; /* ], line 219 */
+        if (!r_RV()) return false; /* call RV, line 219 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 220 */
+                break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 226 */
+            if (!r_prelude()) goto lab0; /* call prelude, line 226 */
+        lab0:
+            c = c1;
+        }
+        {   int c2 = c; /* do, line 227 */
+            if (!r_mark_regions()) goto lab1; /* call mark_regions, line 227 */
+        lab1:
+            c = c2;
+        }
+        lb = c; c = l; /* backwards, line 228 */
+
+        {   int m3 = l - c; (void)m3; /* do, line 229 */
+            if (!r_step_0()) goto lab2; /* call step_0, line 229 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 230 */
+            if (!r_standard_suffix()) goto lab3; /* call standard_suffix, line 230 */
+        lab3:
+            c = l - m4;
+        }
+        {   int m5 = l - c; (void)m5; /* do, line 231 */
+            {   int m6 = l - c; (void)m6; /* or, line 231 */
+                if (!B_standard_suffix_removed) goto lab6; /* Boolean test standard_suffix_removed, line 231 */
+                goto lab5;
+            lab6:
+                c = l - m6;
+                if (!r_verb_suffix()) goto lab4; /* call verb_suffix, line 231 */
+            }
+        lab5:
+        lab4:
+            c = l - m5;
+        }
+        {   int m7 = l - c; (void)m7; /* do, line 232 */
+            if (!r_vowel_suffix()) goto lab7; /* call vowel_suffix, line 232 */
+        lab7:
+            c = l - m7;
+        }
+        c = lb;
+        {   int c8 = c; /* do, line 234 */
+            if (!r_postlude()) goto lab8; /* call postlude, line 234 */
+        lab8:
+            c = c8;
+        }
+        return true;
+    }
+
+  private:
+    bool B_standard_suffix_removed = false;
+    int I_p2 = 0;
+    int I_p1 = 0;
+    int I_pV = 0;
+};
+
+}
+
+#endif
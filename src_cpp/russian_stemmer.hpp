@@ -0,0 +1,951 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_RUSSIAN_STEMMER_HPP
+#define SNOWBALL_RUSSIAN_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct russian_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 33, 65, 8, 232 };
+};
+
+template <bool utf8> struct russian_stemmer_data;
+
+template <>
+struct russian_stemmer_data<true> : russian_stemmer_groupings {
+    static constexpr unsigned char s_0_0[2] = { 0xD0, 0xB2 };
+    static constexpr unsigned char s_0_1[4] = { 0xD0, 0xB8, 0xD0, 0xB2 };
+    static constexpr unsigned char s_0_2[4] = { 0xD1, 0x8B, 0xD0, 0xB2 };
+    static constexpr unsigned char s_0_3[6] = { 0xD0, 0xB2, 0xD1, 0x88, 0xD0, 0xB8 };
+    static constexpr unsigned char s_0_4[8] = { 0xD0, 0xB8, 0xD0, 0xB2, 0xD1, 0x88, 0xD0, 0xB8 };
+    static constexpr unsigned char s_0_5[8] = { 0xD1, 0x8B, 0xD0, 0xB2, 0xD1, 0x88, 0xD0, 0xB8 };
+    static constexpr unsigned char s_0_6[10] = { 0xD0, 0xB2, 0xD1, 0x88, 0xD0, 0xB8, 0xD1, 0x81, 0xD1, 0x8C };
+    static constexpr unsigned char s_0_7[12] = { 0xD0, 0xB8, 0xD0, 0xB2, 0xD1, 0x88, 0xD0, 0xB8, 0xD1, 0x81, 0xD1, 0x8C };
+    static constexpr unsigned char s_0_8[12] = { 0xD1, 0x8B, 0xD0, 0xB2, 0xD1, 0x88, 0xD0, 0xB8, 0xD1, 0x81, 0xD1, 0x8C };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 2, s_0_0, -1, 1, 0 },
+    /*  1 */ { 4, s_0_1, 0, 2, 0 },
+    /*  2 */ { 4, s_0_2, 0, 2, 0 },
+    /*  3 */ { 6, s_0_3, -1, 1, 0 },
+    /*  4 */ { 8, s_0_4, 3, 2, 0 },
+    /*  5 */ { 8, s_0_5, 3, 2, 0 },
+    /*  6 */ { 10, s_0_6, -1, 1, 0 },
+    /*  7 */ { 12, s_0_7, 6, 2, 0 },
+    /*  8 */ { 12, s_0_8, 6, 2, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[4] = { 0xD0, 0xB5, 0xD0, 0xB5 };
+    static constexpr unsigned char s_1_1[4] = { 0xD0, 0xB8, 0xD0, 0xB5 };
+    static constexpr unsigned char s_1_2[4] = { 0xD0, 0xBE, 0xD0, 0xB5 };
+    static constexpr unsigned char s_1_3[4] = { 0xD1, 0x8B, 0xD0, 0xB5 };
+    static constexpr unsigned char s_1_4[6] = { 0xD0, 0xB8, 0xD0, 0xBC, 0xD0, 0xB8 };
+    static constexpr unsigned char s_1_5[6] = { 0xD1, 0x8B, 0xD0, 0xBC, 0xD0, 0xB8 };
+    static constexpr unsigned char s_1_6[4] = { 0xD0, 0xB5, 0xD0, 0xB9 };
+    static constexpr unsigned char s_1_7[4] = { 0xD0, 0xB8, 0xD0, 0xB9 };
+    static constexpr unsigned char s_1_8[4] = { 0xD0, 0xBE, 0xD0, 0xB9 };
+    static constexpr unsigned char s_1_9[4] = { 0xD1, 0x8B, 0xD0, 0xB9 };
+    static constexpr unsigned char s_1_10[4] = { 0xD0, 0xB5, 0xD0, 0xBC };
+    static constexpr unsigned char s_1_11[4] = { 0xD0, 0xB8, 0xD0, 0xBC };
+    static constexpr unsigned char s_1_12[4] = { 0xD0, 0xBE, 0xD0, 0xBC };
+    static constexpr unsigned char s_1_13[4] = { 0xD1, 0x8B, 0xD0, 0xBC };
+    static constexpr unsigned char s_1_14[6] = { 0xD0, 0xB5, 0xD0, 0xB3, 0xD0, 0xBE };
+    static constexpr unsigned char s_1_15[6] = { 0xD0, 0xBE, 0xD0, 0xB3, 0xD0, 0xBE };
+    static constexpr unsigned char s_1_16[6] = { 0xD0, 0xB5, 0xD0, 0xBC, 0xD1, 0x83 };
+    static constexpr unsigned char s_1_17[6] = { 0xD0, 0xBE, 0xD0, 0xBC, 0xD1, 0x83 };
+    static constexpr unsigned char s_1_18[4] = { 0xD0, 0xB8, 0xD1, 0x85 };
+    static constexpr unsigned char s_1_19[4] = { 0xD1, 0x8B, 0xD1, 0x85 };
+    static constexpr unsigned char s_1_20[4] = { 0xD0, 0xB5, 0xD1, 0x8E };
+    static constexpr unsigned char s_1_21[4] = { 0xD0, 0xBE, 0xD1, 0x8E };
+    static constexpr unsigned char s_1_22[4] = { 0xD1, 0x83, 0xD1, 0x8E };
+    static constexpr unsigned char s_1_23[4] = { 0xD1, 0x8E, 0xD1, 0x8E };
+    static constexpr unsigned char s_1_24[4] = { 0xD0, 0xB0, 0xD1, 0x8F };
+    static constexpr unsigned char s_1_25[4] = { 0xD1, 0x8F, 0xD1, 0x8F };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 4, s_1_0, -1, 1, 0 },
+    /*  1 */ { 4, s_1_1, -1, 1, 0 },
+    /*  2 */ { 4, s_1_2, -1, 1, 0 },
+    /*  3 */ { 4, s_1_3, -1, 1, 0 },
+    /*  4 */ { 6, s_1_4, -1, 1, 0 },
+    /*  5 */ { 6, s_1_5, -1, 1, 0 },
+    /*  6 */ { 4, s_1_6, -1, 1, 0 },
+    /*  7 */ { 4, s_1_7, -1, 1, 0 },
+    /*  8 */ { 4, s_1_8, -1, 1, 0 },
+    /*  9 */ { 4, s_1_9, -1, 1, 0 },
+    /* 10 */ { 4, s_1_10, -1, 1, 0 },
+    /* 11 */ { 4, s_1_11, -1, 1, 0 },
+    /* 12 */ { 4, s_1_12, -1, 1, 0 },
+    /* 13 */ { 4, s_1_13, -1, 1, 0 },
+    /* 14 */ { 6, s_1_14, -1, 1, 0 },
+    /* 15 */ { 6, s_1_15, -1, 1, 0 },
+    /* 16 */ { 6, s_1_16, -1, 1, 0 },
+    /* 17 */ { 6, s_1_17, -1, 1, 0 },
+    /* 18 */ { 4, s_1_18, -1, 1, 0 },
+    /* 19 */ { 4, s_1_19, -1, 1, 0 },
+    /* 20 */ { 4, s_1_20, -1, 1, 0 },
+    /* 21 */ { 4, s_1_21, -1, 1, 0 },
+    /* 22 */ { 4, s_1_22, -1, 1, 0 },
+    /* 23 */ { 4, s_1_23, -1, 1, 0 },
+    /* 24 */ { 4, s_1_24, -1, 1, 0 },
+    /* 25 */ { 4, s_1_25, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[4] = { 0xD0, 0xB5, 0xD0, 0xBC };
+    static constexpr unsigned char s_2_1[4] = { 0xD0, 0xBD, 0xD0, 0xBD };
+    static constexpr unsigned char s_2_2[4] = { 0xD0, 0xB2, 0xD1, 0x88 };
+    static constexpr unsigned char s_2_3[6] = { 0xD0, 0xB8, 0xD0, 0xB2, 0xD1, 0x88 };
+    static constexpr unsigned char s_2_4[6] = { 0xD1, 0x8B, 0xD0, 0xB2, 0xD1, 0x88 };
+    static constexpr unsigned char s_2_5[2] = { 0xD1, 0x89 };
+    static constexpr unsigned char s_2_6[4] = { 0xD1, 0x8E, 0xD1, 0x89 };
+    static constexpr unsigned char s_2_7[6] = { 0xD1, 0x83, 0xD1, 0x8E, 0xD1, 0x89 };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 4, s_2_0, -1, 1, 0 },
+    /*  1 */ { 4, s_2_1, -1, 1, 0 },
+    /*  2 */ { 4, s_2_2, -1, 1, 0 },
+    /*  3 */ { 6, s_2_3, 2, 2, 0 },
+    /*  4 */ { 6, s_2_4, 2, 2, 0 },
+    /*  5 */ { 2, s_2_5, -1, 1, 0 },
+    /*  6 */ { 4, s_2_6, 5, 1, 0 },
+    /*  7 */ { 6, s_2_7, 6, 2, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[4] = { 0xD1, 0x81, 0xD1, 0x8C };
+    static constexpr unsigned char s_3_1[4] = { 0xD1, 0x81, 0xD1, 0x8F };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 4, s_3_0, -1, 1, 0 },
+    /*  1 */ { 4, s_3_1, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[4] = { 0xD0, 0xBB, 0xD0, 0xB0 };
+    static constexpr unsigned char s_4_1[6] = { 0xD0, 0xB8, 0xD0, 0xBB, 0xD0, 0xB0 };
+    static constexpr unsigned char s_4_2[6] = { 0xD1, 0x8B, 0xD0, 0xBB, 0xD0, 0xB0 };
+    static constexpr unsigned char s_4_3[4] = { 0xD0, 0xBD, 0xD0, 0xB0 };
+    static constexpr unsigned char s_4_4[6] = { 0xD0, 0xB5, 0xD0, 0xBD, 0xD0, 0xB0 };
+    static constexpr unsigned char s_4_5[6] = { 0xD0, 0xB5, 0xD1, 0x82, 0xD0, 0xB5 };
+    static constexpr unsigned char s_4_6[6] = { 0xD0, 0xB8, 0xD1, 0x82, 0xD0, 0xB5 };
+    static constexpr unsigned char s_4_7[6] = { 0xD0, 0xB9, 0xD1, 0x82, 0xD0, 0xB5 };
+    static constexpr unsigned char s_4_8[8] = { 0xD0, 0xB5, 0xD0, 0xB9, 0xD1, 0x82, 0xD0, 0xB5 };
+    static constexpr unsigned char s_4_9[8] = { 0xD1, 0x83, 0xD0, 0xB9, 0xD1, 0x82, 0xD0, 0xB5 };
+    static constexpr unsigned char s_4_10[4] = { 0xD0, 0xBB, 0xD0, 0xB8 };
+    static constexpr unsigned char s_4_11[6] = { 0xD0, 0xB8, 0xD0, 0xBB, 0xD0, 0xB8 };
+    static constexpr unsigned char s_4_12[6] = { 0xD1, 0x8B, 0xD0, 0xBB, 0xD0, 0xB8 };
+    static constexpr unsigned char s_4_13[2] = { 0xD0, 0xB9 };
+    static constexpr unsigned char s_4_14[4] = { 0xD0, 0xB5, 0xD0, 0xB9 };
+    static constexpr unsigned char s_4_15[4] = { 0xD1, 0x83, 0xD0, 0xB9 };
+    static constexpr unsigned char s_4_16[2] = { 0xD0, 0xBB };
+    static constexpr unsigned char s_4_17[4] = { 0xD0, 0xB8, 0xD0, 0xBB };
+    static constexpr unsigned char s_4_18[4] = { 0xD1, 0x8B, 0xD0, 0xBB };
+    static constexpr unsigned char s_4_19[4] = { 0xD0, 0xB5, 0xD0, 0xBC };
+    static constexpr unsigned char s_4_20[4] = { 0xD0, 0xB8, 0xD0, 0xBC };
+    static constexpr unsigned char s_4_21[4] = { 0xD1, 0x8B, 0xD0, 0xBC };
+    static constexpr unsigned char s_4_22[2] = { 0xD0, 0xBD };
+    static constexpr unsigned char s_4_23[4] = { 0xD0, 0xB5, 0xD0, 0xBD };
+    static constexpr unsigned char s_4_24[4] = { 0xD0, 0xBB, 0xD0, 0xBE };
+    static constexpr unsigned char s_4_25[6] = { 0xD0, 0xB8, 0xD0, 0xBB, 0xD0, 0xBE };
+    static constexpr unsigned char s_4_26[6] = { 0xD1, 0x8B, 0xD0, 0xBB, 0xD0, 0xBE };
+    static constexpr unsigned char s_4_27[4] = { 0xD0, 0xBD, 0xD0, 0xBE };
+    static constexpr unsigned char s_4_28[6] = { 0xD0, 0xB5, 0xD0, 0xBD, 0xD0, 0xBE };
+    static constexpr unsigned char s_4_29[6] = { 0xD0, 0xBD, 0xD0, 0xBD, 0xD0, 0xBE };
+    static constexpr unsigned char s_4_30[4] = { 0xD0, 0xB5, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_31[6] = { 0xD1, 0x83, 0xD0, 0xB5, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_32[4] = { 0xD0, 0xB8, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_33[4] = { 0xD1, 0x8B, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_34[4] = { 0xD1, 0x8E, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_35[6] = { 0xD1, 0x83, 0xD1, 0x8E, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_36[4] = { 0xD1, 0x8F, 0xD1, 0x82 };
+    static constexpr unsigned char s_4_37[4] = { 0xD0, 0xBD, 0xD1, 0x8B };
+    static constexpr unsigned char s_4_38[6] = { 0xD0, 0xB5, 0xD0, 0xBD, 0xD1, 0x8B };
+    static constexpr unsigned char s_4_39[4] = { 0xD1, 0x82, 0xD1, 0x8C };
+    static constexpr unsigned char s_4_40[6] = { 0xD0, 0xB8, 0xD1, 0x82, 0xD1, 0x8C };
+    static constexpr unsigned char s_4_41[6] = { 0xD1, 0x8B, 0xD1, 0x82, 0xD1, 0x8C };
+    static constexpr unsigned char s_4_42[6] = { 0xD0, 0xB5, 0xD1, 0x88, 0xD1, 0x8C };
+    static constexpr unsigned char s_4_43[6] = { 0xD0, 0xB8, 0xD1, 0x88, 0xD1, 0x8C };
+    static constexpr unsigned char s_4_44[2] = { 0xD1, 0x8E };
+    static constexpr unsigned char s_4_45[4] = { 0xD1, 0x83, 0xD1, 0x8E };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 4, s_4_0, -1, 1, 0 },
+    /*  1 */ { 6, s_4_1, 0, 2, 0 },
+    /*  2 */ { 6, s_4_2, 0, 2, 0 },
+    /*  3 */ { 4, s_4_3, -1, 1, 0 },
+    /*  4 */ { 6, s_4_4, 3, 2, 0 },
+    /*  5 */ { 6, s_4_5, -1, 1, 0 },
+    /*  6 */ { 6, s_4_6, -1, 2, 0 },
+    /*  7 */ { 6, s_4_7, -1, 1, 0 },
+    /*  8 */ { 8, s_4_8, 7, 2, 0 },
+    /*  9 */ { 8, s_4_9, 7, 2, 0 },
+    /* 10 */ { 4, s_4_10, -1, 1, 0 },
+    /* 11 */ { 6, s_4_11, 10, 2, 0 },
+    /* 12 */ { 6, s_4_12, 10, 2, 0 },
+    /* 13 */ { 2, s_4_13, -1, 1, 0 },
+    /* 14 */ { 4, s_4_14, 13, 2, 0 },
+    /* 15 */ { 4, s_4_15, 13, 2, 0 },
+    /* 16 */ { 2, s_4_16, -1, 1, 0 },
+    /* 17 */ { 4, s_4_17, 16, 2, 0 },
+    /* 18 */ { 4, s_4_18, 16, 2, 0 },
+    /* 19 */ { 4, s_4_19, -1, 1, 0 },
+    /* 20 */ { 4, s_4_20, -1, 2, 0 },
+    /* 21 */ { 4, s_4_21, -1, 2, 0 },
+    /* 22 */ { 2, s_4_22, -1, 1, 0 },
+    /* 23 */ { 4, s_4_23, 22, 2, 0 },
+    /* 24 */ { 4, s_4_24, -1, 1, 0 },
+    /* 25 */ { 6, s_4_25, 24, 2, 0 },
+    /* 26 */ { 6, s_4_26, 24, 2, 0 },
+    /* 27 */ { 4, s_4_27, -1, 1, 0 },
+    /* 28 */ { 6, s_4_28, 27, 2, 0 },
+    /* 29 */ { 6, s_4_29, 27, 1, 0 },
+    /* 30 */ { 4, s_4_30, -1, 1, 0 },
+    /* 31 */ { 6, s_4_31, 30, 2, 0 },
+    /* 32 */ { 4, s_4_32, -1, 2, 0 },
+    /* 33 */ { 4, s_4_33, -1, 2, 0 },
+    /* 34 */ { 4, s_4_34, -1, 1, 0 },
+    /* 35 */ { 6, s_4_35, 34, 2, 0 },
+    /* 36 */ { 4, s_4_36, -1, 2, 0 },
+    /* 37 */ { 4, s_4_37, -1, 1, 0 },
+    /* 38 */ { 6, s_4_38, 37, 2, 0 },
+    /* 39 */ { 4, s_4_39, -1, 1, 0 },
+    /* 40 */ { 6, s_4_40, 39, 2, 0 },
+    /* 41 */ { 6, s_4_41, 39, 2, 0 },
+    /* 42 */ { 6, s_4_42, -1, 1, 0 },
+    /* 43 */ { 6, s_4_43, -1, 2, 0 },
+    /* 44 */ { 2, s_4_44, -1, 2, 0 },
+    /* 45 */ { 4, s_4_45, 44, 2, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 0xD0, 0xB0 };
+    static constexpr unsigned char s_5_1[4] = { 0xD0, 0xB5, 0xD0, 0xB2 };
+    static constexpr unsigned char s_5_2[4] = { 0xD0, 0xBE, 0xD0, 0xB2 };
+    static constexpr unsigned char s_5_3[2] = { 0xD0, 0xB5 };
+    static constexpr unsigned char s_5_4[4] = { 0xD0, 0xB8, 0xD0, 0xB5 };
+    static constexpr unsigned char s_5_5[4] = { 0xD1, 0x8C, 0xD0, 0xB5 };
+    static constexpr unsigned char s_5_6[2] = { 0xD0, 0xB8 };
+    static constexpr unsigned char s_5_7[4] = { 0xD0, 0xB5, 0xD0, 0xB8 };
+    static constexpr unsigned char s_5_8[4] = { 0xD0, 0xB8, 0xD0, 0xB8 };
+    static constexpr unsigned char s_5_9[6] = { 0xD0, 0xB0, 0xD0, 0xBC, 0xD0, 0xB8 };
+    static constexpr unsigned char s_5_10[6] = { 0xD1, 0x8F, 0xD0, 0xBC, 0xD0, 0xB8 };
+    static constexpr unsigned char s_5_11[8] = { 0xD0, 0xB8, 0xD1, 0x8F, 0xD0, 0xBC, 0xD0, 0xB8 };
+    static constexpr unsigned char s_5_12[2] = { 0xD0, 0xB9 };
+    static constexpr unsigned char s_5_13[4] = { 0xD0, 0xB5, 0xD0, 0xB9 };
+    static constexpr unsigned char s_5_14[6] = { 0xD0, 0xB8, 0xD0, 0xB5, 0xD0, 0xB9 };
+    static constexpr unsigned char s_5_15[4] = { 0xD0, 0xB8, 0xD0, 0xB9 };
+    static constexpr unsigned char s_5_16[4] = { 0xD0, 0xBE, 0xD0, 0xB9 };
+    static constexpr unsigned char s_5_17[4] = { 0xD0, 0xB0, 0xD0, 0xBC };
+    static constexpr unsigned char s_5_18[4] = { 0xD0, 0xB5, 0xD0, 0xBC };
+    static constexpr unsigned char s_5_19[6] = { 0xD0, 0xB8, 0xD0, 0xB5, 0xD0, 0xBC };
+    static constexpr unsigned char s_5_20[4] = { 0xD0, 0xBE, 0xD0, 0xBC };
+    static constexpr unsigned char s_5_21[4] = { 0xD1, 0x8F, 0xD0, 0xBC };
+    static constexpr unsigned char s_5_22[6] = { 0xD0, 0xB8, 0xD1, 0x8F, 0xD0, 0xBC };
+    static constexpr unsigned char s_5_23[2] = { 0xD0, 0xBE };
+    static constexpr unsigned char s_5_24[2] = { 0xD1, 0x83 };
+    static constexpr unsigned char s_5_25[4] = { 0xD0, 0xB0, 0xD1, 0x85 };
+    static constexpr unsigned char s_5_26[4] = { 0xD1, 0x8F, 0xD1, 0x85 };
+    static constexpr unsigned char s_5_27[6] = { 0xD0, 0xB8, 0xD1, 0x8F, 0xD1, 0x85 };
+    static constexpr unsigned char s_5_28[2] = { 0xD1, 0x8B };
+    static constexpr unsigned char s_5_29[2] = { 0xD1, 0x8C };
+    static constexpr unsigned char s_5_30[2] = { 0xD1, 0x8E };
+    static constexpr unsigned char s_5_31[4] = { 0xD0, 0xB8, 0xD1, 0x8E };
+    static constexpr unsigned char s_5_32[4] = { 0xD1, 0x8C, 0xD1, 0x8E };
+    static constexpr unsigned char s_5_33[2] = { 0xD1, 0x8F };
+    static constexpr unsigned char s_5_34[4] = { 0xD0, 0xB8, 0xD1, 0x8F };
+    static constexpr unsigned char s_5_35[4] = { 0xD1, 0x8C, 0xD1, 0x8F };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 4, s_5_2, -1, 1, 0 },
+    /*  3 */ { 2, s_5_3, -1, 1, 0 },
+    /*  4 */ { 4, s_5_4, 3, 1, 0 },
+    /*  5 */ { 4, s_5_5, 3, 1, 0 },
+    /*  6 */ { 2, s_5_6, -1, 1, 0 },
+    /*  7 */ { 4, s_5_7, 6, 1, 0 },
+    /*  8 */ { 4, s_5_8, 6, 1, 0 },
+    /*  9 */ { 6, s_5_9, 6, 1, 0 },
+    /* 10 */ { 6, s_5_10, 6, 1, 0 },
+    /* 11 */ { 8, s_5_11, 10, 1, 0 },
+    /* 12 */ { 2, s_5_12, -1, 1, 0 },
+    /* 13 */ { 4, s_5_13, 12, 1, 0 },
+    /* 14 */ { 6, s_5_14, 13, 1, 0 },
+    /* 15 */ { 4, s_5_15, 12, 1, 0 },
+    /* 16 */ { 4, s_5_16, 12, 1, 0 },
+    /* 17 */ { 4, s_5_17, -1, 1, 0 },
+    /* 18 */ { 4, s_5_18, -1, 1, 0 },
+    /* 19 */ { 6, s_5_19, 18, 1, 0 },
+    /* 20 */ { 4, s_5_20, -1, 1, 0 },
+    /* 21 */ { 4, s_5_21, -1, 1, 0 },
+    /* 22 */ { 6, s_5_22, 21, 1, 0 },
+    /* 23 */ { 2, s_5_23, -1, 1, 0 },
+    /* 24 */ { 2, s_5_24, -1, 1, 0 },
+    /* 25 */ { 4, s_5_25, -1, 1, 0 },
+    /* 26 */ { 4, s_5_26, -1, 1, 0 },
+    /* 27 */ { 6, s_5_27, 26, 1, 0 },
+    /* 28 */ { 2, s_5_28, -1, 1, 0 },
+    /* 29 */ { 2, s_5_29, -1, 1, 0 },
+    /* 30 */ { 2, s_5_30, -1, 1, 0 },
+    /* 31 */ { 4, s_5_31, 30, 1, 0 },
+    /* 32 */ { 4, s_5_32, 30, 1, 0 },
+    /* 33 */ { 2, s_5_33, -1, 1, 0 },
+    /* 34 */ { 4, s_5_34, 33, 1, 0 },
+    /* 35 */ { 4, s_5_35, 33, 1, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[6] = { 0xD0, 0xBE, 0xD1, 0x81, 0xD1, 0x82 };
+    static constexpr unsigned char s_6_1[8] = { 0xD0, 0xBE, 0xD1, 0x81, 0xD1, 0x82, 0xD1, 0x8C };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 6, s_6_0, -1, 1, 0 },
+    /*  1 */ { 8, s_6_1, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[8] = { 0xD0, 0xB5, 0xD0, 0xB9, 0xD1, 0x88, 0xD0, 0xB5 };
+    static constexpr unsigned char s_7_1[2] = { 0xD0, 0xBD };
+    static constexpr unsigned char s_7_2[6] = { 0xD0, 0xB5, 0xD0, 0xB9, 0xD1, 0x88 };
+    static constexpr unsigned char s_7_3[2] = { 0xD1, 0x8C };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 8, s_7_0, -1, 1, 0 },
+    /*  1 */ { 2, s_7_1, -1, 2, 0 },
+    /*  2 */ { 6, s_7_2, -1, 1, 0 },
+    /*  3 */ { 2, s_7_3, -1, 3, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 0xD0, 0xB0 };
+    static constexpr unsigned char s_1[] = { 0xD1, 0x8F };
+    static constexpr unsigned char s_2[] = { 0xD0, 0xB0 };
+    static constexpr unsigned char s_3[] = { 0xD1, 0x8F };
+    static constexpr unsigned char s_4[] = { 0xD0, 0xB0 };
+    static constexpr unsigned char s_5[] = { 0xD1, 0x8F };
+    static constexpr unsigned char s_6[] = { 0xD0, 0xBD };
+    static constexpr unsigned char s_7[] = { 0xD0, 0xBD };
+    static constexpr unsigned char s_8[] = { 0xD0, 0xBD };
+    static constexpr unsigned char s_9[] = { 0xD0, 0xB8 };
+};
+
+template <>
+struct russian_stemmer_data<false> : russian_stemmer_groupings {
+    static constexpr char32_t s_0_0[1] = { 0x432 };
+    static constexpr char32_t s_0_1[2] = { 0x438, 0x432 };
+    static constexpr char32_t s_0_2[2] = { 0x44B, 0x432 };
+    static constexpr char32_t s_0_3[3] = { 0x432, 0x448, 0x438 };
+    static constexpr char32_t s_0_4[4] = { 0x438, 0x432, 0x448, 0x438 };
+    static constexpr char32_t s_0_5[4] = { 0x44B, 0x432, 0x448, 0x438 };
+    static constexpr char32_t s_0_6[5] = { 0x432, 0x448, 0x438, 0x441, 0x44C };
+    static constexpr char32_t s_0_7[6] = { 0x438, 0x432, 0x448, 0x438, 0x441, 0x44C };
+    static constexpr char32_t s_0_8[6] = { 0x44B, 0x432, 0x448, 0x438, 0x441, 0x44C };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 1, 0 },
+    /*  1 */ { 2, s_0_1, 0, 2, 0 },
+    /*  2 */ { 2, s_0_2, 0, 2, 0 },
+    /*  3 */ { 3, s_0_3, -1, 1, 0 },
+    /*  4 */ { 4, s_0_4, 3, 2, 0 },
+    /*  5 */ { 4, s_0_5, 3, 2, 0 },
+    /*  6 */ { 5, s_0_6, -1, 1, 0 },
+    /*  7 */ { 6, s_0_7, 6, 2, 0 },
+    /*  8 */ { 6, s_0_8, 6, 2, 0 }
+    };
+
+    static constexpr char32_t s_1_0[2] = { 0x435, 0x435 };
+    static constexpr char32_t s_1_1[2] = { 0x438, 0x435 };
+    static constexpr char32_t s_1_2[2] = { 0x43E, 0x435 };
+    static constexpr char32_t s_1_3[2] = { 0x44B, 0x435 };
+    static constexpr char32_t s_1_4[3] = { 0x438, 0x43C, 0x438 };
+    static constexpr char32_t s_1_5[3] = { 0x44B, 0x43C, 0x438 };
+    static constexpr char32_t s_1_6[2] = { 0x435, 0x439 };
+    static constexpr char32_t s_1_7[2] = { 0x438, 0x439 };
+    static constexpr char32_t s_1_8[2] = { 0x43E, 0x439 };
+    static constexpr char32_t s_1_9[2] = { 0x44B, 0x439 };
+    static constexpr char32_t s_1_10[2] = { 0x435, 0x43C };
+    static constexpr char32_t s_1_11[2] = { 0x438, 0x43C };
+    static constexpr char32_t s_1_12[2] = { 0x43E, 0x43C };
+    static constexpr char32_t s_1_13[2] = { 0x44B, 0x43C };
+    static constexpr char32_t s_1_14[3] = { 0x435, 0x433, 0x43E };
+    static constexpr char32_t s_1_15[3] = { 0x43E, 0x433, 0x43E };
+    static constexpr char32_t s_1_16[3] = { 0x435, 0x43C, 0x443 };
+    static constexpr char32_t s_1_17[3] = { 0x43E, 0x43C, 0x443 };
+    static constexpr char32_t s_1_18[2] = { 0x438, 0x445 };
+    static constexpr char32_t s_1_19[2] = { 0x44B, 0x445 };
+    static constexpr char32_t s_1_20[2] = { 0x435, 0x44E };
+    static constexpr char32_t s_1_21[2] = { 0x43E, 0x44E };
+    static constexpr char32_t s_1_22[2] = { 0x443, 0x44E };
+    static constexpr char32_t s_1_23[2] = { 0x44E, 0x44E };
+    static constexpr char32_t s_1_24[2] = { 0x430, 0x44F };
+    static constexpr char32_t s_1_25[2] = { 0x44F, 0x44F };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, 1, 0 },
+    /*  1 */ { 2, s_1_1, -1, 1, 0 },
+    /*  2 */ { 2, s_1_2, -1, 1, 0 },
+    /*  3 */ { 2, s_1_3, -1, 1, 0 },
+    /*  4 */ { 3, s_1_4, -1, 1, 0 },
+    /*  5 */ { 3, s_1_5, -1, 1, 0 },
+    /*  6 */ { 2, s_1_6, -1, 1, 0 },
+    /*  7 */ { 2, s_1_7, -1, 1, 0 },
+    /*  8 */ { 2, s_1_8, -1, 1, 0 },
+    /*  9 */ { 2, s_1_9, -1, 1, 0 },
+    /* 10 */ { 2, s_1_10, -1, 1, 0 },
+    /* 11 */ { 2, s_1_11, -1, 1, 0 },
+    /* 12 */ { 2, s_1_12, -1, 1, 0 },
+    /* 13 */ { 2, s_1_13, -1, 1, 0 },
+    /* 14 */ { 3, s_1_14, -1, 1, 0 },
+    /* 15 */ { 3, s_1_15, -1, 1, 0 },
+    /* 16 */ { 3, s_1_16, -1, 1, 0 },
+    /* 17 */ { 3, s_1_17, -1, 1, 0 },
+    /* 18 */ { 2, s_1_18, -1, 1, 0 },
+    /* 19 */ { 2, s_1_19, -1, 1, 0 },
+    /* 20 */ { 2, s_1_20, -1, 1, 0 },
+    /* 21 */ { 2, s_1_21, -1, 1, 0 },
+    /* 22 */ { 2, s_1_22, -1, 1, 0 },
+    /* 23 */ { 2, s_1_23, -1, 1, 0 },
+    /* 24 */ { 2, s_1_24, -1, 1, 0 },
+    /* 25 */ { 2, s_1_25, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 0x435, 0x43C };
+    static constexpr char32_t s_2_1[2] = { 0x43D, 0x43D };
+    static constexpr char32_t s_2_2[2] = { 0x432, 0x448 };
+    static constexpr char32_t s_2_3[3] = { 0x438, 0x432, 0x448 };
+    static constexpr char32_t s_2_4[3] = { 0x44B, 0x432, 0x448 };
+    static constexpr char32_t s_2_5[1] = { 0x449 };
+    static constexpr char32_t s_2_6[2] = { 0x44E, 0x449 };
+    static constexpr char32_t s_2_7[3] = { 0x443, 0x44E, 0x449 };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 2, s_2_1, -1, 1, 0 },
+    /*  2 */ { 2, s_2_2, -1, 1, 0 },
+    /*  3 */ { 3, s_2_3, 2, 2, 0 },
+    /*  4 */ { 3, s_2_4, 2, 2, 0 },
+    /*  5 */ { 1, s_2_5, -1, 1, 0 },
+    /*  6 */ { 2, s_2_6, 5, 1, 0 },
+    /*  7 */ { 3, s_2_7, 6, 2, 0 }
+    };
+
+    static constexpr char32_t s_3_0[2] = { 0x441, 0x44C };
+    static constexpr char32_t s_3_1[2] = { 0x441, 0x44F };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, 1, 0 },
+    /*  1 */ { 2, s_3_1, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[2] = { 0x43B, 0x430 };
+    static constexpr char32_t s_4_1[3] = { 0x438, 0x43B, 0x430 };
+    static constexpr char32_t s_4_2[3] = { 0x44B, 0x43B, 0x430 };
+    static constexpr char32_t s_4_3[2] = { 0x43D, 0x430 };
+    static constexpr char32_t s_4_4[3] = { 0x435, 0x43D, 0x430 };
+    static constexpr char32_t s_4_5[3] = { 0x435, 0x442, 0x435 };
+    static constexpr char32_t s_4_6[3] = { 0x438, 0x442, 0x435 };
+    static constexpr char32_t s_4_7[3] = { 0x439, 0x442, 0x435 };
+    static constexpr char32_t s_4_8[4] = { 0x435, 0x439, 0x442, 0x435 };
+    static constexpr char32_t s_4_9[4] = { 0x443, 0x439, 0x442, 0x435 };
+    static constexpr char32_t s_4_10[2] = { 0x43B, 0x438 };
+    static constexpr char32_t s_4_11[3] = { 0x438, 0x43B, 0x438 };
+    static constexpr char32_t s_4_12[3] = { 0x44B, 0x43B, 0x438 };
+    static constexpr char32_t s_4_13[1] = { 0x439 };
+    static constexpr char32_t s_4_14[2] = { 0x435, 0x439 };
+    static constexpr char32_t s_4_15[2] = { 0x443, 0x439 };
+    static constexpr char32_t s_4_16[1] = { 0x43B };
+    static constexpr char32_t s_4_17[2] = { 0x438, 0x43B };
+    static constexpr char32_t s_4_18[2] = { 0x44B, 0x43B };
+    static constexpr char32_t s_4_19[2] = { 0x435, 0x43C };
+    static constexpr char32_t s_4_20[2] = { 0x438, 0x43C };
+    static constexpr char32_t s_4_21[2] = { 0x44B, 0x43C };
+    static constexpr char32_t s_4_22[1] = { 0x43D };
+    static constexpr char32_t s_4_23[2] = { 0x435, 0x43D };
+    static constexpr char32_t s_4_24[2] = { 0x43B, 0x43E };
+    static constexpr char32_t s_4_25[3] = { 0x438, 0x43B, 0x43E };
+    static constexpr char32_t s_4_26[3] = { 0x44B, 0x43B, 0x43E };
+    static constexpr char32_t s_4_27[2] = { 0x43D, 0x43E };
+    static constexpr char32_t s_4_28[3] = { 0x435, 0x43D, 0x43E };
+    static constexpr char32_t s_4_29[3] = { 0x43D, 0x43D, 0x43E };
+    static constexpr char32_t s_4_30[2] = { 0x435, 0x442 };
+    static constexpr char32_t s_4_31[3] = { 0x443, 0x435, 0x442 };
+    static constexpr char32_t s_4_32[2] = { 0x438, 0x442 };
+    static constexpr char32_t s_4_33[2] = { 0x44B, 0x442 };
+    static constexpr char32_t s_4_34[2] = { 0x44E, 0x442 };
+    static constexpr char32_t s_4_35[3] = { 0x443, 0x44E, 0x442 };
+    static constexpr char32_t s_4_36[2] = { 0x44F, 0x442 };
+    static constexpr char32_t s_4_37[2] = { 0x43D, 0x44B };
+    static constexpr char32_t s_4_38[3] = { 0x435, 0x43D, 0x44B };
+    static constexpr char32_t s_4_39[2] = { 0x442, 0x44C };
+    static constexpr char32_t s_4_40[3] = { 0x438, 0x442, 0x44C };
+    static constexpr char32_t s_4_41[3] = { 0x44B, 0x442, 0x44C };
+    static constexpr char32_t s_4_42[3] = { 0x435, 0x448, 0x44C };
+    static constexpr char32_t s_4_43[3] = { 0x438, 0x448, 0x44C };
+    static constexpr char32_t s_4_44[1] = { 0x44E };
+    static constexpr char32_t s_4_45[2] = { 0x443, 0x44E };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 2, s_4_0, -1, 1, 0 },
+    /*  1 */ { 3, s_4_1, 0, 2, 0 },
+    /*  2 */ { 3, s_4_2, 0, 2, 0 },
+    /*  3 */ { 2, s_4_3, -1, 1, 0 },
+    /*  4 */ { 3, s_4_4, 3, 2, 0 },
+    /*  5 */ { 3, s_4_5, -1, 1, 0 },
+    /*  6 */ { 3, s_4_6, -1, 2, 0 },
+    /*  7 */ { 3, s_4_7, -1, 1, 0 },
+    /*  8 */ { 4, s_4_8, 7, 2, 0 },
+    /*  9 */ { 4, s_4_9, 7, 2, 0 },
+    /* 10 */ { 2, s_4_10, -1, 1, 0 },
+    /* 11 */ { 3, s_4_11, 10, 2, 0 },
+    /* 12 */ { 3, s_4_12, 10, 2, 0 },
+    /* 13 */ { 1, s_4_13, -1, 1, 0 },
+    /* 14 */ { 2, s_4_14, 13, 2, 0 },
+    /* 15 */ { 2, s_4_15, 13, 2, 0 },
+    /* 16 */ { 1, s_4_16, -1, 1, 0 },
+    /* 17 */ { 2, s_4_17, 16, 2, 0 },
+    /* 18 */ { 2, s_4_18, 16, 2, 0 },
+    /* 19 */ { 2, s_4_19, -1, 1, 0 },
+    /* 20 */ { 2, s_4_20, -1, 2, 0 },
+    /* 21 */ { 2, s_4_21, -1, 2, 0 },
+    /* 22 */ { 1, s_4_22, -1, 1, 0 },
+    /* 23 */ { 2, s_4_23, 22, 2, 0 },
+    /* 24 */ { 2, s_4_24, -1, 1, 0 },
+    /* 25 */ { 3, s_4_25, 24, 2, 0 },
+    /* 26 */ { 3, s_4_26, 24, 2, 0 },
+    /* 27 */ { 2, s_4_27, -1, 1, 0 },
+    /* 28 */ { 3, s_4_28, 27, 2, 0 },
+    /* 29 */ { 3, s_4_29, 27, 1, 0 },
+    /* 30 */ { 2, s_4_30, -1, 1, 0 },
+    /* 31 */ { 3, s_4_31, 30, 2, 0 },
+    /* 32 */ { 2, s_4_32, -1, 2, 0 },
+    /* 33 */ { 2, s_4_33, -1, 2, 0 },
+    /* 34 */ { 2, s_4_34, -1, 1, 0 },
+    /* 35 */ { 3, s_4_35, 34, 2, 0 },
+    /* 36 */ { 2, s_4_36, -1, 2, 0 },
+    /* 37 */ { 2, s_4_37, -1, 1, 0 },
+    /* 38 */ { 3, s_4_38, 37, 2, 0 },
+    /* 39 */ { 2, s_4_39, -1, 1, 0 },
+    /* 40 */ { 3, s_4_40, 39, 2, 0 },
+    /* 41 */ { 3, s_4_41, 39, 2, 0 },
+    /* 42 */ { 3, s_4_42, -1, 1, 0 },
+    /* 43 */ { 3, s_4_43, -1, 2, 0 },
+    /* 44 */ { 1, s_4_44, -1, 2, 0 },
+    /* 45 */ { 2, s_4_45, 44, 2, 0 }
+    };
+
+    static constexpr char32_t s_5_0[1] = { 0x430 };
+    static constexpr char32_t s_5_1[2] = { 0x435, 0x432 };
+    static constexpr char32_t s_5_2[2] = { 0x43E, 0x432 };
+    static constexpr char32_t s_5_3[1] = { 0x435 };
+    static constexpr char32_t s_5_4[2] = { 0x438, 0x435 };
+    static constexpr char32_t s_5_5[2] = { 0x44C, 0x435 };
+    static constexpr char32_t s_5_6[1] = { 0x438 };
+    static constexpr char32_t s_5_7[2] = { 0x435, 0x438 };
+    static constexpr char32_t s_5_8[2] = { 0x438, 0x438 };
+    static constexpr char32_t s_5_9[3] = { 0x430, 0x43C, 0x438 };
+    static constexpr char32_t s_5_10[3] = { 0x44F, 0x43C, 0x438 };
+    static constexpr char32_t s_5_11[4] = { 0x438, 0x44F, 0x43C, 0x438 };
+    static constexpr char32_t s_5_12[1] = { 0x439 };
+    static constexpr char32_t s_5_13[2] = { 0x435, 0x439 };
+    static constexpr char32_t s_5_14[3] = { 0x438, 0x435, 0x439 };
+    static constexpr char32_t s_5_15[2] = { 0x438, 0x439 };
+    static constexpr char32_t s_5_16[2] = { 0x43E, 0x439 };
+    static constexpr char32_t s_5_17[2] = { 0x430, 0x43C };
+    static constexpr char32_t s_5_18[2] = { 0x435, 0x43C };
+    static constexpr char32_t s_5_19[3] = { 0x438, 0x435, 0x43C };
+    static constexpr char32_t s_5_20[2] = { 0x43E, 0x43C };
+    static constexpr char32_t s_5_21[2] = { 0x44F, 0x43C };
+    static constexpr char32_t s_5_22[3] = { 0x438, 0x44F, 0x43C };
+    static constexpr char32_t s_5_23[1] = { 0x43E };
+    static constexpr char32_t s_5_24[1] = { 0x443 };
+    static constexpr char32_t s_5_25[2] = { 0x430, 0x445 };
+    static constexpr char32_t s_5_26[2] = { 0x44F, 0x445 };
+    static constexpr char32_t s_5_27[3] = { 0x438, 0x44F, 0x445 };
+    static constexpr char32_t s_5_28[1] = { 0x44B };
+    static constexpr char32_t s_5_29[1] = { 0x44C };
+    static constexpr char32_t s_5_30[1] = { 0x44E };
+    static constexpr char32_t s_5_31[2] = { 0x438, 0x44E };
+    static constexpr char32_t s_5_32[2] = { 0x44C, 0x44E };
+    static constexpr char32_t s_5_33[1] = { 0x44F };
+    static constexpr char32_t s_5_34[2] = { 0x438, 0x44F };
+    static constexpr char32_t s_5_35[2] = { 0x44C, 0x44F };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 1, s_5_0, -1, 1, 0 },
+    /*  1 */ { 2, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, -1, 1, 0 },
+    /*  3 */ { 1, s_5_3, -1, 1, 0 },
+    /*  4 */ { 2, s_5_4, 3, 1, 0 },
+    /*  5 */ { 2, s_5_5, 3, 1, 0 },
+    /*  6 */ { 1, s_5_6, -1, 1, 0 },
+    /*  7 */ { 2, s_5_7, 6, 1, 0 },
+    /*  8 */ { 2, s_5_8, 6, 1, 0 },
+    /*  9 */ { 3, s_5_9, 6, 1, 0 },
+    /* 10 */ { 3, s_5_10, 6, 1, 0 },
+    /* 11 */ { 4, s_5_11, 10, 1, 0 },
+    /* 12 */ { 1, s_5_12, -1, 1, 0 },
+    /* 13 */ { 2, s_5_13, 12, 1, 0 },
+    /* 14 */ { 3, s_5_14, 13, 1, 0 },
+    /* 15 */ { 2, s_5_15, 12, 1, 0 },
+    /* 16 */ { 2, s_5_16, 12, 1, 0 },
+    /* 17 */ { 2, s_5_17, -1, 1, 0 },
+    /* 18 */ { 2, s_5_18, -1, 1, 0 },
+    /* 19 */ { 3, s_5_19, 18, 1, 0 },
+    /* 20 */ { 2, s_5_20, -1, 1, 0 },
+    /* 21 */ { 2, s_5_21, -1, 1, 0 },
+    /* 22 */ { 3, s_5_22, 21, 1, 0 },
+    /* 23 */ { 1, s_5_23, -1, 1, 0 },
+    /* 24 */ { 1, s_5_24, -1, 1, 0 },
+    /* 25 */ { 2, s_5_25, -1, 1, 0 },
+    /* 26 */ { 2, s_5_26, -1, 1, 0 },
+    /* 27 */ { 3, s_5_27, 26, 1, 0 },
+    /* 28 */ { 1, s_5_28, -1, 1, 0 },
+    /* 29 */ { 1, s_5_29, -1, 1, 0 },
+    /* 30 */ { 1, s_5_30, -1, 1, 0 },
+    /* 31 */ { 2, s_5_31, 30, 1, 0 },
+    /* 32 */ { 2, s_5_32, 30, 1, 0 },
+    /* 33 */ { 1, s_5_33, -1, 1, 0 },
+    /* 34 */ { 2, s_5_34, 33, 1, 0 },
+    /* 35 */ { 2, s_5_35, 33, 1, 0 }
+    };
+
+    static constexpr char32_t s_6_0[3] = { 0x43E, 0x441, 0x442 };
+    static constexpr char32_t s_6_1[4] = { 0x43E, 0x441, 0x442, 0x44C };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 4, s_6_1, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_7_0[4] = { 0x435, 0x439, 0x448, 0x435 };
+    static constexpr char32_t s_7_1[1] = { 0x43D };
+    static constexpr char32_t s_7_2[3] = { 0x435, 0x439, 0x448 };
+    static constexpr char32_t s_7_3[1] = { 0x44C };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 4, s_7_0, -1, 1, 0 },
+    /*  1 */ { 1, s_7_1, -1, 2, 0 },
+    /*  2 */ { 3, s_7_2, -1, 1, 0 },
+    /*  3 */ { 1, s_7_3, -1, 3, 0 }
+    };
+    static constexpr char32_t s_0[] = { 0x430 };
+    static constexpr char32_t s_1[] = { 0x44F };
+    static constexpr char32_t s_2[] = { 0x430 };
+    static constexpr char32_t s_3[] = { 0x44F };
+    static constexpr char32_t s_4[] = { 0x430 };
+    static constexpr char32_t s_5[] = { 0x44F };
+    static constexpr char32_t s_6[] = { 0x43D };
+    static constexpr char32_t s_7[] = { 0x43D };
+    static constexpr char32_t s_8[] = { 0x43D };
+    static constexpr char32_t s_9[] = { 0x438 };
+};
+
+template <typename symbol>
+class russian_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef russian_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_pV = l; /* $pV = <integer expression>, line 59 */
+        I_p2 = l; /* $p2 = <integer expression>, line 60 */
+        {   int c1 = c; /* do, line 61 */
+            {    /* gopast */ /* grouping v, line 62 */
+                int ret = out_grouping(data::g_v, 1072, 1103, 1);
+                if (ret < 0) goto lab0;
+                c += ret;
+            }
+            I_pV = c; /* setmark pV, line 62 */
+            {    /* gopast */ /* non v, line 62 */
+                int ret = in_grouping(data::g_v, 1072, 1103, 1);
+                if (ret < 0) goto lab0;
+                c += ret;
+            }
+            {    /* gopast */ /* grouping v, line 63 */
+                int ret = out_grouping(data::g_v, 1072, 1103, 1);
+                if (ret < 0) goto lab0;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 63 */
+                int ret = in_grouping(data::g_v, 1072, 1103, 1);
+                if (ret < 0) goto lab0;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 63 */
+        lab0:
+            c = c1;
+        }
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 69 */
+        return true;
+    }
+
+  private:
+    bool r_perfective_gerund() {
+        int among_var;
+        ket = c; /* [, line 72 */
+        among_var = find_among_b(data::a_0); /* substring, line 72 */
+        if (!among_var) return false;
+        bra = c; /* ], line 72 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m1 = l - c; (void)m1; /* or, line 76 */
+                    if (!eq_s_b(data::s_0)) goto lab1; /* literal, line 76 */
+                    goto lab0;
+                lab1:
+                    c = l - m1;
+                    if (!eq_s_b(data::s_1)) return false; /* literal, line 76 */
+                }
+            lab0:
+                slice_del(); /* delete, line 76 */
+                break;
+            case 2:
+                slice_del(); /* delete, line 83 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_adjective() {
+        int among_var;
+        ket = c; /* [, line 88 */
+        among_var = find_among_b(data::a_1); /* substring, line 88 */
+        if (!among_var) return false;
+        bra = c; /* ], line 88 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 97 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_adjectival() {
+        int among_var;
+        if (!r_adjective()) return false; /* call adjective, line 102 */
+        {   int m_keep = l - c; /* try, line 109 */
+            ket = c; /* [, line 110 */
+            among_var = find_among_b(data::a_2); /* substring, line 110 */
+            if (!among_var) { c = l - m_keep; goto lab0; }
+            bra = c; /* ], line 110 */
+            switch(among_var) {
+                case 0: { c = l - m_keep; goto lab0; }
+                case 1:
+                    {   int m1 = l - c; (void)m1; /* or, line 115 */
+                        if (!eq_s_b(data::s_2)) goto lab2; /* literal, line 115 */
+                        goto lab1;
+                    lab2:
+                        c = l - m1;
+                        if (!eq_s_b(data::s_3)) { c = l - m_keep; goto lab0; } /* literal, line 115 */
+                    }
+                lab1:
+                    slice_del(); /* delete, line 115 */
+                    break;
+                case 2:
+                    slice_del(); /* delete, line 122 */
+                    break;
+            }
+        lab0:
+            ;
+        }
+        return true;
+    }
+
+  private:
+    bool r_reflexive() {
+        int among_var;
+        ket = c; /* [, line 129 */
+        among_var = find_among_b(data::a_3); /* substring, line 129 */
+        if (!among_var) return false;
+        bra = c; /* ], line 129 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 132 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_verb() {
+        int among_var;
+        ket = c; /* [, line 137 */
+        among_var = find_among_b(data::a_4); /* substring, line 137 */
+        if (!among_var) return false;
+        bra = c; /* ], line 137 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m1 = l - c; (void)m1; /* or, line 143 */
+                    if (!eq_s_b(data::s_4)) goto lab1; /* literal, line 143 */
+                    goto lab0;
+                lab1:
+                    c = l - m1;
+                    if (!eq_s_b(data::s_5)) return false; /* literal, line 143 */
+                }
+            lab0:
+                slice_del(); /* delete, line 143 */
+                break;
+            case 2:
+                slice_del(); /* delete, line 151 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_noun() {
+        int among_var;
+        ket = c; /* [, line 160 */
+        among_var = find_among_b(data::a_5); /* substring, line 160 */
+        if (!among_var) return false;
+        bra = c; /* ], line 160 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 167 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_derivational() {
+        int among_var;
+        ket = c; /* [, line 176 */
+        among_var = find_among_b(data::a_6); /* substring, line 176 */
+        if (!among_var) return false;
+        bra = c; /* ], line 176 */
+        if (!r_R2()) return false; /* call R2, line 176 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 179 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_tidy_up() {
+        int among_var;
+        ket = c; /* [, line 184 */
+        among_var = find_among_b(data::a_7); /* substring, line 184 */
+        if (!among_var) return false;
+        bra = c; /* ], line 184 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 188 */
+                ket = c; /* [, line 189 */
+                if (!eq_s_b(data::s_6)) return false; /* literal, line 189 */
+                bra = c; /* ], line 189 */
+                if (!eq_s_b(data::s_7)) return false; /* literal, line 189 */
+                slice_del(); /* delete, line 189 */
+                break;
+            case 2:
+                if (!eq_s_b(data::s_8)) return false; /* literal, line 192 */
+                slice_del(); /* delete, line 192 */
+                break;
+            case 3:
+                slice_del(); /* delete, line 194 */
+                break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 201 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 201 */
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 202 */
+
+        {   int mlimit; /* setlimit, line 202 */
+            int m2 = l - c; (void)m2;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 202 */
+            mlimit = lb; lb = c;
+            c = l - m2;
+            {   int m3 = l - c; (void)m3; /* do, line 203 */
+                {   int m4 = l - c; (void)m4; /* or, line 204 */
+                    if (!r_perfective_gerund()) goto lab3; /* call perfective_gerund, line 204 */
+                    goto lab2;
+                lab3:
+                    c = l - m4;
+                    {   int m_keep = l - c; /* try, line 205 */
+                        if (!r_reflexive()) { c = l - m_keep; goto lab4; } /* call reflexive, line 205 */
+                    lab4:
+                        ;
+                    }
+                    {   int m5 = l - c; (void)m5; /* or, line 206 */
+                        if (!r_adjectival()) goto lab6; /* call adjectival, line 206 */
+                        goto lab5;
+                    lab6:
+                        c = l - m5;
+                        if (!r_verb()) goto lab7; /* call verb, line 206 */
+                        goto lab5;
+                    lab7:
+                        c = l - m5;
+                        if (!r_noun()) goto lab1; /* call noun, line 206 */
+                    }
+                lab5:
+                    ;
+                }
+            lab2:
+            lab1:
+                c = l - m3;
+            }
+            {   int m_keep = l - c; /* try, line 209 */
+                ket = c; /* [, line 209 */
+                if (!eq_s_b(data::s_9)) { c = l - m_keep; goto lab8; } /* literal, line 209 */
+                bra = c; /* ], line 209 */
+                slice_del(); /* delete, line 209 */
+            lab8:
+                ;
+            }
+            {   int m6 = l - c; (void)m6; /* do, line 212 */
+                if (!r_derivational()) goto lab9; /* call derivational, line 212 */
+            lab9:
+                c = l - m6;
+            }
+            {   int m7 = l - c; (void)m7; /* do, line 213 */
+                if (!r_tidy_up()) goto lab10; /* call tidy_up, line 213 */
+            lab10:
+                c = l - m7;
+            }
+            lb = mlimit;
+        }
+        c = lb;
+        return true;
+    }
+
+  private:
+    int I_p2 = 0;
+    int I_pV = 0;
+};
+
+}
+
+#endif
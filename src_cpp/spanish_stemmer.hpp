@@ -0,0 +1,1427 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_SPANISH_STEMMER_HPP
+#define SNOWBALL_SPANISH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct spanish_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 4, 10 };
+};
+
+template <bool utf8> struct spanish_stemmer_data;
+
+template <>
+struct spanish_stemmer_data<true> : spanish_stemmer_groupings {
+    static constexpr unsigned char s_0_1[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_0_2[2] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_0_3[2] = { 0xC3, 0xAD };
+    static constexpr unsigned char s_0_4[2] = { 0xC3, 0xB3 };
+    static constexpr unsigned char s_0_5[2] = { 0xC3, 0xBA };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 6, 0 },
+    /*  1 */ { 2, s_0_1, 0, 1, 0 },
+    /*  2 */ { 2, s_0_2, 0, 2, 0 },
+    /*  3 */ { 2, s_0_3, 0, 3, 0 },
+    /*  4 */ { 2, s_0_4, 0, 4, 0 },
+    /*  5 */ { 2, s_0_5, 0, 5, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[2] = { 'l', 'a' };
+    static constexpr unsigned char s_1_1[4] = { 's', 'e', 'l', 'a' };
+    static constexpr unsigned char s_1_2[2] = { 'l', 'e' };
+    static constexpr unsigned char s_1_3[2] = { 'm', 'e' };
+    static constexpr unsigned char s_1_4[2] = { 's', 'e' };
+    static constexpr unsigned char s_1_5[2] = { 'l', 'o' };
+    static constexpr unsigned char s_1_6[4] = { 's', 'e', 'l', 'o' };
+    static constexpr unsigned char s_1_7[3] = { 'l', 'a', 's' };
+    static constexpr unsigned char s_1_8[5] = { 's', 'e', 'l', 'a', 's' };
+    static constexpr unsigned char s_1_9[3] = { 'l', 'e', 's' };
+    static constexpr unsigned char s_1_10[3] = { 'l', 'o', 's' };
+    static constexpr unsigned char s_1_11[5] = { 's', 'e', 'l', 'o', 's' };
+    static constexpr unsigned char s_1_12[3] = { 'n', 'o', 's' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 4, s_1_1, 0, -1, 0 },
+    /*  2 */ { 2, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 },
+    /*  4 */ { 2, s_1_4, -1, -1, 0 },
+    /*  5 */ { 2, s_1_5, -1, -1, 0 },
+    /*  6 */ { 4, s_1_6, 5, -1, 0 },
+    /*  7 */ { 3, s_1_7, -1, -1, 0 },
+    /*  8 */ { 5, s_1_8, 7, -1, 0 },
+    /*  9 */ { 3, s_1_9, -1, -1, 0 },
+    /* 10 */ { 3, s_1_10, -1, -1, 0 },
+    /* 11 */ { 5, s_1_11, 10, -1, 0 },
+    /* 12 */ { 3, s_1_12, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr unsigned char s_2_1[5] = { 'i', 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_2_2[5] = { 'y', 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_2_3[5] = { 0xC3, 0xA1, 'n', 'd', 'o' };
+    static constexpr unsigned char s_2_4[6] = { 'i', 0xC3, 0xA9, 'n', 'd', 'o' };
+    static constexpr unsigned char s_2_5[2] = { 'a', 'r' };
+    static constexpr unsigned char s_2_6[2] = { 'e', 'r' };
+    static constexpr unsigned char s_2_7[2] = { 'i', 'r' };
+    static constexpr unsigned char s_2_8[3] = { 0xC3, 0xA1, 'r' };
+    static constexpr unsigned char s_2_9[3] = { 0xC3, 0xA9, 'r' };
+    static constexpr unsigned char s_2_10[3] = { 0xC3, 0xAD, 'r' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 4, s_2_0, -1, 6, 0 },
+    /*  1 */ { 5, s_2_1, -1, 6, 0 },
+    /*  2 */ { 5, s_2_2, -1, 7, 0 },
+    /*  3 */ { 5, s_2_3, -1, 2, 0 },
+    /*  4 */ { 6, s_2_4, -1, 1, 0 },
+    /*  5 */ { 2, s_2_5, -1, 6, 0 },
+    /*  6 */ { 2, s_2_6, -1, 6, 0 },
+    /*  7 */ { 2, s_2_7, -1, 6, 0 },
+    /*  8 */ { 3, s_2_8, -1, 3, 0 },
+    /*  9 */ { 3, s_2_9, -1, 4, 0 },
+    /* 10 */ { 3, s_2_10, -1, 5, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_3_1[2] = { 'a', 'd' };
+    static constexpr unsigned char s_3_2[2] = { 'o', 's' };
+    static constexpr unsigned char s_3_3[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, -1, 0 },
+    /*  1 */ { 2, s_3_1, -1, -1, 0 },
+    /*  2 */ { 2, s_3_2, -1, -1, 0 },
+    /*  3 */ { 2, s_3_3, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_4_1[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr unsigned char s_4_2[4] = { 'a', 'n', 't', 'e' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 4, s_4_0, -1, 1, 0 },
+    /*  1 */ { 4, s_4_1, -1, 1, 0 },
+    /*  2 */ { 4, s_4_2, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 'i', 'c' };
+    static constexpr unsigned char s_5_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr unsigned char s_5_2[2] = { 'i', 'v' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[3] = { 'i', 'c', 'a' };
+    static constexpr unsigned char s_6_1[5] = { 'a', 'n', 'c', 'i', 'a' };
+    static constexpr unsigned char s_6_2[5] = { 'e', 'n', 'c', 'i', 'a' };
+    static constexpr unsigned char s_6_3[5] = { 'a', 'd', 'o', 'r', 'a' };
+    static constexpr unsigned char s_6_4[3] = { 'o', 's', 'a' };
+    static constexpr unsigned char s_6_5[4] = { 'i', 's', 't', 'a' };
+    static constexpr unsigned char s_6_6[3] = { 'i', 'v', 'a' };
+    static constexpr unsigned char s_6_7[4] = { 'a', 'n', 'z', 'a' };
+    static constexpr unsigned char s_6_8[6] = { 'l', 'o', 'g', 0xC3, 0xAD, 'a' };
+    static constexpr unsigned char s_6_9[4] = { 'i', 'd', 'a', 'd' };
+    static constexpr unsigned char s_6_10[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr unsigned char s_6_11[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr unsigned char s_6_12[4] = { 'a', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_13[5] = { 'm', 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_14[6] = { 'a', 'm', 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_6_15[6] = { 'a', 'c', 'i', 0xC3, 0xB3, 'n' };
+    static constexpr unsigned char s_6_16[6] = { 'u', 'c', 'i', 0xC3, 0xB3, 'n' };
+    static constexpr unsigned char s_6_17[3] = { 'i', 'c', 'o' };
+    static constexpr unsigned char s_6_18[4] = { 'i', 's', 'm', 'o' };
+    static constexpr unsigned char s_6_19[3] = { 'o', 's', 'o' };
+    static constexpr unsigned char s_6_20[7] = { 'a', 'm', 'i', 'e', 'n', 't', 'o' };
+    static constexpr unsigned char s_6_21[7] = { 'i', 'm', 'i', 'e', 'n', 't', 'o' };
+    static constexpr unsigned char s_6_22[3] = { 'i', 'v', 'o' };
+    static constexpr unsigned char s_6_23[4] = { 'a', 'd', 'o', 'r' };
+    static constexpr unsigned char s_6_24[4] = { 'i', 'c', 'a', 's' };
+    static constexpr unsigned char s_6_25[6] = { 'a', 'n', 'c', 'i', 'a', 's' };
+    static constexpr unsigned char s_6_26[6] = { 'e', 'n', 'c', 'i', 'a', 's' };
+    static constexpr unsigned char s_6_27[6] = { 'a', 'd', 'o', 'r', 'a', 's' };
+    static constexpr unsigned char s_6_28[4] = { 'o', 's', 'a', 's' };
+    static constexpr unsigned char s_6_29[5] = { 'i', 's', 't', 'a', 's' };
+    static constexpr unsigned char s_6_30[4] = { 'i', 'v', 'a', 's' };
+    static constexpr unsigned char s_6_31[5] = { 'a', 'n', 'z', 'a', 's' };
+    static constexpr unsigned char s_6_32[7] = { 'l', 'o', 'g', 0xC3, 0xAD, 'a', 's' };
+    static constexpr unsigned char s_6_33[6] = { 'i', 'd', 'a', 'd', 'e', 's' };
+    static constexpr unsigned char s_6_34[5] = { 'a', 'b', 'l', 'e', 's' };
+    static constexpr unsigned char s_6_35[5] = { 'i', 'b', 'l', 'e', 's' };
+    static constexpr unsigned char s_6_36[7] = { 'a', 'c', 'i', 'o', 'n', 'e', 's' };
+    static constexpr unsigned char s_6_37[7] = { 'u', 'c', 'i', 'o', 'n', 'e', 's' };
+    static constexpr unsigned char s_6_38[6] = { 'a', 'd', 'o', 'r', 'e', 's' };
+    static constexpr unsigned char s_6_39[5] = { 'a', 'n', 't', 'e', 's' };
+    static constexpr unsigned char s_6_40[4] = { 'i', 'c', 'o', 's' };
+    static constexpr unsigned char s_6_41[5] = { 'i', 's', 'm', 'o', 's' };
+    static constexpr unsigned char s_6_42[4] = { 'o', 's', 'o', 's' };
+    static constexpr unsigned char s_6_43[8] = { 'a', 'm', 'i', 'e', 'n', 't', 'o', 's' };
+    static constexpr unsigned char s_6_44[8] = { 'i', 'm', 'i', 'e', 'n', 't', 'o', 's' };
+    static constexpr unsigned char s_6_45[4] = { 'i', 'v', 'o', 's' };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 5, s_6_1, -1, 2, 0 },
+    /*  2 */ { 5, s_6_2, -1, 5, 0 },
+    /*  3 */ { 5, s_6_3, -1, 2, 0 },
+    /*  4 */ { 3, s_6_4, -1, 1, 0 },
+    /*  5 */ { 4, s_6_5, -1, 1, 0 },
+    /*  6 */ { 3, s_6_6, -1, 9, 0 },
+    /*  7 */ { 4, s_6_7, -1, 1, 0 },
+    /*  8 */ { 6, s_6_8, -1, 3, 0 },
+    /*  9 */ { 4, s_6_9, -1, 8, 0 },
+    /* 10 */ { 4, s_6_10, -1, 1, 0 },
+    /* 11 */ { 4, s_6_11, -1, 1, 0 },
+    /* 12 */ { 4, s_6_12, -1, 2, 0 },
+    /* 13 */ { 5, s_6_13, -1, 7, 0 },
+    /* 14 */ { 6, s_6_14, 13, 6, 0 },
+    /* 15 */ { 6, s_6_15, -1, 2, 0 },
+    /* 16 */ { 6, s_6_16, -1, 4, 0 },
+    /* 17 */ { 3, s_6_17, -1, 1, 0 },
+    /* 18 */ { 4, s_6_18, -1, 1, 0 },
+    /* 19 */ { 3, s_6_19, -1, 1, 0 },
+    /* 20 */ { 7, s_6_20, -1, 1, 0 },
+    /* 21 */ { 7, s_6_21, -1, 1, 0 },
+    /* 22 */ { 3, s_6_22, -1, 9, 0 },
+    /* 23 */ { 4, s_6_23, -1, 2, 0 },
+    /* 24 */ { 4, s_6_24, -1, 1, 0 },
+    /* 25 */ { 6, s_6_25, -1, 2, 0 },
+    /* 26 */ { 6, s_6_26, -1, 5, 0 },
+    /* 27 */ { 6, s_6_27, -1, 2, 0 },
+    /* 28 */ { 4, s_6_28, -1, 1, 0 },
+    /* 29 */ { 5, s_6_29, -1, 1, 0 },
+    /* 30 */ { 4, s_6_30, -1, 9, 0 },
+    /* 31 */ { 5, s_6_31, -1, 1, 0 },
+    /* 32 */ { 7, s_6_32, -1, 3, 0 },
+    /* 33 */ { 6, s_6_33, -1, 8, 0 },
+    /* 34 */ { 5, s_6_34, -1, 1, 0 },
+    /* 35 */ { 5, s_6_35, -1, 1, 0 },
+    /* 36 */ { 7, s_6_36, -1, 2, 0 },
+    /* 37 */ { 7, s_6_37, -1, 4, 0 },
+    /* 38 */ { 6, s_6_38, -1, 2, 0 },
+    /* 39 */ { 5, s_6_39, -1, 2, 0 },
+    /* 40 */ { 4, s_6_40, -1, 1, 0 },
+    /* 41 */ { 5, s_6_41, -1, 1, 0 },
+    /* 42 */ { 4, s_6_42, -1, 1, 0 },
+    /* 43 */ { 8, s_6_43, -1, 1, 0 },
+    /* 44 */ { 8, s_6_44, -1, 1, 0 },
+    /* 45 */ { 4, s_6_45, -1, 9, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[2] = { 'y', 'a' };
+    static constexpr unsigned char s_7_1[2] = { 'y', 'e' };
+    static constexpr unsigned char s_7_2[3] = { 'y', 'a', 'n' };
+    static constexpr unsigned char s_7_3[3] = { 'y', 'e', 'n' };
+    static constexpr unsigned char s_7_4[5] = { 'y', 'e', 'r', 'o', 'n' };
+    static constexpr unsigned char s_7_5[5] = { 'y', 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_7_6[2] = { 'y', 'o' };
+    static constexpr unsigned char s_7_7[3] = { 'y', 'a', 's' };
+    static constexpr unsigned char s_7_8[3] = { 'y', 'e', 's' };
+    static constexpr unsigned char s_7_9[4] = { 'y', 'a', 'i', 's' };
+    static constexpr unsigned char s_7_10[5] = { 'y', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_7_11[3] = { 'y', 0xC3, 0xB3 };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 2, s_7_0, -1, 1, 0 },
+    /*  1 */ { 2, s_7_1, -1, 1, 0 },
+    /*  2 */ { 3, s_7_2, -1, 1, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 5, s_7_4, -1, 1, 0 },
+    /*  5 */ { 5, s_7_5, -1, 1, 0 },
+    /*  6 */ { 2, s_7_6, -1, 1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 3, s_7_8, -1, 1, 0 },
+    /*  9 */ { 4, s_7_9, -1, 1, 0 },
+    /* 10 */ { 5, s_7_10, -1, 1, 0 },
+    /* 11 */ { 3, s_7_11, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[3] = { 'a', 'b', 'a' };
+    static constexpr unsigned char s_8_1[3] = { 'a', 'd', 'a' };
+    static constexpr unsigned char s_8_2[3] = { 'i', 'd', 'a' };
+    static constexpr unsigned char s_8_3[3] = { 'a', 'r', 'a' };
+    static constexpr unsigned char s_8_4[4] = { 'i', 'e', 'r', 'a' };
+    static constexpr unsigned char s_8_5[3] = { 0xC3, 0xAD, 'a' };
+    static constexpr unsigned char s_8_6[5] = { 'a', 'r', 0xC3, 0xAD, 'a' };
+    static constexpr unsigned char s_8_7[5] = { 'e', 'r', 0xC3, 0xAD, 'a' };
+    static constexpr unsigned char s_8_8[5] = { 'i', 'r', 0xC3, 0xAD, 'a' };
+    static constexpr unsigned char s_8_9[2] = { 'a', 'd' };
+    static constexpr unsigned char s_8_10[2] = { 'e', 'd' };
+    static constexpr unsigned char s_8_11[2] = { 'i', 'd' };
+    static constexpr unsigned char s_8_12[3] = { 'a', 's', 'e' };
+    static constexpr unsigned char s_8_13[4] = { 'i', 'e', 's', 'e' };
+    static constexpr unsigned char s_8_14[4] = { 'a', 's', 't', 'e' };
+    static constexpr unsigned char s_8_15[4] = { 'i', 's', 't', 'e' };
+    static constexpr unsigned char s_8_16[2] = { 'a', 'n' };
+    static constexpr unsigned char s_8_17[4] = { 'a', 'b', 'a', 'n' };
+    static constexpr unsigned char s_8_18[4] = { 'a', 'r', 'a', 'n' };
+    static constexpr unsigned char s_8_19[5] = { 'i', 'e', 'r', 'a', 'n' };
+    static constexpr unsigned char s_8_20[4] = { 0xC3, 0xAD, 'a', 'n' };
+    static constexpr unsigned char s_8_21[6] = { 'a', 'r', 0xC3, 0xAD, 'a', 'n' };
+    static constexpr unsigned char s_8_22[6] = { 'e', 'r', 0xC3, 0xAD, 'a', 'n' };
+    static constexpr unsigned char s_8_23[6] = { 'i', 'r', 0xC3, 0xAD, 'a', 'n' };
+    static constexpr unsigned char s_8_24[2] = { 'e', 'n' };
+    static constexpr unsigned char s_8_25[4] = { 'a', 's', 'e', 'n' };
+    static constexpr unsigned char s_8_26[5] = { 'i', 'e', 's', 'e', 'n' };
+    static constexpr unsigned char s_8_27[4] = { 'a', 'r', 'o', 'n' };
+    static constexpr unsigned char s_8_28[5] = { 'i', 'e', 'r', 'o', 'n' };
+    static constexpr unsigned char s_8_29[5] = { 'a', 'r', 0xC3, 0xA1, 'n' };
+    static constexpr unsigned char s_8_30[5] = { 'e', 'r', 0xC3, 0xA1, 'n' };
+    static constexpr unsigned char s_8_31[5] = { 'i', 'r', 0xC3, 0xA1, 'n' };
+    static constexpr unsigned char s_8_32[3] = { 'a', 'd', 'o' };
+    static constexpr unsigned char s_8_33[3] = { 'i', 'd', 'o' };
+    static constexpr unsigned char s_8_34[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr unsigned char s_8_35[5] = { 'i', 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_8_36[2] = { 'a', 'r' };
+    static constexpr unsigned char s_8_37[2] = { 'e', 'r' };
+    static constexpr unsigned char s_8_38[2] = { 'i', 'r' };
+    static constexpr unsigned char s_8_39[2] = { 'a', 's' };
+    static constexpr unsigned char s_8_40[4] = { 'a', 'b', 'a', 's' };
+    static constexpr unsigned char s_8_41[4] = { 'a', 'd', 'a', 's' };
+    static constexpr unsigned char s_8_42[4] = { 'i', 'd', 'a', 's' };
+    static constexpr unsigned char s_8_43[4] = { 'a', 'r', 'a', 's' };
+    static constexpr unsigned char s_8_44[5] = { 'i', 'e', 'r', 'a', 's' };
+    static constexpr unsigned char s_8_45[4] = { 0xC3, 0xAD, 'a', 's' };
+    static constexpr unsigned char s_8_46[6] = { 'a', 'r', 0xC3, 0xAD, 'a', 's' };
+    static constexpr unsigned char s_8_47[6] = { 'e', 'r', 0xC3, 0xAD, 'a', 's' };
+    static constexpr unsigned char s_8_48[6] = { 'i', 'r', 0xC3, 0xAD, 'a', 's' };
+    static constexpr unsigned char s_8_49[2] = { 'e', 's' };
+    static constexpr unsigned char s_8_50[4] = { 'a', 's', 'e', 's' };
+    static constexpr unsigned char s_8_51[5] = { 'i', 'e', 's', 'e', 's' };
+    static constexpr unsigned char s_8_52[5] = { 'a', 'b', 'a', 'i', 's' };
+    static constexpr unsigned char s_8_53[5] = { 'a', 'r', 'a', 'i', 's' };
+    static constexpr unsigned char s_8_54[6] = { 'i', 'e', 'r', 'a', 'i', 's' };
+    static constexpr unsigned char s_8_55[5] = { 0xC3, 0xAD, 'a', 'i', 's' };
+    static constexpr unsigned char s_8_56[7] = { 'a', 'r', 0xC3, 0xAD, 'a', 'i', 's' };
+    static constexpr unsigned char s_8_57[7] = { 'e', 'r', 0xC3, 0xAD, 'a', 'i', 's' };
+    static constexpr unsigned char s_8_58[7] = { 'i', 'r', 0xC3, 0xAD, 'a', 'i', 's' };
+    static constexpr unsigned char s_8_59[5] = { 'a', 's', 'e', 'i', 's' };
+    static constexpr unsigned char s_8_60[6] = { 'i', 'e', 's', 'e', 'i', 's' };
+    static constexpr unsigned char s_8_61[6] = { 'a', 's', 't', 'e', 'i', 's' };
+    static constexpr unsigned char s_8_62[6] = { 'i', 's', 't', 'e', 'i', 's' };
+    static constexpr unsigned char s_8_63[4] = { 0xC3, 0xA1, 'i', 's' };
+    static constexpr unsigned char s_8_64[4] = { 0xC3, 0xA9, 'i', 's' };
+    static constexpr unsigned char s_8_65[6] = { 'a', 'r', 0xC3, 0xA9, 'i', 's' };
+    static constexpr unsigned char s_8_66[6] = { 'e', 'r', 0xC3, 0xA9, 'i', 's' };
+    static constexpr unsigned char s_8_67[6] = { 'i', 'r', 0xC3, 0xA9, 'i', 's' };
+    static constexpr unsigned char s_8_68[4] = { 'a', 'd', 'o', 's' };
+    static constexpr unsigned char s_8_69[4] = { 'i', 'd', 'o', 's' };
+    static constexpr unsigned char s_8_70[4] = { 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_71[7] = { 0xC3, 0xA1, 'b', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_72[7] = { 0xC3, 0xA1, 'r', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_73[8] = { 'i', 0xC3, 0xA9, 'r', 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_74[6] = { 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_75[8] = { 'a', 'r', 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_76[8] = { 'e', 'r', 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_77[8] = { 'i', 'r', 0xC3, 0xAD, 'a', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_78[4] = { 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_79[6] = { 'a', 'r', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_80[6] = { 'e', 'r', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_81[6] = { 'i', 'r', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_82[7] = { 0xC3, 0xA1, 's', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_83[8] = { 'i', 0xC3, 0xA9, 's', 'e', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_84[4] = { 'i', 'm', 'o', 's' };
+    static constexpr unsigned char s_8_85[5] = { 'a', 'r', 0xC3, 0xA1, 's' };
+    static constexpr unsigned char s_8_86[5] = { 'e', 'r', 0xC3, 0xA1, 's' };
+    static constexpr unsigned char s_8_87[5] = { 'i', 'r', 0xC3, 0xA1, 's' };
+    static constexpr unsigned char s_8_88[3] = { 0xC3, 0xAD, 's' };
+    static constexpr unsigned char s_8_89[4] = { 'a', 'r', 0xC3, 0xA1 };
+    static constexpr unsigned char s_8_90[4] = { 'e', 'r', 0xC3, 0xA1 };
+    static constexpr unsigned char s_8_91[4] = { 'i', 'r', 0xC3, 0xA1 };
+    static constexpr unsigned char s_8_92[4] = { 'a', 'r', 0xC3, 0xA9 };
+    static constexpr unsigned char s_8_93[4] = { 'e', 'r', 0xC3, 0xA9 };
+    static constexpr unsigned char s_8_94[4] = { 'i', 'r', 0xC3, 0xA9 };
+    static constexpr unsigned char s_8_95[3] = { 'i', 0xC3, 0xB3 };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 3, s_8_0, -1, 2, 0 },
+    /*  1 */ { 3, s_8_1, -1, 2, 0 },
+    /*  2 */ { 3, s_8_2, -1, 2, 0 },
+    /*  3 */ { 3, s_8_3, -1, 2, 0 },
+    /*  4 */ { 4, s_8_4, -1, 2, 0 },
+    /*  5 */ { 3, s_8_5, -1, 2, 0 },
+    /*  6 */ { 5, s_8_6, 5, 2, 0 },
+    /*  7 */ { 5, s_8_7, 5, 2, 0 },
+    /*  8 */ { 5, s_8_8, 5, 2, 0 },
+    /*  9 */ { 2, s_8_9, -1, 2, 0 },
+    /* 10 */ { 2, s_8_10, -1, 2, 0 },
+    /* 11 */ { 2, s_8_11, -1, 2, 0 },
+    /* 12 */ { 3, s_8_12, -1, 2, 0 },
+    /* 13 */ { 4, s_8_13, -1, 2, 0 },
+    /* 14 */ { 4, s_8_14, -1, 2, 0 },
+    /* 15 */ { 4, s_8_15, -1, 2, 0 },
+    /* 16 */ { 2, s_8_16, -1, 2, 0 },
+    /* 17 */ { 4, s_8_17, 16, 2, 0 },
+    /* 18 */ { 4, s_8_18, 16, 2, 0 },
+    /* 19 */ { 5, s_8_19, 16, 2, 0 },
+    /* 20 */ { 4, s_8_20, 16, 2, 0 },
+    /* 21 */ { 6, s_8_21, 20, 2, 0 },
+    /* 22 */ { 6, s_8_22, 20, 2, 0 },
+    /* 23 */ { 6, s_8_23, 20, 2, 0 },
+    /* 24 */ { 2, s_8_24, -1, 1, 0 },
+    /* 25 */ { 4, s_8_25, 24, 2, 0 },
+    /* 26 */ { 5, s_8_26, 24, 2, 0 },
+    /* 27 */ { 4, s_8_27, -1, 2, 0 },
+    /* 28 */ { 5, s_8_28, -1, 2, 0 },
+    /* 29 */ { 5, s_8_29, -1, 2, 0 },
+    /* 30 */ { 5, s_8_30, -1, 2, 0 },
+    /* 31 */ { 5, s_8_31, -1, 2, 0 },
+    /* 32 */ { 3, s_8_32, -1, 2, 0 },
+    /* 33 */ { 3, s_8_33, -1, 2, 0 },
+    /* 34 */ { 4, s_8_34, -1, 2, 0 },
+    /* 35 */ { 5, s_8_35, -1, 2, 0 },
+    /* 36 */ { 2, s_8_36, -1, 2, 0 },
+    /* 37 */ { 2, s_8_37, -1, 2, 0 },
+    /* 38 */ { 2, s_8_38, -1, 2, 0 },
+    /* 39 */ { 2, s_8_39, -1, 2, 0 },
+    /* 40 */ { 4, s_8_40, 39, 2, 0 },
+    /* 41 */ { 4, s_8_41, 39, 2, 0 },
+    /* 42 */ { 4, s_8_42, 39, 2, 0 },
+    /* 43 */ { 4, s_8_43, 39, 2, 0 },
+    /* 44 */ { 5, s_8_44, 39, 2, 0 },
+    /* 45 */ { 4, s_8_45, 39, 2, 0 },
+    /* 46 */ { 6, s_8_46, 45, 2, 0 },
+    /* 47 */ { 6, s_8_47, 45, 2, 0 },
+    /* 48 */ { 6, s_8_48, 45, 2, 0 },
+    /* 49 */ { 2, s_8_49, -1, 1, 0 },
+    /* 50 */ { 4, s_8_50, 49, 2, 0 },
+    /* 51 */ { 5, s_8_51, 49, 2, 0 },
+    /* 52 */ { 5, s_8_52, -1, 2, 0 },
+    /* 53 */ { 5, s_8_53, -1, 2, 0 },
+    /* 54 */ { 6, s_8_54, -1, 2, 0 },
+    /* 55 */ { 5, s_8_55, -1, 2, 0 },
+    /* 56 */ { 7, s_8_56, 55, 2, 0 },
+    /* 57 */ { 7, s_8_57, 55, 2, 0 },
+    /* 58 */ { 7, s_8_58, 55, 2, 0 },
+    /* 59 */ { 5, s_8_59, -1, 2, 0 },
+    /* 60 */ { 6, s_8_60, -1, 2, 0 },
+    /* 61 */ { 6, s_8_61, -1, 2, 0 },
+    /* 62 */ { 6, s_8_62, -1, 2, 0 },
+    /* 63 */ { 4, s_8_63, -1, 2, 0 },
+    /* 64 */ { 4, s_8_64, -1, 1, 0 },
+    /* 65 */ { 6, s_8_65, 64, 2, 0 },
+    /* 66 */ { 6, s_8_66, 64, 2, 0 },
+    /* 67 */ { 6, s_8_67, 64, 2, 0 },
+    /* 68 */ { 4, s_8_68, -1, 2, 0 },
+    /* 69 */ { 4, s_8_69, -1, 2, 0 },
+    /* 70 */ { 4, s_8_70, -1, 2, 0 },
+    /* 71 */ { 7, s_8_71, 70, 2, 0 },
+    /* 72 */ { 7, s_8_72, 70, 2, 0 },
+    /* 73 */ { 8, s_8_73, 70, 2, 0 },
+    /* 74 */ { 6, s_8_74, 70, 2, 0 },
+    /* 75 */ { 8, s_8_75, 74, 2, 0 },
+    /* 76 */ { 8, s_8_76, 74, 2, 0 },
+    /* 77 */ { 8, s_8_77, 74, 2, 0 },
+    /* 78 */ { 4, s_8_78, -1, 1, 0 },
+    /* 79 */ { 6, s_8_79, 78, 2, 0 },
+    /* 80 */ { 6, s_8_80, 78, 2, 0 },
+    /* 81 */ { 6, s_8_81, 78, 2, 0 },
+    /* 82 */ { 7, s_8_82, 78, 2, 0 },
+    /* 83 */ { 8, s_8_83, 78, 2, 0 },
+    /* 84 */ { 4, s_8_84, -1, 2, 0 },
+    /* 85 */ { 5, s_8_85, -1, 2, 0 },
+    /* 86 */ { 5, s_8_86, -1, 2, 0 },
+    /* 87 */ { 5, s_8_87, -1, 2, 0 },
+    /* 88 */ { 3, s_8_88, -1, 2, 0 },
+    /* 89 */ { 4, s_8_89, -1, 2, 0 },
+    /* 90 */ { 4, s_8_90, -1, 2, 0 },
+    /* 91 */ { 4, s_8_91, -1, 2, 0 },
+    /* 92 */ { 4, s_8_92, -1, 2, 0 },
+    /* 93 */ { 4, s_8_93, -1, 2, 0 },
+    /* 94 */ { 4, s_8_94, -1, 2, 0 },
+    /* 95 */ { 3, s_8_95, -1, 2, 0 }
+    };
+
+    static constexpr unsigned char s_9_0[1] = { 'a' };
+    static constexpr unsigned char s_9_1[1] = { 'e' };
+    static constexpr unsigned char s_9_2[1] = { 'o' };
+    static constexpr unsigned char s_9_3[2] = { 'o', 's' };
+    static constexpr unsigned char s_9_4[2] = { 0xC3, 0xA1 };
+    static constexpr unsigned char s_9_5[2] = { 0xC3, 0xA9 };
+    static constexpr unsigned char s_9_6[2] = { 0xC3, 0xAD };
+    static constexpr unsigned char s_9_7[2] = { 0xC3, 0xB3 };
+
+    static constexpr among<unsigned char> a_9[] = {
+    /*  0 */ { 1, s_9_0, -1, 1, 0 },
+    /*  1 */ { 1, s_9_1, -1, 2, 0 },
+    /*  2 */ { 1, s_9_2, -1, 1, 0 },
+    /*  3 */ { 2, s_9_3, -1, 1, 0 },
+    /*  4 */ { 2, s_9_4, -1, 1, 0 },
+    /*  5 */ { 2, s_9_5, -1, 2, 0 },
+    /*  6 */ { 2, s_9_6, -1, 1, 0 },
+    /*  7 */ { 2, s_9_7, -1, 1, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'a' };
+    static constexpr unsigned char s_1[] = { 'e' };
+    static constexpr unsigned char s_2[] = { 'i' };
+    static constexpr unsigned char s_3[] = { 'o' };
+    static constexpr unsigned char s_4[] = { 'u' };
+    static constexpr unsigned char s_5[] = { 'i', 'e', 'n', 'd', 'o' };
+    static constexpr unsigned char s_6[] = { 'a', 'n', 'd', 'o' };
+    static constexpr unsigned char s_7[] = { 'a', 'r' };
+    static constexpr unsigned char s_8[] = { 'e', 'r' };
+    static constexpr unsigned char s_9[] = { 'i', 'r' };
+    static constexpr unsigned char s_10[] = { 'u' };
+    static constexpr unsigned char s_11[] = { 'i', 'c' };
+    static constexpr unsigned char s_12[] = { 'l', 'o', 'g' };
+    static constexpr unsigned char s_13[] = { 'u' };
+    static constexpr unsigned char s_14[] = { 'e', 'n', 't', 'e' };
+    static constexpr unsigned char s_15[] = { 'a', 't' };
+    static constexpr unsigned char s_16[] = { 'a', 't' };
+    static constexpr unsigned char s_17[] = { 'u' };
+    static constexpr unsigned char s_18[] = { 'u' };
+    static constexpr unsigned char s_19[] = { 'g' };
+    static constexpr unsigned char s_20[] = { 'u' };
+    static constexpr unsigned char s_21[] = { 'g' };
+};
+
+template <>
+struct spanish_stemmer_data<false> : spanish_stemmer_groupings {
+    static constexpr char32_t s_0_1[1] = { 0xE1 };
+    static constexpr char32_t s_0_2[1] = { 0xE9 };
+    static constexpr char32_t s_0_3[1] = { 0xED };
+    static constexpr char32_t s_0_4[1] = { 0xF3 };
+    static constexpr char32_t s_0_5[1] = { 0xFA };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 0, nullptr, -1, 6, 0 },
+    /*  1 */ { 1, s_0_1, 0, 1, 0 },
+    /*  2 */ { 1, s_0_2, 0, 2, 0 },
+    /*  3 */ { 1, s_0_3, 0, 3, 0 },
+    /*  4 */ { 1, s_0_4, 0, 4, 0 },
+    /*  5 */ { 1, s_0_5, 0, 5, 0 }
+    };
+
+    static constexpr char32_t s_1_0[2] = { 'l', 'a' };
+    static constexpr char32_t s_1_1[4] = { 's', 'e', 'l', 'a' };
+    static constexpr char32_t s_1_2[2] = { 'l', 'e' };
+    static constexpr char32_t s_1_3[2] = { 'm', 'e' };
+    static constexpr char32_t s_1_4[2] = { 's', 'e' };
+    static constexpr char32_t s_1_5[2] = { 'l', 'o' };
+    static constexpr char32_t s_1_6[4] = { 's', 'e', 'l', 'o' };
+    static constexpr char32_t s_1_7[3] = { 'l', 'a', 's' };
+    static constexpr char32_t s_1_8[5] = { 's', 'e', 'l', 'a', 's' };
+    static constexpr char32_t s_1_9[3] = { 'l', 'e', 's' };
+    static constexpr char32_t s_1_10[3] = { 'l', 'o', 's' };
+    static constexpr char32_t s_1_11[5] = { 's', 'e', 'l', 'o', 's' };
+    static constexpr char32_t s_1_12[3] = { 'n', 'o', 's' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 4, s_1_1, 0, -1, 0 },
+    /*  2 */ { 2, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 },
+    /*  4 */ { 2, s_1_4, -1, -1, 0 },
+    /*  5 */ { 2, s_1_5, -1, -1, 0 },
+    /*  6 */ { 4, s_1_6, 5, -1, 0 },
+    /*  7 */ { 3, s_1_7, -1, -1, 0 },
+    /*  8 */ { 5, s_1_8, 7, -1, 0 },
+    /*  9 */ { 3, s_1_9, -1, -1, 0 },
+    /* 10 */ { 3, s_1_10, -1, -1, 0 },
+    /* 11 */ { 5, s_1_11, 10, -1, 0 },
+    /* 12 */ { 3, s_1_12, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr char32_t s_2_1[5] = { 'i', 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_2_2[5] = { 'y', 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_2_3[4] = { 0xE1, 'n', 'd', 'o' };
+    static constexpr char32_t s_2_4[5] = { 'i', 0xE9, 'n', 'd', 'o' };
+    static constexpr char32_t s_2_5[2] = { 'a', 'r' };
+    static constexpr char32_t s_2_6[2] = { 'e', 'r' };
+    static constexpr char32_t s_2_7[2] = { 'i', 'r' };
+    static constexpr char32_t s_2_8[2] = { 0xE1, 'r' };
+    static constexpr char32_t s_2_9[2] = { 0xE9, 'r' };
+    static constexpr char32_t s_2_10[2] = { 0xED, 'r' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 4, s_2_0, -1, 6, 0 },
+    /*  1 */ { 5, s_2_1, -1, 6, 0 },
+    /*  2 */ { 5, s_2_2, -1, 7, 0 },
+    /*  3 */ { 4, s_2_3, -1, 2, 0 },
+    /*  4 */ { 5, s_2_4, -1, 1, 0 },
+    /*  5 */ { 2, s_2_5, -1, 6, 0 },
+    /*  6 */ { 2, s_2_6, -1, 6, 0 },
+    /*  7 */ { 2, s_2_7, -1, 6, 0 },
+    /*  8 */ { 2, s_2_8, -1, 3, 0 },
+    /*  9 */ { 2, s_2_9, -1, 4, 0 },
+    /* 10 */ { 2, s_2_10, -1, 5, 0 }
+    };
+
+    static constexpr char32_t s_3_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_3_1[2] = { 'a', 'd' };
+    static constexpr char32_t s_3_2[2] = { 'o', 's' };
+    static constexpr char32_t s_3_3[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, -1, 0 },
+    /*  1 */ { 2, s_3_1, -1, -1, 0 },
+    /*  2 */ { 2, s_3_2, -1, -1, 0 },
+    /*  3 */ { 2, s_3_3, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_4_1[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr char32_t s_4_2[4] = { 'a', 'n', 't', 'e' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 4, s_4_0, -1, 1, 0 },
+    /*  1 */ { 4, s_4_1, -1, 1, 0 },
+    /*  2 */ { 4, s_4_2, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 'i', 'c' };
+    static constexpr char32_t s_5_1[4] = { 'a', 'b', 'i', 'l' };
+    static constexpr char32_t s_5_2[2] = { 'i', 'v' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, 1, 0 },
+    /*  1 */ { 4, s_5_1, -1, 1, 0 },
+    /*  2 */ { 2, s_5_2, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_6_0[3] = { 'i', 'c', 'a' };
+    static constexpr char32_t s_6_1[5] = { 'a', 'n', 'c', 'i', 'a' };
+    static constexpr char32_t s_6_2[5] = { 'e', 'n', 'c', 'i', 'a' };
+    static constexpr char32_t s_6_3[5] = { 'a', 'd', 'o', 'r', 'a' };
+    static constexpr char32_t s_6_4[3] = { 'o', 's', 'a' };
+    static constexpr char32_t s_6_5[4] = { 'i', 's', 't', 'a' };
+    static constexpr char32_t s_6_6[3] = { 'i', 'v', 'a' };
+    static constexpr char32_t s_6_7[4] = { 'a', 'n', 'z', 'a' };
+    static constexpr char32_t s_6_8[5] = { 'l', 'o', 'g', 0xED, 'a' };
+    static constexpr char32_t s_6_9[4] = { 'i', 'd', 'a', 'd' };
+    static constexpr char32_t s_6_10[4] = { 'a', 'b', 'l', 'e' };
+    static constexpr char32_t s_6_11[4] = { 'i', 'b', 'l', 'e' };
+    static constexpr char32_t s_6_12[4] = { 'a', 'n', 't', 'e' };
+    static constexpr char32_t s_6_13[5] = { 'm', 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_6_14[6] = { 'a', 'm', 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_6_15[5] = { 'a', 'c', 'i', 0xF3, 'n' };
+    static constexpr char32_t s_6_16[5] = { 'u', 'c', 'i', 0xF3, 'n' };
+    static constexpr char32_t s_6_17[3] = { 'i', 'c', 'o' };
+    static constexpr char32_t s_6_18[4] = { 'i', 's', 'm', 'o' };
+    static constexpr char32_t s_6_19[3] = { 'o', 's', 'o' };
+    static constexpr char32_t s_6_20[7] = { 'a', 'm', 'i', 'e', 'n', 't', 'o' };
+    static constexpr char32_t s_6_21[7] = { 'i', 'm', 'i', 'e', 'n', 't', 'o' };
+    static constexpr char32_t s_6_22[3] = { 'i', 'v', 'o' };
+    static constexpr char32_t s_6_23[4] = { 'a', 'd', 'o', 'r' };
+    static constexpr char32_t s_6_24[4] = { 'i', 'c', 'a', 's' };
+    static constexpr char32_t s_6_25[6] = { 'a', 'n', 'c', 'i', 'a', 's' };
+    static constexpr char32_t s_6_26[6] = { 'e', 'n', 'c', 'i', 'a', 's' };
+    static constexpr char32_t s_6_27[6] = { 'a', 'd', 'o', 'r', 'a', 's' };
+    static constexpr char32_t s_6_28[4] = { 'o', 's', 'a', 's' };
+    static constexpr char32_t s_6_29[5] = { 'i', 's', 't', 'a', 's' };
+    static constexpr char32_t s_6_30[4] = { 'i', 'v', 'a', 's' };
+    static constexpr char32_t s_6_31[5] = { 'a', 'n', 'z', 'a', 's' };
+    static constexpr char32_t s_6_32[6] = { 'l', 'o', 'g', 0xED, 'a', 's' };
+    static constexpr char32_t s_6_33[6] = { 'i', 'd', 'a', 'd', 'e', 's' };
+    static constexpr char32_t s_6_34[5] = { 'a', 'b', 'l', 'e', 's' };
+    static constexpr char32_t s_6_35[5] = { 'i', 'b', 'l', 'e', 's' };
+    static constexpr char32_t s_6_36[7] = { 'a', 'c', 'i', 'o', 'n', 'e', 's' };
+    static constexpr char32_t s_6_37[7] = { 'u', 'c', 'i', 'o', 'n', 'e', 's' };
+    static constexpr char32_t s_6_38[6] = { 'a', 'd', 'o', 'r', 'e', 's' };
+    static constexpr char32_t s_6_39[5] = { 'a', 'n', 't', 'e', 's' };
+    static constexpr char32_t s_6_40[4] = { 'i', 'c', 'o', 's' };
+    static constexpr char32_t s_6_41[5] = { 'i', 's', 'm', 'o', 's' };
+    static constexpr char32_t s_6_42[4] = { 'o', 's', 'o', 's' };
+    static constexpr char32_t s_6_43[8] = { 'a', 'm', 'i', 'e', 'n', 't', 'o', 's' };
+    static constexpr char32_t s_6_44[8] = { 'i', 'm', 'i', 'e', 'n', 't', 'o', 's' };
+    static constexpr char32_t s_6_45[4] = { 'i', 'v', 'o', 's' };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 3, s_6_0, -1, 1, 0 },
+    /*  1 */ { 5, s_6_1, -1, 2, 0 },
+    /*  2 */ { 5, s_6_2, -1, 5, 0 },
+    /*  3 */ { 5, s_6_3, -1, 2, 0 },
+    /*  4 */ { 3, s_6_4, -1, 1, 0 },
+    /*  5 */ { 4, s_6_5, -1, 1, 0 },
+    /*  6 */ { 3, s_6_6, -1, 9, 0 },
+    /*  7 */ { 4, s_6_7, -1, 1, 0 },
+    /*  8 */ { 5, s_6_8, -1, 3, 0 },
+    /*  9 */ { 4, s_6_9, -1, 8, 0 },
+    /* 10 */ { 4, s_6_10, -1, 1, 0 },
+    /* 11 */ { 4, s_6_11, -1, 1, 0 },
+    /* 12 */ { 4, s_6_12, -1, 2, 0 },
+    /* 13 */ { 5, s_6_13, -1, 7, 0 },
+    /* 14 */ { 6, s_6_14, 13, 6, 0 },
+    /* 15 */ { 5, s_6_15, -1, 2, 0 },
+    /* 16 */ { 5, s_6_16, -1, 4, 0 },
+    /* 17 */ { 3, s_6_17, -1, 1, 0 },
+    /* 18 */ { 4, s_6_18, -1, 1, 0 },
+    /* 19 */ { 3, s_6_19, -1, 1, 0 },
+    /* 20 */ { 7, s_6_20, -1, 1, 0 },
+    /* 21 */ { 7, s_6_21, -1, 1, 0 },
+    /* 22 */ { 3, s_6_22, -1, 9, 0 },
+    /* 23 */ { 4, s_6_23, -1, 2, 0 },
+    /* 24 */ { 4, s_6_24, -1, 1, 0 },
+    /* 25 */ { 6, s_6_25, -1, 2, 0 },
+    /* 26 */ { 6, s_6_26, -1, 5, 0 },
+    /* 27 */ { 6, s_6_27, -1, 2, 0 },
+    /* 28 */ { 4, s_6_28, -1, 1, 0 },
+    /* 29 */ { 5, s_6_29, -1, 1, 0 },
+    /* 30 */ { 4, s_6_30, -1, 9, 0 },
+    /* 31 */ { 5, s_6_31, -1, 1, 0 },
+    /* 32 */ { 6, s_6_32, -1, 3, 0 },
+    /* 33 */ { 6, s_6_33, -1, 8, 0 },
+    /* 34 */ { 5, s_6_34, -1, 1, 0 },
+    /* 35 */ { 5, s_6_35, -1, 1, 0 },
+    /* 36 */ { 7, s_6_36, -1, 2, 0 },
+    /* 37 */ { 7, s_6_37, -1, 4, 0 },
+    /* 38 */ { 6, s_6_38, -1, 2, 0 },
+    /* 39 */ { 5, s_6_39, -1, 2, 0 },
+    /* 40 */ { 4, s_6_40, -1, 1, 0 },
+    /* 41 */ { 5, s_6_41, -1, 1, 0 },
+    /* 42 */ { 4, s_6_42, -1, 1, 0 },
+    /* 43 */ { 8, s_6_43, -1, 1, 0 },
+    /* 44 */ { 8, s_6_44, -1, 1, 0 },
+    /* 45 */ { 4, s_6_45, -1, 9, 0 }
+    };
+
+    static constexpr char32_t s_7_0[2] = { 'y', 'a' };
+    static constexpr char32_t s_7_1[2] = { 'y', 'e' };
+    static constexpr char32_t s_7_2[3] = { 'y', 'a', 'n' };
+    static constexpr char32_t s_7_3[3] = { 'y', 'e', 'n' };
+    static constexpr char32_t s_7_4[5] = { 'y', 'e', 'r', 'o', 'n' };
+    static constexpr char32_t s_7_5[5] = { 'y', 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_7_6[2] = { 'y', 'o' };
+    static constexpr char32_t s_7_7[3] = { 'y', 'a', 's' };
+    static constexpr char32_t s_7_8[3] = { 'y', 'e', 's' };
+    static constexpr char32_t s_7_9[4] = { 'y', 'a', 'i', 's' };
+    static constexpr char32_t s_7_10[5] = { 'y', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_7_11[2] = { 'y', 0xF3 };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 2, s_7_0, -1, 1, 0 },
+    /*  1 */ { 2, s_7_1, -1, 1, 0 },
+    /*  2 */ { 3, s_7_2, -1, 1, 0 },
+    /*  3 */ { 3, s_7_3, -1, 1, 0 },
+    /*  4 */ { 5, s_7_4, -1, 1, 0 },
+    /*  5 */ { 5, s_7_5, -1, 1, 0 },
+    /*  6 */ { 2, s_7_6, -1, 1, 0 },
+    /*  7 */ { 3, s_7_7, -1, 1, 0 },
+    /*  8 */ { 3, s_7_8, -1, 1, 0 },
+    /*  9 */ { 4, s_7_9, -1, 1, 0 },
+    /* 10 */ { 5, s_7_10, -1, 1, 0 },
+    /* 11 */ { 2, s_7_11, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_8_0[3] = { 'a', 'b', 'a' };
+    static constexpr char32_t s_8_1[3] = { 'a', 'd', 'a' };
+    static constexpr char32_t s_8_2[3] = { 'i', 'd', 'a' };
+    static constexpr char32_t s_8_3[3] = { 'a', 'r', 'a' };
+    static constexpr char32_t s_8_4[4] = { 'i', 'e', 'r', 'a' };
+    static constexpr char32_t s_8_5[2] = { 0xED, 'a' };
+    static constexpr char32_t s_8_6[4] = { 'a', 'r', 0xED, 'a' };
+    static constexpr char32_t s_8_7[4] = { 'e', 'r', 0xED, 'a' };
+    static constexpr char32_t s_8_8[4] = { 'i', 'r', 0xED, 'a' };
+    static constexpr char32_t s_8_9[2] = { 'a', 'd' };
+    static constexpr char32_t s_8_10[2] = { 'e', 'd' };
+    static constexpr char32_t s_8_11[2] = { 'i', 'd' };
+    static constexpr char32_t s_8_12[3] = { 'a', 's', 'e' };
+    static constexpr char32_t s_8_13[4] = { 'i', 'e', 's', 'e' };
+    static constexpr char32_t s_8_14[4] = { 'a', 's', 't', 'e' };
+    static constexpr char32_t s_8_15[4] = { 'i', 's', 't', 'e' };
+    static constexpr char32_t s_8_16[2] = { 'a', 'n' };
+    static constexpr char32_t s_8_17[4] = { 'a', 'b', 'a', 'n' };
+    static constexpr char32_t s_8_18[4] = { 'a', 'r', 'a', 'n' };
+    static constexpr char32_t s_8_19[5] = { 'i', 'e', 'r', 'a', 'n' };
+    static constexpr char32_t s_8_20[3] = { 0xED, 'a', 'n' };
+    static constexpr char32_t s_8_21[5] = { 'a', 'r', 0xED, 'a', 'n' };
+    static constexpr char32_t s_8_22[5] = { 'e', 'r', 0xED, 'a', 'n' };
+    static constexpr char32_t s_8_23[5] = { 'i', 'r', 0xED, 'a', 'n' };
+    static constexpr char32_t s_8_24[2] = { 'e', 'n' };
+    static constexpr char32_t s_8_25[4] = { 'a', 's', 'e', 'n' };
+    static constexpr char32_t s_8_26[5] = { 'i', 'e', 's', 'e', 'n' };
+    static constexpr char32_t s_8_27[4] = { 'a', 'r', 'o', 'n' };
+    static constexpr char32_t s_8_28[5] = { 'i', 'e', 'r', 'o', 'n' };
+    static constexpr char32_t s_8_29[4] = { 'a', 'r', 0xE1, 'n' };
+    static constexpr char32_t s_8_30[4] = { 'e', 'r', 0xE1, 'n' };
+    static constexpr char32_t s_8_31[4] = { 'i', 'r', 0xE1, 'n' };
+    static constexpr char32_t s_8_32[3] = { 'a', 'd', 'o' };
+    static constexpr char32_t s_8_33[3] = { 'i', 'd', 'o' };
+    static constexpr char32_t s_8_34[4] = { 'a', 'n', 'd', 'o' };
+    static constexpr char32_t s_8_35[5] = { 'i', 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_8_36[2] = { 'a', 'r' };
+    static constexpr char32_t s_8_37[2] = { 'e', 'r' };
+    static constexpr char32_t s_8_38[2] = { 'i', 'r' };
+    static constexpr char32_t s_8_39[2] = { 'a', 's' };
+    static constexpr char32_t s_8_40[4] = { 'a', 'b', 'a', 's' };
+    static constexpr char32_t s_8_41[4] = { 'a', 'd', 'a', 's' };
+    static constexpr char32_t s_8_42[4] = { 'i', 'd', 'a', 's' };
+    static constexpr char32_t s_8_43[4] = { 'a', 'r', 'a', 's' };
+    static constexpr char32_t s_8_44[5] = { 'i', 'e', 'r', 'a', 's' };
+    static constexpr char32_t s_8_45[3] = { 0xED, 'a', 's' };
+    static constexpr char32_t s_8_46[5] = { 'a', 'r', 0xED, 'a', 's' };
+    static constexpr char32_t s_8_47[5] = { 'e', 'r', 0xED, 'a', 's' };
+    static constexpr char32_t s_8_48[5] = { 'i', 'r', 0xED, 'a', 's' };
+    static constexpr char32_t s_8_49[2] = { 'e', 's' };
+    static constexpr char32_t s_8_50[4] = { 'a', 's', 'e', 's' };
+    static constexpr char32_t s_8_51[5] = { 'i', 'e', 's', 'e', 's' };
+    static constexpr char32_t s_8_52[5] = { 'a', 'b', 'a', 'i', 's' };
+    static constexpr char32_t s_8_53[5] = { 'a', 'r', 'a', 'i', 's' };
+    static constexpr char32_t s_8_54[6] = { 'i', 'e', 'r', 'a', 'i', 's' };
+    static constexpr char32_t s_8_55[4] = { 0xED, 'a', 'i', 's' };
+    static constexpr char32_t s_8_56[6] = { 'a', 'r', 0xED, 'a', 'i', 's' };
+    static constexpr char32_t s_8_57[6] = { 'e', 'r', 0xED, 'a', 'i', 's' };
+    static constexpr char32_t s_8_58[6] = { 'i', 'r', 0xED, 'a', 'i', 's' };
+    static constexpr char32_t s_8_59[5] = { 'a', 's', 'e', 'i', 's' };
+    static constexpr char32_t s_8_60[6] = { 'i', 'e', 's', 'e', 'i', 's' };
+    static constexpr char32_t s_8_61[6] = { 'a', 's', 't', 'e', 'i', 's' };
+    static constexpr char32_t s_8_62[6] = { 'i', 's', 't', 'e', 'i', 's' };
+    static constexpr char32_t s_8_63[3] = { 0xE1, 'i', 's' };
+    static constexpr char32_t s_8_64[3] = { 0xE9, 'i', 's' };
+    static constexpr char32_t s_8_65[5] = { 'a', 'r', 0xE9, 'i', 's' };
+    static constexpr char32_t s_8_66[5] = { 'e', 'r', 0xE9, 'i', 's' };
+    static constexpr char32_t s_8_67[5] = { 'i', 'r', 0xE9, 'i', 's' };
+    static constexpr char32_t s_8_68[4] = { 'a', 'd', 'o', 's' };
+    static constexpr char32_t s_8_69[4] = { 'i', 'd', 'o', 's' };
+    static constexpr char32_t s_8_70[4] = { 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_71[6] = { 0xE1, 'b', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_72[6] = { 0xE1, 'r', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_73[7] = { 'i', 0xE9, 'r', 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_74[5] = { 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_75[7] = { 'a', 'r', 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_76[7] = { 'e', 'r', 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_77[7] = { 'i', 'r', 0xED, 'a', 'm', 'o', 's' };
+    static constexpr char32_t s_8_78[4] = { 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_8_79[6] = { 'a', 'r', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_8_80[6] = { 'e', 'r', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_8_81[6] = { 'i', 'r', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_8_82[6] = { 0xE1, 's', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_8_83[7] = { 'i', 0xE9, 's', 'e', 'm', 'o', 's' };
+    static constexpr char32_t s_8_84[4] = { 'i', 'm', 'o', 's' };
+    static constexpr char32_t s_8_85[4] = { 'a', 'r', 0xE1, 's' };
+    static constexpr char32_t s_8_86[4] = { 'e', 'r', 0xE1, 's' };
+    static constexpr char32_t s_8_87[4] = { 'i', 'r', 0xE1, 's' };
+    static constexpr char32_t s_8_88[2] = { 0xED, 's' };
+    static constexpr char32_t s_8_89[3] = { 'a', 'r', 0xE1 };
+    static constexpr char32_t s_8_90[3] = { 'e', 'r', 0xE1 };
+    static constexpr char32_t s_8_91[3] = { 'i', 'r', 0xE1 };
+    static constexpr char32_t s_8_92[3] = { 'a', 'r', 0xE9 };
+    static constexpr char32_t s_8_93[3] = { 'e', 'r', 0xE9 };
+    static constexpr char32_t s_8_94[3] = { 'i', 'r', 0xE9 };
+    static constexpr char32_t s_8_95[2] = { 'i', 0xF3 };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 3, s_8_0, -1, 2, 0 },
+    /*  1 */ { 3, s_8_1, -1, 2, 0 },
+    /*  2 */ { 3, s_8_2, -1, 2, 0 },
+    /*  3 */ { 3, s_8_3, -1, 2, 0 },
+    /*  4 */ { 4, s_8_4, -1, 2, 0 },
+    /*  5 */ { 2, s_8_5, -1, 2, 0 },
+    /*  6 */ { 4, s_8_6, 5, 2, 0 },
+    /*  7 */ { 4, s_8_7, 5, 2, 0 },
+    /*  8 */ { 4, s_8_8, 5, 2, 0 },
+    /*  9 */ { 2, s_8_9, -1, 2, 0 },
+    /* 10 */ { 2, s_8_10, -1, 2, 0 },
+    /* 11 */ { 2, s_8_11, -1, 2, 0 },
+    /* 12 */ { 3, s_8_12, -1, 2, 0 },
+    /* 13 */ { 4, s_8_13, -1, 2, 0 },
+    /* 14 */ { 4, s_8_14, -1, 2, 0 },
+    /* 15 */ { 4, s_8_15, -1, 2, 0 },
+    /* 16 */ { 2, s_8_16, -1, 2, 0 },
+    /* 17 */ { 4, s_8_17, 16, 2, 0 },
+    /* 18 */ { 4, s_8_18, 16, 2, 0 },
+    /* 19 */ { 5, s_8_19, 16, 2, 0 },
+    /* 20 */ { 3, s_8_20, 16, 2, 0 },
+    /* 21 */ { 5, s_8_21, 20, 2, 0 },
+    /* 22 */ { 5, s_8_22, 20, 2, 0 },
+    /* 23 */ { 5, s_8_23, 20, 2, 0 },
+    /* 24 */ { 2, s_8_24, -1, 1, 0 },
+    /* 25 */ { 4, s_8_25, 24, 2, 0 },
+    /* 26 */ { 5, s_8_26, 24, 2, 0 },
+    /* 27 */ { 4, s_8_27, -1, 2, 0 },
+    /* 28 */ { 5, s_8_28, -1, 2, 0 },
+    /* 29 */ { 4, s_8_29, -1, 2, 0 },
+    /* 30 */ { 4, s_8_30, -1, 2, 0 },
+    /* 31 */ { 4, s_8_31, -1, 2, 0 },
+    /* 32 */ { 3, s_8_32, -1, 2, 0 },
+    /* 33 */ { 3, s_8_33, -1, 2, 0 },
+    /* 34 */ { 4, s_8_34, -1, 2, 0 },
+    /* 35 */ { 5, s_8_35, -1, 2, 0 },
+    /* 36 */ { 2, s_8_36, -1, 2, 0 },
+    /* 37 */ { 2, s_8_37, -1, 2, 0 },
+    /* 38 */ { 2, s_8_38, -1, 2, 0 },
+    /* 39 */ { 2, s_8_39, -1, 2, 0 },
+    /* 40 */ { 4, s_8_40, 39, 2, 0 },
+    /* 41 */ { 4, s_8_41, 39, 2, 0 },
+    /* 42 */ { 4, s_8_42, 39, 2, 0 },
+    /* 43 */ { 4, s_8_43, 39, 2, 0 },
+    /* 44 */ { 5, s_8_44, 39, 2, 0 },
+    /* 45 */ { 3, s_8_45, 39, 2, 0 },
+    /* 46 */ { 5, s_8_46, 45, 2, 0 },
+    /* 47 */ { 5, s_8_47, 45, 2, 0 },
+    /* 48 */ { 5, s_8_48, 45, 2, 0 },
+    /* 49 */ { 2, s_8_49, -1, 1, 0 },
+    /* 50 */ { 4, s_8_50, 49, 2, 0 },
+    /* 51 */ { 5, s_8_51, 49, 2, 0 },
+    /* 52 */ { 5, s_8_52, -1, 2, 0 },
+    /* 53 */ { 5, s_8_53, -1, 2, 0 },
+    /* 54 */ { 6, s_8_54, -1, 2, 0 },
+    /* 55 */ { 4, s_8_55, -1, 2, 0 },
+    /* 56 */ { 6, s_8_56, 55, 2, 0 },
+    /* 57 */ { 6, s_8_57, 55, 2, 0 },
+    /* 58 */ { 6, s_8_58, 55, 2, 0 },
+    /* 59 */ { 5, s_8_59, -1, 2, 0 },
+    /* 60 */ { 6, s_8_60, -1, 2, 0 },
+    /* 61 */ { 6, s_8_61, -1, 2, 0 },
+    /* 62 */ { 6, s_8_62, -1, 2, 0 },
+    /* 63 */ { 3, s_8_63, -1, 2, 0 },
+    /* 64 */ { 3, s_8_64, -1, 1, 0 },
+    /* 65 */ { 5, s_8_65, 64, 2, 0 },
+    /* 66 */ { 5, s_8_66, 64, 2, 0 },
+    /* 67 */ { 5, s_8_67, 64, 2, 0 },
+    /* 68 */ { 4, s_8_68, -1, 2, 0 },
+    /* 69 */ { 4, s_8_69, -1, 2, 0 },
+    /* 70 */ { 4, s_8_70, -1, 2, 0 },
+    /* 71 */ { 6, s_8_71, 70, 2, 0 },
+    /* 72 */ { 6, s_8_72, 70, 2, 0 },
+    /* 73 */ { 7, s_8_73, 70, 2, 0 },
+    /* 74 */ { 5, s_8_74, 70, 2, 0 },
+    /* 75 */ { 7, s_8_75, 74, 2, 0 },
+    /* 76 */ { 7, s_8_76, 74, 2, 0 },
+    /* 77 */ { 7, s_8_77, 74, 2, 0 },
+    /* 78 */ { 4, s_8_78, -1, 1, 0 },
+    /* 79 */ { 6, s_8_79, 78, 2, 0 },
+    /* 80 */ { 6, s_8_80, 78, 2, 0 },
+    /* 81 */ { 6, s_8_81, 78, 2, 0 },
+    /* 82 */ { 6, s_8_82, 78, 2, 0 },
+    /* 83 */ { 7, s_8_83, 78, 2, 0 },
+    /* 84 */ { 4, s_8_84, -1, 2, 0 },
+    /* 85 */ { 4, s_8_85, -1, 2, 0 },
+    /* 86 */ { 4, s_8_86, -1, 2, 0 },
+    /* 87 */ { 4, s_8_87, -1, 2, 0 },
+    /* 88 */ { 2, s_8_88, -1, 2, 0 },
+    /* 89 */ { 3, s_8_89, -1, 2, 0 },
+    /* 90 */ { 3, s_8_90, -1, 2, 0 },
+    /* 91 */ { 3, s_8_91, -1, 2, 0 },
+    /* 92 */ { 3, s_8_92, -1, 2, 0 },
+    /* 93 */ { 3, s_8_93, -1, 2, 0 },
+    /* 94 */ { 3, s_8_94, -1, 2, 0 },
+    /* 95 */ { 2, s_8_95, -1, 2, 0 }
+    };
+
+    static constexpr char32_t s_9_0[1] = { 'a' };
+    static constexpr char32_t s_9_1[1] = { 'e' };
+    static constexpr char32_t s_9_2[1] = { 'o' };
+    static constexpr char32_t s_9_3[2] = { 'o', 's' };
+    static constexpr char32_t s_9_4[1] = { 0xE1 };
+    static constexpr char32_t s_9_5[1] = { 0xE9 };
+    static constexpr char32_t s_9_6[1] = { 0xED };
+    static constexpr char32_t s_9_7[1] = { 0xF3 };
+
+    static constexpr among<char32_t> a_9[] = {
+    /*  0 */ { 1, s_9_0, -1, 1, 0 },
+    /*  1 */ { 1, s_9_1, -1, 2, 0 },
+    /*  2 */ { 1, s_9_2, -1, 1, 0 },
+    /*  3 */ { 2, s_9_3, -1, 1, 0 },
+    /*  4 */ { 1, s_9_4, -1, 1, 0 },
+    /*  5 */ { 1, s_9_5, -1, 2, 0 },
+    /*  6 */ { 1, s_9_6, -1, 1, 0 },
+    /*  7 */ { 1, s_9_7, -1, 1, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'a' };
+    static constexpr char32_t s_1[] = { 'e' };
+    static constexpr char32_t s_2[] = { 'i' };
+    static constexpr char32_t s_3[] = { 'o' };
+    static constexpr char32_t s_4[] = { 'u' };
+    static constexpr char32_t s_5[] = { 'i', 'e', 'n', 'd', 'o' };
+    static constexpr char32_t s_6[] = { 'a', 'n', 'd', 'o' };
+    static constexpr char32_t s_7[] = { 'a', 'r' };
+    static constexpr char32_t s_8[] = { 'e', 'r' };
+    static constexpr char32_t s_9[] = { 'i', 'r' };
+    static constexpr char32_t s_10[] = { 'u' };
+    static constexpr char32_t s_11[] = { 'i', 'c' };
+    static constexpr char32_t s_12[] = { 'l', 'o', 'g' };
+    static constexpr char32_t s_13[] = { 'u' };
+    static constexpr char32_t s_14[] = { 'e', 'n', 't', 'e' };
+    static constexpr char32_t s_15[] = { 'a', 't' };
+    static constexpr char32_t s_16[] = { 'a', 't' };
+    static constexpr char32_t s_17[] = { 'u' };
+    static constexpr char32_t s_18[] = { 'u' };
+    static constexpr char32_t s_19[] = { 'g' };
+    static constexpr char32_t s_20[] = { 'u' };
+    static constexpr char32_t s_21[] = { 'g' };
+};
+
+template <typename symbol>
+class spanish_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef spanish_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_pV = l; /* $pV = <integer expression>, line 33 */
+        I_p1 = l; /* $p1 = <integer expression>, line 34 */
+        I_p2 = l; /* $p2 = <integer expression>, line 35 */
+        {   int c1 = c; /* do, line 37 */
+            {   int c2 = c; /* or, line 39 */
+                if (in_grouping(data::g_v, 97, 252, 0)) goto lab2; /* grouping v, line 38 */
+                {   int c3 = c; /* or, line 38 */
+                    if (out_grouping(data::g_v, 97, 252, 0)) goto lab4; /* non v, line 38 */
+                    {    /* gopast */ /* grouping v, line 38 */
+                        int ret = out_grouping(data::g_v, 97, 252, 1);
+                        if (ret < 0) goto lab4;
+                        c += ret;
+                    }
+                    goto lab3;
+                lab4:
+                    c = c3;
+                    if (in_grouping(data::g_v, 97, 252, 0)) goto lab2; /* grouping v, line 38 */
+                    {    /* gopast */ /* non v, line 38 */
+                        int ret = in_grouping(data::g_v, 97, 252, 1);
+                        if (ret < 0) goto lab2;
+                        c += ret;
+                    }
+                }
+            lab3:
+                goto lab1;
+            lab2:
+                c = c2;
+                if (out_grouping(data::g_v, 97, 252, 0)) goto lab0; /* non v, line 40 */
+                {   int c4 = c; /* or, line 40 */
+                    if (out_grouping(data::g_v, 97, 252, 0)) goto lab6; /* non v, line 40 */
+                    {    /* gopast */ /* grouping v, line 40 */
+                        int ret = out_grouping(data::g_v, 97, 252, 1);
+                        if (ret < 0) goto lab6;
+                        c += ret;
+                    }
+                    goto lab5;
+                lab6:
+                    c = c4;
+                    if (in_grouping(data::g_v, 97, 252, 0)) goto lab0; /* grouping v, line 40 */
+                    {   int ret = hop(c, 0, l, 1); /* next, line 40 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                }
+            lab5:
+                ;
+            }
+        lab1:
+            I_pV = c; /* setmark pV, line 41 */
+        lab0:
+            c = c1;
+        }
+        {   int c5 = c; /* do, line 43 */
+            {    /* gopast */ /* grouping v, line 44 */
+                int ret = out_grouping(data::g_v, 97, 252, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 44 */
+                int ret = in_grouping(data::g_v, 97, 252, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p1 = c; /* setmark p1, line 44 */
+            {    /* gopast */ /* grouping v, line 45 */
+                int ret = out_grouping(data::g_v, 97, 252, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            {    /* gopast */ /* non v, line 45 */
+                int ret = in_grouping(data::g_v, 97, 252, 1);
+                if (ret < 0) goto lab7;
+                c += ret;
+            }
+            I_p2 = c; /* setmark p2, line 45 */
+        lab7:
+            c = c5;
+        }
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        int among_var;
+        while(1) { /* repeat, line 49 */
+            int c1 = c;
+            bra = c; /* [, line 50 */
+            among_var = find_among(data::a_0); /* substring, line 50 */
+            if (!among_var) goto lab0;
+            ket = c; /* ], line 50 */
+            switch(among_var) {
+                case 0: goto lab0;
+                case 1:
+                    slice_from(data::s_0); /* <-, line 51 */
+                    break;
+                case 2:
+                    slice_from(data::s_1); /* <-, line 52 */
+                    break;
+                case 3:
+                    slice_from(data::s_2); /* <-, line 53 */
+                    break;
+                case 4:
+                    slice_from(data::s_3); /* <-, line 54 */
+                    break;
+                case 5:
+                    slice_from(data::s_4); /* <-, line 55 */
+                    break;
+                case 6:
+                    {   int ret = hop(c, 0, l, 1); /* next, line 57 */
+                        if (ret < 0) goto lab0;
+                        c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab0:
+            c = c1;
+            break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_RV() {
+        if (!(I_pV <= c)) return false; /* $pV <= <integer expression>, line 63 */
+        return true;
+    }
+
+  private:
+    bool r_R1() {
+        if (!(I_p1 <= c)) return false; /* $p1 <= <integer expression>, line 64 */
+        return true;
+    }
+
+  private:
+    bool r_R2() {
+        if (!(I_p2 <= c)) return false; /* $p2 <= <integer expression>, line 65 */
+        return true;
+    }
+
+  private:
+    bool r_attached_pronoun() {
+        int among_var;
+        ket = c; /* [, line 68 */
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((557090 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 68 */
+        if (!find_among_b(data::a_1)) return false; /* substring, line 68 */
+        bra = c; /* ], line 68 */
+        if (c - 1 <= lb || (p[c - 1] != 111 && p[c - 1] != 114)) return false; /* substring, line 72 */
+        among_var = find_among_b(data::a_2); /* substring, line 72 */
+        if (!among_var) return false;
+        if (!r_RV()) return false; /* call RV, line 72 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                bra = c; /* ], line 73 */
+                slice_from(data::s_5); /* <-, line 73 */
+                break;
+            case 2:
+                bra = c; /* ], line 74 */
+                slice_from(data::s_6); /* <-, line 74 */
+                break;
+            case 3:
+                bra = c; /* ], line 75 */
+                slice_from(data::s_7); /* <-, line 75 */
+                break;
+            case 4:
+                bra = c; /* ], line 76 */
+                slice_from(data::s_8); /* <-, line 76 */
+                break;
+            case 5:
+                bra = c; /* ], line 77 */
+                slice_from(data::s_9); /* <-, line 77 */
+                break;
+            case 6:
+                slice_del(); /* delete, line 81 */
+                break;
+            case 7:
+                if (!eq_s_b(data::s_10)) return false; /* literal, line 82 */
+                slice_del(); /* delete, line 82 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_standard_suffix() {
+        int among_var;
+        ket = c; /* [, line 87 */
+        if (c - 2 <= lb || p[c - 1] >> 5 != 3 || !((835634 >> (p[c - 1] & 0x1f)) & 1)) return false; /* substring, line 87 */
+        among_var = find_among_b(data::a_6); /* substring, line 87 */
+        if (!among_var) return false;
+        bra = c; /* ], line 87 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_R2()) return false; /* call R2, line 99 */
+                slice_del(); /* delete, line 99 */
+                break;
+            case 2:
+                if (!r_R2()) return false; /* call R2, line 105 */
+                slice_del(); /* delete, line 105 */
+                {   int m_keep = l - c; /* try, line 106 */
+                    ket = c; /* [, line 106 */
+                    if (!eq_s_b(data::s_11)) { c = l - m_keep; goto lab0; } /* literal, line 106 */
+                    bra = c; /* ], line 106 */
+                    if (!r_R2()) { c = l - m_keep; goto lab0; } /* call R2, line 106 */
+                    slice_del(); /* delete, line 106 */
+                lab0:
+                    ;
+                }
+                break;
+            case 3:
+                if (!r_R2()) return false; /* call R2, line 111 */
+                slice_from(data::s_12); /* <-, line 111 */
+                break;
+            case 4:
+                if (!r_R2()) return false; /* call R2, line 115 */
+                slice_from(data::s_13); /* <-, line 115 */
+                break;
+            case 5:
+                if (!r_R2()) return false; /* call R2, line 119 */
+                slice_from(data::s_14); /* <-, line 119 */
+                break;
+            case 6:
+                if (!r_R1()) return false; /* call R1, line 123 */
+                slice_del(); /* delete, line 123 */
+                {   int m_keep = l - c; /* try, line 124 */
+                    ket = c; /* [, line 125 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4718616 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab1; } /* substring, line 125 */
+                    among_var = find_among_b(data::a_3); /* substring, line 125 */
+                    if (!among_var) { c = l - m_keep; goto lab1; }
+                    bra = c; /* ], line 125 */
+                    if (!r_R2()) { c = l - m_keep; goto lab1; } /* call R2, line 125 */
+                    slice_del(); /* delete, line 125 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab1; }
+                        case 1:
+                            ket = c; /* [, line 126 */
+                            if (!eq_s_b(data::s_15)) { c = l - m_keep; goto lab1; } /* literal, line 126 */
+                            bra = c; /* ], line 126 */
+                            if (!r_R2()) { c = l - m_keep; goto lab1; } /* call R2, line 126 */
+                            slice_del(); /* delete, line 126 */
+                            break;
+                    }
+                lab1:
+                    ;
+                }
+                break;
+            case 7:
+                if (!r_R2()) return false; /* call R2, line 135 */
+                slice_del(); /* delete, line 135 */
+                {   int m_keep = l - c; /* try, line 136 */
+                    ket = c; /* [, line 137 */
+                    if (c - 3 <= lb || p[c - 1] != 101) { c = l - m_keep; goto lab2; } /* substring, line 137 */
+                    among_var = find_among_b(data::a_4); /* substring, line 137 */
+                    if (!among_var) { c = l - m_keep; goto lab2; }
+                    bra = c; /* ], line 137 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab2; }
+                        case 1:
+                            if (!r_R2()) { c = l - m_keep; goto lab2; } /* call R2, line 140 */
+                            slice_del(); /* delete, line 140 */
+                            break;
+                    }
+                lab2:
+                    ;
+                }
+                break;
+            case 8:
+                if (!r_R2()) return false; /* call R2, line 147 */
+                slice_del(); /* delete, line 147 */
+                {   int m_keep = l - c; /* try, line 148 */
+                    ket = c; /* [, line 149 */
+                    if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((4198408 >> (p[c - 1] & 0x1f)) & 1)) { c = l - m_keep; goto lab3; } /* substring, line 149 */
+                    among_var = find_among_b(data::a_5); /* substring, line 149 */
+                    if (!among_var) { c = l - m_keep; goto lab3; }
+                    bra = c; /* ], line 149 */
+                    switch(among_var) {
+                        case 0: { c = l - m_keep; goto lab3; }
+                        case 1:
+                            if (!r_R2()) { c = l - m_keep; goto lab3; } /* call R2, line 152 */
+                            slice_del(); /* delete, line 152 */
+                            break;
+                    }
+                lab3:
+                    ;
+                }
+                break;
+            case 9:
+                if (!r_R2()) return false; /* call R2, line 159 */
+                slice_del(); /* delete, line 159 */
+                {   int m_keep = l - c; /* try, line 160 */
+                    ket = c; /* [, line 161 */
+                    if (!eq_s_b(data::s_16)) { c = l - m_keep; goto lab4; } /* literal, line 161 */
+                    bra = c; /* ], line 161 */
+                    if (!r_R2()) { c = l - m_keep; goto lab4; } /* call R2, line 161 */
+                    slice_del(); /* delete, line 161 */
+                lab4:
+                    ;
+                }
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_y_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 168 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 168 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 168 */
+            among_var = find_among_b(data::a_7); /* substring, line 168 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 168 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!eq_s_b(data::s_17)) return false; /* literal, line 171 */
+                slice_del(); /* delete, line 171 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_verb_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 176 */
+            int m1 = l - c; (void)m1;
+            if (c < I_pV) return false;
+            c = I_pV; /* tomark, line 176 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 176 */
+            among_var = find_among_b(data::a_8); /* substring, line 176 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 176 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                {   int m_keep = l - c; /* try, line 179 */
+                    if (!eq_s_b(data::s_18)) { c = l - m_keep; goto lab0; } /* literal, line 179 */
+                    {   int m_test = l - c; /* test, line 179 */
+                        if (!eq_s_b(data::s_19)) { c = l - m_keep; goto lab0; } /* literal, line 179 */
+                        c = l - m_test;
+                    }
+                lab0:
+                    ;
+                }
+                bra = c; /* ], line 179 */
+                slice_del(); /* delete, line 179 */
+                break;
+            case 2:
+                slice_del(); /* delete, line 200 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_residual_suffix() {
+        int among_var;
+        ket = c; /* [, line 205 */
+        among_var = find_among_b(data::a_9); /* substring, line 205 */
+        if (!among_var) return false;
+        bra = c; /* ], line 205 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                if (!r_RV()) return false; /* call RV, line 208 */
+                slice_del(); /* delete, line 208 */
+                break;
+            case 2:
+                if (!r_RV()) return false; /* call RV, line 210 */
+                slice_del(); /* delete, line 210 */
+                {   int m_keep = l - c; /* try, line 210 */
+                    ket = c; /* [, line 210 */
+                    if (!eq_s_b(data::s_20)) { c = l - m_keep; goto lab0; } /* literal, line 210 */
+                    bra = c; /* ], line 210 */
+                    {   int m_test = l - c; /* test, line 210 */
+                        if (!eq_s_b(data::s_21)) { c = l - m_keep; goto lab0; } /* literal, line 210 */
+                        c = l - m_test;
+                    }
+                    if (!r_RV()) { c = l - m_keep; goto lab0; } /* call RV, line 210 */
+                    slice_del(); /* delete, line 210 */
+                lab0:
+                    ;
+                }
+                break;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 216 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 216 */
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 217 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 218 */
+            if (!r_attached_pronoun()) goto lab1; /* call attached_pronoun, line 218 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 219 */
+            {   int m4 = l - c; (void)m4; /* or, line 219 */
+                if (!r_standard_suffix()) goto lab4; /* call standard_suffix, line 219 */
+                goto lab3;
+            lab4:
+                c = l - m4;
+                if (!r_y_verb_suffix()) goto lab5; /* call y_verb_suffix, line 220 */
+                goto lab3;
+            lab5:
+                c = l - m4;
+                if (!r_verb_suffix()) goto lab2; /* call verb_suffix, line 221 */
+            }
+        lab3:
+        lab2:
+            c = l - m3;
+        }
+        {   int m5 = l - c; (void)m5; /* do, line 223 */
+            if (!r_residual_suffix()) goto lab6; /* call residual_suffix, line 223 */
+        lab6:
+            c = l - m5;
+        }
+        c = lb;
+        {   int c6 = c; /* do, line 225 */
+            if (!r_postlude()) goto lab7; /* call postlude, line 225 */
+        lab7:
+            c = c6;
+        }
+        return true;
+    }
+
+  private:
+    int I_p2 = 0;
+    int I_p1 = 0;
+    int I_pV = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,412 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_SWEDISH_STEMMER_HPP
+#define SNOWBALL_SWEDISH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct swedish_stemmer_groupings {
+    static constexpr unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 32 };
+    static constexpr unsigned char g_s_ending[] = { 119, 127, 149 };
+};
+
+template <bool utf8> struct swedish_stemmer_data;
+
+template <>
+struct swedish_stemmer_data<true> : swedish_stemmer_groupings {
+    static constexpr unsigned char s_0_0[1] = { 'a' };
+    static constexpr unsigned char s_0_1[4] = { 'a', 'r', 'n', 'a' };
+    static constexpr unsigned char s_0_2[4] = { 'e', 'r', 'n', 'a' };
+    static constexpr unsigned char s_0_3[7] = { 'h', 'e', 't', 'e', 'r', 'n', 'a' };
+    static constexpr unsigned char s_0_4[4] = { 'o', 'r', 'n', 'a' };
+    static constexpr unsigned char s_0_5[2] = { 'a', 'd' };
+    static constexpr unsigned char s_0_6[1] = { 'e' };
+    static constexpr unsigned char s_0_7[3] = { 'a', 'd', 'e' };
+    static constexpr unsigned char s_0_8[4] = { 'a', 'n', 'd', 'e' };
+    static constexpr unsigned char s_0_9[4] = { 'a', 'r', 'n', 'e' };
+    static constexpr unsigned char s_0_10[3] = { 'a', 'r', 'e' };
+    static constexpr unsigned char s_0_11[4] = { 'a', 's', 't', 'e' };
+    static constexpr unsigned char s_0_12[2] = { 'e', 'n' };
+    static constexpr unsigned char s_0_13[5] = { 'a', 'n', 'd', 'e', 'n' };
+    static constexpr unsigned char s_0_14[4] = { 'a', 'r', 'e', 'n' };
+    static constexpr unsigned char s_0_15[5] = { 'h', 'e', 't', 'e', 'n' };
+    static constexpr unsigned char s_0_16[3] = { 'e', 'r', 'n' };
+    static constexpr unsigned char s_0_17[2] = { 'a', 'r' };
+    static constexpr unsigned char s_0_18[2] = { 'e', 'r' };
+    static constexpr unsigned char s_0_19[5] = { 'h', 'e', 't', 'e', 'r' };
+    static constexpr unsigned char s_0_20[2] = { 'o', 'r' };
+    static constexpr unsigned char s_0_21[1] = { 's' };
+    static constexpr unsigned char s_0_22[2] = { 'a', 's' };
+    static constexpr unsigned char s_0_23[5] = { 'a', 'r', 'n', 'a', 's' };
+    static constexpr unsigned char s_0_24[5] = { 'e', 'r', 'n', 'a', 's' };
+    static constexpr unsigned char s_0_25[5] = { 'o', 'r', 'n', 'a', 's' };
+    static constexpr unsigned char s_0_26[2] = { 'e', 's' };
+    static constexpr unsigned char s_0_27[4] = { 'a', 'd', 'e', 's' };
+    static constexpr unsigned char s_0_28[5] = { 'a', 'n', 'd', 'e', 's' };
+    static constexpr unsigned char s_0_29[3] = { 'e', 'n', 's' };
+    static constexpr unsigned char s_0_30[5] = { 'a', 'r', 'e', 'n', 's' };
+    static constexpr unsigned char s_0_31[6] = { 'h', 'e', 't', 'e', 'n', 's' };
+    static constexpr unsigned char s_0_32[4] = { 'e', 'r', 'n', 's' };
+    static constexpr unsigned char s_0_33[2] = { 'a', 't' };
+    static constexpr unsigned char s_0_34[5] = { 'a', 'n', 'd', 'e', 't' };
+    static constexpr unsigned char s_0_35[3] = { 'h', 'e', 't' };
+    static constexpr unsigned char s_0_36[3] = { 'a', 's', 't' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 1, 0 },
+    /*  1 */ { 4, s_0_1, 0, 1, 0 },
+    /*  2 */ { 4, s_0_2, 0, 1, 0 },
+    /*  3 */ { 7, s_0_3, 2, 1, 0 },
+    /*  4 */ { 4, s_0_4, 0, 1, 0 },
+    /*  5 */ { 2, s_0_5, -1, 1, 0 },
+    /*  6 */ { 1, s_0_6, -1, 1, 0 },
+    /*  7 */ { 3, s_0_7, 6, 1, 0 },
+    /*  8 */ { 4, s_0_8, 6, 1, 0 },
+    /*  9 */ { 4, s_0_9, 6, 1, 0 },
+    /* 10 */ { 3, s_0_10, 6, 1, 0 },
+    /* 11 */ { 4, s_0_11, 6, 1, 0 },
+    /* 12 */ { 2, s_0_12, -1, 1, 0 },
+    /* 13 */ { 5, s_0_13, 12, 1, 0 },
+    /* 14 */ { 4, s_0_14, 12, 1, 0 },
+    /* 15 */ { 5, s_0_15, 12, 1, 0 },
+    /* 16 */ { 3, s_0_16, -1, 1, 0 },
+    /* 17 */ { 2, s_0_17, -1, 1, 0 },
+    /* 18 */ { 2, s_0_18, -1, 1, 0 },
+    /* 19 */ { 5, s_0_19, 18, 1, 0 },
+    /* 20 */ { 2, s_0_20, -1, 1, 0 },
+    /* 21 */ { 1, s_0_21, -1, 2, 0 },
+    /* 22 */ { 2, s_0_22, 21, 1, 0 },
+    /* 23 */ { 5, s_0_23, 22, 1, 0 },
+    /* 24 */ { 5, s_0_24, 22, 1, 0 },
+    /* 25 */ { 5, s_0_25, 22, 1, 0 },
+    /* 26 */ { 2, s_0_26, 21, 1, 0 },
+    /* 27 */ { 4, s_0_27, 26, 1, 0 },
+    /* 28 */ { 5, s_0_28, 26, 1, 0 },
+    /* 29 */ { 3, s_0_29, 21, 1, 0 },
+    /* 30 */ { 5, s_0_30, 29, 1, 0 },
+    /* 31 */ { 6, s_0_31, 29, 1, 0 },
+    /* 32 */ { 4, s_0_32, 21, 1, 0 },
+    /* 33 */ { 2, s_0_33, -1, 1, 0 },
+    /* 34 */ { 5, s_0_34, -1, 1, 0 },
+    /* 35 */ { 3, s_0_35, -1, 1, 0 },
+    /* 36 */ { 3, s_0_36, -1, 1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[2] = { 'd', 'd' };
+    static constexpr unsigned char s_1_1[2] = { 'g', 'd' };
+    static constexpr unsigned char s_1_2[2] = { 'n', 'n' };
+    static constexpr unsigned char s_1_3[2] = { 'd', 't' };
+    static constexpr unsigned char s_1_4[2] = { 'g', 't' };
+    static constexpr unsigned char s_1_5[2] = { 'k', 't' };
+    static constexpr unsigned char s_1_6[2] = { 't', 't' };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 },
+    /*  2 */ { 2, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 },
+    /*  4 */ { 2, s_1_4, -1, -1, 0 },
+    /*  5 */ { 2, s_1_5, -1, -1, 0 },
+    /*  6 */ { 2, s_1_6, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'i', 'g' };
+    static constexpr unsigned char s_2_1[3] = { 'l', 'i', 'g' };
+    static constexpr unsigned char s_2_2[3] = { 'e', 'l', 's' };
+    static constexpr unsigned char s_2_3[5] = { 'f', 'u', 'l', 'l', 't' };
+    static constexpr unsigned char s_2_4[5] = { 'l', 0xC3, 0xB6, 's', 't' };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 3, s_2_1, 0, 1, 0 },
+    /*  2 */ { 3, s_2_2, -1, 1, 0 },
+    /*  3 */ { 5, s_2_3, -1, 3, 0 },
+    /*  4 */ { 5, s_2_4, -1, 2, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'l', 0xC3, 0xB6, 's' };
+    static constexpr unsigned char s_1[] = { 'f', 'u', 'l', 'l' };
+};
+
+template <>
+struct swedish_stemmer_data<false> : swedish_stemmer_groupings {
+    static constexpr char32_t s_0_0[1] = { 'a' };
+    static constexpr char32_t s_0_1[4] = { 'a', 'r', 'n', 'a' };
+    static constexpr char32_t s_0_2[4] = { 'e', 'r', 'n', 'a' };
+    static constexpr char32_t s_0_3[7] = { 'h', 'e', 't', 'e', 'r', 'n', 'a' };
+    static constexpr char32_t s_0_4[4] = { 'o', 'r', 'n', 'a' };
+    static constexpr char32_t s_0_5[2] = { 'a', 'd' };
+    static constexpr char32_t s_0_6[1] = { 'e' };
+    static constexpr char32_t s_0_7[3] = { 'a', 'd', 'e' };
+    static constexpr char32_t s_0_8[4] = { 'a', 'n', 'd', 'e' };
+    static constexpr char32_t s_0_9[4] = { 'a', 'r', 'n', 'e' };
+    static constexpr char32_t s_0_10[3] = { 'a', 'r', 'e' };
+    static constexpr char32_t s_0_11[4] = { 'a', 's', 't', 'e' };
+    static constexpr char32_t s_0_12[2] = { 'e', 'n' };
+    static constexpr char32_t s_0_13[5] = { 'a', 'n', 'd', 'e', 'n' };
+    static constexpr char32_t s_0_14[4] = { 'a', 'r', 'e', 'n' };
+    static constexpr char32_t s_0_15[5] = { 'h', 'e', 't', 'e', 'n' };
+    static constexpr char32_t s_0_16[3] = { 'e', 'r', 'n' };
+    static constexpr char32_t s_0_17[2] = { 'a', 'r' };
+    static constexpr char32_t s_0_18[2] = { 'e', 'r' };
+    static constexpr char32_t s_0_19[5] = { 'h', 'e', 't', 'e', 'r' };
+    static constexpr char32_t s_0_20[2] = { 'o', 'r' };
+    static constexpr char32_t s_0_21[1] = { 's' };
+    static constexpr char32_t s_0_22[2] = { 'a', 's' };
+    static constexpr char32_t s_0_23[5] = { 'a', 'r', 'n', 'a', 's' };
+    static constexpr char32_t s_0_24[5] = { 'e', 'r', 'n', 'a', 's' };
+    static constexpr char32_t s_0_25[5] = { 'o', 'r', 'n', 'a', 's' };
+    static constexpr char32_t s_0_26[2] = { 'e', 's' };
+    static constexpr char32_t s_0_27[4] = { 'a', 'd', 'e', 's' };
+    static constexpr char32_t s_0_28[5] = { 'a', 'n', 'd', 'e', 's' };
+    static constexpr char32_t s_0_29[3] = { 'e', 'n', 's' };
+    static constexpr char32_t s_0_30[5] = { 'a', 'r', 'e', 'n', 's' };
+    static constexpr char32_t s_0_31[6] = { 'h', 'e', 't', 'e', 'n', 's' };
+    static constexpr char32_t s_0_32[4] = { 'e', 'r', 'n', 's' };
+    static constexpr char32_t s_0_33[2] = { 'a', 't' };
+    static constexpr char32_t s_0_34[5] = { 'a', 'n', 'd', 'e', 't' };
+    static constexpr char32_t s_0_35[3] = { 'h', 'e', 't' };
+    static constexpr char32_t s_0_36[3] = { 'a', 's', 't' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, 1, 0 },
+    /*  1 */ { 4, s_0_1, 0, 1, 0 },
+    /*  2 */ { 4, s_0_2, 0, 1, 0 },
+    /*  3 */ { 7, s_0_3, 2, 1, 0 },
+    /*  4 */ { 4, s_0_4, 0, 1, 0 },
+    /*  5 */ { 2, s_0_5, -1, 1, 0 },
+    /*  6 */ { 1, s_0_6, -1, 1, 0 },
+    /*  7 */ { 3, s_0_7, 6, 1, 0 },
+    /*  8 */ { 4, s_0_8, 6, 1, 0 },
+    /*  9 */ { 4, s_0_9, 6, 1, 0 },
+    /* 10 */ { 3, s_0_10, 6, 1, 0 },
+    /* 11 */ { 4, s_0_11, 6, 1, 0 },
+    /* 12 */ { 2, s_0_12, -1, 1, 0 },
+    /* 13 */ { 5, s_0_13, 12, 1, 0 },
+    /* 14 */ { 4, s_0_14, 12, 1, 0 },
+    /* 15 */ { 5, s_0_15, 12, 1, 0 },
+    /* 16 */ { 3, s_0_16, -1, 1, 0 },
+    /* 17 */ { 2, s_0_17, -1, 1, 0 },
+    /* 18 */ { 2, s_0_18, -1, 1, 0 },
+    /* 19 */ { 5, s_0_19, 18, 1, 0 },
+    /* 20 */ { 2, s_0_20, -1, 1, 0 },
+    /* 21 */ { 1, s_0_21, -1, 2, 0 },
+    /* 22 */ { 2, s_0_22, 21, 1, 0 },
+    /* 23 */ { 5, s_0_23, 22, 1, 0 },
+    /* 24 */ { 5, s_0_24, 22, 1, 0 },
+    /* 25 */ { 5, s_0_25, 22, 1, 0 },
+    /* 26 */ { 2, s_0_26, 21, 1, 0 },
+    /* 27 */ { 4, s_0_27, 26, 1, 0 },
+    /* 28 */ { 5, s_0_28, 26, 1, 0 },
+    /* 29 */ { 3, s_0_29, 21, 1, 0 },
+    /* 30 */ { 5, s_0_30, 29, 1, 0 },
+    /* 31 */ { 6, s_0_31, 29, 1, 0 },
+    /* 32 */ { 4, s_0_32, 21, 1, 0 },
+    /* 33 */ { 2, s_0_33, -1, 1, 0 },
+    /* 34 */ { 5, s_0_34, -1, 1, 0 },
+    /* 35 */ { 3, s_0_35, -1, 1, 0 },
+    /* 36 */ { 3, s_0_36, -1, 1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[2] = { 'd', 'd' };
+    static constexpr char32_t s_1_1[2] = { 'g', 'd' };
+    static constexpr char32_t s_1_2[2] = { 'n', 'n' };
+    static constexpr char32_t s_1_3[2] = { 'd', 't' };
+    static constexpr char32_t s_1_4[2] = { 'g', 't' };
+    static constexpr char32_t s_1_5[2] = { 'k', 't' };
+    static constexpr char32_t s_1_6[2] = { 't', 't' };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 2, s_1_0, -1, -1, 0 },
+    /*  1 */ { 2, s_1_1, -1, -1, 0 },
+    /*  2 */ { 2, s_1_2, -1, -1, 0 },
+    /*  3 */ { 2, s_1_3, -1, -1, 0 },
+    /*  4 */ { 2, s_1_4, -1, -1, 0 },
+    /*  5 */ { 2, s_1_5, -1, -1, 0 },
+    /*  6 */ { 2, s_1_6, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'i', 'g' };
+    static constexpr char32_t s_2_1[3] = { 'l', 'i', 'g' };
+    static constexpr char32_t s_2_2[3] = { 'e', 'l', 's' };
+    static constexpr char32_t s_2_3[5] = { 'f', 'u', 'l', 'l', 't' };
+    static constexpr char32_t s_2_4[4] = { 'l', 0xF6, 's', 't' };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, 1, 0 },
+    /*  1 */ { 3, s_2_1, 0, 1, 0 },
+    /*  2 */ { 3, s_2_2, -1, 1, 0 },
+    /*  3 */ { 5, s_2_3, -1, 3, 0 },
+    /*  4 */ { 4, s_2_4, -1, 2, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'l', 0xF6, 's' };
+    static constexpr char32_t s_1[] = { 'f', 'u', 'l', 'l' };
+};
+
+template <typename symbol>
+class swedish_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef swedish_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_mark_regions() {
+        I_p1 = l; /* $p1 = <integer expression>, line 28 */
+        {   int c_test = c; /* test, line 29 */
+            {   int ret = hop(c, 0, l, 3); /* hop, line 29 */
+                if (ret < 0) return false;
+                c = ret;
+            }
+            I_x = c; /* setmark x, line 29 */
+            c = c_test;
+        }
+        if (out_grouping(data::g_v, 97, 246, 1) < 0) return false; /* goto */ /* grouping v, line 30 */
+        {    /* gopast */ /* non v, line 30 */
+            int ret = in_grouping(data::g_v, 97, 246, 1);
+            if (ret < 0) return false;
+            c += ret;
+        }
+        I_p1 = c; /* setmark p1, line 30 */
+         /* try, line 31 */
+        if (!(I_p1 < I_x)) goto lab0; /* $p1 < <integer expression>, line 31 */
+        I_p1 = I_x; /* $p1 = <integer expression>, line 31 */
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_main_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 37 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 37 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 37 */
+            if (c <= lb || p[c - 1] >> 5 != 3 || !((1851442 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 37 */
+            among_var = find_among_b(data::a_0); /* substring, line 37 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 37 */
+            lb = mlimit;
+        }
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_del(); /* delete, line 44 */
+                break;
+            case 2:
+                if (in_grouping_b(data::g_s_ending, 98, 121, 0)) return false; /* grouping s_ending, line 46 */
+                slice_del(); /* delete, line 46 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_consonant_pair() {
+        {   int mlimit; /* setlimit, line 50 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 50 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* and, line 52 */
+                if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1064976 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* among, line 51 */
+                if (!find_among_b(data::a_1)) { lb = mlimit; return false; } /* among, line 51 */
+                c = l - m2;
+                ket = c; /* [, line 52 */
+                {   int ret = hop(c, lb, l, -1); /* next, line 52 */
+                    if (ret < 0) { lb = mlimit; return false; }
+                    c = ret;
+                }
+                bra = c; /* ], line 52 */
+                slice_del(); /* delete, line 52 */
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  private:
+    bool r_other_suffix() {
+        int among_var;
+        {   int mlimit; /* setlimit, line 55 */
+            int m1 = l - c; (void)m1;
+            if (c < I_p1) return false;
+            c = I_p1; /* tomark, line 55 */
+            mlimit = lb; lb = c;
+            c = l - m1;
+            ket = c; /* [, line 56 */
+            if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((1572992 >> (p[c - 1] & 0x1f)) & 1)) { lb = mlimit; return false; } /* substring, line 56 */
+            among_var = find_among_b(data::a_2); /* substring, line 56 */
+            if (!among_var) { lb = mlimit; return false; }
+            bra = c; /* ], line 56 */
+            switch(among_var) {
+                case 0: { lb = mlimit; return false; }
+                case 1:
+                    slice_del(); /* delete, line 57 */
+                    break;
+                case 2:
+                    slice_from(data::s_0); /* <-, line 58 */
+                    break;
+                case 3:
+                    slice_from(data::s_1); /* <-, line 59 */
+                    break;
+            }
+            lb = mlimit;
+        }
+        return true;
+    }
+
+  public:
+    bool stem() {
+        {   int c1 = c; /* do, line 66 */
+            if (!r_mark_regions()) goto lab0; /* call mark_regions, line 66 */
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 67 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 68 */
+            if (!r_main_suffix()) goto lab1; /* call main_suffix, line 68 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 69 */
+            if (!r_consonant_pair()) goto lab2; /* call consonant_pair, line 69 */
+        lab2:
+            c = l - m3;
+        }
+        {   int m4 = l - c; (void)m4; /* do, line 70 */
+            if (!r_other_suffix()) goto lab3; /* call other_suffix, line 70 */
+        lab3:
+            c = l - m4;
+        }
+        c = lb;
+        return true;
+    }
+
+  private:
+    int I_x = 0;
+    int I_p1 = 0;
+};
+
+}
+
+#endif
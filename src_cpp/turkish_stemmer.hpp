@@ -0,0 +1,2042 @@
+
+/* This file was generated automatically by the Snowball to C++ compiler */
+
+#ifndef SNOWBALL_TURKISH_STEMMER_HPP
+#define SNOWBALL_TURKISH_STEMMER_HPP
+
+#include <climits> /* for INT_MAX, INT_MIN */
+#include "../runtime/snowball.hpp"
+
+namespace snowball {
+
+struct turkish_stemmer_groupings {
+    static constexpr unsigned char g_vowel[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 8, 0, 0, 0, 0, 0, 0, 1 };
+    static constexpr unsigned char g_U[] = { 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 1 };
+    static constexpr unsigned char g_vowel1[] = { 1, 64, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+    static constexpr unsigned char g_vowel2[] = { 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130 };
+    static constexpr unsigned char g_vowel3[] = { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+    static constexpr unsigned char g_vowel4[] = { 17 };
+    static constexpr unsigned char g_vowel5[] = { 65 };
+    static constexpr unsigned char g_vowel6[] = { 65 };
+};
+
+template <bool utf8> struct turkish_stemmer_data;
+
+template <>
+struct turkish_stemmer_data<true> : turkish_stemmer_groupings {
+    static constexpr unsigned char s_0_0[1] = { 'm' };
+    static constexpr unsigned char s_0_1[1] = { 'n' };
+    static constexpr unsigned char s_0_2[3] = { 'm', 'i', 'z' };
+    static constexpr unsigned char s_0_3[3] = { 'n', 'i', 'z' };
+    static constexpr unsigned char s_0_4[3] = { 'm', 'u', 'z' };
+    static constexpr unsigned char s_0_5[3] = { 'n', 'u', 'z' };
+    static constexpr unsigned char s_0_6[4] = { 'm', 0xC3, 0xBC, 'z' };
+    static constexpr unsigned char s_0_7[4] = { 'n', 0xC3, 0xBC, 'z' };
+    static constexpr unsigned char s_0_8[4] = { 'm', 0xC4, 0xB1, 'z' };
+    static constexpr unsigned char s_0_9[4] = { 'n', 0xC4, 0xB1, 'z' };
+
+    static constexpr among<unsigned char> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, -1, 0 },
+    /*  1 */ { 1, s_0_1, -1, -1, 0 },
+    /*  2 */ { 3, s_0_2, -1, -1, 0 },
+    /*  3 */ { 3, s_0_3, -1, -1, 0 },
+    /*  4 */ { 3, s_0_4, -1, -1, 0 },
+    /*  5 */ { 3, s_0_5, -1, -1, 0 },
+    /*  6 */ { 4, s_0_6, -1, -1, 0 },
+    /*  7 */ { 4, s_0_7, -1, -1, 0 },
+    /*  8 */ { 4, s_0_8, -1, -1, 0 },
+    /*  9 */ { 4, s_0_9, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_1_0[4] = { 'l', 'e', 'r', 'i' };
+    static constexpr unsigned char s_1_1[5] = { 'l', 'a', 'r', 0xC4, 0xB1 };
+
+    static constexpr among<unsigned char> a_1[] = {
+    /*  0 */ { 4, s_1_0, -1, -1, 0 },
+    /*  1 */ { 5, s_1_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_2_0[2] = { 'n', 'i' };
+    static constexpr unsigned char s_2_1[2] = { 'n', 'u' };
+    static constexpr unsigned char s_2_2[3] = { 'n', 0xC3, 0xBC };
+    static constexpr unsigned char s_2_3[3] = { 'n', 0xC4, 0xB1 };
+
+    static constexpr among<unsigned char> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 3, s_2_2, -1, -1, 0 },
+    /*  3 */ { 3, s_2_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_3_0[2] = { 'i', 'n' };
+    static constexpr unsigned char s_3_1[2] = { 'u', 'n' };
+    static constexpr unsigned char s_3_2[3] = { 0xC3, 0xBC, 'n' };
+    static constexpr unsigned char s_3_3[3] = { 0xC4, 0xB1, 'n' };
+
+    static constexpr among<unsigned char> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, -1, 0 },
+    /*  1 */ { 2, s_3_1, -1, -1, 0 },
+    /*  2 */ { 3, s_3_2, -1, -1, 0 },
+    /*  3 */ { 3, s_3_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_4_0[1] = { 'a' };
+    static constexpr unsigned char s_4_1[1] = { 'e' };
+
+    static constexpr among<unsigned char> a_4[] = {
+    /*  0 */ { 1, s_4_0, -1, -1, 0 },
+    /*  1 */ { 1, s_4_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_5_0[2] = { 'n', 'a' };
+    static constexpr unsigned char s_5_1[2] = { 'n', 'e' };
+
+    static constexpr among<unsigned char> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, -1, 0 },
+    /*  1 */ { 2, s_5_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_6_0[2] = { 'd', 'a' };
+    static constexpr unsigned char s_6_1[2] = { 't', 'a' };
+    static constexpr unsigned char s_6_2[2] = { 'd', 'e' };
+    static constexpr unsigned char s_6_3[2] = { 't', 'e' };
+
+    static constexpr among<unsigned char> a_6[] = {
+    /*  0 */ { 2, s_6_0, -1, -1, 0 },
+    /*  1 */ { 2, s_6_1, -1, -1, 0 },
+    /*  2 */ { 2, s_6_2, -1, -1, 0 },
+    /*  3 */ { 2, s_6_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_7_0[3] = { 'n', 'd', 'a' };
+    static constexpr unsigned char s_7_1[3] = { 'n', 'd', 'e' };
+
+    static constexpr among<unsigned char> a_7[] = {
+    /*  0 */ { 3, s_7_0, -1, -1, 0 },
+    /*  1 */ { 3, s_7_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_8_0[3] = { 'd', 'a', 'n' };
+    static constexpr unsigned char s_8_1[3] = { 't', 'a', 'n' };
+    static constexpr unsigned char s_8_2[3] = { 'd', 'e', 'n' };
+    static constexpr unsigned char s_8_3[3] = { 't', 'e', 'n' };
+
+    static constexpr among<unsigned char> a_8[] = {
+    /*  0 */ { 3, s_8_0, -1, -1, 0 },
+    /*  1 */ { 3, s_8_1, -1, -1, 0 },
+    /*  2 */ { 3, s_8_2, -1, -1, 0 },
+    /*  3 */ { 3, s_8_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_9_0[4] = { 'n', 'd', 'a', 'n' };
+    static constexpr unsigned char s_9_1[4] = { 'n', 'd', 'e', 'n' };
+
+    static constexpr among<unsigned char> a_9[] = {
+    /*  0 */ { 4, s_9_0, -1, -1, 0 },
+    /*  1 */ { 4, s_9_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_10_0[2] = { 'l', 'a' };
+    static constexpr unsigned char s_10_1[2] = { 'l', 'e' };
+
+    static constexpr among<unsigned char> a_10[] = {
+    /*  0 */ { 2, s_10_0, -1, -1, 0 },
+    /*  1 */ { 2, s_10_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_11_0[2] = { 'c', 'a' };
+    static constexpr unsigned char s_11_1[2] = { 'c', 'e' };
+
+    static constexpr among<unsigned char> a_11[] = {
+    /*  0 */ { 2, s_11_0, -1, -1, 0 },
+    /*  1 */ { 2, s_11_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_12_0[2] = { 'i', 'm' };
+    static constexpr unsigned char s_12_1[2] = { 'u', 'm' };
+    static constexpr unsigned char s_12_2[3] = { 0xC3, 0xBC, 'm' };
+    static constexpr unsigned char s_12_3[3] = { 0xC4, 0xB1, 'm' };
+
+    static constexpr among<unsigned char> a_12[] = {
+    /*  0 */ { 2, s_12_0, -1, -1, 0 },
+    /*  1 */ { 2, s_12_1, -1, -1, 0 },
+    /*  2 */ { 3, s_12_2, -1, -1, 0 },
+    /*  3 */ { 3, s_12_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_13_0[3] = { 's', 'i', 'n' };
+    static constexpr unsigned char s_13_1[3] = { 's', 'u', 'n' };
+    static constexpr unsigned char s_13_2[4] = { 's', 0xC3, 0xBC, 'n' };
+    static constexpr unsigned char s_13_3[4] = { 's', 0xC4, 0xB1, 'n' };
+
+    static constexpr among<unsigned char> a_13[] = {
+    /*  0 */ { 3, s_13_0, -1, -1, 0 },
+    /*  1 */ { 3, s_13_1, -1, -1, 0 },
+    /*  2 */ { 4, s_13_2, -1, -1, 0 },
+    /*  3 */ { 4, s_13_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_14_0[2] = { 'i', 'z' };
+    static constexpr unsigned char s_14_1[2] = { 'u', 'z' };
+    static constexpr unsigned char s_14_2[3] = { 0xC3, 0xBC, 'z' };
+    static constexpr unsigned char s_14_3[3] = { 0xC4, 0xB1, 'z' };
+
+    static constexpr among<unsigned char> a_14[] = {
+    /*  0 */ { 2, s_14_0, -1, -1, 0 },
+    /*  1 */ { 2, s_14_1, -1, -1, 0 },
+    /*  2 */ { 3, s_14_2, -1, -1, 0 },
+    /*  3 */ { 3, s_14_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_15_0[5] = { 's', 'i', 'n', 'i', 'z' };
+    static constexpr unsigned char s_15_1[5] = { 's', 'u', 'n', 'u', 'z' };
+    static constexpr unsigned char s_15_2[7] = { 's', 0xC3, 0xBC, 'n', 0xC3, 0xBC, 'z' };
+    static constexpr unsigned char s_15_3[7] = { 's', 0xC4, 0xB1, 'n', 0xC4, 0xB1, 'z' };
+
+    static constexpr among<unsigned char> a_15[] = {
+    /*  0 */ { 5, s_15_0, -1, -1, 0 },
+    /*  1 */ { 5, s_15_1, -1, -1, 0 },
+    /*  2 */ { 7, s_15_2, -1, -1, 0 },
+    /*  3 */ { 7, s_15_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_16_0[3] = { 'l', 'a', 'r' };
+    static constexpr unsigned char s_16_1[3] = { 'l', 'e', 'r' };
+
+    static constexpr among<unsigned char> a_16[] = {
+    /*  0 */ { 3, s_16_0, -1, -1, 0 },
+    /*  1 */ { 3, s_16_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_17_0[3] = { 'n', 'i', 'z' };
+    static constexpr unsigned char s_17_1[3] = { 'n', 'u', 'z' };
+    static constexpr unsigned char s_17_2[4] = { 'n', 0xC3, 0xBC, 'z' };
+    static constexpr unsigned char s_17_3[4] = { 'n', 0xC4, 0xB1, 'z' };
+
+    static constexpr among<unsigned char> a_17[] = {
+    /*  0 */ { 3, s_17_0, -1, -1, 0 },
+    /*  1 */ { 3, s_17_1, -1, -1, 0 },
+    /*  2 */ { 4, s_17_2, -1, -1, 0 },
+    /*  3 */ { 4, s_17_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_18_0[3] = { 'd', 'i', 'r' };
+    static constexpr unsigned char s_18_1[3] = { 't', 'i', 'r' };
+    static constexpr unsigned char s_18_2[3] = { 'd', 'u', 'r' };
+    static constexpr unsigned char s_18_3[3] = { 't', 'u', 'r' };
+    static constexpr unsigned char s_18_4[4] = { 'd', 0xC3, 0xBC, 'r' };
+    static constexpr unsigned char s_18_5[4] = { 't', 0xC3, 0xBC, 'r' };
+    static constexpr unsigned char s_18_6[4] = { 'd', 0xC4, 0xB1, 'r' };
+    static constexpr unsigned char s_18_7[4] = { 't', 0xC4, 0xB1, 'r' };
+
+    static constexpr among<unsigned char> a_18[] = {
+    /*  0 */ { 3, s_18_0, -1, -1, 0 },
+    /*  1 */ { 3, s_18_1, -1, -1, 0 },
+    /*  2 */ { 3, s_18_2, -1, -1, 0 },
+    /*  3 */ { 3, s_18_3, -1, -1, 0 },
+    /*  4 */ { 4, s_18_4, -1, -1, 0 },
+    /*  5 */ { 4, s_18_5, -1, -1, 0 },
+    /*  6 */ { 4, s_18_6, -1, -1, 0 },
+    /*  7 */ { 4, s_18_7, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_19_0[7] = { 'c', 'a', 's', 0xC4, 0xB1, 'n', 'a' };
+    static constexpr unsigned char s_19_1[6] = { 'c', 'e', 's', 'i', 'n', 'e' };
+
+    static constexpr among<unsigned char> a_19[] = {
+    /*  0 */ { 7, s_19_0, -1, -1, 0 },
+    /*  1 */ { 6, s_19_1, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_20_0[2] = { 'd', 'i' };
+    static constexpr unsigned char s_20_1[2] = { 't', 'i' };
+    static constexpr unsigned char s_20_2[3] = { 'd', 'i', 'k' };
+    static constexpr unsigned char s_20_3[3] = { 't', 'i', 'k' };
+    static constexpr unsigned char s_20_4[3] = { 'd', 'u', 'k' };
+    static constexpr unsigned char s_20_5[3] = { 't', 'u', 'k' };
+    static constexpr unsigned char s_20_6[4] = { 'd', 0xC3, 0xBC, 'k' };
+    static constexpr unsigned char s_20_7[4] = { 't', 0xC3, 0xBC, 'k' };
+    static constexpr unsigned char s_20_8[4] = { 'd', 0xC4, 0xB1, 'k' };
+    static constexpr unsigned char s_20_9[4] = { 't', 0xC4, 0xB1, 'k' };
+    static constexpr unsigned char s_20_10[3] = { 'd', 'i', 'm' };
+    static constexpr unsigned char s_20_11[3] = { 't', 'i', 'm' };
+    static constexpr unsigned char s_20_12[3] = { 'd', 'u', 'm' };
+    static constexpr unsigned char s_20_13[3] = { 't', 'u', 'm' };
+    static constexpr unsigned char s_20_14[4] = { 'd', 0xC3, 0xBC, 'm' };
+    static constexpr unsigned char s_20_15[4] = { 't', 0xC3, 0xBC, 'm' };
+    static constexpr unsigned char s_20_16[4] = { 'd', 0xC4, 0xB1, 'm' };
+    static constexpr unsigned char s_20_17[4] = { 't', 0xC4, 0xB1, 'm' };
+    static constexpr unsigned char s_20_18[3] = { 'd', 'i', 'n' };
+    static constexpr unsigned char s_20_19[3] = { 't', 'i', 'n' };
+    static constexpr unsigned char s_20_20[3] = { 'd', 'u', 'n' };
+    static constexpr unsigned char s_20_21[3] = { 't', 'u', 'n' };
+    static constexpr unsigned char s_20_22[4] = { 'd', 0xC3, 0xBC, 'n' };
+    static constexpr unsigned char s_20_23[4] = { 't', 0xC3, 0xBC, 'n' };
+    static constexpr unsigned char s_20_24[4] = { 'd', 0xC4, 0xB1, 'n' };
+    static constexpr unsigned char s_20_25[4] = { 't', 0xC4, 0xB1, 'n' };
+    static constexpr unsigned char s_20_26[2] = { 'd', 'u' };
+    static constexpr unsigned char s_20_27[2] = { 't', 'u' };
+    static constexpr unsigned char s_20_28[3] = { 'd', 0xC3, 0xBC };
+    static constexpr unsigned char s_20_29[3] = { 't', 0xC3, 0xBC };
+    static constexpr unsigned char s_20_30[3] = { 'd', 0xC4, 0xB1 };
+    static constexpr unsigned char s_20_31[3] = { 't', 0xC4, 0xB1 };
+
+    static constexpr among<unsigned char> a_20[] = {
+    /*  0 */ { 2, s_20_0, -1, -1, 0 },
+    /*  1 */ { 2, s_20_1, -1, -1, 0 },
+    /*  2 */ { 3, s_20_2, -1, -1, 0 },
+    /*  3 */ { 3, s_20_3, -1, -1, 0 },
+    /*  4 */ { 3, s_20_4, -1, -1, 0 },
+    /*  5 */ { 3, s_20_5, -1, -1, 0 },
+    /*  6 */ { 4, s_20_6, -1, -1, 0 },
+    /*  7 */ { 4, s_20_7, -1, -1, 0 },
+    /*  8 */ { 4, s_20_8, -1, -1, 0 },
+    /*  9 */ { 4, s_20_9, -1, -1, 0 },
+    /* 10 */ { 3, s_20_10, -1, -1, 0 },
+    /* 11 */ { 3, s_20_11, -1, -1, 0 },
+    /* 12 */ { 3, s_20_12, -1, -1, 0 },
+    /* 13 */ { 3, s_20_13, -1, -1, 0 },
+    /* 14 */ { 4, s_20_14, -1, -1, 0 },
+    /* 15 */ { 4, s_20_15, -1, -1, 0 },
+    /* 16 */ { 4, s_20_16, -1, -1, 0 },
+    /* 17 */ { 4, s_20_17, -1, -1, 0 },
+    /* 18 */ { 3, s_20_18, -1, -1, 0 },
+    /* 19 */ { 3, s_20_19, -1, -1, 0 },
+    /* 20 */ { 3, s_20_20, -1, -1, 0 },
+    /* 21 */ { 3, s_20_21, -1, -1, 0 },
+    /* 22 */ { 4, s_20_22, -1, -1, 0 },
+    /* 23 */ { 4, s_20_23, -1, -1, 0 },
+    /* 24 */ { 4, s_20_24, -1, -1, 0 },
+    /* 25 */ { 4, s_20_25, -1, -1, 0 },
+    /* 26 */ { 2, s_20_26, -1, -1, 0 },
+    /* 27 */ { 2, s_20_27, -1, -1, 0 },
+    /* 28 */ { 3, s_20_28, -1, -1, 0 },
+    /* 29 */ { 3, s_20_29, -1, -1, 0 },
+    /* 30 */ { 3, s_20_30, -1, -1, 0 },
+    /* 31 */ { 3, s_20_31, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_21_0[2] = { 's', 'a' };
+    static constexpr unsigned char s_21_1[2] = { 's', 'e' };
+    static constexpr unsigned char s_21_2[3] = { 's', 'a', 'k' };
+    static constexpr unsigned char s_21_3[3] = { 's', 'e', 'k' };
+    static constexpr unsigned char s_21_4[3] = { 's', 'a', 'm' };
+    static constexpr unsigned char s_21_5[3] = { 's', 'e', 'm' };
+    static constexpr unsigned char s_21_6[3] = { 's', 'a', 'n' };
+    static constexpr unsigned char s_21_7[3] = { 's', 'e', 'n' };
+
+    static constexpr among<unsigned char> a_21[] = {
+    /*  0 */ { 2, s_21_0, -1, -1, 0 },
+    /*  1 */ { 2, s_21_1, -1, -1, 0 },
+    /*  2 */ { 3, s_21_2, -1, -1, 0 },
+    /*  3 */ { 3, s_21_3, -1, -1, 0 },
+    /*  4 */ { 3, s_21_4, -1, -1, 0 },
+    /*  5 */ { 3, s_21_5, -1, -1, 0 },
+    /*  6 */ { 3, s_21_6, -1, -1, 0 },
+    /*  7 */ { 3, s_21_7, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_22_0[4] = { 'm', 'i', 0xC5, 0x9F };
+    static constexpr unsigned char s_22_1[4] = { 'm', 'u', 0xC5, 0x9F };
+    static constexpr unsigned char s_22_2[5] = { 'm', 0xC3, 0xBC, 0xC5, 0x9F };
+    static constexpr unsigned char s_22_3[5] = { 'm', 0xC4, 0xB1, 0xC5, 0x9F };
+
+    static constexpr among<unsigned char> a_22[] = {
+    /*  0 */ { 4, s_22_0, -1, -1, 0 },
+    /*  1 */ { 4, s_22_1, -1, -1, 0 },
+    /*  2 */ { 5, s_22_2, -1, -1, 0 },
+    /*  3 */ { 5, s_22_3, -1, -1, 0 }
+    };
+
+    static constexpr unsigned char s_23_0[1] = { 'b' };
+    static constexpr unsigned char s_23_1[1] = { 'c' };
+    static constexpr unsigned char s_23_2[1] = { 'd' };
+    static constexpr unsigned char s_23_3[2] = { 0xC4, 0x9F };
+
+    static constexpr among<unsigned char> a_23[] = {
+    /*  0 */ { 1, s_23_0, -1, 1, 0 },
+    /*  1 */ { 1, s_23_1, -1, 2, 0 },
+    /*  2 */ { 1, s_23_2, -1, 3, 0 },
+    /*  3 */ { 2, s_23_3, -1, 4, 0 }
+    };
+    static constexpr unsigned char s_0[] = { 'a' };
+    static constexpr unsigned char s_1[] = { 'e' };
+    static constexpr unsigned char s_2[] = { 0xC4, 0xB1 };
+    static constexpr unsigned char s_3[] = { 'i' };
+    static constexpr unsigned char s_4[] = { 'o' };
+    static constexpr unsigned char s_5[] = { 0xC3, 0xB6 };
+    static constexpr unsigned char s_6[] = { 'u' };
+    static constexpr unsigned char s_7[] = { 0xC3, 0xBC };
+    static constexpr unsigned char s_8[] = { 'n' };
+    static constexpr unsigned char s_9[] = { 'n' };
+    static constexpr unsigned char s_10[] = { 's' };
+    static constexpr unsigned char s_11[] = { 's' };
+    static constexpr unsigned char s_12[] = { 'y' };
+    static constexpr unsigned char s_13[] = { 'y' };
+    static constexpr unsigned char s_14[] = { 'k', 'i' };
+    static constexpr unsigned char s_15[] = { 'k', 'e', 'n' };
+    static constexpr unsigned char s_16[] = { 'p' };
+    static constexpr unsigned char s_17[] = { 0xC3, 0xA7 };
+    static constexpr unsigned char s_18[] = { 't' };
+    static constexpr unsigned char s_19[] = { 'k' };
+    static constexpr unsigned char s_20[] = { 'd' };
+    static constexpr unsigned char s_21[] = { 'g' };
+    static constexpr unsigned char s_22[] = { 'a' };
+    static constexpr unsigned char s_23[] = { 0xC4, 0xB1 };
+    static constexpr unsigned char s_24[] = { 0xC4, 0xB1 };
+    static constexpr unsigned char s_25[] = { 'e' };
+    static constexpr unsigned char s_26[] = { 'i' };
+    static constexpr unsigned char s_27[] = { 'i' };
+    static constexpr unsigned char s_28[] = { 'o' };
+    static constexpr unsigned char s_29[] = { 'u' };
+    static constexpr unsigned char s_30[] = { 'u' };
+    static constexpr unsigned char s_31[] = { 0xC3, 0xB6 };
+    static constexpr unsigned char s_32[] = { 0xC3, 0xBC };
+    static constexpr unsigned char s_33[] = { 0xC3, 0xBC };
+    static constexpr unsigned char s_34[] = { 'a', 'd' };
+    static constexpr unsigned char s_35[] = { 's', 'o', 'y', 'a', 'd' };
+};
+
+template <>
+struct turkish_stemmer_data<false> : turkish_stemmer_groupings {
+    static constexpr char32_t s_0_0[1] = { 'm' };
+    static constexpr char32_t s_0_1[1] = { 'n' };
+    static constexpr char32_t s_0_2[3] = { 'm', 'i', 'z' };
+    static constexpr char32_t s_0_3[3] = { 'n', 'i', 'z' };
+    static constexpr char32_t s_0_4[3] = { 'm', 'u', 'z' };
+    static constexpr char32_t s_0_5[3] = { 'n', 'u', 'z' };
+    static constexpr char32_t s_0_6[3] = { 'm', 0xFC, 'z' };
+    static constexpr char32_t s_0_7[3] = { 'n', 0xFC, 'z' };
+    static constexpr char32_t s_0_8[3] = { 'm', 0x131, 'z' };
+    static constexpr char32_t s_0_9[3] = { 'n', 0x131, 'z' };
+
+    static constexpr among<char32_t> a_0[] = {
+    /*  0 */ { 1, s_0_0, -1, -1, 0 },
+    /*  1 */ { 1, s_0_1, -1, -1, 0 },
+    /*  2 */ { 3, s_0_2, -1, -1, 0 },
+    /*  3 */ { 3, s_0_3, -1, -1, 0 },
+    /*  4 */ { 3, s_0_4, -1, -1, 0 },
+    /*  5 */ { 3, s_0_5, -1, -1, 0 },
+    /*  6 */ { 3, s_0_6, -1, -1, 0 },
+    /*  7 */ { 3, s_0_7, -1, -1, 0 },
+    /*  8 */ { 3, s_0_8, -1, -1, 0 },
+    /*  9 */ { 3, s_0_9, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_1_0[4] = { 'l', 'e', 'r', 'i' };
+    static constexpr char32_t s_1_1[4] = { 'l', 'a', 'r', 0x131 };
+
+    static constexpr among<char32_t> a_1[] = {
+    /*  0 */ { 4, s_1_0, -1, -1, 0 },
+    /*  1 */ { 4, s_1_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_2_0[2] = { 'n', 'i' };
+    static constexpr char32_t s_2_1[2] = { 'n', 'u' };
+    static constexpr char32_t s_2_2[2] = { 'n', 0xFC };
+    static constexpr char32_t s_2_3[2] = { 'n', 0x131 };
+
+    static constexpr among<char32_t> a_2[] = {
+    /*  0 */ { 2, s_2_0, -1, -1, 0 },
+    /*  1 */ { 2, s_2_1, -1, -1, 0 },
+    /*  2 */ { 2, s_2_2, -1, -1, 0 },
+    /*  3 */ { 2, s_2_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_3_0[2] = { 'i', 'n' };
+    static constexpr char32_t s_3_1[2] = { 'u', 'n' };
+    static constexpr char32_t s_3_2[2] = { 0xFC, 'n' };
+    static constexpr char32_t s_3_3[2] = { 0x131, 'n' };
+
+    static constexpr among<char32_t> a_3[] = {
+    /*  0 */ { 2, s_3_0, -1, -1, 0 },
+    /*  1 */ { 2, s_3_1, -1, -1, 0 },
+    /*  2 */ { 2, s_3_2, -1, -1, 0 },
+    /*  3 */ { 2, s_3_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_4_0[1] = { 'a' };
+    static constexpr char32_t s_4_1[1] = { 'e' };
+
+    static constexpr among<char32_t> a_4[] = {
+    /*  0 */ { 1, s_4_0, -1, -1, 0 },
+    /*  1 */ { 1, s_4_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_5_0[2] = { 'n', 'a' };
+    static constexpr char32_t s_5_1[2] = { 'n', 'e' };
+
+    static constexpr among<char32_t> a_5[] = {
+    /*  0 */ { 2, s_5_0, -1, -1, 0 },
+    /*  1 */ { 2, s_5_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_6_0[2] = { 'd', 'a' };
+    static constexpr char32_t s_6_1[2] = { 't', 'a' };
+    static constexpr char32_t s_6_2[2] = { 'd', 'e' };
+    static constexpr char32_t s_6_3[2] = { 't', 'e' };
+
+    static constexpr among<char32_t> a_6[] = {
+    /*  0 */ { 2, s_6_0, -1, -1, 0 },
+    /*  1 */ { 2, s_6_1, -1, -1, 0 },
+    /*  2 */ { 2, s_6_2, -1, -1, 0 },
+    /*  3 */ { 2, s_6_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_7_0[3] = { 'n', 'd', 'a' };
+    static constexpr char32_t s_7_1[3] = { 'n', 'd', 'e' };
+
+    static constexpr among<char32_t> a_7[] = {
+    /*  0 */ { 3, s_7_0, -1, -1, 0 },
+    /*  1 */ { 3, s_7_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_8_0[3] = { 'd', 'a', 'n' };
+    static constexpr char32_t s_8_1[3] = { 't', 'a', 'n' };
+    static constexpr char32_t s_8_2[3] = { 'd', 'e', 'n' };
+    static constexpr char32_t s_8_3[3] = { 't', 'e', 'n' };
+
+    static constexpr among<char32_t> a_8[] = {
+    /*  0 */ { 3, s_8_0, -1, -1, 0 },
+    /*  1 */ { 3, s_8_1, -1, -1, 0 },
+    /*  2 */ { 3, s_8_2, -1, -1, 0 },
+    /*  3 */ { 3, s_8_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_9_0[4] = { 'n', 'd', 'a', 'n' };
+    static constexpr char32_t s_9_1[4] = { 'n', 'd', 'e', 'n' };
+
+    static constexpr among<char32_t> a_9[] = {
+    /*  0 */ { 4, s_9_0, -1, -1, 0 },
+    /*  1 */ { 4, s_9_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_10_0[2] = { 'l', 'a' };
+    static constexpr char32_t s_10_1[2] = { 'l', 'e' };
+
+    static constexpr among<char32_t> a_10[] = {
+    /*  0 */ { 2, s_10_0, -1, -1, 0 },
+    /*  1 */ { 2, s_10_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_11_0[2] = { 'c', 'a' };
+    static constexpr char32_t s_11_1[2] = { 'c', 'e' };
+
+    static constexpr among<char32_t> a_11[] = {
+    /*  0 */ { 2, s_11_0, -1, -1, 0 },
+    /*  1 */ { 2, s_11_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_12_0[2] = { 'i', 'm' };
+    static constexpr char32_t s_12_1[2] = { 'u', 'm' };
+    static constexpr char32_t s_12_2[2] = { 0xFC, 'm' };
+    static constexpr char32_t s_12_3[2] = { 0x131, 'm' };
+
+    static constexpr among<char32_t> a_12[] = {
+    /*  0 */ { 2, s_12_0, -1, -1, 0 },
+    /*  1 */ { 2, s_12_1, -1, -1, 0 },
+    /*  2 */ { 2, s_12_2, -1, -1, 0 },
+    /*  3 */ { 2, s_12_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_13_0[3] = { 's', 'i', 'n' };
+    static constexpr char32_t s_13_1[3] = { 's', 'u', 'n' };
+    static constexpr char32_t s_13_2[3] = { 's', 0xFC, 'n' };
+    static constexpr char32_t s_13_3[3] = { 's', 0x131, 'n' };
+
+    static constexpr among<char32_t> a_13[] = {
+    /*  0 */ { 3, s_13_0, -1, -1, 0 },
+    /*  1 */ { 3, s_13_1, -1, -1, 0 },
+    /*  2 */ { 3, s_13_2, -1, -1, 0 },
+    /*  3 */ { 3, s_13_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_14_0[2] = { 'i', 'z' };
+    static constexpr char32_t s_14_1[2] = { 'u', 'z' };
+    static constexpr char32_t s_14_2[2] = { 0xFC, 'z' };
+    static constexpr char32_t s_14_3[2] = { 0x131, 'z' };
+
+    static constexpr among<char32_t> a_14[] = {
+    /*  0 */ { 2, s_14_0, -1, -1, 0 },
+    /*  1 */ { 2, s_14_1, -1, -1, 0 },
+    /*  2 */ { 2, s_14_2, -1, -1, 0 },
+    /*  3 */ { 2, s_14_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_15_0[5] = { 's', 'i', 'n', 'i', 'z' };
+    static constexpr char32_t s_15_1[5] = { 's', 'u', 'n', 'u', 'z' };
+    static constexpr char32_t s_15_2[5] = { 's', 0xFC, 'n', 0xFC, 'z' };
+    static constexpr char32_t s_15_3[5] = { 's', 0x131, 'n', 0x131, 'z' };
+
+    static constexpr among<char32_t> a_15[] = {
+    /*  0 */ { 5, s_15_0, -1, -1, 0 },
+    /*  1 */ { 5, s_15_1, -1, -1, 0 },
+    /*  2 */ { 5, s_15_2, -1, -1, 0 },
+    /*  3 */ { 5, s_15_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_16_0[3] = { 'l', 'a', 'r' };
+    static constexpr char32_t s_16_1[3] = { 'l', 'e', 'r' };
+
+    static constexpr among<char32_t> a_16[] = {
+    /*  0 */ { 3, s_16_0, -1, -1, 0 },
+    /*  1 */ { 3, s_16_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_17_0[3] = { 'n', 'i', 'z' };
+    static constexpr char32_t s_17_1[3] = { 'n', 'u', 'z' };
+    static constexpr char32_t s_17_2[3] = { 'n', 0xFC, 'z' };
+    static constexpr char32_t s_17_3[3] = { 'n', 0x131, 'z' };
+
+    static constexpr among<char32_t> a_17[] = {
+    /*  0 */ { 3, s_17_0, -1, -1, 0 },
+    /*  1 */ { 3, s_17_1, -1, -1, 0 },
+    /*  2 */ { 3, s_17_2, -1, -1, 0 },
+    /*  3 */ { 3, s_17_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_18_0[3] = { 'd', 'i', 'r' };
+    static constexpr char32_t s_18_1[3] = { 't', 'i', 'r' };
+    static constexpr char32_t s_18_2[3] = { 'd', 'u', 'r' };
+    static constexpr char32_t s_18_3[3] = { 't', 'u', 'r' };
+    static constexpr char32_t s_18_4[3] = { 'd', 0xFC, 'r' };
+    static constexpr char32_t s_18_5[3] = { 't', 0xFC, 'r' };
+    static constexpr char32_t s_18_6[3] = { 'd', 0x131, 'r' };
+    static constexpr char32_t s_18_7[3] = { 't', 0x131, 'r' };
+
+    static constexpr among<char32_t> a_18[] = {
+    /*  0 */ { 3, s_18_0, -1, -1, 0 },
+    /*  1 */ { 3, s_18_1, -1, -1, 0 },
+    /*  2 */ { 3, s_18_2, -1, -1, 0 },
+    /*  3 */ { 3, s_18_3, -1, -1, 0 },
+    /*  4 */ { 3, s_18_4, -1, -1, 0 },
+    /*  5 */ { 3, s_18_5, -1, -1, 0 },
+    /*  6 */ { 3, s_18_6, -1, -1, 0 },
+    /*  7 */ { 3, s_18_7, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_19_0[6] = { 'c', 'a', 's', 0x131, 'n', 'a' };
+    static constexpr char32_t s_19_1[6] = { 'c', 'e', 's', 'i', 'n', 'e' };
+
+    static constexpr among<char32_t> a_19[] = {
+    /*  0 */ { 6, s_19_0, -1, -1, 0 },
+    /*  1 */ { 6, s_19_1, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_20_0[2] = { 'd', 'i' };
+    static constexpr char32_t s_20_1[2] = { 't', 'i' };
+    static constexpr char32_t s_20_2[3] = { 'd', 'i', 'k' };
+    static constexpr char32_t s_20_3[3] = { 't', 'i', 'k' };
+    static constexpr char32_t s_20_4[3] = { 'd', 'u', 'k' };
+    static constexpr char32_t s_20_5[3] = { 't', 'u', 'k' };
+    static constexpr char32_t s_20_6[3] = { 'd', 0xFC, 'k' };
+    static constexpr char32_t s_20_7[3] = { 't', 0xFC, 'k' };
+    static constexpr char32_t s_20_8[3] = { 'd', 0x131, 'k' };
+    static constexpr char32_t s_20_9[3] = { 't', 0x131, 'k' };
+    static constexpr char32_t s_20_10[3] = { 'd', 'i', 'm' };
+    static constexpr char32_t s_20_11[3] = { 't', 'i', 'm' };
+    static constexpr char32_t s_20_12[3] = { 'd', 'u', 'm' };
+    static constexpr char32_t s_20_13[3] = { 't', 'u', 'm' };
+    static constexpr char32_t s_20_14[3] = { 'd', 0xFC, 'm' };
+    static constexpr char32_t s_20_15[3] = { 't', 0xFC, 'm' };
+    static constexpr char32_t s_20_16[3] = { 'd', 0x131, 'm' };
+    static constexpr char32_t s_20_17[3] = { 't', 0x131, 'm' };
+    static constexpr char32_t s_20_18[3] = { 'd', 'i', 'n' };
+    static constexpr char32_t s_20_19[3] = { 't', 'i', 'n' };
+    static constexpr char32_t s_20_20[3] = { 'd', 'u', 'n' };
+    static constexpr char32_t s_20_21[3] = { 't', 'u', 'n' };
+    static constexpr char32_t s_20_22[3] = { 'd', 0xFC, 'n' };
+    static constexpr char32_t s_20_23[3] = { 't', 0xFC, 'n' };
+    static constexpr char32_t s_20_24[3] = { 'd', 0x131, 'n' };
+    static constexpr char32_t s_20_25[3] = { 't', 0x131, 'n' };
+    static constexpr char32_t s_20_26[2] = { 'd', 'u' };
+    static constexpr char32_t s_20_27[2] = { 't', 'u' };
+    static constexpr char32_t s_20_28[2] = { 'd', 0xFC };
+    static constexpr char32_t s_20_29[2] = { 't', 0xFC };
+    static constexpr char32_t s_20_30[2] = { 'd', 0x131 };
+    static constexpr char32_t s_20_31[2] = { 't', 0x131 };
+
+    static constexpr among<char32_t> a_20[] = {
+    /*  0 */ { 2, s_20_0, -1, -1, 0 },
+    /*  1 */ { 2, s_20_1, -1, -1, 0 },
+    /*  2 */ { 3, s_20_2, -1, -1, 0 },
+    /*  3 */ { 3, s_20_3, -1, -1, 0 },
+    /*  4 */ { 3, s_20_4, -1, -1, 0 },
+    /*  5 */ { 3, s_20_5, -1, -1, 0 },
+    /*  6 */ { 3, s_20_6, -1, -1, 0 },
+    /*  7 */ { 3, s_20_7, -1, -1, 0 },
+    /*  8 */ { 3, s_20_8, -1, -1, 0 },
+    /*  9 */ { 3, s_20_9, -1, -1, 0 },
+    /* 10 */ { 3, s_20_10, -1, -1, 0 },
+    /* 11 */ { 3, s_20_11, -1, -1, 0 },
+    /* 12 */ { 3, s_20_12, -1, -1, 0 },
+    /* 13 */ { 3, s_20_13, -1, -1, 0 },
+    /* 14 */ { 3, s_20_14, -1, -1, 0 },
+    /* 15 */ { 3, s_20_15, -1, -1, 0 },
+    /* 16 */ { 3, s_20_16, -1, -1, 0 },
+    /* 17 */ { 3, s_20_17, -1, -1, 0 },
+    /* 18 */ { 3, s_20_18, -1, -1, 0 },
+    /* 19 */ { 3, s_20_19, -1, -1, 0 },
+    /* 20 */ { 3, s_20_20, -1, -1, 0 },
+    /* 21 */ { 3, s_20_21, -1, -1, 0 },
+    /* 22 */ { 3, s_20_22, -1, -1, 0 },
+    /* 23 */ { 3, s_20_23, -1, -1, 0 },
+    /* 24 */ { 3, s_20_24, -1, -1, 0 },
+    /* 25 */ { 3, s_20_25, -1, -1, 0 },
+    /* 26 */ { 2, s_20_26, -1, -1, 0 },
+    /* 27 */ { 2, s_20_27, -1, -1, 0 },
+    /* 28 */ { 2, s_20_28, -1, -1, 0 },
+    /* 29 */ { 2, s_20_29, -1, -1, 0 },
+    /* 30 */ { 2, s_20_30, -1, -1, 0 },
+    /* 31 */ { 2, s_20_31, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_21_0[2] = { 's', 'a' };
+    static constexpr char32_t s_21_1[2] = { 's', 'e' };
+    static constexpr char32_t s_21_2[3] = { 's', 'a', 'k' };
+    static constexpr char32_t s_21_3[3] = { 's', 'e', 'k' };
+    static constexpr char32_t s_21_4[3] = { 's', 'a', 'm' };
+    static constexpr char32_t s_21_5[3] = { 's', 'e', 'm' };
+    static constexpr char32_t s_21_6[3] = { 's', 'a', 'n' };
+    static constexpr char32_t s_21_7[3] = { 's', 'e', 'n' };
+
+    static constexpr among<char32_t> a_21[] = {
+    /*  0 */ { 2, s_21_0, -1, -1, 0 },
+    /*  1 */ { 2, s_21_1, -1, -1, 0 },
+    /*  2 */ { 3, s_21_2, -1, -1, 0 },
+    /*  3 */ { 3, s_21_3, -1, -1, 0 },
+    /*  4 */ { 3, s_21_4, -1, -1, 0 },
+    /*  5 */ { 3, s_21_5, -1, -1, 0 },
+    /*  6 */ { 3, s_21_6, -1, -1, 0 },
+    /*  7 */ { 3, s_21_7, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_22_0[3] = { 'm', 'i', 0x15F };
+    static constexpr char32_t s_22_1[3] = { 'm', 'u', 0x15F };
+    static constexpr char32_t s_22_2[3] = { 'm', 0xFC, 0x15F };
+    static constexpr char32_t s_22_3[3] = { 'm', 0x131, 0x15F };
+
+    static constexpr among<char32_t> a_22[] = {
+    /*  0 */ { 3, s_22_0, -1, -1, 0 },
+    /*  1 */ { 3, s_22_1, -1, -1, 0 },
+    /*  2 */ { 3, s_22_2, -1, -1, 0 },
+    /*  3 */ { 3, s_22_3, -1, -1, 0 }
+    };
+
+    static constexpr char32_t s_23_0[1] = { 'b' };
+    static constexpr char32_t s_23_1[1] = { 'c' };
+    static constexpr char32_t s_23_2[1] = { 'd' };
+    static constexpr char32_t s_23_3[1] = { 0x11F };
+
+    static constexpr among<char32_t> a_23[] = {
+    /*  0 */ { 1, s_23_0, -1, 1, 0 },
+    /*  1 */ { 1, s_23_1, -1, 2, 0 },
+    /*  2 */ { 1, s_23_2, -1, 3, 0 },
+    /*  3 */ { 1, s_23_3, -1, 4, 0 }
+    };
+    static constexpr char32_t s_0[] = { 'a' };
+    static constexpr char32_t s_1[] = { 'e' };
+    static constexpr char32_t s_2[] = { 0x131 };
+    static constexpr char32_t s_3[] = { 'i' };
+    static constexpr char32_t s_4[] = { 'o' };
+    static constexpr char32_t s_5[] = { 0xF6 };
+    static constexpr char32_t s_6[] = { 'u' };
+    static constexpr char32_t s_7[] = { 0xFC };
+    static constexpr char32_t s_8[] = { 'n' };
+    static constexpr char32_t s_9[] = { 'n' };
+    static constexpr char32_t s_10[] = { 's' };
+    static constexpr char32_t s_11[] = { 's' };
+    static constexpr char32_t s_12[] = { 'y' };
+    static constexpr char32_t s_13[] = { 'y' };
+    static constexpr char32_t s_14[] = { 'k', 'i' };
+    static constexpr char32_t s_15[] = { 'k', 'e', 'n' };
+    static constexpr char32_t s_16[] = { 'p' };
+    static constexpr char32_t s_17[] = { 0xE7 };
+    static constexpr char32_t s_18[] = { 't' };
+    static constexpr char32_t s_19[] = { 'k' };
+    static constexpr char32_t s_20[] = { 'd' };
+    static constexpr char32_t s_21[] = { 'g' };
+    static constexpr char32_t s_22[] = { 'a' };
+    static constexpr char32_t s_23[] = { 0x131 };
+    static constexpr char32_t s_24[] = { 0x131 };
+    static constexpr char32_t s_25[] = { 'e' };
+    static constexpr char32_t s_26[] = { 'i' };
+    static constexpr char32_t s_27[] = { 'i' };
+    static constexpr char32_t s_28[] = { 'o' };
+    static constexpr char32_t s_29[] = { 'u' };
+    static constexpr char32_t s_30[] = { 'u' };
+    static constexpr char32_t s_31[] = { 0xF6 };
+    static constexpr char32_t s_32[] = { 0xFC };
+    static constexpr char32_t s_33[] = { 0xFC };
+    static constexpr char32_t s_34[] = { 'a', 'd' };
+    static constexpr char32_t s_35[] = { 's', 'o', 'y', 'a', 'd' };
+};
+
+template <typename symbol>
+class turkish_stemmer : public program<symbol> {
+
+    typedef program<symbol> base;
+    typedef turkish_stemmer_data<base::utf8 != 0> data;
+
+    using base::p; using base::c; using base::l; using base::lb;
+    using base::bra; using base::ket;
+    using typename base::cursors; using base::save_cursors; using base::restore_cursors;
+    using base::swap_current; using base::hop;
+    using base::in_grouping; using base::in_grouping_b;
+    using base::out_grouping; using base::out_grouping_b;
+    using base::eq_s; using base::eq_s_b; using base::eq_v; using base::eq_v_b;
+    using base::find_among; using base::find_among_b;
+    using base::slice_from; using base::slice_from_v; using base::slice_del;
+    using base::insert; using base::insert_v;
+    using base::slice_to; using base::assign_to; using base::debug;
+
+  private:
+    bool r_check_vowel_harmony() {
+        {   int m_test = l - c; /* test, line 112 */
+            if (out_grouping_b(data::g_vowel, 97, 305, 1) < 0) return false; /* goto */ /* grouping vowel, line 114 */
+            {   int m1 = l - c; (void)m1; /* or, line 116 */
+                if (!eq_s_b(data::s_0)) goto lab1; /* literal, line 116 */
+                if (out_grouping_b(data::g_vowel1, 97, 305, 1) < 0) goto lab1; /* goto */ /* grouping vowel1, line 116 */
+                goto lab0;
+            lab1:
+                c = l - m1;
+                if (!eq_s_b(data::s_1)) goto lab2; /* literal, line 117 */
+                if (out_grouping_b(data::g_vowel2, 101, 252, 1) < 0) goto lab2; /* goto */ /* grouping vowel2, line 117 */
+                goto lab0;
+            lab2:
+                c = l - m1;
+                if (!eq_s_b(data::s_2)) goto lab3; /* literal, line 118 */
+                if (out_grouping_b(data::g_vowel3, 97, 305, 1) < 0) goto lab3; /* goto */ /* grouping vowel3, line 118 */
+                goto lab0;
+            lab3:
+                c = l - m1;
+                if (!eq_s_b(data::s_3)) goto lab4; /* literal, line 119 */
+                if (out_grouping_b(data::g_vowel4, 101, 105, 1) < 0) goto lab4; /* goto */ /* grouping vowel4, line 119 */
+                goto lab0;
+            lab4:
+                c = l - m1;
+                if (!eq_s_b(data::s_4)) goto lab5; /* literal, line 120 */
+                if (out_grouping_b(data::g_vowel5, 111, 117, 1) < 0) goto lab5; /* goto */ /* grouping vowel5, line 120 */
+                goto lab0;
+            lab5:
+                c = l - m1;
+                if (!eq_s_b(data::s_5)) goto lab6; /* literal, line 121 */
+                if (out_grouping_b(data::g_vowel6, 246, 252, 1) < 0) goto lab6; /* goto */ /* grouping vowel6, line 121 */
+                goto lab0;
+            lab6:
+                c = l - m1;
+                if (!eq_s_b(data::s_6)) goto lab7; /* literal, line 122 */
+                if (out_grouping_b(data::g_vowel5, 111, 117, 1) < 0) goto lab7; /* goto */ /* grouping vowel5, line 122 */
+                goto lab0;
+            lab7:
+                c = l - m1;
+                if (!eq_s_b(data::s_7)) return false; /* literal, line 123 */
+                if (out_grouping_b(data::g_vowel6, 246, 252, 1) < 0) return false; /* goto */ /* grouping vowel6, line 123 */
+            }
+        lab0:
+            c = l - m_test;
+        }
+        return true;
+    }
+
+  private:
+    bool r_mark_suffix_with_optional_n_consonant() {
+        {   int m1 = l - c; (void)m1; /* or, line 134 */
+            {   int m_test = l - c; /* test, line 133 */
+                if (!eq_s_b(data::s_8)) goto lab1; /* literal, line 133 */
+                c = l - m_test;
+            }
+            {   int ret = hop(c, lb, l, -1); /* next, line 133 */
+                if (ret < 0) goto lab1;
+                c = ret;
+            }
+            {   int m_test = l - c; /* test, line 133 */
+                if (in_grouping_b(data::g_vowel, 97, 305, 0)) goto lab1; /* grouping vowel, line 133 */
+                c = l - m_test;
+            }
+            goto lab0;
+        lab1:
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* not, line 135 */
+                {   int m_test = l - c; /* test, line 135 */
+                    if (!eq_s_b(data::s_9)) goto lab2; /* literal, line 135 */
+                    c = l - m_test;
+                }
+                return false;
+            lab2:
+                c = l - m2;
+            }
+            {   int m_test = l - c; /* test, line 135 */
+                {   int ret = hop(c, lb, l, -1); /* next, line 135 */
+                    if (ret < 0) return false;
+                    c = ret;
+                }
+                {   int m_test = l - c; /* test, line 135 */
+                    if (in_grouping_b(data::g_vowel, 97, 305, 0)) return false; /* grouping vowel, line 135 */
+                    c = l - m_test;
+                }
+                c = l - m_test;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_mark_suffix_with_optional_s_consonant() {
+        {   int m1 = l - c; (void)m1; /* or, line 145 */
+            {   int m_test = l - c; /* test, line 144 */
+                if (!eq_s_b(data::s_10)) goto lab1; /* literal, line 144 */
+                c = l - m_test;
+            }
+            {   int ret = hop(c, lb, l, -1); /* next, line 144 */
+                if (ret < 0) goto lab1;
+                c = ret;
+            }
+            {   int m_test = l - c; /* test, line 144 */
+                if (in_grouping_b(data::g_vowel, 97, 305, 0)) goto lab1; /* grouping vowel, line 144 */
+                c = l - m_test;
+            }
+            goto lab0;
+        lab1:
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* not, line 146 */
+                {   int m_test = l - c; /* test, line 146 */
+                    if (!eq_s_b(data::s_11)) goto lab2; /* literal, line 146 */
+                    c = l - m_test;
+                }
+                return false;
+            lab2:
+                c = l - m2;
+            }
+            {   int m_test = l - c; /* test, line 146 */
+                {   int ret = hop(c, lb, l, -1); /* next, line 146 */
+                    if (ret < 0) return false;
+                    c = ret;
+                }
+                {   int m_test = l - c; /* test, line 146 */
+                    if (in_grouping_b(data::g_vowel, 97, 305, 0)) return false; /* grouping vowel, line 146 */
+                    c = l - m_test;
+                }
+                c = l - m_test;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_mark_suffix_with_optional_y_consonant() {
+        {   int m1 = l - c; (void)m1; /* or, line 155 */
+            {   int m_test = l - c; /* test, line 154 */
+                if (!eq_s_b(data::s_12)) goto lab1; /* literal, line 154 */
+                c = l - m_test;
+            }
+            {   int ret = hop(c, lb, l, -1); /* next, line 154 */
+                if (ret < 0) goto lab1;
+                c = ret;
+            }
+            {   int m_test = l - c; /* test, line 154 */
+                if (in_grouping_b(data::g_vowel, 97, 305, 0)) goto lab1; /* grouping vowel, line 154 */
+                c = l - m_test;
+            }
+            goto lab0;
+        lab1:
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* not, line 156 */
+                {   int m_test = l - c; /* test, line 156 */
+                    if (!eq_s_b(data::s_13)) goto lab2; /* literal, line 156 */
+                    c = l - m_test;
+                }
+                return false;
+            lab2:
+                c = l - m2;
+            }
+            {   int m_test = l - c; /* test, line 156 */
+                {   int ret = hop(c, lb, l, -1); /* next, line 156 */
+                    if (ret < 0) return false;
+                    c = ret;
+                }
+                {   int m_test = l - c; /* test, line 156 */
+                    if (in_grouping_b(data::g_vowel, 97, 305, 0)) return false; /* grouping vowel, line 156 */
+                    c = l - m_test;
+                }
+                c = l - m_test;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_mark_suffix_with_optional_U_vowel() {
+        {   int m1 = l - c; (void)m1; /* or, line 161 */
+            {   int m_test = l - c; /* test, line 160 */
+                if (in_grouping_b(data::g_U, 105, 305, 0)) goto lab1; /* grouping U, line 160 */
+                c = l - m_test;
+            }
+            {   int ret = hop(c, lb, l, -1); /* next, line 160 */
+                if (ret < 0) goto lab1;
+                c = ret;
+            }
+            {   int m_test = l - c; /* test, line 160 */
+                if (out_grouping_b(data::g_vowel, 97, 305, 0)) goto lab1; /* non vowel, line 160 */
+                c = l - m_test;
+            }
+            goto lab0;
+        lab1:
+            c = l - m1;
+            {   int m2 = l - c; (void)m2; /* not, line 162 */
+                {   int m_test = l - c; /* test, line 162 */
+                    if (in_grouping_b(data::g_U, 105, 305, 0)) goto lab2; /* grouping U, line 162 */
+                    c = l - m_test;
+                }
+                return false;
+            lab2:
+                c = l - m2;
+            }
+            {   int m_test = l - c; /* test, line 162 */
+                {   int ret = hop(c, lb, l, -1); /* next, line 162 */
+                    if (ret < 0) return false;
+                    c = ret;
+                }
+                {   int m_test = l - c; /* test, line 162 */
+                    if (out_grouping_b(data::g_vowel, 97, 305, 0)) return false; /* non vowel, line 162 */
+                    c = l - m_test;
+                }
+                c = l - m_test;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_mark_possessives() {
+        if (c <= lb || p[c - 1] >> 5 != 3 || !((67133440 >> (p[c - 1] & 0x1f)) & 1)) return false; /* among, line 167 */
+        if (!find_among_b(data::a_0)) return false; /* among, line 167 */
+        if (!r_mark_suffix_with_optional_U_vowel()) return false; /* call mark_suffix_with_optional_U_vowel, line 169 */
+        return true;
+    }
+
+  private:
+    bool r_mark_sU() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 173 */
+        if (in_grouping_b(data::g_U, 105, 305, 0)) return false; /* grouping U, line 174 */
+        if (!r_mark_suffix_with_optional_s_consonant()) return false; /* call mark_suffix_with_optional_s_consonant, line 175 */
+        return true;
+    }
+
+  private:
+    bool r_mark_lArI() {
+        if (!find_among_b(data::a_1)) return false; /* among, line 179 */
+        return true;
+    }
+
+  private:
+    bool r_mark_yU() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 183 */
+        if (in_grouping_b(data::g_U, 105, 305, 0)) return false; /* grouping U, line 184 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 185 */
+        return true;
+    }
+
+  private:
+    bool r_mark_nU() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 189 */
+        if (!find_among_b(data::a_2)) return false; /* among, line 190 */
+        return true;
+    }
+
+  private:
+    bool r_mark_nUn() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 194 */
+        if (c - 1 <= lb || p[c - 1] != 110) return false; /* among, line 195 */
+        if (!find_among_b(data::a_3)) return false; /* among, line 195 */
+        if (!r_mark_suffix_with_optional_n_consonant()) return false; /* call mark_suffix_with_optional_n_consonant, line 196 */
+        return true;
+    }
+
+  private:
+    bool r_mark_yA() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 200 */
+        if (c <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 201 */
+        if (!find_among_b(data::a_4)) return false; /* among, line 201 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 202 */
+        return true;
+    }
+
+  private:
+    bool r_mark_nA() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 206 */
+        if (c - 1 <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 207 */
+        if (!find_among_b(data::a_5)) return false; /* among, line 207 */
+        return true;
+    }
+
+  private:
+    bool r_mark_DA() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 211 */
+        if (c - 1 <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 212 */
+        if (!find_among_b(data::a_6)) return false; /* among, line 212 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ndA() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 216 */
+        if (c - 2 <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 217 */
+        if (!find_among_b(data::a_7)) return false; /* among, line 217 */
+        return true;
+    }
+
+  private:
+    bool r_mark_DAn() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 221 */
+        if (c - 2 <= lb || p[c - 1] != 110) return false; /* among, line 222 */
+        if (!find_among_b(data::a_8)) return false; /* among, line 222 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ndAn() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 226 */
+        if (c - 3 <= lb || p[c - 1] != 110) return false; /* among, line 227 */
+        if (!find_among_b(data::a_9)) return false; /* among, line 227 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ylA() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 231 */
+        if (c - 1 <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 232 */
+        if (!find_among_b(data::a_10)) return false; /* among, line 232 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 233 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ki() {
+        if (!eq_s_b(data::s_14)) return false; /* literal, line 237 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ncA() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 241 */
+        if (c - 1 <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 242 */
+        if (!find_among_b(data::a_11)) return false; /* among, line 242 */
+        if (!r_mark_suffix_with_optional_n_consonant()) return false; /* call mark_suffix_with_optional_n_consonant, line 243 */
+        return true;
+    }
+
+  private:
+    bool r_mark_yUm() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 247 */
+        if (c - 1 <= lb || p[c - 1] != 109) return false; /* among, line 248 */
+        if (!find_among_b(data::a_12)) return false; /* among, line 248 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 249 */
+        return true;
+    }
+
+  private:
+    bool r_mark_sUn() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 253 */
+        if (c - 2 <= lb || p[c - 1] != 110) return false; /* among, line 254 */
+        if (!find_among_b(data::a_13)) return false; /* among, line 254 */
+        return true;
+    }
+
+  private:
+    bool r_mark_yUz() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 258 */
+        if (c - 1 <= lb || p[c - 1] != 122) return false; /* among, line 259 */
+        if (!find_among_b(data::a_14)) return false; /* among, line 259 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 260 */
+        return true;
+    }
+
+  private:
+    bool r_mark_sUnUz() {
+        if (c - 4 <= lb || p[c - 1] != 122) return false; /* among, line 264 */
+        if (!find_among_b(data::a_15)) return false; /* among, line 264 */
+        return true;
+    }
+
+  private:
+    bool r_mark_lAr() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 268 */
+        if (c - 2 <= lb || p[c - 1] != 114) return false; /* among, line 269 */
+        if (!find_among_b(data::a_16)) return false; /* among, line 269 */
+        return true;
+    }
+
+  private:
+    bool r_mark_nUz() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 273 */
+        if (c - 2 <= lb || p[c - 1] != 122) return false; /* among, line 274 */
+        if (!find_among_b(data::a_17)) return false; /* among, line 274 */
+        return true;
+    }
+
+  private:
+    bool r_mark_DUr() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 278 */
+        if (c - 2 <= lb || p[c - 1] != 114) return false; /* among, line 279 */
+        if (!find_among_b(data::a_18)) return false; /* among, line 279 */
+        return true;
+    }
+
+  private:
+    bool r_mark_cAsInA() {
+        if (c - 5 <= lb || (p[c - 1] != 97 && p[c - 1] != 101)) return false; /* among, line 283 */
+        if (!find_among_b(data::a_19)) return false; /* among, line 283 */
+        return true;
+    }
+
+  private:
+    bool r_mark_yDU() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 287 */
+        if (!find_among_b(data::a_20)) return false; /* among, line 288 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 292 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ysA() {
+        if (c - 1 <= lb || p[c - 1] >> 5 != 3 || !((26658 >> (p[c - 1] & 0x1f)) & 1)) return false; /* among, line 297 */
+        if (!find_among_b(data::a_21)) return false; /* among, line 297 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 298 */
+        return true;
+    }
+
+  private:
+    bool r_mark_ymUs_() {
+        if (!r_check_vowel_harmony()) return false; /* call check_vowel_harmony, line 302 */
+        if (!find_among_b(data::a_22)) return false; /* among, line 303 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 304 */
+        return true;
+    }
+
+  private:
+    bool r_mark_yken() {
+        if (!eq_s_b(data::s_15)) return false; /* literal, line 308 */
+        if (!r_mark_suffix_with_optional_y_consonant()) return false; /* call mark_suffix_with_optional_y_consonant, line 308 */
+        return true;
+    }
+
+  private:
+    bool r_stem_nominal_verb_suffixes() {
+        ket = c; /* [, line 312 */
+        B_continue_stemming_noun_suffixes = true; /* set continue_stemming_noun_suffixes, line 313 */
+        {   int m1 = l - c; (void)m1; /* or, line 315 */
+            {   int m2 = l - c; (void)m2; /* or, line 314 */
+                if (!r_mark_ymUs_()) goto lab3; /* call mark_ymUs_, line 314 */
+                goto lab2;
+            lab3:
+                c = l - m2;
+                if (!r_mark_yDU()) goto lab4; /* call mark_yDU, line 314 */
+                goto lab2;
+            lab4:
+                c = l - m2;
+                if (!r_mark_ysA()) goto lab5; /* call mark_ysA, line 314 */
+                goto lab2;
+            lab5:
+                c = l - m2;
+                if (!r_mark_yken()) goto lab1; /* call mark_yken, line 314 */
+            }
+        lab2:
+            goto lab0;
+        lab1:
+            c = l - m1;
+            if (!r_mark_cAsInA()) goto lab6; /* call mark_cAsInA, line 316 */
+            {   int m3 = l - c; (void)m3; /* or, line 316 */
+                if (!r_mark_sUnUz()) goto lab8; /* call mark_sUnUz, line 316 */
+                goto lab7;
+            lab8:
+                c = l - m3;
+                if (!r_mark_lAr()) goto lab9; /* call mark_lAr, line 316 */
+                goto lab7;
+            lab9:
+                c = l - m3;
+                if (!r_mark_yUm()) goto lab10; /* call mark_yUm, line 316 */
+                goto lab7;
+            lab10:
+                c = l - m3;
+                if (!r_mark_sUn()) goto lab11; /* call mark_sUn, line 316 */
+                goto lab7;
+            lab11:
+                c = l - m3;
+                if (!r_mark_yUz()) goto lab12; /* call mark_yUz, line 316 */
+                goto lab7;
+            lab12:
+                c = l - m3;
+            }
+        lab7:
+            if (!r_mark_ymUs_()) goto lab6; /* call mark_ymUs_, line 316 */
+            goto lab0;
+        lab6:
+            c = l - m1;
+            if (!r_mark_lAr()) goto lab13; /* call mark_lAr, line 319 */
+            bra = c; /* ], line 319 */
+            slice_del(); /* delete, line 319 */
+            {   int m_keep = l - c; /* try, line 319 */
+                ket = c; /* [, line 319 */
+                {   int m4 = l - c; (void)m4; /* or, line 319 */
+                    if (!r_mark_DUr()) goto lab16; /* call mark_DUr, line 319 */
+                    goto lab15;
+                lab16:
+                    c = l - m4;
+                    if (!r_mark_yDU()) goto lab17; /* call mark_yDU, line 319 */
+                    goto lab15;
+                lab17:
+                    c = l - m4;
+                    if (!r_mark_ysA()) goto lab18; /* call mark_ysA, line 319 */
+                    goto lab15;
+                lab18:
+                    c = l - m4;
+                    if (!r_mark_ymUs_()) { c = l - m_keep; goto lab14; } /* call mark_ymUs_, line 319 */
+                }
+            lab15:
+            lab14:
+                ;
+            }
+            B_continue_stemming_noun_suffixes = false; /* unset continue_stemming_noun_suffixes, line 320 */
+            goto lab0;
+        lab13:
+            c = l - m1;
+            if (!r_mark_nUz()) goto lab19; /* call mark_nUz, line 323 */
+            {   int m5 = l - c; (void)m5; /* or, line 323 */
+                if (!r_mark_yDU()) goto lab21; /* call mark_yDU, line 323 */
+                goto lab20;
+            lab21:
+                c = l - m5;
+                if (!r_mark_ysA()) goto lab19; /* call mark_ysA, line 323 */
+            }
+        lab20:
+            goto lab0;
+        lab19:
+            c = l - m1;
+            {   int m6 = l - c; (void)m6; /* or, line 325 */
+                if (!r_mark_sUnUz()) goto lab24; /* call mark_sUnUz, line 325 */
+                goto lab23;
+            lab24:
+                c = l - m6;
+                if (!r_mark_yUz()) goto lab25; /* call mark_yUz, line 325 */
+                goto lab23;
+            lab25:
+                c = l - m6;
+                if (!r_mark_sUn()) goto lab26; /* call mark_sUn, line 325 */
+                goto lab23;
+            lab26:
+                c = l - m6;
+                if (!r_mark_yUm()) goto lab22; /* call mark_yUm, line 325 */
+            }
+        lab23:
+            bra = c; /* ], line 325 */
+            slice_del(); /* delete, line 325 */
+            {   int m_keep = l - c; /* try, line 325 */
+                ket = c; /* [, line 325 */
+                if (!r_mark_ymUs_()) { c = l - m_keep; goto lab27; } /* call mark_ymUs_, line 325 */
+            lab27:
+                ;
+            }
+            goto lab0;
+        lab22:
+            c = l - m1;
+            if (!r_mark_DUr()) return false; /* call mark_DUr, line 327 */
+            bra = c; /* ], line 327 */
+            slice_del(); /* delete, line 327 */
+            {   int m_keep = l - c; /* try, line 327 */
+                ket = c; /* [, line 327 */
+                {   int m7 = l - c; (void)m7; /* or, line 327 */
+                    if (!r_mark_sUnUz()) goto lab30; /* call mark_sUnUz, line 327 */
+                    goto lab29;
+                lab30:
+                    c = l - m7;
+                    if (!r_mark_lAr()) goto lab31; /* call mark_lAr, line 327 */
+                    goto lab29;
+                lab31:
+                    c = l - m7;
+                    if (!r_mark_yUm()) goto lab32; /* call mark_yUm, line 327 */
+                    goto lab29;
+                lab32:
+                    c = l - m7;
+                    if (!r_mark_sUn()) goto lab33; /* call mark_sUn, line 327 */
+                    goto lab29;
+                lab33:
+                    c = l - m7;
+                    if (!r_mark_yUz()) goto lab34; /* call mark_yUz, line 327 */
+                    goto lab29;
+                lab34:
+                    c = l - m7;
+                }
+            lab29:
+                if (!r_mark_ymUs_()) { c = l - m_keep; goto lab28; } /* call mark_ymUs_, line 327 */
+            lab28:
+                ;
+            }
+        }
+    lab0:
+        bra = c; /* ], line 328 */
+        slice_del(); /* delete, line 328 */
+        return true;
+    }
+
+  private:
+    bool r_stem_suffix_chain_before_ki() {
+        ket = c; /* [, line 333 */
+        if (!r_mark_ki()) return false; /* call mark_ki, line 334 */
+        {   int m1 = l - c; (void)m1; /* or, line 342 */
+            if (!r_mark_DA()) goto lab1; /* call mark_DA, line 336 */
+            bra = c; /* ], line 336 */
+            slice_del(); /* delete, line 336 */
+            {   int m_keep = l - c; /* try, line 336 */
+                ket = c; /* [, line 336 */
+                {   int m2 = l - c; (void)m2; /* or, line 338 */
+                    if (!r_mark_lAr()) goto lab4; /* call mark_lAr, line 337 */
+                    bra = c; /* ], line 337 */
+                    slice_del(); /* delete, line 337 */
+                    {   int m_keep = l - c; /* try, line 337 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab5; } /* call stem_suffix_chain_before_ki, line 337 */
+                    lab5:
+                        ;
+                    }
+                    goto lab3;
+                lab4:
+                    c = l - m2;
+                    if (!r_mark_possessives()) { c = l - m_keep; goto lab2; } /* call mark_possessives, line 339 */
+                    bra = c; /* ], line 339 */
+                    slice_del(); /* delete, line 339 */
+                    {   int m_keep = l - c; /* try, line 339 */
+                        ket = c; /* [, line 339 */
+                        if (!r_mark_lAr()) { c = l - m_keep; goto lab6; } /* call mark_lAr, line 339 */
+                        bra = c; /* ], line 339 */
+                        slice_del(); /* delete, line 339 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab6; } /* call stem_suffix_chain_before_ki, line 339 */
+                    lab6:
+                        ;
+                    }
+                }
+            lab3:
+            lab2:
+                ;
+            }
+            goto lab0;
+        lab1:
+            c = l - m1;
+            if (!r_mark_nUn()) goto lab7; /* call mark_nUn, line 343 */
+            bra = c; /* ], line 343 */
+            slice_del(); /* delete, line 343 */
+            {   int m_keep = l - c; /* try, line 343 */
+                ket = c; /* [, line 343 */
+                {   int m3 = l - c; (void)m3; /* or, line 345 */
+                    if (!r_mark_lArI()) goto lab10; /* call mark_lArI, line 344 */
+                    bra = c; /* ], line 344 */
+                    slice_del(); /* delete, line 344 */
+                    goto lab9;
+                lab10:
+                    c = l - m3;
+                    ket = c; /* [, line 346 */
+                    {   int m4 = l - c; (void)m4; /* or, line 346 */
+                        if (!r_mark_possessives()) goto lab13; /* call mark_possessives, line 346 */
+                        goto lab12;
+                    lab13:
+                        c = l - m4;
+                        if (!r_mark_sU()) goto lab11; /* call mark_sU, line 346 */
+                    }
+                lab12:
+                    bra = c; /* ], line 346 */
+                    slice_del(); /* delete, line 346 */
+                    {   int m_keep = l - c; /* try, line 346 */
+                        ket = c; /* [, line 346 */
+                        if (!r_mark_lAr()) { c = l - m_keep; goto lab14; } /* call mark_lAr, line 346 */
+                        bra = c; /* ], line 346 */
+                        slice_del(); /* delete, line 346 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab14; } /* call stem_suffix_chain_before_ki, line 346 */
+                    lab14:
+                        ;
+                    }
+                    goto lab9;
+                lab11:
+                    c = l - m3;
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab8; } /* call stem_suffix_chain_before_ki, line 348 */
+                }
+            lab9:
+            lab8:
+                ;
+            }
+            goto lab0;
+        lab7:
+            c = l - m1;
+            if (!r_mark_ndA()) return false; /* call mark_ndA, line 351 */
+            {   int m5 = l - c; (void)m5; /* or, line 353 */
+                if (!r_mark_lArI()) goto lab16; /* call mark_lArI, line 352 */
+                bra = c; /* ], line 352 */
+                slice_del(); /* delete, line 352 */
+                goto lab15;
+            lab16:
+                c = l - m5;
+                if (!r_mark_sU()) goto lab17; /* call mark_sU, line 354 */
+                bra = c; /* ], line 354 */
+                slice_del(); /* delete, line 354 */
+                {   int m_keep = l - c; /* try, line 354 */
+                    ket = c; /* [, line 354 */
+                    if (!r_mark_lAr()) { c = l - m_keep; goto lab18; } /* call mark_lAr, line 354 */
+                    bra = c; /* ], line 354 */
+                    slice_del(); /* delete, line 354 */
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab18; } /* call stem_suffix_chain_before_ki, line 354 */
+                lab18:
+                    ;
+                }
+                goto lab15;
+            lab17:
+                c = l - m5;
+                if (!r_stem_suffix_chain_before_ki()) return false; /* call stem_suffix_chain_before_ki, line 356 */
+            }
+        lab15:
+            ;
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_stem_noun_suffixes() {
+        {   int m1 = l - c; (void)m1; /* or, line 363 */
+            ket = c; /* [, line 362 */
+            if (!r_mark_lAr()) goto lab1; /* call mark_lAr, line 362 */
+            bra = c; /* ], line 362 */
+            slice_del(); /* delete, line 362 */
+            {   int m_keep = l - c; /* try, line 362 */
+                if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab2; } /* call stem_suffix_chain_before_ki, line 362 */
+            lab2:
+                ;
+            }
+            goto lab0;
+        lab1:
+            c = l - m1;
+            ket = c; /* [, line 364 */
+            if (!r_mark_ncA()) goto lab3; /* call mark_ncA, line 364 */
+            bra = c; /* ], line 364 */
+            slice_del(); /* delete, line 364 */
+            {   int m_keep = l - c; /* try, line 365 */
+                {   int m2 = l - c; (void)m2; /* or, line 367 */
+                    ket = c; /* [, line 366 */
+                    if (!r_mark_lArI()) goto lab6; /* call mark_lArI, line 366 */
+                    bra = c; /* ], line 366 */
+                    slice_del(); /* delete, line 366 */
+                    goto lab5;
+                lab6:
+                    c = l - m2;
+                    ket = c; /* [, line 368 */
+                    {   int m3 = l - c; (void)m3; /* or, line 368 */
+                        if (!r_mark_possessives()) goto lab9; /* call mark_possessives, line 368 */
+                        goto lab8;
+                    lab9:
+                        c = l - m3;
+                        if (!r_mark_sU()) goto lab7; /* call mark_sU, line 368 */
+                    }
+                lab8:
+                    bra = c; /* ], line 368 */
+                    slice_del(); /* delete, line 368 */
+                    {   int m_keep = l - c; /* try, line 368 */
+                        ket = c; /* [, line 368 */
+                        if (!r_mark_lAr()) { c = l - m_keep; goto lab10; } /* call mark_lAr, line 368 */
+                        bra = c; /* ], line 368 */
+                        slice_del(); /* delete, line 368 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab10; } /* call stem_suffix_chain_before_ki, line 368 */
+                    lab10:
+                        ;
+                    }
+                    goto lab5;
+                lab7:
+                    c = l - m2;
+                    ket = c; /* [, line 370 */
+                    if (!r_mark_lAr()) { c = l - m_keep; goto lab4; } /* call mark_lAr, line 370 */
+                    bra = c; /* ], line 370 */
+                    slice_del(); /* delete, line 370 */
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab4; } /* call stem_suffix_chain_before_ki, line 370 */
+                }
+            lab5:
+            lab4:
+                ;
+            }
+            goto lab0;
+        lab3:
+            c = l - m1;
+            ket = c; /* [, line 374 */
+            {   int m4 = l - c; (void)m4; /* or, line 374 */
+                if (!r_mark_ndA()) goto lab13; /* call mark_ndA, line 374 */
+                goto lab12;
+            lab13:
+                c = l - m4;
+                if (!r_mark_nA()) goto lab11; /* call mark_nA, line 374 */
+            }
+        lab12:
+            {   int m5 = l - c; (void)m5; /* or, line 377 */
+                if (!r_mark_lArI()) goto lab15; /* call mark_lArI, line 376 */
+                bra = c; /* ], line 376 */
+                slice_del(); /* delete, line 376 */
+                goto lab14;
+            lab15:
+                c = l - m5;
+                if (!r_mark_sU()) goto lab16; /* call mark_sU, line 378 */
+                bra = c; /* ], line 378 */
+                slice_del(); /* delete, line 378 */
+                {   int m_keep = l - c; /* try, line 378 */
+                    ket = c; /* [, line 378 */
+                    if (!r_mark_lAr()) { c = l - m_keep; goto lab17; } /* call mark_lAr, line 378 */
+                    bra = c; /* ], line 378 */
+                    slice_del(); /* delete, line 378 */
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab17; } /* call stem_suffix_chain_before_ki, line 378 */
+                lab17:
+                    ;
+                }
+                goto lab14;
+            lab16:
+                c = l - m5;
+                if (!r_stem_suffix_chain_before_ki()) goto lab11; /* call stem_suffix_chain_before_ki, line 380 */
+            }
+        lab14:
+            goto lab0;
+        lab11:
+            c = l - m1;
+            ket = c; /* [, line 384 */
+            {   int m6 = l - c; (void)m6; /* or, line 384 */
+                if (!r_mark_ndAn()) goto lab20; /* call mark_ndAn, line 384 */
+                goto lab19;
+            lab20:
+                c = l - m6;
+                if (!r_mark_nU()) goto lab18; /* call mark_nU, line 384 */
+            }
+        lab19:
+            {   int m7 = l - c; (void)m7; /* or, line 384 */
+                if (!r_mark_sU()) goto lab22; /* call mark_sU, line 384 */
+                bra = c; /* ], line 384 */
+                slice_del(); /* delete, line 384 */
+                {   int m_keep = l - c; /* try, line 384 */
+                    ket = c; /* [, line 384 */
+                    if (!r_mark_lAr()) { c = l - m_keep; goto lab23; } /* call mark_lAr, line 384 */
+                    bra = c; /* ], line 384 */
+                    slice_del(); /* delete, line 384 */
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab23; } /* call stem_suffix_chain_before_ki, line 384 */
+                lab23:
+                    ;
+                }
+                goto lab21;
+            lab22:
+                c = l - m7;
+                if (!r_mark_lArI()) goto lab18; /* call mark_lArI, line 384 */
+            }
+        lab21:
+            goto lab0;
+        lab18:
+            c = l - m1;
+            ket = c; /* [, line 386 */
+            if (!r_mark_DAn()) goto lab24; /* call mark_DAn, line 386 */
+            bra = c; /* ], line 386 */
+            slice_del(); /* delete, line 386 */
+            {   int m_keep = l - c; /* try, line 386 */
+                ket = c; /* [, line 386 */
+                {   int m8 = l - c; (void)m8; /* or, line 389 */
+                    if (!r_mark_possessives()) goto lab27; /* call mark_possessives, line 388 */
+                    bra = c; /* ], line 388 */
+                    slice_del(); /* delete, line 388 */
+                    {   int m_keep = l - c; /* try, line 388 */
+                        ket = c; /* [, line 388 */
+                        if (!r_mark_lAr()) { c = l - m_keep; goto lab28; } /* call mark_lAr, line 388 */
+                        bra = c; /* ], line 388 */
+                        slice_del(); /* delete, line 388 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab28; } /* call stem_suffix_chain_before_ki, line 388 */
+                    lab28:
+                        ;
+                    }
+                    goto lab26;
+                lab27:
+                    c = l - m8;
+                    if (!r_mark_lAr()) goto lab29; /* call mark_lAr, line 390 */
+                    bra = c; /* ], line 390 */
+                    slice_del(); /* delete, line 390 */
+                    {   int m_keep = l - c; /* try, line 390 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab30; } /* call stem_suffix_chain_before_ki, line 390 */
+                    lab30:
+                        ;
+                    }
+                    goto lab26;
+                lab29:
+                    c = l - m8;
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab25; } /* call stem_suffix_chain_before_ki, line 392 */
+                }
+            lab26:
+            lab25:
+                ;
+            }
+            goto lab0;
+        lab24:
+            c = l - m1;
+            ket = c; /* [, line 396 */
+            {   int m9 = l - c; (void)m9; /* or, line 396 */
+                if (!r_mark_nUn()) goto lab33; /* call mark_nUn, line 396 */
+                goto lab32;
+            lab33:
+                c = l - m9;
+                if (!r_mark_ylA()) goto lab31; /* call mark_ylA, line 396 */
+            }
+        lab32:
+            bra = c; /* ], line 396 */
+            slice_del(); /* delete, line 396 */
+            {   int m_keep = l - c; /* try, line 397 */
+                {   int m10 = l - c; (void)m10; /* or, line 399 */
+                    ket = c; /* [, line 398 */
+                    if (!r_mark_lAr()) goto lab36; /* call mark_lAr, line 398 */
+                    bra = c; /* ], line 398 */
+                    slice_del(); /* delete, line 398 */
+                    if (!r_stem_suffix_chain_before_ki()) goto lab36; /* call stem_suffix_chain_before_ki, line 398 */
+                    goto lab35;
+                lab36:
+                    c = l - m10;
+                    ket = c; /* [, line 400 */
+                    {   int m11 = l - c; (void)m11; /* or, line 400 */
+                        if (!r_mark_possessives()) goto lab39; /* call mark_possessives, line 400 */
+                        goto lab38;
+                    lab39:
+                        c = l - m11;
+                        if (!r_mark_sU()) goto lab37; /* call mark_sU, line 400 */
+                    }
+                lab38:
+                    bra = c; /* ], line 400 */
+                    slice_del(); /* delete, line 400 */
+                    {   int m_keep = l - c; /* try, line 400 */
+                        ket = c; /* [, line 400 */
+                        if (!r_mark_lAr()) { c = l - m_keep; goto lab40; } /* call mark_lAr, line 400 */
+                        bra = c; /* ], line 400 */
+                        slice_del(); /* delete, line 400 */
+                        if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab40; } /* call stem_suffix_chain_before_ki, line 400 */
+                    lab40:
+                        ;
+                    }
+                    goto lab35;
+                lab37:
+                    c = l - m10;
+                    if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab34; } /* call stem_suffix_chain_before_ki, line 402 */
+                }
+            lab35:
+            lab34:
+                ;
+            }
+            goto lab0;
+        lab31:
+            c = l - m1;
+            ket = c; /* [, line 406 */
+            if (!r_mark_lArI()) goto lab41; /* call mark_lArI, line 406 */
+            bra = c; /* ], line 406 */
+            slice_del(); /* delete, line 406 */
+            goto lab0;
+        lab41:
+            c = l - m1;
+            if (!r_stem_suffix_chain_before_ki()) goto lab42; /* call stem_suffix_chain_before_ki, line 408 */
+            goto lab0;
+        lab42:
+            c = l - m1;
+            ket = c; /* [, line 410 */
+            {   int m12 = l - c; (void)m12; /* or, line 410 */
+                if (!r_mark_DA()) goto lab45; /* call mark_DA, line 410 */
+                goto lab44;
+            lab45:
+                c = l - m12;
+                if (!r_mark_yU()) goto lab46; /* call mark_yU, line 410 */
+                goto lab44;
+            lab46:
+                c = l - m12;
+                if (!r_mark_yA()) goto lab43; /* call mark_yA, line 410 */
+            }
+        lab44:
+            bra = c; /* ], line 410 */
+            slice_del(); /* delete, line 410 */
+            {   int m_keep = l - c; /* try, line 410 */
+                ket = c; /* [, line 410 */
+                {   int m13 = l - c; (void)m13; /* or, line 410 */
+                    if (!r_mark_possessives()) goto lab49; /* call mark_possessives, line 410 */
+                    bra = c; /* ], line 410 */
+                    slice_del(); /* delete, line 410 */
+                    {   int m_keep = l - c; /* try, line 410 */
+                        ket = c; /* [, line 410 */
+                        if (!r_mark_lAr()) { c = l - m_keep; goto lab50; } /* call mark_lAr, line 410 */
+                    lab50:
+                        ;
+                    }
+                    goto lab48;
+                lab49:
+                    c = l - m13;
+                    if (!r_mark_lAr()) { c = l - m_keep; goto lab47; } /* call mark_lAr, line 410 */
+                }
+            lab48:
+                bra = c; /* ], line 410 */
+                slice_del(); /* delete, line 410 */
+                ket = c; /* [, line 410 */
+                if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab47; } /* call stem_suffix_chain_before_ki, line 410 */
+            lab47:
+                ;
+            }
+            goto lab0;
+        lab43:
+            c = l - m1;
+            ket = c; /* [, line 412 */
+            {   int m14 = l - c; (void)m14; /* or, line 412 */
+                if (!r_mark_possessives()) goto lab52; /* call mark_possessives, line 412 */
+                goto lab51;
+            lab52:
+                c = l - m14;
+                if (!r_mark_sU()) return false; /* call mark_sU, line 412 */
+            }
+        lab51:
+            bra = c; /* ], line 412 */
+            slice_del(); /* delete, line 412 */
+            {   int m_keep = l - c; /* try, line 412 */
+                ket = c; /* [, line 412 */
+                if (!r_mark_lAr()) { c = l - m_keep; goto lab53; } /* call mark_lAr, line 412 */
+                bra = c; /* ], line 412 */
+                slice_del(); /* delete, line 412 */
+                if (!r_stem_suffix_chain_before_ki()) { c = l - m_keep; goto lab53; } /* call stem_suffix_chain_before_ki, line 412 */
+            lab53:
+                ;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_post_process_last_consonants() {
+        int among_var;
+        ket = c; /* [, line 416 */
+        among_var = find_among_b(data::a_23); /* substring, line 416 */
+        if (!among_var) return false;
+        bra = c; /* ], line 416 */
+        switch(among_var) {
+            case 0: return false;
+            case 1:
+                slice_from(data::s_16); /* <-, line 417 */
+                break;
+            case 2:
+                slice_from(data::s_17); /* <-, line 418 */
+                break;
+            case 3:
+                slice_from(data::s_18); /* <-, line 419 */
+                break;
+            case 4:
+                slice_from(data::s_19); /* <-, line 420 */
+                break;
+        }
+        return true;
+    }
+
+  private:
+    bool r_append_U_to_stems_ending_with_d_or_g() {
+        {   int m_test = l - c; /* test, line 431 */
+            {   int m1 = l - c; (void)m1; /* or, line 431 */
+                if (!eq_s_b(data::s_20)) goto lab1; /* literal, line 431 */
+                goto lab0;
+            lab1:
+                c = l - m1;
+                if (!eq_s_b(data::s_21)) return false; /* literal, line 431 */
+            }
+        lab0:
+            c = l - m_test;
+        }
+        {   int m2 = l - c; (void)m2; /* or, line 433 */
+            {   int m_test = l - c; /* test, line 432 */
+                if (out_grouping_b(data::g_vowel, 97, 305, 1) < 0) goto lab3; /* goto */ /* grouping vowel, line 432 */
+                {   int m3 = l - c; (void)m3; /* or, line 432 */
+                    if (!eq_s_b(data::s_22)) goto lab5; /* literal, line 432 */
+                    goto lab4;
+                lab5:
+                    c = l - m3;
+                    if (!eq_s_b(data::s_23)) goto lab3; /* literal, line 432 */
+                }
+            lab4:
+                c = l - m_test;
+            }
+            {   int c_keep = c; /* <+, line 432 */
+                insert(c, c, data::s_24);
+                c = c_keep;
+            }
+            goto lab2;
+        lab3:
+            c = l - m2;
+            {   int m_test = l - c; /* test, line 434 */
+                if (out_grouping_b(data::g_vowel, 97, 305, 1) < 0) goto lab6; /* goto */ /* grouping vowel, line 434 */
+                {   int m4 = l - c; (void)m4; /* or, line 434 */
+                    if (!eq_s_b(data::s_25)) goto lab8; /* literal, line 434 */
+                    goto lab7;
+                lab8:
+                    c = l - m4;
+                    if (!eq_s_b(data::s_26)) goto lab6; /* literal, line 434 */
+                }
+            lab7:
+                c = l - m_test;
+            }
+            {   int c_keep = c; /* <+, line 434 */
+                insert(c, c, data::s_27);
+                c = c_keep;
+            }
+            goto lab2;
+        lab6:
+            c = l - m2;
+            {   int m_test = l - c; /* test, line 436 */
+                if (out_grouping_b(data::g_vowel, 97, 305, 1) < 0) goto lab9; /* goto */ /* grouping vowel, line 436 */
+                {   int m5 = l - c; (void)m5; /* or, line 436 */
+                    if (!eq_s_b(data::s_28)) goto lab11; /* literal, line 436 */
+                    goto lab10;
+                lab11:
+                    c = l - m5;
+                    if (!eq_s_b(data::s_29)) goto lab9; /* literal, line 436 */
+                }
+            lab10:
+                c = l - m_test;
+            }
+            {   int c_keep = c; /* <+, line 436 */
+                insert(c, c, data::s_30);
+                c = c_keep;
+            }
+            goto lab2;
+        lab9:
+            c = l - m2;
+            {   int m_test = l - c; /* test, line 438 */
+                if (out_grouping_b(data::g_vowel, 97, 305, 1) < 0) return false; /* goto */ /* grouping vowel, line 438 */
+                {   int m6 = l - c; (void)m6; /* or, line 438 */
+                    if (!eq_s_b(data::s_31)) goto lab13; /* literal, line 438 */
+                    goto lab12;
+                lab13:
+                    c = l - m6;
+                    if (!eq_s_b(data::s_32)) return false; /* literal, line 438 */
+                }
+            lab12:
+                c = l - m_test;
+            }
+            {   int c_keep = c; /* <+, line 438 */
+                insert(c, c, data::s_33);
+                c = c_keep;
+            }
+        }
+    lab2:
+        return true;
+    }
+
+  private:
+    bool r_more_than_one_syllable_word() {
+        {   int c_test = c; /* test, line 446 */
+            {   int i = 2;
+                while(1) { /* atleast, line 446 */
+                    int c1 = c;
+                    {    /* gopast */ /* grouping vowel, line 446 */
+                        int ret = out_grouping(data::g_vowel, 97, 305, 1);
+                        if (ret < 0) goto lab0;
+                        c += ret;
+                    }
+                    i--;
+                    continue;
+                lab0:
+                    c = c1;
+                    break;
+                }
+                if (i > 0) return false;
+            }
+            c = c_test;
+        }
+        return true;
+    }
+
+  private:
+    bool r_is_reserved_word() {
+        {   int c1 = c; /* or, line 451 */
+            {   int c_test = c; /* test, line 450 */
+                while(1) { /* gopast, line 450 */
+                    if (!eq_s(data::s_34)) goto lab2; /* literal, line 450 */
+                    break;
+                lab2:
+                    {   int ret = hop(c, 0, l, 1); /* gopast, line 450 */
+                        if (ret < 0) goto lab1;
+                        c = ret;
+                    }
+                }
+                I_strlen = 2; /* $strlen = <integer expression>, line 450 */
+                if (!(I_strlen == l)) goto lab1; /* $strlen == <integer expression>, line 450 */
+                c = c_test;
+            }
+            goto lab0;
+        lab1:
+            c = c1;
+            {   int c_test = c; /* test, line 452 */
+                while(1) { /* gopast, line 452 */
+                    if (!eq_s(data::s_35)) goto lab3; /* literal, line 452 */
+                    break;
+                lab3:
+                    {   int ret = hop(c, 0, l, 1); /* gopast, line 452 */
+                        if (ret < 0) return false;
+                        c = ret;
+                    }
+                }
+                I_strlen = 5; /* $strlen = <integer expression>, line 452 */
+                if (!(I_strlen == l)) return false; /* $strlen == <integer expression>, line 452 */
+                c = c_test;
+            }
+        }
+    lab0:
+        return true;
+    }
+
+  private:
+    bool r_postlude() {
+        {   int c1 = c; /* not, line 456 */
+            if (!r_is_reserved_word()) goto lab0; /* call is_reserved_word, line 456 */
+            return false;
+        lab0:
+            c = c1;
+        }
+        lb = c; c = l; /* backwards, line 457 */
+
+        {   int m2 = l - c; (void)m2; /* do, line 458 */
+            if (!r_append_U_to_stems_ending_with_d_or_g()) goto lab1; /* call append_U_to_stems_ending_with_d_or_g, line 458 */
+        lab1:
+            c = l - m2;
+        }
+        {   int m3 = l - c; (void)m3; /* do, line 459 */
+            if (!r_post_process_last_consonants()) goto lab2; /* call post_process_last_consonants, line 459 */
+        lab2:
+            c = l - m3;
+        }
+        c = lb;
+        return true;
+    }
+
+  public:
+    bool stem() {
+        if (!r_more_than_one_syllable_word()) return false; /* call more_than_one_syllable_word, line 465 */
+        lb = c; c = l; /* backwards, line 467 */
+
+        {   int m1 = l - c; (void)m1; /* do, line 468 */
+            if (!r_stem_nominal_verb_suffixes()) goto lab0; /* call stem_nominal_verb_suffixes, line 468 */
+        lab0:
+            c = l - m1;
+        }
+        if (!B_continue_stemming_noun_suffixes) return false; /* Boolean test continue_stemming_noun_suffixes, line 469 */
+        {   int m2 = l - c; (void)m2; /* do, line 470 */
+            if (!r_stem_noun_suffixes()) goto lab1; /* call stem_noun_suffixes, line 470 */
+        lab1:
+            c = l - m2;
+        }
+        c = lb;
+        if (!r_postlude()) return false; /* call postlude, line 473 */
+        return true;
+    }
+
+  private:
+    bool B_continue_stemming_noun_suffixes = false;
+    int I_strlen = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,27 @@
+/* Stems the words read one per line from stdin with a program compiled
+   by 'snowball X.sbl -O -o X', to compare against 'snowball X.sbl -eval'.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "header.h"
+
+extern struct SN_env * create_env(void);
+extern void close_env(struct SN_env * z);
+extern int stem(struct SN_env * z);
+
+int main(void) {
+    struct SN_env * z = create_env();
+    char line[1024];
+    while (fgets(line, sizeof line, stdin) != NULL) {
+        int n = strlen(line);
+        if (n > 0 && line[n - 1] == '\n') n--;
+        SN_set_current(z, n, (const symbol *) line);
+        stem(z);
+        fwrite(z->p, 1, z->l, stdout);
+        putchar('\n');
+    }
+    close_env(z);
+    return 0;
+}